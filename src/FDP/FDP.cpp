@@ -33,15 +33,25 @@
 #    define PAUSE           _mm_pause()
 
 #else
+#    include <arpa/inet.h>
 #    include <fcntl.h>
+#    include <linux/futex.h>
+#    include <netdb.h>
+#    include <netinet/in.h>
+#    include <netinet/tcp.h>
 #    include <sys/mman.h>
 #    include <sys/shm.h>
+#    include <sys/socket.h>
 #    include <sys/stat.h>
+#    include <sys/syscall.h>
 #    include <unistd.h>
 #    define FORCE_INLINE    inline __attribute__((__always_inline__))
 #    define PAUSE           asm("pause")
 #endif
 
+#include <climits>
+#include <ctime>
+
 #include <cstring>
 #include <random>
 #include <thread>
@@ -55,8 +65,11 @@ namespace
         static constexpr bool ok = true;
     };
 #define STATIC_ASSERT_EQ(A, B) static_assert(!!expect_eq<A, B>::ok, "");
-    STATIC_ASSERT_EQ(sizeof(FDP_SHM_CANAL), FDP_MAX_DATA_SIZE + 8);
-    STATIC_ASSERT_EQ(sizeof(FDP_SHM_SHARED), 2 * sizeof(FDP_SHM_CANAL) + 4);
+    STATIC_ASSERT_EQ(sizeof(FDP_SHM_CANAL), FDP_MAX_DATA_SIZE + 2 * FDP_CACHE_LINE);
+    STATIC_ASSERT_EQ(sizeof(FDP_SHM_RING), FDP_RING_SLOT_COUNT * (FDP_RING_SLOT_SIZE + 8) + 8);
+    STATIC_ASSERT_EQ(sizeof(FDP_PARALLEL_CANAL), 2 * sizeof(FDP_SMALL_CANAL) + 4);
+    STATIC_ASSERT_EQ(sizeof(FDP_BP_SHADOW_ENTRY), 11);
+    STATIC_ASSERT_EQ(sizeof(FDP_SHM_SHARED), 2 * sizeof(FDP_SHM_CANAL) + 2 * sizeof(FDP_SHM_RING) + sizeof(FDP_EVENT_QUEUE) + FDP_PARALLEL_CANAL_COUNT * sizeof(FDP_PARALLEL_CANAL) + FDP_MAX_BREAKPOINT * sizeof(FDP_BP_SHADOW_ENTRY) + sizeof(FDP_TELEMETRY) + 2 * FDP_CACHE_LINE + 8);
 
     constexpr size_t max_wait_iters    = 0x100000;
     constexpr size_t min_backoff_iters = 0x20;
@@ -106,12 +119,42 @@ namespace
     {
         ttas_spinlock_unlock(&FDPShm->lock);
     }
+
+    // OS-level wakeup on the canal wakeup word, used once spinning gave up.
+    // Waits are bounded so a missed wakeup only costs one timeout.
+    constexpr uint64_t default_sleep_ns = 1000 * 1000; // 1ms
+
+    FORCE_INLINE void wait_on_address(std::atomic<uint32_t>* addr, uint32_t last_seen, uint64_t sleep_ns)
+    {
+#ifdef _MSC_VER
+        WaitOnAddress(addr, &last_seen, sizeof last_seen, (DWORD) (sleep_ns / (1000 * 1000) + 1));
+#else
+        struct timespec timeout = {0, (long) sleep_ns};
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAIT, last_seen, &timeout, nullptr, 0);
+#endif
+    }
+
+    FORCE_INLINE uint64_t NowNs()
+    {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    }
+
+    FORCE_INLINE void wake_address(std::atomic<uint32_t>* addr)
+    {
+#ifdef _MSC_VER
+        WakeByAddressAll(addr);
+#else
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
 }
 
-static bool WriteFDPDataWithStatus(FDP_SHM_CANAL* pFDPCanal, uint8_t* pData, uint32_t DataSize, bool bStatus)
+template <typename CANAL>
+static bool WriteFDPDataWithStatus(CANAL* pFDPCanal, uint8_t* pData, uint32_t DataSize, bool bStatus, uint64_t DeadlineNs = 0)
 {
     bool dataWritten = false;
-    if(DataSize > FDP_MAX_DATA_SIZE)
+    if(DataSize > sizeof pFDPCanal->data)
     {
         return false;
     }
@@ -128,45 +171,66 @@ static bool WriteFDPDataWithStatus(FDP_SHM_CANAL* pFDPCanal, uint8_t* pData, uin
             dataWritten             = true;
         }
         ttas_spinlock_unlock(&pFDPCanal->lock);
+        if(!dataWritten && DeadlineNs != 0 && NowNs() >= DeadlineNs)
+        {
+            // the previous payload was never consumed before the deadline
+            return false;
+        }
     } while(!dataWritten);
+    pFDPCanal->wakeup.fetch_add(1, std::memory_order_release);
+    wake_address(&pFDPCanal->wakeup);
     return true;
 }
 
-static bool WriteFDPData(FDP_SHM_CANAL* pFDPCanal, uint8_t* pData, uint32_t DataSize)
+template <typename CANAL>
+static bool WriteFDPData(CANAL* pFDPCanal, uint8_t* pData, uint32_t DataSize, uint64_t DeadlineNs = 0)
 {
-    return WriteFDPDataWithStatus(pFDPCanal, pData, DataSize, true);
+    return WriteFDPDataWithStatus(pFDPCanal, pData, DataSize, true, DeadlineNs);
 }
 
 namespace
 {
-    FORCE_INLINE void wait_until_bool_is(std::atomic_bool* lock, bool value)
+    template <typename CANAL>
+    FORCE_INLINE bool wait_until_data_present(CANAL* pFDPCanal, size_t spin_budget = max_wait_iters, uint64_t sleep_ns = default_sleep_ns, uint64_t deadline_ns = 0)
     {
         size_t num_iters = 0;
-        while(lock->load(std::memory_order_relaxed) != value)
+        while(!pFDPCanal->bDataPresent.load(std::memory_order_relaxed))
         {
-            if(num_iters < max_wait_iters)
+            if(num_iters < spin_budget)
             {
                 ++num_iters;
                 PAUSE;
+                continue;
             }
-            else
-            {
-                yield_sleep();
-            }
+            if(deadline_ns != 0 && NowNs() >= deadline_ns)
+                return false;
+
+            // spin budget exhausted, block until the writer bumps the
+            // wakeup word instead of sleeping a fixed 500us
+            const auto last_seen = pFDPCanal->wakeup.load(std::memory_order_acquire);
+            if(pFDPCanal->bDataPresent.load(std::memory_order_relaxed))
+                return true;
+
+            wait_on_address(&pFDPCanal->wakeup, last_seen, sleep_ns);
         }
+        return true;
     }
 }
 
-static uint32_t ReadFDPDataWithStatus(FDP_SHM_CANAL* pFDPCanal, uint8_t* buffer, bool* pbStatus)
+template <typename CANAL>
+static uint32_t ReadFDPDataWithStatus(CANAL* pFDPCanal, uint8_t* buffer, bool* pbStatus, size_t SpinBudget = max_wait_iters, uint64_t SleepNs = default_sleep_ns, uint64_t DeadlineNs = 0)
 {
     uint32_t dataReadSize = 0;
     do
     {
-        wait_until_bool_is(&pFDPCanal->bDataPresent, true);
+        if(!wait_until_data_present(pFDPCanal, SpinBudget, SleepNs, DeadlineNs))
+        {
+            return 0;
+        }
         ttas_spinlock_lock(&pFDPCanal->lock);
         if(pFDPCanal->bDataPresent)
         {
-            if(pFDPCanal->dataSize < FDP_MAX_DATA_SIZE)
+            if(pFDPCanal->dataSize < sizeof pFDPCanal->data)
                 memcpy(buffer, (char*) pFDPCanal->data, pFDPCanal->dataSize);
             dataReadSize            = pFDPCanal->dataSize;
             *pbStatus               = pFDPCanal->bStatus;
@@ -177,10 +241,79 @@ static uint32_t ReadFDPDataWithStatus(FDP_SHM_CANAL* pFDPCanal, uint8_t* buffer,
     return dataReadSize;
 }
 
-FORCE_INLINE static uint32_t ReadFDPData(FDP_SHM_CANAL* pFDPCanal, uint8_t* buffer)
+template <typename CANAL>
+FORCE_INLINE static uint32_t ReadFDPData(CANAL* pFDPCanal, uint8_t* buffer, size_t SpinBudget = max_wait_iters, uint64_t SleepNs = default_sleep_ns)
 {
     bool bIsSuccess;
-    return ReadFDPDataWithStatus(pFDPCanal, buffer, &bIsSuccess);
+    return ReadFDPDataWithStatus(pFDPCanal, buffer, &bIsSuccess, SpinBudget, SleepNs);
+}
+
+static bool RingPush(FDP_SHM_RING* pRing, const uint8_t* pData, uint32_t DataSize, bool bStatus)
+{
+    if(DataSize == 0 || DataSize > FDP_RING_SLOT_SIZE)
+    {
+        return false;
+    }
+    const uint32_t writeIndex = pRing->writeIndex.load(std::memory_order_relaxed);
+    const uint32_t readIndex  = pRing->readIndex.load(std::memory_order_acquire);
+    if(writeIndex - readIndex >= FDP_RING_SLOT_COUNT)
+    {
+        return false; // ring is full
+    }
+    FDP_RING_SLOT* pSlot = &pRing->slots[writeIndex % FDP_RING_SLOT_COUNT];
+    memcpy((void*) pSlot->data, pData, DataSize);
+    pSlot->dataSize = DataSize;
+    pSlot->bStatus  = bStatus;
+    pRing->writeIndex.store(writeIndex + 1, std::memory_order_release);
+    return true;
+}
+
+static uint32_t RingPop(FDP_SHM_RING* pRing, uint8_t* pBuffer, uint32_t MaxSize, bool* pbStatus)
+{
+    const uint32_t readIndex  = pRing->readIndex.load(std::memory_order_relaxed);
+    const uint32_t writeIndex = pRing->writeIndex.load(std::memory_order_acquire);
+    if(readIndex == writeIndex)
+    {
+        return 0; // ring is empty
+    }
+    FDP_RING_SLOT* pSlot    = &pRing->slots[readIndex % FDP_RING_SLOT_COUNT];
+    const uint32_t dataSize = pSlot->dataSize;
+    memcpy(pBuffer, (const void*) pSlot->data, std::min(dataSize, MaxSize));
+    if(pbStatus != NULL)
+    {
+        *pbStatus = pSlot->bStatus;
+    }
+    pRing->readIndex.store(readIndex + 1, std::memory_order_release);
+    return dataSize;
+}
+
+// best effort: the canals move megabytes per command, transparent huge
+// pages cut the tlb misses without requiring a hugetlbfs mount; with
+// FDP_NUMA_NODE=<node> the mapping is also bound to one socket so both
+// sides fault it on the same memory node
+static void ApplyShmPlacementHints(void* pBuf, size_t szSize)
+{
+#ifndef _MSC_VER
+#ifdef MADV_HUGEPAGE
+    madvise(pBuf, szSize, MADV_HUGEPAGE);
+#endif
+#ifdef SYS_mbind
+    const char* pNode = getenv("FDP_NUMA_NODE");
+    if(pNode != NULL)
+    {
+        const unsigned long node = strtoul(pNode, NULL, 0);
+        if(node < sizeof(unsigned long) * 8)
+        {
+            const unsigned long nodeMask = 1ul << node;
+            // MPOL_BIND without a libnuma dependency
+            syscall(SYS_mbind, pBuf, szSize, 2, &nodeMask, sizeof(nodeMask) * 8, 0);
+        }
+    }
+#endif
+#else
+    (void) pBuf;
+    (void) szSize;
+#endif
 }
 
 FDP_EXPORTED
@@ -236,11 +369,25 @@ FDP_SHM* FDP_CreateSHM(const char* shmName)
     }
 #endif
 
+    ApplyShmPlacementHints(pBuf, FDP_SHM_SHARED_SIZE);
     // Clear SHM
     memset(pBuf, 0, FDP_SHM_SHARED_SIZE);
     FDP_SHM* pFDPSHM = (FDP_SHM*) malloc(sizeof *pFDPSHM);
     // TODO: check !
     pFDPSHM->pSharedFDPSHM = (FDP_SHM_SHARED*) pBuf;
+    strncpy(pFDPSHM->aShmName, shmName, sizeof pFDPSHM->aShmName - 1);
+    pFDPSHM->aShmName[sizeof pFDPSHM->aShmName - 1] = 0;
+    pFDPSHM->pPhysicalMemoryShm                     = NULL;
+    pFDPSHM->PhysicalMemoryShmSize                  = 0;
+    pFDPSHM->bPhysicalShmProbed                     = false;
+    pFDPSHM->bRemoteTransport                       = false;
+    pFDPSHM->RemoteSocket                           = 0;
+    memset(&pFDPSHM->WaitTuning, 0, sizeof pFDPSHM->WaitTuning);
+    pFDPSHM->CommandTimeoutNs = 0;
+    pFDPSHM->PendingCommand   = 0;
+    pFDPSHM->bReplyAbandoned  = false;
+    pFDPSHM->pfnWatchdog      = NULL;
+    pFDPSHM->pWatchdogContext = NULL;
     return pFDPSHM;
 }
 
@@ -288,6 +435,7 @@ void* OpenShm(const char* pShmName, size_t szShmSize)
     }
 #endif
 
+    ApplyShmPlacementHints(pBuf, szShmSize);
     return pBuf;
 }
 
@@ -316,6 +464,19 @@ FDP_EXPORTED FDP_SHM* FDP_OpenSHM(const char* pShmName)
     }
     pFDPSHM->pSharedFDPSHM = (FDP_SHM_SHARED*) pSharedFDPSHM;
     pFDPSHM->pCpuShm       = (FDP_CPU_CTX*) pCpuShm;
+    strncpy(pFDPSHM->aShmName, pShmName, sizeof pFDPSHM->aShmName - 1);
+    pFDPSHM->aShmName[sizeof pFDPSHM->aShmName - 1] = 0;
+    pFDPSHM->pPhysicalMemoryShm                     = NULL;
+    pFDPSHM->PhysicalMemoryShmSize                  = 0;
+    pFDPSHM->bPhysicalShmProbed                     = false;
+    pFDPSHM->bRemoteTransport                       = false;
+    pFDPSHM->RemoteSocket                           = 0;
+    memset(&pFDPSHM->WaitTuning, 0, sizeof pFDPSHM->WaitTuning);
+    pFDPSHM->CommandTimeoutNs = 0;
+    pFDPSHM->PendingCommand   = 0;
+    pFDPSHM->bReplyAbandoned  = false;
+    pFDPSHM->pfnWatchdog      = NULL;
+    pFDPSHM->pWatchdogContext = NULL;
     return pFDPSHM;
 }
 
@@ -324,231 +485,984 @@ FDP_EXPORTED void FDP_ExitSHM(FDP_SHM* pShm)
     free(pShm);
 }
 
-static void RunCmd(FDP_SHM* pFDP, void* pDst, const void* pSrc, size_t szSize)
-{
-    LockSHM(pFDP->pSharedFDPSHM);
-    {
-        WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, (uint8_t*) pSrc, (uint32_t) szSize);
-        ReadFDPData(&pFDP->pSharedFDPSHM->ServerToClient, (uint8_t*) pDst); // TODO: return success/fail !
-    }
-    UnlockSHM(pFDP->pSharedFDPSHM);
-}
-
-static bool CheckRunCmd(FDP_SHM* pFDP, const void* pSrc, size_t szSize)
+namespace
 {
-    bool bReturnValue = false;
-    RunCmd(pFDP, &bReturnValue, pSrc, szSize);
-    return bReturnValue;
-}
+#ifdef _MSC_VER
+    typedef SOCKET fdp_socket_t;
+    constexpr fdp_socket_t invalid_socket = INVALID_SOCKET;
 
-static bool RunCmdBuffer(FDP_SHM* pFDP, void* pDst, const void* pSrc, size_t szSize)
-{
-    bool bReturnValue = false;
-    LockSHM(pFDP->pSharedFDPSHM);
+    bool socket_init()
     {
-        WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, (uint8_t*) pSrc, (uint32_t) szSize);
-        ReadFDPDataWithStatus(&pFDP->pSharedFDPSHM->ServerToClient, (uint8_t*) pDst, &bReturnValue);
+        static bool done = []
+        {
+            WSADATA wsa;
+            return WSAStartup(MAKEWORD(2, 2), &wsa) == 0;
+        }();
+        return done;
     }
-    UnlockSHM(pFDP->pSharedFDPSHM);
-    return bReturnValue;
-}
+#else
+    typedef int fdp_socket_t;
+    constexpr fdp_socket_t invalid_socket = -1;
 
-FDP_EXPORTED
-bool FDP_Pause(FDP_SHM* pFDP)
-{
-    if(pFDP == NULL)
+    bool socket_init()
     {
-        return false;
+        return true;
     }
-    FDP_SIMPLE_PKT_REQ TempPkt;
-    TempPkt.Type = FDPCMD_PAUSE_VM;
-    return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
-}
+#endif
 
-FDP_EXPORTED
-bool FDP_Resume(FDP_SHM* pFDP)
-{
-    if(pFDP == NULL)
+    bool send_all(fdp_socket_t sock, const void* src, size_t size)
     {
-        return false;
+        const char* ptr = (const char*) src;
+        while(size > 0)
+        {
+            const auto sent = send(sock, ptr, (int) size, 0);
+            if(sent <= 0)
+            {
+                return false;
+            }
+            ptr += sent;
+            size -= sent;
+        }
+        return true;
     }
-    FDP_SIMPLE_PKT_REQ TempPkt;
-    TempPkt.Type = FDPCMD_RESUME_VM;
-    return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
-}
 
-FDP_EXPORTED
-bool FDP_Reboot(FDP_SHM* pFDP)
-{
-    if(pFDP == NULL)
+    bool recv_all(fdp_socket_t sock, void* dst, size_t size)
     {
-        return false;
+        char* ptr = (char*) dst;
+        while(size > 0)
+        {
+            const auto got = recv(sock, ptr, (int) size, 0);
+            if(got <= 0)
+            {
+                return false;
+            }
+            ptr += got;
+            size -= got;
+        }
+        return true;
     }
-    FDP_SIMPLE_PKT_REQ TempPkt;
-    TempPkt.Type = FDPCMD_REBOOT;
-    return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
-}
-
-bool FDP_ReadPhysicalMemoryInternal(FDP_SHM* pFDP, uint8_t* pDstBuffer, uint32_t ReadSize, uint64_t PhysicalAddress)
-{
-    FDP_READ_PHYSICAL_MEMORY_PKT_REQ tmpPkt;
-    tmpPkt.Type            = FDPCMD_READ_PHYSICAL;
-    tmpPkt.PhysicalAddress = PhysicalAddress;
-    tmpPkt.ReadSize        = ReadSize;
-    return RunCmdBuffer(pFDP, pDstBuffer, &tmpPkt, sizeof tmpPkt);
-}
 
-FDP_EXPORTED
-bool FDP_ReadPhysicalMemory(FDP_SHM* pFDP, uint8_t* pDstBuffer, uint32_t ReadSize, uint64_t PhysicalAddress)
-{
-    if(pFDP == NULL)
-    {
-        return false;
-    }
-    uint32_t CurrentOffset = 0;
-    do
+    // relays the process-local canals of a remote FDP_SHM over the socket,
+    // one request/reply pair per command, until the connection drops
+    void tcp_client_pump(FDP_SHM* pFDP)
     {
-        uint32_t CurrentReadSize = std::min<uint32_t>(ReadSize, FDP_MAX_DATA_SIZE - 1);
-        if(FDP_ReadPhysicalMemoryInternal(pFDP, pDstBuffer + CurrentOffset, CurrentReadSize,
-                                          PhysicalAddress + CurrentOffset)
-           == false)
+        const fdp_socket_t sock = (fdp_socket_t) pFDP->RemoteSocket;
+        while(true)
         {
-            return false;
+            const uint32_t u32RequestSize = ReadFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pFDP->InputBuffer);
+            bool     bStatus         = false;
+            uint32_t u32ResponseSize = 0;
+            uint8_t  u8Status        = 0;
+            const bool bTransferOk   = send_all(sock, &u32RequestSize, sizeof u32RequestSize)
+                                    && send_all(sock, pFDP->InputBuffer, u32RequestSize)
+                                    && recv_all(sock, &u32ResponseSize, sizeof u32ResponseSize)
+                                    && recv_all(sock, &u8Status, sizeof u8Status)
+                                    && u32ResponseSize <= FDP_MAX_DATA_SIZE
+                                    && recv_all(sock, pFDP->InputBuffer, u32ResponseSize);
+            if(bTransferOk)
+            {
+                bStatus = u8Status != 0;
+            }
+            else
+            {
+                // fail the pending command instead of leaving the caller
+                // blocked on the reply canal
+                pFDP->InputBuffer[0] = false;
+                u32ResponseSize      = 1;
+            }
+            WriteFDPDataWithStatus(&pFDP->pSharedFDPSHM->ServerToClient, pFDP->InputBuffer, u32ResponseSize, bStatus);
+            if(!bTransferOk)
+            {
+                return;
+            }
         }
-        CurrentOffset += CurrentReadSize;
-    } while(CurrentOffset < ReadSize);
-    return true;
-}
-
-bool FDP_ReadVirtualMemoryInternal(FDP_SHM* pFDP, uint32_t CpuId, uint8_t* pDstBuffer, uint32_t ReadSize,
-                                   uint64_t VirtualAddress)
-{
-    FDP_READ_VIRTUAL_MEMORY_PKT_REQ tmpPkt;
-    tmpPkt.Type           = FDPCMD_READ_VIRTUAL;
-    tmpPkt.CpuId          = CpuId;
-    tmpPkt.VirtualAddress = VirtualAddress;
-    tmpPkt.ReadSize       = ReadSize;
-    return RunCmdBuffer(pFDP, pDstBuffer, &tmpPkt, sizeof tmpPkt);
+    }
 }
 
-FDP_EXPORTED
-bool FDP_ReadVirtualMemory(FDP_SHM* pFDP, uint32_t CpuId, uint8_t* pDstBuffer, uint32_t ReadSize,
-                           uint64_t VirtualAddress)
+FDP_EXPORTED FDP_SHM* FDP_OpenTCP(const char* pHostPort)
 {
-    if(pFDP == NULL || ReadSize <= 0)
+    if(pHostPort == NULL || socket_init() == false)
     {
-        return false;
+        return NULL;
     }
-    uint32_t CurrentOffset = 0;
-    do
+    char aHost[512];
+    strncpy(aHost, pHostPort, sizeof aHost - 1);
+    aHost[sizeof aHost - 1] = 0;
+    char* pColon            = strrchr(aHost, ':');
+    if(pColon == NULL)
     {
-        uint32_t CurrentReadSize = std::min<uint32_t>(ReadSize, FDP_MAX_DATA_SIZE - 1);
-        if(FDP_ReadVirtualMemoryInternal(pFDP, CpuId, pDstBuffer + CurrentOffset, CurrentReadSize,
-                                         VirtualAddress + CurrentOffset)
-           == false)
-        {
-            return false;
-        }
-        CurrentOffset += CurrentReadSize;
-    } while(CurrentOffset < ReadSize);
-    return true;
-}
+        return NULL;
+    }
+    *pColon           = 0;
+    const char* pPort = pColon + 1;
 
-FDP_EXPORTED
-bool FDP_WritePhysicalMemory(FDP_SHM* pFDP, uint8_t* pSrcBuffer, uint32_t WriteSize, uint64_t PhysicalAddress)
-{
-    if(pFDP == NULL)
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof hints);
+    hints.ai_family          = AF_UNSPEC;
+    hints.ai_socktype        = SOCK_STREAM;
+    struct addrinfo* pResult = NULL;
+    if(getaddrinfo(aHost, pPort, &hints, &pResult) != 0 || pResult == NULL)
     {
-        return false;
+        return NULL;
     }
-    bool bReturnValue = false;
-    LockSHM(pFDP->pSharedFDPSHM);
+    fdp_socket_t sock = invalid_socket;
+    for(struct addrinfo* pCur = pResult; pCur != NULL; pCur = pCur->ai_next)
     {
-        FDP_WRITE_PHYSICAL_MEMORY_PKT_REQ* TempPkt = (FDP_WRITE_PHYSICAL_MEMORY_PKT_REQ*) pFDP->OutputBuffer;
-        TempPkt->Type                              = FDPCMD_WRITE_PHYSICAL;
-        TempPkt->PhysicalAddress                   = PhysicalAddress;
-        TempPkt->WriteSize                         = WriteSize;
-        if(WriteSize < FDP_MAX_DATA_SIZE - sizeof *TempPkt)
+        sock = socket(pCur->ai_family, pCur->ai_socktype, pCur->ai_protocol);
+        if(sock == invalid_socket)
         {
-            memcpy(TempPkt->Data, pSrcBuffer, WriteSize);
-            WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, (uint8_t*) TempPkt, sizeof *TempPkt + WriteSize);
-            ReadFDPData(&pFDP->pSharedFDPSHM->ServerToClient, (uint8_t*) &bReturnValue);
+            continue;
+        }
+        if(connect(sock, pCur->ai_addr, (int) pCur->ai_addrlen) == 0)
+        {
+            break;
         }
+#ifdef _MSC_VER
+        closesocket(sock);
+#else
+        close(sock);
+#endif
+        sock = invalid_socket;
     }
-    UnlockSHM(pFDP->pSharedFDPSHM);
-    return bReturnValue;
-}
+    freeaddrinfo(pResult);
+    if(sock == invalid_socket)
+    {
+        return NULL;
+    }
+    const int one = 1;
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, (const char*) &one, sizeof one);
 
-FDP_EXPORTED
-bool FDP_WriteVirtualMemory(FDP_SHM* pFDP, uint32_t CpuId, uint8_t* pSrcBuffer, uint32_t WriteSize,
-                            uint64_t VirtualAddress)
-{
-    if(pFDP == NULL)
+    FDP_SHM* pFDPSHM = (FDP_SHM*) malloc(sizeof *pFDPSHM);
+    if(pFDPSHM == NULL)
     {
-        return false;
+        return NULL;
     }
-    bool bReturnValue = false;
-    LockSHM(pFDP->pSharedFDPSHM);
+    // the canals live on the heap, only the pump thread touches the wire
+    FDP_SHM_SHARED* pShared = (FDP_SHM_SHARED*) malloc(FDP_SHM_SHARED_SIZE);
+    FDP_CPU_CTX*    pCpuCtx = (FDP_CPU_CTX*) malloc(sizeof(FDP_CPU_CTX));
+    if(pShared == NULL || pCpuCtx == NULL)
     {
-        FDP_WRITE_VIRTUAL_MEMORY_PKT_REQ* TempPkt = (FDP_WRITE_VIRTUAL_MEMORY_PKT_REQ*) pFDP->OutputBuffer;
-        TempPkt->Type                             = FDPCMD_WRITE_VIRTUAL;
-        TempPkt->CpuId                            = CpuId;
-        TempPkt->VirtualAddress                   = VirtualAddress;
-        TempPkt->WriteSize                        = WriteSize;
-        if(WriteSize < FDP_MAX_DATA_SIZE - sizeof *TempPkt)
-        {
-            memcpy(TempPkt->Data, pSrcBuffer, WriteSize);
-            WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pFDP->OutputBuffer, sizeof *TempPkt + WriteSize);
-            ReadFDPData(&pFDP->pSharedFDPSHM->ServerToClient, (uint8_t*) &bReturnValue);
-        }
+        free(pShared);
+        free(pCpuCtx);
+        free(pFDPSHM);
+        return NULL;
     }
-    UnlockSHM(pFDP->pSharedFDPSHM);
-    return bReturnValue;
+    memset(pShared, 0, FDP_SHM_SHARED_SIZE);
+    memset(pCpuCtx, 0, sizeof *pCpuCtx);
+    pFDPSHM->pSharedFDPSHM = pShared;
+    pFDPSHM->pCpuShm       = pCpuCtx;
+    strncpy(pFDPSHM->aShmName, pHostPort, sizeof pFDPSHM->aShmName - 1);
+    pFDPSHM->aShmName[sizeof pFDPSHM->aShmName - 1] = 0;
+    pFDPSHM->pPhysicalMemoryShm                     = NULL;
+    pFDPSHM->PhysicalMemoryShmSize                  = 0;
+    pFDPSHM->bPhysicalShmProbed                     = true; // no local RAM window over TCP
+    pFDPSHM->bRemoteTransport                       = true;
+    pFDPSHM->RemoteSocket                           = (uint64_t) sock;
+    memset(&pFDPSHM->WaitTuning, 0, sizeof pFDPSHM->WaitTuning);
+    pFDPSHM->CommandTimeoutNs = 0;
+    pFDPSHM->PendingCommand   = 0;
+    pFDPSHM->bReplyAbandoned  = false;
+    pFDPSHM->pfnWatchdog      = NULL;
+    pFDPSHM->pWatchdogContext = NULL;
+    std::thread(&tcp_client_pump, pFDPSHM).detach();
+    return pFDPSHM;
 }
 
-FDP_EXPORTED
-uint64_t FDP_SearchPhysicalMemory(FDP_SHM* pFDP, const void* pPatternData, uint32_t PatternSize, uint64_t StartOffset)
+FDP_EXPORTED bool FDP_ServeTCP(FDP_SHM* pFDP, uint16_t Port)
 {
-    if(pFDP == NULL)
+    if(pFDP == NULL || socket_init() == false)
     {
         return false;
     }
-    uint64_t FoundAddress = 0x0;
-    LockSHM(pFDP->pSharedFDPSHM);
+    const fdp_socket_t listener = socket(AF_INET, SOCK_STREAM, 0);
+    if(listener == invalid_socket)
     {
-        FDP_SEARCH_PHYSICAL_MEMORY_PKT_REQ* TempPkt = (FDP_SEARCH_PHYSICAL_MEMORY_PKT_REQ*) pFDP->OutputBuffer;
-        TempPkt->Type                               = FDPCMD_SEARCH_PHYSICAL_MEMORY;
-        TempPkt->PatternSize                        = PatternSize;
-        TempPkt->StartOffset                        = StartOffset;
-        memcpy(TempPkt->PatternData, pPatternData, PatternSize);
-        WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pFDP->OutputBuffer, sizeof *TempPkt + PatternSize);
-        ReadFDPData(&pFDP->pSharedFDPSHM->ServerToClient, (uint8_t*) &FoundAddress); // TODO: return success/fail !
+        return false;
     }
-    UnlockSHM(pFDP->pSharedFDPSHM);
-    return FoundAddress;
-}
-
-// TODO !
-FDP_EXPORTED
-bool FDP_SearchVirtualMemory(FDP_SHM* pFDP, uint32_t CpuId, const void* pPatternData, uint32_t PatternSize,
-                             uint64_t StartOffset)
-{
-    if(pFDP == NULL)
+    const int one = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, (const char*) &one, sizeof one);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof addr);
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port        = htons(Port);
+    if(bind(listener, (struct sockaddr*) &addr, sizeof addr) != 0
+       || listen(listener, 1) != 0)
     {
         return false;
     }
-    uint64_t FoundAddress = 0x0;
-    bool bReturnCode      = false;
-    LockSHM(pFDP->pSharedFDPSHM);
+    uint8_t* pBuffer = (uint8_t*) malloc(FDP_MAX_DATA_SIZE);
+    if(pBuffer == NULL)
     {
-        FDP_SEARCH_VIRTUAL_MEMORY_PKT_REQ* TempPkt = (FDP_SEARCH_VIRTUAL_MEMORY_PKT_REQ*) pFDP->OutputBuffer;
+        return false;
+    }
+    while(true)
+    {
+        const fdp_socket_t client = accept(listener, NULL, NULL);
+        if(client == invalid_socket)
+        {
+            continue;
+        }
+        setsockopt(client, IPPROTO_TCP, TCP_NODELAY, (const char*) &one, sizeof one);
+        while(true)
+        {
+            uint32_t u32RequestSize = 0;
+            if(!recv_all(client, &u32RequestSize, sizeof u32RequestSize)
+               || u32RequestSize == 0
+               || u32RequestSize > FDP_MAX_DATA_SIZE
+               || !recv_all(client, pBuffer, u32RequestSize))
+            {
+                break;
+            }
+            bool     bStatus         = false;
+            uint32_t u32ResponseSize = 0;
+            LockSHM(pFDP->pSharedFDPSHM);
+            {
+                WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pBuffer, u32RequestSize);
+                u32ResponseSize = ReadFDPDataWithStatus(&pFDP->pSharedFDPSHM->ServerToClient, pBuffer, &bStatus);
+            }
+            UnlockSHM(pFDP->pSharedFDPSHM);
+            const uint8_t u8Status = bStatus;
+            if(!send_all(client, &u32ResponseSize, sizeof u32ResponseSize)
+               || !send_all(client, &u8Status, sizeof u8Status)
+               || !send_all(client, pBuffer, u32ResponseSize))
+            {
+                break;
+            }
+        }
+#ifdef _MSC_VER
+        closesocket(client);
+#else
+        close(client);
+#endif
+    }
+}
+
+namespace
+{
+    // nominal PAUSE cost used to convert latencies into spin budgets;
+    // only the order of magnitude matters, the ewma self-corrects
+    constexpr uint64_t approx_pause_ns = 4;
+    constexpr uint64_t min_sleep_ns    = 100 * 1000;
+    constexpr size_t   min_spin_iters  = 0x100;
+
+    FORCE_INLINE int WaitClassOf(uint8_t Type)
+    {
+        switch(Type)
+        {
+            case FDPCMD_READ_PHYSICAL:
+            case FDPCMD_READ_VIRTUAL:
+            case FDPCMD_READ_VIRTUAL_MULTIPLE:
+            case FDPCMD_READ_PHYSICAL_STREAM:
+            case FDPCMD_WRITE_PHYSICAL:
+            case FDPCMD_WRITE_VIRTUAL:
+            case FDPCMD_SEARCH_PHYSICAL_MEMORY:
+            case FDPCMD_SEARCH_VIRTUAL_MEMORY:
+                return FDP_WAIT_CLASS_MEMORY;
+            case FDPCMD_READ_REGISTER:
+            case FDPCMD_WRITE_REGISTER:
+            case FDPCMD_READ_MSR:
+            case FDPCMD_WRITE_MSR:
+            case FDPCMD_GET_CPU_CTX:
+            case FDPCMD_GET_FXSTATE:
+            case FDPCMD_SET_FXSTATE:
+                return FDP_WAIT_CLASS_REGISTER;
+            default:
+                return FDP_WAIT_CLASS_CONTROL;
+        }
+    }
+
+    // relaxed is enough: counters are monotonic and readers only need a
+    // rough view, torn snapshots still localize a stall
+    FORCE_INLINE void TelemetryRecordCommand(FDP_SHM* pFDP, uint8_t Type, uint64_t ElapsedNs)
+    {
+        FDP_TELEMETRY* pTelemetry = &pFDP->pSharedFDPSHM->Telemetry;
+        const int Slot            = Type < FDP_TELEMETRY_CMD_SLOTS ? Type : FDP_TELEMETRY_CMD_SLOTS - 1;
+        pTelemetry->CommandCount[Slot].fetch_add(1, std::memory_order_relaxed);
+        pTelemetry->CommandNs[Slot].fetch_add(ElapsedNs, std::memory_order_relaxed);
+    }
+
+    // ewma with alpha 1/8: spin about twice the expected latency, then
+    // block roughly one expected latency at a time; fast local hosts
+    // converge on pure spinning, remote setups on early blocking
+    void UpdateWaitTuning(FDP_WAIT_STATS* pStats, uint64_t SampleNs)
+    {
+        const uint64_t Ewma = pStats->Samples == 0 ? SampleNs : pStats->EwmaNs - pStats->EwmaNs / 8 + SampleNs / 8;
+        pStats->EwmaNs      = Ewma;
+        pStats->Samples++;
+        const uint64_t SpinBudget = 2 * Ewma / approx_pause_ns;
+        pStats->SpinBudget        = std::min(std::max((uint64_t) min_spin_iters, SpinBudget), (uint64_t) max_wait_iters);
+        pStats->SleepNs           = std::min(std::max(min_sleep_ns, Ewma), default_sleep_ns);
+    }
+
+    FORCE_INLINE size_t SpinBudgetOf(const FDP_WAIT_STATS* pStats)
+    {
+        return pStats->SpinBudget ? (size_t) pStats->SpinBudget : max_wait_iters;
+    }
+
+    FORCE_INLINE uint64_t SleepNsOf(const FDP_WAIT_STATS* pStats)
+    {
+        return pStats->SleepNs ? pStats->SleepNs : default_sleep_ns;
+    }
+
+    template <typename CANAL>
+    void SnapshotCanal(const CANAL* pCanal, FDP_CANAL_HEALTH* pDst)
+    {
+        pDst->bLocked      = pCanal->lock.load(std::memory_order_relaxed);
+        pDst->bDataPresent = pCanal->bDataPresent.load(std::memory_order_relaxed);
+        pDst->bStatus      = pCanal->bStatus;
+        pDst->DataSize     = pCanal->dataSize;
+        pDst->Wakeup       = pCanal->wakeup.load(std::memory_order_relaxed);
+    }
+
+    void BuildChannelHealth(FDP_SHM* pFDP, FDP_CHANNEL_HEALTH* pHealth)
+    {
+        memset(pHealth, 0, sizeof *pHealth);
+        FDP_SHM_SHARED* pShared = pFDP->pSharedFDPSHM;
+        pHealth->bShmLocked     = pShared->lock.load(std::memory_order_relaxed);
+        pHealth->PendingCommand = pFDP->PendingCommand;
+        SnapshotCanal(&pShared->ClientToServer, &pHealth->ClientToServer);
+        SnapshotCanal(&pShared->ServerToClient, &pHealth->ServerToClient);
+        for(int i = 0; i < FDP_PARALLEL_CANAL_COUNT; i++)
+        {
+            if(pShared->aParallelCanals[i].bBusy.load(std::memory_order_relaxed))
+            {
+                pHealth->ParallelBusyMask |= (uint8_t) (1u << i);
+            }
+            if(pShared->aParallelCanals[i].bServed.load(std::memory_order_relaxed))
+            {
+                pHealth->ParallelServedMask |= (uint8_t) (1u << i);
+            }
+        }
+    }
+
+    // deadline expired with the command still in flight: hand the channel
+    // state to the recovery callback, true grants one more full deadline
+    bool OnCommandTimeout(FDP_SHM* pFDP)
+    {
+        FDP_CHANNEL_HEALTH Health;
+        BuildChannelHealth(pFDP, &Health);
+        if(pFDP->pfnWatchdog == NULL)
+        {
+            return false;
+        }
+        return pFDP->pfnWatchdog(pFDP->pWatchdogContext, &Health);
+    }
+
+    FORCE_INLINE uint64_t DeadlineOf(FDP_SHM* pFDP)
+    {
+        return pFDP->CommandTimeoutNs != 0 ? NowNs() + pFDP->CommandTimeoutNs : 0;
+    }
+
+    // an abandoned reply has no sequence number: drop it before sending
+    // the next command so it is never mistaken for that command's reply
+    void DrainAbandonedReply(FDP_SHM* pFDP)
+    {
+        if(!pFDP->bReplyAbandoned)
+        {
+            return;
+        }
+        FDP_SHM_CANAL* pCanal = &pFDP->pSharedFDPSHM->ServerToClient;
+        ttas_spinlock_lock(&pCanal->lock);
+        const bool bLate = pCanal->bDataPresent.load(std::memory_order_relaxed);
+        if(bLate)
+        {
+            pCanal->bDataPresent.store(false, std::memory_order_relaxed);
+        }
+        ttas_spinlock_unlock(&pCanal->lock);
+        // keep dropping until the late reply actually surfaced
+        pFDP->bReplyAbandoned = !bLate;
+    }
+}
+
+// watchdog-aware send on the global canal: a previous request still
+// unconsumed after the deadline means the server is wedged, the
+// recovery callback decides whether to grant another full deadline
+static bool WriteCmdWatched(FDP_SHM* pFDP, const void* pSrc, uint32_t Size)
+{
+    pFDP->PendingCommand = *(const uint8_t*) pSrc;
+    DrainAbandonedReply(pFDP);
+    while(true)
+    {
+        if(WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, (uint8_t*) pSrc, Size, DeadlineOf(pFDP)))
+        {
+            return true;
+        }
+        if(!OnCommandTimeout(pFDP))
+        {
+            pFDP->PendingCommand = 0;
+            return false;
+        }
+    }
+}
+
+// watchdog-aware reply wait; on giving up *pbAbandoned marks the canal
+// as owing one stale reply that must not be read as the next one
+template <typename CANAL>
+static uint32_t ReadReplyWatchedOn(FDP_SHM* pFDP, CANAL* pCanal, void* pDst, bool* pbStatus, const FDP_WAIT_STATS* pStats, bool* pbAbandoned)
+{
+    const size_t   SpinBudget = pStats != NULL ? SpinBudgetOf(pStats) : max_wait_iters;
+    const uint64_t SleepNs    = pStats != NULL ? SleepNsOf(pStats) : default_sleep_ns;
+    bool bStatus              = false;
+    while(true)
+    {
+        const uint32_t Size = ReadFDPDataWithStatus(pCanal, (uint8_t*) pDst, &bStatus, SpinBudget, SleepNs, DeadlineOf(pFDP));
+        if(Size != 0)
+        {
+            if(pbStatus != NULL)
+            {
+                *pbStatus = bStatus;
+            }
+            pFDP->PendingCommand = 0;
+            return Size;
+        }
+        if(!OnCommandTimeout(pFDP))
+        {
+            *pbAbandoned = true;
+            if(pbStatus != NULL)
+            {
+                *pbStatus = false;
+            }
+            pFDP->PendingCommand = 0;
+            return 0;
+        }
+    }
+}
+
+static uint32_t ReadReplyWatched(FDP_SHM* pFDP, void* pDst, bool* pbStatus, const FDP_WAIT_STATS* pStats)
+{
+    bool bAbandoned     = false;
+    const uint32_t Size = ReadReplyWatchedOn(pFDP, &pFDP->pSharedFDPSHM->ServerToClient, pDst, pbStatus, pStats, &bAbandoned);
+    if(bAbandoned)
+    {
+        pFDP->bReplyAbandoned = true;
+    }
+    return Size;
+}
+
+static void RunCmd(FDP_SHM* pFDP, void* pDst, const void* pSrc, size_t szSize)
+{
+    FDP_WAIT_STATS* pStats = &pFDP->WaitTuning.aClasses[WaitClassOf(*(const uint8_t*) pSrc)];
+    const uint64_t StartNs = NowNs();
+    uint32_t ReplySize     = 0;
+    LockSHM(pFDP->pSharedFDPSHM);
+    {
+        if(WriteCmdWatched(pFDP, pSrc, (uint32_t) szSize))
+        {
+            ReplySize = ReadReplyWatched(pFDP, pDst, NULL, pStats); // TODO: return success/fail !
+        }
+    }
+    UnlockSHM(pFDP->pSharedFDPSHM);
+    if(ReplySize != 0)
+    {
+        UpdateWaitTuning(pStats, NowNs() - StartNs);
+    }
+}
+
+static bool CheckRunCmd(FDP_SHM* pFDP, const void* pSrc, size_t szSize)
+{
+    bool bReturnValue = false;
+    RunCmd(pFDP, &bReturnValue, pSrc, szSize);
+    return bReturnValue;
+}
+
+static bool RunCmdBuffer(FDP_SHM* pFDP, void* pDst, const void* pSrc, size_t szSize)
+{
+    bool bReturnValue      = false;
+    FDP_WAIT_STATS* pStats = &pFDP->WaitTuning.aClasses[WaitClassOf(*(const uint8_t*) pSrc)];
+    const uint64_t StartNs = NowNs();
+    uint32_t ReplySize     = 0;
+    LockSHM(pFDP->pSharedFDPSHM);
+    {
+        if(WriteCmdWatched(pFDP, pSrc, (uint32_t) szSize))
+        {
+            ReplySize = ReadReplyWatched(pFDP, pDst, &bReturnValue, pStats);
+        }
+    }
+    UnlockSHM(pFDP->pSharedFDPSHM);
+    if(ReplySize != 0)
+    {
+        UpdateWaitTuning(pStats, NowNs() - StartNs);
+    }
+    return bReturnValue;
+}
+
+static FDP_PARALLEL_CANAL* AcquireParallelCanal(FDP_SHM* pFDP)
+{
+    if(pFDP->bRemoteTransport)
+    {
+        return NULL;
+    }
+    if(!pFDP->pSharedFDPSHM->aParallelCanals[0].bServed.load(std::memory_order_acquire))
+    {
+        // server predates the parallel workers, or has not armed them yet
+        return NULL;
+    }
+    for(int i = 0; i < FDP_PARALLEL_CANAL_COUNT; i++)
+    {
+        FDP_PARALLEL_CANAL* pCanal = &pFDP->pSharedFDPSHM->aParallelCanals[i];
+        bool bExpected             = false;
+        if(pCanal->bBusy.compare_exchange_strong(bExpected, true, std::memory_order_acquire))
+        {
+            return pCanal;
+        }
+    }
+    return NULL;
+}
+
+static void ReleaseParallelCanal(FDP_PARALLEL_CANAL* pCanal)
+{
+    pCanal->bBusy.store(false, std::memory_order_release);
+}
+
+// read-only commands bypass the global lock when a parallel canal is free,
+// independent client threads then proceed concurrently
+static bool RunCmdBufferParallel(FDP_SHM* pFDP, void* pDst, const void* pSrc, size_t szSize, size_t szMaxResponse)
+{
+    if(szSize < FDP_PARALLEL_DATA_SIZE && szMaxResponse < FDP_PARALLEL_DATA_SIZE)
+    {
+        FDP_PARALLEL_CANAL* pCanal = AcquireParallelCanal(pFDP);
+        if(pCanal != NULL)
+        {
+            bool bReturnValue      = false;
+            FDP_WAIT_STATS* pStats = &pFDP->WaitTuning.aClasses[WaitClassOf(*(const uint8_t*) pSrc)];
+            const uint64_t StartNs = NowNs();
+            bool bPoisoned         = false;
+            while(true)
+            {
+                if(WriteFDPData(&pCanal->ClientToServer, (uint8_t*) pSrc, (uint32_t) szSize, DeadlineOf(pFDP)))
+                {
+                    break;
+                }
+                if(!OnCommandTimeout(pFDP))
+                {
+                    bPoisoned = true;
+                    break;
+                }
+            }
+            uint32_t ReplySize = 0;
+            if(!bPoisoned)
+            {
+                ReplySize = ReadReplyWatchedOn(pFDP, &pCanal->ServerToClient, pDst, &bReturnValue, pStats, &bPoisoned);
+            }
+            if(bPoisoned)
+            {
+                // a stale reply would land in this pair: keep it claimed
+                // instead of handing a poisoned canal to another thread
+                return false;
+            }
+            ReleaseParallelCanal(pCanal);
+            if(ReplySize != 0)
+            {
+                UpdateWaitTuning(pStats, NowNs() - StartNs);
+            }
+            return bReturnValue;
+        }
+    }
+    return RunCmdBuffer(pFDP, pDst, pSrc, szSize);
+}
+
+FDP_EXPORTED
+bool FDP_Pause(FDP_SHM* pFDP)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    FDP_SIMPLE_PKT_REQ TempPkt;
+    TempPkt.Type = FDPCMD_PAUSE_VM;
+    return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
+}
+
+FDP_EXPORTED
+bool FDP_Resume(FDP_SHM* pFDP)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    FDP_SIMPLE_PKT_REQ TempPkt;
+    TempPkt.Type = FDPCMD_RESUME_VM;
+    return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
+}
+
+FDP_EXPORTED
+bool FDP_Reboot(FDP_SHM* pFDP)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    FDP_SIMPLE_PKT_REQ TempPkt;
+    TempPkt.Type = FDPCMD_REBOOT;
+    return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
+}
+
+// Overlay the original bytes behind installed soft breakpoints so read
+// paths never return the int3 patches, the guest RAM window included
+static void FDP_OverlayShadowBytes(FDP_SHM* pFDP, FDP_AddressType AddressType, uint64_t Address, uint64_t ReadSize, uint8_t* pDstBuffer)
+{
+    FDP_SHM_SHARED* pShared = pFDP->pSharedFDPSHM;
+    if(pShared == NULL)
+    {
+        return;
+    }
+    const uint32_t HighWater = std::min<uint32_t>(pShared->BreakpointShadowHighWater, FDP_MAX_BREAKPOINT);
+    for(uint32_t i = 0; i < HighWater; i++)
+    {
+        const FDP_BP_SHADOW_ENTRY* pEntry = &pShared->aBreakpointShadow[i];
+        if(pEntry->bEnabled == 0 || pEntry->AddressType != (uint8_t) AddressType)
+        {
+            continue;
+        }
+        if(pEntry->Address < Address || pEntry->Address - Address >= ReadSize)
+        {
+            continue;
+        }
+        pDstBuffer[pEntry->Address - Address] = pEntry->OriginalByte;
+    }
+}
+
+bool FDP_ReadPhysicalMemoryInternal(FDP_SHM* pFDP, uint8_t* pDstBuffer, uint32_t ReadSize, uint64_t PhysicalAddress)
+{
+    FDP_READ_PHYSICAL_MEMORY_PKT_REQ tmpPkt;
+    tmpPkt.Type            = FDPCMD_READ_PHYSICAL;
+    tmpPkt.PhysicalAddress = PhysicalAddress;
+    tmpPkt.ReadSize        = ReadSize;
+    return RunCmdBufferParallel(pFDP, pDstBuffer, &tmpPkt, sizeof tmpPkt, ReadSize);
+}
+
+// Try to map the guest RAM window exported by the FDP server as a
+// shared mapping, reads then become a single memcpy without any
+// channel round trip
+static bool FDP_TryMapPhysicalMemory(FDP_SHM* pFDP)
+{
+    if(pFDP->bPhysicalShmProbed)
+    {
+        return pFDP->pPhysicalMemoryShm != NULL;
+    }
+    pFDP->bPhysicalShmProbed    = true;
+    uint64_t PhysicalMemorySize = 0;
+    if(FDP_GetPhysicalMemorySize(pFDP, &PhysicalMemorySize) == false || PhysicalMemorySize == 0)
+    {
+        return false;
+    }
+    char aPhysicalShmName[512];
+    strncpy(aPhysicalShmName, "PHY_", sizeof aPhysicalShmName - 1);
+    strncat(aPhysicalShmName, pFDP->aShmName, sizeof aPhysicalShmName - strlen(aPhysicalShmName) - 1);
+    pFDP->pPhysicalMemoryShm = (uint8_t*) OpenShm(aPhysicalShmName, PhysicalMemorySize);
+    if(pFDP->pPhysicalMemoryShm == NULL)
+    {
+        return false;
+    }
+    pFDP->PhysicalMemoryShmSize = PhysicalMemorySize;
+    return true;
+}
+
+FDP_EXPORTED
+bool FDP_ReadPhysicalMemory(FDP_SHM* pFDP, uint8_t* pDstBuffer, uint32_t ReadSize, uint64_t PhysicalAddress)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    if(FDP_TryMapPhysicalMemory(pFDP)
+       && PhysicalAddress + ReadSize >= PhysicalAddress
+       && PhysicalAddress + ReadSize <= pFDP->PhysicalMemoryShmSize)
+    {
+        memcpy(pDstBuffer, pFDP->pPhysicalMemoryShm + PhysicalAddress, ReadSize);
+        FDP_OverlayShadowBytes(pFDP, FDP_PHYSICAL_ADDRESS, PhysicalAddress, ReadSize, pDstBuffer);
+        return true;
+    }
+    uint32_t CurrentOffset = 0;
+    do
+    {
+        uint32_t CurrentReadSize = std::min<uint32_t>(ReadSize, FDP_MAX_DATA_SIZE - 1);
+        if(FDP_ReadPhysicalMemoryInternal(pFDP, pDstBuffer + CurrentOffset, CurrentReadSize,
+                                          PhysicalAddress + CurrentOffset)
+           == false)
+        {
+            return false;
+        }
+        CurrentOffset += CurrentReadSize;
+    } while(CurrentOffset < ReadSize);
+    FDP_OverlayShadowBytes(pFDP, FDP_PHYSICAL_ADDRESS, PhysicalAddress, ReadSize, pDstBuffer);
+    return true;
+}
+
+FDP_EXPORTED
+bool FDP_ReadPhysicalMemoryStream(FDP_SHM* pFDP, uint8_t* pDstBuffer, uint64_t ReadSize, uint64_t PhysicalAddress)
+{
+    if(pFDP == NULL || pDstBuffer == NULL || ReadSize == 0)
+    {
+        return false;
+    }
+    if(FDP_TryMapPhysicalMemory(pFDP)
+       && PhysicalAddress + ReadSize >= PhysicalAddress
+       && PhysicalAddress + ReadSize <= pFDP->PhysicalMemoryShmSize)
+    {
+        memcpy(pDstBuffer, pFDP->pPhysicalMemoryShm + PhysicalAddress, ReadSize);
+        FDP_OverlayShadowBytes(pFDP, FDP_PHYSICAL_ADDRESS, PhysicalAddress, ReadSize, pDstBuffer);
+        return true;
+    }
+    if(ReadSize <= FDP_STREAM_CHUNK_SIZE || pFDP->bRemoteTransport)
+    {
+        // the TCP relay pairs one reply per request, fall back to plain
+        // chunked reads there
+        uint64_t Offset = 0;
+        while(Offset < ReadSize)
+        {
+            const uint32_t ChunkSize = (uint32_t) std::min<uint64_t>(ReadSize - Offset, FDP_STREAM_CHUNK_SIZE);
+            if(FDP_ReadPhysicalMemory(pFDP, pDstBuffer + Offset, ChunkSize, PhysicalAddress + Offset) == false)
+            {
+                return false;
+            }
+            Offset += ChunkSize;
+        }
+        return true;
+    }
+    bool bReturnValue = true;
+    LockSHM(pFDP->pSharedFDPSHM);
+    {
+        FDP_READ_PHYSICAL_MEMORY_STREAM_PKT_REQ* TempPkt = (FDP_READ_PHYSICAL_MEMORY_STREAM_PKT_REQ*) pFDP->OutputBuffer;
+        TempPkt->Type                                    = FDPCMD_READ_PHYSICAL_STREAM;
+        TempPkt->PhysicalAddress                         = PhysicalAddress;
+        TempPkt->ReadSize                                = ReadSize;
+        WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pFDP->OutputBuffer, sizeof *TempPkt);
+        uint64_t Remaining  = ReadSize;
+        uint64_t Offset     = 0;
+        uint32_t ChunkIndex = 0;
+        while(Remaining > 0)
+        {
+            const uint32_t ChunkSize = (uint32_t) std::min<uint64_t>(Remaining, FDP_STREAM_CHUNK_SIZE);
+            // even chunks come through ServerToClient, odd ones through the
+            // now idle ClientToServer canal, so the server always has a free
+            // slot to refill while we drain the other one
+            FDP_SHM_CANAL* pCanal = (ChunkIndex & 1) ? &pFDP->pSharedFDPSHM->ClientToServer
+                                                     : &pFDP->pSharedFDPSHM->ServerToClient;
+            bool bChunkStatus      = false;
+            const uint32_t GotSize = ReadFDPDataWithStatus(pCanal, pDstBuffer + Offset, &bChunkStatus);
+            bReturnValue &= bChunkStatus && GotSize == ChunkSize;
+            Remaining -= ChunkSize;
+            Offset += ChunkSize;
+            ChunkIndex++;
+        }
+    }
+    UnlockSHM(pFDP->pSharedFDPSHM);
+    if(bReturnValue)
+    {
+        FDP_OverlayShadowBytes(pFDP, FDP_PHYSICAL_ADDRESS, PhysicalAddress, ReadSize, pDstBuffer);
+    }
+    return bReturnValue;
+}
+
+bool FDP_ReadVirtualMemoryInternal(FDP_SHM* pFDP, uint32_t CpuId, uint8_t* pDstBuffer, uint32_t ReadSize,
+                                   uint64_t VirtualAddress)
+{
+    FDP_READ_VIRTUAL_MEMORY_PKT_REQ tmpPkt;
+    tmpPkt.Type           = FDPCMD_READ_VIRTUAL;
+    tmpPkt.CpuId          = CpuId;
+    tmpPkt.VirtualAddress = VirtualAddress;
+    tmpPkt.ReadSize       = ReadSize;
+    return RunCmdBufferParallel(pFDP, pDstBuffer, &tmpPkt, sizeof tmpPkt, ReadSize);
+}
+
+FDP_EXPORTED
+bool FDP_ReadVirtualMemory(FDP_SHM* pFDP, uint32_t CpuId, uint8_t* pDstBuffer, uint32_t ReadSize,
+                           uint64_t VirtualAddress)
+{
+    if(pFDP == NULL || ReadSize <= 0)
+    {
+        return false;
+    }
+    uint32_t CurrentOffset = 0;
+    do
+    {
+        uint32_t CurrentReadSize = std::min<uint32_t>(ReadSize, FDP_MAX_DATA_SIZE - 1);
+        if(FDP_ReadVirtualMemoryInternal(pFDP, CpuId, pDstBuffer + CurrentOffset, CurrentReadSize,
+                                         VirtualAddress + CurrentOffset)
+           == false)
+        {
+            return false;
+        }
+        CurrentOffset += CurrentReadSize;
+    } while(CurrentOffset < ReadSize);
+    FDP_OverlayShadowBytes(pFDP, FDP_VIRTUAL_ADDRESS, VirtualAddress, ReadSize, pDstBuffer);
+    return true;
+}
+
+FDP_EXPORTED
+bool FDP_ReadVirtualMemoryMultiple(FDP_SHM* pFDP, uint32_t CpuId, const FDP_VIRTUAL_RANGE* pRanges, uint32_t RangeCount,
+                                   uint8_t* pDstBuffer)
+{
+    if(pFDP == NULL || pRanges == NULL || RangeCount == 0)
+    {
+        return false;
+    }
+    uint64_t TotalReadSize = 0;
+    for(uint32_t i = 0; i < RangeCount; i++)
+    {
+        TotalReadSize += pRanges[i].ReadSize;
+    }
+    const uint64_t RequestSize = sizeof(FDP_READ_VIRTUAL_MEMORY_MULTIPLE_PKT_REQ) + RangeCount * sizeof(FDP_VIRTUAL_RANGE);
+    if(TotalReadSize >= FDP_MAX_DATA_SIZE || RequestSize >= FDP_MAX_DATA_SIZE)
+    {
+        return false;
+    }
+    bool bReturnValue = false;
+    LockSHM(pFDP->pSharedFDPSHM);
+    {
+        FDP_READ_VIRTUAL_MEMORY_MULTIPLE_PKT_REQ* TempPkt = (FDP_READ_VIRTUAL_MEMORY_MULTIPLE_PKT_REQ*) pFDP->OutputBuffer;
+        TempPkt->Type                                     = FDPCMD_READ_VIRTUAL_MULTIPLE;
+        TempPkt->CpuId                                    = CpuId;
+        TempPkt->RangeCount                               = RangeCount;
+        memcpy(TempPkt->Ranges, pRanges, RangeCount * sizeof(FDP_VIRTUAL_RANGE));
+        if(WriteCmdWatched(pFDP, pFDP->OutputBuffer, (uint32_t) RequestSize))
+        {
+            ReadReplyWatched(pFDP, pDstBuffer, &bReturnValue, NULL);
+        }
+    }
+    UnlockSHM(pFDP->pSharedFDPSHM);
+    if(bReturnValue)
+    {
+        uint64_t RangeOffset = 0;
+        for(uint32_t i = 0; i < RangeCount; i++)
+        {
+            FDP_OverlayShadowBytes(pFDP, FDP_VIRTUAL_ADDRESS, pRanges[i].VirtualAddress, pRanges[i].ReadSize, pDstBuffer + RangeOffset);
+            RangeOffset += pRanges[i].ReadSize;
+        }
+    }
+    return bReturnValue;
+}
+
+FDP_EXPORTED
+bool FDP_WritePhysicalMemory(FDP_SHM* pFDP, uint8_t* pSrcBuffer, uint32_t WriteSize, uint64_t PhysicalAddress)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    bool bReturnValue = false;
+    LockSHM(pFDP->pSharedFDPSHM);
+    {
+        FDP_WRITE_PHYSICAL_MEMORY_PKT_REQ* TempPkt = (FDP_WRITE_PHYSICAL_MEMORY_PKT_REQ*) pFDP->OutputBuffer;
+        TempPkt->Type                              = FDPCMD_WRITE_PHYSICAL;
+        TempPkt->PhysicalAddress                   = PhysicalAddress;
+        TempPkt->WriteSize                         = WriteSize;
+        if(WriteSize < FDP_MAX_DATA_SIZE - sizeof *TempPkt)
+        {
+            memcpy(TempPkt->Data, pSrcBuffer, WriteSize);
+            if(WriteCmdWatched(pFDP, (uint8_t*) TempPkt, sizeof *TempPkt + WriteSize))
+            {
+                ReadReplyWatched(pFDP, (uint8_t*) &bReturnValue, NULL, NULL);
+            }
+        }
+    }
+    UnlockSHM(pFDP->pSharedFDPSHM);
+    return bReturnValue;
+}
+
+FDP_EXPORTED
+bool FDP_WriteVirtualMemory(FDP_SHM* pFDP, uint32_t CpuId, uint8_t* pSrcBuffer, uint32_t WriteSize,
+                            uint64_t VirtualAddress)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    bool bReturnValue = false;
+    LockSHM(pFDP->pSharedFDPSHM);
+    {
+        FDP_WRITE_VIRTUAL_MEMORY_PKT_REQ* TempPkt = (FDP_WRITE_VIRTUAL_MEMORY_PKT_REQ*) pFDP->OutputBuffer;
+        TempPkt->Type                             = FDPCMD_WRITE_VIRTUAL;
+        TempPkt->CpuId                            = CpuId;
+        TempPkt->VirtualAddress                   = VirtualAddress;
+        TempPkt->WriteSize                        = WriteSize;
+        if(WriteSize < FDP_MAX_DATA_SIZE - sizeof *TempPkt)
+        {
+            memcpy(TempPkt->Data, pSrcBuffer, WriteSize);
+            if(WriteCmdWatched(pFDP, pFDP->OutputBuffer, sizeof *TempPkt + WriteSize))
+            {
+                ReadReplyWatched(pFDP, (uint8_t*) &bReturnValue, NULL, NULL);
+            }
+        }
+    }
+    UnlockSHM(pFDP->pSharedFDPSHM);
+    return bReturnValue;
+}
+
+FDP_EXPORTED
+uint64_t FDP_SearchPhysicalMemory(FDP_SHM* pFDP, const void* pPatternData, uint32_t PatternSize, uint64_t StartOffset)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    uint64_t FoundAddress = 0x0;
+    LockSHM(pFDP->pSharedFDPSHM);
+    {
+        FDP_SEARCH_PHYSICAL_MEMORY_PKT_REQ* TempPkt = (FDP_SEARCH_PHYSICAL_MEMORY_PKT_REQ*) pFDP->OutputBuffer;
+        TempPkt->Type                               = FDPCMD_SEARCH_PHYSICAL_MEMORY;
+        TempPkt->PatternSize                        = PatternSize;
+        TempPkt->StartOffset                        = StartOffset;
+        memcpy(TempPkt->PatternData, pPatternData, PatternSize);
+        if(WriteCmdWatched(pFDP, pFDP->OutputBuffer, sizeof *TempPkt + PatternSize))
+        {
+            ReadReplyWatched(pFDP, (uint8_t*) &FoundAddress, NULL, NULL); // TODO: return success/fail !
+        }
+    }
+    UnlockSHM(pFDP->pSharedFDPSHM);
+    return FoundAddress;
+}
+
+// TODO !
+FDP_EXPORTED
+bool FDP_SearchVirtualMemory(FDP_SHM* pFDP, uint32_t CpuId, const void* pPatternData, uint32_t PatternSize,
+                             uint64_t StartOffset)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    uint64_t FoundAddress = 0x0;
+    bool bReturnCode      = false;
+    LockSHM(pFDP->pSharedFDPSHM);
+    {
+        FDP_SEARCH_VIRTUAL_MEMORY_PKT_REQ* TempPkt = (FDP_SEARCH_VIRTUAL_MEMORY_PKT_REQ*) pFDP->OutputBuffer;
         TempPkt->Type                              = FDPCMD_SEARCH_VIRTUAL_MEMORY;
         TempPkt->CpuId                             = CpuId;
         TempPkt->PatternSize                       = PatternSize;
         TempPkt->StartOffset                       = StartOffset;
         memcpy(TempPkt->PatternData, pPatternData, PatternSize);
-        WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pFDP->OutputBuffer, sizeof *TempPkt + PatternSize);
-        ReadFDPData(&pFDP->pSharedFDPSHM->ServerToClient, (uint8_t*) &FoundAddress); // TODO: return success/fail !
+        if(WriteCmdWatched(pFDP, pFDP->OutputBuffer, sizeof *TempPkt + PatternSize))
+        {
+            ReadReplyWatched(pFDP, (uint8_t*) &FoundAddress, NULL, NULL); // TODO: return success/fail !
+        }
         bReturnCode = true;
     }
     UnlockSHM(pFDP->pSharedFDPSHM);
@@ -562,81 +1476,82 @@ bool FDP_ReadRegister(FDP_SHM* pFDP, uint32_t CpuId, FDP_Register RegisterId, ui
     {
         return false;
     }
-    // Fast way...
-    switch(RegisterId)
-    {
-        case FDP_RIP_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->rip;
-            return true;
-        case FDP_RAX_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->rax;
-            return true;
-        case FDP_RCX_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->rcx;
-            return true;
-        case FDP_RDX_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->rdx;
-            return true;
-        case FDP_RBX_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->rbx;
-            return true;
-        case FDP_RSP_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->rsp;
-            return true;
-        case FDP_RBP_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->rbp;
-            return true;
-        case FDP_RSI_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->rsi;
-            return true;
-        case FDP_RDI_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->rdi;
-            return true;
-        case FDP_R8_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->r8;
-            return true;
-        case FDP_R9_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->r9;
-            return true;
-        case FDP_R10_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->r10;
-            return true;
-        case FDP_R11_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->r11;
-            return true;
-        case FDP_R12_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->r12;
-            return true;
-        case FDP_R13_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->r13;
-            return true;
-        case FDP_R14_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->r14;
-            return true;
-        case FDP_R15_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->r15;
-            return true;
-        case FDP_CR0_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->cr0;
-            return true;
-        case FDP_CR2_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->cr2;
-            return true;
-        case FDP_CR3_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->cr3;
-            return true;
-        case FDP_CR4_REGISTER:
-            *pRegisterValue = pFDP->pCpuShm->cr4;
-            return true;
-        default:
-            break;
-    }
+    // Fast way... the CPU snapshot mapping is only coherent locally
+    if(pFDP->bRemoteTransport == false)
+        switch(RegisterId)
+        {
+            case FDP_RIP_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->rip;
+                return true;
+            case FDP_RAX_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->rax;
+                return true;
+            case FDP_RCX_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->rcx;
+                return true;
+            case FDP_RDX_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->rdx;
+                return true;
+            case FDP_RBX_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->rbx;
+                return true;
+            case FDP_RSP_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->rsp;
+                return true;
+            case FDP_RBP_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->rbp;
+                return true;
+            case FDP_RSI_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->rsi;
+                return true;
+            case FDP_RDI_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->rdi;
+                return true;
+            case FDP_R8_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->r8;
+                return true;
+            case FDP_R9_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->r9;
+                return true;
+            case FDP_R10_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->r10;
+                return true;
+            case FDP_R11_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->r11;
+                return true;
+            case FDP_R12_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->r12;
+                return true;
+            case FDP_R13_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->r13;
+                return true;
+            case FDP_R14_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->r14;
+                return true;
+            case FDP_R15_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->r15;
+                return true;
+            case FDP_CR0_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->cr0;
+                return true;
+            case FDP_CR2_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->cr2;
+                return true;
+            case FDP_CR3_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->cr3;
+                return true;
+            case FDP_CR4_REGISTER:
+                *pRegisterValue = pFDP->pCpuShm->cr4;
+                return true;
+            default:
+                break;
+        }
     // Old version => low performance
     FDP_READ_REGISTER_PKT_REQ TempPkt;
     TempPkt.Type       = FDPCMD_READ_REGISTER;
     TempPkt.CpuId      = CpuId;
     TempPkt.RegisterId = RegisterId;
-    RunCmd(pFDP, pRegisterValue, &TempPkt, sizeof TempPkt);
+    RunCmdBufferParallel(pFDP, pRegisterValue, &TempPkt, sizeof TempPkt, sizeof *pRegisterValue);
     return true;
 }
 
@@ -651,7 +1566,7 @@ bool FDP_ReadMsr(FDP_SHM* pFDP, uint32_t CpuId, uint64_t MsrId, uint64_t* pMsrVa
     TempPkt.Type  = FDPCMD_READ_MSR;
     TempPkt.CpuId = CpuId;
     TempPkt.MsrId = MsrId;
-    RunCmd(pFDP, pMsrValue, &TempPkt, sizeof TempPkt);
+    RunCmdBufferParallel(pFDP, pMsrValue, &TempPkt, sizeof TempPkt, sizeof *pMsrValue);
     return true;
 }
 
@@ -662,6 +1577,11 @@ bool FDP_WriteMsr(FDP_SHM* pFDP, uint32_t CpuId, uint64_t MsrId, uint64_t MsrVal
     {
         return false;
     }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
     FDP_WRITE_MSR_PKT_REQ TempPkt;
     TempPkt.Type     = FDPCMD_WRITE_MSR;
     TempPkt.CpuId    = CpuId;
@@ -677,6 +1597,11 @@ bool FDP_WriteRegister(FDP_SHM* pFDP, uint32_t CpuId, FDP_Register RegisterId, u
     {
         return false;
     }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
     FDP_WRITE_REGISTER_PKT_REQ TempPkt;
     TempPkt.Type          = FDPCMD_WRITE_REGISTER;
     TempPkt.CpuId         = CpuId;
@@ -692,12 +1617,235 @@ bool FDP_UnsetBreakpoint(FDP_SHM* pFDP, int BreakpointId)
     {
         return false;
     }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
     FDP_CLEAR_BREAKPOINT_PKT_REQ TempPkt;
     TempPkt.Type         = FDPCMD_UNSET_BP;
     TempPkt.BreakpointId = BreakpointId;
+    TempPkt.SessionId    = pFDP->SessionId;
+    return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
+}
+
+// names a client on the server so breakpoint slots get an owner; pure
+// observers pass bReadOnly and every mutating command fails locally,
+// their reads ride the lock-free parallel canals
+FDP_EXPORTED
+uint32_t FDP_OpenSession(FDP_SHM* pFDP, bool bReadOnly)
+{
+    if(pFDP == NULL)
+    {
+        return 0;
+    }
+    FDP_OPEN_SESSION_PKT_REQ TempPkt;
+    TempPkt.Type       = FDPCMD_OPEN_SESSION;
+    TempPkt.bReadOnly  = bReadOnly;
+    uint32_t SessionId = 0;
+    if(RunCmdBuffer(pFDP, &SessionId, &TempPkt, sizeof TempPkt) == false)
+    {
+        return 0;
+    }
+    pFDP->SessionId        = SessionId;
+    pFDP->bReadOnlySession = bReadOnly;
+    return SessionId;
+}
+
+// the server reclaims every breakpoint the session still owns
+FDP_EXPORTED
+bool FDP_CloseSession(FDP_SHM* pFDP)
+{
+    if(pFDP == NULL || pFDP->SessionId == 0)
+    {
+        return false;
+    }
+    FDP_CLOSE_SESSION_PKT_REQ TempPkt;
+    TempPkt.Type           = FDPCMD_CLOSE_SESSION;
+    TempPkt.SessionId      = pFDP->SessionId;
+    pFDP->SessionId        = 0;
+    pFDP->bReadOnlySession = false;
+    return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
+}
+
+FDP_EXPORTED
+bool FDP_SetBreakpointFilter(FDP_SHM* pFDP, int BreakpointId, uint64_t FilterCr3, uint64_t FilterThreadAddress, uint64_t FilterThreadValue)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    FDP_SET_BREAKPOINT_FILTER_PKT_REQ TempPkt;
+    TempPkt.Type                = FDPCMD_SET_BP_FILTER;
+    TempPkt.BreakpointId        = BreakpointId;
+    TempPkt.FilterCr3           = FilterCr3;
+    TempPkt.FilterThreadAddress = FilterThreadAddress;
+    TempPkt.FilterThreadValue   = FilterThreadValue;
+    return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
+}
+
+FDP_EXPORTED
+bool FDP_SetBreakpointOneShot(FDP_SHM* pFDP, int BreakpointId, bool bOneShot)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    FDP_SET_BREAKPOINT_ONE_SHOT_PKT_REQ TempPkt;
+    TempPkt.Type         = FDPCMD_SET_BP_ONE_SHOT;
+    TempPkt.BreakpointId = BreakpointId;
+    TempPkt.bOneShot     = bOneShot;
     return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
 }
 
+// ask the monitor to snapshot guest ram copy-on-write into an offline
+// image; the answered path is then served through the crash-dump backend
+// while the real guest resumes
+FDP_EXPORTED
+bool FDP_Fork(FDP_SHM* pFDP, char* pDumpPath, uint32_t MaxPathSize)
+{
+    if(pFDP == NULL || pDumpPath == NULL || MaxPathSize == 0)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    FDP_SIMPLE_PKT_REQ TempPkt;
+    TempPkt.Type = FDPCMD_FORK;
+    char aPath[FDP_FORK_PATH_SIZE];
+    memset(aPath, 0, sizeof aPath);
+    if(RunCmdBuffer(pFDP, aPath, &TempPkt, sizeof TempPkt) == false)
+    {
+        return false;
+    }
+    aPath[sizeof aPath - 1] = 0;
+    if(aPath[0] == 0)
+    {
+        return false;
+    }
+    strncpy(pDumpPath, aPath, MaxPathSize - 1);
+    pDumpPath[MaxPathSize - 1] = 0;
+    return true;
+}
+
+FDP_EXPORTED
+bool FDP_SetBreakpointRegisterFilter(FDP_SHM* pFDP, int BreakpointId, FDP_Register RegisterId, const FDP_REGISTER_RANGE* pRanges, uint32_t RangeCount)
+{
+    if(pFDP == NULL || pRanges == NULL || RangeCount == 0)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    const uint64_t RequestSize = sizeof(FDP_SET_BREAKPOINT_REGISTER_FILTER_PKT_REQ) + RangeCount * sizeof(FDP_REGISTER_RANGE);
+    if(RequestSize >= FDP_MAX_DATA_SIZE)
+    {
+        return false;
+    }
+    bool bReturnValue = false;
+    LockSHM(pFDP->pSharedFDPSHM);
+    {
+        FDP_SET_BREAKPOINT_REGISTER_FILTER_PKT_REQ* TempPkt = (FDP_SET_BREAKPOINT_REGISTER_FILTER_PKT_REQ*) pFDP->OutputBuffer;
+        TempPkt->Type                                       = FDPCMD_SET_BP_REGISTER_FILTER;
+        TempPkt->BreakpointId                               = BreakpointId;
+        TempPkt->RegisterId                                 = RegisterId;
+        TempPkt->RangeCount                                 = RangeCount;
+        memcpy(TempPkt->Ranges, pRanges, RangeCount * sizeof(FDP_REGISTER_RANGE));
+        if(WriteCmdWatched(pFDP, pFDP->OutputBuffer, (uint32_t) RequestSize))
+        {
+            ReadReplyWatched(pFDP, (uint8_t*) &bReturnValue, NULL, NULL);
+        }
+    }
+    UnlockSHM(pFDP->pSharedFDPSHM);
+    return bReturnValue;
+}
+
+FDP_EXPORTED
+bool FDP_SetBreakpointMultiple(FDP_SHM* pFDP, uint32_t CpuId, const FDP_BREAKPOINT_DESC* pBreakpoints,
+                               uint32_t BreakpointCount, int* pBreakpointIds)
+{
+    if(pFDP == NULL || pBreakpoints == NULL || pBreakpointIds == NULL || BreakpointCount == 0)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    const uint64_t RequestSize = sizeof(FDP_SET_BREAKPOINT_MULTIPLE_PKT_REQ) + BreakpointCount * sizeof(FDP_BREAKPOINT_DESC);
+    if(RequestSize >= FDP_MAX_DATA_SIZE || BreakpointCount * sizeof(int) >= FDP_MAX_DATA_SIZE)
+    {
+        return false;
+    }
+    bool bReturnValue = false;
+    LockSHM(pFDP->pSharedFDPSHM);
+    {
+        FDP_SET_BREAKPOINT_MULTIPLE_PKT_REQ* TempPkt = (FDP_SET_BREAKPOINT_MULTIPLE_PKT_REQ*) pFDP->OutputBuffer;
+        TempPkt->Type                                = FDPCMD_SET_BP_MULTIPLE;
+        TempPkt->CpuId                               = CpuId;
+        TempPkt->SessionId                           = pFDP->SessionId;
+        TempPkt->BreakpointCount                     = BreakpointCount;
+        memcpy(TempPkt->Breakpoints, pBreakpoints, BreakpointCount * sizeof(FDP_BREAKPOINT_DESC));
+        if(WriteCmdWatched(pFDP, pFDP->OutputBuffer, (uint32_t) RequestSize))
+        {
+            ReadReplyWatched(pFDP, (uint8_t*) pBreakpointIds, &bReturnValue, NULL);
+        }
+    }
+    UnlockSHM(pFDP->pSharedFDPSHM);
+    return bReturnValue;
+}
+
+FDP_EXPORTED
+bool FDP_UnsetBreakpointMultiple(FDP_SHM* pFDP, const int* pBreakpointIds, uint32_t BreakpointCount)
+{
+    if(pFDP == NULL || pBreakpointIds == NULL || BreakpointCount == 0)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    const uint64_t RequestSize = sizeof(FDP_UNSET_BREAKPOINT_MULTIPLE_PKT_REQ) + BreakpointCount * sizeof(int);
+    if(RequestSize >= FDP_MAX_DATA_SIZE)
+    {
+        return false;
+    }
+    bool bReturnValue = false;
+    LockSHM(pFDP->pSharedFDPSHM);
+    {
+        FDP_UNSET_BREAKPOINT_MULTIPLE_PKT_REQ* TempPkt = (FDP_UNSET_BREAKPOINT_MULTIPLE_PKT_REQ*) pFDP->OutputBuffer;
+        TempPkt->Type                                  = FDPCMD_UNSET_BP_MULTIPLE;
+        TempPkt->SessionId                             = pFDP->SessionId;
+        TempPkt->BreakpointCount                       = BreakpointCount;
+        memcpy(TempPkt->BreakpointIds, pBreakpointIds, BreakpointCount * sizeof(int));
+        if(WriteCmdWatched(pFDP, pFDP->OutputBuffer, (uint32_t) RequestSize))
+        {
+            ReadReplyWatched(pFDP, (uint8_t*) &bReturnValue, NULL, NULL);
+        }
+    }
+    UnlockSHM(pFDP->pSharedFDPSHM);
+    return bReturnValue;
+}
+
 FDP_EXPORTED
 int FDP_SetBreakpoint(
     FDP_SHM* pFDP,
@@ -714,6 +1862,11 @@ int FDP_SetBreakpoint(
     {
         return false;
     }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return -1;
+    }
     int                        iReturnedBreakpointId;
     FDP_SET_BREAKPOINT_PKT_REQ TempPkt;
     TempPkt.Type                  = FDPCMD_SET_BP;
@@ -725,6 +1878,7 @@ int FDP_SetBreakpoint(
     TempPkt.BreakpointAddress     = BreakpointAddress;
     TempPkt.BreakpointLength      = BreakpointLength;
     TempPkt.BreakpointCr3         = BreakpointCr3;
+    TempPkt.SessionId             = pFDP->SessionId;
     RunCmd(pFDP, &iReturnedBreakpointId, &TempPkt, sizeof TempPkt);
     return iReturnedBreakpointId;
 }
@@ -740,7 +1894,7 @@ bool FDP_VirtualToPhysical(FDP_SHM* pFDP, uint32_t CpuId, uint64_t VirtualAddres
     TempPkt.Type           = FDPCMD_VIRTUAL_PHYSICAL;
     TempPkt.CpuId          = CpuId;
     TempPkt.VirtualAddress = VirtualAddress;
-    RunCmd(pFDP, PhysicalAddress, &TempPkt, sizeof TempPkt);
+    RunCmdBufferParallel(pFDP, PhysicalAddress, &TempPkt, sizeof TempPkt, sizeof *PhysicalAddress);
     return true;
 }
 
@@ -794,12 +1948,38 @@ bool FDP_SingleStep(FDP_SHM* pFDP, uint32_t CpuId)
     {
         return false;
     }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
     FDP_SINGLE_STEP_PKT_REQ TempPkt;
     TempPkt.Type  = FDPCMD_SINGLE_STEP;
     TempPkt.CpuId = CpuId;
     return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
 }
 
+FDP_EXPORTED
+bool FDP_SingleStepMultiple(FDP_SHM* pFDP, uint32_t CpuId, uint64_t StepCount, uint64_t StopAddress, uint64_t* pStepsDone)
+{
+    if(pFDP == NULL || pStepsDone == NULL || StepCount == 0)
+    {
+        return false;
+    }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
+    FDP_SINGLE_STEP_MULTIPLE_PKT_REQ TempPkt;
+    TempPkt.Type        = FDPCMD_SINGLE_STEP_MULTIPLE;
+    TempPkt.CpuId       = CpuId;
+    TempPkt.StepCount   = StepCount;
+    TempPkt.StopAddress = StopAddress;
+    *pStepsDone         = 0;
+    return RunCmdBuffer(pFDP, pStepsDone, &TempPkt, sizeof TempPkt);
+}
+
 uint8_t FDP_Test(FDP_SHM* pFDP)
 {
     if(pFDP == NULL)
@@ -811,8 +1991,10 @@ uint8_t FDP_Test(FDP_SHM* pFDP)
     {
         FDP_GET_STATE_PKT_REQ* tmpPkt = (FDP_GET_STATE_PKT_REQ*) pFDP->OutputBuffer;
         tmpPkt->Type                  = FDPCMD_TEST;
-        WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pFDP->OutputBuffer, sizeof *tmpPkt);
-        ReadFDPData(&pFDP->pSharedFDPSHM->ServerToClient, (uint8_t*) &DebuggeState); // TODO: return success/fail !
+        if(WriteCmdWatched(pFDP, pFDP->OutputBuffer, sizeof *tmpPkt))
+        {
+            ReadReplyWatched(pFDP, (uint8_t*) &DebuggeState, NULL, NULL); // TODO: return success/fail !
+        }
     }
     UnlockSHM(pFDP->pSharedFDPSHM);
     return DebuggeState;
@@ -830,8 +2012,10 @@ bool FDP_GetFxState64(FDP_SHM* pFDP, uint32_t CpuId, FDP_XSAVE_FORMAT64_T* pFxSt
         FDP_GET_STATE_PKT_REQ* TempPkt = (FDP_GET_STATE_PKT_REQ*) pFDP->OutputBuffer;
         TempPkt->Type                  = FDPCMD_GET_FXSTATE;
         TempPkt->CpuId                 = CpuId;
-        WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pFDP->OutputBuffer, sizeof *TempPkt);
-        ReadFDPData(&pFDP->pSharedFDPSHM->ServerToClient, (uint8_t*) pFxState); // TODO: return success/fail !
+        if(WriteCmdWatched(pFDP, pFDP->OutputBuffer, sizeof *TempPkt))
+        {
+            ReadReplyWatched(pFDP, (uint8_t*) pFxState, NULL, NULL); // TODO: return success/fail !
+        }
     }
     UnlockSHM(pFDP->pSharedFDPSHM);
     return true;
@@ -844,6 +2028,11 @@ bool FDP_SetFxState64(FDP_SHM* pFDP, uint32_t CpuId, FDP_XSAVE_FORMAT64_T* pFxSt
     {
         return false;
     }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
     bool bReturnValue = false;
     LockSHM(pFDP->pSharedFDPSHM);
     {
@@ -851,65 +2040,149 @@ bool FDP_SetFxState64(FDP_SHM* pFDP, uint32_t CpuId, FDP_XSAVE_FORMAT64_T* pFxSt
         TempPkt->Type                 = FDPCMD_SET_FXSTATE;
         TempPkt->CpuId                = CpuId;
         memcpy(&TempPkt->FxState64, pFxState64, sizeof *pFxState64);
-        WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pFDP->OutputBuffer, sizeof *TempPkt);
-        ReadFDPData(&pFDP->pSharedFDPSHM->ServerToClient, (uint8_t*) &bReturnValue); // TODO: return success/fail !
+        if(WriteCmdWatched(pFDP, pFDP->OutputBuffer, sizeof *TempPkt))
+        {
+            ReadReplyWatched(pFDP, (uint8_t*) &bReturnValue, NULL, NULL); // TODO: return success/fail !
+        }
     }
     UnlockSHM(pFDP->pSharedFDPSHM);
     return bReturnValue;
 }
 
 FDP_EXPORTED
-bool FDP_GetPhysicalMemorySize(FDP_SHM* pFDP, uint64_t* PhysicalMemorySize)
+bool FDP_GetPhysicalMemorySize(FDP_SHM* pFDP, uint64_t* PhysicalMemorySize)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    bool bReturnValue = true;
+    FDP_SIMPLE_PKT_REQ TempPkt;
+    TempPkt.Type = FDPCMD_GET_MEMORYSIZE;
+    RunCmd(pFDP, PhysicalMemorySize, &TempPkt, sizeof TempPkt);
+    // TODO return bool !
+    return bReturnValue;
+}
+
+FDP_EXPORTED
+bool FDP_GetCpuCount(FDP_SHM* pFDP, uint32_t* CPUCount)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    bool bReturnValue = true;
+    FDP_SIMPLE_PKT_REQ TempPkt;
+    TempPkt.Type = FDPCMD_GET_CPU_COUNT;
+    RunCmd(pFDP, CPUCount, &TempPkt, sizeof TempPkt);
+    return bReturnValue;
+}
+
+FDP_EXPORTED
+bool FDP_GetCpuState(FDP_SHM* pFDP, uint32_t CpuId, FDP_State* pDebuggeeState)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    FDP_GET_CPU_STATE_PKT_REQ TempPkt;
+    TempPkt.Type  = FDPCMD_GET_CPU_STATE;
+    TempPkt.CpuId = CpuId;
+    RunCmd(pFDP, pDebuggeeState, &TempPkt, sizeof TempPkt);
+    return true;
+}
+
+FDP_EXPORTED
+bool FDP_GetCpuContext(FDP_SHM* pFDP, uint32_t CpuId, FDP_CPU_CTX_SNAPSHOT* pSnapshot)
+{
+    if(pFDP == NULL || pSnapshot == NULL)
+    {
+        return false;
+    }
+    // Fast way: a local server publishes the stopped context under a
+    // seqlock; a version of zero means nobody ever published there
+    if(pFDP->bRemoteTransport == false && pFDP->pCpuShm != NULL)
+    {
+        for(int Retry = 0; Retry < 8; Retry++)
+        {
+            const uint64_t Seq = pFDP->pCpuShm->StateSeq;
+            if(Seq == 0)
+            {
+                break;
+            }
+            if(Seq & 1)
+            {
+                continue;
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            FDP_CPU_CTX Ctx = *pFDP->pCpuShm;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(pFDP->pCpuShm->StateSeq != Seq)
+            {
+                continue;
+            }
+            pSnapshot->Ctx             = Ctx;
+            pSnapshot->MsrLstar        = Ctx.msr_lstar;
+            pSnapshot->MsrGsBase       = Ctx.gs_base;
+            pSnapshot->MsrKernelGsBase = Ctx.kernel_gs_base;
+            pSnapshot->MsrTsc          = Ctx.msr_tsc;
+            return true;
+        }
+    }
+    FDP_GET_CPU_STATE_PKT_REQ TempPkt;
+    TempPkt.Type  = FDPCMD_GET_CPU_CTX;
+    TempPkt.CpuId = CpuId;
+    return RunCmdBufferParallel(pFDP, pSnapshot, &TempPkt, sizeof TempPkt, sizeof *pSnapshot);
+}
+
+FDP_EXPORTED
+bool FDP_Save(FDP_SHM* pFDP)
 {
     if(pFDP == NULL)
     {
         return false;
     }
-    bool bReturnValue = true;
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
     FDP_SIMPLE_PKT_REQ TempPkt;
-    TempPkt.Type = FDPCMD_GET_MEMORYSIZE;
-    RunCmd(pFDP, PhysicalMemorySize, &TempPkt, sizeof TempPkt);
-    // TODO return bool !
-    return bReturnValue;
+    TempPkt.Type = FDPCMD_SAVE;
+    return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
 }
 
 FDP_EXPORTED
-bool FDP_GetCpuCount(FDP_SHM* pFDP, uint32_t* CPUCount)
+bool FDP_SaveIncremental(FDP_SHM* pFDP)
 {
     if(pFDP == NULL)
     {
         return false;
     }
-    bool bReturnValue = true;
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
     FDP_SIMPLE_PKT_REQ TempPkt;
-    TempPkt.Type = FDPCMD_GET_CPU_COUNT;
-    RunCmd(pFDP, CPUCount, &TempPkt, sizeof TempPkt);
-    return bReturnValue;
+    TempPkt.Type = FDPCMD_SAVE_INCREMENTAL;
+    return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
 }
 
 FDP_EXPORTED
-bool FDP_GetCpuState(FDP_SHM* pFDP, uint32_t CpuId, FDP_State* pDebuggeeState)
+bool FDP_RestoreIncremental(FDP_SHM* pFDP)
 {
     if(pFDP == NULL)
     {
         return false;
     }
-    FDP_GET_CPU_STATE_PKT_REQ TempPkt;
-    TempPkt.Type  = FDPCMD_GET_CPU_STATE;
-    TempPkt.CpuId = CpuId;
-    RunCmd(pFDP, pDebuggeeState, &TempPkt, sizeof TempPkt);
-    return true;
-}
-
-FDP_EXPORTED
-bool FDP_Save(FDP_SHM* pFDP)
-{
-    if(pFDP == NULL)
+    if(pFDP->bReadOnlySession)
     {
+        // pure observer sessions never mutate the vm
         return false;
     }
     FDP_SIMPLE_PKT_REQ TempPkt;
-    TempPkt.Type = FDPCMD_SAVE;
+    TempPkt.Type = FDPCMD_RESTORE_INCREMENTAL;
     return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
 }
 
@@ -920,6 +2193,11 @@ bool FDP_Restore(FDP_SHM* pFDP)
     {
         return false;
     }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
     FDP_SIMPLE_PKT_REQ TempPkt;
     TempPkt.Type = FDPCMD_RESTORE;
     return CheckRunCmd(pFDP, &TempPkt, sizeof TempPkt);
@@ -958,9 +2236,97 @@ void FDP_SetStateChanged(FDP_SHM* pFDP)
     }
     // UnlockSHM(pFDP->pSharedFDPSHM);
     ttas_spinlock_unlock(&pFDP->pSharedFDPSHM->stateChangedLock);
+    pFDP->pSharedFDPSHM->Telemetry.StateChangeCount.fetch_add(1, std::memory_order_relaxed);
     return;
 }
 
+FDP_EXPORTED
+bool FDP_PushStateEvent(FDP_SHM* pFDP, uint16_t State, uint32_t CpuId, uint64_t Rip)
+{
+    // servers without their own trap stamp fold trap handling into the
+    // publish stamp, the span still starts as close to the exit as we know
+    return FDP_PushStateEventTimed(pFDP, State, CpuId, Rip, NowNs());
+}
+
+FDP_EXPORTED
+bool FDP_PushStateEventTimed(FDP_SHM* pFDP, uint16_t State, uint32_t CpuId, uint64_t Rip, uint64_t TrapNs)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    FDP_EVENT_QUEUE* pQueue   = &pFDP->pSharedFDPSHM->EventQueue;
+    const uint32_t writeIndex = pQueue->writeIndex.load(std::memory_order_relaxed);
+    const uint32_t readIndex  = pQueue->readIndex.load(std::memory_order_acquire);
+    if(writeIndex - readIndex >= FDP_EVENT_QUEUE_SIZE)
+    {
+        return false; // queue is full
+    }
+    FDP_EVENT* pEvent = (FDP_EVENT*) &pQueue->events[writeIndex % FDP_EVENT_QUEUE_SIZE];
+    pEvent->State     = State;
+    pEvent->CpuId     = CpuId;
+    pEvent->Rip       = Rip;
+    pEvent->EventId   = writeIndex; // write indices are never reused
+    pEvent->TrapNs    = TrapNs;
+    pEvent->PublishNs = NowNs();
+    pQueue->writeIndex.store(writeIndex + 1, std::memory_order_release);
+    if(State & (FDP_STATE_BREAKPOINT_HIT | FDP_STATE_HARD_BREAKPOINT_HIT))
+    {
+        pFDP->pSharedFDPSHM->Telemetry.BreakpointHitCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    // keep legacy pollers working
+    FDP_SetStateChanged(pFDP);
+    return true;
+}
+
+FDP_EXPORTED
+uint32_t FDP_PopStateEvents(FDP_SHM* pFDP, FDP_EVENT* pEvents, uint32_t MaxEventCount)
+{
+    if(pFDP == NULL || pEvents == NULL)
+    {
+        return 0;
+    }
+    FDP_EVENT_QUEUE* pQueue  = &pFDP->pSharedFDPSHM->EventQueue;
+    uint32_t u32PoppedEvents = 0;
+    while(u32PoppedEvents < MaxEventCount)
+    {
+        const uint32_t readIndex  = pQueue->readIndex.load(std::memory_order_relaxed);
+        const uint32_t writeIndex = pQueue->writeIndex.load(std::memory_order_acquire);
+        if(readIndex == writeIndex)
+        {
+            break; // queue is empty
+        }
+        pEvents[u32PoppedEvents] = pQueue->events[readIndex % FDP_EVENT_QUEUE_SIZE];
+        pQueue->readIndex.store(readIndex + 1, std::memory_order_release);
+        u32PoppedEvents++;
+    }
+    return u32PoppedEvents;
+}
+
+FDP_EXPORTED
+uint32_t FDP_PendingStateEvents(FDP_SHM* pFDP)
+{
+    if(pFDP == NULL)
+    {
+        return 0;
+    }
+    FDP_EVENT_QUEUE* pQueue   = &pFDP->pSharedFDPSHM->EventQueue;
+    const uint32_t readIndex  = pQueue->readIndex.load(std::memory_order_relaxed);
+    const uint32_t writeIndex = pQueue->writeIndex.load(std::memory_order_acquire);
+    return writeIndex - readIndex;
+}
+
+FDP_EXPORTED
+bool FDP_PeekStateChanged(FDP_SHM* pFDP)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    // lock-free read, the flag is only cleared by FDP_GetStateChanged
+    return pFDP->pSharedFDPSHM->stateChanged;
+}
+
 FDP_EXPORTED
 bool FDP_InjectInterrupt(FDP_SHM* pFDP, uint32_t CpuId, uint32_t uInterruptionCode, uint32_t uErrorCode,
                          uint64_t Cr2Value)
@@ -969,6 +2335,11 @@ bool FDP_InjectInterrupt(FDP_SHM* pFDP, uint32_t CpuId, uint32_t uInterruptionCo
     {
         return false;
     }
+    if(pFDP->bReadOnlySession)
+    {
+        // pure observer sessions never mutate the vm
+        return false;
+    }
     bool bReturnValue = false;
     LockSHM(pFDP->pSharedFDPSHM);
     {
@@ -978,321 +2349,1103 @@ bool FDP_InjectInterrupt(FDP_SHM* pFDP, uint32_t CpuId, uint32_t uInterruptionCo
         tmpPkt->Cr2Value                     = Cr2Value;
         tmpPkt->ErrorCode                    = uErrorCode;
         tmpPkt->InterruptionCode             = uInterruptionCode;
-        WriteFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pFDP->OutputBuffer, sizeof *tmpPkt);
-        ReadFDPData(&pFDP->pSharedFDPSHM->ServerToClient, (uint8_t*) &bReturnValue); // TODO: return success/fail !
+        if(WriteCmdWatched(pFDP, pFDP->OutputBuffer, sizeof *tmpPkt))
+        {
+            ReadReplyWatched(pFDP, (uint8_t*) &bReturnValue, NULL, NULL); // TODO: return success/fail !
+        }
     }
     UnlockSHM(pFDP->pSharedFDPSHM);
     return bReturnValue;
 }
 
-// Server Part
 FDP_EXPORTED
-bool FDP_ServerLoop(FDP_SHM* pFDP)
+bool FDP_EnqueueCommand(FDP_SHM* pFDP, const void* pCommand, uint32_t CommandSize)
 {
-    if(pFDP == NULL)
+    if(pFDP == NULL || pCommand == NULL || pFDP->bRemoteTransport)
+    {
+        // the TCP relay only serves the canals, not the pipelining rings
+        return false;
+    }
+    return RingPush(&pFDP->pSharedFDPSHM->ClientToServerRing, (const uint8_t*) pCommand, CommandSize, true);
+}
+
+FDP_EXPORTED
+uint32_t FDP_CollectResponse(FDP_SHM* pFDP, void* pResponseBuffer, uint32_t MaxResponseSize, bool* pbStatus)
+{
+    if(pFDP == NULL || pResponseBuffer == NULL)
+    {
+        return 0;
+    }
+    // pipelined responses carry no single command class, wait with the
+    // shortest measured quantum so the fastest class never oversleeps
+    uint64_t SleepNs    = 0;
+    size_t   SpinBudget = 0;
+    for(int i = 0; i < FDP_WAIT_CLASS_COUNT; i++)
+    {
+        const FDP_WAIT_STATS* pStats = &pFDP->WaitTuning.aClasses[i];
+        if(pStats->Samples == 0)
+        {
+            continue;
+        }
+        if(SleepNs == 0 || pStats->SleepNs < SleepNs)
+        {
+            SleepNs = pStats->SleepNs;
+        }
+        if(pStats->SpinBudget > SpinBudget)
+        {
+            SpinBudget = (size_t) pStats->SpinBudget;
+        }
+    }
+    if(SleepNs == 0)
+    {
+        SleepNs    = default_sleep_ns;
+        SpinBudget = max_wait_iters;
+    }
+    size_t num_iters = 0;
+    while(true)
+    {
+        const uint32_t dataSize = RingPop(&pFDP->pSharedFDPSHM->ServerToClientRing,
+                                          (uint8_t*) pResponseBuffer, MaxResponseSize, pbStatus);
+        if(dataSize != 0)
+        {
+            return dataSize;
+        }
+        if(num_iters < SpinBudget)
+        {
+            ++num_iters;
+            PAUSE;
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(SleepNs));
+        }
+    }
+}
+
+// Fill the whole register file plus the hot MSRs with server-side calls,
+// one channel round trip instead of one per register
+static bool FDP_FillCpuContext(FDP_SHM* pFDP, uint32_t CpuId, FDP_CPU_CTX_SNAPSHOT* pSnapshot)
+{
+    FDP_SERVER_INTERFACE_T* pServer = pFDP->pFdpServer;
+    const struct
+    {
+        FDP_Register RegisterId;
+        uint64_t*    pValue;
+    } aEntries[] = {
+        {FDP_RIP_REGISTER, &pSnapshot->Ctx.rip},
+        {FDP_RAX_REGISTER, &pSnapshot->Ctx.rax},
+        {FDP_RCX_REGISTER, &pSnapshot->Ctx.rcx},
+        {FDP_RDX_REGISTER, &pSnapshot->Ctx.rdx},
+        {FDP_RBX_REGISTER, &pSnapshot->Ctx.rbx},
+        {FDP_RSP_REGISTER, &pSnapshot->Ctx.rsp},
+        {FDP_RBP_REGISTER, &pSnapshot->Ctx.rbp},
+        {FDP_RSI_REGISTER, &pSnapshot->Ctx.rsi},
+        {FDP_RDI_REGISTER, &pSnapshot->Ctx.rdi},
+        {FDP_R8_REGISTER, &pSnapshot->Ctx.r8},
+        {FDP_R9_REGISTER, &pSnapshot->Ctx.r9},
+        {FDP_R10_REGISTER, &pSnapshot->Ctx.r10},
+        {FDP_R11_REGISTER, &pSnapshot->Ctx.r11},
+        {FDP_R12_REGISTER, &pSnapshot->Ctx.r12},
+        {FDP_R13_REGISTER, &pSnapshot->Ctx.r13},
+        {FDP_R14_REGISTER, &pSnapshot->Ctx.r14},
+        {FDP_R15_REGISTER, &pSnapshot->Ctx.r15},
+        {FDP_ES_REGISTER, &pSnapshot->Ctx.es},
+        {FDP_CS_REGISTER, &pSnapshot->Ctx.cs},
+        {FDP_SS_REGISTER, &pSnapshot->Ctx.ss},
+        {FDP_DS_REGISTER, &pSnapshot->Ctx.ds},
+        {FDP_FS_REGISTER, &pSnapshot->Ctx.fs},
+        {FDP_GS_REGISTER, &pSnapshot->Ctx.gs},
+        {FDP_RFLAGS_REGISTER, &pSnapshot->Ctx.rflags},
+        {FDP_CR0_REGISTER, &pSnapshot->Ctx.cr0},
+        {FDP_CR2_REGISTER, &pSnapshot->Ctx.cr2},
+        {FDP_CR3_REGISTER, &pSnapshot->Ctx.cr3},
+        {FDP_CR4_REGISTER, &pSnapshot->Ctx.cr4},
+    };
+    bool bStatus = true;
+    for(size_t i = 0; i < sizeof aEntries / sizeof aEntries[0]; i++)
+    {
+        bStatus &= pServer->pfnReadRegister(pServer->pUserHandle, CpuId, aEntries[i].RegisterId, aEntries[i].pValue);
+    }
+    bStatus &= pServer->pfnReadMsr(pServer->pUserHandle, CpuId, 0xC0000082, &pSnapshot->MsrLstar);
+    bStatus &= pServer->pfnReadMsr(pServer->pUserHandle, CpuId, 0xC0000101, &pSnapshot->MsrGsBase);
+    bStatus &= pServer->pfnReadMsr(pServer->pUserHandle, CpuId, 0xC0000102, &pSnapshot->MsrKernelGsBase);
+    bStatus &= pServer->pfnReadMsr(pServer->pUserHandle, CpuId, 0x10, &pSnapshot->MsrTsc);
+    return bStatus;
+}
+
+// Publish the freshly stopped context into the lock-free CPU mapping so
+// local clients read a consistent block with zero commands. Single
+// writer: only the main serving thread calls this, the seqlock version
+// is odd while the block is mid-update
+static void FDP_PublishCpuContext(FDP_SHM* pFDP, uint32_t CpuId)
+{
+    FDP_CPU_CTX* pCpuShm = pFDP->pCpuShm;
+    if(pCpuShm == NULL)
+    {
+        return;
+    }
+    FDP_SERVER_INTERFACE_T* pServer  = pFDP->pFdpServer;
+    FDP_CPU_CTX_SNAPSHOT    Snapshot;
+    memset(&Snapshot, 0, sizeof Snapshot);
+    if(FDP_FillCpuContext(pFDP, CpuId, &Snapshot) == false)
+    {
+        return;
+    }
+    Snapshot.Ctx.gs_base        = Snapshot.MsrGsBase;
+    Snapshot.Ctx.kernel_gs_base = Snapshot.MsrKernelGsBase;
+    Snapshot.Ctx.msr_lstar      = Snapshot.MsrLstar;
+    Snapshot.Ctx.msr_tsc        = Snapshot.MsrTsc;
+    pServer->pfnReadMsr(pServer->pUserHandle, CpuId, 0xC0000100, &Snapshot.Ctx.fs_base);
+    pServer->pfnReadRegister(pServer->pUserHandle, CpuId, FDP_GDTRB_REGISTER, &Snapshot.Ctx.gdtrb);
+    pServer->pfnReadRegister(pServer->pUserHandle, CpuId, FDP_IDTRB_REGISTER, &Snapshot.Ctx.idtrb);
+    const uint64_t BaseSeq = pCpuShm->StateSeq;
+    pCpuShm->StateSeq      = BaseSeq + 1;
+    std::atomic_thread_fence(std::memory_order_release);
+    Snapshot.Ctx.StateSeq = BaseSeq + 1;
+    *pCpuShm              = Snapshot.Ctx;
+    std::atomic_thread_fence(std::memory_order_release);
+    pCpuShm->StateSeq       = BaseSeq + 2;
+    pFDP->bCpuCtxPublished  = true;
+}
+
+// sessions only scope breakpoint slots: a slot set by session A cannot be
+// cleared by session B, while legacy unscoped clients (session 0) keep the
+// historical free-for-all behavior
+static bool FDP_OwnsBreakpoint(FDP_SHM* pFDP, uint32_t SessionId, int BreakpointId)
+{
+    if(SessionId == 0)
+    {
+        return true;
+    }
+    if(BreakpointId < 0 || BreakpointId >= FDP_MAX_BREAKPOINT)
+    {
+        return true; // let the backend reject the id itself
+    }
+    const uint32_t Owner = pFDP->aBreakpointOwner[BreakpointId];
+    return Owner == 0 || Owner == SessionId;
+}
+
+static void FDP_ReleaseBreakpointOwner(FDP_SHM* pFDP, int BreakpointId)
+{
+    if(BreakpointId >= 0 && BreakpointId < FDP_MAX_BREAKPOINT)
+    {
+        pFDP->aBreakpointOwner[BreakpointId] = 0;
+    }
+}
+
+// Read the byte a soft breakpoint patch is about to replace; must run
+// before pfnSetBreakpoint while the original code is still in place
+static bool FDP_CaptureShadowByte(FDP_SHM* pFDP, uint32_t CpuId, FDP_BreakpointType BreakpointType, FDP_AddressType BreakpointAddressType, uint64_t BreakpointAddress, uint8_t* pOriginalByte)
+{
+    if(BreakpointType != FDP_SOFTHBP)
     {
         return false;
     }
-    uint32_t u32InputBufferSize  = 0;
+    if(BreakpointAddressType == FDP_VIRTUAL_ADDRESS)
+    {
+        return pFDP->pFdpServer->pfnReadVirtualMemory(pFDP->pFdpServer->pUserHandle, CpuId, BreakpointAddress, 1, pOriginalByte);
+    }
+    return pFDP->pFdpServer->pfnReadPhysicalMemory(pFDP->pFdpServer->pUserHandle, pOriginalByte, BreakpointAddress, 1);
+}
+
+static void FDP_CommitShadowByte(FDP_SHM* pFDP, int BreakpointId, FDP_AddressType BreakpointAddressType, uint64_t BreakpointAddress, uint8_t OriginalByte)
+{
+    if(BreakpointId < 0 || BreakpointId >= FDP_MAX_BREAKPOINT)
+    {
+        return;
+    }
+    FDP_SHM_SHARED*      pShared = pFDP->pSharedFDPSHM;
+    FDP_BP_SHADOW_ENTRY* pEntry  = &pShared->aBreakpointShadow[BreakpointId];
+    pEntry->AddressType          = (uint8_t) BreakpointAddressType;
+    pEntry->OriginalByte         = OriginalByte;
+    pEntry->Address              = BreakpointAddress;
+    if((uint32_t) BreakpointId >= pShared->BreakpointShadowHighWater)
+    {
+        pShared->BreakpointShadowHighWater = BreakpointId + 1;
+    }
+    pEntry->bEnabled = 1;
+}
+
+static void FDP_DropShadowByte(FDP_SHM* pFDP, int BreakpointId)
+{
+    if(BreakpointId < 0 || BreakpointId >= FDP_MAX_BREAKPOINT)
+    {
+        return;
+    }
+    pFDP->pSharedFDPSHM->aBreakpointShadow[BreakpointId].bEnabled = 0;
+}
+
+// Server Part
+// Execute the command found in pFDP->InputBuffer, fill pFDP->OutputBuffer
+// and return the answer size
+static uint32_t FDP_ExecuteCommand(FDP_SHM* pFDP, bool* pbStatus)
+{
     uint32_t u32OutputBuffersize = 0;
-    pFDP->pFdpServer->bIsRunning = true;
-    while(pFDP->pFdpServer->bIsRunning)
+    bool     bStatus             = true;
+    uint8_t  Type                = pFDP->InputBuffer[0];
+    switch(Type)
     {
-        bool bStatus       = true;
-        u32InputBufferSize = ReadFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pFDP->InputBuffer);
-        if(u32InputBufferSize == 0)
+        case FDPCMD_TEST:
         {
-            return false;
+            pFDP->OutputBuffer[0] = 0; // TODO: true !
+            u32OutputBuffersize   = 1;
+            break;
+        }
+        case FDPCMD_SAVE:
+        {
+            pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnSave(pFDP->pFdpServer->pUserHandle);
+            u32OutputBuffersize   = 1;
+            break;
+        }
+        case FDPCMD_SAVE_INCREMENTAL:
+        {
+            // full save when the server has no dirty-page tracking
+            if(pFDP->pFdpServer->pfnSaveIncremental != NULL)
+            {
+                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnSaveIncremental(pFDP->pFdpServer->pUserHandle);
+            }
+            else
+            {
+                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnSave(pFDP->pFdpServer->pUserHandle);
+            }
+            u32OutputBuffersize = 1;
+            break;
+        }
+        case FDPCMD_RESTORE_INCREMENTAL:
+        {
+            // only rewrite pages dirtied since the last save when tracked
+            if(pFDP->pFdpServer->pfnRestoreIncremental != NULL)
+            {
+                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnRestoreIncremental(pFDP->pFdpServer->pUserHandle);
+            }
+            else
+            {
+                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnRestore(pFDP->pFdpServer->pUserHandle);
+            }
+            u32OutputBuffersize = 1;
+            break;
+        }
+        case FDPCMD_RESTORE:
+        {
+            pFDP->OutputBuffer[0]  = pFDP->pFdpServer->pfnRestore(pFDP->pFdpServer->pUserHandle);
+            pFDP->bCpuCtxPublished = false;
+            u32OutputBuffersize    = 1;
+            break;
+        }
+        case FDPCMD_REBOOT:
+        {
+            pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnReboot(pFDP->pFdpServer->pUserHandle);
+            u32OutputBuffersize   = 1;
+            break;
+        }
+        case FDPCMD_GET_CPU_COUNT:
+        {
+            uint32_t CpuCout;
+            pFDP->pFdpServer->pfnGetCpuCount(pFDP->pFdpServer->pUserHandle, &CpuCout);
+            ((uint32_t*) pFDP->OutputBuffer)[0] = CpuCout;
+            u32OutputBuffersize                 = sizeof CpuCout;
+            break;
+        }
+        case FDPCMD_GET_STATE:
+        {
+            uint8_t CurrentState;
+            pFDP->pFdpServer->pfnGetState(pFDP->pFdpServer->pUserHandle, &CurrentState);
+            if((CurrentState & (FDP_STATE_PAUSED | FDP_STATE_BREAKPOINT_HIT)) && pFDP->bCpuCtxPublished == false)
+            {
+                FDP_PublishCpuContext(pFDP, 0);
+            }
+            pFDP->OutputBuffer[0] = CurrentState;
+            u32OutputBuffersize   = sizeof CurrentState;
+            break;
+        }
+        case FDPCMD_GET_CPU_STATE:
+        {
+            uint8_t CurrentState           = 0;
+            FDP_GET_STATE_PKT_REQ* TempPkt = (FDP_GET_STATE_PKT_REQ*) pFDP->InputBuffer;
+            pFDP->pFdpServer->pfnGetCpuState(pFDP->pFdpServer->pUserHandle, TempPkt->CpuId, &CurrentState);
+            if((CurrentState & (FDP_STATE_PAUSED | FDP_STATE_BREAKPOINT_HIT)) && pFDP->bCpuCtxPublished == false)
+            {
+                FDP_PublishCpuContext(pFDP, TempPkt->CpuId);
+            }
+            pFDP->OutputBuffer[0] = CurrentState;
+            u32OutputBuffersize   = sizeof CurrentState;
+            break;
+        }
+        case FDPCMD_GET_MEMORYSIZE:
+        {
+            uint64_t u64PhysicalMemorySize;
+            pFDP->pFdpServer->pfnGetMemorySize(pFDP->pFdpServer->pUserHandle, &u64PhysicalMemorySize);
+            ((uint64_t*) pFDP->OutputBuffer)[0] = u64PhysicalMemorySize;
+            u32OutputBuffersize                 = sizeof u64PhysicalMemorySize;
+            break;
+        }
+        case FDPCMD_UNSET_BP:
+        {
+            FDP_CLEAR_BREAKPOINT_PKT_REQ* TempPkt = (FDP_CLEAR_BREAKPOINT_PKT_REQ*) pFDP->InputBuffer;
+            const uint32_t SessionId              = pFDP->InputDataSize >= sizeof(FDP_CLEAR_BREAKPOINT_PKT_REQ) ? TempPkt->SessionId : 0;
+            if(FDP_OwnsBreakpoint(pFDP, SessionId, TempPkt->BreakpointId) == false)
+            {
+                pFDP->OutputBuffer[0] = false;
+                u32OutputBuffersize   = 1;
+                break;
+            }
+            FDP_DropShadowByte(pFDP, TempPkt->BreakpointId);
+            FDP_ReleaseBreakpointOwner(pFDP, TempPkt->BreakpointId);
+            pFDP->OutputBuffer[0]                 = pFDP->pFdpServer->pfnUnsetBreakpoint(pFDP->pFdpServer->pUserHandle, TempPkt->BreakpointId);
+            u32OutputBuffersize                   = 1;
+            break;
+        }
+        case FDPCMD_SET_BP:
+        {
+            FDP_SET_BREAKPOINT_PKT_REQ* TempPkt = (FDP_SET_BREAKPOINT_PKT_REQ*) pFDP->InputBuffer;
+            uint8_t    OriginalByte             = 0;
+            const bool bShadowValid             = FDP_CaptureShadowByte(pFDP,
+                                                           TempPkt->CpuId,
+                                                           TempPkt->BreakpointType,
+                                                           TempPkt->BreakpointAddressType,
+                                                           TempPkt->BreakpointAddress,
+                                                           &OriginalByte);
+            const int BreakpointId              = pFDP->pFdpServer->pfnSetBreakpoint(pFDP->pFdpServer->pUserHandle,
+                                                                        TempPkt->CpuId,
+                                                                        TempPkt->BreakpointType,
+                                                                        TempPkt->BreakpointId,
+                                                                        TempPkt->BreakpointAccessType,
+                                                                        TempPkt->BreakpointAddressType,
+                                                                        TempPkt->BreakpointAddress,
+                                                                        TempPkt->BreakpointLength,
+                                                                        TempPkt->BreakpointCr3);
+            if(bShadowValid)
+            {
+                FDP_CommitShadowByte(pFDP, BreakpointId, TempPkt->BreakpointAddressType, TempPkt->BreakpointAddress, OriginalByte);
+            }
+            if(BreakpointId >= 0 && BreakpointId < FDP_MAX_BREAKPOINT)
+            {
+                // legacy short packets carry no session, the slot stays unscoped
+                pFDP->aBreakpointOwner[BreakpointId] = pFDP->InputDataSize >= sizeof(FDP_SET_BREAKPOINT_PKT_REQ) ? TempPkt->SessionId : 0;
+            }
+            ((int*) pFDP->OutputBuffer)[0]      = BreakpointId;
+            u32OutputBuffersize                 = sizeof(int);
+            break;
+        }
+        case FDPCMD_READ_PHYSICAL_STREAM:
+        {
+            FDP_READ_PHYSICAL_MEMORY_STREAM_PKT_REQ* TempPkt = (FDP_READ_PHYSICAL_MEMORY_STREAM_PKT_REQ*) pFDP->InputBuffer;
+            uint64_t Remaining                               = TempPkt->ReadSize;
+            uint64_t Offset                                  = 0;
+            uint32_t ChunkIndex                              = 0;
+            while(Remaining > 0)
+            {
+                const uint32_t ChunkSize = (uint32_t) std::min<uint64_t>(Remaining, FDP_STREAM_CHUNK_SIZE);
+                const bool bChunkStatus  = pFDP->pFdpServer->pfnReadPhysicalMemory(pFDP->pFdpServer->pUserHandle,
+                                                                                  pFDP->OutputBuffer,
+                                                                                  TempPkt->PhysicalAddress + Offset,
+                                                                                  ChunkSize);
+                // alternate canals so the client drains one while we refill
+                // the other
+                FDP_SHM_CANAL* pCanal = (ChunkIndex & 1) ? &pFDP->pSharedFDPSHM->ClientToServer
+                                                         : &pFDP->pSharedFDPSHM->ServerToClient;
+                WriteFDPDataWithStatus(pCanal, pFDP->OutputBuffer, ChunkSize, bChunkStatus);
+                Remaining -= ChunkSize;
+                Offset += ChunkSize;
+                ChunkIndex++;
+            }
+            u32OutputBuffersize = 0; // chunks already streamed, no trailing reply
+            break;
+        }
+        case FDPCMD_SET_BP_MULTIPLE:
+        {
+            FDP_SET_BREAKPOINT_MULTIPLE_PKT_REQ* TempPkt = (FDP_SET_BREAKPOINT_MULTIPLE_PKT_REQ*) pFDP->InputBuffer;
+            int* pBreakpointIds                          = (int*) pFDP->OutputBuffer;
+            for(uint32_t i = 0; i < TempPkt->BreakpointCount; i++)
+            {
+                const FDP_BREAKPOINT_DESC* pDesc = &TempPkt->Breakpoints[i];
+                uint8_t    OriginalByte          = 0;
+                const bool bShadowValid          = FDP_CaptureShadowByte(pFDP,
+                                                              TempPkt->CpuId,
+                                                              pDesc->BreakpointType,
+                                                              pDesc->BreakpointAddressType,
+                                                              pDesc->BreakpointAddress,
+                                                              &OriginalByte);
+                pBreakpointIds[i]                = pFDP->pFdpServer->pfnSetBreakpoint(pFDP->pFdpServer->pUserHandle,
+                                                                       TempPkt->CpuId,
+                                                                       pDesc->BreakpointType,
+                                                                       pDesc->BreakpointId,
+                                                                       pDesc->BreakpointAccessType,
+                                                                       pDesc->BreakpointAddressType,
+                                                                       pDesc->BreakpointAddress,
+                                                                       pDesc->BreakpointLength,
+                                                                       pDesc->BreakpointCr3);
+                if(bShadowValid)
+                {
+                    FDP_CommitShadowByte(pFDP, pBreakpointIds[i], pDesc->BreakpointAddressType, pDesc->BreakpointAddress, OriginalByte);
+                }
+                if(pBreakpointIds[i] >= 0 && pBreakpointIds[i] < FDP_MAX_BREAKPOINT)
+                {
+                    pFDP->aBreakpointOwner[pBreakpointIds[i]] = TempPkt->SessionId;
+                }
+            }
+            u32OutputBuffersize = TempPkt->BreakpointCount * sizeof(int);
+            break;
+        }
+        case FDPCMD_OPEN_SESSION:
+        {
+            // the server only names sessions, read-only is enforced client-side
+            pFDP->NextSessionId                 = pFDP->NextSessionId + 1;
+            if(pFDP->NextSessionId == 0)
+            {
+                pFDP->NextSessionId = 1; // 0 stays the legacy unscoped id
+            }
+            ((uint32_t*) pFDP->OutputBuffer)[0] = pFDP->NextSessionId;
+            u32OutputBuffersize                 = sizeof(uint32_t);
+            break;
+        }
+        case FDPCMD_CLOSE_SESSION:
+        {
+            // reclaim every breakpoint the session still owns
+            FDP_CLOSE_SESSION_PKT_REQ* TempPkt = (FDP_CLOSE_SESSION_PKT_REQ*) pFDP->InputBuffer;
+            bool bAllUnset                     = true;
+            if(TempPkt->SessionId != 0)
+            {
+                for(int i = 0; i < FDP_MAX_BREAKPOINT; i++)
+                {
+                    if(pFDP->aBreakpointOwner[i] != TempPkt->SessionId)
+                    {
+                        continue;
+                    }
+                    FDP_DropShadowByte(pFDP, i);
+                    FDP_ReleaseBreakpointOwner(pFDP, i);
+                    bAllUnset &= pFDP->pFdpServer->pfnUnsetBreakpoint(pFDP->pFdpServer->pUserHandle, i);
+                }
+            }
+            pFDP->OutputBuffer[0] = bAllUnset;
+            u32OutputBuffersize   = 1;
+            break;
         }
-        uint8_t Type = pFDP->InputBuffer[0];
-        switch(Type)
+        case FDPCMD_SET_BP_FILTER:
         {
-            case FDPCMD_TEST:
+            // old servers without filter support report failure, the client
+            // keeps filtering hits on its side
+            FDP_SET_BREAKPOINT_FILTER_PKT_REQ* TempPkt = (FDP_SET_BREAKPOINT_FILTER_PKT_REQ*) pFDP->InputBuffer;
+            if(pFDP->pFdpServer->pfnSetBreakpointFilter != NULL)
             {
-                pFDP->OutputBuffer[0] = 0; // TODO: true !
-                u32OutputBuffersize   = 1;
-                break;
+                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnSetBreakpointFilter(pFDP->pFdpServer->pUserHandle,
+                                                                                 TempPkt->BreakpointId,
+                                                                                 TempPkt->FilterCr3,
+                                                                                 TempPkt->FilterThreadAddress,
+                                                                                 TempPkt->FilterThreadValue);
             }
-            case FDPCMD_SAVE:
+            else
             {
-                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnSave(pFDP->pFdpServer->pUserHandle);
-                u32OutputBuffersize   = 1;
-                break;
+                pFDP->OutputBuffer[0] = false;
             }
-            case FDPCMD_RESTORE:
+            u32OutputBuffersize = sizeof(bool);
+            break;
+        }
+        case FDPCMD_SET_BP_ONE_SHOT:
+        {
+            // the backend disarms the breakpoint itself on first hit; old
+            // servers report failure and the client keeps its unset round-trip
+            FDP_SET_BREAKPOINT_ONE_SHOT_PKT_REQ* TempPkt = (FDP_SET_BREAKPOINT_ONE_SHOT_PKT_REQ*) pFDP->InputBuffer;
+            if(pFDP->pFdpServer->pfnSetBreakpointOneShot != NULL)
             {
-                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnRestore(pFDP->pFdpServer->pUserHandle);
-                u32OutputBuffersize   = 1;
-                break;
+                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnSetBreakpointOneShot(pFDP->pFdpServer->pUserHandle,
+                                                                                  TempPkt->BreakpointId,
+                                                                                  TempPkt->bOneShot);
             }
-            case FDPCMD_REBOOT:
+            else
             {
-                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnReboot(pFDP->pFdpServer->pUserHandle);
-                u32OutputBuffersize   = 1;
-                break;
+                pFDP->OutputBuffer[0] = false;
             }
-            case FDPCMD_GET_CPU_COUNT:
+            u32OutputBuffersize = sizeof(bool);
+            break;
+        }
+        case FDPCMD_FORK:
+        {
+            // the monitor snapshots guest ram copy-on-write with its save
+            // machinery and answers the image path; old servers report
+            // failure and the client falls back to a full copy
+            memset(pFDP->OutputBuffer, 0, FDP_FORK_PATH_SIZE);
+            if(pFDP->pFdpServer->pfnFork != NULL)
             {
-                uint32_t CpuCout;
-                pFDP->pFdpServer->pfnGetCpuCount(pFDP->pFdpServer->pUserHandle, &CpuCout);
-                ((uint32_t*) pFDP->OutputBuffer)[0] = CpuCout;
-                u32OutputBuffersize                 = sizeof CpuCout;
-                break;
+                bStatus = pFDP->pFdpServer->pfnFork(pFDP->pFdpServer->pUserHandle,
+                                                    (char*) pFDP->OutputBuffer,
+                                                    FDP_FORK_PATH_SIZE);
             }
-            case FDPCMD_GET_STATE:
+            else
             {
-                uint8_t CurrentState;
-                pFDP->pFdpServer->pfnGetState(pFDP->pFdpServer->pUserHandle, &CurrentState);
-                pFDP->OutputBuffer[0] = CurrentState;
-                u32OutputBuffersize   = sizeof CurrentState;
-                break;
+                bStatus = false;
             }
-            case FDPCMD_GET_CPU_STATE:
+            u32OutputBuffersize = FDP_FORK_PATH_SIZE;
+            break;
+        }
+        case FDPCMD_SET_BP_REGISTER_FILTER:
+        {
+            // old servers without register predicates report failure, the
+            // client keeps filtering hits on its side
+            FDP_SET_BREAKPOINT_REGISTER_FILTER_PKT_REQ* TempPkt = (FDP_SET_BREAKPOINT_REGISTER_FILTER_PKT_REQ*) pFDP->InputBuffer;
+            if(pFDP->pFdpServer->pfnSetBreakpointRegisterFilter != NULL)
             {
-                uint8_t CurrentState           = 0;
-                FDP_GET_STATE_PKT_REQ* TempPkt = (FDP_GET_STATE_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->pFdpServer->pfnGetCpuState(pFDP->pFdpServer->pUserHandle, TempPkt->CpuId, &CurrentState);
-                pFDP->OutputBuffer[0] = CurrentState;
-                u32OutputBuffersize   = sizeof CurrentState;
-                break;
+                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnSetBreakpointRegisterFilter(pFDP->pFdpServer->pUserHandle,
+                                                                                         TempPkt->BreakpointId,
+                                                                                         TempPkt->RegisterId,
+                                                                                         TempPkt->Ranges,
+                                                                                         TempPkt->RangeCount);
             }
-            case FDPCMD_GET_MEMORYSIZE:
+            else
             {
-                uint64_t u64PhysicalMemorySize;
-                pFDP->pFdpServer->pfnGetMemorySize(pFDP->pFdpServer->pUserHandle, &u64PhysicalMemorySize);
-                ((uint64_t*) pFDP->OutputBuffer)[0] = u64PhysicalMemorySize;
-                u32OutputBuffersize                 = sizeof u64PhysicalMemorySize;
-                break;
+                pFDP->OutputBuffer[0] = false;
             }
-            case FDPCMD_UNSET_BP:
+            u32OutputBuffersize = sizeof(bool);
+            break;
+        }
+        case FDPCMD_UNSET_BP_MULTIPLE:
+        {
+            FDP_UNSET_BREAKPOINT_MULTIPLE_PKT_REQ* TempPkt = (FDP_UNSET_BREAKPOINT_MULTIPLE_PKT_REQ*) pFDP->InputBuffer;
+            bool bAllUnset                                 = true;
+            for(uint32_t i = 0; i < TempPkt->BreakpointCount; i++)
             {
-                FDP_CLEAR_BREAKPOINT_PKT_REQ* TempPkt = (FDP_CLEAR_BREAKPOINT_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->OutputBuffer[0]                 = pFDP->pFdpServer->pfnUnsetBreakpoint(pFDP->pFdpServer->pUserHandle, TempPkt->BreakpointId);
-                u32OutputBuffersize                   = 1;
-                break;
+                if(FDP_OwnsBreakpoint(pFDP, TempPkt->SessionId, TempPkt->BreakpointIds[i]) == false)
+                {
+                    bAllUnset = false;
+                    continue;
+                }
+                FDP_DropShadowByte(pFDP, TempPkt->BreakpointIds[i]);
+                FDP_ReleaseBreakpointOwner(pFDP, TempPkt->BreakpointIds[i]);
+                bAllUnset &= pFDP->pFdpServer->pfnUnsetBreakpoint(pFDP->pFdpServer->pUserHandle, TempPkt->BreakpointIds[i]);
             }
-            case FDPCMD_SET_BP:
+            pFDP->OutputBuffer[0] = bAllUnset;
+            u32OutputBuffersize   = sizeof(bool);
+            break;
+        }
+        case FDPCMD_VIRTUAL_PHYSICAL:
+        {
+            uint64_t PhysicalAddress              = 0;
+            FDP_VIRTUAL_PHYSICAL_PKT_REQ* TempPkt = (FDP_VIRTUAL_PHYSICAL_PKT_REQ*) pFDP->InputBuffer;
+            pFDP->pFdpServer->pfnVirtualToPhysical(pFDP->pFdpServer->pUserHandle,
+                                                   TempPkt->CpuId,
+                                                   TempPkt->VirtualAddress,
+                                                   &PhysicalAddress);
+            ((uint64_t*) pFDP->OutputBuffer)[0] = PhysicalAddress;
+            u32OutputBuffersize                 = sizeof PhysicalAddress;
+            break;
+        }
+        case FDPCMD_RESUME_VM:
+            pFDP->OutputBuffer[0]  = pFDP->pFdpServer->pfnResume(pFDP->pFdpServer->pUserHandle);
+            pFDP->bCpuCtxPublished = false;
+            u32OutputBuffersize    = sizeof(bool);
+            break;
+        case FDPCMD_PAUSE_VM:
+            pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnPause(pFDP->pFdpServer->pUserHandle);
+            FDP_PublishCpuContext(pFDP, 0);
+            u32OutputBuffersize   = sizeof(bool);
+            break;
+        case FDPCMD_SINGLE_STEP:
+        {
+            FDP_GET_STATE_PKT_REQ* TempPkt = (FDP_GET_STATE_PKT_REQ*) pFDP->InputBuffer;
+            pFDP->OutputBuffer[0]          = pFDP->pFdpServer->pfnSingleStep(pFDP->pFdpServer->pUserHandle, TempPkt->CpuId);
+            FDP_PublishCpuContext(pFDP, TempPkt->CpuId);
+            u32OutputBuffersize            = sizeof(bool);
+            break;
+        }
+        case FDPCMD_SINGLE_STEP_MULTIPLE:
+        {
+            // steps run server-side, the exit condition avoids one channel
+            // round trip per instruction
+            FDP_SINGLE_STEP_MULTIPLE_PKT_REQ* TempPkt = (FDP_SINGLE_STEP_MULTIPLE_PKT_REQ*) pFDP->InputBuffer;
+            uint64_t StepsDone                        = 0;
+            while(StepsDone < TempPkt->StepCount)
             {
-                FDP_SET_BREAKPOINT_PKT_REQ* TempPkt = (FDP_SET_BREAKPOINT_PKT_REQ*) pFDP->InputBuffer;
-                ((int*) pFDP->OutputBuffer)[0]      = pFDP->pFdpServer->pfnSetBreakpoint(pFDP->pFdpServer->pUserHandle,
-                                                                                    TempPkt->CpuId,
-                                                                                    TempPkt->BreakpointType,
-                                                                                    TempPkt->BreakpointId,
-                                                                                    TempPkt->BreakpointAccessType,
-                                                                                    TempPkt->BreakpointAddressType,
-                                                                                    TempPkt->BreakpointAddress,
-                                                                                    TempPkt->BreakpointLength,
-                                                                                    TempPkt->BreakpointCr3);
-                u32OutputBuffersize                 = sizeof(int);
-                break;
+                if(pFDP->pFdpServer->pfnSingleStep(pFDP->pFdpServer->pUserHandle, TempPkt->CpuId) == false)
+                {
+                    bStatus = false;
+                    break;
+                }
+                StepsDone++;
+                if(TempPkt->StopAddress != 0)
+                {
+                    uint64_t Rip = 0;
+                    pFDP->pFdpServer->pfnReadRegister(pFDP->pFdpServer->pUserHandle, TempPkt->CpuId, FDP_RIP_REGISTER, &Rip);
+                    if(Rip == TempPkt->StopAddress)
+                    {
+                        break;
+                    }
+                }
             }
-            case FDPCMD_VIRTUAL_PHYSICAL:
+            FDP_PublishCpuContext(pFDP, TempPkt->CpuId);
+            ((uint64_t*) pFDP->OutputBuffer)[0] = StepsDone;
+            u32OutputBuffersize                 = sizeof StepsDone;
+            break;
+        }
+        case FDPCMD_READ_REGISTER:
+        {
+            uint64_t RegisterValue             = 0;
+            FDP_READ_REGISTER_PKT_REQ* TempPkt = (FDP_READ_REGISTER_PKT_REQ*) pFDP->InputBuffer;
+            pFDP->pFdpServer->pfnReadRegister(pFDP->pFdpServer->pUserHandle,
+                                              TempPkt->CpuId,
+                                              TempPkt->RegisterId,
+                                              &RegisterValue);
+            ((uint64_t*) pFDP->OutputBuffer)[0] = RegisterValue;
+            u32OutputBuffersize                 = sizeof RegisterValue;
+            break;
+        }
+        case FDPCMD_GET_FXSTATE:
+        {
+            FDP_GET_STATE_PKT_REQ* TempPkt = (FDP_GET_STATE_PKT_REQ*) pFDP->InputBuffer;
+            pFDP->pFdpServer->pfnGetFxState64(pFDP->pFdpServer->pUserHandle,
+                                              TempPkt->CpuId,
+                                              pFDP->OutputBuffer,
+                                              &u32OutputBuffersize);
+            break;
+        }
+        case FDPCMD_SET_FXSTATE:
+        {
+            FDP_SET_FX_STATE_REQ* TempPkt = (FDP_SET_FX_STATE_REQ*) pFDP->InputBuffer;
+            pFDP->OutputBuffer[0]         = pFDP->pFdpServer->pfnSetFxState64(pFDP->pFdpServer->pUserHandle,
+                                                                      TempPkt->CpuId,
+                                                                      (uint8_t*) &TempPkt->FxState64,
+                                                                      sizeof TempPkt->FxState64);
+            u32OutputBuffersize           = sizeof(bool);
+            break;
+        }
+        case FDPCMD_READ_MSR:
+        {
+            uint64_t MsrValue             = 0;
+            FDP_READ_MSR_PKT_REQ* TempPkt = (FDP_READ_MSR_PKT_REQ*) pFDP->InputBuffer;
+            pFDP->pFdpServer->pfnReadMsr(pFDP->pFdpServer->pUserHandle,
+                                         TempPkt->CpuId,
+                                         TempPkt->MsrId,
+                                         &MsrValue);
+            ((uint64_t*) pFDP->OutputBuffer)[0] = MsrValue;
+            u32OutputBuffersize                 = sizeof MsrValue;
+            break;
+        }
+        case FDPCMD_WRITE_MSR:
+        {
+            FDP_WRITE_MSR_PKT_REQ* TempPkt = (FDP_WRITE_MSR_PKT_REQ*) pFDP->InputBuffer;
+            pFDP->OutputBuffer[0]          = pFDP->pFdpServer->pfnWriteMsr(pFDP->pFdpServer->pUserHandle,
+                                                                  TempPkt->CpuId,
+                                                                  TempPkt->MsrId,
+                                                                  TempPkt->MsrValue);
+            pFDP->bCpuCtxPublished         = false;
+            u32OutputBuffersize            = sizeof(bool);
+            break;
+        }
+        case FDPCMD_WRITE_REGISTER:
+        {
+            FDP_WRITE_REGISTER_PKT_REQ* TempPkt = (FDP_WRITE_REGISTER_PKT_REQ*) pFDP->InputBuffer;
+            pFDP->OutputBuffer[0]               = pFDP->pFdpServer->pfnWriteRegister(pFDP->pFdpServer->pUserHandle,
+                                                                       TempPkt->CpuId,
+                                                                       TempPkt->RegisterId,
+                                                                       TempPkt->RegisterValue);
+            pFDP->bCpuCtxPublished              = false;
+            u32OutputBuffersize                 = sizeof(bool);
+            break;
+        }
+        case FDPCMD_READ_PHYSICAL:
+        {
+            FDP_READ_PHYSICAL_MEMORY_PKT_REQ* TempPkt = (FDP_READ_PHYSICAL_MEMORY_PKT_REQ*) pFDP->InputBuffer;
+            if(TempPkt->ReadSize > FDP_MAX_DATA_SIZE)
             {
-                uint64_t PhysicalAddress              = 0;
-                FDP_VIRTUAL_PHYSICAL_PKT_REQ* TempPkt = (FDP_VIRTUAL_PHYSICAL_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->pFdpServer->pfnVirtualToPhysical(pFDP->pFdpServer->pUserHandle,
-                                                       TempPkt->CpuId,
-                                                       TempPkt->VirtualAddress,
-                                                       &PhysicalAddress);
-                ((uint64_t*) pFDP->OutputBuffer)[0] = PhysicalAddress;
-                u32OutputBuffersize                 = sizeof PhysicalAddress;
-                break;
+                bStatus = false;
             }
-            case FDPCMD_RESUME_VM:
-                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnResume(pFDP->pFdpServer->pUserHandle);
-                u32OutputBuffersize   = sizeof(bool);
-                break;
-            case FDPCMD_PAUSE_VM:
-                pFDP->OutputBuffer[0] = pFDP->pFdpServer->pfnPause(pFDP->pFdpServer->pUserHandle);
-                u32OutputBuffersize   = sizeof(bool);
-                break;
-            case FDPCMD_SINGLE_STEP:
+            else
             {
-                FDP_GET_STATE_PKT_REQ* TempPkt = (FDP_GET_STATE_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->OutputBuffer[0]          = pFDP->pFdpServer->pfnSingleStep(pFDP->pFdpServer->pUserHandle, TempPkt->CpuId);
-                u32OutputBuffersize            = sizeof(bool);
-                break;
+                bStatus = pFDP->pFdpServer->pfnReadPhysicalMemory(pFDP->pFdpServer->pUserHandle,
+                                                                  pFDP->OutputBuffer,
+                                                                  TempPkt->PhysicalAddress,
+                                                                  TempPkt->ReadSize);
             }
-            case FDPCMD_READ_REGISTER:
+            if(bStatus)
             {
-                uint64_t RegisterValue             = 0;
-                FDP_READ_REGISTER_PKT_REQ* TempPkt = (FDP_READ_REGISTER_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->pFdpServer->pfnReadRegister(pFDP->pFdpServer->pUserHandle,
-                                                  TempPkt->CpuId,
-                                                  TempPkt->RegisterId,
-                                                  &RegisterValue);
-                ((uint64_t*) pFDP->OutputBuffer)[0] = RegisterValue;
-                u32OutputBuffersize                 = sizeof RegisterValue;
-                break;
+                u32OutputBuffersize = TempPkt->ReadSize;
             }
-            case FDPCMD_GET_FXSTATE:
+            else
             {
-                FDP_GET_STATE_PKT_REQ* TempPkt = (FDP_GET_STATE_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->pFdpServer->pfnGetFxState64(pFDP->pFdpServer->pUserHandle,
-                                                  TempPkt->CpuId,
-                                                  pFDP->OutputBuffer,
-                                                  &u32OutputBuffersize);
-                break;
+                u32OutputBuffersize = 1;
             }
-            case FDPCMD_SET_FXSTATE:
+            break;
+        }
+        case FDPCMD_READ_VIRTUAL:
+        {
+            FDP_READ_VIRTUAL_MEMORY_PKT_REQ* TempPkt = (FDP_READ_VIRTUAL_MEMORY_PKT_REQ*) pFDP->InputBuffer;
+            if(TempPkt->ReadSize > FDP_MAX_DATA_SIZE)
             {
-                FDP_SET_FX_STATE_REQ* TempPkt = (FDP_SET_FX_STATE_REQ*) pFDP->InputBuffer;
-                pFDP->OutputBuffer[0]         = pFDP->pFdpServer->pfnSetFxState64(pFDP->pFdpServer->pUserHandle,
-                                                                          TempPkt->CpuId,
-                                                                          (uint8_t*) &TempPkt->FxState64,
-                                                                          sizeof TempPkt->FxState64);
-                u32OutputBuffersize           = sizeof(bool);
-                break;
+                bStatus = false;
             }
-            case FDPCMD_READ_MSR:
+            else
             {
-                uint64_t MsrValue             = 0;
-                FDP_READ_MSR_PKT_REQ* TempPkt = (FDP_READ_MSR_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->pFdpServer->pfnReadMsr(pFDP->pFdpServer->pUserHandle,
-                                             TempPkt->CpuId,
-                                             TempPkt->MsrId,
-                                             &MsrValue);
-                ((uint64_t*) pFDP->OutputBuffer)[0] = MsrValue;
-                u32OutputBuffersize                 = sizeof MsrValue;
-                break;
+                bStatus = pFDP->pFdpServer->pfnReadVirtualMemory(pFDP->pFdpServer->pUserHandle,
+                                                                 TempPkt->CpuId,
+                                                                 TempPkt->VirtualAddress,
+                                                                 TempPkt->ReadSize,
+                                                                 pFDP->OutputBuffer);
             }
-            case FDPCMD_WRITE_MSR:
+            if(bStatus)
             {
-                FDP_WRITE_MSR_PKT_REQ* TempPkt = (FDP_WRITE_MSR_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->OutputBuffer[0]          = pFDP->pFdpServer->pfnWriteMsr(pFDP->pFdpServer->pUserHandle,
-                                                                      TempPkt->CpuId,
-                                                                      TempPkt->MsrId,
-                                                                      TempPkt->MsrValue);
-                u32OutputBuffersize            = sizeof(bool);
-                break;
+                u32OutputBuffersize = TempPkt->ReadSize;
             }
-            case FDPCMD_WRITE_REGISTER:
+            else
             {
-                FDP_WRITE_REGISTER_PKT_REQ* TempPkt = (FDP_WRITE_REGISTER_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->OutputBuffer[0]               = pFDP->pFdpServer->pfnWriteRegister(pFDP->pFdpServer->pUserHandle,
-                                                                           TempPkt->CpuId,
-                                                                           TempPkt->RegisterId,
-                                                                           TempPkt->RegisterValue);
-                u32OutputBuffersize                 = sizeof(bool);
-                break;
+                u32OutputBuffersize = 1;
             }
-            case FDPCMD_READ_PHYSICAL:
+            break;
+        }
+        case FDPCMD_GET_CPU_CTX:
+        {
+            FDP_GET_CPU_STATE_PKT_REQ* TempPkt = (FDP_GET_CPU_STATE_PKT_REQ*) pFDP->InputBuffer;
+            FDP_CPU_CTX_SNAPSHOT* pSnapshot    = (FDP_CPU_CTX_SNAPSHOT*) pFDP->OutputBuffer;
+            bStatus                            = FDP_FillCpuContext(pFDP, TempPkt->CpuId, pSnapshot);
+            u32OutputBuffersize                = bStatus ? sizeof *pSnapshot : 1;
+            break;
+        }
+        case FDPCMD_READ_VIRTUAL_MULTIPLE:
+        {
+            FDP_READ_VIRTUAL_MEMORY_MULTIPLE_PKT_REQ* TempPkt = (FDP_READ_VIRTUAL_MEMORY_MULTIPLE_PKT_REQ*) pFDP->InputBuffer;
+            uint32_t CurrentOffset                            = 0;
+            if(pFDP->pFdpServer->pfnReadVirtualMemoryMultiple != NULL)
             {
-                FDP_READ_PHYSICAL_MEMORY_PKT_REQ* TempPkt = (FDP_READ_PHYSICAL_MEMORY_PKT_REQ*) pFDP->InputBuffer;
-                if(TempPkt->ReadSize > FDP_MAX_DATA_SIZE)
-                {
-                    bStatus = false;
-                }
-                else
-                {
-                    bStatus = pFDP->pFdpServer->pfnReadPhysicalMemory(pFDP->pFdpServer->pUserHandle,
-                                                                      pFDP->OutputBuffer,
-                                                                      TempPkt->PhysicalAddress,
-                                                                      TempPkt->ReadSize);
-                }
-                if(bStatus)
-                {
-                    u32OutputBuffersize = TempPkt->ReadSize;
-                }
-                else
+                bStatus = pFDP->pFdpServer->pfnReadVirtualMemoryMultiple(pFDP->pFdpServer->pUserHandle,
+                                                                         TempPkt->CpuId,
+                                                                         TempPkt->Ranges,
+                                                                         TempPkt->RangeCount,
+                                                                         pFDP->OutputBuffer);
+                for(uint32_t i = 0; i < TempPkt->RangeCount; i++)
                 {
-                    u32OutputBuffersize = 1;
+                    CurrentOffset += TempPkt->Ranges[i].ReadSize;
                 }
-                break;
             }
-            case FDPCMD_READ_VIRTUAL:
+            else
             {
-                FDP_READ_VIRTUAL_MEMORY_PKT_REQ* TempPkt = (FDP_READ_VIRTUAL_MEMORY_PKT_REQ*) pFDP->InputBuffer;
-                if(TempPkt->ReadSize > FDP_MAX_DATA_SIZE)
-                {
-                    bStatus = false;
-                }
-                else
+                // Server without native support, serve every range with the single-range handler
+                for(uint32_t i = 0; bStatus && i < TempPkt->RangeCount; i++)
                 {
+                    const FDP_VIRTUAL_RANGE* pRange = &TempPkt->Ranges[i];
+                    if(CurrentOffset + pRange->ReadSize > FDP_MAX_DATA_SIZE)
+                    {
+                        bStatus = false;
+                        break;
+                    }
                     bStatus = pFDP->pFdpServer->pfnReadVirtualMemory(pFDP->pFdpServer->pUserHandle,
                                                                      TempPkt->CpuId,
-                                                                     TempPkt->VirtualAddress,
-                                                                     TempPkt->ReadSize,
-                                                                     pFDP->OutputBuffer);
-                }
-                if(bStatus)
-                {
-                    u32OutputBuffersize = TempPkt->ReadSize;
+                                                                     pRange->VirtualAddress,
+                                                                     pRange->ReadSize,
+                                                                     pFDP->OutputBuffer + CurrentOffset);
+                    CurrentOffset += pRange->ReadSize;
                 }
-                else
-                {
-                    u32OutputBuffersize = 1;
-                }
-                break;
-            }
-            case FDPCMD_WRITE_PHYSICAL:
-            {
-                FDP_WRITE_PHYSICAL_MEMORY_PKT_REQ* TempPkt = (FDP_WRITE_PHYSICAL_MEMORY_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->OutputBuffer[0]                      = pFDP->pFdpServer->pfnWritePhysicalMemory(pFDP->pFdpServer->pUserHandle,
-                                                                                 TempPkt->Data,
-                                                                                 TempPkt->PhysicalAddress,
-                                                                                 TempPkt->WriteSize);
-                u32OutputBuffersize                        = sizeof(bool);
-                break;
             }
-            case FDPCMD_WRITE_VIRTUAL:
+            if(bStatus && CurrentOffset <= FDP_MAX_DATA_SIZE)
             {
-                FDP_WRITE_VIRTUAL_MEMORY_PKT_REQ* TempPkt = (FDP_WRITE_VIRTUAL_MEMORY_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->OutputBuffer[0]                     = pFDP->pFdpServer->pfnWriteVirtualMemory(
-                    pFDP->pFdpServer->pUserHandle,
-                    TempPkt->CpuId,
-                    TempPkt->Data,
-                    TempPkt->VirtualAddress,
-                    TempPkt->WriteSize);
-                u32OutputBuffersize = sizeof(bool);
-                break;
+                u32OutputBuffersize = CurrentOffset;
             }
-            case FDPCMD_INJECT_INTERRUPT:
+            else
             {
-                FDP_INJECT_INTERRUPT_PKT_REQ* TempPkt = (FDP_INJECT_INTERRUPT_PKT_REQ*) pFDP->InputBuffer;
-                pFDP->OutputBuffer[0]                 = pFDP->pFdpServer->pfnInjectInterrupt(
-                    pFDP->pFdpServer->pUserHandle,
-                    TempPkt->CpuId,
-                    TempPkt->InterruptionCode,
-                    TempPkt->ErrorCode,
-                    TempPkt->Cr2Value);
-                u32OutputBuffersize = sizeof(bool);
-                break;
+                bStatus             = false;
+                u32OutputBuffersize = 1;
             }
-            // TODO !
-            case FDPCMD_SEARCH_PHYSICAL_MEMORY:
-            {
-                /*FDP_SEARCH_PHYSICAL_MEMORY_PKT_REQ* tmpPkt = (FDP_SEARCH_PHYSICAL_MEMORY_PKT_REQ*)pFDP->InputBuffer;
+            break;
+        }
+        case FDPCMD_WRITE_PHYSICAL:
+        {
+            FDP_WRITE_PHYSICAL_MEMORY_PKT_REQ* TempPkt = (FDP_WRITE_PHYSICAL_MEMORY_PKT_REQ*) pFDP->InputBuffer;
+            pFDP->OutputBuffer[0]                      = pFDP->pFdpServer->pfnWritePhysicalMemory(pFDP->pFdpServer->pUserHandle,
+                                                                             TempPkt->Data,
+                                                                             TempPkt->PhysicalAddress,
+                                                                             TempPkt->WriteSize);
+            u32OutputBuffersize                        = sizeof(bool);
+            break;
+        }
+        case FDPCMD_WRITE_VIRTUAL:
+        {
+            FDP_WRITE_VIRTUAL_MEMORY_PKT_REQ* TempPkt = (FDP_WRITE_VIRTUAL_MEMORY_PKT_REQ*) pFDP->InputBuffer;
+            pFDP->OutputBuffer[0]                     = pFDP->pFdpServer->pfnWriteVirtualMemory(
+                pFDP->pFdpServer->pUserHandle,
+                TempPkt->CpuId,
+                TempPkt->Data,
+                TempPkt->VirtualAddress,
+                TempPkt->WriteSize);
+            u32OutputBuffersize = sizeof(bool);
+            break;
+        }
+        case FDPCMD_INJECT_INTERRUPT:
+        {
+            FDP_INJECT_INTERRUPT_PKT_REQ* TempPkt = (FDP_INJECT_INTERRUPT_PKT_REQ*) pFDP->InputBuffer;
+            pFDP->OutputBuffer[0]                 = pFDP->pFdpServer->pfnInjectInterrupt(
+                pFDP->pFdpServer->pUserHandle,
+                TempPkt->CpuId,
+                TempPkt->InterruptionCode,
+                TempPkt->ErrorCode,
+                TempPkt->Cr2Value);
+            u32OutputBuffersize = sizeof(bool);
+            break;
+        }
+        // TODO !
+        case FDPCMD_SEARCH_PHYSICAL_MEMORY:
+        {
+            /*FDP_SEARCH_PHYSICAL_MEMORY_PKT_REQ* tmpPkt = (FDP_SEARCH_PHYSICAL_MEMORY_PKT_REQ*)pFDP->InputBuffer;
 
-            ((uint64_t*)pFDP->OutputBuffer)[0] = pFDP->pFdpServer->pfnSear
+        ((uint64_t*)pFDP->OutputBuffer)[0] = pFDP->pFdpServer->pfnSear
 
-            ((uint64_t*)myFDPHandle.OutputBuffer)[0] = -1;
-            if (tmpPkt->StartOffset < MMR3PhysGetRamSizeU(pUVM)){
-            int rc = PGMR3DbgScanPhysicalU(pUVM, tmpPkt->StartOffset, MMR3PhysGetRamSizeU(pUVM) - tmpPkt->StartOffset, 1, tmpPkt->PatternData, tmpPkt->PatternSize, &HitAddress);
-            ((uint64_t*)myFDPHandle.OutputBuffer)[0] = HitAddress;
-            if (RT_FAILURE(rc)){
-            ((uint64_t*)myFDPHandle.OutputBuffer)[0] = -1;
+        ((uint64_t*)myFDPHandle.OutputBuffer)[0] = -1;
+        if (tmpPkt->StartOffset < MMR3PhysGetRamSizeU(pUVM)){
+        int rc = PGMR3DbgScanPhysicalU(pUVM, tmpPkt->StartOffset, MMR3PhysGetRamSizeU(pUVM) - tmpPkt->StartOffset, 1, tmpPkt->PatternData, tmpPkt->PatternSize, &HitAddress);
+        ((uint64_t*)myFDPHandle.OutputBuffer)[0] = HitAddress;
+        if (RT_FAILURE(rc)){
+        ((uint64_t*)myFDPHandle.OutputBuffer)[0] = -1;
 
-            }
+        }
+
+        }
+        myFDPHandle.OutputBufferSize = sizeof(uint64_t);
+        */
+            break;
+        }
+        default:
+            break;
+    }
+    *pbStatus = bStatus;
+    return u32OutputBuffersize;
+}
+
+// subset of commands safe to run concurrently with the main server loop
+// on a paused guest, executed by the parallel canal workers
+static uint32_t FDP_ExecuteReadOnlyCommand(FDP_SHM* pFDP, const uint8_t* pInput, uint8_t* pOutput, bool* pbStatus)
+{
+    uint32_t u32OutputBuffersize = 0;
+    bool     bStatus             = true;
+    switch(pInput[0])
+    {
+        case FDPCMD_READ_REGISTER:
+        {
+            uint64_t RegisterValue             = 0;
+            FDP_READ_REGISTER_PKT_REQ* TempPkt = (FDP_READ_REGISTER_PKT_REQ*) pInput;
+            pFDP->pFdpServer->pfnReadRegister(pFDP->pFdpServer->pUserHandle,
+                                              TempPkt->CpuId,
+                                              TempPkt->RegisterId,
+                                              &RegisterValue);
+            ((uint64_t*) pOutput)[0] = RegisterValue;
+            u32OutputBuffersize      = sizeof RegisterValue;
+            break;
+        }
+        case FDPCMD_READ_MSR:
+        {
+            uint64_t MsrValue             = 0;
+            FDP_READ_MSR_PKT_REQ* TempPkt = (FDP_READ_MSR_PKT_REQ*) pInput;
+            pFDP->pFdpServer->pfnReadMsr(pFDP->pFdpServer->pUserHandle,
+                                         TempPkt->CpuId,
+                                         TempPkt->MsrId,
+                                         &MsrValue);
+            ((uint64_t*) pOutput)[0] = MsrValue;
+            u32OutputBuffersize      = sizeof MsrValue;
+            break;
+        }
+        case FDPCMD_VIRTUAL_PHYSICAL:
+        {
+            uint64_t PhysicalAddress              = 0;
+            FDP_VIRTUAL_PHYSICAL_PKT_REQ* TempPkt = (FDP_VIRTUAL_PHYSICAL_PKT_REQ*) pInput;
+            pFDP->pFdpServer->pfnVirtualToPhysical(pFDP->pFdpServer->pUserHandle,
+                                                   TempPkt->CpuId,
+                                                   TempPkt->VirtualAddress,
+                                                   &PhysicalAddress);
+            ((uint64_t*) pOutput)[0] = PhysicalAddress;
+            u32OutputBuffersize      = sizeof PhysicalAddress;
+            break;
+        }
+        case FDPCMD_READ_PHYSICAL:
+        {
+            FDP_READ_PHYSICAL_MEMORY_PKT_REQ* TempPkt = (FDP_READ_PHYSICAL_MEMORY_PKT_REQ*) pInput;
+            bStatus                                   = TempPkt->ReadSize <= FDP_PARALLEL_DATA_SIZE
+                   && pFDP->pFdpServer->pfnReadPhysicalMemory(pFDP->pFdpServer->pUserHandle,
+                                                              pOutput,
+                                                              TempPkt->PhysicalAddress,
+                                                              TempPkt->ReadSize);
+            u32OutputBuffersize = bStatus ? TempPkt->ReadSize : 1;
+            break;
+        }
+        case FDPCMD_READ_VIRTUAL:
+        {
+            FDP_READ_VIRTUAL_MEMORY_PKT_REQ* TempPkt = (FDP_READ_VIRTUAL_MEMORY_PKT_REQ*) pInput;
+            bStatus                                  = TempPkt->ReadSize <= FDP_PARALLEL_DATA_SIZE
+                   && pFDP->pFdpServer->pfnReadVirtualMemory(pFDP->pFdpServer->pUserHandle,
+                                                             TempPkt->CpuId,
+                                                             TempPkt->VirtualAddress,
+                                                             TempPkt->ReadSize,
+                                                             pOutput);
+            u32OutputBuffersize = bStatus ? TempPkt->ReadSize : 1;
+            break;
+        }
+        case FDPCMD_GET_CPU_CTX:
+        {
+            FDP_GET_CPU_STATE_PKT_REQ* TempPkt = (FDP_GET_CPU_STATE_PKT_REQ*) pInput;
+            FDP_CPU_CTX_SNAPSHOT* pSnapshot    = (FDP_CPU_CTX_SNAPSHOT*) pOutput;
+            bStatus                            = FDP_FillCpuContext(pFDP, TempPkt->CpuId, pSnapshot);
+            u32OutputBuffersize                = bStatus ? sizeof *pSnapshot : 1;
+            break;
+        }
+        default:
+            // not read-only, clients must use the global canal for it
+            bStatus = false;
+            break;
+    }
+    if(u32OutputBuffersize == 0)
+    {
+        pOutput[0]          = false;
+        u32OutputBuffersize = 1;
+    }
+    *pbStatus = bStatus;
+    return u32OutputBuffersize;
+}
+
+static void FDP_ParallelWorker(FDP_SHM* pFDP, FDP_PARALLEL_CANAL* pCanal)
+{
+    uint8_t* pInput  = (uint8_t*) malloc(FDP_PARALLEL_DATA_SIZE);
+    uint8_t* pOutput = (uint8_t*) malloc(FDP_PARALLEL_DATA_SIZE);
+    if(pInput == NULL || pOutput == NULL)
+    {
+        free(pInput);
+        free(pOutput);
+        return;
+    }
+    pCanal->bServed.store(true, std::memory_order_release);
+    while(pFDP->pFdpServer->bIsRunning)
+    {
+        const uint32_t u32InputSize = ReadFDPData(&pCanal->ClientToServer, pInput);
+        if(u32InputSize == 0)
+        {
+            continue;
+        }
+        bool     bStatus             = true;
+        const uint64_t StartNs       = NowNs();
+        uint32_t u32OutputBuffersize = FDP_ExecuteReadOnlyCommand(pFDP, pInput, pOutput, &bStatus);
+        TelemetryRecordCommand(pFDP, pInput[0], NowNs() - StartNs);
+        WriteFDPDataWithStatus(&pCanal->ServerToClient, pOutput, u32OutputBuffersize, bStatus);
+    }
+    free(pInput);
+    free(pOutput);
+}
 
+FDP_EXPORTED
+bool FDP_ServerLoop(FDP_SHM* pFDP)
+{
+    if(pFDP == NULL)
+    {
+        return false;
+    }
+    size_t num_idle              = 0;
+    pFDP->pFdpServer->bIsRunning = true;
+    // serve the parallel read-only canals from dedicated workers
+    for(int i = 0; i < FDP_PARALLEL_CANAL_COUNT; i++)
+    {
+        std::thread(&FDP_ParallelWorker, pFDP, &pFDP->pSharedFDPSHM->aParallelCanals[i]).detach();
+    }
+    while(pFDP->pFdpServer->bIsRunning)
+    {
+        // Drain pipelined commands first, their answers go back through the ring
+        bool bServedRing = false;
+        uint32_t u32RingPktSize = 0;
+        while((u32RingPktSize = RingPop(&pFDP->pSharedFDPSHM->ClientToServerRing, pFDP->InputBuffer, FDP_MAX_DATA_SIZE, NULL)) > 0)
+        {
+            pFDP->InputDataSize          = u32RingPktSize;
+            bool     bStatus             = true;
+            const uint64_t StartNs       = NowNs();
+            uint32_t u32OutputBuffersize = FDP_ExecuteCommand(pFDP, &bStatus);
+            TelemetryRecordCommand(pFDP, pFDP->InputBuffer[0], NowNs() - StartNs);
+            if(u32OutputBuffersize == 0 || u32OutputBuffersize > FDP_RING_SLOT_SIZE)
+            {
+                u32OutputBuffersize = 1;
+                bStatus             = false;
             }
-            myFDPHandle.OutputBufferSize = sizeof(uint64_t);
-            */
-                break;
+            RingPush(&pFDP->pSharedFDPSHM->ServerToClientRing, pFDP->OutputBuffer, u32OutputBuffersize, bStatus);
+            bServedRing = true;
+        }
+        if(pFDP->pSharedFDPSHM->ClientToServer.bDataPresent.load(std::memory_order_relaxed) == false)
+        {
+            if(bServedRing)
+            {
+                num_idle = 0;
             }
-            default:
-                break;
+            else if(num_idle < max_wait_iters)
+            {
+                ++num_idle;
+                PAUSE;
+            }
+            else
+            {
+                yield_sleep();
+            }
+            continue;
+        }
+        num_idle                    = 0;
+        uint32_t u32InputBufferSize = ReadFDPData(&pFDP->pSharedFDPSHM->ClientToServer, pFDP->InputBuffer);
+        if(u32InputBufferSize == 0)
+        {
+            return false;
         }
+        pFDP->InputDataSize          = u32InputBufferSize;
+        bool     bStatus             = true;
+        const uint64_t StartNs       = NowNs();
+        uint32_t u32OutputBuffersize = FDP_ExecuteCommand(pFDP, &bStatus);
+        TelemetryRecordCommand(pFDP, pFDP->InputBuffer[0], NowNs() - StartNs);
         // There is something to send !
         if(u32OutputBuffersize > 0)
         {
             WriteFDPDataWithStatus(&pFDP->pSharedFDPSHM->ServerToClient, pFDP->OutputBuffer, u32OutputBuffersize, bStatus);
-            u32OutputBuffersize = 0;
         }
     }
     return true;
 }
 
+FDP_EXPORTED
+bool FDP_GetTelemetry(FDP_SHM* pShm, FDP_TELEMETRY_SNAPSHOT* pSnapshot)
+{
+    if(pShm == NULL || pSnapshot == NULL)
+    {
+        return false;
+    }
+    if(pShm->bRemoteTransport)
+    {
+        // the TCP relay only carries the canals, telemetry stays server-local
+        return false;
+    }
+    const FDP_TELEMETRY* pTelemetry = &pShm->pSharedFDPSHM->Telemetry;
+    for(int i = 0; i < FDP_TELEMETRY_CMD_SLOTS; i++)
+    {
+        pSnapshot->CommandCount[i] = pTelemetry->CommandCount[i].load(std::memory_order_relaxed);
+        pSnapshot->CommandNs[i]    = pTelemetry->CommandNs[i].load(std::memory_order_relaxed);
+    }
+    pSnapshot->BreakpointHitCount = pTelemetry->BreakpointHitCount.load(std::memory_order_relaxed);
+    pSnapshot->StateChangeCount   = pTelemetry->StateChangeCount.load(std::memory_order_relaxed);
+    return true;
+}
+
+FDP_EXPORTED
+bool FDP_GetChannelHealth(FDP_SHM* pShm, FDP_CHANNEL_HEALTH* pHealth)
+{
+    if(pShm == NULL || pHealth == NULL)
+    {
+        return false;
+    }
+    if(pShm->bRemoteTransport)
+    {
+        // the TCP relay only carries the canals, health is shm-local
+        return false;
+    }
+    BuildChannelHealth(pShm, pHealth);
+    return true;
+}
+
+FDP_EXPORTED
+bool FDP_SetCommandTimeout(FDP_SHM* pShm, uint64_t TimeoutMs, FDP_WATCHDOG_CALLBACK pfnOnTimeout, void* pUserContext)
+{
+    if(pShm == NULL)
+    {
+        return false;
+    }
+    pShm->pfnWatchdog      = pfnOnTimeout;
+    pShm->pWatchdogContext = pUserContext;
+    pShm->CommandTimeoutNs = TimeoutMs * 1000 * 1000;
+    return true;
+}
+
 FDP_EXPORTED
 bool FDP_SetFDPServer(FDP_SHM* pFDP, FDP_SERVER_INTERFACE_T* pFDPServer)
 {
@@ -82,8 +82,86 @@ extern "C"
 
 #define FDP_MAX_BREAKPOINT 1024
 
+    typedef struct FDP_EVENT_
+    {
+        uint16_t State; // FDP_State flags
+        uint32_t CpuId;
+        uint64_t Rip;
+        // latency budget stamps: EventId correlates the client-side
+        // span with this event, the two clocks are server-side
+        // CLOCK_MONOTONIC nanoseconds comparable with the client's
+        uint64_t EventId;   // monotonic per session, never reused
+        uint64_t TrapNs;    // when the server took the vm exit
+        uint64_t PublishNs; // when the event reached the queue
+    } FDP_EVENT;
+
+    typedef struct FDP_BREAKPOINT_DESC_
+    {
+        FDP_BreakpointType BreakpointType;
+        int                BreakpointId;
+        FDP_Access         BreakpointAccessType;
+        FDP_AddressType    BreakpointAddressType;
+        uint64_t           BreakpointAddress;
+        uint64_t           BreakpointLength;
+        uint64_t           BreakpointCr3;
+    } FDP_BREAKPOINT_DESC;
+
+    typedef struct FDP_VIRTUAL_RANGE_
+    {
+        uint64_t VirtualAddress;
+        uint32_t ReadSize;
+    } FDP_VIRTUAL_RANGE;
+
+    typedef struct FDP_REGISTER_RANGE_
+    {
+        uint64_t Minimum;
+        uint64_t Maximum; // inclusive
+    } FDP_REGISTER_RANGE;
+
     typedef struct FDP_SHM_ FDP_SHM;
 
+// wait-free telemetry snapshot: plain counters copied out of shared
+// memory so slow sessions can be localized without instrumented builds
+#define FDP_TELEMETRY_CMD_SLOTS 64
+
+// maximum path length answered by FDP_Fork
+#define FDP_FORK_PATH_SIZE 512
+
+    typedef struct FDP_TELEMETRY_SNAPSHOT_
+    {
+        uint64_t CommandCount[FDP_TELEMETRY_CMD_SLOTS]; // executions per command type
+        uint64_t CommandNs[FDP_TELEMETRY_CMD_SLOTS];    // cumulative server latency per type
+        uint64_t BreakpointHitCount;                    // state events flagged as breakpoint hits
+        uint64_t StateChangeCount;                      // state changes published by the monitor
+    } FDP_TELEMETRY_SNAPSHOT;
+
+// channel state words copied client-side without any command round
+// trip, so the answer stays available when the server is wedged, see
+// FDP_GetChannelHealth
+    typedef struct FDP_CANAL_HEALTH_
+    {
+        bool     bLocked;      // canal spinlock held
+        bool     bDataPresent; // payload published and not yet consumed
+        bool     bStatus;      // status word of that payload
+        uint32_t DataSize;
+        uint32_t Wakeup;       // publish counter, a stall shows it frozen
+    } FDP_CANAL_HEALTH;
+
+    typedef struct FDP_CHANNEL_HEALTH_
+    {
+        bool             bShmLocked;         // global command lock held
+        uint8_t          PendingCommand;     // type byte of the command in flight, 0 when idle
+        uint8_t          ParallelBusyMask;   // parallel canals claimed by client threads
+        uint8_t          ParallelServedMask; // parallel canals drained by server workers
+        FDP_CANAL_HEALTH ClientToServer;
+        FDP_CANAL_HEALTH ServerToClient;
+    } FDP_CHANNEL_HEALTH;
+
+    // consulted when a command outlives its deadline: return true to
+    // grant one more full deadline, false to fail the command
+    typedef bool (*FDP_WATCHDOG_CALLBACK)(void* pUserContext, const FDP_CHANNEL_HEALTH* pHealth);
+    typedef struct FDP_CPU_CTX_SNAPSHOT_ FDP_CPU_CTX_SNAPSHOT;
+
     typedef struct _FDP_SERVER_INTERFACE_T
     {
         bool bIsRunning;
@@ -115,19 +193,30 @@ extern "C"
         bool    (*pfnRestore)               (void*);
         bool    (*pfnReboot)                (void*);
         bool    (*pfnInjectInterrupt)       (void*, uint32_t, uint32_t, uint32_t, uint64_t);
+        bool    (*pfnReadVirtualMemoryMultiple) (void*, uint32_t, const FDP_VIRTUAL_RANGE*, uint32_t, uint8_t*);
+        bool    (*pfnSaveIncremental)       (void*);
+        bool    (*pfnRestoreIncremental)    (void*);
+        bool    (*pfnSetBreakpointFilter)   (void* pUserHandle, int BreakpointId, uint64_t FilterCr3, uint64_t FilterThreadAddress, uint64_t FilterThreadValue);
+        bool    (*pfnSetBreakpointRegisterFilter) (void* pUserHandle, int BreakpointId, FDP_Register RegisterId, const FDP_REGISTER_RANGE* pRanges, uint32_t RangeCount);
+        bool    (*pfnSetBreakpointOneShot)  (void* pUserHandle, int BreakpointId, bool bOneShot);
+        bool    (*pfnFork)                  (void* pUserHandle, char* pDumpPath, uint32_t MaxPathSize);
     } FDP_SERVER_INTERFACE_T;
 
     // FDP API
     FDP_EXPORTED FDP_SHM*   FDP_CreateSHM               (const char* shmName);
     FDP_EXPORTED FDP_SHM*   FDP_OpenSHM                 (const char* pShmName);
+    FDP_EXPORTED FDP_SHM*   FDP_OpenTCP                 (const char* pHostPort);
+    FDP_EXPORTED bool       FDP_ServeTCP                (FDP_SHM* pShm, uint16_t Port);
     FDP_EXPORTED void       FDP_ExitSHM                 (FDP_SHM* pShm);
     FDP_EXPORTED bool       FDP_Init                    (FDP_SHM* pShm);
     FDP_EXPORTED bool       FDP_Pause                   (FDP_SHM* pShm);
     FDP_EXPORTED bool       FDP_Resume                  (FDP_SHM* pShm);
     FDP_EXPORTED bool       FDP_ReadPhysicalMemory      (FDP_SHM* pShm, uint8_t* pDstBuffer, uint32_t ReadSize, uint64_t PhysicalAddress);
+    FDP_EXPORTED bool       FDP_ReadPhysicalMemoryStream(FDP_SHM* pShm, uint8_t* pDstBuffer, uint64_t ReadSize, uint64_t PhysicalAddress);
     FDP_EXPORTED bool       FDP_WritePhysicalMemory     (FDP_SHM* pShm, uint8_t* pSrcBuffer, uint32_t WriteSize, uint64_t PhysicalAddress);
     FDP_EXPORTED bool       FDP_ReadVirtualMemory       (FDP_SHM* pShm, uint32_t CpuId, uint8_t* pDstBuffer, uint32_t ReadSize, uint64_t VirtualAddress);
     FDP_EXPORTED bool       FDP_WriteVirtualMemory      (FDP_SHM* pShm, uint32_t CpuId, uint8_t* pSrcBuffer, uint32_t WriteSize, uint64_t VirtualAddress);
+    FDP_EXPORTED bool       FDP_ReadVirtualMemoryMultiple(FDP_SHM* pShm, uint32_t CpuId, const FDP_VIRTUAL_RANGE* pRanges, uint32_t RangeCount, uint8_t* pDstBuffer);
     FDP_EXPORTED uint64_t   FDP_SearchPhysicalMemory    (FDP_SHM* pShm, const void* pPatternData, uint32_t PatternSize, uint64_t StartOffset);
     FDP_EXPORTED bool       FDP_SearchVirtualMemory     (FDP_SHM* pFDP, uint32_t CpuId, const void* pPatternData, uint32_t PatternSize, uint64_t StartOffset);
     FDP_EXPORTED bool       FDP_ReadRegister            (FDP_SHM* pShm, uint32_t CpuId, FDP_Register RegisterId, uint64_t* pRegisterValue);
@@ -136,20 +225,45 @@ extern "C"
     FDP_EXPORTED bool       FDP_WriteMsr                (FDP_SHM* pShm, uint32_t CpuId, uint64_t MsrId, uint64_t MsrValue);
     FDP_EXPORTED int        FDP_SetBreakpoint           (FDP_SHM* pShm, uint32_t CpuId, FDP_BreakpointType BreakpointType, int BreakpointId, FDP_Access BreakpointAccessType, FDP_AddressType BreakpointAddressType, uint64_t BreakpointAddress, uint64_t BreakpointLength, uint64_t BreakpointCr3);
     FDP_EXPORTED bool       FDP_UnsetBreakpoint         (FDP_SHM* pShm, int BreakpointId);
+    FDP_EXPORTED bool       FDP_SetBreakpointMultiple   (FDP_SHM* pShm, uint32_t CpuId, const FDP_BREAKPOINT_DESC* pBreakpoints, uint32_t BreakpointCount, int* pBreakpointIds);
+    FDP_EXPORTED bool       FDP_UnsetBreakpointMultiple (FDP_SHM* pShm, const int* pBreakpointIds, uint32_t BreakpointCount);
+FDP_EXPORTED bool       FDP_SetBreakpointFilter     (FDP_SHM* pShm, int BreakpointId, uint64_t FilterCr3, uint64_t FilterThreadAddress, uint64_t FilterThreadValue);
+    FDP_EXPORTED uint32_t   FDP_OpenSession             (FDP_SHM* pShm, bool bReadOnly);
+    FDP_EXPORTED bool       FDP_CloseSession            (FDP_SHM* pShm);
+    FDP_EXPORTED bool       FDP_SetBreakpointRegisterFilter(FDP_SHM* pShm, int BreakpointId, FDP_Register RegisterId, const FDP_REGISTER_RANGE* pRanges, uint32_t RangeCount);
+    FDP_EXPORTED bool       FDP_SetBreakpointOneShot    (FDP_SHM* pShm, int BreakpointId, bool bOneShot);
     FDP_EXPORTED bool       FDP_VirtualToPhysical       (FDP_SHM* pShm, uint32_t CpuId, uint64_t VirtualAddress, uint64_t* pPhysicalAddress);
     FDP_EXPORTED bool       FDP_GetState                (FDP_SHM* pShm, FDP_State* pState);
     FDP_EXPORTED bool       FDP_GetFxState64            (FDP_SHM* pShm, uint32_t CpuId, FDP_XSAVE_FORMAT64_T* pFxState64);
     FDP_EXPORTED bool       FDP_SetFxState64            (FDP_SHM* pFDP, uint32_t CpuId, FDP_XSAVE_FORMAT64_T* pFxState64);
     FDP_EXPORTED bool       FDP_SingleStep              (FDP_SHM* pShm, uint32_t CpuId);
+    FDP_EXPORTED bool       FDP_SingleStepMultiple      (FDP_SHM* pShm, uint32_t CpuId, uint64_t StepCount, uint64_t StopAddress, uint64_t* pStepsDone);
     FDP_EXPORTED bool       FDP_GetPhysicalMemorySize   (FDP_SHM* pShm, uint64_t* pPhysicalMemorySize);
     FDP_EXPORTED bool       FDP_GetCpuCount             (FDP_SHM* pShm, uint32_t* pCPUCount);
     FDP_EXPORTED bool       FDP_GetCpuState             (FDP_SHM* pShm, uint32_t CpuId, FDP_State* pState);
+    FDP_EXPORTED bool       FDP_GetCpuContext           (FDP_SHM* pShm, uint32_t CpuId, FDP_CPU_CTX_SNAPSHOT* pSnapshot);
     FDP_EXPORTED bool       FDP_Reboot                  (FDP_SHM* pShm);
     FDP_EXPORTED bool       FDP_Save                    (FDP_SHM* pShm);
+    FDP_EXPORTED bool       FDP_SaveIncremental         (FDP_SHM* pShm);
     FDP_EXPORTED bool       FDP_Restore                 (FDP_SHM* pShm);
+    FDP_EXPORTED bool       FDP_RestoreIncremental      (FDP_SHM* pShm);
     FDP_EXPORTED bool       FDP_GetStateChanged         (FDP_SHM* pShm);
+    FDP_EXPORTED bool       FDP_PushStateEvent          (FDP_SHM* pShm, uint16_t State, uint32_t CpuId, uint64_t Rip);
+    // same, with the trap timestamp supplied by the server so the
+    // published span covers its own trap handling; TrapNs must come
+    // from the monotonic clock, see FDP_EVENT
+    FDP_EXPORTED bool       FDP_PushStateEventTimed     (FDP_SHM* pShm, uint16_t State, uint32_t CpuId, uint64_t Rip, uint64_t TrapNs);
+    FDP_EXPORTED uint32_t   FDP_PopStateEvents          (FDP_SHM* pShm, FDP_EVENT* pEvents, uint32_t MaxEventCount);
+    FDP_EXPORTED uint32_t   FDP_PendingStateEvents      (FDP_SHM* pShm);
+    FDP_EXPORTED bool       FDP_PeekStateChanged        (FDP_SHM* pShm);
     FDP_EXPORTED void       FDP_SetStateChanged         (FDP_SHM* pShm);
     FDP_EXPORTED bool       FDP_InjectInterrupt         (FDP_SHM* pShm, uint32_t CpuId, uint32_t uInterruptionCode, uint32_t uErrorCode, uint64_t Cr2Value);
+    FDP_EXPORTED bool       FDP_EnqueueCommand          (FDP_SHM* pShm, const void* pCommand, uint32_t CommandSize);
+    FDP_EXPORTED uint32_t   FDP_CollectResponse         (FDP_SHM* pShm, void* pResponseBuffer, uint32_t MaxResponseSize, bool* pbStatus);
+    FDP_EXPORTED bool       FDP_Fork                    (FDP_SHM* pShm, char* pDumpPath, uint32_t MaxPathSize);
+    FDP_EXPORTED bool       FDP_GetTelemetry            (FDP_SHM* pShm, FDP_TELEMETRY_SNAPSHOT* pSnapshot);
+    FDP_EXPORTED bool       FDP_GetChannelHealth        (FDP_SHM* pShm, FDP_CHANNEL_HEALTH* pHealth);
+    FDP_EXPORTED bool       FDP_SetCommandTimeout       (FDP_SHM* pShm, uint64_t TimeoutMs, FDP_WATCHDOG_CALLBACK pfnOnTimeout, void* pUserContext);
     FDP_EXPORTED bool       FDP_SetFDPServer            (FDP_SHM* pFDP, FDP_SERVER_INTERFACE_T* pFDPServer);
     FDP_EXPORTED bool       FDP_SetFDPServerRunning     (FDP_SHM* pFDP, bool bRunning);
     FDP_EXPORTED bool       FDP_ServerLoop              (FDP_SHM* pFDP);
@@ -33,6 +33,14 @@
 #include "FDP.h"
 
 #pragma pack(push, 1)
+typedef struct FDP_BP_SHADOW_ENTRY_
+{
+    uint8_t  bEnabled;     // written last on install, first on removal
+    uint8_t  AddressType;  // FDP_AddressType of Address
+    uint8_t  OriginalByte; // byte the soft breakpoint patch replaced
+    uint64_t Address;
+} FDP_BP_SHADOW_ENTRY;
+
 typedef struct FDP_CPU_CTX_
 {
     uint64_t rip;
@@ -68,7 +76,29 @@ typedef struct FDP_CPU_CTX_
     uint64_t cr2;
     uint64_t cr3;
     uint64_t cr4;
+
+    // appended past the original block so hypervisors built against the
+    // older layout keep working: segment bases, the hot MSRs and a
+    // seqlock version, odd while the publisher is mid-update and zero
+    // when nobody ever published
+    uint64_t fs_base;
+    uint64_t gs_base;
+    uint64_t kernel_gs_base;
+    uint64_t gdtrb;
+    uint64_t idtrb;
+    uint64_t msr_lstar;
+    uint64_t msr_tsc;
+    uint64_t StateSeq;
 } FDP_CPU_CTX;
+
+typedef struct FDP_CPU_CTX_SNAPSHOT_
+{
+    FDP_CPU_CTX Ctx;
+    uint64_t    MsrLstar;
+    uint64_t    MsrGsBase;
+    uint64_t    MsrKernelGsBase;
+    uint64_t    MsrTsc;
+} FDP_CPU_CTX_SNAPSHOT;
 #pragma pack(pop)
 
 enum
@@ -103,7 +133,21 @@ enum
     FDPCMD_SAVE,
     FDPCMD_RESTORE,
     FDPCMD_INJECT_INTERRUPT,
-    FDPCMD_TEST
+    FDPCMD_TEST,
+    FDPCMD_READ_VIRTUAL_MULTIPLE,
+    FDPCMD_GET_CPU_CTX,
+    FDPCMD_SET_BP_MULTIPLE,
+    FDPCMD_UNSET_BP_MULTIPLE,
+    FDPCMD_READ_PHYSICAL_STREAM,
+    FDPCMD_SAVE_INCREMENTAL,
+    FDPCMD_RESTORE_INCREMENTAL,
+    FDPCMD_SET_BP_FILTER,
+    FDPCMD_SINGLE_STEP_MULTIPLE,
+    FDPCMD_SET_BP_REGISTER_FILTER,
+    FDPCMD_OPEN_SESSION,
+    FDPCMD_CLOSE_SESSION,
+    FDPCMD_SET_BP_ONE_SHOT,
+    FDPCMD_FORK
 };
 
 typedef struct _FDP_UnsetBreakpoint_req
@@ -126,31 +170,147 @@ typedef struct _FDP_SetBreakpoint_req
 
 #define FDP_1M              1024 * 1024
 #define FDP_MAX_DATA_SIZE   10 * FDP_1M
+// streamed replies alternate between the two canals, each chunk fills
+// half a canal so the server can refill one while the client drains it
+#define FDP_STREAM_CHUNK_SIZE (5 * FDP_1M)
 
 #ifdef FDP_INTERNAL_ONLY
 
 #    include <atomic>
 
+// control words live on private cache lines: the lock bounces between
+// client and server while waiters spin on bDataPresent, packing them
+// next to the payload caused cross-socket false sharing on dual-node
+// hosts
+#    define FDP_CACHE_LINE 64
+
 typedef struct FDP_SHM_CANAL_
 {
-    volatile uint8_t  data[FDP_MAX_DATA_SIZE];
+    std::atomic_bool      lock;         // Per channel lock
+    uint8_t               _pad0[FDP_CACHE_LINE - 1];
+    volatile uint32_t     dataSize;
+    std::atomic<uint32_t> wakeup;       // bumped on publish, waiters block on it
+    std::atomic_bool      bDataPresent; // is data present
+    volatile bool         bStatus;
+    uint8_t               _pad1[FDP_CACHE_LINE - 10];
+    volatile uint8_t      data[FDP_MAX_DATA_SIZE];
+} FDP_SHM_CANAL;
+
+#    define FDP_PARALLEL_CANAL_COUNT 8
+#    define FDP_PARALLEL_DATA_SIZE   (1 * FDP_1M)
+
+// smaller canal mirroring FDP_SHM_CANAL, sized for read-only commands
+typedef struct FDP_SMALL_CANAL_
+{
+    std::atomic_bool      lock;         // Per channel lock
+    uint8_t               _pad0[FDP_CACHE_LINE - 1];
+    volatile uint32_t     dataSize;
+    std::atomic<uint32_t> wakeup;       // bumped on publish, waiters block on it
+    std::atomic_bool      bDataPresent; // is data present
+    volatile bool         bStatus;
+    uint8_t               _pad1[FDP_CACHE_LINE - 10];
+    volatile uint8_t      data[FDP_PARALLEL_DATA_SIZE];
+} FDP_SMALL_CANAL;
+
+// one independent request/reply pair, claimed by a client thread so
+// read-only commands do not serialize on the global lock
+typedef struct FDP_PARALLEL_CANAL_
+{
+    FDP_SMALL_CANAL  ClientToServer;
+    FDP_SMALL_CANAL  ServerToClient;
+    std::atomic_bool bBusy;   // claimed by a client thread
+    std::atomic_bool bServed; // a server worker is draining this canal
+    uint8_t          _[2];    // padding
+} FDP_PARALLEL_CANAL;
+
+#    define FDP_RING_SLOT_SIZE  4096
+#    define FDP_RING_SLOT_COUNT 64
+
+typedef struct FDP_RING_SLOT_
+{
     volatile uint32_t dataSize;
-    std::atomic_bool  lock;         // Per channel lock
-    std::atomic_bool  bDataPresent; // is data present
     volatile bool     bStatus;
-    uint8_t           _;            // padding
-} FDP_SHM_CANAL;
+    uint8_t           _[3];      // padding
+    volatile uint8_t  data[FDP_RING_SLOT_SIZE];
+} FDP_RING_SLOT;
+
+// Single-producer single-consumer command ring used for pipelined commands
+typedef struct FDP_SHM_RING_
+{
+    std::atomic<uint32_t> writeIndex; // next slot filled by the producer
+    std::atomic<uint32_t> readIndex;  // next slot drained by the consumer
+    FDP_RING_SLOT         slots[FDP_RING_SLOT_COUNT];
+} FDP_SHM_RING;
+
+#    define FDP_EVENT_QUEUE_SIZE 256
+
+// One-way event queue, the server pushes state change events,
+// the client drains them without any command round trip
+typedef struct FDP_EVENT_QUEUE_
+{
+    std::atomic<uint32_t> writeIndex; // next slot filled by the server
+    std::atomic<uint32_t> readIndex;  // next slot drained by the client
+    FDP_EVENT             events[FDP_EVENT_QUEUE_SIZE];
+} FDP_EVENT_QUEUE;
+
+// wait-free telemetry: the server publishes with relaxed atomics,
+// readers snapshot the counters without taking any lock, see
+// FDP_GetTelemetry
+typedef struct FDP_TELEMETRY_
+{
+    std::atomic<uint64_t> CommandCount[FDP_TELEMETRY_CMD_SLOTS];
+    std::atomic<uint64_t> CommandNs[FDP_TELEMETRY_CMD_SLOTS];
+    std::atomic<uint64_t> BreakpointHitCount;
+    std::atomic<uint64_t> StateChangeCount;
+} FDP_TELEMETRY;
 
 typedef struct FDP_SHM_SHARED_
 {
     std::atomic_bool lock; // General lock for the whole FDP_SHM_SHARED
+    uint8_t          _pad0[FDP_CACHE_LINE - 1];
     std::atomic_bool stateChangedLock;
     volatile bool    stateChanged;
-    uint8_t          _;    // padding
+    uint8_t          _pad1[FDP_CACHE_LINE - 2];
     FDP_SHM_CANAL    ClientToServer;
     FDP_SHM_CANAL    ServerToClient;
+    FDP_SHM_RING     ClientToServerRing;
+    FDP_SHM_RING     ServerToClientRing;
+    FDP_EVENT_QUEUE  EventQueue;
+    FDP_PARALLEL_CANAL aParallelCanals[FDP_PARALLEL_CANAL_COUNT];
+
+    // original bytes behind installed soft breakpoints; client read
+    // paths overlay them so reads never return the int3 patches
+    uint32_t            BreakpointShadowHighWater;
+    FDP_BP_SHADOW_ENTRY aBreakpointShadow[FDP_MAX_BREAKPOINT];
+
+    FDP_TELEMETRY Telemetry; // server-published, wait-free reads
 } FDP_SHM_SHARED;
 
+// adaptive wait policy, client side: response latencies are tracked
+// per command class and translate into spin budgets and sleep quantums,
+// see UpdateWaitTuning in FDP.cpp; zeroed entries fall back to the
+// static defaults until the first response is measured
+enum FDP_WAIT_CLASS
+{
+    FDP_WAIT_CLASS_MEMORY,   // memory reads and writes
+    FDP_WAIT_CLASS_REGISTER, // register and msr accesses
+    FDP_WAIT_CLASS_CONTROL,  // execution control and everything else
+    FDP_WAIT_CLASS_COUNT,
+};
+
+typedef struct FDP_WAIT_STATS_
+{
+    uint64_t EwmaNs;     // smoothed response latency
+    uint64_t SpinBudget; // PAUSE iterations granted before blocking
+    uint64_t SleepNs;    // block quantum once spinning gave up
+    uint64_t Samples;    // responses measured so far
+} FDP_WAIT_STATS;
+
+typedef struct FDP_WAIT_TUNING_
+{
+    FDP_WAIT_STATS aClasses[FDP_WAIT_CLASS_COUNT];
+} FDP_WAIT_TUNING;
+
 struct ALIGNED_(1) FDP_SHM_
 {
     FDP_SHM_SHARED* pSharedFDPSHM;                   // Shared part of the FDP SHM
@@ -159,6 +319,37 @@ struct ALIGNED_(1) FDP_SHM_
 
     FDP_SERVER_INTERFACE_T* pFdpServer;
     FDP_CPU_CTX*            pCpuShm;
+
+    char     aShmName[512];         // name used to open optional side mappings
+    uint8_t* pPhysicalMemoryShm;    // optional direct guest RAM window
+    uint64_t PhysicalMemoryShmSize; // size of the guest RAM window
+    bool     bPhysicalShmProbed;    // guest RAM window open was attempted
+
+    bool     bCpuCtxPublished;      // stopped context already published into
+                                    // the CPU mapping since the last run
+
+    bool     bRemoteTransport;      // canals are process-local, a pump thread
+                                    // relays them over a socket
+    uint64_t RemoteSocket;          // connected socket when bRemoteTransport
+
+    uint32_t SessionId;             // client: id from FDP_OpenSession, 0 until then
+    bool     bReadOnlySession;      // client: mutating commands fail locally
+
+    uint32_t NextSessionId;         // server: last session id handed out
+    uint32_t InputDataSize;         // server: size of the packet in InputBuffer,
+                                    // distinguishes legacy short packets
+    uint32_t aBreakpointOwner[FDP_MAX_BREAKPOINT]; // server: owning session per
+                                                   // slot, 0 when unscoped
+
+    FDP_WAIT_TUNING WaitTuning; // client: adaptive wait policy, per command class
+
+    // client: per-command watchdog, commands fail after CommandTimeoutNs
+    // instead of waiting forever; 0 disables it, see FDP_SetCommandTimeout
+    uint64_t              CommandTimeoutNs;
+    uint8_t               PendingCommand;  // type byte of the command in flight
+    bool                  bReplyAbandoned; // a timed-out reply may still land
+    FDP_WATCHDOG_CALLBACK pfnWatchdog;     // consulted on deadline expiry
+    void*                 pWatchdogContext;
 };
 
 #    define FDP_SHM_SHARED_SIZE sizeof(FDP_SHM_SHARED)
@@ -193,6 +384,14 @@ typedef struct FDP_WRITE_PHYSICAL_MEMORY_PKT_REQ_
     uint8_t  Data[];
 } FDP_WRITE_PHYSICAL_MEMORY_PKT_REQ;
 
+typedef struct FDP_READ_VIRTUAL_MEMORY_MULTIPLE_PKT_REQ_
+{
+    uint8_t  Type;
+    uint32_t CpuId;
+    uint32_t RangeCount;
+    FDP_VIRTUAL_RANGE Ranges[];
+} FDP_READ_VIRTUAL_MEMORY_MULTIPLE_PKT_REQ;
+
 typedef struct FDP_WRITE_VIRTUAL_MEMORY_PKT_REQ_
 {
     uint8_t  Type;
@@ -277,8 +476,9 @@ typedef struct FDP_GET_CPU_STATE_PKT_REQ_
 
 typedef struct FDP_UNSET_BREAKPOINT_PKT_REQ
 {
-    uint8_t Type;
-    int     BreakpointId;
+    uint8_t  Type;
+    int      BreakpointId;
+    uint32_t SessionId; // appended, 0 for legacy unscoped clients
 } FDP_CLEAR_BREAKPOINT_PKT_REQ;
 
 typedef struct FDP_SET_BREAKPOINT_PKT_REQ_
@@ -292,8 +492,78 @@ typedef struct FDP_SET_BREAKPOINT_PKT_REQ_
     uint64_t BreakpointAddress;
     uint64_t BreakpointLength;
     uint64_t BreakpointCr3;
+    uint32_t SessionId; // appended, 0 for legacy unscoped clients
 } FDP_SET_BREAKPOINT_PKT_REQ;
 
+typedef struct FDP_READ_PHYSICAL_MEMORY_STREAM_PKT_REQ_
+{
+    uint8_t  Type;
+    uint64_t PhysicalAddress;
+    uint64_t ReadSize;
+} FDP_READ_PHYSICAL_MEMORY_STREAM_PKT_REQ;
+
+typedef struct FDP_SET_BREAKPOINT_MULTIPLE_PKT_REQ_
+{
+    uint8_t  Type;
+    uint32_t CpuId;
+    uint32_t SessionId;
+    uint32_t BreakpointCount;
+    FDP_BREAKPOINT_DESC Breakpoints[];
+} FDP_SET_BREAKPOINT_MULTIPLE_PKT_REQ;
+
+typedef struct FDP_UNSET_BREAKPOINT_MULTIPLE_PKT_REQ_
+{
+    uint8_t  Type;
+    uint32_t SessionId;
+    uint32_t BreakpointCount;
+    int      BreakpointIds[];
+} FDP_UNSET_BREAKPOINT_MULTIPLE_PKT_REQ;
+
+typedef struct FDP_SINGLE_STEP_MULTIPLE_PKT_REQ_
+{
+    uint8_t  Type;
+    uint32_t CpuId;
+    uint64_t StepCount;
+    uint64_t StopAddress; // 0 to disable the exit condition
+} FDP_SINGLE_STEP_MULTIPLE_PKT_REQ;
+
+typedef struct FDP_OPEN_SESSION_PKT_REQ_
+{
+    uint8_t Type;
+    uint8_t bReadOnly;
+} FDP_OPEN_SESSION_PKT_REQ;
+
+typedef struct FDP_CLOSE_SESSION_PKT_REQ_
+{
+    uint8_t  Type;
+    uint32_t SessionId;
+} FDP_CLOSE_SESSION_PKT_REQ;
+
+typedef struct FDP_SET_BREAKPOINT_FILTER_PKT_REQ_
+{
+    uint8_t  Type;
+    int      BreakpointId;
+    uint64_t FilterCr3;
+    uint64_t FilterThreadAddress;
+    uint64_t FilterThreadValue;
+} FDP_SET_BREAKPOINT_FILTER_PKT_REQ;
+
+typedef struct FDP_SET_BREAKPOINT_ONE_SHOT_PKT_REQ_
+{
+    uint8_t Type;
+    int     BreakpointId;
+    bool    bOneShot;
+} FDP_SET_BREAKPOINT_ONE_SHOT_PKT_REQ;
+
+typedef struct FDP_SET_BREAKPOINT_REGISTER_FILTER_PKT_REQ_
+{
+    uint8_t            Type;
+    int                BreakpointId;
+    FDP_Register       RegisterId;
+    uint32_t           RangeCount;
+    FDP_REGISTER_RANGE Ranges[];
+} FDP_SET_BREAKPOINT_REGISTER_FILTER_PKT_REQ;
+
 typedef struct FDP_INJECT_INTERRUPT_PKT_REQ_
 {
     uint8_t  Type;
@@ -131,6 +131,9 @@ void *g_GeneralRegisters;
                 }                                                                                                    \
 }
 
+bool SendGDBPacket(GDB_TYPE_T *pGDB, char *pData);
+bool RecvGDBPacket(GDB_TYPE_T *pGDB, char *pCommand);
+
 uint64_t Hex2U64(char *pHex){
     return strtoull(pHex, NULL, 16);
 }
@@ -193,6 +196,7 @@ GDB_TYPE_T* GDB_Open(char *pArgument)
     if (pGDB == NULL) {
         return NULL;
     }
+    memset(pGDB, 0, sizeof(GDB_TYPE_T));
 
     int err = WSAStartup(MAKEWORD(2, 2), &wsa);
     if (err < 0) {
@@ -232,14 +236,29 @@ GDB_TYPE_T* GDB_Open(char *pArgument)
         return NULL;
     }
 
+    //One acked round-trip here removes two acks per packet afterwards;
+    //stubs without QStartNoAckMode reply with an empty packet and the
+    //classic acked protocol stays in place
+    char Command[1024];
+    SendGDBPacket(pGDB, "QStartNoAckMode");
+    if (RecvGDBPacket(pGDB, Command) == true && strcmp(Command, "OK") == 0){
+        pGDB->bNoAckMode = true;
+    }
+
+    SendGDBPacket(pGDB, "vCont?");
+    if (RecvGDBPacket(pGDB, Command) == true && strncmp(Command, "vCont", 5) == 0){
+        pGDB->bVContSupported = true;
+    }
+
     //Never remove that for VMware !, BSOD due to instruction cache and code injection
     GDB_SingleStep(pGDB);
 
     return pGDB;
 }
 
-bool SendGDBPacket(SOCKET Sock, char *pData)
+bool SendGDBPacket(GDB_TYPE_T *pGDB, char *pData)
 {
+    SOCKET Sock = pGDB->Sock;
     size_t szDataLen = strlen(pData);
     uint32_t uChecksum = 0;
     for (size_t i = 0; i < szDataLen; i++){
@@ -259,22 +278,25 @@ bool SendGDBPacket(SOCKET Sock, char *pData)
         return false;
     }
 
-    //Wait for Ack
-    char cAck;
-    if (recv(Sock, &cAck, 1, 0) != 1){
-        printf("Failed to recv\n");
-        return false;
-    }
+    //Wait for Ack, unless both sides agreed on QStartNoAckMode
+    if (pGDB->bNoAckMode == false){
+        char cAck;
+        if (recv(Sock, &cAck, 1, 0) != 1){
+            printf("Failed to recv\n");
+            return false;
+        }
 
-    if (cAck != '+'){
-        printf("Not a Ack (%c)!\n", cAck);
-        return false;
+        if (cAck != '+'){
+            printf("Not a Ack (%c)!\n", cAck);
+            return false;
+        }
     }
     return true;
 }
 
-bool RecvGDBPacket(SOCKET Sock, char *pCommand)
+bool RecvGDBPacket(GDB_TYPE_T *pGDB, char *pCommand)
 {
+    SOCKET Sock = pGDB->Sock;
     //char Command[1024];
     int i = 0;
     char cCurrentChar;
@@ -313,10 +335,12 @@ bool RecvGDBPacket(SOCKET Sock, char *pCommand)
         return false;
     }
 
-    //Send Ack
-    if (send(Sock, "+", 1, 0) < 0){
-        printf("Failed to send\n");
-        return false;
+    //Send Ack, unless both sides agreed on QStartNoAckMode
+    if (pGDB->bNoAckMode == false){
+        if (send(Sock, "+", 1, 0) < 0){
+            printf("Failed to send\n");
+            return false;
+        }
     }
 
     pCommand[i - 1] = 0;
@@ -362,9 +386,9 @@ bool GDB_ReadRegisterInternal(GDB_TYPE_T *pGDB, uint32_t CpuId, uint32_t Registe
     //$p0#FF
     char Command[1024];
     sprintf_s(Command, sizeof(Command), "p%d", RegisterNumber);
-    SendGDBPacket(pGDB->Sock, Command);
+    SendGDBPacket(pGDB, Command);
     //Receive 
-    RecvGDBPacket(pGDB->Sock, Command);
+    RecvGDBPacket(pGDB, Command);
 
     *pRegisterValue = RegisterStrToU64(Command);
     return false;
@@ -381,17 +405,17 @@ bool GDB_WriteRegisterInternal(GDB_TYPE_T *pGDB, uint32_t CpuId, uint32_t Regist
     sprintf_s(Command, sizeof(Command), "P%d=%s", RegisterNumber, RegisterStr);
 
     //Send
-    SendGDBPacket(pGDB->Sock, Command);
+    SendGDBPacket(pGDB, Command);
     //Receive 
-    RecvGDBPacket(pGDB->Sock, Command);
+    RecvGDBPacket(pGDB, Command);
 
     return true;
 }
 
 bool GDB_RefreshGeneralRegister(GDB_TYPE_T *pGDB) {
     //Get General Registers
-    SendGDBPacket(pGDB->Sock, "g");
-    RecvGDBPacket(pGDB->Sock, (char*)g_GeneralRegisters);
+    SendGDBPacket(pGDB, "g");
+    RecvGDBPacket(pGDB, (char*)g_GeneralRegisters);
     return 0;
 }
 
@@ -676,10 +700,10 @@ bool GDB_WriteRegister(GDB_TYPE_T *pGDB, uint32_t CpuId, FDP_Register RegisterId
 bool GDB_SingleStep(GDB_TYPE_T *pGDB)
 {
     char Command[1024];
-    //$s#FF
-    SendGDBPacket(pGDB->Sock, "s");
+    //$s#FF, or the vCont form when the stub advertises it
+    SendGDBPacket(pGDB, pGDB->bVContSupported == true ? "vCont;s" : "s");
     //Receive 
-    RecvGDBPacket(pGDB->Sock, Command);
+    RecvGDBPacket(pGDB, Command);
 
     GDB_RefreshGeneralRegister(pGDB);
     return true;
@@ -691,9 +715,9 @@ bool ReadVirtualMemoryChunk(GDB_TYPE_T *pGDB, uint64_t VirtualAddress, uint16_t
     sprintf_s(Command, sizeof(Command), "m%llx,%04x", VirtualAddress, ReadLength);
 
     //Send
-    SendGDBPacket(pGDB->Sock, Command);
+    SendGDBPacket(pGDB, Command);
     //Receive 
-    RecvGDBPacket(pGDB->Sock, Command);
+    RecvGDBPacket(pGDB, Command);
 
     if (strcmp(Command, "E00") == 0){
         return false;
@@ -732,9 +756,9 @@ bool GDB_WriteVirtualMemory(GDB_TYPE_T *pGDB, uint32_t CpuId, uint8_t *pSrcBuffe
     }
 
     //Send
-    SendGDBPacket(pGDB->Sock, Command);
+    SendGDBPacket(pGDB, Command);
     //Receive 
-    RecvGDBPacket(pGDB->Sock, Command);
+    RecvGDBPacket(pGDB, Command);
 
     return true;
 }
@@ -888,14 +912,16 @@ bool GDB_Pause(GDB_TYPE_T* pGDB)
             printf("Failed to send\n");
             return false;
         }
-        char cAck;
-        if (recv(pGDB->Sock, &cAck, 1, 0) != 1){
-            printf("Failed to recv\n");
-            return false;
+        if (pGDB->bNoAckMode == false){
+            char cAck;
+            if (recv(pGDB->Sock, &cAck, 1, 0) != 1){
+                printf("Failed to recv\n");
+                return false;
+            }
         }
 
         //Receive 
-        if (RecvGDBPacket(pGDB->Sock, Command) == false){
+        if (RecvGDBPacket(pGDB, Command) == false){
             printf("Failed to RecvGDBPacket\n");
             return false;
         }
@@ -929,7 +955,7 @@ bool GDB_ReadPhysicalMemory(GDB_TYPE_T *pGDB, void *pDstBuffer, uint32_t ReadSiz
 
 bool GDB_Resume(GDB_TYPE_T *pGDB)
 {
-    SendGDBPacket(pGDB->Sock, "c");
+    SendGDBPacket(pGDB, pGDB->bVContSupported == true ? "vCont;c" : "c");
     pGDB->bInContinue = true;
     return true;
 }
@@ -946,9 +972,9 @@ bool GDB_UnsetBreakpoint(GDB_TYPE_T* pGDB, int iBreakpointId)
     if (iBreakpointId <= 4){
         sprintf_s(Command, sizeof(Command), "z0,%llx,1", pGDB->HardwareBreakpoint[iBreakpointId]);
         //Send
-        SendGDBPacket(pGDB->Sock, Command);
+        SendGDBPacket(pGDB, Command);
         //Receive 
-        RecvGDBPacket(pGDB->Sock, Command);
+        RecvGDBPacket(pGDB, Command);
         if (Command[0] == 'O' && Command[1] == 'K'){
             pGDB->HardwareBreakpoint[iBreakpointId] = 0x0;
             return true;
@@ -971,9 +997,9 @@ int  GDB_SetBreakpoint(GDB_TYPE_T *pGDB, uint32_t CpuId, FDP_BreakpointType Brea
     }
     sprintf_s(Command, sizeof(Command), "Z0,%llx,1", BreakpointAddress);
     //Send
-    SendGDBPacket(pGDB->Sock, Command);
+    SendGDBPacket(pGDB, Command);
     //Receive 
-    RecvGDBPacket(pGDB->Sock, Command);
+    RecvGDBPacket(pGDB, Command);
     if (Command[0] == 'O' && Command[1] == 'K'){
         pGDB->HardwareBreakpoint[BreakpointIndex] = BreakpointAddress;
         return BreakpointIndex;
@@ -994,7 +1020,7 @@ bool GDB_GetStateChanged(GDB_TYPE_T *pGDB){
     if (iSelectReturn == 1){
         char Command[1024];
         //Dont care about the receivced commande
-        RecvGDBPacket(pGDB->Sock, Command);
+        RecvGDBPacket(pGDB, Command);
         printf("StateChanged !\n");
         pGDB->bInContinue = false;
         GDB_RefreshGeneralRegister(pGDB);
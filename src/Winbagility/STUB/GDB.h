@@ -32,6 +32,10 @@ typedef struct GDB_TYPE_T_{
     uint64_t    Idtrb;
     uint64_t    Gdtrb;
     bool        bIsX86;
+    //QStartNoAckMode accepted, per-packet acks are skipped both ways
+    bool        bNoAckMode;
+    //vCont? advertised, step/continue go through vCont actions
+    bool        bVContSupported;
 }GDB_TYPE_T;
 
 
@@ -603,5 +603,9 @@ bool                SendKDPacket(HANDLE hPipe, KD_PACKET_T* toSendKDPkt);
 DWORD               WriteKDPipe(HANDLE hPipe, KD_PACKET_T *pkt);
 KdPacketType        ReadKDPipe(HANDLE hPipe, KD_PACKET_T *pktBuffer);
 bool                ParseKDPkt(KD_PACKET_T* pkt);
+//Per-packet dissection dump, off by default: the dissectors decode
+//fields in place from the receive buffer, but dumping every packet
+//is far too slow for live traffic
+extern uint8_t        DEBUG_PKT;
 
 #endif //__KD_H__
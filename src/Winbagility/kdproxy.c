@@ -49,10 +49,12 @@ DWORD WINAPI DebuggeeToWinDbg(LPVOID lpParam)
             KdPacketType result = ReadKDPipe(proxyVMPipe, pKdPkt);
             if (result != KdNoPacket){
                 DWORD numBytesWritten = WriteKDPipe(proxyDBGPipe, pKdPkt);
-                WaitForSingleObject(ghMutex, INFINITE);
-                printf("[VM->Windbg] Write to Windbg : %lu\n", numBytesWritten);
-                ParseKDPkt(pKdPkt);
-                ReleaseMutex(ghMutex);
+                if (DEBUG_PKT){
+                    WaitForSingleObject(ghMutex, INFINITE);
+                    printf("[VM->Windbg] Write to Windbg : %lu\n", numBytesWritten);
+                    ParseKDPkt(pKdPkt);
+                    ReleaseMutex(ghMutex);
+                }
             }
         }
         free(pKdPkt);
@@ -77,10 +79,12 @@ DWORD WINAPI WindDbgToDebuggee(LPVOID lpParam)
             }
             else{
                 numBytesWritten = WriteKDPipe(proxyVMPipe, pKdPkt);
-                WaitForSingleObject(ghMutex, INFINITE);
-                printf("[Windbg->VM] Write to VM : %lu\n", numBytesWritten);
-                ParseKDPkt(pKdPkt);
-                ReleaseMutex(ghMutex);
+                if (DEBUG_PKT){
+                    WaitForSingleObject(ghMutex, INFINITE);
+                    printf("[Windbg->VM] Write to VM : %lu\n", numBytesWritten);
+                    ParseKDPkt(pKdPkt);
+                    ReleaseMutex(ghMutex);
+                }
             }
         }
     }
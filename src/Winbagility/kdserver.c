@@ -154,7 +154,7 @@ BOOL HandleBreakPkt(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, bool bIsBreak, bool
 
     //Read current thread address form KPRCB
     if (pWinbagilityCtx->pCurrentWindowsProfil->bIsX86 == true) {
-        pWinbagilityCtx->pfnReadVirtualMemory(pWinbagilityCtx->pUserHandle,
+        MMU_ReadVirtualMemory(pWinbagilityCtx,
             0,
             (uint8_t*)&pRespKdPkt->StateChange.Thread,
             sizeof(uint64_t),
@@ -162,7 +162,7 @@ BOOL HandleBreakPkt(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, bool bIsBreak, bool
         pRespKdPkt->StateChange.Thread |= 0xFFFFFFFF00000000;
     }
     else {
-        pWinbagilityCtx->pfnReadVirtualMemory(pWinbagilityCtx->pUserHandle,
+        MMU_ReadVirtualMemory(pWinbagilityCtx,
             0,
             (uint8_t*)&pRespKdPkt->StateChange.Thread,
             sizeof(uint64_t),
@@ -210,7 +210,7 @@ BOOL HandleBreakPkt(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, bool bIsBreak, bool
     pRespKdPkt->StateChange.ControlReport.EFlags = (ULONG)WDBG_ReadRegister(pWinbagilityCtx, CurrentCpuId, FDP_RFLAGS_REGISTER);
     //Read following instructions
     pRespKdPkt->StateChange.ControlReport.InstructionCount = DBGKD_MAXSTREAM;
-    pWinbagilityCtx->pfnReadVirtualMemory(pWinbagilityCtx->pUserHandle,
+    MMU_ReadVirtualMemory(pWinbagilityCtx,
         0,
         pRespKdPkt->StateChange.ControlReport.InstructionStream,
         pRespKdPkt->StateChange.ControlReport.InstructionCount,
@@ -280,7 +280,7 @@ BOOL HandleDbgKdGetVersionApiPkt(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, KD_PACK
 
     uint64_t v_KdVersionBlock = pWinbagilityCtx->v_KernBase + pWinbagilityCtx->pCurrentWindowsProfil->KdVersionBlockOffset;
     //Read nt!KdVersionBlock
-    if (pWinbagilityCtx->pfnReadVirtualMemory(pWinbagilityCtx->pUserHandle,
+    if (MMU_ReadVirtualMemory(pWinbagilityCtx,
         0,
         (uint8_t*)&pRespKdPkt->ManipulateState64.DbgGetVersion,
         sizeof(DBGKD_GET_VERSION_API64),
@@ -337,7 +337,7 @@ BOOL HandleDbgKdReadVirtualMemoryApiPkt(WINBAGILITY_CONTEXT_T *pWinbagilityCtx,
             //Read the end of KdDebuggerDataBlock
             memcpy(pRespKdPkt->ManipulateState64.ReadMemory.Data, ((uint8_t*)(&pWinbagilityCtx->KDBG)) + u64OffsetInKDBG, uKDBGToRead);
             //Read the end
-            bIsReadSuccess = pWinbagilityCtx->pfnReadVirtualMemory(pWinbagilityCtx->pUserHandle,
+            bIsReadSuccess = MMU_ReadVirtualMemory(pWinbagilityCtx,
                     0,
                     (uint8_t*)&pRespKdPkt->ManipulateState64.ReadMemory.Data + (sizeof(KDDEBUGGER_DATA64)-u64OffsetInKDBG),
                     (pReqKdPkt->ManipulateState64.ReadMemory.TransferCount - (sizeof(KDDEBUGGER_DATA64)-u64OffsetInKDBG)) & 0xFFFFFFFF,
@@ -374,7 +374,7 @@ BOOL HandleDbgKdReadVirtualMemoryApiPkt(WINBAGILITY_CONTEXT_T *pWinbagilityCtx,
                 break;
             default:
                 //Normal memory read
-                bIsReadSuccess = pWinbagilityCtx->pfnReadVirtualMemory(pWinbagilityCtx->pUserHandle,
+                bIsReadSuccess = MMU_ReadVirtualMemory(pWinbagilityCtx,
                     0,
                     (uint8_t*)&pRespKdPkt->ManipulateState64.ReadMemory.Data,
                     pReqKdPkt->ManipulateState64.ReadMemory.TransferCount,
@@ -424,6 +424,7 @@ BOOL HandleDbgKdWriteVirtualMemoryApiPkt(WINBAGILITY_CONTEXT_T *pWinbagilityCtx,
         pReqKdPkt->ManipulateState64.WriteMemory.Data,
         pReqKdPkt->ManipulateState64.WriteMemory.TransferCount,
         pReqKdPkt->ManipulateState64.WriteMemory.TargetBaseAddress);
+    MMU_FlushTlb();
 
     if (bIsWriteSucess){
         pRespKdPkt->ManipulateState64.ReturnStatus = STATUS_SUCCESS;
@@ -496,6 +497,7 @@ BOOL HandleDbgKdWritePhysicalMemoryApiPkt(WINBAGILITY_CONTEXT_T *pWinbagilityCtx
         pReqKdPkt->ManipulateState64.WriteMemory.Data,
         pReqKdPkt->ManipulateState64.WriteMemory.TransferCount,
         pReqKdPkt->ManipulateState64.WriteMemory.TargetBaseAddress);
+    MMU_FlushTlb();
 
     if (bResult == false){
         pRespKdPkt->ManipulateState64.ReturnStatus = STATUS_UNSUCCESSFUL;
@@ -541,6 +543,7 @@ BOOL HandleDbgKdWriteBreakPointApi(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, KD_PA
         pRespKdPkt->ManipulateState64.WriteBreakPoint.BreakPointAddress,
         0x1,
         FDP_NO_CR3);
+    MMU_FlushTlb();
     if (tmpBreakpointHandle >= 0){
         //Breakpoint install success 
         pRespKdPkt->ManipulateState64.WriteBreakPoint.BreakPointHandle = tmpBreakpointHandle; //TODO dont use FDP handle here !
@@ -575,6 +578,7 @@ BOOL HandleDbgKdRestoreBreakPointApi(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, KD_
 
     //Unset the breakpoint !
     pWinbagilityCtx->pfnUnsetBreakpoint(pWinbagilityCtx->pUserHandle, pReqKdPkt->ManipulateState64.RestoreBreakPoint.BreakPointHandle);
+    MMU_FlushTlb();
 
     SendKDPacket(pWinbagilityCtx->hWinDbgPipe, pRespKdPkt);
     return true;
@@ -766,7 +770,7 @@ BOOL HandleDbgKdReadControlSpaceApi(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, KD_P
     Log1("TargetBaseAddress %llx TransfertCount: %d\n", pReqKdPkt->ManipulateState64.ReadMemory.TargetBaseAddress, pReqKdPkt->ManipulateState64.ReadMemory.TransferCount);
 
     if (pWinbagilityCtx->pCurrentWindowsProfil->bIsX86 == true) {
-        pWinbagilityCtx->pfnReadVirtualMemory(pWinbagilityCtx->pUserHandle,
+        MMU_ReadVirtualMemory(pWinbagilityCtx,
             0,
             pRespKdPkt->ManipulateState64.ReadMemory.Data,
             pReqKdPkt->ManipulateState64.ReadMemory.TransferCount,
@@ -787,7 +791,7 @@ BOOL HandleDbgKdReadControlSpaceApi(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, KD_P
         case 2: //SpecialRegisters
         {
             //TODO: 
-            pWinbagilityCtx->pfnReadVirtualMemory(pWinbagilityCtx->pUserHandle,
+            MMU_ReadVirtualMemory(pWinbagilityCtx,
                 0,
                 pRespKdPkt->ManipulateState64.ReadMemory.Data,
                 pReqKdPkt->ManipulateState64.ReadMemory.TransferCount,
@@ -833,7 +837,7 @@ BOOL HandleDbgKdReadControlSpaceApi(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, KD_P
              }*/
              //But not indeed...
              {
-                 pWinbagilityCtx->pfnReadVirtualMemory(pWinbagilityCtx->pUserHandle,
+                 MMU_ReadVirtualMemory(pWinbagilityCtx,
                      0,
                      (uint8_t*)&CurrentThreadPointer,
                      sizeof(CurrentThreadPointer),
@@ -895,6 +899,7 @@ bool HandleDbgKdWriteControlSpaceApi(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, KD_
         pWinbagilityCtx->pfnWriteRegister(pWinbagilityCtx->pUserHandle, CurrentCpuId, FDP_CR0_REGISTER, tmpSpecialRegisters->Cr0);
         pWinbagilityCtx->pfnWriteRegister(pWinbagilityCtx->pUserHandle, CurrentCpuId, FDP_CR2_REGISTER, tmpSpecialRegisters->Cr2);
         pWinbagilityCtx->pfnWriteRegister(pWinbagilityCtx->pUserHandle, CurrentCpuId, FDP_CR3_REGISTER, tmpSpecialRegisters->Cr3);
+        MMU_FlushTlb();
         pWinbagilityCtx->pfnWriteRegister(pWinbagilityCtx->pUserHandle, CurrentCpuId, FDP_CR4_REGISTER, tmpSpecialRegisters->Cr4);
         pWinbagilityCtx->pfnWriteRegister(pWinbagilityCtx->pUserHandle, CurrentCpuId, FDP_CR8_REGISTER, tmpSpecialRegisters->Cr8);
         break;
@@ -925,10 +930,12 @@ bool HandleDbgKdContinueApi(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, KD_PACKET_T
     else{
         if (pWinbagilityCtx->bSingleStep == true){
             pWinbagilityCtx->pfnSingleStep(pWinbagilityCtx->pUserHandle, CurrentCpuId);
+            MMU_FlushTlb();
             HandleBreakPkt(pWinbagilityCtx, false, false);
         }
         else{
             pWinbagilityCtx->pfnResume(pWinbagilityCtx->pUserHandle);
+            MMU_FlushTlb();
         }
     }
 
@@ -958,6 +965,7 @@ bool HandleDbgKdContinueApi2(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, KD_PACKET_T
             pWinbagilityCtx->bSingleStep = true;
             //Single step the current cpu
             pWinbagilityCtx->pfnSingleStep(pWinbagilityCtx->pUserHandle, CurrentCpuId);
+            MMU_FlushTlb();
             //Alert WinDbg that the single step is done 
 
             HandleBreakPkt(pWinbagilityCtx, true, false);
@@ -965,6 +973,7 @@ bool HandleDbgKdContinueApi2(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, KD_PACKET_T
         }
         else{
             pWinbagilityCtx->pfnResume(pWinbagilityCtx->pUserHandle);
+            MMU_FlushTlb();
         }
     }
     return true;
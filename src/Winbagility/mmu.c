@@ -37,6 +37,127 @@
 #include "utils.h"
 
 
+//Direct-mapped TLB over the stub page-table walk: WinDbg spams
+//overlapping virtual reads while stepping and every one costs a full
+//four-level walk in the stub; cached translations are tagged with the
+//guest CR3 and a generation bumped on resume/single-step, so a flush
+//is a counter increment and stale entries die without clearing the
+//table
+#define MMU_TLB_ENTRY_COUNT 1024 //Power of two
+
+typedef struct MMU_TLB_ENTRY_T_{
+    uint64_t Cr3;
+    uint64_t VirtualPageAddress;
+    uint64_t PhysicalPageAddress;
+    uint64_t Generation;
+}MMU_TLB_ENTRY_T;
+
+static MMU_TLB_ENTRY_T gTlbEntries[MMU_TLB_ENTRY_COUNT];
+
+//Read-combining cache under the TLB: WinDbg refreshes its stack and
+//disassembly windows with bursts of adjacent small reads, and each
+//one used to cost a stub round-trip; misses pull the whole guest
+//page once and the rest of the burst is served from local memory,
+//sharing the TLB generation so it empties whenever the target runs
+#define MMU_PAGE_CACHE_ENTRY_COUNT 64 //Power of two, 256KB of guest pages
+
+typedef struct MMU_PAGE_CACHE_ENTRY_T_{
+    uint64_t PhysicalPageAddress;
+    uint64_t Generation;
+    uint8_t Data[PAGE_SIZE];
+}MMU_PAGE_CACHE_ENTRY_T;
+
+static MMU_PAGE_CACHE_ENTRY_T gPageCacheEntries[MMU_PAGE_CACHE_ENTRY_COUNT];
+static uint64_t gTlbGeneration = 1; //0 tags never-filled entries
+static uint64_t gTlbCr3Value = 0;
+static uint64_t gTlbCr3Generation = 0;
+static uint32_t gTlbCr3CpuId = 0;
+
+void MMU_FlushTlb()
+{
+    gTlbGeneration++;
+}
+
+//Read the guest CR3 once per generation instead of once per page
+static bool MMU_GetCr3(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, uint32_t CpuId, uint64_t *pCr3Value)
+{
+    if (gTlbCr3Generation != gTlbGeneration || gTlbCr3CpuId != CpuId){
+        if (pWinbagilityCtx->pfnReadRegister(pWinbagilityCtx->pUserHandle, CpuId, FDP_CR3_REGISTER, &gTlbCr3Value) == false){
+            return false;
+        }
+        gTlbCr3Generation = gTlbGeneration;
+        gTlbCr3CpuId = CpuId;
+    }
+    *pCr3Value = gTlbCr3Value;
+    return true;
+}
+
+static bool MMU_VirtualToPhysical(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, uint32_t CpuId, uint64_t VirtualAddress, uint64_t *pPhysicalAddress)
+{
+    uint64_t Cr3Value;
+    if (MMU_GetCr3(pWinbagilityCtx, CpuId, &Cr3Value) == false){
+        return false;
+    }
+    uint64_t VirtualPageAddress = VirtualAddress & ~((uint64_t)(PAGE_SIZE - 1));
+    MMU_TLB_ENTRY_T *pTlbEntry = &gTlbEntries[(VirtualPageAddress >> 12) & (MMU_TLB_ENTRY_COUNT - 1)];
+    if (pTlbEntry->Generation == gTlbGeneration
+        && pTlbEntry->Cr3 == Cr3Value
+        && pTlbEntry->VirtualPageAddress == VirtualPageAddress){
+        *pPhysicalAddress = pTlbEntry->PhysicalPageAddress + (VirtualAddress & (PAGE_SIZE - 1));
+        return true;
+    }
+    uint64_t PhysicalPageAddress;
+    if (pWinbagilityCtx->pfnVirtualToPhysical(pWinbagilityCtx->pUserHandle, CpuId, VirtualPageAddress, &PhysicalPageAddress) == false){
+        return false;
+    }
+    pTlbEntry->Cr3 = Cr3Value;
+    pTlbEntry->VirtualPageAddress = VirtualPageAddress;
+    pTlbEntry->PhysicalPageAddress = PhysicalPageAddress;
+    pTlbEntry->Generation = gTlbGeneration;
+    *pPhysicalAddress = PhysicalPageAddress + (VirtualAddress & (PAGE_SIZE - 1));
+    return true;
+}
+
+bool MMU_ReadVirtualMemory(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, uint32_t CpuId, uint8_t *pDstBuffer, uint32_t ReadSize, uint64_t VirtualAddress)
+{
+    //Stubs without a translation callback keep the direct path
+    if (pWinbagilityCtx->pfnVirtualToPhysical == NULL
+        || pWinbagilityCtx->pfnReadPhysicalMemory == NULL
+        || pWinbagilityCtx->pfnReadRegister == NULL){
+        return pWinbagilityCtx->pfnReadVirtualMemory(pWinbagilityCtx->pUserHandle, CpuId, pDstBuffer, ReadSize, VirtualAddress);
+    }
+    uint32_t CurrentOffset = 0;
+    while (CurrentOffset < ReadSize){
+        uint64_t CurrentVirtualAddress = VirtualAddress + CurrentOffset;
+        uint32_t LeftInPage = PAGE_SIZE - (uint32_t)(CurrentVirtualAddress & (PAGE_SIZE - 1));
+        uint32_t CurrentReadSize = MIN(ReadSize - CurrentOffset, LeftInPage);
+        uint64_t PhysicalAddress;
+        if (MMU_VirtualToPhysical(pWinbagilityCtx, CpuId, CurrentVirtualAddress, &PhysicalAddress) == false){
+            return false;
+        }
+        uint64_t PhysicalPageAddress = PhysicalAddress & ~((uint64_t)(PAGE_SIZE - 1));
+        MMU_PAGE_CACHE_ENTRY_T *pPageEntry = &gPageCacheEntries[(PhysicalPageAddress >> 12) & (MMU_PAGE_CACHE_ENTRY_COUNT - 1)];
+        if (pPageEntry->Generation != gTlbGeneration
+            || pPageEntry->PhysicalPageAddress != PhysicalPageAddress){
+            if (pWinbagilityCtx->pfnReadPhysicalMemory(pWinbagilityCtx->pUserHandle, pPageEntry->Data, PAGE_SIZE, PhysicalPageAddress) == false){
+                //Truncated page at the end of physical memory, read the
+                //requested chunk directly and don't cache it
+                pPageEntry->Generation = 0;
+                if (pWinbagilityCtx->pfnReadPhysicalMemory(pWinbagilityCtx->pUserHandle, pDstBuffer + CurrentOffset, CurrentReadSize, PhysicalAddress) == false){
+                    return false;
+                }
+                CurrentOffset = CurrentOffset + CurrentReadSize;
+                continue;
+            }
+            pPageEntry->PhysicalPageAddress = PhysicalPageAddress;
+            pPageEntry->Generation = gTlbGeneration;
+        }
+        memcpy(pDstBuffer + CurrentOffset, pPageEntry->Data + (PhysicalAddress & (PAGE_SIZE - 1)), CurrentReadSize);
+        CurrentOffset = CurrentOffset + CurrentReadSize;
+    }
+    return true;
+}
+
 bool WDBG_SearchVirtualMemory(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, uint8_t *pPatternData, uint32_t PatternSize, uint64_t StartVirtualAddress, uint64_t EndOffset, uint64_t *pFoundVirtualAddress)
 {
     uint64_t curOffset = 0;
@@ -27,6 +27,17 @@
 #define PAGE_SIZE 4096
 
 
+//Translation cache over the stub page-table walk, flushed by
+//generation whenever the target runs
+void MMU_FlushTlb();
+
+bool MMU_ReadVirtualMemory(WINBAGILITY_CONTEXT_T *pWinbagilityCtx,
+                                        uint32_t CpuId,
+                                        uint8_t *pDstBuffer,
+                                        uint32_t ReadSize,
+                                        uint64_t VirtualAddress);
+
+
 bool WDBG_SearchVirtualMemory(WINBAGILITY_CONTEXT_T *pWinbagilityCtx, 
                                         uint8_t *pPatternData, 
                                         uint32_t PatternSize, 
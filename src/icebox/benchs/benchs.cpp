@@ -1,8 +1,70 @@
 #include <FDP.h>
 
+#define FDP_MODULE "benchs"
+#include <icebox/core.hpp>
+#include <icebox/endian.hpp>
+#include <icebox/log.hpp>
+
 #include <benchmark/benchmark.h>
 
 #include <memory>
+#include <vector>
+
+namespace
+{
+    // prove the batched endian decoders beat the per-field loop on a
+    // handle-table-sized page; no vm needed
+    void le64_per_field(benchmark::State& state)
+    {
+        auto page = std::vector<uint8_t>(4096, 0x5A);
+        auto sum  = uint64_t{0};
+        for(auto _ : state)
+        {
+            for(size_t i = 0; i < page.size(); i += sizeof(uint64_t))
+                sum += read_le64(&page[i]);
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetBytesProcessed(state.iterations() * int64_t(page.size()));
+    }
+
+    void le64_batched(benchmark::State& state)
+    {
+        auto page = std::vector<uint8_t>(4096, 0x5A);
+        auto sum  = uint64_t{0};
+        for(auto _ : state)
+        {
+            uint64_t values[4];
+            for(size_t i = 0; i < page.size(); i += sizeof values)
+            {
+                read_le64x4(values, &page[i]);
+                sum += values[0] + values[1] + values[2] + values[3];
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetBytesProcessed(state.iterations() * int64_t(page.size()));
+    }
+
+    void be64_batched(benchmark::State& state)
+    {
+        auto page = std::vector<uint8_t>(4096, 0x5A);
+        auto sum  = uint64_t{0};
+        for(auto _ : state)
+        {
+            uint64_t values[4];
+            for(size_t i = 0; i < page.size(); i += sizeof values)
+            {
+                read_be64x4(values, &page[i]);
+                sum += values[0] + values[1] + values[2] + values[3];
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetBytesProcessed(state.iterations() * int64_t(page.size()));
+    }
+}
+
+BENCHMARK(le64_per_field);
+BENCHMARK(le64_batched);
+BENCHMARK(be64_batched);
 
 namespace
 {
@@ -126,5 +188,132 @@ BENCHMARK_F(win10, set_breakpoint)
     state.SetItemsProcessed(int64_t(state.iterations()));
 }
 
+namespace
+{
+    // per-thread client handles over one channel: pair with the fdp_fake
+    // synthetic server to measure client-side scaling without a
+    // hypervisor bounding throughput
+    void mt_read_physical(benchmark::State& state)
+    {
+        // no FDP_Init here: it zeroes the shared channel & would corrupt
+        // the other clients mid-operation
+        auto* shm = FDP_OpenSHM(vm_name);
+        if(!shm)
+            return state.SkipWithError("unable to open shm");
+
+        auto bytes = std::vector<uint8_t>(4096);
+        for(auto _ : state)
+        {
+            (void) _;
+            const auto ok = FDP_ReadPhysicalMemory(shm, &bytes[0], uint32_t(bytes.size()), 0x1000);
+            if(!ok)
+                return state.SkipWithError("unable to read memory");
+        }
+        state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(bytes.size()));
+        FDP_ExitSHM(shm);
+    }
+}
+BENCHMARK(mt_read_physical)->ThreadRange(1, 8)->UseRealTime();
+
+namespace
+{
+    // same guest through the icebox layers: regressions seen by tools
+    // live here, not in the raw fdp calls above
+    struct icebox_win10
+        : public ::benchmark::Fixture
+    {
+        void SetUp(::benchmark::State& state) override
+        {
+            core = core::attach(vm_name);
+            if(!core)
+                return state.SkipWithError("unable to attach icebox core");
+
+            state::pause(*core);
+        }
+
+        void TearDown(::benchmark::State& /*state*/) override
+        {
+            if(core)
+                state::resume(*core);
+            core = nullptr;
+        }
+
+        std::shared_ptr<core::Core> core;
+    };
+}
+
+BENCHMARK_DEFINE_F(icebox_win10, read_virtual)
+(benchmark::State& state)
+{
+    const auto proc = process::current(*core);
+    if(!proc)
+        return state.SkipWithError("unable to read current process");
+
+    const auto lstar = registers::read_msr(*core, msr_e::lstar);
+    auto bytes       = std::vector<uint8_t>(state.range(0));
+    for(auto _ : state)
+    {
+        (void) _;
+        const auto ok = memory::read_virtual(*core, *proc, &bytes[0], lstar, bytes.size());
+        if(!ok)
+            return state.SkipWithError("unable to read memory");
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+BENCHMARK_REGISTER_F(icebox_win10, read_virtual)->Arg(8)->Arg(4096)->Arg(1 << 16);
+
+BENCHMARK_F(icebox_win10, process_list)
+(benchmark::State& state)
+{
+    auto count = int64_t{};
+    for(auto _ : state)
+    {
+        (void) _;
+        const auto ok = process::list(*core, [&](proc_t)
+        {
+            ++count;
+            return walk_e::next;
+        });
+        if(!ok)
+            return state.SkipWithError("unable to list processes");
+    }
+    state.SetItemsProcessed(count);
+}
+
+BENCHMARK_F(icebox_win10, symbols_string)
+(benchmark::State& state)
+{
+    const auto proc = process::current(*core);
+    if(!proc)
+        return state.SkipWithError("unable to read current process");
+
+    symbols::load_drivers(*core);
+    const auto lstar = registers::read_msr(*core, msr_e::lstar);
+    for(auto _ : state)
+    {
+        (void) _;
+        benchmark::DoNotOptimize(symbols::string(*core, *proc, lstar));
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+BENCHMARK_F(icebox_win10, callstacks_read)
+(benchmark::State& state)
+{
+    const auto proc = process::current(*core);
+    if(!proc)
+        return state.SkipWithError("unable to read current process");
+
+    symbols::load_drivers(*core);
+    auto callers = std::vector<callstacks::caller_t>(256);
+    auto frames  = int64_t{};
+    for(auto _ : state)
+    {
+        (void) _;
+        frames += int64_t(callstacks::read(*core, &callers[0], callers.size(), *proc));
+    }
+    state.SetItemsProcessed(frames);
+}
+
 // Run the benchmark
 BENCHMARK_MAIN();
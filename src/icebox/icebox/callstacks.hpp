@@ -2,6 +2,9 @@
 
 #include "types.hpp"
 
+#include <string>
+#include <vector>
+
 namespace core { struct Core; }
 
 namespace callstacks
@@ -20,9 +23,26 @@ namespace callstacks
         uint64_t addr;
     };
 
+    // partial unwind knobs for cheap attribution paths,
+    // zeroed fields keep the full-fidelity behavior
+    struct options_t
+    {
+        size_t max_depth;          // stop after this many frames, 0 means num_callers
+        bool   frame_pointer_only; // follow the bp chain only, skip unwind info
+        bool   same_module_only;   // stop once a frame leaves the first frame's module
+    };
+
     size_t      read            (core::Core& core, caller_t* callers, size_t num_callers, proc_t proc);
     size_t      read_from       (core::Core& core, caller_t* callers, size_t num_callers, proc_t proc, const context_t& where);
+    size_t      read_partial    (core::Core& core, caller_t* callers, size_t num_callers, proc_t proc, const options_t& opts);
     bool        load_module     (core::Core& core, proc_t proc, mod_t mod);
     bool        load_driver     (core::Core& core, proc_t proc, driver_t drv);
     opt<bpid_t> autoload_modules(core::Core& core, proc_t proc);
+
+    // interned stack ids: identical caller arrays collapse to one compact
+    // id and are symbolized once, trace sinks store the 8-byte id instead
+    // of full frame lists
+    uint64_t                        intern      (core::Core& core, proc_t proc, const caller_t* callers, size_t num_callers);
+    // symbolized frames for an interned id, null when the id is unknown
+    const std::vector<std::string>* symbolized  (core::Core& core, uint64_t stack_id);
 } // namespace callstacks
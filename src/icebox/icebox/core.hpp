@@ -28,4 +28,13 @@ namespace core
 
     // detect try to detect current os & possibly change current os helper.
     bool detect(core::Core& core);
+
+    // attach_lazy returns a core without running os detection; the
+    // first os-dependent call triggers it, so trivial control
+    // operations (pause, resume, single-step) attach in milliseconds.
+    std::shared_ptr<Core> attach_lazy(const std::string& name);
+
+    // warm_up is the prefetch hint for heavyweight users: it runs os
+    // detection & kernel symbol loading now instead of on first use.
+    bool warm_up(core::Core& core);
 } // namespace core
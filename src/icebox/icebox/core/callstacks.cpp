@@ -5,6 +5,21 @@
 #include "core.hpp"
 #include "core_private.hpp"
 #include "interfaces/if_callstacks.hpp"
+#include "utils/hash.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+struct callstacks::Data
+{
+    std::unordered_map<uint64_t, std::vector<std::string>> stacks;
+};
+
+std::shared_ptr<callstacks::Data> callstacks::setup()
+{
+    return std::make_shared<callstacks::Data>();
+}
 
 size_t callstacks::read(core::Core& core, caller_t* callers, size_t num_callers, proc_t proc)
 {
@@ -22,6 +37,14 @@ size_t callstacks::read_from(core::Core& core, caller_t* callers, size_t num_cal
     return core.callstacks_->read_from(callers, num_callers, proc, where);
 }
 
+size_t callstacks::read_partial(core::Core& core, caller_t* callers, size_t num_callers, proc_t proc, const options_t& opts)
+{
+    if(!core.callstacks_)
+        return 0;
+
+    return core.callstacks_->read_partial(callers, num_callers, proc, opts);
+}
+
 bool callstacks::load_module(core::Core& core, proc_t proc, mod_t mod)
 {
     if(!core.callstacks_)
@@ -68,10 +91,52 @@ opt<bpid_t> callstacks::autoload_modules(core::Core& core, proc_t proc)
         return walk_e::next;
     });
     const auto ptr   = &core;
+    const auto seen  = std::make_shared<std::unordered_set<uint64_t>>();
     const auto flags = process::flags(core, proc);
     const auto bpid  = modules::listen_create(core, proc, flags, [=](mod_t mod)
     {
+        // startup bursts repeat notifications per dll, preload once
+        if(!seen->insert(mod.id).second)
+            return;
+
         load_module(*ptr, proc, mod);
     });
     return bpid;
 }
+
+namespace
+{
+    uint64_t stack_id(const callstacks::caller_t* callers, size_t num_callers)
+    {
+        size_t seed = 0;
+        for(size_t i = 0; i < num_callers; ++i)
+            ::hash::combine(seed, callers[i].addr);
+        return seed;
+    }
+}
+
+uint64_t callstacks::intern(core::Core& core, proc_t proc, const caller_t* callers, size_t num_callers)
+{
+    const auto id = stack_id(callers, num_callers);
+    auto& stacks  = core.stacks_->stacks;
+    if(stacks.count(id))
+        return id;
+
+    // distinct stacks are few relative to events, symbolize once here
+    auto addrs = std::vector<uint64_t>{};
+    addrs.reserve(num_callers);
+    for(size_t i = 0; i < num_callers; ++i)
+        addrs.push_back(callers[i].addr);
+    stacks.emplace(id, symbols::string_many(core, proc, addrs.data(), num_callers));
+    return id;
+}
+
+const std::vector<std::string>* callstacks::symbolized(core::Core& core, uint64_t stack_id)
+{
+    const auto& stacks = core.stacks_->stacks;
+    const auto it      = stacks.find(stack_id);
+    if(it == stacks.end())
+        return nullptr;
+
+    return &it->second;
+}
@@ -8,8 +8,11 @@
 #include "interfaces/if_os.hpp"
 #include "interfaces/if_symbols.hpp"
 #include "log.hpp"
+#include "utils/file.hpp"
+#include "utils/utils.hpp"
 
 #include <chrono>
+#include <cstring>
 #include <thread>
 
 core::Core::Core(std::string name)
@@ -59,9 +62,14 @@ namespace
         return true;
     }
 
-    bool finalize_linux(core::Core& /*core*/)
+    bool finalize_linux(core::Core& core)
     {
-        return true;
+        core.callstacks_ = callstacks::make_linux(core);
+        if(core.callstacks_)
+            return true;
+
+        core.linux_.reset();
+        return false;
     }
 
     struct interfaces_t
@@ -84,12 +92,54 @@ namespace
             },
     };
 
+    fs::path detect_cache_path(const std::string& name)
+    {
+        auto ec        = std::error_code{};
+        const auto dir = fs::temp_directory_path(ec);
+        if(ec)
+            return {};
+
+        return dir / ("icebox." + name + ".os");
+    }
+
+    opt<size_t> load_last_os(const std::string& name)
+    {
+        const auto path = detect_cache_path(name);
+        if(path.empty())
+            return {};
+
+        auto map = file::Map{};
+        if(!file::map_read(map, path))
+            return {};
+
+        auto found = opt<size_t>{};
+        for(size_t i = 0; i < COUNT_OF(g_interfaces); ++i)
+            if(map.size == strlen(g_interfaces[i].name))
+                if(!memcmp(map.data, g_interfaces[i].name, map.size))
+                    found = i;
+        file::unmap(map);
+        return found;
+    }
+
+    void save_last_os(const std::string& name, const char* os)
+    {
+        const auto path = detect_cache_path(name);
+        if(path.empty())
+            return;
+
+        file::write(path, os, strlen(os));
+    }
+
     bool try_load_os(core::Core& core)
     {
-        for(const auto& h : g_interfaces)
+        // start with the os detected on the last attach of this vm
+        const auto last  = load_last_os(core.name_);
+        const auto first = last ? *last : size_t{0};
+        for(size_t i = 0; i < COUNT_OF(g_interfaces); ++i)
         {
-            core.os_ = nullptr;
-            auto ok  = h.make(core);
+            const auto& h = g_interfaces[(first + i) % COUNT_OF(g_interfaces)];
+            core.os_      = nullptr;
+            auto ok       = h.make(core);
             if(!ok)
                 continue;
 
@@ -101,6 +151,7 @@ namespace
             if(!ok)
                 continue;
 
+            save_last_os(core.name_, h.name);
             return true;
         }
 
@@ -120,8 +171,11 @@ namespace
 
         fdp::reset(core);
         core.mem_     = memory::setup();
+        core.regs_    = registers::setup();
         core.state_   = state::setup(core);
         core.func_    = functions::setup();
+        core.drv_     = drivers::setup();
+        core.stacks_  = callstacks::setup();
         core.symbols_ = std::make_unique<symbols::Modules>(core);
         core.none_    = os::make_none();
         core.os_      = &*core.none_;
@@ -143,6 +197,26 @@ bool core::detect(core::Core& core)
     return try_load_os(core);
 }
 
+std::shared_ptr<core::Core> core::attach_lazy(const std::string& name)
+{
+    auto ptr = attach_only(name);
+    if(!ptr)
+        return {};
+
+    ptr->lazy_ = os::make_lazy(*ptr);
+    ptr->os_   = &*ptr->lazy_;
+    return ptr;
+}
+
+bool core::warm_up(core::Core& core)
+{
+    // already detected, nothing left to prefetch
+    if(core.os_ != &*core.none_ && (!core.lazy_ || core.os_ != &*core.lazy_))
+        return true;
+
+    return try_load_os(core);
+}
+
 std::shared_ptr<core::Core> core::attach(const std::string& name)
 {
     const auto ptr = attach_only(name);
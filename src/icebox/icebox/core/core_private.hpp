@@ -14,8 +14,16 @@ namespace memory
 {
     struct Memory;
     std::shared_ptr<Memory> setup();
+    void                    flush_tlb   (core::Core& core);
+    void                    flush_caches(core::Core& core);
 } // namespace memory
 
+namespace registers
+{
+    struct Registers;
+    std::shared_ptr<Registers> setup();
+} // namespace registers
+
 namespace state
 {
     struct State;
@@ -28,6 +36,18 @@ namespace functions
     std::shared_ptr<Data> setup();
 } // namespace functions
 
+namespace drivers
+{
+    struct Data;
+    std::shared_ptr<Data> setup();
+} // namespace drivers
+
+namespace callstacks
+{
+    struct Data;
+    std::shared_ptr<Data> setup();
+} // namespace callstacks
+
 namespace os { struct Module; }
 namespace callstacks { struct Module; }
 namespace symbols { struct Modules; }
@@ -37,9 +57,12 @@ namespace core
 {
     using Shm        = std::shared_ptr<fdp::shm>;
     using Memory     = std::shared_ptr<memory::Memory>;
+    using Registers  = std::shared_ptr<registers::Registers>;
     using State      = std::shared_ptr<state::State>;
     using Functions  = std::shared_ptr<functions::Data>;
+    using Drivers    = std::shared_ptr<drivers::Data>;
     using Callstacks = std::unique_ptr<callstacks::Module>;
+    using Stacks     = std::shared_ptr<callstacks::Data>;
     using Symbols    = std::unique_ptr<symbols::Modules>;
     using Nt         = std::shared_ptr<nt::Os>;
     using Os         = std::unique_ptr<os::Module>;
@@ -52,13 +75,17 @@ namespace core
         const std::string name_;
         Shm               shm_;
         Memory            mem_;
+        Registers         regs_;
         State             state_;
         Functions         func_;
+        Drivers           drv_;
         Os                none_;
+        Os                lazy_;
         Nt                nt_;
         Os                linux_;
         os::Module*       os_;
         Callstacks        callstacks_;
+        Stacks            stacks_;
         Symbols           symbols_;
     };
 } // namespace core
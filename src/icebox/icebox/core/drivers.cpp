@@ -8,6 +8,9 @@
 #include "log.hpp"
 #include "utils/path.hpp"
 
+#include <algorithm>
+#include <vector>
+
 #ifdef _MSC_VER
 #    define stricmp _stricmp
 #else
@@ -15,13 +18,117 @@
 #    define stricmp strcasecmp
 #endif
 
+namespace
+{
+    struct Entry
+    {
+        uint64_t addr;
+        uint64_t size;
+        driver_t drv;
+    };
+}
+
+struct drivers::Data
+{
+    std::vector<Entry> entries; // sorted by base address
+    opt<bpid_t>        bpid;    // load/unload refresh listener
+    bool               valid = false;
+};
+
+std::shared_ptr<drivers::Data> drivers::setup()
+{
+    return std::make_shared<drivers::Data>();
+}
+
 bool drivers::list(core::Core& core, on_driver_fn on_driver)
 {
     return core.os_->driver_list(std::move(on_driver));
 }
 
+namespace
+{
+    void index_insert(drivers::Data& d, core::Core& core, driver_t drv)
+    {
+        const auto span = drivers::span(core, drv);
+        if(!span)
+            return;
+
+        const auto it = std::upper_bound(d.entries.begin(), d.entries.end(), span->addr, [](uint64_t addr, const Entry& e)
+        {
+            return addr < e.addr;
+        });
+        d.entries.insert(it, Entry{span->addr, span->size, drv});
+    }
+
+    void index_remove(drivers::Data& d, driver_t drv)
+    {
+        d.entries.erase(std::remove_if(d.entries.begin(), d.entries.end(), [&](const Entry& e)
+        {
+            return e.drv.id == drv.id;
+        }), d.entries.end());
+    }
+
+    // one guest walk builds a sorted interval table of loaded drivers,
+    // kept current through the load/unload listener, so kernel-address
+    // attribution stays a local binary search per symbolized frame
+    bool index_drivers(drivers::Data& d, core::Core& core)
+    {
+        if(d.valid)
+            return true;
+
+        const auto ptr = &core;
+        if(!d.bpid)
+            d.bpid = drivers::listen_create(core, [=](driver_t drv, bool load)
+            {
+                auto& data = *ptr->drv_;
+                if(load)
+                    index_insert(data, *ptr, drv);
+                else
+                    index_remove(data, drv);
+            });
+        // without a refresh path the table would go stale, keep walking
+        if(!d.bpid)
+            return false;
+
+        d.entries.clear();
+        drivers::list(core, [&](driver_t drv)
+        {
+            const auto span = drivers::span(core, drv);
+            if(span)
+                d.entries.push_back(Entry{span->addr, span->size, drv});
+            return walk_e::next;
+        });
+        std::sort(d.entries.begin(), d.entries.end(), [](const Entry& a, const Entry& b)
+        {
+            return a.addr < b.addr;
+        });
+        d.valid = true;
+        return true;
+    }
+
+    opt<driver_t> find_indexed(drivers::Data& d, uint64_t addr)
+    {
+        const auto it = std::upper_bound(d.entries.begin(), d.entries.end(), addr, [](uint64_t want, const Entry& e)
+        {
+            return want < e.addr;
+        });
+        if(it == d.entries.begin())
+            return {};
+
+        const auto& e = *(it - 1);
+        if(addr >= e.addr + e.size)
+            return {};
+
+        return e.drv;
+    }
+}
+
 opt<driver_t> drivers::find(core::Core& core, uint64_t addr)
 {
+    auto& d = *core.drv_;
+    if(index_drivers(d, core))
+        return find_indexed(d, addr);
+
     auto found = opt<driver_t>{};
     drivers::list(core, [&](driver_t drv)
     {
@@ -4,13 +4,23 @@
 #define FDP_MODULE "fdp"
 #include "core.hpp"
 #include "core_private.hpp"
+#include "counters.hpp"
+#include "fdp_dump.hpp"
+#include "fdp_replay.hpp"
 #include "log.hpp"
 
 extern "C"
 {
 #include <FDP.h>
+#include <FDP_structs.h>
 }
 
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
 struct fdp::shm
 {
     shm(FDP_SHM* ptr)
@@ -21,17 +31,211 @@ struct fdp::shm
 
     ~shm()
     {
+        if(!ptr)
+            return;
+
         FDP_Resume(ptr);
         FDP_ExitSHM(ptr);
     }
 
-    FDP_SHM* ptr;
-    bool     is_running;
+    FDP_SHM*               ptr;
+    bool                   is_running;
+    fdp_replay::SessionPtr session;
+    fdp_dump::DumpPtr      dump;
+    fdp::on_stall_fn       on_stall;
 };
 
+namespace
+{
+    bool read_cpu_state(FDP_SHM* ptr, fdp_dump::cpu_state& state)
+    {
+        const auto reg = [&](uint64_t& dst, FDP_Register id)
+        {
+            return FDP_ReadRegister(ptr, 0, id, &dst);
+        };
+        auto ok = reg(state.regs[0], FDP_RAX_REGISTER)
+                  && reg(state.regs[1], FDP_RCX_REGISTER)
+                  && reg(state.regs[2], FDP_RDX_REGISTER)
+                  && reg(state.regs[3], FDP_RBX_REGISTER)
+                  && reg(state.regs[4], FDP_RSP_REGISTER)
+                  && reg(state.regs[5], FDP_RBP_REGISTER)
+                  && reg(state.regs[6], FDP_RSI_REGISTER)
+                  && reg(state.regs[7], FDP_RDI_REGISTER)
+                  && reg(state.regs[8], FDP_R8_REGISTER)
+                  && reg(state.regs[9], FDP_R9_REGISTER)
+                  && reg(state.regs[10], FDP_R10_REGISTER)
+                  && reg(state.regs[11], FDP_R11_REGISTER)
+                  && reg(state.regs[12], FDP_R12_REGISTER)
+                  && reg(state.regs[13], FDP_R13_REGISTER)
+                  && reg(state.regs[14], FDP_R14_REGISTER)
+                  && reg(state.regs[15], FDP_R15_REGISTER)
+                  && reg(state.rip, FDP_RIP_REGISTER)
+                  && reg(state.rflags, FDP_RFLAGS_REGISTER)
+                  && reg(state.seg_cs, FDP_CS_REGISTER)
+                  && reg(state.dtb, FDP_CR3_REGISTER);
+        ok = ok && FDP_ReadMsr(ptr, 0, 0xC0000082, &state.lstar);
+        ok = ok && FDP_ReadMsr(ptr, 0, 0xC0000101, &state.gs_base);
+        ok = ok && FDP_ReadMsr(ptr, 0, 0xC0000102, &state.kernel_gs_base);
+        return ok;
+    }
+
+    fdp_dump::DumpPtr take_snapshot(FDP_SHM* ptr)
+    {
+        if(!FDP_Pause(ptr))
+            return nullptr;
+
+        auto state = fdp_dump::cpu_state{};
+        if(!read_cpu_state(ptr, state))
+            return nullptr;
+
+        auto size = uint64_t{};
+        if(!FDP_GetPhysicalMemorySize(ptr, &size) || !size)
+            return nullptr;
+
+        // one sequential pass over guest ram bounds the pause window,
+        // the stream reader serves it from the shared mapping locally
+        auto buffer = std::vector<uint8_t>(size);
+        if(!FDP_ReadPhysicalMemoryStream(ptr, buffer.data(), size, 0))
+            return nullptr;
+
+        return fdp_dump::freeze(std::move(buffer), state);
+    }
+
+    fdp_dump::DumpPtr take_fork(FDP_SHM* ptr)
+    {
+        if(!FDP_Pause(ptr))
+            return nullptr;
+
+        auto state = fdp_dump::cpu_state{};
+        if(!read_cpu_state(ptr, state))
+            return nullptr;
+
+        char path[FDP_FORK_PATH_SIZE];
+        if(!FDP_Fork(ptr, path, sizeof path))
+            return nullptr;
+
+        // the cow image is stable now, the guest resumes before the fork
+        // is even read back: analysis time never adds to pause time
+        FDP_Resume(ptr);
+        auto file = fopen(path, "rb");
+        if(!file)
+            return nullptr;
+
+        fseek(file, 0, SEEK_END);
+        const auto size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        auto buffer  = std::vector<uint8_t>(static_cast<size_t>(size));
+        const auto n = fread(buffer.data(), 1, buffer.size(), file);
+        fclose(file);
+        if(n != buffer.size())
+            return nullptr;
+
+        return fdp_dump::freeze(std::move(buffer), state);
+    }
+
+    fdp::channel_health make_channel_health(const FDP_CHANNEL_HEALTH& src)
+    {
+        auto ret            = fdp::channel_health{};
+        ret.pending_command = src.PendingCommand;
+        ret.shm_locked      = src.bShmLocked;
+        ret.request_pending = src.ClientToServer.bDataPresent;
+        ret.reply_pending   = src.ServerToClient.bDataPresent;
+        ret.parallel_busy   = src.ParallelBusyMask;
+        return ret;
+    }
+
+    bool on_channel_stall(void* ctx, const FDP_CHANNEL_HEALTH* health)
+    {
+        // dump the channel words first: this is what the operator reads
+        // when a session hangs, whatever the recovery callback decides
+        LOG(ERROR, "command 0x%02x stalled: lock:%d c2s[present:%d size:%u wakeup:%u] s2c[present:%d size:%u wakeup:%u] parallel[busy:%02x served:%02x]",
+            health->PendingCommand, health->bShmLocked,
+            health->ClientToServer.bDataPresent, health->ClientToServer.DataSize, health->ClientToServer.Wakeup,
+            health->ServerToClient.bDataPresent, health->ServerToClient.DataSize, health->ServerToClient.Wakeup,
+            health->ParallelBusyMask, health->ParallelServedMask);
+        const auto& on_stall = *static_cast<fdp::on_stall_fn*>(ctx);
+        if(!on_stall)
+            return false; // fail the command fast by default
+
+        return on_stall(make_channel_health(*health));
+    }
+}
+
 std::shared_ptr<fdp::shm> fdp::setup(const std::string& name)
 {
-    const auto ptr = FDP_OpenSHM(name.data());
+    // "replay://file" serves a recorded session without any vm &
+    // "record://name@file" attaches to name while capturing every call
+    constexpr auto replay_prefix = std::string_view{"replay://"};
+    constexpr auto record_prefix = std::string_view{"record://"};
+    if(name.rfind(replay_prefix.data(), 0) == 0)
+    {
+        auto session = fdp_replay::replay(name.substr(replay_prefix.size()));
+        if(!session)
+            return nullptr;
+
+        auto ret     = std::make_shared<fdp::shm>(nullptr);
+        ret->session = session;
+        return ret;
+    }
+
+    // "dump://file" serves a windows full-memory crash dump or a raw
+    // physical image read-only without any vm, see fdp_dump.hpp
+    constexpr auto dump_prefix = std::string_view{"dump://"};
+    if(name.rfind(dump_prefix.data(), 0) == 0)
+    {
+        auto dump = fdp_dump::open(name.substr(dump_prefix.size()));
+        if(!dump)
+            return nullptr;
+
+        auto ret  = std::make_shared<fdp::shm>(nullptr);
+        ret->dump = dump;
+        return ret;
+    }
+
+    // "snapshot://name" pauses the vm only long enough to copy its
+    // physical memory & cpu state into a host buffer, resumes it, then
+    // attaches to the frozen copy: analysis time never adds to guest
+    // pause time
+    constexpr auto snapshot_prefix = std::string_view{"snapshot://"};
+    auto snapshot                  = false;
+    auto target                    = name;
+    if(name.rfind(snapshot_prefix.data(), 0) == 0)
+    {
+        snapshot = true;
+        target   = name.substr(snapshot_prefix.size());
+    }
+
+    // "fork://name" asks the monitor for a copy-on-write snapshot of
+    // guest ram served as an offline image: the guest only pauses for
+    // the cow setup & the register capture, then analysis runs against
+    // the fork through the dump backend; monitors without fork support
+    // fall back to the snapshot full copy
+    constexpr auto fork_prefix = std::string_view{"fork://"};
+    auto fork_vm               = false;
+    if(name.rfind(fork_prefix.data(), 0) == 0)
+    {
+        fork_vm = true;
+        target  = name.substr(fork_prefix.size());
+    }
+
+    auto session = fdp_replay::SessionPtr{};
+    if(name.rfind(record_prefix.data(), 0) == 0)
+    {
+        const auto rest = name.substr(record_prefix.size());
+        const auto at   = rest.find('@');
+        if(at == std::string::npos)
+            return nullptr;
+
+        target  = rest.substr(0, at);
+        session = fdp_replay::record(rest.substr(at + 1));
+        if(!session)
+            return nullptr;
+    }
+
+    // "tcp://host:port" attaches to a remote FDP_ServeTCP relay instead of
+    // the local shared memory
+    const auto is_tcp = target.rfind("tcp://", 0) == 0;
+    const auto ptr    = is_tcp ? FDP_OpenTCP(target.data() + 6) : FDP_OpenSHM(target.data());
     if(!ptr)
         return nullptr;
 
@@ -39,13 +243,44 @@ std::shared_ptr<fdp::shm> fdp::setup(const std::string& name)
     if(!ok)
         return nullptr;
 
-    return std::make_shared<fdp::shm>(ptr);
+    if(snapshot || fork_vm)
+    {
+        auto dump = fork_vm ? take_fork(ptr) : nullptr;
+        if(!dump)
+            dump = take_snapshot(ptr);
+        FDP_Resume(ptr);
+        FDP_ExitSHM(ptr);
+        if(!dump)
+            return nullptr;
+
+        auto ret  = std::make_shared<fdp::shm>(nullptr);
+        ret->dump = dump;
+        return ret;
+    }
+
+    auto ret     = std::make_shared<fdp::shm>(ptr);
+    ret->session = session;
+    // FDP_COMMAND_TIMEOUT_MS=<ms> arms the per-command watchdog so a
+    // wedged monitor fails commands fast instead of hanging the session
+    if(const auto* timeout = getenv("FDP_COMMAND_TIMEOUT_MS"))
+        FDP_SetCommandTimeout(ptr, strtoull(timeout, nullptr, 0), &on_channel_stall, &ret->on_stall);
+    return ret;
 }
 
 namespace
 {
+    fdp_dump::Dump* get_dump(core::Core& core)
+    {
+        return core.shm_ ? core.shm_->dump.get() : nullptr;
+    }
+
     void check_vm(core::Core& core, const char* where)
     {
+        // every caller is one channel round trip, attributed to the
+        // outermost tagged module on this thread
+        counters::bump(counters::get().fdp_calls);
+        if(auto* chan = counters::current_channel())
+            counters::bump(chan->calls);
         if(!core.shm_)
             return;
 
@@ -54,6 +289,86 @@ namespace
 
         LOG(ERROR, "%s called on is_running vm", where);
     }
+
+    // record/replay plumbing: every wrapper funnels its request key &
+    // reply through these, see fdp_replay.hpp
+    enum op_e : uint8_t
+    {
+        op_state = 1,
+        op_state_changed,
+        op_next_event,
+        op_pause,
+        op_resume,
+        op_step_once,
+        op_single_step_many,
+        op_unset_bp,
+        op_set_bp,
+        op_set_bps,
+        op_unset_bps,
+        op_phys_size,
+        op_bp_filter,
+        op_bp_reg_filter,
+        op_read_phys,
+        op_write_phys,
+        op_read_virt,
+        op_read_virt_ranges,
+        op_write_virt,
+        op_v2p,
+        op_inject,
+        op_read_reg,
+        op_cpu_ctx,
+        op_read_msr,
+        op_write_reg,
+        op_write_msr,
+        op_save,
+        op_restore,
+        op_save_inc,
+        op_restore_inc,
+        op_bp_one_shot,
+        op_sample_phys,
+    };
+
+    void account_bytes(uint64_t size)
+    {
+        counters::get().fdp_bytes.fetch_add(size, std::memory_order_relaxed);
+        if(auto* chan = counters::current_channel())
+            chan->bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    struct key_buf
+    {
+        template <typename T>
+        void add(const T& arg)
+        {
+            const auto* src = reinterpret_cast<const uint8_t*>(&arg);
+            data.insert(data.end(), src, src + sizeof arg);
+        }
+
+        void add_bytes(const void* src, size_t size)
+        {
+            const auto* ptr = reinterpret_cast<const uint8_t*>(src);
+            data.insert(data.end(), ptr, ptr + size);
+        }
+
+        std::vector<uint8_t> data;
+    };
+
+    bool try_replay(core::Core& core, uint8_t op, const key_buf& key, void* reply, size_t rsize, bool& ok)
+    {
+        const auto& session = core.shm_->session;
+        if(!session || !fdp_replay::is_replay(*session))
+            return false;
+
+        ok = fdp_replay::fetch(*session, op, key.data.data(), key.data.size(), reply, rsize);
+        return true;
+    }
+
+    void try_record(core::Core& core, uint8_t op, const key_buf& key, const void* reply, size_t rsize, bool ok)
+    {
+        const auto& session = core.shm_->session;
+        if(session && !fdp_replay::is_replay(*session))
+            fdp_replay::save(*session, op, key.data.data(), key.data.size(), reply, rsize, ok);
+    }
 }
 
 void fdp::reset(core::Core& core)
@@ -62,8 +377,17 @@ void fdp::reset(core::Core& core)
 
     auto ptr = core.shm_->ptr;
     check_vm(core, "fdp::reset");
+    if(!ptr)
+        return;
+
+    // clear every breakpoint slot in one transaction
+    int bpids[FDP_MAX_BREAKPOINT];
     for(int bpid = 0; bpid < FDP_MAX_BREAKPOINT; bpid++)
-        FDP_UnsetBreakpoint(ptr, bpid);
+        bpids[bpid] = bpid;
+    const auto ok = FDP_UnsetBreakpointMultiple(ptr, bpids, FDP_MAX_BREAKPOINT);
+    if(!ok)
+        for(int bpid = 0; bpid < FDP_MAX_BREAKPOINT; bpid++)
+            FDP_UnsetBreakpoint(ptr, bpid);
 
     FDP_WriteRegister(ptr, 0, FDP_DR0_REGISTER, 0);
     FDP_WriteRegister(ptr, 0, FDP_DR1_REGISTER, 0);
@@ -75,9 +399,18 @@ void fdp::reset(core::Core& core)
 
 opt<FDP_State> fdp::state(core::Core& core)
 {
+    if(get_dump(core))
+        return FDP_State{FDP_STATE_PAUSED};
+
     // accept is_running FDP_GetState calls
-    auto value    = FDP_State{};
-    const auto ok = FDP_GetState(core.shm_->ptr, &value);
+    auto value = FDP_State{};
+    auto key   = key_buf{};
+    auto ok    = false;
+    if(try_replay(core, op_state, key, &value, sizeof value, ok))
+        return ok ? opt<FDP_State>{value} : std::nullopt;
+
+    ok = FDP_GetState(core.shm_->ptr, &value);
+    try_record(core, op_state, key, &value, sizeof value, ok);
     if(!ok)
         return {};
 
@@ -86,7 +419,13 @@ opt<FDP_State> fdp::state(core::Core& core)
 
 bool fdp::state_changed(core::Core& core)
 {
-    const auto ret = FDP_GetStateChanged(core.shm_->ptr);
+    auto ret = false;
+    auto key = key_buf{};
+    if(!try_replay(core, op_state_changed, key, nullptr, 0, ret))
+    {
+        ret = FDP_GetStateChanged(core.shm_->ptr);
+        try_record(core, op_state_changed, key, nullptr, 0, ret);
+    }
     if(!ret)
         return false;
 
@@ -98,16 +437,64 @@ bool fdp::state_changed(core::Core& core)
     return true;
 }
 
+bool fdp::next_event(core::Core& core, fdp::event& ev)
+{
+    auto raw = FDP_EVENT{};
+    auto key = key_buf{};
+    auto got = false;
+    if(!try_replay(core, op_next_event, key, &raw, sizeof raw, got))
+    {
+        got = FDP_PopStateEvents(core.shm_->ptr, &raw, 1) > 0;
+        try_record(core, op_next_event, key, &raw, sizeof raw, got);
+    }
+    if(!got)
+        return false;
+
+    const auto now        = std::chrono::steady_clock::now().time_since_epoch();
+    const auto wake_ns    = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    ev                    = event{raw.State, raw.CpuId, raw.Rip, raw.EventId, raw.TrapNs, raw.PublishNs, wake_ns};
+    core.shm_->is_running = !(raw.State & FDP_STATE_PAUSED);
+    // consume the legacy flag the server sets alongside events
+    if(core.shm_->ptr)
+        FDP_GetStateChanged(core.shm_->ptr);
+    return true;
+}
+
+bool fdp::has_pending_events(core::Core& core)
+{
+    const auto& session = core.shm_->session;
+    if(session && fdp_replay::is_replay(*session))
+        return fdp_replay::remaining(*session, op_next_event) > 0;
+
+    // non-consuming shared memory peeks, safe from a watcher thread
+    return FDP_PendingStateEvents(core.shm_->ptr) > 0 || FDP_PeekStateChanged(core.shm_->ptr);
+}
+
 bool fdp::pause(core::Core& core)
 {
-    const auto ret        = FDP_Pause(core.shm_->ptr);
+    if(get_dump(core))
+        return true; // a dump never runs
+
+    auto ret = false;
+    auto key = key_buf{};
+    if(!try_replay(core, op_pause, key, nullptr, 0, ret))
+    {
+        ret = FDP_Pause(core.shm_->ptr);
+        try_record(core, op_pause, key, nullptr, 0, ret);
+    }
     core.shm_->is_running = !ret;
     return ret;
 }
 
 bool fdp::resume(core::Core& core)
 {
-    const auto ret        = FDP_Resume(core.shm_->ptr);
+    auto ret = false;
+    auto key = key_buf{};
+    if(!try_replay(core, op_resume, key, nullptr, 0, ret))
+    {
+        ret = FDP_Resume(core.shm_->ptr);
+        try_record(core, op_resume, key, nullptr, 0, ret);
+    }
     core.shm_->is_running = ret;
     return ret;
 }
@@ -115,35 +502,236 @@ bool fdp::resume(core::Core& core)
 bool fdp::step_once(core::Core& core)
 {
     check_vm(core, "fdp::step_once");
-    return FDP_SingleStep(core.shm_->ptr, 0);
+    auto ret = false;
+    auto key = key_buf{};
+    if(try_replay(core, op_step_once, key, nullptr, 0, ret))
+        return ret;
+
+    ret = FDP_SingleStep(core.shm_->ptr, 0);
+    try_record(core, op_step_once, key, nullptr, 0, ret);
+    return ret;
+}
+
+opt<uint64_t> fdp::single_step_many(core::Core& core, uint64_t count, uint64_t stop_addr)
+{
+    check_vm(core, "fdp::single_step_many");
+    auto steps = uint64_t{};
+    auto key   = key_buf{};
+    key.add(count);
+    key.add(stop_addr);
+    auto ok = false;
+    if(try_replay(core, op_single_step_many, key, &steps, sizeof steps, ok))
+        return ok ? opt<uint64_t>{steps} : std::nullopt;
+
+    ok = FDP_SingleStepMultiple(core.shm_->ptr, 0, count, stop_addr, &steps);
+    try_record(core, op_single_step_many, key, &steps, sizeof steps, ok);
+    if(!ok)
+        return {};
+
+    return steps;
 }
 
 bool fdp::unset_breakpoint(core::Core& core, int bpid)
 {
     check_vm(core, "fdp::unset_breakpoint");
-    return FDP_UnsetBreakpoint(core.shm_->ptr, bpid);
+    auto ret = false;
+    auto key = key_buf{};
+    key.add(bpid);
+    if(try_replay(core, op_unset_bp, key, nullptr, 0, ret))
+        return ret;
+
+    ret = FDP_UnsetBreakpoint(core.shm_->ptr, bpid);
+    try_record(core, op_unset_bp, key, nullptr, 0, ret);
+    return ret;
 }
 
 int fdp::set_breakpoint(core::Core& core, FDP_BreakpointType type, int bpid, FDP_Access access, FDP_AddressType ptrtype, uint64_t ptr, uint64_t len, uint64_t cr3)
 {
     check_vm(core, "fdp::set_breakpoint");
-    return FDP_SetBreakpoint(core.shm_->ptr, 0, type, bpid, access, ptrtype, ptr, len, cr3);
+    auto key = key_buf{};
+    key.add(type);
+    key.add(bpid);
+    key.add(access);
+    key.add(ptrtype);
+    key.add(ptr);
+    key.add(len);
+    key.add(cr3);
+    auto got = int{-1};
+    auto ok  = false;
+    if(try_replay(core, op_set_bp, key, &got, sizeof got, ok))
+        return ok ? got : -1;
+
+    got = FDP_SetBreakpoint(core.shm_->ptr, 0, type, bpid, access, ptrtype, ptr, len, cr3);
+    try_record(core, op_set_bp, key, &got, sizeof got, got >= 0);
+    return got;
+}
+
+bool fdp::set_breakpoints(core::Core& core, const fdp::breakpoint_desc* descs, size_t count, int* bpids)
+{
+    check_vm(core, "fdp::set_breakpoints");
+    auto key = key_buf{};
+    key.add_bytes(descs, count * sizeof *descs);
+    auto ok = false;
+    if(try_replay(core, op_set_bps, key, bpids, count * sizeof *bpids, ok))
+        return ok;
+
+    auto fdp_descs = std::vector<FDP_BREAKPOINT_DESC>(count);
+    for(size_t i = 0; i < count; ++i)
+        fdp_descs[i] = FDP_BREAKPOINT_DESC{descs[i].type, 0, descs[i].access, descs[i].ptrtype, descs[i].ptr, descs[i].len, descs[i].cr3};
+    ok = FDP_SetBreakpointMultiple(core.shm_->ptr, 0, fdp_descs.data(), static_cast<uint32_t>(count), bpids);
+    try_record(core, op_set_bps, key, bpids, count * sizeof *bpids, ok);
+    return ok;
+}
+
+bool fdp::unset_breakpoints(core::Core& core, const int* bpids, size_t count)
+{
+    check_vm(core, "fdp::unset_breakpoints");
+    auto key = key_buf{};
+    key.add_bytes(bpids, count * sizeof *bpids);
+    auto ok = false;
+    if(try_replay(core, op_unset_bps, key, nullptr, 0, ok))
+        return ok;
+
+    ok = FDP_UnsetBreakpointMultiple(core.shm_->ptr, bpids, static_cast<uint32_t>(count));
+    try_record(core, op_unset_bps, key, nullptr, 0, ok);
+    return ok;
+}
+
+opt<uint64_t> fdp::physical_memory_size(core::Core& core)
+{
+    if(auto* dump = get_dump(core))
+        return fdp_dump::physical_memory_size(*dump);
+
+    check_vm(core, "fdp::physical_memory_size");
+    auto size = uint64_t{};
+    auto key  = key_buf{};
+    auto ok   = false;
+    if(try_replay(core, op_phys_size, key, &size, sizeof size, ok))
+        return ok ? opt<uint64_t>{size} : std::nullopt;
+
+    ok = FDP_GetPhysicalMemorySize(core.shm_->ptr, &size);
+    try_record(core, op_phys_size, key, &size, sizeof size, ok);
+    if(!ok)
+        return {};
+
+    return size;
+}
+
+bool fdp::set_breakpoint_filter(core::Core& core, int bpid, uint64_t cr3, uint64_t thread_addr, uint64_t thread_value)
+{
+    check_vm(core, "fdp::set_breakpoint_filter");
+    auto key = key_buf{};
+    key.add(bpid);
+    key.add(cr3);
+    key.add(thread_addr);
+    key.add(thread_value);
+    auto ok = false;
+    if(try_replay(core, op_bp_filter, key, nullptr, 0, ok))
+        return ok;
+
+    ok = FDP_SetBreakpointFilter(core.shm_->ptr, bpid, cr3, thread_addr, thread_value);
+    try_record(core, op_bp_filter, key, nullptr, 0, ok);
+    return ok;
+}
+
+bool fdp::set_breakpoint_one_shot(core::Core& core, int bpid, bool enable)
+{
+    check_vm(core, "fdp::set_breakpoint_one_shot");
+    auto key = key_buf{};
+    key.add(bpid);
+    key.add(enable);
+    auto ok = false;
+    if(try_replay(core, op_bp_one_shot, key, nullptr, 0, ok))
+        return ok;
+
+    ok = FDP_SetBreakpointOneShot(core.shm_->ptr, bpid, enable);
+    try_record(core, op_bp_one_shot, key, nullptr, 0, ok);
+    return ok;
+}
+
+bool fdp::set_breakpoint_register_filter(core::Core& core, int bpid, FDP_Register reg, const fdp::register_range* ranges, size_t count)
+{
+    check_vm(core, "fdp::set_breakpoint_register_filter");
+    auto key = key_buf{};
+    key.add(bpid);
+    key.add(reg);
+    key.add_bytes(ranges, count * sizeof *ranges);
+    auto ok = false;
+    if(try_replay(core, op_bp_reg_filter, key, nullptr, 0, ok))
+        return ok;
+
+    static_assert(sizeof(fdp::register_range) == sizeof(FDP_REGISTER_RANGE), "abi mismatch");
+    ok = FDP_SetBreakpointRegisterFilter(core.shm_->ptr, bpid, reg, reinterpret_cast<const FDP_REGISTER_RANGE*>(ranges), static_cast<uint32_t>(count));
+    try_record(core, op_bp_reg_filter, key, nullptr, 0, ok);
+    return ok;
 }
 
 bool fdp::read_physical(core::Core& core, void* vdst, phy_t src, size_t size)
 {
+    account_bytes(size);
+    if(auto* dump = get_dump(core))
+        return fdp_dump::read_physical(*dump, vdst, src.val, size);
+
     check_vm(core, "fdp::read_physical");
-    const auto dst   = reinterpret_cast<uint8_t*>(vdst);
-    const auto usize = static_cast<uint32_t>(size);
-    return FDP_ReadPhysicalMemory(core.shm_->ptr, dst, usize, src.val);
+    const auto dst = reinterpret_cast<uint8_t*>(vdst);
+    auto       key = key_buf{};
+    key.add(src.val);
+    key.add(size);
+    auto ok = false;
+    if(try_replay(core, op_read_phys, key, dst, size, ok))
+        return ok;
+
+    if(size > FDP_MAX_DATA_SIZE)
+        ok = FDP_ReadPhysicalMemoryStream(core.shm_->ptr, dst, size, src.val);
+    else
+        ok = FDP_ReadPhysicalMemory(core.shm_->ptr, dst, static_cast<uint32_t>(size), src.val);
+    try_record(core, op_read_phys, key, dst, size, ok);
+    return ok;
+}
+
+// gauge sampling reads while the guest runs by design: the request is
+// served from the shared RAM window or a parallel canal without
+// stopping any vcpu & the caller tolerates torn values
+bool fdp::sample_physical(core::Core& core, void* vdst, phy_t src, size_t size)
+{
+    account_bytes(size);
+    if(auto* dump = get_dump(core))
+        return fdp_dump::read_physical(*dump, vdst, src.val, size);
+
+    counters::bump(counters::get().fdp_calls);
+    if(auto* chan = counters::current_channel())
+        counters::bump(chan->calls);
+    if(size > FDP_MAX_DATA_SIZE)
+        return false;
+
+    const auto dst = reinterpret_cast<uint8_t*>(vdst);
+    auto       key = key_buf{};
+    key.add(src.val);
+    key.add(size);
+    auto ok = false;
+    if(try_replay(core, op_sample_phys, key, dst, size, ok))
+        return ok;
+
+    ok = FDP_ReadPhysicalMemory(core.shm_->ptr, dst, static_cast<uint32_t>(size), src.val);
+    try_record(core, op_sample_phys, key, dst, size, ok);
+    return ok;
 }
 
 bool fdp::write_physical(core::Core& core, phy_t dst, const void* vsrc, size_t size)
 {
     check_vm(core, "fdp::write_physical");
-    const auto src   = reinterpret_cast<uint8_t*>(const_cast<void*>(vsrc));
-    const auto usize = static_cast<uint32_t>(size);
-    return FDP_WritePhysicalMemory(core.shm_->ptr, src, usize, dst.val);
+    account_bytes(size);
+    const auto src = reinterpret_cast<uint8_t*>(const_cast<void*>(vsrc));
+    auto       key = key_buf{};
+    key.add(dst.val);
+    key.add(size);
+    auto ok = false;
+    if(try_replay(core, op_write_phys, key, nullptr, 0, ok))
+        return ok;
+
+    ok = FDP_WritePhysicalMemory(core.shm_->ptr, src, static_cast<uint32_t>(size), dst.val);
+    try_record(core, op_write_phys, key, nullptr, 0, ok);
+    return ok;
 }
 
 namespace
@@ -164,34 +752,102 @@ namespace
 
 bool fdp::read_virtual(core::Core& core, void* vdst, uint64_t src, dtb_t dtb, size_t size)
 {
+    account_bytes(size);
+    if(auto* dump = get_dump(core))
+        return fdp_dump::read_virtual(*dump, vdst, src, dtb.val, size);
+
     const auto dst   = reinterpret_cast<uint8_t*>(vdst);
     const auto usize = static_cast<uint32_t>(size);
-    return switch_dtb(core, dtb, [&]
+    auto       key   = key_buf{};
+    key.add(src);
+    key.add(dtb.val);
+    key.add(size);
+    auto ok = false;
+    if(try_replay(core, op_read_virt, key, dst, size, ok))
+        return ok;
+
+    ok = switch_dtb(core, dtb, [&]
     {
         check_vm(core, "fdp::read_virtual");
         return FDP_ReadVirtualMemory(core.shm_->ptr, 0, dst, usize, src);
     });
+    try_record(core, op_read_virt, key, dst, size, ok);
+    return ok;
+}
+
+bool fdp::read_virtual_ranges(core::Core& core, void* vdst, const span_t* ranges, size_t count, dtb_t dtb)
+{
+    auto total = size_t{};
+    auto key   = key_buf{};
+    key.add(dtb.val);
+    for(size_t i = 0; i < count; ++i)
+    {
+        key.add(ranges[i].addr);
+        key.add(ranges[i].size);
+        total += ranges[i].size;
+    }
+    account_bytes(total);
+    const auto dst = reinterpret_cast<uint8_t*>(vdst);
+    auto       ok  = false;
+    if(try_replay(core, op_read_virt_ranges, key, dst, total, ok))
+        return ok;
+
+    auto fdp_ranges = std::vector<FDP_VIRTUAL_RANGE>(count);
+    for(size_t i = 0; i < count; ++i)
+        fdp_ranges[i] = FDP_VIRTUAL_RANGE{ranges[i].addr, static_cast<uint32_t>(ranges[i].size)};
+    ok = switch_dtb(core, dtb, [&]
+    {
+        check_vm(core, "fdp::read_virtual_ranges");
+        return FDP_ReadVirtualMemoryMultiple(core.shm_->ptr, 0, fdp_ranges.data(), static_cast<uint32_t>(count), dst);
+    });
+    try_record(core, op_read_virt_ranges, key, dst, total, ok);
+    return ok;
 }
 
 bool fdp::write_virtual(core::Core& core, uint64_t dst, dtb_t dtb, const void* vsrc, size_t size)
 {
+    account_bytes(size);
     const auto src   = reinterpret_cast<uint8_t*>(const_cast<void*>(vsrc));
     const auto usize = static_cast<uint32_t>(size);
-    return switch_dtb(core, dtb, [&]
+    auto       key   = key_buf{};
+    key.add(dst);
+    key.add(dtb.val);
+    key.add(size);
+    auto ok = false;
+    if(try_replay(core, op_write_virt, key, nullptr, 0, ok))
+        return ok;
+
+    ok = switch_dtb(core, dtb, [&]
     {
         check_vm(core, "fdp::write_virtual");
         return FDP_WriteVirtualMemory(core.shm_->ptr, 0, src, usize, dst);
     });
+    try_record(core, op_write_virt, key, nullptr, 0, ok);
+    return ok;
 }
 
 opt<phy_t> fdp::virtual_to_physical(core::Core& core, dtb_t dtb, uint64_t ptr)
 {
-    uint64_t phy  = 0;
-    const auto ok = switch_dtb(core, dtb, [&]
+    if(auto* dump = get_dump(core))
+    {
+        const auto walked = fdp_dump::virtual_to_physical(*dump, dtb.val, ptr);
+        return walked ? opt<phy_t>{phy_t{*walked}} : std::nullopt;
+    }
+
+    uint64_t phy = 0;
+    auto     key = key_buf{};
+    key.add(dtb.val);
+    key.add(ptr);
+    auto ok = false;
+    if(try_replay(core, op_v2p, key, &phy, sizeof phy, ok))
+        return ok ? opt<phy_t>{phy_t{phy}} : std::nullopt;
+
+    ok = switch_dtb(core, dtb, [&]
     {
         check_vm(core, "fdp::virtual_to_physical");
         return FDP_VirtualToPhysical(core.shm_->ptr, 0, ptr, &phy);
     });
+    try_record(core, op_v2p, key, &phy, sizeof phy, ok);
     if(!ok)
         return {};
 
@@ -201,7 +857,17 @@ opt<phy_t> fdp::virtual_to_physical(core::Core& core, dtb_t dtb, uint64_t ptr)
 bool fdp::inject_interrupt(core::Core& core, uint32_t code, uint32_t error, uint64_t cr2)
 {
     check_vm(core, "fdp::inject_interrupt");
-    return FDP_InjectInterrupt(core.shm_->ptr, 0, code, error, cr2);
+    auto key = key_buf{};
+    key.add(code);
+    key.add(error);
+    key.add(cr2);
+    auto ok = false;
+    if(try_replay(core, op_inject, key, nullptr, 0, ok))
+        return ok;
+
+    ok = FDP_InjectInterrupt(core.shm_->ptr, 0, code, error, cr2);
+    try_record(core, op_inject, key, nullptr, 0, ok);
+    return ok;
 }
 
 namespace
@@ -237,15 +903,118 @@ namespace
 
 opt<uint64_t> fdp::read_register(core::Core& core, reg_e reg)
 {
+    if(auto* dump = get_dump(core))
+        return fdp_dump::read_register(*dump, reg);
+
     check_vm(core, "fdp::read_register");
-    auto value    = uint64_t{};
-    const auto ok = FDP_ReadRegister(core.shm_->ptr, 0, cast(reg), &value);
+    auto value = uint64_t{};
+    auto key   = key_buf{};
+    key.add(reg);
+    auto ok = false;
+    if(try_replay(core, op_read_reg, key, &value, sizeof value, ok))
+        return ok ? opt<uint64_t>{value} : std::nullopt;
+
+    ok = FDP_ReadRegister(core.shm_->ptr, 0, cast(reg), &value);
+    try_record(core, op_read_reg, key, &value, sizeof value, ok);
     if(!ok)
         return {};
 
     return value;
 }
 
+opt<fdp::cpu_context> fdp::read_cpu_context(core::Core& core)
+{
+    if(auto* dump = get_dump(core))
+    {
+        const auto rip = fdp_dump::read_register(*dump, reg_e::rip);
+        const auto cr3 = fdp_dump::read_register(*dump, reg_e::cr3);
+        if(!rip || !cr3)
+            return {};
+
+        auto ctx = cpu_context{};
+        ctx.rip  = *rip;
+        ctx.cr3  = *cr3;
+        const auto fill = [&](uint64_t& dst, reg_e reg)
+        {
+            const auto value = fdp_dump::read_register(*dump, reg);
+            dst              = value ? *value : 0;
+        };
+        fill(ctx.rax, reg_e::rax);
+        fill(ctx.rcx, reg_e::rcx);
+        fill(ctx.rdx, reg_e::rdx);
+        fill(ctx.rbx, reg_e::rbx);
+        fill(ctx.rsp, reg_e::rsp);
+        fill(ctx.rbp, reg_e::rbp);
+        fill(ctx.rsi, reg_e::rsi);
+        fill(ctx.rdi, reg_e::rdi);
+        fill(ctx.r8, reg_e::r8);
+        fill(ctx.r9, reg_e::r9);
+        fill(ctx.r10, reg_e::r10);
+        fill(ctx.r11, reg_e::r11);
+        fill(ctx.r12, reg_e::r12);
+        fill(ctx.r13, reg_e::r13);
+        fill(ctx.r14, reg_e::r14);
+        fill(ctx.r15, reg_e::r15);
+        fill(ctx.cs, reg_e::cs);
+        const auto fill_msr = [&](uint64_t& dst, msr_e msr)
+        {
+            const auto value = fdp_dump::read_msr(*dump, msr);
+            dst              = value ? *value : 0;
+        };
+        fill_msr(ctx.msr_lstar, msr_e::lstar);
+        fill_msr(ctx.msr_gs_base, msr_e::gs_base);
+        fill_msr(ctx.msr_kernel_gs_base, msr_e::kernel_gs_base);
+        return ctx;
+    }
+
+    check_vm(core, "fdp::read_cpu_context");
+    auto snapshot = FDP_CPU_CTX_SNAPSHOT{};
+    auto key      = key_buf{};
+    auto ok       = false;
+    if(!try_replay(core, op_cpu_ctx, key, &snapshot, sizeof snapshot, ok))
+    {
+        ok = FDP_GetCpuContext(core.shm_->ptr, 0, &snapshot);
+        try_record(core, op_cpu_ctx, key, &snapshot, sizeof snapshot, ok);
+    }
+    if(!ok)
+        return {};
+
+    auto ctx               = cpu_context{};
+    ctx.rip                = snapshot.Ctx.rip;
+    ctx.rax                = snapshot.Ctx.rax;
+    ctx.rcx                = snapshot.Ctx.rcx;
+    ctx.rdx                = snapshot.Ctx.rdx;
+    ctx.rbx                = snapshot.Ctx.rbx;
+    ctx.rsp                = snapshot.Ctx.rsp;
+    ctx.rbp                = snapshot.Ctx.rbp;
+    ctx.rsi                = snapshot.Ctx.rsi;
+    ctx.rdi                = snapshot.Ctx.rdi;
+    ctx.r8                 = snapshot.Ctx.r8;
+    ctx.r9                 = snapshot.Ctx.r9;
+    ctx.r10                = snapshot.Ctx.r10;
+    ctx.r11                = snapshot.Ctx.r11;
+    ctx.r12                = snapshot.Ctx.r12;
+    ctx.r13                = snapshot.Ctx.r13;
+    ctx.r14                = snapshot.Ctx.r14;
+    ctx.r15                = snapshot.Ctx.r15;
+    ctx.es                 = snapshot.Ctx.es;
+    ctx.cs                 = snapshot.Ctx.cs;
+    ctx.ss                 = snapshot.Ctx.ss;
+    ctx.ds                 = snapshot.Ctx.ds;
+    ctx.fs                 = snapshot.Ctx.fs;
+    ctx.gs                 = snapshot.Ctx.gs;
+    ctx.rflags             = snapshot.Ctx.rflags;
+    ctx.cr0                = snapshot.Ctx.cr0;
+    ctx.cr2                = snapshot.Ctx.cr2;
+    ctx.cr3                = snapshot.Ctx.cr3;
+    ctx.cr4                = snapshot.Ctx.cr4;
+    ctx.msr_lstar          = snapshot.MsrLstar;
+    ctx.msr_gs_base        = snapshot.MsrGsBase;
+    ctx.msr_kernel_gs_base = snapshot.MsrKernelGsBase;
+    ctx.msr_tsc            = snapshot.MsrTsc;
+    return ctx;
+}
+
 namespace
 {
     uint64_t cast(msr_e reg)
@@ -256,6 +1025,7 @@ namespace
             case msr_e::fs_base:        return 0xC0000100;
             case msr_e::gs_base:        return 0xC0000101;
             case msr_e::kernel_gs_base: return 0xC0000102;
+            case msr_e::tsc:            return 0x00000010;
         }
         return ~0ULL;
     }
@@ -263,9 +1033,19 @@ namespace
 
 opt<uint64_t> fdp::read_msr_register(core::Core& core, msr_e msr)
 {
+    if(auto* dump = get_dump(core))
+        return fdp_dump::read_msr(*dump, msr);
+
     check_vm(core, "fdp::read_msr_register");
-    auto value    = uint64_t{};
-    const auto ok = FDP_ReadMsr(core.shm_->ptr, 0, cast(msr), &value);
+    auto value = uint64_t{};
+    auto key   = key_buf{};
+    key.add(msr);
+    auto ok = false;
+    if(try_replay(core, op_read_msr, key, &value, sizeof value, ok))
+        return ok ? opt<uint64_t>{value} : std::nullopt;
+
+    ok = FDP_ReadMsr(core.shm_->ptr, 0, cast(msr), &value);
+    try_record(core, op_read_msr, key, &value, sizeof value, ok);
     if(!ok)
         return {};
 
@@ -275,23 +1055,105 @@ opt<uint64_t> fdp::read_msr_register(core::Core& core, msr_e msr)
 bool fdp::write_register(core::Core& core, reg_e reg, uint64_t value)
 {
     check_vm(core, "fdp::write_register");
-    return FDP_WriteRegister(core.shm_->ptr, 0, cast(reg), value);
+    auto key = key_buf{};
+    key.add(reg);
+    key.add(value);
+    auto ok = false;
+    if(try_replay(core, op_write_reg, key, nullptr, 0, ok))
+        return ok;
+
+    ok = FDP_WriteRegister(core.shm_->ptr, 0, cast(reg), value);
+    try_record(core, op_write_reg, key, nullptr, 0, ok);
+    return ok;
 }
 
 bool fdp::write_msr_register(core::Core& core, msr_e msr, uint64_t value)
 {
     check_vm(core, "fdp::write_msr_register");
-    return FDP_WriteMsr(core.shm_->ptr, 0, cast(msr), value);
+    auto key = key_buf{};
+    key.add(msr);
+    key.add(value);
+    auto ok = false;
+    if(try_replay(core, op_write_msr, key, nullptr, 0, ok))
+        return ok;
+
+    ok = FDP_WriteMsr(core.shm_->ptr, 0, cast(msr), value);
+    try_record(core, op_write_msr, key, nullptr, 0, ok);
+    return ok;
 }
 
 bool fdp::save(core::Core& core)
 {
     check_vm(core, "fdp::save");
-    return FDP_Save(core.shm_->ptr);
+    auto key = key_buf{};
+    auto ok  = false;
+    if(try_replay(core, op_save, key, nullptr, 0, ok))
+        return ok;
+
+    ok = FDP_Save(core.shm_->ptr);
+    try_record(core, op_save, key, nullptr, 0, ok);
+    return ok;
 }
 
 bool fdp::restore(core::Core& core)
 {
     check_vm(core, "fdp::restore");
-    return FDP_Restore(core.shm_->ptr);
+    auto key = key_buf{};
+    auto ok  = false;
+    if(try_replay(core, op_restore, key, nullptr, 0, ok))
+        return ok;
+
+    ok = FDP_Restore(core.shm_->ptr);
+    try_record(core, op_restore, key, nullptr, 0, ok);
+    return ok;
+}
+
+bool fdp::save_incremental(core::Core& core)
+{
+    check_vm(core, "fdp::save_incremental");
+    auto key = key_buf{};
+    auto ok  = false;
+    if(try_replay(core, op_save_inc, key, nullptr, 0, ok))
+        return ok;
+
+    ok = FDP_SaveIncremental(core.shm_->ptr);
+    try_record(core, op_save_inc, key, nullptr, 0, ok);
+    return ok;
+}
+
+bool fdp::restore_incremental(core::Core& core)
+{
+    check_vm(core, "fdp::restore_incremental");
+    auto key = key_buf{};
+    auto ok  = false;
+    if(try_replay(core, op_restore_inc, key, nullptr, 0, ok))
+        return ok;
+
+    ok = FDP_RestoreIncremental(core.shm_->ptr);
+    try_record(core, op_restore_inc, key, nullptr, 0, ok);
+    return ok;
+}
+
+bool fdp::set_watchdog(core::Core& core, uint64_t timeout_ms, const on_stall_fn& on_stall)
+{
+    const auto ptr = core.shm_ ? core.shm_->ptr : nullptr;
+    if(!ptr)
+        return FAIL(false, "no live vm channel to watch");
+
+    core.shm_->on_stall = on_stall;
+    return FDP_SetCommandTimeout(ptr, timeout_ms, &on_channel_stall, &core.shm_->on_stall);
+}
+
+opt<fdp::channel_health> fdp::channel_state(core::Core& core)
+{
+    const auto ptr = core.shm_ ? core.shm_->ptr : nullptr;
+    if(!ptr)
+        return {};
+
+    auto health   = FDP_CHANNEL_HEALTH{};
+    const auto ok = FDP_GetChannelHealth(ptr, &health);
+    if(!ok)
+        return {};
+
+    return make_channel_health(health);
 }
@@ -7,28 +7,98 @@ extern "C"
 #include <FDP_enum.h>
 }
 
+#include <functional>
+
 namespace core { struct Core; }
 
 namespace fdp
 {
+    struct event
+    {
+        uint16_t state;  // FDP_State flags
+        uint32_t cpu_id;
+        uint64_t rip;
+        // latency budget stamps, monotonic-clock nanoseconds; the
+        // first three come from the server, wake_ns is stamped when
+        // the event is popped on our side, see state latency_budget
+        uint64_t event_id;
+        uint64_t trap_ns;
+        uint64_t publish_ns;
+        uint64_t wake_ns;
+    };
+
+    struct cpu_context
+    {
+        uint64_t rip, rax, rcx, rdx, rbx, rsp, rbp, rsi, rdi;
+        uint64_t r8, r9, r10, r11, r12, r13, r14, r15;
+        uint64_t es, cs, ss, ds, fs, gs;
+        uint64_t rflags, cr0, cr2, cr3, cr4;
+        uint64_t msr_lstar, msr_gs_base, msr_kernel_gs_base, msr_tsc;
+    };
+
     void            reset               (core::Core& core);
     opt<FDP_State>  state               (core::Core& core);
     bool            state_changed       (core::Core& core);
+    bool            next_event          (core::Core& core, event& ev);
+    bool            has_pending_events  (core::Core& core);
     bool            pause               (core::Core& core);
     bool            resume              (core::Core& core);
     bool            step_once           (core::Core& core);
+    opt<uint64_t>   single_step_many    (core::Core& core, uint64_t count, uint64_t stop_addr);
     bool            unset_breakpoint    (core::Core& core, int bpid);
     int             set_breakpoint      (core::Core& core, FDP_BreakpointType type, int bpid, FDP_Access access, FDP_AddressType ptrtype, uint64_t ptr, uint64_t len, uint64_t cr3);
+
+    struct breakpoint_desc
+    {
+        FDP_BreakpointType type;
+        FDP_Access         access;
+        FDP_AddressType    ptrtype;
+        uint64_t           ptr;
+        uint64_t           len;
+        uint64_t           cr3;
+    };
+    bool            set_breakpoints     (core::Core& core, const breakpoint_desc* descs, size_t count, int* bpids);
+    bool            set_breakpoint_filter(core::Core& core, int bpid, uint64_t cr3, uint64_t thread_addr, uint64_t thread_value);
+
+    struct register_range
+    {
+        uint64_t minimum;
+        uint64_t maximum; // inclusive
+    };
+    bool            set_breakpoint_register_filter(core::Core& core, int bpid, FDP_Register reg, const register_range* ranges, size_t count);
+    bool            set_breakpoint_one_shot(core::Core& core, int bpid, bool enable);
+    bool            unset_breakpoints   (core::Core& core, const int* bpids, size_t count);
+    opt<uint64_t>   physical_memory_size(core::Core& core);
+    bool            sample_physical     (core::Core& core, void* dst, phy_t src, size_t size);
     bool            read_physical       (core::Core& core, void* dst, phy_t src, size_t size);
     bool            read_virtual        (core::Core& core, void* dst, uint64_t src, dtb_t dtb, size_t size);
+    bool            read_virtual_ranges (core::Core& core, void* dst, const span_t* ranges, size_t count, dtb_t dtb);
     bool            write_physical      (core::Core& core, phy_t dst, const void* src, size_t size);
     bool            write_virtual       (core::Core& core, uint64_t dst, dtb_t dtb, const void* src, size_t size);
     opt<phy_t>      virtual_to_physical (core::Core& core, dtb_t dtb, uint64_t ptr);
     bool            inject_interrupt    (core::Core& core, uint32_t code, uint32_t error, uint64_t cr2);
     opt<uint64_t>   read_register       (core::Core& core, reg_e reg);
+    opt<cpu_context> read_cpu_context    (core::Core& core);
     opt<uint64_t>   read_msr_register   (core::Core& core, msr_e msr);
     bool            write_register      (core::Core& core, reg_e reg, uint64_t value);
     bool            write_msr_register  (core::Core& core, msr_e msr, uint64_t value);
     bool            save                (core::Core& core);
+    bool            save_incremental    (core::Core& core);
     bool            restore             (core::Core& core);
+    bool            restore_incremental (core::Core& core);
+
+    // stalled channel watchdog: commands fail after timeout_ms instead
+    // of hanging forever when the monitor wedges; on_stall may attempt
+    // recovery & return true to grant the command one more deadline
+    struct channel_health
+    {
+        uint8_t pending_command; // type byte of the command in flight, 0 when idle
+        bool    shm_locked;      // global command lock held
+        bool    request_pending; // client-to-server payload not yet consumed
+        bool    reply_pending;   // server-to-client payload not yet collected
+        uint8_t parallel_busy;   // bitmask of claimed parallel canals
+    };
+    using on_stall_fn = std::function<bool(const channel_health&)>;
+    bool                set_watchdog (core::Core& core, uint64_t timeout_ms, const on_stall_fn& on_stall);
+    opt<channel_health> channel_state(core::Core& core);
 } // namespace fdp
@@ -0,0 +1,365 @@
+#include "fdp_dump.hpp"
+
+#define FDP_MODULE "fdp_dump"
+#include "log.hpp"
+#include "utils/file.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    // _DMP_HEADER64 field offsets, the layout is frozen since win2003
+    constexpr size_t off_valid_dump       = 0x004;
+    constexpr size_t off_dtb              = 0x010;
+    constexpr size_t off_modules          = 0x020; // PsLoadedModuleList
+    constexpr size_t off_num_runs         = 0x088; // _PHYSICAL_MEMORY_DESCRIPTOR64
+    constexpr size_t off_runs             = 0x098;
+    constexpr size_t off_context          = 0x348; // amd64 CONTEXT of the crashing cpu
+    constexpr size_t off_dump_type        = 0xF98;
+    constexpr size_t header_size          = 0x2000;
+    constexpr size_t max_runs             = (off_context - off_runs) / 16;
+    constexpr uint32_t dump_type_full     = 1;
+
+    // amd64 CONTEXT field offsets
+    constexpr size_t ctx_seg_cs           = 0x038;
+    constexpr size_t ctx_eflags           = 0x044;
+    constexpr size_t ctx_rax              = 0x078; // rax..r15 are contiguous
+    constexpr size_t ctx_rip              = 0x0F8;
+
+    constexpr uint64_t pfn_mask           = 0x000FFFFFFFFFF000;
+    constexpr uint64_t page_present       = 1ULL << 0;
+    constexpr uint64_t page_large         = 1ULL << 7;
+
+    struct run_t
+    {
+        uint64_t base;   // physical address, bytes
+        uint64_t size;   // bytes
+        uint64_t offset; // file offset of the first byte
+    };
+}
+
+struct fdp_dump::Dump
+{
+    ~Dump()
+    {
+        file::unmap(map);
+    }
+
+    file::Map            map;
+    std::vector<uint8_t> buffer; // frozen live snapshots own their copy
+    const uint8_t*       data = nullptr;
+    std::vector<run_t>   runs;
+    uint64_t           phy_size     = 0;
+    uint64_t           dtb          = 0;
+    uint64_t           modules      = 0; // kernel-space anchor, see read_msr
+    uint64_t           regs[16]     = {};
+    uint64_t           rip          = 0;
+    uint64_t           rflags       = 0;
+    uint64_t           seg_cs       = 0;
+    bool               has_context  = false;
+    bool               kpcr_scanned = false;
+    uint64_t           kpcr         = 0;
+};
+
+namespace
+{
+    template <typename T>
+    T read_at(const fdp_dump::Dump& d, size_t offset)
+    {
+        auto value = T{};
+        memcpy(&value, d.data + offset, sizeof value);
+        return value;
+    }
+
+    bool parse_full_dump(fdp_dump::Dump& d)
+    {
+        if(read_at<uint32_t>(d, off_dump_type) != dump_type_full)
+            return FAIL(false, "unsupported dump type, only full-memory dumps carry raw pages");
+
+        d.dtb     = read_at<uint64_t>(d, off_dtb);
+        d.modules = read_at<uint64_t>(d, off_modules);
+
+        const auto num_runs = read_at<uint32_t>(d, off_num_runs);
+        if(!num_runs || num_runs > max_runs)
+            return FAIL(false, "invalid physical memory descriptor, %u runs", num_runs);
+
+        // runs are stored in pages & laid out back-to-back after the header
+        auto offset = uint64_t{header_size};
+        for(uint32_t i = 0; i < num_runs; ++i)
+        {
+            auto run   = run_t{};
+            run.base   = read_at<uint64_t>(d, off_runs + i * 16) * PAGE_SIZE;
+            run.size   = read_at<uint64_t>(d, off_runs + i * 16 + 8) * PAGE_SIZE;
+            run.offset = offset;
+            if(run.offset + run.size > d.map.size)
+                return FAIL(false, "truncated dump, run %u ends past the file", i);
+
+            offset += run.size;
+            d.phy_size = run.base + run.size;
+            d.runs.emplace_back(run);
+        }
+
+        for(size_t i = 0; i < 16; ++i)
+            d.regs[i] = read_at<uint64_t>(d, off_context + ctx_rax + i * 8);
+        d.rip         = read_at<uint64_t>(d, off_context + ctx_rip);
+        d.rflags      = read_at<uint32_t>(d, off_context + ctx_eflags);
+        d.seg_cs      = read_at<uint16_t>(d, off_context + ctx_seg_cs);
+        d.has_context = true;
+        return true;
+    }
+
+    // raw images carry no header: the file is the physical memory &
+    // registers are unavailable, so os detection fails gracefully and
+    // only physical analysis applies
+    void parse_raw_image(fdp_dump::Dump& d)
+    {
+        auto run = run_t{};
+        run.size = (d.buffer.empty() ? d.map.size : d.buffer.size()) & ~uint64_t{PAGE_SIZE - 1};
+        d.runs.emplace_back(run);
+        d.phy_size = run.size;
+    }
+
+    const run_t* find_run(const fdp_dump::Dump& d, uint64_t phy)
+    {
+        const auto it = std::upper_bound(d.runs.begin(), d.runs.end(), phy, [](uint64_t lhs, const run_t& rhs)
+        {
+            return lhs < rhs.base;
+        });
+        if(it == d.runs.begin())
+            return nullptr;
+
+        const auto& run = *(it - 1);
+        return phy < run.base + run.size ? &run : nullptr;
+    }
+
+    opt<uint64_t> read_qword(fdp_dump::Dump& d, uint64_t phy)
+    {
+        auto value = uint64_t{};
+        if(!fdp_dump::read_physical(d, &value, phy, sizeof value))
+            return {};
+
+        return value;
+    }
+
+    // local 4-level walk, large pages included; page-table pages come
+    // straight from the mapping so translations never leave the process
+    opt<uint64_t> walk(fdp_dump::Dump& d, uint64_t dtb, uint64_t ptr)
+    {
+        if(!dtb)
+            return {};
+
+        const auto pml4e = read_qword(d, (dtb & pfn_mask) + 8 * ((ptr >> 39) & 0x1FF));
+        if(!pml4e || !(*pml4e & page_present))
+            return {};
+
+        const auto pdpte = read_qword(d, (*pml4e & pfn_mask) + 8 * ((ptr >> 30) & 0x1FF));
+        if(!pdpte || !(*pdpte & page_present))
+            return {};
+
+        if(*pdpte & page_large)
+            return (*pdpte & 0x000FFFFFC0000000) + (ptr & 0x3FFFFFFF);
+
+        const auto pde = read_qword(d, (*pdpte & pfn_mask) + 8 * ((ptr >> 21) & 0x1FF));
+        if(!pde || !(*pde & page_present))
+            return {};
+
+        if(*pde & page_large)
+            return (*pde & 0x000FFFFFFFE00000) + (ptr & 0x1FFFFF);
+
+        const auto pte = read_qword(d, (*pde & pfn_mask) + 8 * ((ptr >> 12) & 0x1FF));
+        if(!pte || !(*pte & page_present))
+            return {};
+
+        return (*pte & pfn_mask) + (ptr & 0xFFF);
+    }
+
+    // the dump context holds no gs base, recover the KPCR by its
+    // self-pointer instead: KPCR.Self (+0x18) holds its own virtual
+    // address & KPCR.CurrentPrcb (+0x20) points 0x180 bytes past it
+    uint64_t scan_kpcr(fdp_dump::Dump& d)
+    {
+        for(const auto& run : d.runs)
+        {
+            const auto* data = d.data + run.offset;
+            for(uint64_t page = 0; page + PAGE_SIZE <= run.size; page += PAGE_SIZE)
+            {
+                auto self = uint64_t{};
+                auto prcb = uint64_t{};
+                memcpy(&self, &data[page + 0x18], sizeof self);
+                memcpy(&prcb, &data[page + 0x20], sizeof prcb);
+                if(self >> 47 != 0x1FFFF || prcb != self + 0x180)
+                    continue;
+
+                const auto phy = walk(d, d.dtb, self);
+                if(phy && *phy == run.base + page)
+                    return self;
+            }
+        }
+        return 0;
+    }
+}
+
+fdp_dump::DumpPtr fdp_dump::open(const std::string& path)
+{
+    auto ret = std::make_shared<Dump>();
+    if(!file::map_read(ret->map, path))
+        return nullptr;
+
+    ret->data           = static_cast<const uint8_t*>(ret->map.data);
+    const auto is_dmp64 = ret->map.size >= header_size
+                          && !memcmp(ret->data, "PAGE", 4)
+                          && !memcmp(ret->data + off_valid_dump, "DU64", 4);
+    if(is_dmp64)
+    {
+        if(!parse_full_dump(*ret))
+            return nullptr;
+    }
+    else
+        parse_raw_image(*ret);
+
+    LOG(INFO, "dump: %s, %zu run(s), %" PRIx64 " bytes of physical memory", is_dmp64 ? "full-memory crash dump" : "raw physical image", ret->runs.size(), ret->phy_size);
+    return ret;
+}
+
+fdp_dump::DumpPtr fdp_dump::freeze(std::vector<uint8_t>&& physical, const cpu_state& state)
+{
+    auto ret    = std::make_shared<Dump>();
+    ret->buffer = std::move(physical);
+    ret->data   = ret->buffer.data();
+    parse_raw_image(*ret);
+    memcpy(ret->regs, state.regs, sizeof ret->regs);
+    ret->rip          = state.rip;
+    ret->rflags       = state.rflags;
+    ret->seg_cs       = state.seg_cs;
+    ret->dtb          = state.dtb;
+    ret->modules      = state.lstar; // a real lstar is the best anchor
+    ret->has_context  = true;
+    // the captured gs base spares the self-pointer scan
+    ret->kpcr         = state.gs_base >> 47 == 0x1FFFF ? state.gs_base : state.kernel_gs_base;
+    ret->kpcr_scanned = true;
+    LOG(INFO, "snapshot: %zu run(s), %" PRIx64 " bytes of physical memory", ret->runs.size(), ret->phy_size);
+    return ret;
+}
+
+uint64_t fdp_dump::physical_memory_size(fdp_dump::Dump& d)
+{
+    return d.phy_size;
+}
+
+bool fdp_dump::read_physical(fdp_dump::Dump& d, void* vdst, uint64_t src, size_t size)
+{
+    if(src + size > d.phy_size)
+        return false;
+
+    // holes between runs read as zeroes, like device memory on a live vm
+    auto* dst = static_cast<uint8_t*>(vdst);
+    while(size)
+    {
+        const auto* run = find_run(d, src);
+        if(run)
+        {
+            const auto chunk = std::min<uint64_t>(size, run->base + run->size - src);
+            memcpy(dst, d.data + run->offset + (src - run->base), chunk);
+            dst += chunk;
+            src += chunk;
+            size -= chunk;
+            continue;
+        }
+
+        const auto it   = std::upper_bound(d.runs.begin(), d.runs.end(), src, [](uint64_t lhs, const run_t& rhs)
+        {
+            return lhs < rhs.base;
+        });
+        const auto next = it != d.runs.end() ? it->base : d.phy_size;
+        const auto gap  = std::min<uint64_t>(size, next - src);
+        memset(dst, 0, gap);
+        dst += gap;
+        src += gap;
+        size -= gap;
+    }
+    return true;
+}
+
+opt<uint64_t> fdp_dump::virtual_to_physical(fdp_dump::Dump& d, uint64_t dtb, uint64_t ptr)
+{
+    return walk(d, dtb, ptr);
+}
+
+bool fdp_dump::read_virtual(fdp_dump::Dump& d, void* vdst, uint64_t src, uint64_t dtb, size_t size)
+{
+    auto* dst = static_cast<uint8_t*>(vdst);
+    while(size)
+    {
+        const auto phy = walk(d, dtb, src);
+        if(!phy)
+            return false;
+
+        const auto chunk = std::min<uint64_t>(size, PAGE_SIZE - (src & 0xFFF));
+        if(!read_physical(d, dst, *phy, chunk))
+            return false;
+
+        dst += chunk;
+        src += chunk;
+        size -= chunk;
+    }
+    return true;
+}
+
+opt<uint64_t> fdp_dump::read_register(fdp_dump::Dump& d, reg_e reg)
+{
+    if(reg == reg_e::cr3)
+        return d.dtb ? opt<uint64_t>{d.dtb} : std::nullopt;
+
+    if(!d.has_context)
+        return {};
+
+    switch(reg)
+    {
+        case reg_e::rip:    return d.rip;
+        case reg_e::cs:     return d.seg_cs;
+        case reg_e::cr8:    return 0;
+        // rax..r15 match the CONTEXT record order
+        case reg_e::rax:    return d.regs[0];
+        case reg_e::rcx:    return d.regs[1];
+        case reg_e::rdx:    return d.regs[2];
+        case reg_e::rbx:    return d.regs[3];
+        case reg_e::rsp:    return d.regs[4];
+        case reg_e::rbp:    return d.regs[5];
+        case reg_e::rsi:    return d.regs[6];
+        case reg_e::rdi:    return d.regs[7];
+        case reg_e::r8:     return d.regs[8];
+        case reg_e::r9:     return d.regs[9];
+        case reg_e::r10:    return d.regs[10];
+        case reg_e::r11:    return d.regs[11];
+        case reg_e::r12:    return d.regs[12];
+        case reg_e::r13:    return d.regs[13];
+        case reg_e::r14:    return d.regs[14];
+        case reg_e::r15:    return d.regs[15];
+        default:            return {};
+    }
+}
+
+opt<uint64_t> fdp_dump::read_msr(fdp_dump::Dump& d, msr_e msr)
+{
+    switch(msr)
+    {
+        // any pointer into the kernel image satisfies the backward
+        // page scan behind lstar, PsLoadedModuleList is one
+        case msr_e::lstar:
+            return d.modules ? opt<uint64_t>{d.modules} : std::nullopt;
+
+        case msr_e::gs_base:
+        case msr_e::kernel_gs_base:
+            if(!d.kpcr_scanned)
+            {
+                d.kpcr         = scan_kpcr(d);
+                d.kpcr_scanned = true;
+            }
+            return d.kpcr ? opt<uint64_t>{d.kpcr} : std::nullopt;
+
+        default:
+            return {};
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// read-only post-mortem backend: serves the fdp transport surface from
+// a windows full-memory crash dump or a raw physical image mapped from
+// disk, with the page-table walk done locally, so everything above the
+// transport (symbols, processes, callstacks, python) runs at memory
+// speed without any vm
+namespace fdp_dump
+{
+    struct Dump;
+    using DumpPtr = std::shared_ptr<Dump>;
+
+    // cpu state captured at pause time for frozen live snapshots
+    struct cpu_state
+    {
+        uint64_t regs[16]; // rax..r15 in amd64 CONTEXT order
+        uint64_t rip;
+        uint64_t rflags;
+        uint64_t seg_cs;
+        uint64_t dtb;
+        uint64_t lstar;
+        uint64_t gs_base;
+        uint64_t kernel_gs_base;
+    };
+
+    DumpPtr         open                (const std::string& path);
+    DumpPtr         freeze              (std::vector<uint8_t>&& physical, const cpu_state& state);
+    uint64_t        physical_memory_size(Dump& d);
+    bool            read_physical       (Dump& d, void* dst, uint64_t src, size_t size);
+    opt<uint64_t>   virtual_to_physical (Dump& d, uint64_t dtb, uint64_t ptr);
+    bool            read_virtual        (Dump& d, void* dst, uint64_t src, uint64_t dtb, size_t size);
+    opt<uint64_t>   read_register       (Dump& d, reg_e reg);
+    opt<uint64_t>   read_msr            (Dump& d, msr_e msr);
+} // namespace fdp_dump
@@ -0,0 +1,183 @@
+#include "fdp_replay.hpp"
+
+#define FDP_MODULE "fdp_replay"
+#include "log.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr char     magic[4]  = {'F', 'D', 'P', 'R'};
+    constexpr uint32_t version   = 1;
+
+    struct Reply
+    {
+        std::vector<uint8_t> data;
+        bool                 ok;
+    };
+
+    // replies for one (op, key) pair, served in recorded order; the
+    // last one sticks so idempotent calls can repeat past the tape
+    using Replies = std::deque<Reply>;
+}
+
+struct fdp_replay::Session
+{
+    ~Session()
+    {
+        if(file)
+            fclose(file);
+    }
+
+    bool                                     replaying = false;
+    FILE*                                    file      = nullptr;
+    std::unordered_map<std::string, Replies> calls;
+    std::unordered_map<uint8_t, size_t>      counts;
+};
+
+namespace
+{
+    std::string make_key(uint8_t op, const void* key, size_t ksize)
+    {
+        auto ret = std::string{};
+        ret.reserve(1 + ksize);
+        ret.push_back(static_cast<char>(op));
+        ret.append(reinterpret_cast<const char*>(key), ksize);
+        return ret;
+    }
+
+    bool read_exact(FILE* file, void* dst, size_t size)
+    {
+        return fread(dst, 1, size, file) == size;
+    }
+
+    bool write_exact(FILE* file, const void* src, size_t size)
+    {
+        return fwrite(src, 1, size, file) == size;
+    }
+}
+
+fdp_replay::SessionPtr fdp_replay::record(const std::string& path)
+{
+    auto file = fopen(path.data(), "wb");
+    if(!file)
+        return FAIL(nullptr, "unable to open %s", path.data());
+
+    auto hdr = version;
+    if(!write_exact(file, magic, sizeof magic) || !write_exact(file, &hdr, sizeof hdr))
+    {
+        fclose(file);
+        return FAIL(nullptr, "unable to write header to %s", path.data());
+    }
+
+    auto session  = std::make_shared<Session>();
+    session->file = file;
+    return session;
+}
+
+fdp_replay::SessionPtr fdp_replay::replay(const std::string& path)
+{
+    auto file = fopen(path.data(), "rb");
+    if(!file)
+        return FAIL(nullptr, "unable to open %s", path.data());
+
+    char head[4];
+    auto hdr = uint32_t{};
+    if(!read_exact(file, head, sizeof head) || memcmp(head, magic, sizeof magic) != 0
+       || !read_exact(file, &hdr, sizeof hdr) || hdr != version)
+    {
+        fclose(file);
+        return FAIL(nullptr, "invalid session file %s", path.data());
+    }
+
+    auto session       = std::make_shared<Session>();
+    session->replaying = true;
+    auto records       = size_t{};
+    while(true)
+    {
+        auto op = uint8_t{};
+        if(!read_exact(file, &op, sizeof op))
+            break;
+
+        auto ksize = uint32_t{};
+        auto rsize = uint32_t{};
+        auto ok    = uint8_t{};
+        if(!read_exact(file, &ksize, sizeof ksize))
+            break;
+
+        auto key = std::vector<char>(ksize);
+        if(ksize && !read_exact(file, &key[0], ksize))
+            break;
+
+        if(!read_exact(file, &rsize, sizeof rsize))
+            break;
+
+        auto reply = Reply{};
+        reply.data.resize(rsize);
+        if(rsize && !read_exact(file, &reply.data[0], rsize))
+            break;
+
+        if(!read_exact(file, &ok, sizeof ok))
+            break;
+
+        reply.ok = !!ok;
+        session->calls[make_key(op, ksize ? &key[0] : nullptr, ksize)].emplace_back(std::move(reply));
+        session->counts[op]++;
+        ++records;
+    }
+    fclose(file);
+    LOG(INFO, "loaded %zd record(s) from %s", records, path.data());
+    return session;
+}
+
+bool fdp_replay::is_replay(const Session& s)
+{
+    return s.replaying;
+}
+
+void fdp_replay::save(Session& s, uint8_t op, const void* key, size_t ksize, const void* reply, size_t rsize, bool ok)
+{
+    if(!s.file)
+        return;
+
+    const auto k32   = static_cast<uint32_t>(ksize);
+    const auto r32   = static_cast<uint32_t>(rsize);
+    const auto ok8   = static_cast<uint8_t>(ok);
+    auto       write = write_exact(s.file, &op, sizeof op);
+    write            = write && write_exact(s.file, &k32, sizeof k32);
+    write            = write && (!ksize || write_exact(s.file, key, ksize));
+    write            = write && write_exact(s.file, &r32, sizeof r32);
+    write            = write && (!rsize || write_exact(s.file, reply, rsize));
+    write            = write && write_exact(s.file, &ok8, sizeof ok8);
+    if(!write)
+        LOG(ERROR, "unable to record call op:%d", op);
+}
+
+bool fdp_replay::fetch(Session& s, uint8_t op, const void* key, size_t ksize, void* reply, size_t rsize)
+{
+    const auto it = s.calls.find(make_key(op, key, ksize));
+    if(it == s.calls.end() || it->second.empty())
+        return false;
+
+    const auto& front = it->second.front();
+    if(rsize && reply)
+        memcpy(reply, front.data.data(), std::min(rsize, front.data.size()));
+    const auto ok = front.ok;
+    if(it->second.size() > 1)
+    {
+        it->second.pop_front();
+        s.counts[op]--;
+    }
+    return ok;
+}
+
+size_t fdp_replay::remaining(Session& s, uint8_t op)
+{
+    const auto it = s.counts.find(op);
+    return it != s.counts.end() ? it->second : 0;
+}
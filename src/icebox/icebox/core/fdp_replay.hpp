@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// record/replay sessions over the fdp transport: record captures every
+// request/response pair flowing through the fdp:: wrappers into a
+// compact file, replay serves them back deterministically without any
+// vm, enabling offline benchmarks & tests of everything above the
+// transport
+namespace fdp_replay
+{
+    struct Session;
+    using SessionPtr = std::shared_ptr<Session>;
+
+    SessionPtr  record      (const std::string& path);
+    SessionPtr  replay      (const std::string& path);
+    bool        is_replay   (const Session& s);
+
+    // one call = one op id + serialized request key + serialized reply
+    void        save        (Session& s, uint8_t op, const void* key, size_t ksize, const void* reply, size_t rsize, bool ok);
+    // copy the recorded reply & return the recorded status, false when
+    // the call was never recorded
+    bool        fetch       (Session& s, uint8_t op, const void* key, size_t ksize, void* reply, size_t rsize);
+    // recorded replies left for op, any key
+    size_t      remaining   (Session& s, uint8_t op);
+} // namespace fdp_replay
@@ -6,23 +6,80 @@
 #include "core_private.hpp"
 #include "interfaces/if_os.hpp"
 
+#include "utils/hash.hpp"
+
 #include <unordered_map>
 
 namespace
 {
+    // one breakpoint armed per (process, return address), shared by
+    // every in-flight invocation returning there
+    struct SiteKey
+    {
+        uint64_t proc;
+        uint64_t addr;
+    };
+
+    inline bool operator==(const SiteKey& a, const SiteKey& b)
+    {
+        return a.proc == b.proc && a.addr == b.addr;
+    }
+}
+
+namespace std
+{
+    template <>
+    struct hash<SiteKey>
+    {
+        size_t operator()(const SiteKey& arg) const
+        {
+            size_t seed = 0;
+            ::hash::combine(seed, arg.proc, arg.addr);
+            return seed;
+        }
+    };
+} // namespace std
+
+namespace
+{
+    struct Site
+    {
+        state::Breakpoint bp;
+        size_t            refcount;
+    };
+
     struct Return
     {
-        state::Breakpoint       bp;
+        SiteKey                 site;
         functions::on_return_fn on_return;
     };
+    using Sites   = std::unordered_map<SiteKey, Site>;
     using Returns = std::unordered_map<uint64_t, Return>;
+
+    // drop one reference on a pooled return site, the breakpoint is
+    // only torn down once no invocation is in flight anymore
+    void release_return_site(functions::Data& d, const SiteKey& key);
 }
 
 struct functions::Data
 {
+    Sites   sites;
     Returns returns;
 };
 
+namespace
+{
+    void release_return_site(functions::Data& d, const SiteKey& key)
+    {
+        const auto it = d.sites.find(key);
+        if(it == d.sites.end())
+            return;
+
+        if(--it->second.refcount == 0)
+            d.sites.erase(it);
+    }
+}
+
 std::shared_ptr<functions::Data> functions::setup()
 {
     return std::make_shared<functions::Data>();
@@ -52,22 +109,38 @@ bool functions::break_on_return(core::Core& core, std::string_view name, const f
     if(!return_addr)
         return false;
 
-    struct Private
-    {
-        core::Core& core;
-    } ctx         = {core};
-    const auto bp = state::break_on_thread(core, name, *thread, *return_addr, [=]
+    // invocations sharing a return site share one armed breakpoint:
+    // hot functions stop churning set/unset through the channel & the
+    // site is only torn down once every caller has returned
+    const auto key = SiteKey{proc->id, *return_addr};
+    auto& d        = *core.func_;
+    auto it        = d.sites.find(key);
+    if(it == d.sites.end())
     {
-        auto& d        = *ctx.core.func_;
-        const auto rsp = registers::read(ctx.core, reg_e::rsp) - ptr_size;
-        auto it        = d.returns.find(rsp);
-        if(it == d.returns.end())
-            return;
+        struct Private
+        {
+            core::Core& core;
+        } ctx         = {core};
+        const auto bp = state::break_on_process(core, name, *proc, *return_addr, [=]
+        {
+            auto& d        = *ctx.core.func_;
+            const auto rsp = registers::read(ctx.core, reg_e::rsp) - ptr_size;
+            auto ju        = d.returns.find(rsp);
+            if(ju == d.returns.end())
+                return;
+
+            const auto ret = std::move(ju->second);
+            d.returns.erase(ju);
+            ret.on_return();
+            release_return_site(d, ret.site);
+        });
+        if(!bp)
+            return false;
 
-        it->second.on_return();
-        d.returns.erase(it);
-    });
-    core.func_->returns.emplace(want_rsp, Return{bp, on_return});
+        it = d.sites.emplace(key, Site{bp, 0}).first;
+    }
+    ++it->second.refcount;
+    d.returns.emplace(want_rsp, Return{key, on_return});
     return true;
 }
 
@@ -81,6 +154,11 @@ opt<arg_t> functions::read_arg(core::Core& core, size_t index)
     return core.os_->read_arg(index);
 }
 
+bool functions::read_args(core::Core& core, arg_t* args, size_t count)
+{
+    return core.os_->read_args(args, count);
+}
+
 bool functions::write_arg(core::Core& core, size_t index, arg_t arg)
 {
     return core.os_->write_arg(index, arg);
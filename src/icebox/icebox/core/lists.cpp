@@ -0,0 +1,73 @@
+#include "lists.hpp"
+
+#define FDP_MODULE "lists"
+#include "log.hpp"
+#include "memory.hpp"
+
+#include <vector>
+
+namespace
+{
+    // follow the remembered chain while the guest still agrees with it,
+    // all next links are fetched in a single batched read beforehand
+    bool replay_chain(const std::vector<uint64_t>& chain, const memory::Io& io, uint64_t head, std::vector<uint64_t>& nodes)
+    {
+        auto nexts  = std::vector<uint64_t>(chain.size());
+        auto ranges = std::vector<memory::io_range_t>{};
+        ranges.reserve(chain.size());
+        for(size_t i = 0; i < chain.size(); ++i)
+            ranges.push_back(memory::io_range_t{chain[i], &nexts[i], sizeof nexts[i]});
+        if(!io.read_many(&ranges[0], ranges.size()))
+            return false;
+
+        for(size_t i = 0; i < chain.size(); ++i)
+        {
+            const auto next = nexts[i];
+            if(next == head)
+                return true; // the whole chain revalidated
+
+            if(!next)
+                break;
+
+            // a fresh link is valid even where the chains diverge
+            nodes.push_back(next);
+            if(i + 1 >= chain.size() || next != chain[i + 1])
+                break;
+        }
+        return false;
+    }
+}
+
+bool lists::walk(Walker& walker, const memory::Io& io, uint64_t head, const on_node_fn& on_node)
+{
+    auto& chain = walker.chains[head];
+    auto nodes  = std::vector<uint64_t>{};
+    nodes.reserve(chain.size() + 16);
+    nodes.push_back(head);
+
+    auto done = false;
+    if(!chain.empty() && chain[0] == head)
+        done = replay_chain(chain, io, head, nodes);
+
+    while(!done)
+    {
+        const auto next = io.read(nodes.back());
+        if(!next)
+            return FAIL(false, "unable to read next list link at 0x%" PRIx64, nodes.back());
+
+        if(*next == head)
+            break;
+
+        if(!*next)
+            return FAIL(false, "null list link after 0x%" PRIx64, nodes.back());
+
+        nodes.push_back(*next);
+    }
+
+    chain = nodes;
+    for(size_t i = 1; i < nodes.size(); ++i)
+        if(on_node(nodes[i]) == walk_e::stop)
+            break;
+
+    return true;
+}
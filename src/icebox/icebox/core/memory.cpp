@@ -4,16 +4,64 @@
 #define FDP_MODULE "mem"
 #include "core.hpp"
 #include "core_private.hpp"
+#include "counters.hpp"
 #include "endian.hpp"
 #include "fdp.hpp"
 #include "log.hpp"
 #include "utils/utils.hpp"
 
+#include <algorithm>
 #include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    struct tlb_key_t
+    {
+        uint64_t dtb;
+        uint64_t page;
+    };
+
+    bool operator==(const tlb_key_t& a, const tlb_key_t& b)
+    {
+        return a.dtb == b.dtb && a.page == b.page;
+    }
+
+    struct tlb_hash_t
+    {
+        size_t operator()(const tlb_key_t& key) const
+        {
+            return std::hash<uint64_t>()(key.dtb ^ key.page);
+        }
+    };
+}
+
+namespace
+{
+    using PageData  = std::unique_ptr<std::array<uint8_t, PAGE_SIZE>>;
+    using PageCache = std::unordered_map<uint64_t, PageData>;
+
+    // bound the cache to 16MB, one break event rarely touches more
+    constexpr size_t max_cached_pages = 0x1000;
+}
 
 struct memory::Memory
 {
     int depth = 0;
+
+    // software tlb, valid while the vm stays paused
+    std::unordered_map<tlb_key_t, phy_t, tlb_hash_t> tlb;
+
+    // guest pages read since the last state change, keyed by physical page
+    PageCache pages;
+
+    // incremented on every flush so callers can invalidate their own caches
+    uint64_t generation = 0;
+
+    // incremented on every guest write, code caches key off it
+    uint64_t write_generation = 0;
 };
 
 std::shared_ptr<memory::Memory> memory::setup()
@@ -21,6 +69,29 @@ std::shared_ptr<memory::Memory> memory::setup()
     return std::make_shared<Memory>();
 }
 
+void memory::flush_tlb(core::Core& core)
+{
+    core.mem_->tlb.clear();
+    core.mem_->generation++;
+}
+
+void memory::flush_caches(core::Core& core)
+{
+    core.mem_->tlb.clear();
+    core.mem_->pages.clear();
+    core.mem_->generation++;
+}
+
+uint64_t memory::cache_generation(core::Core& core)
+{
+    return core.mem_->generation;
+}
+
+uint64_t memory::write_generation(core::Core& core)
+{
+    return core.mem_->write_generation;
+}
+
 namespace
 {
     dtb_t dtb_select(core::Core& core, proc_t proc, uint64_t ptr)
@@ -30,55 +101,412 @@ namespace
 
     opt<phy_t> virtual_to_physical(core::Core& core, proc_t* proc, dtb_t dtb, uint64_t ptr)
     {
+        auto&      tlb    = core.mem_->tlb;
+        const auto page   = utils::align<PAGE_SIZE>(ptr);
+        const auto offset = ptr - page;
+        const auto key    = tlb_key_t{dtb.val, page};
+        const auto it     = tlb.find(key);
+        if(it != tlb.end())
+            return phy_t{it->second.val + offset};
+
         const auto ret = fdp::virtual_to_physical(core, dtb, ptr);
         if(ret && ret->val)
+        {
+            tlb.emplace(key, phy_t{ret->val - offset});
             return ret;
+        }
 
-        return os::virtual_to_physical(core, proc, dtb, ptr);
+        const auto walked = os::virtual_to_physical(core, proc, dtb, ptr);
+        if(walked)
+            tlb.emplace(key, phy_t{walked->val - offset});
+        return walked;
     }
 }
 
 opt<phy_t> memory::virtual_to_physical(core::Core& core, proc_t proc, uint64_t ptr)
 {
+    CHANNEL_SCOPE();
     const auto dtb = dtb_select(core, proc, ptr);
     return ::virtual_to_physical(core, &proc, dtb, ptr);
 }
 
 opt<phy_t> memory::virtual_to_physical_with_dtb(core::Core& core, dtb_t dtb, uint64_t ptr)
 {
+    CHANNEL_SCOPE();
     return ::virtual_to_physical(core, nullptr, dtb, ptr);
 }
 
+bool memory::residency_map(core::Core& core, proc_t proc, span_t span, uint8_t* states)
+{
+    CHANNEL_SCOPE();
+    if(!span.size)
+        return true;
+
+    const auto dtb = dtb_select(core, proc, span.addr);
+    if(os::residency_map(core, &proc, dtb, span, states))
+        return true;
+
+    // oses without a native walk fall back to per-page translations
+    const auto first = utils::align<PAGE_SIZE>(span.addr);
+    const auto last  = utils::align<PAGE_SIZE>(span.addr + span.size - 1);
+    auto       ptrs  = std::vector<uint64_t>{};
+    ptrs.reserve((last - first) / PAGE_SIZE + 1);
+    for(auto page = first; page <= last; page += PAGE_SIZE)
+        ptrs.push_back(page);
+    auto phys = std::vector<opt<phy_t>>(ptrs.size());
+    memory::virtual_to_physical_many(core, proc, &ptrs[0], &phys[0], ptrs.size());
+    for(size_t i = 0; i < phys.size(); ++i)
+        states[i] = phys[i] ? page_valid : page_none;
+    return true;
+}
+
 namespace
 {
+    // pages streamed per physical run while prefetching
+    constexpr size_t max_prefetch_run = 256;
+
+    // pages per chunk while streaming resident extents
+    constexpr size_t max_sparse_run = 256;
+}
+
+size_t memory::page_in(core::Core& core, proc_t proc, span_t span)
+{
+    CHANNEL_SCOPE();
+    return os::page_in(core, proc, span);
+}
+
+size_t memory::prefetch(core::Core& core, proc_t proc)
+{
+    CHANNEL_SCOPE();
+    // collect the address space first, the vad walk itself reads memory
+    auto spans = std::vector<span_t>{};
+    vm_area::list(core, proc, [&](vm_area_t vm_area)
+    {
+        const auto span = vm_area::span(core, proc, vm_area);
+        if(span && span->size)
+            spans.push_back(*span);
+        return walk_e::next;
+    });
+
+    // resident pages are the ones the batch walker resolves
+    auto ptrs = std::vector<uint64_t>{};
+    for(const auto& span : spans)
+    {
+        const auto first = utils::align<PAGE_SIZE>(span.addr);
+        const auto last  = utils::align<PAGE_SIZE>(span.addr + span.size - 1);
+        for(auto page = first; page <= last; page += PAGE_SIZE)
+            ptrs.push_back(page);
+    }
+    auto phys = std::vector<opt<phy_t>>(ptrs.size());
+    memory::virtual_to_physical_many(core, proc, ptrs.data(), phys.data(), ptrs.size());
+
+    auto pages = std::vector<uint64_t>{};
+    pages.reserve(phys.size());
+    for(const auto& phy : phys)
+        if(phy && phy->val)
+            pages.push_back(utils::align<PAGE_SIZE>(phy->val));
+    std::sort(pages.begin(), pages.end());
+    pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+    // stream consecutive physical runs in large reads: every page lands
+    // in the host cache & the first ones fill the guest page cache
+    auto& cache   = core.mem_->pages;
+    auto  buffer  = std::vector<uint8_t>(max_prefetch_run * PAGE_SIZE);
+    auto  fetched = size_t{};
+    for(size_t i = 0; i < pages.size();)
+    {
+        auto count = size_t{1};
+        while(i + count < pages.size()
+              && count < max_prefetch_run
+              && pages[i + count] == pages[i] + count * PAGE_SIZE)
+            ++count;
+        const auto ok = fdp::read_physical(core, buffer.data(), phy_t{pages[i]}, count * PAGE_SIZE);
+        if(ok)
+        {
+            fetched += count;
+            for(size_t k = 0; k < count && cache.size() < max_cached_pages; ++k)
+            {
+                const auto page = pages[i + k];
+                if(cache.find(page) != cache.end())
+                    continue;
+
+                auto data = std::make_unique<std::array<uint8_t, PAGE_SIZE>>();
+                memcpy(data->data(), &buffer[k * PAGE_SIZE], PAGE_SIZE);
+                cache.emplace(page, std::move(data));
+            }
+        }
+        i += count;
+    }
+    return fetched;
+}
+
+bool memory::read_sparse(core::Core& core, proc_t proc, span_t span, const on_extent_fn& on_extent)
+{
+    CHANNEL_SCOPE();
+    if(!span.size)
+        return true;
+
+    const auto first  = utils::align<PAGE_SIZE>(span.addr);
+    const auto last   = utils::align<PAGE_SIZE>(span.addr + span.size - 1);
+    const auto pages  = (last - first) / PAGE_SIZE + 1;
+    auto       states = std::vector<uint8_t>(pages);
+    if(!residency_map(core, proc, {first, pages * PAGE_SIZE}, &states[0]))
+        return false;
+
+    auto buffer = std::vector<uint8_t>(max_sparse_run * PAGE_SIZE);
+    for(size_t i = 0; i < pages;)
+    {
+        const auto resident = states[i] != page_none;
+        auto       count    = size_t{1};
+        while(i + count < pages && (states[i + count] != page_none) == resident)
+            ++count;
+
+        const auto extent = span_t{first + i * PAGE_SIZE, count * PAGE_SIZE};
+        i += count;
+        if(!resident)
+        {
+            // one hole per gap, the caller decides how to record it
+            if(on_extent(extent, nullptr) == walk_e::stop)
+                return true;
+
+            continue;
+        }
+
+        // resident extents stream in large chunks: every page resolves
+        // on the direct path, none can fall into the os fallback
+        for(size_t k = 0; k < count;)
+        {
+            const auto run   = std::min(count - k, max_sparse_run);
+            const auto chunk = span_t{extent.addr + k * PAGE_SIZE, run * PAGE_SIZE};
+            if(!read_virtual(core, proc, &buffer[0], chunk.addr, chunk.size))
+                return false;
+
+            if(on_extent(chunk, &buffer[0]) == walk_e::stop)
+                return true;
+
+            k += run;
+        }
+    }
+    return true;
+}
+
+opt<memory::va_snapshot_t> memory::snapshot_exec(core::Core& core, proc_t proc)
+{
+    CHANNEL_SCOPE();
+    // collect the private executable areas first, the vad walk itself
+    // reads memory
+    auto spans = std::vector<span_t>{};
+    vm_area::list(core, proc, [&](vm_area_t vm_area)
+    {
+        const auto access = vm_area::access(core, proc, vm_area);
+        if(!(access & VMA_ACCESS_EXEC) || (access & VMA_ACCESS_SHARED))
+            return walk_e::next;
+
+        const auto span = vm_area::span(core, proc, vm_area);
+        if(span && span->size)
+            spans.push_back(*span);
+        return walk_e::next;
+    });
+
+    auto ret    = va_snapshot_t{};
+    auto states = std::vector<uint8_t>{};
+    for(const auto& span : spans)
+    {
+        const auto first = utils::align<PAGE_SIZE>(span.addr);
+        const auto last  = utils::align<PAGE_SIZE>(span.addr + span.size - 1);
+        const auto pages = (last - first) / PAGE_SIZE + 1;
+        states.assign(pages, 0);
+        if(!residency_map(core, proc, {first, pages * PAGE_SIZE}, &states[0]))
+            continue;
+
+        const auto base  = ret.bits.size();
+        const auto words = (pages + 63) / 64;
+        ret.bits.resize(base + words, 0);
+        for(uint64_t i = 0; i < pages; ++i)
+            if((states[i] & page_valid) && !(states[i] & page_noexec))
+                ret.bits[base + i / 64] |= uint64_t{1} << (i % 64);
+        ret.regions.push_back({first, pages, base});
+    }
+    return ret;
+}
+
+namespace
+{
+    const memory::va_snapshot_t::region_t* find_region(const memory::va_snapshot_t& snap, uint64_t base, uint64_t pages)
+    {
+        // regions come out of the vad walk sorted by base
+        const auto it = std::lower_bound(snap.regions.begin(), snap.regions.end(), base, [](const auto& region, uint64_t addr)
+        {
+            return region.base < addr;
+        });
+        if(it == snap.regions.end() || it->base != base || it->pages != pages)
+            return nullptr;
+
+        return &*it;
+    }
+}
+
+bool memory::diff_exec(const va_snapshot_t& prev, const va_snapshot_t& next, const on_span_fn& on_range)
+{
+    for(const auto& region : next.regions)
+    {
+        // a resized or relocated area counts as all new
+        const auto* old  = find_region(prev, region.base, region.pages);
+        const auto words = (region.pages + 63) / 64;
+        // unchanged regions stop at this one compare, which runs on the
+        // vectorized libc memcmp
+        if(old && !memcmp(&next.bits[region.first], &prev.bits[old->first], words * sizeof(uint64_t)))
+            continue;
+
+        auto run_begin = uint64_t{};
+        auto run_pages = uint64_t{};
+        auto walk      = walk_e::next;
+        const auto flush = [&]
+        {
+            if(!run_pages)
+                return;
+
+            walk      = on_range({run_begin, run_pages * PAGE_SIZE});
+            run_pages = 0;
+        };
+        for(uint64_t w = 0; w < words && walk == walk_e::next; ++w)
+        {
+            const auto before = old ? prev.bits[old->first + w] : uint64_t{};
+            const auto fresh  = next.bits[region.first + w] & ~before;
+            if(!fresh)
+            {
+                flush();
+                continue;
+            }
+            for(uint64_t b = 0; b < 64 && walk == walk_e::next; ++b)
+            {
+                const auto page = w * 64 + b;
+                if(page >= region.pages)
+                    break;
+
+                if(!(fresh & (uint64_t{1} << b)))
+                {
+                    flush();
+                    continue;
+                }
+                if(!run_pages)
+                    run_begin = region.base + page * PAGE_SIZE;
+                ++run_pages;
+            }
+        }
+        if(walk == walk_e::next)
+            flush();
+        if(walk == walk_e::stop)
+            return true;
+    }
+    return true;
+}
+
+size_t memory::virtual_to_physical_many(core::Core& core, proc_t proc, const uint64_t* ptrs, opt<phy_t>* phys, size_t count)
+{
+    auto& tlb      = core.mem_->tlb;
+    auto  resolved = size_t{};
+    for(size_t i = 0; i < count; ++i)
+    {
+        const auto ptr    = ptrs[i];
+        const auto dtb    = dtb_select(core, proc, ptr);
+        const auto page   = utils::align<PAGE_SIZE>(ptr);
+        const auto offset = ptr - page;
+        const auto key    = tlb_key_t{dtb.val, page};
+        const auto it     = tlb.find(key);
+        if(it != tlb.end())
+        {
+            phys[i] = phy_t{it->second.val + offset};
+            ++resolved;
+            continue;
+        }
+
+        // walk locally first, page-table pages stay in the guest page cache
+        // so consecutive addresses cost about one physical read per 512 entries
+        auto walked = os::virtual_to_physical_walk(core, &proc, dtb, ptr);
+        if(!walked)
+            walked = fdp::virtual_to_physical(core, dtb, ptr);
+        if(!walked || !walked->val)
+        {
+            phys[i] = {};
+            continue;
+        }
+
+        tlb.emplace(key, phy_t{walked->val - offset});
+        phys[i] = *walked;
+        ++resolved;
+    }
+    return resolved;
+}
+
+namespace
+{
+    // consecutive pages fetched per round trip on the page-wise fallback path
+    constexpr size_t read_ahead_pages = 16;
+
     template <typename T>
     bool read_pages(const char* /*where*/, uint8_t* dst, uint64_t src, size_t size, const T& operand)
     {
-        auto buffer = std::array<uint8_t, PAGE_SIZE>{};
+        auto buffer = std::vector<uint8_t>(read_ahead_pages * PAGE_SIZE);
         auto fill   = size_t{};
         auto ptr    = utils::align<PAGE_SIZE>(src);
         auto skip   = src - ptr;
         while(fill < size)
         {
-            const auto ok = operand(&buffer[0], ptr, sizeof buffer);
+            const auto remaining = skip + size - fill;
+            const auto npages    = std::min(read_ahead_pages, (remaining + PAGE_SIZE - 1) / PAGE_SIZE);
+            auto       ok        = operand(&buffer[0], ptr, npages * PAGE_SIZE);
+            if(!ok && npages > 1)
+            {
+                // the batch crossed a hole, retry page by page
+                ok = true;
+                for(size_t i = 0; ok && i < npages; ++i)
+                    ok = operand(&buffer[i * PAGE_SIZE], ptr + i * PAGE_SIZE, PAGE_SIZE);
+            }
             if(!ok)
                 return false;
 
-            const auto chunk = std::min(size - fill, sizeof buffer - skip);
+            const auto chunk = std::min(size - fill, npages * PAGE_SIZE - skip);
             memcpy(&dst[fill], &buffer[skip], chunk);
             fill += chunk;
             skip = 0;
-            ptr += sizeof buffer;
+            ptr += npages * PAGE_SIZE;
         }
         return true;
     }
 
+    const uint8_t* cached_page(core::Core& core, uint64_t phy_page)
+    {
+        auto& pages   = core.mem_->pages;
+        const auto it = pages.find(phy_page);
+        if(it != pages.end())
+        {
+            counters::bump(counters::get().page_cache_hits);
+            return it->second->data();
+        }
+
+        counters::bump(counters::get().page_cache_misses);
+        if(pages.size() >= max_cached_pages)
+            pages.clear();
+
+        auto buffer   = std::make_unique<std::array<uint8_t, PAGE_SIZE>>();
+        const auto ok = fdp::read_physical(core, buffer->data(), phy_t{phy_page}, PAGE_SIZE);
+        if(!ok)
+            return nullptr;
+
+        return pages.emplace(phy_page, std::move(buffer)).first->second->data();
+    }
+
     bool read_virtual_page(core::Core& core, uint8_t* pgdst, uint64_t pgsrc, proc_t* proc, dtb_t dtb, size_t pgsize)
     {
         auto ok = fdp::read_virtual(core, pgdst, pgsrc, dtb, pgsize);
         if(ok)
             return true;
 
+        // the page walker only handles single pages
+        if(pgsize != PAGE_SIZE)
+            return false;
+
         return os::read_page(core, pgdst, pgsrc, proc, dtb);
     }
 
@@ -87,6 +515,20 @@ namespace
         if(!size)
             return true;
 
+        // reads within one page are served from the page cache
+        const auto page = utils::align<PAGE_SIZE>(src);
+        if(page == utils::align<PAGE_SIZE>(src + size - 1))
+        {
+            const auto skip = src - page;
+            const auto phy  = ::virtual_to_physical(core, proc, dtb, src);
+            if(phy)
+                if(const auto cached = cached_page(core, phy->val - skip))
+                {
+                    memcpy(dst, cached + skip, size);
+                    return true;
+                }
+        }
+
         const auto full = fdp::read_virtual(core, dst, src, dtb, size);
         if(full)
             return true;
@@ -104,6 +546,12 @@ namespace
 
         return read_pages("physical", dst, src, size, [&](uint8_t* pgdst, uint64_t pgsrc, uint32_t pgsize)
         {
+            if(pgsize == PAGE_SIZE)
+                if(const auto cached = cached_page(core, pgsrc))
+                {
+                    memcpy(pgdst, cached, pgsize);
+                    return true;
+                }
             return fdp::read_physical(core, pgdst, phy_t{pgsrc}, pgsize);
         });
     }
@@ -145,6 +593,8 @@ namespace
         if(!size)
             return true;
 
+        core.mem_->pages.clear();
+
         const auto full = fdp::write_virtual(core, dst, dtb, src, size);
         if(full)
             return true;
@@ -169,6 +619,8 @@ namespace
         if(!size)
             return true;
 
+        core.mem_->pages.clear();
+
         const auto read_physical = [&](uint8_t* pgdst, uint64_t pgsrc, size_t pgsize)
         {
             return fdp::read_physical(core, pgdst, phy_t{pgsrc}, pgsize);
@@ -181,8 +633,15 @@ namespace
     }
 }
 
+opt<uint64_t> memory::physical_size(core::Core& core)
+{
+    CHANNEL_SCOPE();
+    return fdp::physical_memory_size(core);
+}
+
 bool memory::read_virtual(core::Core& core, proc_t proc, void* vdst, uint64_t src, size_t size)
 {
+    CHANNEL_SCOPE();
     const auto dst   = reinterpret_cast<uint8_t*>(vdst);
     const auto usize = static_cast<uint32_t>(size);
     const auto dtb   = dtb_select(core, proc, src);
@@ -191,34 +650,65 @@ bool memory::read_virtual(core::Core& core, proc_t proc, void* vdst, uint64_t sr
 
 bool memory::read_virtual_with_dtb(core::Core& core, dtb_t dtb, void* vdst, uint64_t src, size_t size)
 {
+    CHANNEL_SCOPE();
     const auto dst   = reinterpret_cast<uint8_t*>(vdst);
     const auto usize = static_cast<uint32_t>(size);
     return ::read_virtual(core, nullptr, dtb, dst, src, usize);
 }
 
+bool memory::read_virtual_with_proc_dtb(core::Core& core, proc_t proc, dtb_t dtb, void* vdst, uint64_t src, size_t size)
+{
+    CHANNEL_SCOPE();
+    const auto dst   = reinterpret_cast<uint8_t*>(vdst);
+    const auto usize = static_cast<uint32_t>(size);
+    return ::read_virtual(core, &proc, dtb, dst, src, usize);
+}
+
 bool memory::read_physical(core::Core& core, void* vdst, uint64_t src, size_t size)
 {
+    CHANNEL_SCOPE();
     const auto dst = reinterpret_cast<uint8_t*>(vdst);
     return ::read_physical(core, dst, src, size);
 }
 
+bool memory::sample_physical(core::Core& core, void* vdst, uint64_t src, size_t size)
+{
+    CHANNEL_SCOPE();
+    return fdp::sample_physical(core, vdst, phy_t{src}, size);
+}
+
 bool memory::write_virtual(core::Core& core, proc_t proc, uint64_t dst, const void* vsrc, size_t size)
 {
+    CHANNEL_SCOPE();
     const auto src   = reinterpret_cast<const uint8_t*>(vsrc);
     const auto usize = static_cast<uint32_t>(size);
     const auto dtb   = dtb_select(core, proc, dst);
+    core.mem_->write_generation++;
     return ::write_virtual(core, &proc, dtb, dst, src, usize);
 }
 
 bool memory::write_virtual_with_dtb(core::Core& core, dtb_t dtb, uint64_t dst, const void* vsrc, size_t size)
 {
+    CHANNEL_SCOPE();
     const auto src   = reinterpret_cast<const uint8_t*>(vsrc);
     const auto usize = static_cast<uint32_t>(size);
+    core.mem_->write_generation++;
     return ::write_virtual(core, nullptr, dtb, dst, src, usize);
 }
 
+bool memory::write_virtual_with_proc_dtb(core::Core& core, proc_t proc, dtb_t dtb, uint64_t dst, const void* vsrc, size_t size)
+{
+    CHANNEL_SCOPE();
+    const auto src   = reinterpret_cast<const uint8_t*>(vsrc);
+    const auto usize = static_cast<uint32_t>(size);
+    core.mem_->write_generation++;
+    return ::write_virtual(core, &proc, dtb, dst, src, usize);
+}
+
 bool memory::write_physical(core::Core& core, uint64_t dst, const void* vsrc, size_t size)
 {
+    CHANNEL_SCOPE();
     const auto src = reinterpret_cast<const uint8_t*>(vsrc);
+    core.mem_->write_generation++;
     return ::write_physical(core, dst, src, size);
 }
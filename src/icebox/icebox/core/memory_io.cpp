@@ -5,8 +5,15 @@
 #include "core.hpp"
 #include "core_private.hpp"
 #include "endian.hpp"
+#include "fdp.hpp"
 #include "interfaces/if_os.hpp"
-#include "os.hpp"
+#include "utils/utf8.hpp"
+#include "utils/utils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
 
 namespace
 {
@@ -33,18 +40,18 @@ namespace
 memory::Io memory::make_io_kernel(core::Core& core)
 {
     const auto dtb = core.os_->kernel_dtb();
-    return memory::Io{core, {}, dtb};
+    return memory::Io{core, {}, dtb, 0};
 }
 
 memory::Io memory::make_io_current(core::Core& core)
 {
     const auto dtb = dtb_t{registers::read(core, reg_e::cr3)};
-    return memory::Io{core, {}, dtb};
+    return memory::Io{core, {}, dtb, 0};
 }
 
 memory::Io memory::make_io(core::Core& core, proc_t proc)
 {
-    return memory::Io{core, proc, proc.udtb};
+    return memory::Io{core, proc, proc.udtb, core.os_->kernel_split()};
 }
 
 opt<uint8_t> memory::Io::byte(uint64_t ptr) const
@@ -91,11 +98,233 @@ opt<uint64_t> memory::Io::read(uint64_t ptr) const
 bool memory::Io::read_all(void* dst, uint64_t ptr, size_t size) const
 {
     if(proc)
-        return memory::read_virtual(core, *proc, dst, ptr, size);
+        return memory::read_virtual_with_proc_dtb(core, *proc, ptr < split ? proc->udtb : proc->kdtb, dst, ptr, size);
 
     return memory::read_virtual_with_dtb(core, dtb, dst, ptr, size);
 }
 
+namespace
+{
+    bool read_ranges_fallback(const memory::Io& io, const memory::io_range_t* ranges, size_t count)
+    {
+        auto ok = true;
+        for(size_t i = 0; i < count; ++i)
+            ok = io.read_all(ranges[i].dst, ranges[i].ptr, ranges[i].size) && ok;
+        return ok;
+    }
+
+    // maximum pages fetched in one batched transfer
+    constexpr size_t max_batched_pages = 64;
+}
+
+bool memory::Io::read_many(const io_range_t* ranges, size_t count) const
+{
+    if(!count)
+        return true;
+
+    // collect the pages covering every range
+    auto pages = std::vector<uint64_t>{};
+    pages.reserve(count);
+    auto all_kernel = true;
+    auto all_user   = true;
+    for(size_t i = 0; i < count; ++i)
+    {
+        if(!ranges[i].size)
+            continue;
+
+        const auto is_kernel = ranges[i].ptr >= split; // pinned split, no os lookup per range
+        all_kernel &= is_kernel;
+        all_user &= !is_kernel;
+        const auto first = utils::align<PAGE_SIZE>(ranges[i].ptr);
+        const auto last  = utils::align<PAGE_SIZE>(ranges[i].ptr + ranges[i].size - 1);
+        for(auto page = first; page <= last; page += PAGE_SIZE)
+            pages.push_back(page);
+    }
+    std::sort(pages.begin(), pages.end());
+    pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+    if(pages.empty())
+        return true;
+
+    // per-range reads handle oversized batches & mixed kernel/user spaces
+    if(pages.size() > max_batched_pages || (proc && !all_kernel && !all_user))
+        return read_ranges_fallback(*this, ranges, count);
+
+    auto spans = std::vector<span_t>{};
+    spans.reserve(pages.size());
+    for(const auto page : pages)
+        spans.push_back({page, PAGE_SIZE});
+
+    const auto read_dtb = proc ? (all_kernel ? proc->kdtb : proc->udtb) : dtb;
+    auto       buffer   = std::vector<uint8_t>(pages.size() * PAGE_SIZE);
+    const auto ok       = fdp::read_virtual_ranges(core, &buffer[0], &spans[0], spans.size(), read_dtb);
+    if(!ok)
+        return read_ranges_fallback(*this, ranges, count);
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        auto dst  = reinterpret_cast<uint8_t*>(ranges[i].dst);
+        auto ptr  = ranges[i].ptr;
+        auto left = ranges[i].size;
+        while(left)
+        {
+            const auto page  = utils::align<PAGE_SIZE>(ptr);
+            const auto skip  = ptr - page;
+            const auto chunk = std::min<size_t>(left, PAGE_SIZE - skip);
+            const auto idx   = std::lower_bound(pages.begin(), pages.end(), page) - pages.begin();
+            memcpy(dst, &buffer[idx * PAGE_SIZE + skip], chunk);
+            dst += chunk;
+            ptr += chunk;
+            left -= chunk;
+        }
+    }
+    return true;
+}
+
+namespace
+{
+    bool write_ranges_fallback(const memory::Io& io, const memory::write_range_t* ranges, size_t count)
+    {
+        auto ok = true;
+        for(size_t i = 0; i < count; ++i)
+            ok = io.write_all(ranges[i].ptr, ranges[i].src, ranges[i].size) && ok;
+        return ok;
+    }
+}
+
+bool memory::Io::write_many(const write_range_t* ranges, size_t count) const
+{
+    if(!count)
+        return true;
+
+    // collect the pages covering every range
+    auto pages = std::vector<uint64_t>{};
+    pages.reserve(count);
+    auto all_kernel = true;
+    auto all_user   = true;
+    for(size_t i = 0; i < count; ++i)
+    {
+        if(!ranges[i].size)
+            continue;
+
+        const auto is_kernel = ranges[i].ptr >= split; // pinned split, no os lookup per range
+        all_kernel &= is_kernel;
+        all_user &= !is_kernel;
+        const auto first = utils::align<PAGE_SIZE>(ranges[i].ptr);
+        const auto last  = utils::align<PAGE_SIZE>(ranges[i].ptr + ranges[i].size - 1);
+        for(auto page = first; page <= last; page += PAGE_SIZE)
+            pages.push_back(page);
+    }
+    std::sort(pages.begin(), pages.end());
+    pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+    if(pages.empty())
+        return true;
+
+    // per-range writes handle oversized batches & mixed kernel/user spaces
+    if(pages.size() > max_batched_pages || (proc && !all_kernel && !all_user))
+        return write_ranges_fallback(*this, ranges, count);
+
+    // one batched fetch of every touched page, then patch in place
+    auto spans = std::vector<span_t>{};
+    spans.reserve(pages.size());
+    for(const auto page : pages)
+        spans.push_back({page, PAGE_SIZE});
+
+    const auto rw_dtb = proc ? (all_kernel ? proc->kdtb : proc->udtb) : dtb;
+    auto       buffer = std::vector<uint8_t>(pages.size() * PAGE_SIZE);
+    const auto ok     = fdp::read_virtual_ranges(core, &buffer[0], &spans[0], spans.size(), rw_dtb);
+    if(!ok)
+        return write_ranges_fallback(*this, ranges, count);
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        auto src  = reinterpret_cast<const uint8_t*>(ranges[i].src);
+        auto ptr  = ranges[i].ptr;
+        auto left = ranges[i].size;
+        while(left)
+        {
+            const auto page  = utils::align<PAGE_SIZE>(ptr);
+            const auto skip  = ptr - page;
+            const auto chunk = std::min<size_t>(left, PAGE_SIZE - skip);
+            const auto idx   = std::lower_bound(pages.begin(), pages.end(), page) - pages.begin();
+            memcpy(&buffer[idx * PAGE_SIZE + skip], src, chunk);
+            src += chunk;
+            ptr += chunk;
+            left -= chunk;
+        }
+    }
+
+    // write back merged runs so adjacent pages go out in one command,
+    // through write_all to keep cache invalidation & generations right
+    auto wrote = true;
+    auto run   = size_t{0};
+    for(size_t i = 1; i <= pages.size(); ++i)
+    {
+        if(i < pages.size() && pages[i] == pages[i - 1] + PAGE_SIZE)
+            continue;
+
+        wrote = write_all(pages[run], &buffer[run * PAGE_SIZE], (i - run) * PAGE_SIZE) && wrote;
+        run   = i;
+    }
+    return wrote;
+}
+
+opt<std::string> memory::Io::read_cstr(uint64_t ptr, size_t max_size) const
+{
+    auto ret    = std::string{};
+    auto buffer = std::array<char, PAGE_SIZE>{};
+    while(ret.size() < max_size)
+    {
+        // never cross a page boundary within one fetch
+        const auto page  = utils::align<PAGE_SIZE>(ptr);
+        const auto skip  = ptr - page;
+        const auto chunk = std::min<size_t>(PAGE_SIZE - skip, max_size - ret.size());
+        const auto ok    = read_all(&buffer[0], ptr, chunk);
+        if(!ok)
+            return {};
+
+        const auto end = static_cast<const char*>(memchr(&buffer[0], 0, chunk));
+        ret.append(&buffer[0], end ? end - &buffer[0] : chunk);
+        if(end)
+            return ret;
+
+        ptr += chunk;
+    }
+    return ret;
+}
+
+opt<std::string> memory::Io::read_utf16(uint64_t ptr, size_t max_size) const
+{
+    auto raw    = std::vector<uint8_t>{};
+    auto buffer = std::array<uint8_t, PAGE_SIZE>{};
+    max_size &= ~size_t{1};
+    while(raw.size() < max_size)
+    {
+        const auto page  = utils::align<PAGE_SIZE>(ptr);
+        const auto skip  = ptr - page;
+        const auto chunk = std::min<size_t>((PAGE_SIZE - skip) & ~size_t{1}, max_size - raw.size());
+        const auto ok    = read_all(&buffer[0], ptr, chunk);
+        if(!ok)
+            return {};
+
+        auto end = chunk;
+        for(size_t i = 0; i + 1 < chunk; i += 2)
+            if(!buffer[i] && !buffer[i + 1])
+            {
+                end = i;
+                break;
+            }
+        raw.insert(raw.end(), &buffer[0], &buffer[end]);
+        if(end != chunk)
+            break;
+
+        ptr += chunk;
+    }
+    if(raw.empty())
+        return std::string{};
+
+    return utf8::from_utf16(&raw[0], &raw[0] + raw.size());
+}
+
 opt<phy_t> memory::Io::physical(uint64_t ptr) const
 {
     if(proc)
@@ -148,7 +377,7 @@ bool memory::Io::write(uint64_t dst, uint64_t arg) const
 bool memory::Io::write_all(uint64_t dst, const void* src, size_t size) const
 {
     if(proc)
-        return memory::write_virtual(core, *proc, dst, src, size);
+        return memory::write_virtual_with_proc_dtb(core, *proc, dst < split ? proc->udtb : proc->kdtb, dst, src, size);
 
     return memory::write_virtual_with_dtb(core, dtb, dst, src, size);
 }
@@ -35,6 +35,30 @@ opt<phy_t> os::virtual_to_physical(core::Core& core, proc_t* proc, dtb_t dtb, ui
     return core.os_->virtual_to_physical(proc, dtb, ptr);
 }
 
+opt<phy_t> os::virtual_to_physical_walk(core::Core& core, proc_t* proc, dtb_t dtb, uint64_t ptr)
+{
+    if(!core.os_)
+        return {};
+
+    return core.os_->virtual_to_physical_walk(proc, dtb, ptr);
+}
+
+bool os::residency_map(core::Core& core, proc_t* proc, dtb_t dtb, span_t span, uint8_t* states)
+{
+    if(!core.os_)
+        return false;
+
+    return core.os_->residency_map(proc, dtb, span, states);
+}
+
+size_t os::page_in(core::Core& core, proc_t proc, span_t span)
+{
+    if(!core.os_)
+        return 0;
+
+    return core.os_->page_in(proc, span);
+}
+
 void os::debug_print(core::Core& core)
 {
     return core.os_->debug_print();
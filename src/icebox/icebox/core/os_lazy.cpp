@@ -0,0 +1,374 @@
+#include "os.hpp"
+
+#define PRIVATE_CORE__
+#define FDP_MODULE "lazy"
+#include "core.hpp"
+#include "core_private.hpp"
+#include "interfaces/if_os.hpp"
+#include "log.hpp"
+
+namespace
+{
+    // stand-in os module for attach_lazy cores: the first call runs os
+    // detection, which swaps core.os_ to the detected module (or the
+    // none fallback), so later calls never go through this proxy again
+    struct Lazy
+        : public os::Module
+    {
+        explicit Lazy(core::Core& core)
+            : core_(core)
+        {
+        }
+
+        os::Module& resolve();
+
+        // os::IModule
+        bool        setup               () override;
+        bool        is_kernel_address   (uint64_t ptr) override;
+        uint64_t    kernel_split        () override;
+        bool        read_page           (void* dst, uint64_t ptr, proc_t* proc, dtb_t dtb) override;
+        bool        write_page          (uint64_t ptr, const void* src, proc_t* proc, dtb_t dtb) override;
+        opt<phy_t>  virtual_to_physical (proc_t* proc, dtb_t dtb, uint64_t ptr) override;
+        opt<phy_t>  virtual_to_physical_walk(proc_t* proc, dtb_t dtb, uint64_t ptr) override;
+        bool        residency_map       (proc_t* proc, dtb_t dtb, span_t span, uint8_t* states) override;
+        size_t      page_in             (proc_t proc, span_t span) override;
+        dtb_t       kernel_dtb          () override;
+
+        bool                proc_list       (process::on_proc_fn on_process) override;
+        opt<proc_t>         proc_current    () override;
+        opt<proc_t>         proc_find       (std::string_view name, flags_t flags) override;
+        opt<proc_t>         proc_find       (uint64_t pid) override;
+        opt<std::string>    proc_name       (proc_t proc) override;
+        bool                proc_is_valid   (proc_t proc) override;
+        uint64_t            proc_id         (proc_t proc) override;
+        flags_t             proc_flags      (proc_t proc) override;
+        void                proc_join       (proc_t proc, mode_e mode) override;
+        opt<proc_t>         proc_parent     (proc_t proc) override;
+
+        bool            thread_list     (proc_t proc, threads::on_thread_fn on_thread) override;
+        opt<thread_t>   thread_current  () override;
+        opt<uint64_t>   thread_current_slot() override;
+        opt<proc_t>     thread_proc     (thread_t thread) override;
+        opt<uint64_t>   thread_pc       (proc_t proc, thread_t thread) override;
+        uint64_t        thread_id       (proc_t proc, thread_t thread) override;
+        opt<thread_t>   thread_find     (uint64_t tid) override;
+        bool            thread_list_info(threads::on_info_fn on_info) override;
+
+        bool                mod_list(proc_t proc, modules::on_mod_fn on_module) override;
+        opt<std::string>    mod_name(proc_t proc, mod_t mod) override;
+        opt<span_t>         mod_span(proc_t proc, mod_t mod) override;
+        opt<mod_t>          mod_find(proc_t proc, uint64_t addr) override;
+
+        bool                vm_area_list    (proc_t proc, vm_area::on_vm_area_fn on_vm_area) override;
+        opt<vm_area_t>      vm_area_find    (proc_t proc, uint64_t addr) override;
+        void                vm_area_refresh (proc_t proc) override;
+        opt<span_t>         vm_area_span    (proc_t proc, vm_area_t vm_area) override;
+        vma_access_e        vm_area_access  (proc_t proc, vm_area_t vm_area) override;
+        vma_type_e          vm_area_type    (proc_t proc, vm_area_t vm_area) override;
+        opt<std::string>    vm_area_name    (proc_t proc, vm_area_t vm_area) override;
+
+        bool                driver_list (drivers::on_driver_fn on_driver) override;
+        opt<std::string>    driver_name (driver_t drv) override;
+        opt<span_t>         driver_span (driver_t drv) override;
+
+        opt<bpid_t> listen_proc_create  (const process::on_event_fn& on_create) override;
+        opt<bpid_t> listen_proc_delete  (const process::on_event_fn& on_delete) override;
+        opt<bpid_t> listen_thread_create(const threads::on_event_fn& on_create) override;
+        opt<bpid_t> listen_thread_delete(const threads::on_event_fn& on_delete) override;
+        opt<bpid_t> listen_mod_create   (proc_t proc, flags_t flags, const modules::on_event_fn& on_create) override;
+        opt<bpid_t> listen_drv_create   (const drivers::on_event_fn& on_drv) override;
+
+        opt<arg_t>  read_stack  (size_t index) override;
+        opt<arg_t>  read_arg    (size_t index) override;
+        bool        read_args   (arg_t* args, size_t count) override;
+        bool        write_arg   (size_t index, arg_t arg) override;
+
+        void debug_print() override;
+
+        core::Core& core_;
+        bool        tried_ = false;
+    };
+}
+
+std::unique_ptr<os::Module> os::make_lazy(core::Core& core)
+{
+    return std::make_unique<Lazy>(core);
+}
+
+os::Module& Lazy::resolve()
+{
+    if(!tried_)
+    {
+        tried_ = true;
+        LOG(INFO, "deferred os detection...");
+        core::detect(core_);
+    }
+    // detect replaced core.os_ with the detected module or the none
+    // fallback, this proxy is out of the dispatch path from now on
+    return *core_.os_;
+}
+
+bool Lazy::setup()
+{
+    return resolve().setup();
+}
+
+bool Lazy::is_kernel_address(uint64_t ptr)
+{
+    return resolve().is_kernel_address(ptr);
+}
+
+uint64_t Lazy::kernel_split()
+{
+    return resolve().kernel_split();
+}
+
+bool Lazy::read_page(void* dst, uint64_t ptr, proc_t* proc, dtb_t dtb)
+{
+    return resolve().read_page(dst, ptr, proc, dtb);
+}
+
+bool Lazy::write_page(uint64_t ptr, const void* src, proc_t* proc, dtb_t dtb)
+{
+    return resolve().write_page(ptr, src, proc, dtb);
+}
+
+opt<phy_t> Lazy::virtual_to_physical(proc_t* proc, dtb_t dtb, uint64_t ptr)
+{
+    return resolve().virtual_to_physical(proc, dtb, ptr);
+}
+
+opt<phy_t> Lazy::virtual_to_physical_walk(proc_t* proc, dtb_t dtb, uint64_t ptr)
+{
+    return resolve().virtual_to_physical_walk(proc, dtb, ptr);
+}
+
+bool Lazy::residency_map(proc_t* proc, dtb_t dtb, span_t span, uint8_t* states)
+{
+    return resolve().residency_map(proc, dtb, span, states);
+}
+
+size_t Lazy::page_in(proc_t proc, span_t span)
+{
+    return resolve().page_in(proc, span);
+}
+
+dtb_t Lazy::kernel_dtb()
+{
+    return resolve().kernel_dtb();
+}
+
+bool Lazy::proc_list(process::on_proc_fn on_process)
+{
+    return resolve().proc_list(std::move(on_process));
+}
+
+opt<proc_t> Lazy::proc_current()
+{
+    return resolve().proc_current();
+}
+
+opt<proc_t> Lazy::proc_find(std::string_view name, flags_t flags)
+{
+    return resolve().proc_find(name, flags);
+}
+
+opt<proc_t> Lazy::proc_find(uint64_t pid)
+{
+    return resolve().proc_find(pid);
+}
+
+opt<std::string> Lazy::proc_name(proc_t proc)
+{
+    return resolve().proc_name(proc);
+}
+
+bool Lazy::proc_is_valid(proc_t proc)
+{
+    return resolve().proc_is_valid(proc);
+}
+
+uint64_t Lazy::proc_id(proc_t proc)
+{
+    return resolve().proc_id(proc);
+}
+
+flags_t Lazy::proc_flags(proc_t proc)
+{
+    return resolve().proc_flags(proc);
+}
+
+void Lazy::proc_join(proc_t proc, mode_e mode)
+{
+    return resolve().proc_join(proc, mode);
+}
+
+opt<proc_t> Lazy::proc_parent(proc_t proc)
+{
+    return resolve().proc_parent(proc);
+}
+
+bool Lazy::thread_list(proc_t proc, threads::on_thread_fn on_thread)
+{
+    return resolve().thread_list(proc, std::move(on_thread));
+}
+
+opt<thread_t> Lazy::thread_current()
+{
+    return resolve().thread_current();
+}
+
+opt<uint64_t> Lazy::thread_current_slot()
+{
+    return resolve().thread_current_slot();
+}
+
+opt<proc_t> Lazy::thread_proc(thread_t thread)
+{
+    return resolve().thread_proc(thread);
+}
+
+opt<uint64_t> Lazy::thread_pc(proc_t proc, thread_t thread)
+{
+    return resolve().thread_pc(proc, thread);
+}
+
+uint64_t Lazy::thread_id(proc_t proc, thread_t thread)
+{
+    return resolve().thread_id(proc, thread);
+}
+
+opt<thread_t> Lazy::thread_find(uint64_t tid)
+{
+    return resolve().thread_find(tid);
+}
+
+bool Lazy::thread_list_info(threads::on_info_fn on_info)
+{
+    return resolve().thread_list_info(std::move(on_info));
+}
+
+bool Lazy::mod_list(proc_t proc, modules::on_mod_fn on_module)
+{
+    return resolve().mod_list(proc, std::move(on_module));
+}
+
+opt<std::string> Lazy::mod_name(proc_t proc, mod_t mod)
+{
+    return resolve().mod_name(proc, mod);
+}
+
+opt<span_t> Lazy::mod_span(proc_t proc, mod_t mod)
+{
+    return resolve().mod_span(proc, mod);
+}
+
+opt<mod_t> Lazy::mod_find(proc_t proc, uint64_t addr)
+{
+    return resolve().mod_find(proc, addr);
+}
+
+bool Lazy::vm_area_list(proc_t proc, vm_area::on_vm_area_fn on_vm_area)
+{
+    return resolve().vm_area_list(proc, std::move(on_vm_area));
+}
+
+opt<vm_area_t> Lazy::vm_area_find(proc_t proc, uint64_t addr)
+{
+    return resolve().vm_area_find(proc, addr);
+}
+
+void Lazy::vm_area_refresh(proc_t proc)
+{
+    return resolve().vm_area_refresh(proc);
+}
+
+opt<span_t> Lazy::vm_area_span(proc_t proc, vm_area_t vm_area)
+{
+    return resolve().vm_area_span(proc, vm_area);
+}
+
+vma_access_e Lazy::vm_area_access(proc_t proc, vm_area_t vm_area)
+{
+    return resolve().vm_area_access(proc, vm_area);
+}
+
+vma_type_e Lazy::vm_area_type(proc_t proc, vm_area_t vm_area)
+{
+    return resolve().vm_area_type(proc, vm_area);
+}
+
+opt<std::string> Lazy::vm_area_name(proc_t proc, vm_area_t vm_area)
+{
+    return resolve().vm_area_name(proc, vm_area);
+}
+
+bool Lazy::driver_list(drivers::on_driver_fn on_driver)
+{
+    return resolve().driver_list(std::move(on_driver));
+}
+
+opt<std::string> Lazy::driver_name(driver_t drv)
+{
+    return resolve().driver_name(drv);
+}
+
+opt<span_t> Lazy::driver_span(driver_t drv)
+{
+    return resolve().driver_span(drv);
+}
+
+opt<bpid_t> Lazy::listen_proc_create(const process::on_event_fn& on_create)
+{
+    return resolve().listen_proc_create(on_create);
+}
+
+opt<bpid_t> Lazy::listen_proc_delete(const process::on_event_fn& on_delete)
+{
+    return resolve().listen_proc_delete(on_delete);
+}
+
+opt<bpid_t> Lazy::listen_thread_create(const threads::on_event_fn& on_create)
+{
+    return resolve().listen_thread_create(on_create);
+}
+
+opt<bpid_t> Lazy::listen_thread_delete(const threads::on_event_fn& on_delete)
+{
+    return resolve().listen_thread_delete(on_delete);
+}
+
+opt<bpid_t> Lazy::listen_mod_create(proc_t proc, flags_t flags, const modules::on_event_fn& on_create)
+{
+    return resolve().listen_mod_create(proc, flags, on_create);
+}
+
+opt<bpid_t> Lazy::listen_drv_create(const drivers::on_event_fn& on_drv)
+{
+    return resolve().listen_drv_create(on_drv);
+}
+
+opt<arg_t> Lazy::read_stack(size_t index)
+{
+    return resolve().read_stack(index);
+}
+
+opt<arg_t> Lazy::read_arg(size_t index)
+{
+    return resolve().read_arg(index);
+}
+
+bool Lazy::read_args(arg_t* args, size_t count)
+{
+    return resolve().read_args(args, count);
+}
+
+bool Lazy::write_arg(size_t index, arg_t arg)
+{
+    return resolve().write_arg(index, arg);
+}
+
+void Lazy::debug_print()
+{
+    return resolve().debug_print();
+}
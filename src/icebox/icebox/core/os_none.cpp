@@ -13,9 +13,13 @@ namespace
         // os::IModule
         bool        setup               () override;
         bool        is_kernel_address   (uint64_t ptr) override;
+        uint64_t    kernel_split        () override;
         bool        read_page           (void* dst, uint64_t ptr, proc_t* proc, dtb_t dtb) override;
         bool        write_page          (uint64_t ptr, const void* src, proc_t* proc, dtb_t dtb) override;
         opt<phy_t>  virtual_to_physical (proc_t* proc, dtb_t dtb, uint64_t ptr) override;
+        opt<phy_t>  virtual_to_physical_walk(proc_t* proc, dtb_t dtb, uint64_t ptr) override;
+        bool        residency_map       (proc_t* proc, dtb_t dtb, span_t span, uint8_t* states) override;
+        size_t      page_in             (proc_t proc, span_t span) override;
         dtb_t       kernel_dtb          () override;
 
         bool                proc_list       (process::on_proc_fn on_process) override;
@@ -31,9 +35,12 @@ namespace
 
         bool            thread_list     (proc_t proc, threads::on_thread_fn on_thread) override;
         opt<thread_t>   thread_current  () override;
+        opt<uint64_t>   thread_current_slot() override;
         opt<proc_t>     thread_proc     (thread_t thread) override;
         opt<uint64_t>   thread_pc       (proc_t proc, thread_t thread) override;
         uint64_t        thread_id       (proc_t proc, thread_t thread) override;
+        opt<thread_t>   thread_find     (uint64_t tid) override;
+        bool            thread_list_info(threads::on_info_fn on_info) override;
 
         bool                mod_list(proc_t proc, modules::on_mod_fn on_module) override;
         opt<std::string>    mod_name(proc_t proc, mod_t mod) override;
@@ -42,6 +49,7 @@ namespace
 
         bool                vm_area_list    (proc_t proc, vm_area::on_vm_area_fn on_vm_area) override;
         opt<vm_area_t>      vm_area_find    (proc_t proc, uint64_t addr) override;
+        void                vm_area_refresh (proc_t proc) override;
         opt<span_t>         vm_area_span    (proc_t proc, vm_area_t vm_area) override;
         vma_access_e        vm_area_access  (proc_t proc, vm_area_t vm_area) override;
         vma_type_e          vm_area_type    (proc_t proc, vm_area_t vm_area) override;
@@ -60,6 +68,7 @@ namespace
 
         opt<arg_t>  read_stack  (size_t index) override;
         opt<arg_t>  read_arg    (size_t index) override;
+        bool        read_args   (arg_t* args, size_t count) override;
         bool        write_arg   (size_t index, arg_t arg) override;
 
         void debug_print() override;
@@ -116,6 +125,26 @@ bool None::is_kernel_address(uint64_t /*ptr*/)
     return true;
 }
 
+uint64_t None::kernel_split()
+{
+    return 0; // every address is treated as kernel
+}
+
+opt<phy_t> None::virtual_to_physical_walk(proc_t* /*proc*/, dtb_t /*dtb*/, uint64_t /*ptr*/)
+{
+    return {};
+}
+
+bool None::residency_map(proc_t* /*proc*/, dtb_t /*dtb*/, span_t /*span*/, uint8_t* /*states*/)
+{
+    return false;
+}
+
+size_t None::page_in(proc_t /*proc*/, span_t /*span*/)
+{
+    return 0;
+}
+
 opt<phy_t> None::virtual_to_physical(proc_t* /*proc*/, dtb_t /*dtb*/, uint64_t /*ptr*/)
 {
     return {};
@@ -160,6 +189,11 @@ opt<thread_t> None::thread_current()
     return {};
 }
 
+opt<uint64_t> None::thread_current_slot()
+{
+    return {};
+}
+
 opt<proc_t> None::thread_proc(thread_t /*thread*/)
 {
     return {};
@@ -175,6 +209,16 @@ uint64_t None::thread_id(proc_t /*proc*/, thread_t /*thread*/)
     return {};
 }
 
+opt<thread_t> None::thread_find(uint64_t /*tid*/)
+{
+    return {};
+}
+
+bool None::thread_list_info(threads::on_info_fn /*on_info*/)
+{
+    return true;
+}
+
 bool None::mod_list(proc_t /*proc*/, modules::on_mod_fn /*on_module*/)
 {
     return true;
@@ -205,6 +249,10 @@ opt<vm_area_t> None::vm_area_find(proc_t /*proc*/, uint64_t /*addr*/)
     return {};
 }
 
+void None::vm_area_refresh(proc_t /*proc*/)
+{
+}
+
 opt<span_t> None::vm_area_span(proc_t /*proc*/, vm_area_t /*vm_area*/)
 {
     return {};
@@ -250,6 +298,11 @@ opt<arg_t> None::read_arg(size_t /*index*/)
     return {};
 }
 
+bool None::read_args(arg_t* /*args*/, size_t /*count*/)
+{
+    return false;
+}
+
 bool None::write_arg(size_t /*index*/, arg_t /*arg*/)
 {
     return false;
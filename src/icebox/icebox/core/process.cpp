@@ -6,6 +6,7 @@
 #include "core_private.hpp"
 #include "interfaces/if_os.hpp"
 #include "log.hpp"
+#include "symbols.hpp"
 
 bool process::list(core::Core& core, process::on_proc_fn on_proc)
 {
@@ -52,6 +53,14 @@ void process::join(core::Core& core, proc_t proc, mode_e mode)
     return core.os_->proc_join(proc, mode);
 }
 
+// same as join but symbol loading rides the background prefetchers
+// instead of blocking the caller, see symbols::load_modules_deferred
+void process::join_deferred(core::Core& core, proc_t proc, mode_e mode)
+{
+    core.os_->proc_join(proc, mode);
+    symbols::load_modules_deferred(core, proc);
+}
+
 opt<proc_t> process::parent(core::Core& core, proc_t proc)
 {
     return core.os_->proc_parent(proc);
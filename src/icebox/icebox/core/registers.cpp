@@ -1,66 +1,209 @@
 #include "registers.hpp"
 
+#define FDP_MODULE "regs"
 #define PRIVATE_CORE__
+#include "core.hpp"
+#include "core_private.hpp"
+#include "counters.hpp"
 #include "fdp.hpp"
+#include "utils/utils.hpp"
+
+#include <array>
+
+namespace
+{
+    template <typename T>
+    using RegArray = std::array<opt<uint64_t>, static_cast<size_t>(T::last) + 1>;
+}
+
+struct registers::Registers
+{
+    // values are stable while the vm stays paused
+    uint64_t          epoch = ~0ull;
+    RegArray<reg_e>   regs;
+    RegArray<msr_e>   msrs;
+};
+
+std::shared_ptr<registers::Registers> registers::setup()
+{
+    return std::make_shared<Registers>();
+}
+
+namespace
+{
+    registers::Registers& sync_cache(core::Core& core)
+    {
+        auto& cache      = *core.regs_;
+        const auto epoch = memory::cache_generation(core);
+        if(cache.epoch != epoch)
+        {
+            cache.regs.fill({});
+            cache.msrs.fill({});
+            cache.epoch = epoch;
+        }
+        return cache;
+    }
+
+    template <typename T>
+    opt<uint64_t>& slot_of(RegArray<T>& regs, T reg)
+    {
+        return regs[static_cast<size_t>(reg)];
+    }
+}
+
+opt<registers::snapshot_t> registers::snapshot(core::Core& core)
+{
+    CHANNEL_SCOPE();
+    const auto ctx = fdp::read_cpu_context(core);
+    if(!ctx)
+        return {};
+
+    auto snap           = snapshot_t{};
+    snap.rip            = ctx->rip;
+    snap.rax            = ctx->rax;
+    snap.rcx            = ctx->rcx;
+    snap.rdx            = ctx->rdx;
+    snap.rbx            = ctx->rbx;
+    snap.rsp            = ctx->rsp;
+    snap.rbp            = ctx->rbp;
+    snap.rsi            = ctx->rsi;
+    snap.rdi            = ctx->rdi;
+    snap.r8             = ctx->r8;
+    snap.r9             = ctx->r9;
+    snap.r10            = ctx->r10;
+    snap.r11            = ctx->r11;
+    snap.r12            = ctx->r12;
+    snap.r13            = ctx->r13;
+    snap.r14            = ctx->r14;
+    snap.r15            = ctx->r15;
+    snap.es             = ctx->es;
+    snap.cs             = ctx->cs;
+    snap.ss             = ctx->ss;
+    snap.ds             = ctx->ds;
+    snap.fs             = ctx->fs;
+    snap.gs             = ctx->gs;
+    snap.rflags         = ctx->rflags;
+    snap.cr0            = ctx->cr0;
+    snap.cr2            = ctx->cr2;
+    snap.cr3            = ctx->cr3;
+    snap.cr4            = ctx->cr4;
+    snap.lstar          = ctx->msr_lstar;
+    snap.gs_base        = ctx->msr_gs_base;
+    snap.kernel_gs_base = ctx->msr_kernel_gs_base;
+    snap.tsc            = ctx->msr_tsc;
+
+    // one context read warms the whole per-pause cache
+    auto& cache                                  = sync_cache(core);
+    slot_of(cache.regs, reg_e::rip)              = ctx->rip;
+    slot_of(cache.regs, reg_e::rsp)              = ctx->rsp;
+    slot_of(cache.regs, reg_e::rbp)              = ctx->rbp;
+    slot_of(cache.regs, reg_e::rax)              = ctx->rax;
+    slot_of(cache.regs, reg_e::rbx)              = ctx->rbx;
+    slot_of(cache.regs, reg_e::rcx)              = ctx->rcx;
+    slot_of(cache.regs, reg_e::rdx)              = ctx->rdx;
+    slot_of(cache.regs, reg_e::rsi)              = ctx->rsi;
+    slot_of(cache.regs, reg_e::rdi)              = ctx->rdi;
+    slot_of(cache.regs, reg_e::r8)               = ctx->r8;
+    slot_of(cache.regs, reg_e::r9)               = ctx->r9;
+    slot_of(cache.regs, reg_e::r10)              = ctx->r10;
+    slot_of(cache.regs, reg_e::r11)              = ctx->r11;
+    slot_of(cache.regs, reg_e::r12)              = ctx->r12;
+    slot_of(cache.regs, reg_e::r13)              = ctx->r13;
+    slot_of(cache.regs, reg_e::r14)              = ctx->r14;
+    slot_of(cache.regs, reg_e::r15)              = ctx->r15;
+    slot_of(cache.regs, reg_e::cs)               = ctx->cs;
+    slot_of(cache.regs, reg_e::cr3)              = ctx->cr3;
+    slot_of(cache.msrs, msr_e::lstar)            = ctx->msr_lstar;
+    slot_of(cache.msrs, msr_e::gs_base)          = ctx->msr_gs_base;
+    slot_of(cache.msrs, msr_e::kernel_gs_base)   = ctx->msr_kernel_gs_base;
+    slot_of(cache.msrs, msr_e::tsc)              = ctx->msr_tsc;
+    return snap;
+}
 
 uint64_t registers::read(core::Core& core, reg_e reg)
 {
+    CHANNEL_SCOPE();
+    auto& cache = sync_cache(core);
+    auto& slot  = slot_of(cache.regs, reg);
+    if(slot)
+        return *slot;
+
     const auto ret = fdp::read_register(core, reg);
-    return ret ? *ret : 0;
+    if(!ret)
+        return 0;
+
+    slot = *ret;
+    return *ret;
 }
 
 bool registers::write(core::Core& core, reg_e reg, uint64_t value)
 {
-    return fdp::write_register(core, reg, value);
+    CHANNEL_SCOPE();
+    if(reg == reg_e::cr3)
+        memory::flush_tlb(core);
+    const auto ok = fdp::write_register(core, reg, value);
+    if(ok)
+        slot_of(sync_cache(core).regs, reg) = value;
+    return ok;
 }
 
 uint64_t registers::read_msr(core::Core& core, msr_e reg)
 {
+    CHANNEL_SCOPE();
+    auto& cache = sync_cache(core);
+    auto& slot  = slot_of(cache.msrs, reg);
+    if(slot)
+        return *slot;
+
     const auto ret = fdp::read_msr_register(core, reg);
-    return ret ? *ret : 0;
+    if(!ret)
+        return 0;
+
+    slot = *ret;
+    return *ret;
 }
 
 bool registers::write_msr(core::Core& core, msr_e reg, uint64_t value)
 {
-    return fdp::write_msr_register(core, reg, value);
+    CHANNEL_SCOPE();
+    const auto ok = fdp::write_msr_register(core, reg, value);
+    if(ok)
+        slot_of(sync_cache(core).msrs, reg) = value;
+    return ok;
 }
 
-std::string_view registers::to_string(reg_e reg)
+namespace
 {
-    switch(reg)
+    // constexpr tables in enum declaration order, see enums.hpp
+    constexpr std::string_view g_reg_names[] =
     {
-        case reg_e::cs:     return "cs";
-        case reg_e::rsp:    return "rsp";
-        case reg_e::rip:    return "rip";
-        case reg_e::rbp:    return "rbp";
-        case reg_e::cr3:    return "cr3";
-        case reg_e::cr8:    return "cr8";
-        case reg_e::rax:    return "rax";
-        case reg_e::rbx:    return "rbx";
-        case reg_e::rcx:    return "rcx";
-        case reg_e::rdx:    return "rdx";
-        case reg_e::rsi:    return "rsi";
-        case reg_e::rdi:    return "rdi";
-        case reg_e::r8:     return "r8";
-        case reg_e::r9:     return "r9";
-        case reg_e::r10:    return "r10";
-        case reg_e::r11:    return "r11";
-        case reg_e::r12:    return "r12";
-        case reg_e::r13:    return "r13";
-        case reg_e::r14:    return "r14";
-        case reg_e::r15:    return "r15";
-    }
-    return "?";
+        "rip", "rsp", "rbp", "rax", "rbx", "rcx", "rdx", "rsi", "rdi",
+        "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
+        "cs", "cr3", "cr8",
+    };
+    static_assert(COUNT_OF(g_reg_names) == static_cast<size_t>(reg_e::last) + 1, "unnamed reg_e value");
+
+    constexpr std::string_view g_msr_names[] =
+    {
+        "lstar", "fs_base", "gs_base", "kernel_gs_base", "tsc",
+    };
+    static_assert(COUNT_OF(g_msr_names) == static_cast<size_t>(msr_e::last) + 1, "unnamed msr_e value");
+}
+
+std::string_view registers::to_string(reg_e reg)
+{
+    const auto idx = static_cast<size_t>(reg);
+    if(idx >= COUNT_OF(g_reg_names))
+        return "?";
+
+    return g_reg_names[idx];
 }
 
 std::string_view registers::to_string(msr_e reg)
 {
-    switch(reg)
-    {
-        case msr_e::lstar:          return "lstar";
-        case msr_e::fs_base:        return "fs_base";
-        case msr_e::gs_base:        return "gs_base";
-        case msr_e::kernel_gs_base: return "kernel_gs_base";
-    }
-    return "?";
+    const auto idx = static_cast<size_t>(reg);
+    if(idx >= COUNT_OF(g_msr_names))
+        return "?";
+
+    return g_msr_names[idx];
 }
@@ -0,0 +1,174 @@
+#include "scanner.hpp"
+
+#define PRIVATE_CORE__
+#define FDP_MODULE "scanner"
+#include "core.hpp"
+#include "core_private.hpp"
+#include "fdp.hpp"
+#include "log.hpp"
+#include "memory.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+    // large chunks keep the transport bandwidth-bound instead of latency-bound
+    constexpr size_t chunk_size = 4 * 1024 * 1024;
+
+    struct chunk_t
+    {
+        uint64_t             phy;
+        std::vector<uint8_t> data;
+    };
+
+    // memchr anchors every candidate on the first pattern byte & memcmp verifies
+    // the remainder, both run on the vectorized libc implementations
+    void scan_exact(const chunk_t& chunk, size_t limit, const std::vector<uint8_t>& bytes, size_t pattern, std::vector<scanner::match_t>& matches)
+    {
+        const auto* begin = &chunk.data[0];
+        const auto* end   = begin + chunk.data.size() - bytes.size() + 1;
+        const auto* ptr   = begin;
+        while(ptr < end)
+        {
+            ptr = static_cast<const uint8_t*>(memchr(ptr, bytes[0], end - ptr));
+            if(!ptr)
+                return;
+
+            const auto at = static_cast<uint64_t>(ptr - begin);
+            if(at >= limit)
+                return;
+
+            if(!memcmp(ptr, &bytes[0], bytes.size()))
+                matches.push_back({phy_t{chunk.phy + at}, pattern});
+            ++ptr;
+        }
+    }
+
+    void scan_masked(const chunk_t& chunk, size_t limit, const scanner::pattern_t& pat, size_t pattern, std::vector<scanner::match_t>& matches)
+    {
+        const auto* begin = &chunk.data[0];
+        const auto* end   = begin + chunk.data.size() - pat.bytes.size() + 1;
+        for(const auto* ptr = begin; ptr < end; ++ptr)
+        {
+            const auto at = static_cast<uint64_t>(ptr - begin);
+            if(at >= limit)
+                return;
+
+            auto found = true;
+            for(size_t i = 0; found && i < pat.bytes.size(); ++i)
+                found = (ptr[i] & pat.mask[i]) == pat.bytes[i];
+            if(found)
+                matches.push_back({phy_t{chunk.phy + at}, pattern});
+        }
+    }
+
+    // report matches starting below limit only, the tail overlaps the next chunk
+    void scan_chunk(const chunk_t& chunk, size_t limit, const std::vector<scanner::pattern_t>& patterns, std::vector<scanner::match_t>& matches)
+    {
+        for(size_t p = 0; p < patterns.size(); ++p)
+        {
+            const auto& pat = patterns[p];
+            if(pat.bytes.empty() || chunk.data.size() < pat.bytes.size())
+                continue;
+
+            if(pat.mask.empty())
+                scan_exact(chunk, limit, pat.bytes, p, matches);
+            else
+                scan_masked(chunk, limit, pat, p, matches);
+        }
+    }
+}
+
+bool scanner::scan_physical(core::Core& core, const std::vector<pattern_t>& patterns, const on_match_fn& on_match)
+{
+    auto max_len = size_t{};
+    for(const auto& pat : patterns)
+    {
+        if(!pat.mask.empty() && pat.mask.size() != pat.bytes.size())
+            return FAIL(false, "pattern mask size mismatch");
+
+        max_len = std::max(max_len, pat.bytes.size());
+    }
+    if(!max_len)
+        return true;
+
+    const auto ram_size = fdp::physical_memory_size(core);
+    if(!ram_size)
+        return FAIL(false, "unable to read physical memory size");
+
+    const auto nthreads   = std::max(std::thread::hardware_concurrency(), 1u);
+    const auto max_queued = size_t{2} * nthreads;
+    auto       mutex      = std::mutex{};
+    auto       cv_work    = std::condition_variable{};
+    auto       cv_room    = std::condition_variable{};
+    auto       queue      = std::deque<chunk_t>{};
+    auto       matches    = std::vector<match_t>{};
+    auto       done       = false;
+
+    auto workers = std::vector<std::thread>{};
+    workers.reserve(nthreads);
+    for(auto i = 0u; i < nthreads; ++i)
+        workers.emplace_back([&]
+        {
+            auto local = std::vector<match_t>{};
+            while(true)
+            {
+                auto lock = std::unique_lock<std::mutex>{mutex};
+                cv_work.wait(lock, [&] { return done || !queue.empty(); });
+                if(queue.empty())
+                    return;
+
+                const auto chunk = std::move(queue.front());
+                queue.pop_front();
+                lock.unlock();
+                cv_room.notify_one();
+
+                // the tail past chunk_size belongs to the next chunk
+                local.clear();
+                scan_chunk(chunk, chunk_size, patterns, local);
+                if(local.empty())
+                    continue;
+
+                lock.lock();
+                matches.insert(matches.end(), local.begin(), local.end());
+            }
+        });
+
+    // fdp serializes guest reads, one producer streams overlapping chunks
+    for(uint64_t phy = 0; phy < *ram_size; phy += chunk_size)
+    {
+        const auto size  = std::min<uint64_t>(chunk_size + max_len - 1, *ram_size - phy);
+        auto       chunk = chunk_t{phy, std::vector<uint8_t>(size)};
+        const auto ok    = fdp::read_physical(core, &chunk.data[0], phy_t{phy}, size);
+        if(!ok)
+            continue; // unbacked ranges (mmio holes) are skipped
+
+        auto lock = std::unique_lock<std::mutex>{mutex};
+        cv_room.wait(lock, [&] { return queue.size() < max_queued; });
+        queue.push_back(std::move(chunk));
+        lock.unlock();
+        cv_work.notify_one();
+    }
+    {
+        const auto lock = std::lock_guard<std::mutex>{mutex};
+        done            = true;
+    }
+    cv_work.notify_all();
+    for(auto& worker : workers)
+        worker.join();
+
+    std::sort(matches.begin(), matches.end(), [](const match_t& a, const match_t& b)
+    {
+        return a.phy.val != b.phy.val ? a.phy.val < b.phy.val : a.pattern < b.pattern;
+    });
+    for(const auto& match : matches)
+        if(on_match(match) == walk_e::stop)
+            break;
+
+    return true;
+}
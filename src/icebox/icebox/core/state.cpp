@@ -4,16 +4,36 @@
 #define FDP_MODULE "state"
 #include "core.hpp"
 #include "core_private.hpp"
+#include "counters.hpp"
 #include "fdp.hpp"
 #include "interfaces/if_os.hpp"
 #include "log.hpp"
+#include "utils/arena.hpp"
+#include "utils/flat_map.hpp"
+#include "utils/small_vector.hpp"
+#include "utils/utils.hpp"
 
+#include <FDP.h>
 #include <libco.h>
 
+#ifdef _MSC_VER
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
 #include <deque>
 #include <map>
 #include <thread>
+#include <unordered_map>
 
 namespace std
 {
@@ -42,6 +62,11 @@ namespace
     {
         opt<dtb_t> dtb;
         int        id;
+        bool       filtered = false; // server-side thread filter installed
+        bool       hardware = false; // promoted to a debug register
+        bool       one_shot = false; // server disarms on first hit
+        uint64_t   hits     = 0;
+        uint64_t   last_hit = 0;     // rotation recency, see evict_coldest
     };
 
     struct BreakpointObserver
@@ -62,12 +87,17 @@ namespace
         opt<proc_t>   proc;
         opt<thread_t> thread;
         int           bpid;
+        bool          once = false; // expires on first hit
     };
 
     using Breakers  = std::unordered_map<phy_t, Breakpoint>;
+    // virtual (disarmed) targets per physical page, armed on page hit
+    using VirtualPages = std::unordered_map<uint64_t, std::vector<phy_t>>;
     using Observer  = std::shared_ptr<BreakpointObserver>;
-    using Observers = std::multimap<phy_t, Observer>;
-    using Buffer    = std::vector<uint8_t>;
+    // inline capacity covers every observer of a typical hit
+    using ObserverList = utils::small_vector<Observer, 16>;
+    // contiguous observer array per phy address, one probe per hit
+    using Observers = flat::map<phy_t, std::vector<Observer>>;
 
     template <typename T>
     struct Pool
@@ -100,19 +130,163 @@ namespace
         buffers_t buffers;
     };
 
-    constexpr auto g_stack_size = 0x400000; // 4mb stack size
+    constexpr auto g_stack_size = size_t{0x400000}; // default 4mb stack size
+
+    size_t stack_page_size()
+    {
+#ifdef _MSC_VER
+        auto info = SYSTEM_INFO{};
+        GetSystemInfo(&info);
+        return info.dwPageSize;
+#else
+        return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    }
+
+    size_t worker_stack_size()
+    {
+        // override the default with _ICEBOX_STACK_SIZE, in bytes
+        const auto env  = getenv("_ICEBOX_STACK_SIZE");
+        const auto size = env ? strtoull(env, nullptr, 0) : 0;
+        const auto page = stack_page_size();
+        return size ? (size + page - 1) & ~(page - 1) : g_stack_size;
+    }
+
+    // lazily-committed worker stack, one unreadable guard page below
+    struct Stack
+    {
+        Stack()
+            : guard_(stack_page_size())
+            , size_(worker_stack_size())
+        {
+#ifdef _MSC_VER
+            base_ = VirtualAlloc(nullptr, guard_ + size_, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+            auto old = DWORD{};
+            if(base_)
+                VirtualProtect(base_, guard_, PAGE_NOACCESS, &old);
+#else
+            base_ = mmap(nullptr, guard_ + size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(base_ == MAP_FAILED)
+                base_ = nullptr;
+            if(base_)
+                mprotect(base_, guard_, PROT_NONE);
+#endif
+        }
+
+        ~Stack()
+        {
+            if(!base_)
+                return;
+
+#ifdef _MSC_VER
+            VirtualFree(base_, 0, MEM_RELEASE);
+#else
+            munmap(base_, guard_ + size_);
+#endif
+        }
+
+        Stack(const Stack&) = delete;
+        Stack& operator=(const Stack&) = delete;
+
+        void* data()
+        {
+            return base_ ? static_cast<uint8_t*>(base_) + guard_ : nullptr;
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+        // hand touched pages back while keeping the mapping pooled
+        void decommit()
+        {
+            if(!base_)
+                return;
+
+#ifdef _MSC_VER
+            VirtualAlloc(data(), size_, MEM_RESET, PAGE_READWRITE);
+#else
+            madvise(data(), size_, MADV_DONTNEED);
+#endif
+        }
+
+        void*  base_ = nullptr;
+        size_t guard_;
+        size_t size_;
+    };
 
     struct Worker
     {
-        Buffer buffer        = Buffer(g_stack_size);
+        Stack buffer;
         cothread_t co_thread = nullptr;
         uint64_t seq_id      = 0;     // current sequence id
         bool finished        = false; // worker thread is dead
+        std::string name;             // observer name, for instrumentation
+        arena::Arena arena;           // event-scoped temporaries, reset on release
     };
 
     using WorkerPool  = Pool<Worker>;
     using Workers     = std::vector<std::unique_ptr<Worker>>;
     using Breakpoints = std::multimap<uint64_t, state::Breakpoint>;
+
+    struct MemWatch
+    {
+        std::string        name;
+        uint64_t           ptr;
+        uint64_t           size;
+        bpid_t             id;
+        int                fdpid;
+        state::on_watch_fn on_access;
+    };
+    using Watches = std::vector<MemWatch>;
+
+    // code bytes decoded by check_watches, keyed by rip; watch faults
+    // hammer the same few sites, so skip re-reading guest code until a
+    // write path invalidates it, see memory::write_generation
+    struct CachedCode
+    {
+        uint64_t                generation;
+        uint64_t                cr3;
+        std::array<uint8_t, 16> bytes;
+    };
+    using CodeCache = std::unordered_map<uint64_t, CachedCode>;
+
+    constexpr size_t max_cached_code = 0x1000;
+
+    struct ObserverStats
+    {
+        uint64_t hits      = 0;
+        uint64_t task_ns   = 0;
+        uint64_t paused_ns = 0;
+        std::array<uint64_t, 32> histogram = {};
+    };
+    using Stats = std::unordered_map<std::string, ObserverStats>;
+
+    // per-stage accumulator of the cross-layer latency budget,
+    // see state::latency_budget for the stage order & meaning
+    struct StageStats
+    {
+        uint64_t count    = 0;
+        uint64_t total_ns = 0;
+        std::array<uint64_t, 32> histogram = {};
+    };
+    constexpr const char* stage_names[] = {"trap", "canal", "wake", "dispatch", "resume"};
+    using Budget                        = std::array<StageStats, COUNT_OF(stage_names)>;
+
+    // one open latency span per popped breakpoint event; dispatch is
+    // single-threaded, so a fresh event before the closing resume just
+    // drops the unfinished span instead of mixing two round trips
+    struct Span
+    {
+        bool     open            = false;
+        uint64_t event_id        = 0;
+        uint64_t trap_ns         = 0;
+        uint64_t publish_ns      = 0;
+        uint64_t wake_ns         = 0;
+        uint64_t dispatch_beg_ns = 0;
+        uint64_t dispatch_end_ns = 0;
+    };
 }
 
 struct state::State
@@ -122,8 +296,22 @@ struct state::State
         , last_bpid{}
         , breakphy{}
         , co_main(co_active())
-        , pool(16)
+        , pool(64)
     {
+        observers.reserve(128); // sized once, breakpoint dispatch never rehashes
+    }
+
+    ~State()
+    {
+        notify_stop = true;
+        if(notifier.joinable())
+            notifier.join();
+#ifndef _MSC_VER
+        if(notify_rd >= 0)
+            close(notify_rd);
+        if(notify_wr >= 0)
+            close(notify_wr);
+#endif
     }
 
     core::Core& core;
@@ -135,6 +323,37 @@ struct state::State
     cothread_t  co_main;
     WorkerPool  pool;
     Workers     workers;
+
+    // scratch buffer reused across breakpoint hits
+    ObserverList pending;
+
+    // per-observer instrumentation, keyed by observer name
+    Stats stats;
+
+    // cross-layer latency budget, see state::latency_budget
+    Budget budget;
+    Span   span;
+
+    // client-side breakpoint virtualization, see arm_page_siblings
+    uint64_t     hit_seq     = 0;
+    size_t       armed_count = 0;
+    VirtualPages virtual_pages;
+
+    // active data watches, see state::watch_memory
+    Watches   watches;
+    CodeCache code_cache;
+
+    // flight recorder, see state::flight_recorder & state::rewind
+    uint64_t flight_interval  = 0;
+    uint64_t flight_events    = 0;
+    bool     flight_replaying = false;
+
+    // event notifier, see state::wait_fd
+    std::thread       notifier;
+    std::atomic<bool> notified    = false;
+    std::atomic<bool> notify_stop = false;
+    int               notify_rd   = -1;
+    int               notify_wr   = -1;
 };
 
 std::shared_ptr<state::State> state::setup(core::Core& core)
@@ -146,13 +365,85 @@ namespace
 {
     using Data = state::State;
 
+    uint64_t elapsed_ns(const std::chrono::steady_clock::time_point& begin)
+    {
+        const auto end = std::chrono::steady_clock::now();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    }
+
+    // bucket i counts time slices in [2^i, 2^i+1) nanoseconds
+    // slices are inclusive of nested waits run from the task
+    void account_task(Data& d, const std::string& name, uint64_t ns)
+    {
+        auto& stats = d.stats[name];
+        stats.task_ns += ns;
+        auto bucket = size_t{};
+        while(bucket + 1 < stats.histogram.size() && (uint64_t{1} << (bucket + 1)) <= ns)
+            ++bucket;
+        ++stats.histogram[bucket];
+    }
+
+    uint64_t now_ns()
+    {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+
+    // server & client clocks share the monotonic base but replayed
+    // sessions carry stale stamps, a backwards stage clamps to zero
+    uint64_t stage_ns(uint64_t begin, uint64_t end)
+    {
+        return end > begin ? end - begin : 0;
+    }
+
+    void account_stage(Data& d, size_t stage, uint64_t ns)
+    {
+        auto& stats = d.budget[stage];
+        ++stats.count;
+        stats.total_ns += ns;
+        auto bucket = size_t{};
+        while(bucket + 1 < stats.histogram.size() && (uint64_t{1} << (bucket + 1)) <= ns)
+            ++bucket;
+        ++stats.histogram[bucket];
+    }
+
+    void open_span(Data& d, const fdp::event& ev)
+    {
+        if(!(ev.state & (FDP_STATE_BREAKPOINT_HIT | FDP_STATE_HARD_BREAKPOINT_HIT)))
+            return;
+
+        d.span = Span{true, ev.event_id, ev.trap_ns, ev.publish_ns, ev.wake_ns, 0, 0};
+    }
+
+    void close_span(Data& d, uint64_t resume_ns)
+    {
+        auto& span = d.span;
+        if(!span.open)
+            return;
+
+        span.open = false;
+        // events resumed without dispatching any observer close the
+        // wake stage straight into the resume command
+        if(!span.dispatch_beg_ns)
+            span.dispatch_beg_ns = span.dispatch_end_ns = resume_ns;
+        account_stage(d, 0, stage_ns(span.trap_ns, span.publish_ns));
+        account_stage(d, 1, stage_ns(span.publish_ns, span.wake_ns));
+        account_stage(d, 2, stage_ns(span.wake_ns, span.dispatch_beg_ns));
+        account_stage(d, 3, stage_ns(span.dispatch_beg_ns, span.dispatch_end_ns));
+        account_stage(d, 4, stage_ns(span.dispatch_end_ns, resume_ns));
+    }
+
     bool run_workers(Data& d)
     {
         auto resumed = false;
         for(const auto& h : d.workers)
         {
             const auto seq_id = h->seq_id;
+            const auto begin  = std::chrono::steady_clock::now();
+            const auto prev   = arena::set_current(&h->arena);
             co_switch(h->co_thread);
+            arena::set_current(prev);
+            account_task(d, h->name, elapsed_ns(begin));
             resumed = resumed || seq_id != h->seq_id;
         }
         return resumed;
@@ -171,8 +462,9 @@ namespace
     {
         d.workers.emplace_back(d.pool.acquire());
         auto& w            = *d.workers.back();
+        w.name             = observer->name;
         g_co_ctx           = {&d, observer};
-        const auto co_next = co_derive(w.buffer.data(), g_stack_size, []
+        const auto co_next = co_derive(w.buffer.data(), static_cast<unsigned int>(w.buffer.size()), []
         {
             const auto co_main = g_co_ctx.pstate->co_main;
             {
@@ -191,7 +483,11 @@ namespace
             // we must unwind everything before last switch
             co_switch(co_main);
         });
+        const auto begin = std::chrono::steady_clock::now();
+        const auto prev  = arena::set_current(&w.arena);
         co_switch(co_next);
+        arena::set_current(prev);
+        account_task(d, observer->name, elapsed_ns(begin));
     }
 
     template <typename T, typename U>
@@ -207,12 +503,14 @@ namespace
             if(!h->finished)
                 return false;
 
+            h->buffer.decommit();
+            h->arena.reset();
             d.pool.release(std::move(h));
             return true;
         });
     }
 
-    void exec_breakpoints(Data& d, const std::vector<Observer>& observers)
+    void exec_breakpoints(Data& d, const ObserverList& observers)
     {
         const auto resumed = run_workers(d);
         if(!resumed)
@@ -251,9 +549,12 @@ namespace
 
     bool update_break_state(Data& d)
     {
-        d.breakphy     = {};
-        const auto rip = registers::read(d.core, reg_e::rip);
-        const auto dtb = dtb_t{registers::read(d.core, reg_e::cr3)};
+        memory::flush_caches(d.core);
+        d.breakphy = {};
+        // refresh the whole register file once per break event
+        const auto regs = registers::snapshot(d.core);
+        const auto rip  = regs ? regs->rip : registers::read(d.core, reg_e::rip);
+        const auto dtb  = dtb_t{regs ? regs->cr3 : registers::read(d.core, reg_e::cr3)};
         const auto phy = memory::virtual_to_physical_with_dtb(d.core, dtb, rip);
         if(!phy)
             return FAIL(false, "unable to get current physical address");
@@ -283,6 +584,7 @@ namespace
 
     bool try_single_step(core::Core& core)
     {
+        memory::flush_caches(core);
         return fdp::step_once(core);
     }
 
@@ -299,39 +601,207 @@ namespace
             if(!try_single_step(d.core))
                 return false;
 
+        memory::flush_caches(d.core);
         const auto resumed = fdp::resume(d.core);
         if(!resumed)
             return FAIL(false, "unable to resume");
 
+        close_span(d, now_ns());
         return true;
     }
 }
 
 bool state::pause(core::Core& core)
 {
+    CHANNEL_SCOPE();
     return try_pause(*core.state_);
 }
 
 bool state::resume(core::Core& core)
 {
+    CHANNEL_SCOPE();
     return try_resume(*core.state_);
 }
 
 bool state::single_step(core::Core& core)
 {
+    CHANNEL_SCOPE();
     return try_single_step(core);
 }
 
+opt<registers::snapshot_t> state::step_many(core::Core& core, uint64_t count, opt<uint64_t> until)
+{
+    CHANNEL_SCOPE();
+    if(!count)
+        return registers::snapshot(core);
+
+    auto& d = *core.state_;
+    memory::flush_caches(core);
+    const auto steps = fdp::single_step_many(core, count, until ? *until : 0);
+    if(!steps)
+    {
+        // old servers step one instruction per round trip
+        for(uint64_t i = 0; i < count; ++i)
+        {
+            if(!fdp::step_once(core))
+                return {};
+
+            if(until && registers::read(core, reg_e::rip) == *until)
+                break;
+        }
+    }
+
+    const auto updated = update_break_state(d);
+    if(!updated)
+        return {};
+
+    return registers::snapshot(core);
+}
+
 namespace
 {
-    template <typename T>
-    void lookup_observers(Observers& observers, phy_t phy, T operand)
+    // the server caps live slots at FDP_MAX_BREAKPOINT; the full target
+    // set stays client-side, only recently-active targets own a slot &
+    // the rest wait virtual until their page gets hit
+    constexpr size_t max_armed_targets = FDP_MAX_BREAKPOINT - 64; // headroom for watches & cr3 breakpoints
+
+    uint64_t page_of(phy_t phy)
     {
-        // fast observer lookup while allowing current iterator deletion
-        const auto end = observers.end();
-        for(auto it = observers.lower_bound(phy); it != end && it->first == phy; /**/)
-            if(operand(it++) == walk_e::stop)
+        return phy.val & ~uint64_t{0xFFF};
+    }
+
+    void forget_virtual(Data& d, phy_t phy)
+    {
+        const auto it = d.virtual_pages.find(page_of(phy));
+        if(it == d.virtual_pages.end())
+            return;
+
+        auto&      phys   = it->second;
+        const auto target = std::find_if(phys.begin(), phys.end(), [&](phy_t x) { return x.val == phy.val; });
+        if(target != phys.end())
+            phys.erase(target);
+        if(phys.empty())
+            d.virtual_pages.erase(it);
+    }
+
+    void mark_virtual(Data& d, phy_t phy, Breakpoint& target)
+    {
+        target.id = -1;
+        d.virtual_pages[page_of(phy)].push_back(phy);
+        const auto it = d.observers.find(phy);
+        if(it == d.observers.end())
+            return;
+
+        for(const auto& observer : it->second)
+            observer->bpid = -1;
+    }
+
+    bool evict_coldest(Data& d)
+    {
+        auto coldest = d.targets.end();
+        for(auto it = d.targets.begin(); it != d.targets.end(); ++it)
+        {
+            auto& target = it->second;
+            // pinned targets keep their slot, server-side predicates &
+            // debug registers would not survive a rotation
+            if(target.id < 0 || target.hardware || target.filtered || target.one_shot)
+                continue;
+
+            if(it->first.val == d.breakphy.val)
+                continue;
+
+            if(coldest == d.targets.end() || target.last_hit < coldest->second.last_hit)
+                coldest = it;
+        }
+        if(coldest == d.targets.end())
+            return false;
+
+        fdp::unset_breakpoint(d.core, coldest->second.id);
+        --d.armed_count;
+        mark_virtual(d, coldest->first, coldest->second);
+        return true;
+    }
+
+    int arm_target(Data& d, phy_t phy, Breakpoint& target)
+    {
+        if(d.armed_count >= max_armed_targets && !evict_coldest(d))
+            return -1;
+
+        const auto dtb_val = target.dtb ? target.dtb->val : 0;
+        auto       bpid    = fdp::set_breakpoint(d.core, FDP_SOFTHBP, 0, FDP_EXECUTE_BP, FDP_PHYSICAL_ADDRESS, phy.val, 1, dtb_val);
+        if(bpid < 0 && evict_coldest(d))
+            bpid = fdp::set_breakpoint(d.core, FDP_SOFTHBP, 0, FDP_EXECUTE_BP, FDP_PHYSICAL_ADDRESS, phy.val, 1, dtb_val);
+        if(bpid < 0)
+            return -1;
+
+        target.id       = bpid;
+        target.last_hit = ++d.hit_seq;
+        ++d.armed_count;
+        const auto it = d.observers.find(phy);
+        if(it != d.observers.end())
+            for(const auto& observer : it->second)
+                observer->bpid = bpid;
+        return bpid;
+    }
+
+    // page activation is the rotation signal: a hit on a page means its
+    // virtual siblings are about to execute, arm them in one batch
+    void arm_page_siblings(Data& d, phy_t phy)
+    {
+        const auto it = d.virtual_pages.find(page_of(phy));
+        if(it == d.virtual_pages.end())
+            return;
+
+        auto pending = std::move(it->second);
+        d.virtual_pages.erase(it);
+        while(d.armed_count + pending.size() > max_armed_targets)
+            if(!evict_coldest(d))
                 break;
+
+        auto descs = std::vector<fdp::breakpoint_desc>{};
+        auto phys  = std::vector<phy_t>{};
+        descs.reserve(pending.size());
+        phys.reserve(pending.size());
+        for(const auto& target_phy : pending)
+        {
+            const auto target = d.targets.find(target_phy);
+            if(target == d.targets.end() || target->second.id >= 0)
+                continue;
+
+            if(d.armed_count + descs.size() >= max_armed_targets)
+            {
+                d.virtual_pages[page_of(target_phy)].push_back(target_phy);
+                continue;
+            }
+
+            const auto dtb_val = target->second.dtb ? target->second.dtb->val : 0;
+            descs.push_back({FDP_SOFTHBP, FDP_EXECUTE_BP, FDP_PHYSICAL_ADDRESS, target_phy.val, 1, dtb_val});
+            phys.push_back(target_phy);
+        }
+        if(descs.empty())
+            return;
+
+        auto       bpids = std::vector<int>(descs.size());
+        const auto ok    = fdp::set_breakpoints(d.core, descs.data(), descs.size(), bpids.data());
+        for(size_t i = 0; i < phys.size(); ++i)
+        {
+            auto& target = d.targets.find(phys[i])->second;
+            if(!ok || bpids[i] < 0)
+            {
+                d.virtual_pages[page_of(phys[i])].push_back(phys[i]);
+                continue;
+            }
+
+            target.id       = bpids[i];
+            target.last_hit = ++d.hit_seq;
+            ++d.armed_count;
+            const auto ju = d.observers.find(phys[i]);
+            if(ju == d.observers.end())
+                continue;
+
+            for(const auto& observer : ju->second)
+                observer->bpid = bpids[i];
+        }
     }
 }
 
@@ -345,31 +815,36 @@ struct state::BreakpointPrivate
 
     ~BreakpointPrivate()
     {
-        auto& d              = *core_.state_;
-        bool unique_observer = true;
-        opt<Observers::iterator> target;
-        lookup_observers(d.observers, observer_->phy, [&](auto it)
-        {
-            if(observer_ == it->second)
-                target = it;
-            else
-                unique_observer = false;
-            if(target && !unique_observer)
-                return walk_e::stop;
-
-            return walk_e::next;
-        });
-        if(!target)
+        auto& d       = *core_.state_;
+        const auto it = d.observers.find(observer_->phy);
+        if(it == d.observers.end())
             return;
 
-        d.observers.erase(*target);
-        if(!unique_observer)
+        auto&      siblings = it->second;
+        const auto target   = std::find(siblings.begin(), siblings.end(), observer_);
+        if(target == siblings.end())
             return;
 
-        const auto ok = fdp::unset_breakpoint(core_, observer_->bpid);
-        if(!ok)
-            LOG(ERROR, "unable to remove breakpoint %d", observer_->bpid);
+        siblings.erase(target);
+        if(!siblings.empty())
+            return;
 
+        d.observers.erase(it);
+        const auto breaker = d.targets.find(observer_->phy);
+        if(breaker != d.targets.end())
+        {
+            if(breaker->second.id >= 0)
+            {
+                const auto ok = fdp::unset_breakpoint(core_, breaker->second.id);
+                if(!ok)
+                    LOG(ERROR, "unable to remove breakpoint %d", breaker->second.id);
+                --d.armed_count;
+            }
+            else
+            {
+                forget_virtual(d, observer_->phy);
+            }
+        }
         d.targets.erase(observer_->phy);
     }
 
@@ -379,40 +854,317 @@ struct state::BreakpointPrivate
 
 namespace
 {
+    phy_t breakpoint_phy(const state::BreakpointPrivate& bp)
+    {
+        return bp.observer_->phy;
+    }
+}
+
+namespace
+{
+    // scarce debug registers, keep them for the hottest targets
+    constexpr size_t   max_hardware_slots = 4;
+    constexpr uint64_t promote_threshold  = 64;
+
+    void reinstall_target(Data& d, phy_t phy, Breakpoint& target, FDP_BreakpointType type)
+    {
+        fdp::unset_breakpoint(d.core, target.id);
+        const auto dtb_val = target.dtb ? target.dtb->val : 0;
+        auto       bpid    = fdp::set_breakpoint(d.core, type, 0, FDP_EXECUTE_BP, FDP_PHYSICAL_ADDRESS, phy.val, 1, dtb_val);
+        if(bpid < 0 && type != FDP_SOFTHBP)
+        {
+            // the server ran out of debug registers, stay software
+            type = FDP_SOFTHBP;
+            bpid = fdp::set_breakpoint(d.core, type, 0, FDP_EXECUTE_BP, FDP_PHYSICAL_ADDRESS, phy.val, 1, dtb_val);
+        }
+        if(bpid < 0)
+        {
+            LOG(ERROR, "unable to reinstall breakpoint phy:0x%" PRIx64, phy.val);
+            return;
+        }
+
+        target.id       = bpid;
+        target.hardware = type == FDP_HARDHBP;
+        const auto it   = d.observers.find(phy);
+        if(it == d.observers.end())
+            return;
+
+        for(const auto& observer : it->second)
+            observer->bpid = bpid;
+    }
+
+    void maybe_promote_target(Data& d, phy_t phy, Breakpoint& target)
+    {
+        if(target.hardware || target.hits < promote_threshold)
+            return;
+
+        auto used    = size_t{};
+        auto coldest = d.targets.end();
+        for(auto it = d.targets.begin(); it != d.targets.end(); ++it)
+        {
+            if(!it->second.hardware)
+                continue;
+
+            ++used;
+            if(coldest == d.targets.end() || it->second.hits < coldest->second.hits)
+                coldest = it;
+        }
+        if(used >= max_hardware_slots)
+        {
+            // demote the coldest slot only for a clearly hotter target
+            if(coldest->second.hits * 2 >= target.hits)
+                return;
+
+            reinstall_target(d, coldest->first, coldest->second, FDP_SOFTHBP);
+        }
+        reinstall_target(d, phy, target, FDP_HARDHBP);
+    }
+
+    // minimal x86 effective-address decoder: legacy prefixes & rex are
+    // skipped, the opcode is assumed to be followed by its mod/rm byte,
+    // which holds for the mov-class instructions that touch data; the
+    // caller filters the result against the watched span, so a wrongly
+    // decoded instruction is dropped instead of misreported
+    opt<uint64_t> decode_access(const uint8_t* buf, size_t size, const registers::snapshot_t& regs)
+    {
+        auto i   = size_t{0};
+        auto rex = uint8_t{0};
+        while(i < size)
+        {
+            const auto op        = buf[i];
+            const auto is_prefix = op == 0x26 || op == 0x2e || op == 0x36 || op == 0x3e
+                                   || op == 0x64 || op == 0x65 || op == 0x66 || op == 0x67
+                                   || op == 0xf0 || op == 0xf2 || op == 0xf3;
+            if(!is_prefix)
+                break;
+
+            ++i;
+        }
+        if(i < size && (buf[i] & 0xf0) == 0x40)
+            rex = buf[i++];
+
+        if(i < size && buf[i] == 0x0f)
+            ++i; // two-byte opcode
+        ++i;     // opcode
+        if(i >= size)
+            return {};
+
+        const auto modrm = buf[i++];
+        const auto mod   = modrm >> 6;
+        const auto rm    = modrm & 7;
+        if(mod == 3)
+            return {}; // register-only operand
+
+        const uint64_t gprs[] =
+        {
+            regs.rax, regs.rcx, regs.rdx, regs.rbx, regs.rsp, regs.rbp, regs.rsi, regs.rdi,
+            regs.r8, regs.r9, regs.r10, regs.r11, regs.r12, regs.r13, regs.r14, regs.r15,
+        };
+        auto addr       = uint64_t{0};
+        auto has_disp32 = mod == 2;
+        if(rm == 4)
+        {
+            if(i >= size)
+                return {};
+
+            const auto sib   = buf[i++];
+            const auto scale = sib >> 6;
+            const auto index = ((sib >> 3) & 7) | ((rex & 2) << 2);
+            const auto base  = (sib & 7) | ((rex & 1) << 3);
+            if(index != 4)
+                addr += gprs[index] << scale;
+            if((sib & 7) == 5 && mod == 0)
+                has_disp32 = true;
+            else
+                addr += gprs[base];
+        }
+        else if(rm == 5 && mod == 0)
+            return {}; // rip-relative, needs the full instruction length
+        else
+            addr += gprs[rm | ((rex & 1) << 3)];
+
+        if(mod == 1)
+        {
+            if(i >= size)
+                return {};
+
+            addr += static_cast<uint64_t>(static_cast<int64_t>(static_cast<int8_t>(buf[i])));
+        }
+        else if(has_disp32)
+        {
+            if(i + 4 > size)
+                return {};
+
+            auto disp = int32_t{};
+            memcpy(&disp, &buf[i], sizeof disp);
+            addr += static_cast<uint64_t>(static_cast<int64_t>(disp));
+        }
+        return addr;
+    }
+
+    void check_watches(Data& d)
+    {
+        if(d.watches.empty())
+            return;
+
+        const auto regs = registers::snapshot(d.core);
+        if(!regs)
+            return;
+
+        auto buf       = std::array<uint8_t, 16>{};
+        const auto gen = memory::write_generation(d.core);
+        const auto it  = d.code_cache.find(regs->rip);
+        if(it != d.code_cache.end() && it->second.generation == gen && it->second.cr3 == regs->cr3)
+        {
+            buf = it->second.bytes;
+        }
+        else
+        {
+            const auto ok = memory::read_virtual_with_dtb(d.core, dtb_t{regs->cr3}, &buf[0], regs->rip, sizeof buf);
+            if(!ok)
+                return;
+
+            if(d.code_cache.size() >= max_cached_code)
+                d.code_cache.clear();
+            d.code_cache[regs->rip] = CachedCode{gen, regs->cr3, buf};
+        }
+
+        const auto addr = decode_access(&buf[0], sizeof buf, *regs);
+        if(!addr)
+            return;
+
+        for(const auto& watch : d.watches)
+        {
+            // address filter: page traps fire for the whole page, only
+            // accesses inside the watched span are reported
+            if(*addr < watch.ptr || *addr >= watch.ptr + watch.size)
+                continue;
+
+            LOG(INFO, "%s: 0x%" PRIx64 " accessed from rip 0x%" PRIx64, watch.name.data(), *addr, regs->rip);
+            if(watch.on_access)
+                watch.on_access({regs->rip, *addr});
+        }
+    }
+
+    // one-shot observers expire before their task runs, so further
+    // hits & nested waits can never dispatch them twice; the last
+    // observer tears the target down, skipping the unset round-trip
+    // when the server already disarmed itself
+    void expire_one_shots(Data& d, phy_t phy, const ObserverList& observers)
+    {
+        auto any = false;
+        for(const auto& observer : observers)
+            any |= observer->once;
+        if(!any)
+            return;
+
+        const auto it = d.observers.find(phy);
+        if(it == d.observers.end())
+            return;
+
+        auto& siblings = it->second;
+        for(const auto& observer : observers)
+        {
+            if(!observer->once)
+                continue;
+
+            const auto target = std::find(siblings.begin(), siblings.end(), observer);
+            if(target != siblings.end())
+                siblings.erase(target);
+        }
+        if(!siblings.empty())
+            return;
+
+        d.observers.erase(it);
+        const auto target = d.targets.find(phy);
+        if(target == d.targets.end())
+            return;
+
+        if(target->second.id >= 0)
+        {
+            if(!target->second.one_shot)
+                fdp::unset_breakpoint(d.core, target->second.id);
+            --d.armed_count;
+        }
+        else
+        {
+            forget_virtual(d, phy);
+        }
+        d.targets.erase(target);
+    }
+
     void check_breakpoints(Data& d)
     {
         const auto state = fdp::state(d.core);
         if(!state)
             return;
 
-        if(!(*state & FDP_STATE_BREAKPOINT_HIT))
+        if(!(*state & (FDP_STATE_BREAKPOINT_HIT | FDP_STATE_HARD_BREAKPOINT_HIT)))
             return;
 
-        auto observers  = std::vector<Observer>{};
-        auto opt_thread = opt<thread_t>{};
-        auto opt_proc   = opt<proc_t>{};
-        lookup_observers(d.observers, d.breakphy, [&](auto it)
+        // flight recorder: refresh the snapshot every interval events so
+        // a rewind never replays more than one interval forward
+        if(d.flight_interval)
         {
-            const auto& bp        = *it->second;
-            const auto has_filter = bp.thread || bp.proc;
-            if(has_filter && !opt_thread)
-                opt_thread = threads::current(d.core);
+            if(!d.flight_replaying && d.flight_events >= d.flight_interval)
+                if(fdp::save_incremental(d.core))
+                    d.flight_events = 0;
+            ++d.flight_events;
+        }
 
-            if(bp.thread && bp.thread != opt_thread)
-                return walk_e::next;
+        const auto target = d.targets.find(d.breakphy);
+        if(target != d.targets.end())
+        {
+            ++target->second.hits;
+            target->second.last_hit = ++d.hit_seq;
+            maybe_promote_target(d, d.breakphy, target->second);
+            arm_page_siblings(d, d.breakphy);
+        }
 
-            if(bp.proc && !opt_proc)
-                opt_proc = threads::process(d.core, *opt_thread);
+        const auto begin = std::chrono::steady_clock::now();
+        if(d.span.open)
+            d.span.dispatch_beg_ns = now_ns();
+        // recycle the scratch buffer, nested waits steal & restore it
+        auto observers = std::move(d.pending);
+        observers.clear();
+        auto opt_thread = opt<thread_t>{};
+        auto opt_proc   = opt<proc_t>{};
+        const auto it   = d.observers.find(d.breakphy);
+        if(it != d.observers.end())
+            for(const auto& observer : it->second)
+            {
+                const auto& bp        = *observer;
+                const auto has_filter = bp.thread || bp.proc;
+                if(has_filter && !opt_thread)
+                    opt_thread = threads::current(d.core);
 
-            if(bp.proc && bp.proc != opt_proc)
-                return walk_e::next;
+                if(bp.thread && bp.thread != opt_thread)
+                    continue;
 
-            if(bp.task)
-                observers.push_back(it->second);
+                if(bp.proc && !opt_proc)
+                    opt_proc = threads::process(d.core, *opt_thread);
 
-            return walk_e::next;
-        });
+                if(bp.proc && bp.proc != opt_proc)
+                    continue;
+
+                if(bp.task)
+                    observers.push_back(observer);
+            }
+        if(it == d.observers.end())
+            check_watches(d);
+        expire_one_shots(d, d.breakphy, observers);
         exec_breakpoints(d, observers);
+        if(d.span.open)
+            d.span.dispatch_end_ns = now_ns();
+        const auto paused = elapsed_ns(begin);
+        for(const auto& observer : observers)
+        {
+            counters::bump(counters::get().breakpoint_hits);
+            auto& stats = d.stats[observer->name];
+            ++stats.hits;
+            stats.paused_ns += paused;
+        }
+        d.pending = std::move(observers);
     }
 
     enum class breakpoints_e
@@ -432,10 +1184,14 @@ namespace
         while(true)
         {
             std::this_thread::yield();
-            const auto ok = fdp::state_changed(d.core);
+            // drain the event channel first, one shared memory read
+            // instead of a state round trip per poll
+            auto ev       = fdp::event{};
+            const auto ok = fdp::next_event(d.core, ev) || fdp::state_changed(d.core);
             if(!ok)
                 continue;
 
+            open_span(d, ev);
             if(state == state_e::update)
                 update_break_state(d);
             if(check == breakpoints_e::update)
@@ -447,24 +1203,103 @@ namespace
 
 bool state::wait(core::Core& core)
 {
+    CHANNEL_SCOPE();
     auto& d = *core.state_;
     return try_wait(d, state_e::update, breakpoints_e::update);
 }
 
 void state::exec(core::Core& core)
 {
+    CHANNEL_SCOPE();
     state::resume(core);
     state::wait(core);
 }
 
 void state::wait_for(core::Core& core, int timeout_ms)
 {
+    CHANNEL_SCOPE();
     const auto now      = std::chrono::steady_clock::now();
     const auto deadline = now + std::chrono::milliseconds(timeout_ms);
     while(std::chrono::steady_clock::now() < deadline)
         state::exec(core);
 }
 
+namespace
+{
+    void drain_notifications(Data& d)
+    {
+#ifndef _MSC_VER
+        if(d.notify_rd >= 0)
+        {
+            uint8_t buf[16];
+            while(read(d.notify_rd, buf, sizeof buf) > 0)
+                continue;
+        }
+#endif
+        d.notified = false;
+    }
+}
+
+bool state::poll(core::Core& core, int timeout_ms)
+{
+    CHANNEL_SCOPE();
+    auto&      d        = *core.state_;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while(true)
+    {
+        auto ev       = fdp::event{};
+        const auto ok = fdp::next_event(d.core, ev) || fdp::state_changed(d.core);
+        if(ok)
+        {
+            open_span(d, ev);
+            drain_notifications(d);
+            update_break_state(d);
+            check_breakpoints(d);
+            return true;
+        }
+        if(std::chrono::steady_clock::now() >= deadline)
+            return false;
+
+        std::this_thread::yield();
+    }
+}
+
+int state::wait_fd(core::Core& core)
+{
+#ifdef _MSC_VER
+    (void) core;
+    return -1; // select()-able handles are posix-only for now
+#else
+    auto& d = *core.state_;
+    if(d.notify_rd >= 0)
+        return d.notify_rd;
+
+    int fds[2];
+    if(pipe(fds))
+        return FAIL(-1, "unable to create a notification pipe");
+
+    fcntl(fds[0], F_SETFL, O_NONBLOCK);
+    fcntl(fds[1], F_SETFL, O_NONBLOCK);
+    d.notify_rd = fds[0];
+    d.notify_wr = fds[1];
+    d.notifier  = std::thread{[&d]
+    {
+        // non-consuming peeks only, the embedder thread drains the channel
+        while(!d.notify_stop)
+        {
+            if(!d.notified && fdp::has_pending_events(d.core))
+            {
+                const auto one = uint8_t{1};
+                const auto n   = write(d.notify_wr, &one, 1);
+                d.notified     = n == 1;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }};
+    return d.notify_rd;
+#endif
+}
+
 namespace
 {
     opt<int> try_add_breakpoint(core::Core& core, std::string_view name, phy_t phy, opt<dtb_t> dtb)
@@ -480,7 +1315,16 @@ namespace
                 return it->second.id;
 
             // filtering rules are too restrictive, remove old breakpoint & add an unfiltered breakpoint
-            const auto ok = fdp::unset_breakpoint(core, it->second.id);
+            auto ok = true;
+            if(it->second.id >= 0)
+            {
+                ok = fdp::unset_breakpoint(core, it->second.id);
+                --d.armed_count;
+            }
+            else
+            {
+                forget_virtual(d, phy);
+            }
             targets.erase(it);
             if(!ok)
                 return std::nullopt;
@@ -489,33 +1333,64 @@ namespace
             dtb = {};
         }
 
-        const auto dtb_val = dtb ? dtb->val : 0;
-        const auto bpid    = fdp::set_breakpoint(core, FDP_SOFTHBP, 0, FDP_EXECUTE_BP, FDP_PHYSICAL_ADDRESS, phy.val, 1, dtb_val);
+        auto&      target = targets.emplace(phy, Breakpoint{dtb, -1}).first->second;
+        const auto bpid   = arm_target(d, phy, target);
         if(bpid < 0)
-            return FAIL(std::nullopt, "unable to set breakpoint %s phy:0x%" PRIx64 " dtb:0x%" PRIx64, std::string{name}.data(), phy.val, dtb_val);
-
-        targets.emplace(phy, Breakpoint{dtb, bpid});
+        {
+            // out of server slots: the target stays virtual & is armed
+            // when its page next activates
+            LOG(INFO, "virtualized breakpoint %s phy:0x%" PRIx64, std::string{name}.data(), phy.val);
+            mark_virtual(d, phy, target);
+        }
         return bpid;
     }
 
-    state::Breakpoint set_physical_breakpoint(core::Core& core, std::string_view name, phy_t phy, const opt<dtb_t>& dtb, opt<proc_t> proc, const opt<thread_t>& thread, const state::Task& task)
+    state::Breakpoint set_physical_breakpoint(core::Core& core, std::string_view name, phy_t phy, const opt<dtb_t>& dtb, opt<proc_t> proc, const opt<thread_t>& thread, bool once, const state::Task& task)
     {
         auto& d = *core.state_;
         if(thread && !proc)
             proc = threads::process(core, *thread);
 
-        const auto bp   = std::make_shared<BreakpointObserver>(task, name, phy, proc, thread);
+        const auto bp = std::make_shared<BreakpointObserver>(task, name, phy, proc, thread);
+        bp->once      = once;
         const auto bpid = try_add_breakpoint(core, std::string{name}, phy, dtb);
         if(!bpid)
             return {};
 
         // update all observers breakpoint id
-        d.observers.emplace(phy, bp);
-        lookup_observers(d.observers, phy, [&](auto it)
+        auto& siblings = d.observers[phy];
+        siblings.push_back(bp);
+        for(const auto& observer : siblings)
+            observer->bpid = *bpid;
+
+        // push the thread predicate server-side while a single filtered
+        // observer owns this breakpoint, so foreign hits resume in the
+        // hypervisor; old servers fail & hits stay filtered client-side
+        const auto target = d.targets.find(phy);
+        if(target != d.targets.end() && *bpid >= 0)
         {
-            it->second->bpid = *bpid;
-            return walk_e::next;
-        });
+            if(siblings.size() == 1 && thread)
+            {
+                if(const auto slot = core.os_->thread_current_slot())
+                    target->second.filtered = fdp::set_breakpoint_filter(core, *bpid, dtb ? dtb->val : 0, *slot, thread->id);
+            }
+            else if(target->second.filtered)
+            {
+                // shared breakpoints match every hit again
+                fdp::set_breakpoint_filter(core, *bpid, 0, 0, 0);
+                target->second.filtered = false;
+            }
+
+            // a sole one-shot observer lets the server disarm on hit,
+            // sharing the target falls back to the client round-trip
+            if(siblings.size() == 1 && once)
+                target->second.one_shot = fdp::set_breakpoint_one_shot(core, *bpid, true);
+            else if(target->second.one_shot)
+            {
+                fdp::set_breakpoint_one_shot(core, *bpid, false);
+                target->second.one_shot = false;
+            }
+        }
         return std::make_shared<state::BreakpointPrivate>(core, bp);
     }
 
@@ -524,7 +1399,7 @@ namespace
         return core.os_->is_kernel_address(ptr) ? proc.kdtb : proc.udtb;
     }
 
-    state::Breakpoint set_virtual_breakpoint(core::Core& core, std::string_view name, uint64_t ptr, const opt<proc_t>& proc, const opt<thread_t>& thread, const state::Task& task)
+    state::Breakpoint set_virtual_breakpoint(core::Core& core, std::string_view name, uint64_t ptr, const opt<proc_t>& proc, const opt<thread_t>& thread, bool once, const state::Task& task)
     {
         const auto opt_proc = proc ? proc : thread ? threads::process(core, *thread) : process::current(core);
         if(!opt_proc)
@@ -536,33 +1411,48 @@ namespace
 
         const auto dtb     = dtb_select(core, *opt_proc, ptr);
         const auto opt_dtb = proc || thread ? std::make_optional(dtb) : std::nullopt;
-        return set_physical_breakpoint(core, name, *opt_phy, opt_dtb, proc, thread, task);
+        return set_physical_breakpoint(core, name, *opt_phy, opt_dtb, proc, thread, once, task);
     }
 }
 
 state::Breakpoint state::break_on(core::Core& core, std::string_view name, uint64_t ptr, const state::Task& task)
 {
-    return set_virtual_breakpoint(core, name, ptr, {}, {}, task);
+    return set_virtual_breakpoint(core, name, ptr, {}, {}, false, task);
 }
 
 state::Breakpoint state::break_on_process(core::Core& core, std::string_view name, proc_t proc, uint64_t ptr, const state::Task& task)
 {
-    return set_virtual_breakpoint(core, name, ptr, proc, {}, task);
+    return set_virtual_breakpoint(core, name, ptr, proc, {}, false, task);
 }
 
 state::Breakpoint state::break_on_thread(core::Core& core, std::string_view name, thread_t thread, uint64_t ptr, const state::Task& task)
 {
-    return set_virtual_breakpoint(core, name, ptr, {}, thread, task);
+    return set_virtual_breakpoint(core, name, ptr, {}, thread, false, task);
+}
+
+state::Breakpoint state::break_on_once(core::Core& core, std::string_view name, uint64_t ptr, const state::Task& task)
+{
+    return set_virtual_breakpoint(core, name, ptr, {}, {}, true, task);
+}
+
+state::Breakpoint state::break_on_process_once(core::Core& core, std::string_view name, proc_t proc, uint64_t ptr, const state::Task& task)
+{
+    return set_virtual_breakpoint(core, name, ptr, proc, {}, true, task);
+}
+
+state::Breakpoint state::break_on_thread_once(core::Core& core, std::string_view name, thread_t thread, uint64_t ptr, const state::Task& task)
+{
+    return set_virtual_breakpoint(core, name, ptr, {}, thread, true, task);
 }
 
 state::Breakpoint state::break_on_physical(core::Core& core, std::string_view name, phy_t phy, const state::Task& task)
 {
-    return set_physical_breakpoint(core, name, phy, {}, {}, {}, task);
+    return set_physical_breakpoint(core, name, phy, {}, {}, {}, false, task);
 }
 
 state::Breakpoint state::break_on_physical_process(core::Core& core, std::string_view name, dtb_t dtb, phy_t phy, const state::Task& task)
 {
-    return set_physical_breakpoint(core, name, phy, dtb, {}, {}, task);
+    return set_physical_breakpoint(core, name, phy, dtb, {}, {}, false, task);
 }
 
 namespace
@@ -614,7 +1504,7 @@ void state::run_to_current(core::Core& core, std::string_view name)
     const auto thread = threads::current(core);
     const auto rsp    = registers::read(core, reg_e::rsp);
     const auto rip    = registers::read(core, reg_e::rip);
-    const auto bp     = set_virtual_breakpoint(core, name, rip, {}, *thread, {});
+    const auto bp     = set_virtual_breakpoint(core, name, rip, {}, *thread, false, {});
     run_until(d, [&]
     {
         const auto got_rip = registers::read(core, reg_e::rip);
@@ -623,68 +1513,310 @@ void state::run_to_current(core::Core& core, std::string_view name)
     });
 }
 
+namespace
+{
+    // arm every new target in one transaction,
+    // set_virtual_breakpoint then reuses the installed breakpoints
+    void prearm_targets(core::Core& core, const std::unordered_set<uint64_t>& ptrs)
+    {
+        auto& d        = *core.state_;
+        auto descs     = std::vector<fdp::breakpoint_desc>{};
+        auto new_phys  = std::vector<phy_t>{};
+        const auto cur = process::current(core);
+        if(!cur)
+            return;
+
+        for(const uint64_t& ptr : ptrs)
+        {
+            const auto phy = memory::virtual_to_physical(core, *cur, ptr);
+            if(!phy || d.targets.count(*phy))
+                continue;
+
+            descs.push_back({FDP_SOFTHBP, FDP_EXECUTE_BP, FDP_PHYSICAL_ADDRESS, phy->val, 1, 0});
+            new_phys.push_back(*phy);
+        }
+        if(descs.empty())
+            return;
+
+        auto bpids = std::vector<int>(descs.size());
+        if(!fdp::set_breakpoints(core, descs.data(), descs.size(), bpids.data()))
+            return;
+
+        for(size_t i = 0; i < bpids.size(); ++i)
+            if(bpids[i] >= 0)
+                d.targets.emplace(new_phys[i], Breakpoint{{}, bpids[i]});
+    }
+}
+
+namespace
+{
+    void run_to_ptrs(core::Core& core, const std::unordered_set<uint64_t>& ptrs, state::bp_cr3_e bp_cr3, const std::function<walk_e(proc_t, thread_t)>& on_bp)
+    {
+        int bpid     = -1;
+        uint64_t cr3 = 0;
+        if(bp_cr3 == state::BP_CR3_ON_WRITINGS)
+        {
+            bpid = fdp::set_breakpoint(core, FDP_CRHBP, 0, FDP_WRITE_BP, FDP_VIRTUAL_ADDRESS, 3, 1, 0);
+            if(bpid < 0)
+            {
+                LOG(ERROR, "unable to set a breakpoint on CR3 writes");
+                return;
+            }
+
+            cr3 = registers::read(core, reg_e::cr3);
+        }
+
+        auto& d = *core.state_;
+        run_until(d, [&]
+        {
+            const auto got_cr3 = registers::read(core, reg_e::cr3);
+            const auto rip     = registers::read(core, reg_e::rip);
+            if(!ptrs.count(rip) && (bp_cr3 == state::BP_CR3_NONE || cr3 == got_cr3))
+                return false;
+
+            if(bp_cr3 == state::BP_CR3_ON_WRITINGS && cr3 != got_cr3)
+                cr3 = got_cr3;
+
+            const auto thread = threads::current(core);
+            if(!thread)
+                return false;
+
+            const auto proc = threads::process(core, *thread);
+            if(!proc)
+                return false;
+
+            return on_bp(*proc, *thread) == walk_e::stop;
+        });
+
+        if(bp_cr3 == state::BP_CR3_ON_WRITINGS)
+            fdp::unset_breakpoint(core, bpid);
+    }
+}
+
 void state::run_to(core::Core& core, std::string_view name, std::unordered_set<uint64_t> ptrs, bp_cr3_e bp_cr3, std::function<walk_e(proc_t, thread_t)> on_bp)
 {
     if((bp_cr3 == BP_CR3_NONE) & ptrs.empty())
         return;
 
+    prearm_targets(core, ptrs);
+
     auto bps = std::vector<state::Breakpoint>{};
     bps.reserve(ptrs.size());
     for(const uint64_t& ptr : ptrs)
-        bps.push_back(set_virtual_breakpoint(core, name, ptr, {}, {}, {}));
+        bps.push_back(set_virtual_breakpoint(core, name, ptr, {}, {}, false, {}));
+
+    run_to_ptrs(core, ptrs, bp_cr3, on_bp);
+}
+
+struct state::TargetSetPrivate
+{
+    std::unordered_set<uint64_t>   ptrs;
+    std::vector<state::Breakpoint> bps; // keeps the fdp breakpoints installed
+};
 
-    int bpid     = -1;
-    uint64_t cr3 = 0;
-    if(bp_cr3 == BP_CR3_ON_WRITINGS)
+state::TargetSet state::compile_targets(core::Core& core, std::string_view name, const std::unordered_set<uint64_t>& ptrs)
+{
+    // translate & arm once, under the current process mappings
+    prearm_targets(core, ptrs);
+
+    auto targets   = std::make_shared<TargetSetPrivate>();
+    targets->ptrs  = ptrs;
+    targets->bps.reserve(ptrs.size());
+    for(const uint64_t& ptr : ptrs)
     {
-        bpid = fdp::set_breakpoint(core, FDP_CRHBP, 0, FDP_WRITE_BP, FDP_VIRTUAL_ADDRESS, 3, 1, 0);
-        if(bpid < 0)
+        auto bp = set_virtual_breakpoint(core, name, ptr, {}, {}, false, {});
+        if(bp)
+            targets->bps.push_back(std::move(bp));
+    }
+    return targets;
+}
+
+void state::run_to_targets(core::Core& core, TargetSet& targets, bp_cr3_e bp_cr3, std::function<walk_e(proc_t, thread_t)> on_bp)
+{
+    if(!targets)
+        return;
+
+    if((bp_cr3 == BP_CR3_NONE) & targets->ptrs.empty())
+        return;
+
+    run_to_ptrs(core, targets->ptrs, bp_cr3, on_bp);
+}
+
+struct state::BreakpointGroupPrivate
+{
+    std::vector<state::Breakpoint> bps;
+    bool                           armed = true;
+};
+
+state::BreakpointGroup state::breakpoint_group(core::Core& /*core*/)
+{
+    return std::make_shared<state::BreakpointGroupPrivate>();
+}
+
+state::BreakpointGroup state::breakpoint_group_disarmed(core::Core& /*core*/)
+{
+    auto group   = std::make_shared<state::BreakpointGroupPrivate>();
+    group->armed = false;
+    return group;
+}
+
+void state::group_add(BreakpointGroup& group, const Breakpoint& bp)
+{
+    if(group && bp)
+        group->bps.push_back(bp);
+}
+
+namespace
+{
+    // every fdp breakpoint backing the group, deduplicated
+    std::vector<phy_t> group_targets(Data& d, const state::BreakpointGroupPrivate& group)
+    {
+        auto phys = std::vector<phy_t>{};
+        phys.reserve(group.bps.size());
+        for(const auto& bp : group.bps)
         {
-            LOG(ERROR, "unable to set a breakpoint on CR3 writes");
-            return;
+            const auto phy = breakpoint_phy(*bp);
+            if(d.targets.count(phy) && std::find(phys.begin(), phys.end(), phy) == phys.end())
+                phys.push_back(phy);
         }
-
-        cr3 = registers::read(core, reg_e::cr3);
+        return phys;
     }
+}
 
-    auto& d = *core.state_;
-    run_until(d, [&]
+bool state::group_disarm(core::Core& core, BreakpointGroup& group)
+{
+    if(!group || !group->armed)
+        return true;
+
+    auto&      d     = *core.state_;
+    const auto phys  = group_targets(d, *group);
+    auto       bpids = std::vector<int>{};
+    bpids.reserve(phys.size());
+    for(const auto& phy : phys)
     {
-        const auto got_cr3 = registers::read(core, reg_e::cr3);
-        const auto rip     = registers::read(core, reg_e::rip);
-        if(!ptrs.count(rip) && (bp_cr3 == BP_CR3_NONE || cr3 == got_cr3))
-            return false;
+        auto& target = d.targets.find(phy)->second;
+        if(target.id < 0)
+            continue;
 
-        if(bp_cr3 == BP_CR3_ON_WRITINGS && cr3 != got_cr3)
-            cr3 = got_cr3;
+        bpids.push_back(target.id);
+        target.id = -1; // slot released until group_rearm
+        --d.armed_count;
+    }
+    if(!bpids.empty())
+        if(!fdp::unset_breakpoints(core, &bpids[0], bpids.size()))
+            return FAIL(false, "unable to disarm breakpoint group");
 
-        const auto thread = threads::current(core);
-        if(!thread)
-            return false;
+    group->armed = false;
+    return true;
+}
 
-        const auto proc = threads::process(core, *thread);
-        if(!proc)
-            return false;
+bool state::group_rearm(core::Core& core, BreakpointGroup& group)
+{
+    if(!group || group->armed)
+        return true;
 
-        return on_bp(*proc, *thread) == walk_e::stop;
-    });
+    auto&      d    = *core.state_;
+    const auto all  = group_targets(d, *group);
+    auto descs      = std::vector<fdp::breakpoint_desc>{};
+    auto phys       = std::vector<phy_t>{};
+    descs.reserve(all.size());
+    phys.reserve(all.size());
+    for(const auto& phy : all)
+    {
+        const auto& target = d.targets.find(phy)->second;
+        if(target.id >= 0)
+            continue;
+
+        const auto dtb_val = target.dtb ? target.dtb->val : 0;
+        descs.push_back({FDP_SOFTHBP, FDP_EXECUTE_BP, FDP_PHYSICAL_ADDRESS, phy.val, 1, dtb_val});
+        phys.push_back(phy);
+    }
+    while(d.armed_count + descs.size() > max_armed_targets)
+        if(!evict_coldest(d))
+            break;
+
+    if(!descs.empty())
+    {
+        auto bpids = std::vector<int>(descs.size());
+        if(!fdp::set_breakpoints(core, descs.data(), descs.size(), bpids.data()))
+            return FAIL(false, "unable to rearm breakpoint group");
 
-    if(bp_cr3 == BP_CR3_ON_WRITINGS)
-        fdp::unset_breakpoint(core, bpid);
+        // refresh breakpoint ids on targets & observers
+        for(size_t i = 0; i < phys.size(); ++i)
+        {
+            if(bpids[i] < 0)
+                return FAIL(false, "unable to rearm breakpoint group");
+
+            auto& target    = d.targets.find(phys[i])->second;
+            target.id       = bpids[i];
+            target.last_hit = ++d.hit_seq;
+            ++d.armed_count;
+            forget_virtual(d, phys[i]);
+            const auto it = d.observers.find(phys[i]);
+            if(it == d.observers.end())
+                continue;
+
+            for(const auto& observer : it->second)
+                observer->bpid = bpids[i];
+        }
+    }
+    group->armed = true;
+    return true;
 }
 
 bool state::save(core::Core& core)
 {
-    return fdp::save(core);
+    CHANNEL_SCOPE();
+    // incremental when the server tracks dirty pages, full save otherwise
+    return fdp::save_incremental(core);
 }
 
 bool state::restore(core::Core& core)
 {
-    return fdp::restore(core);
+    CHANNEL_SCOPE();
+    memory::flush_caches(core);
+    return fdp::restore_incremental(core);
+}
+
+void state::flight_recorder(core::Core& core, uint64_t interval)
+{
+    CHANNEL_SCOPE();
+    auto& d           = *core.state_;
+    d.flight_interval = interval;
+    d.flight_events   = 0;
+    if(interval)
+        fdp::save_incremental(core);
+}
+
+opt<uint64_t> state::rewind(core::Core& core, uint64_t events)
+{
+    CHANNEL_SCOPE();
+    auto& d = *core.state_;
+    if(!d.flight_interval)
+        return FAIL(std::nullopt, "flight recorder is disabled");
+
+    // the fdp server keeps a single incremental delta, so the reachable
+    // window is what happened since the last refresh
+    if(events > d.flight_events)
+        return FAIL(std::nullopt, "only %" PRIu64 " events recorded since the last snapshot", d.flight_events);
+
+    const auto forward = d.flight_events - events;
+    memory::flush_caches(core);
+    if(!fdp::restore_incremental(core))
+        return FAIL(std::nullopt, "unable to restore the flight snapshot");
+
+    // replay forward, counting events like the live run did
+    d.flight_events    = 0;
+    d.flight_replaying = true;
+    while(d.flight_events < forward)
+        state::exec(core);
+    d.flight_replaying = false;
+    return forward;
 }
 
 bool state::inject_interrupt(core::Core& core, uint32_t code, uint32_t error, uint64_t cr2)
 {
+    CHANNEL_SCOPE();
     return fdp::inject_interrupt(core, code, error, cr2);
 }
 
@@ -703,6 +1835,71 @@ namespace
     }
 }
 
+std::vector<state::observer_stats_t> state::observer_stats(core::Core& core)
+{
+    auto& d   = *core.state_;
+    auto  ret = std::vector<observer_stats_t>{};
+    ret.reserve(d.stats.size());
+    for(const auto& it : d.stats)
+        ret.push_back({it.first, it.second.hits, it.second.task_ns, it.second.paused_ns, it.second.histogram});
+    std::sort(ret.begin(), ret.end(), [](const auto& a, const auto& b)
+    {
+        return a.paused_ns > b.paused_ns;
+    });
+    return ret;
+}
+
+void state::reset_observer_stats(core::Core& core)
+{
+    core.state_->stats.clear();
+}
+
+void state::log_observer_stats(core::Core& core)
+{
+    for(const auto& it : observer_stats(core))
+    {
+        LOG(INFO, "%s: %" PRIu64 " hits, task %" PRIu64 " us, paused %" PRIu64 " us", it.name.data(), it.hits, it.task_ns / 1000, it.paused_ns / 1000);
+        auto buckets = std::string{};
+        for(size_t i = 0; i < it.histogram.size(); ++i)
+            if(it.histogram[i])
+                buckets += " " + std::to_string(i) + ":" + std::to_string(it.histogram[i]);
+        if(!buckets.empty())
+            LOG(INFO, "  log2 ns buckets:%s", buckets.data());
+    }
+}
+
+std::array<state::stage_stats_t, 5> state::latency_budget(core::Core& core)
+{
+    auto& d   = *core.state_;
+    auto  ret = std::array<stage_stats_t, 5>{};
+    static_assert(COUNT_OF(stage_names) == 5, "stage count & api out of sync");
+    for(size_t i = 0; i < ret.size(); ++i)
+        ret[i] = stage_stats_t{stage_names[i], d.budget[i].count, d.budget[i].total_ns, d.budget[i].histogram};
+    return ret;
+}
+
+void state::reset_latency_budget(core::Core& core)
+{
+    auto& d  = *core.state_;
+    d.budget = {};
+    d.span   = {};
+}
+
+void state::log_latency_budget(core::Core& core)
+{
+    for(const auto& it : latency_budget(core))
+    {
+        const auto avg = it.count ? it.total_ns / it.count : 0;
+        LOG(INFO, "%s: %" PRIu64 " spans, total %" PRIu64 " us, avg %" PRIu64 " ns", it.name, it.count, it.total_ns / 1000, avg);
+        auto buckets = std::string{};
+        for(size_t i = 0; i < it.histogram.size(); ++i)
+            if(it.histogram[i])
+                buckets += " " + std::to_string(i) + ":" + std::to_string(it.histogram[i]);
+        if(!buckets.empty())
+            LOG(INFO, "  log2 ns buckets:%s", buckets.data());
+    }
+}
+
 bpid_t state::save_breakpoint(core::Core& core, const Breakpoint& bp)
 {
     if(!bp)
@@ -732,3 +1929,35 @@ void state::drop_breakpoint(core::Core& core, bpid_t bpid)
     auto& d = *core.state_;
     d.breakpoints.erase(bpid.id);
 }
+
+opt<bpid_t> state::watch_memory(core::Core& core, std::string_view name, proc_t proc, uint64_t ptr, uint64_t size, const on_watch_fn& on_access)
+{
+    auto& d = *core.state_;
+    // one page breakpoint write-protects the whole span on the server,
+    // rounded out to page granularity
+    const auto fdpid = fdp::set_breakpoint(core, FDP_PAGEHBP, 0, FDP_WRITE_BP, FDP_VIRTUAL_ADDRESS, ptr, size, proc.udtb.val);
+    if(fdpid < 0)
+        return FAIL(std::nullopt, "unable to watch 0x%" PRIx64 "-0x%" PRIx64, ptr, ptr + size);
+
+    const auto bpid = acquire_breakpoint_id(core);
+    d.watches.push_back(MemWatch{std::string{name}, ptr, size, bpid, fdpid, on_access});
+    return bpid;
+}
+
+bool state::unwatch_memory(core::Core& core, bpid_t bpid)
+{
+    auto&      d  = *core.state_;
+    const auto it = std::find_if(d.watches.begin(), d.watches.end(), [&](const MemWatch& watch)
+    {
+        return watch.id.id == bpid.id;
+    });
+    if(it == d.watches.end())
+        return false;
+
+    const auto ok = fdp::unset_breakpoint(core, it->fdpid);
+    if(!ok)
+        LOG(ERROR, "unable to remove watch breakpoint %d", it->fdpid);
+
+    d.watches.erase(it);
+    return true;
+}
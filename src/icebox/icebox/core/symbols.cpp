@@ -4,14 +4,28 @@
 #define FDP_MODULE "sym"
 #include "core.hpp"
 #include "core_private.hpp"
+#include "counters.hpp"
 #include "interfaces/if_symbols.hpp"
 #include "log.hpp"
+#include "memory.hpp"
 
+#include "utils/flat_map.hpp"
 #include "utils/hash.hpp"
 #include "utils/hex.hpp"
 #include "utils/path.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
+
+#include <cstring>
 
 #ifdef _MSC_VER
 #    define strnicmp _strnicmp
@@ -48,6 +62,34 @@ namespace std
     };
 } // namespace std
 
+namespace
+{
+    struct NameKey
+    {
+        uint64_t proc;
+        uint64_t addr;
+    };
+
+    inline bool operator==(const NameKey& a, const NameKey& b)
+    {
+        return a.proc == b.proc && a.addr == b.addr;
+    }
+}
+
+namespace std
+{
+    template <>
+    struct hash<NameKey>
+    {
+        size_t operator()(const NameKey& arg) const
+        {
+            size_t seed = 0;
+            ::hash::combine(seed, arg.proc, arg.addr);
+            return seed;
+        }
+    };
+} // namespace std
+
 namespace
 {
     using ModulePtr = std::shared_ptr<symbols::Module>;
@@ -57,10 +99,44 @@ namespace
         span_t    span;
     };
 
-    using Mods     = std::unordered_map<ModKey, Mod>;
-    using ModByIds = std::unordered_map<std::string_view, ModulePtr>;
-    using Data     = symbols::Modules::Data;
-    using Buffer   = std::vector<uint8_t>;
+    struct CachedName
+    {
+        uint64_t    generation;
+        std::string name;
+    };
+
+    using Mods       = flat::map<ModKey, Mod>;
+    using ModByIds   = std::unordered_map<std::string_view, ModulePtr>;
+    using Names      = std::unordered_map<NameKey, CachedName>;
+    using Identities = std::unordered_map<uint64_t, symbols::Identity>;
+    using Data       = symbols::Modules::Data;
+    using Buffer     = std::vector<uint8_t>;
+
+    // flushed whole when full, cheaper than per-hit lru bookkeeping
+    constexpr size_t max_cached_names = 0x10000;
+
+    // module parsed on a background worker, waiting for the owner
+    // thread to splice it into the tables, see drain_pending_inserts
+    struct PendingInsert
+    {
+        std::string name;
+        std::string id;
+        proc_t      proc;
+        span_t      span;
+        ModulePtr   module;       // null when the parse failed
+        bool        pdb_fallback; // retry from the export table on drain
+    };
+
+    // exports-tier module waiting for a full parse on its first deep
+    // query, see find_deep
+    struct Demoted
+    {
+        std::string name; // original pe name, for the debug file lookup
+        std::string id;
+        proc_t      proc;
+        span_t      span;
+    };
+    using Demotions = std::unordered_map<std::string, Demoted>;
 }
 
 struct symbols::Modules::Data
@@ -68,12 +144,52 @@ struct symbols::Modules::Data
     Data(core::Core& core)
         : core(core)
     {
+        mods.reserve(256); // sized once, symbol lookups never rehash
+    }
+
+    ~Data()
+    {
+        {
+            const auto lock = std::lock_guard<std::mutex>{prefetch_mutex};
+            prefetch_stop   = true;
+        }
+        prefetch_cv.notify_all();
+        for(auto& worker : prefetchers)
+            worker.join();
     }
 
     core::Core& core;
     Mods        mods;
     ModByIds    mod_by_ids;
     Buffer      buffer;
+
+    // address-to-name cache, stale entries die on generation bumps
+    Names       names;
+    uint64_t    generation = 0;
+
+    // pe identification cache, see identify_module
+    Identities  identities;
+
+    // memoized struc lookups, keyed by module identity so every
+    // process sharing a debug file shares the resolved offsets
+    std::unordered_map<std::string, opt<uint64_t>> member_offsets;
+    std::unordered_map<std::string, opt<uint64_t>> struc_sizes;
+
+    // per-module symbol tiering, see set_load_policy
+    std::vector<std::pair<std::string, symbols::tier_e>> policy;
+    Demotions                                            demoted;
+
+    // background symbol prefetch, see prefetch_module
+    std::mutex                        prefetch_mutex;
+    std::condition_variable           prefetch_cv;
+    std::deque<std::function<void()>> prefetch_queue;
+    std::vector<std::thread>          prefetchers;
+    bool                              prefetch_stop = false;
+
+    // deferred module loads land here from the workers & are spliced
+    // in by the next symbols query, see drain_pending_inserts
+    std::mutex                 pending_mutex;
+    std::vector<PendingInsert> pending_inserts;
 };
 
 symbols::Modules::Modules(core::Core& core)
@@ -99,6 +215,39 @@ namespace
     {
         return proc.id == symbols::kernel.id;
     }
+
+    // the same dll mapped into every process yields the same debug
+    // directory, so key identities on the module first page & size and
+    // skip repeated guest reads during module load storms
+    opt<uint64_t> hash_module(span_t span, const memory::Io& io)
+    {
+        char page[0x1000];
+        const auto size = std::min<uint64_t>(span.size, sizeof page);
+        const auto ok   = io.read_all(page, span.addr, size);
+        if(!ok)
+            return {};
+
+        auto seed = size_t{0};
+        hash::combine(seed, span.size, std::string_view{page, size});
+        return seed;
+    }
+
+    opt<symbols::Identity> identify_module(Data& d, span_t span, const memory::Io& io,
+                                           opt<symbols::Identity> (*identify)(span_t, const memory::Io&))
+    {
+        const auto key = hash_module(span, io);
+        if(key)
+        {
+            const auto it = d.identities.find(*key);
+            if(it != d.identities.end())
+                return it->second;
+        }
+
+        const auto opt_id = identify(span, io);
+        if(key && opt_id)
+            d.identities.emplace(*key, *opt_id);
+        return opt_id;
+    }
 }
 
 symbols::Modules& symbols::Modules::modules(core::Core& core)
@@ -114,11 +263,51 @@ namespace
         cached,
     };
 
+    // run a task on the shared background workers, spawned on demand
+    void queue_prefetch_task(Data& d, std::function<void()> task)
+    {
+        auto lock = std::unique_lock<std::mutex>{d.prefetch_mutex};
+        if(d.prefetchers.empty())
+        {
+            const auto nthreads = std::min(2u, std::max(std::thread::hardware_concurrency(), 1u));
+            for(auto i = 0u; i < nthreads; ++i)
+                d.prefetchers.emplace_back([&d]
+                {
+                    while(true)
+                    {
+                        auto lock = std::unique_lock<std::mutex>{d.prefetch_mutex};
+                        d.prefetch_cv.wait(lock, [&] { return d.prefetch_stop || !d.prefetch_queue.empty(); });
+                        if(d.prefetch_stop)
+                            return;
+
+                        const auto work = std::move(d.prefetch_queue.front());
+                        d.prefetch_queue.pop_front();
+                        lock.unlock();
+                        work();
+                    }
+                });
+        }
+        d.prefetch_queue.push_back(std::move(task));
+        lock.unlock();
+        d.prefetch_cv.notify_one();
+    }
+
+    // warm new modules in the background while the guest resumes;
+    // callers needing symbols right away query & block on the same load
+    void prefetch_module(Data& d, const ModulePtr& mod)
+    {
+        // any query materializes a deferred index
+        queue_prefetch_task(d, [mod] { mod->symbol_offset(std::string{}); });
+    }
+
     bool insert_module(Data& d, proc_t proc, const std::string& module, span_t span, const ModulePtr& sym, insert_e einsert)
     {
         LOG(INFO, "%s %s %s", einsert == insert_e::loaded ? "loaded" : "cached", sym->id().data(), module.data());
         const auto ret = d.mods.emplace(ModKey{module, proc}, Mod{sym, span});
         d.mod_by_ids.emplace(sym->id(), sym);
+        ++d.generation;
+        if(einsert == insert_e::loaded)
+            prefetch_module(d, sym);
         return ret.second;
     }
 }
@@ -148,6 +337,91 @@ namespace
         }
         return ret;
     }
+
+    // '*' wildcard match, case-insensitive, for load policy patterns
+    bool match_pattern(const char* pattern, const char* name)
+    {
+        while(*pattern)
+        {
+            if(*pattern == '*')
+            {
+                ++pattern;
+                for(;; ++name)
+                {
+                    if(match_pattern(pattern, name))
+                        return true;
+                    if(!*name)
+                        return false;
+                }
+            }
+            if(!*name || tolower(*pattern) != tolower(*name))
+                return false;
+
+            ++pattern;
+            ++name;
+        }
+        return !*name;
+    }
+
+    // the longest matching pattern wins so "*" can set a default tier
+    // & specific modules override it, unmatched modules stay full
+    symbols::tier_e tier_of(Data& d, const std::string& name)
+    {
+        auto tier = symbols::tier_e::full;
+        auto best = size_t{0};
+        for(const auto& p : d.policy)
+            if(p.first.size() + 1 > best && match_pattern(p.first.data(), name.data()))
+            {
+                best = p.first.size() + 1;
+                tier = p.second;
+            }
+        return tier;
+    }
+
+    std::string demote_key(const std::string& name, proc_t proc)
+    {
+        return name + '@' + std::to_string(proc.id);
+    }
+}
+
+namespace
+{
+    // without a debug file, serve the module export table instead:
+    // parsed once per identity & reloaded from the serialized index
+    ModulePtr make_module_exports(Data& d, const memory::Io& io, span_t span, const symbols::Identity& id, bool& is_cached)
+    {
+        const auto it = d.mod_by_ids.find(id.id + "#exports");
+        is_cached     = it != d.mod_by_ids.end();
+        if(is_cached)
+            return it->second;
+
+        return symbols::make_exports(io, span, id.name, id.id);
+    }
+
+    // splice modules parsed on the background workers into the tables;
+    // runs on the owner thread so lookups stay lock-free
+    void drain_pending_inserts(Data& d)
+    {
+        auto pending = std::vector<PendingInsert>{};
+        {
+            const auto lock = std::lock_guard<std::mutex>{d.pending_mutex};
+            if(d.pending_inserts.empty())
+                return;
+
+            pending.swap(d.pending_inserts);
+        }
+        for(auto& p : pending)
+        {
+            auto is_cached = false;
+            if(!p.module && p.pdb_fallback)
+            {
+                const auto io = memory::make_io(d.core, p.proc);
+                p.module      = make_module_exports(d, io, p.span, {p.name, p.id}, is_cached);
+            }
+            if(p.module)
+                insert_module(d, p.proc, fix_module_name(p.name), p.span, p.module, is_cached ? insert_e::cached : insert_e::loaded);
+        }
+    }
 }
 
 bool symbols::Modules::insert(proc_t proc, const memory::Io& io, span_t span)
@@ -156,17 +430,19 @@ bool symbols::Modules::insert(proc_t proc, const memory::Io& io, span_t span)
     auto& d = *d_;
     for(const auto& h : g_helpers)
     {
-        const auto opt_id = h.identify(span, io);
+        const auto opt_id = identify_module(d, span, io, h.identify);
         if(!opt_id)
             continue;
 
-        const auto it        = d.mod_by_ids.find(opt_id->id);
-        auto mod             = ModulePtr{};
-        const auto is_cached = it != d.mod_by_ids.end();
+        const auto it  = d.mod_by_ids.find(opt_id->id);
+        auto mod       = ModulePtr{};
+        auto is_cached = it != d.mod_by_ids.end();
         if(is_cached)
             mod = it->second;
         else
             mod = h.make(opt_id->name, opt_id->id);
+        if(!mod)
+            mod = make_module_exports(d, io, span, *opt_id, is_cached);
         if(!mod)
             continue;
 
@@ -199,11 +475,13 @@ bool symbols::Modules::remove(proc_t proc, const std::string& module)
         d.mod_by_ids.erase(id);
 
     d.mods.erase(it);
+    ++d.generation;
     return true;
 }
 
 bool symbols::Modules::list(proc_t proc, const on_module_fn& on_module)
 {
+    drain_pending_inserts(*d_);
     for(const auto& m : d_->mods)
         if(m.first.proc.id == proc.id)
             if(on_module(m.second.span, *m.second.module) == walk_e::stop)
@@ -221,6 +499,7 @@ namespace
 
     opt<Mod> find_module(Data& d, proc_t proc, const std::string& name, find_e efind)
     {
+        drain_pending_inserts(d);
         const auto it = d.mods.find({name, proc});
         if(it != d.mods.end())
             return it->second;
@@ -237,6 +516,39 @@ namespace
 
         return {};
     }
+
+    // lazy tier upgrade: struc queries need the full debug file, swap
+    // the export-table stand-in for its pdb on the first deep query
+    symbols::Module* find_deep(Data& d, proc_t proc, const std::string& name)
+    {
+        const auto opt_mod = find_module(d, proc, name, find_e::all);
+        if(!opt_mod)
+            return nullptr;
+
+        auto it = d.demoted.find(demote_key(name, proc));
+        if(it == d.demoted.end() && !is_kernel_proc(proc))
+            it = d.demoted.find(demote_key(name, symbols::kernel));
+        if(it == d.demoted.end())
+            return opt_mod->module.get();
+
+        const auto& entry = it->second;
+        const auto  full  = symbols::make_pdb(entry.name, entry.id);
+        if(!full)
+        {
+            // no debug file reachable, stay on exports & stop retrying
+            d.demoted.erase(it);
+            return opt_mod->module.get();
+        }
+
+        LOG(INFO, "upgraded %s %s", full->id().data(), name.data());
+        const auto mo = d.mods.find({name, entry.proc});
+        if(mo != d.mods.end())
+            mo->second = Mod{full, entry.span};
+        d.mod_by_ids.emplace(full->id(), full);
+        ++d.generation;
+        d.demoted.erase(it);
+        return full.get();
+    }
 }
 
 symbols::Module* symbols::Modules::find(proc_t proc, const std::string& module)
@@ -260,14 +572,14 @@ opt<uint64_t> symbols::Modules::address(proc_t proc, const std::string& module,
 
 void symbols::Modules::list_strucs(proc_t proc, const std::string& module, const symbols::on_name_fn& on_struc)
 {
-    const auto mod = find(proc, module);
+    const auto mod = find_deep(*d_, proc, module);
     if(mod)
         mod->list_strucs(on_struc);
 }
 
 opt<symbols::Struc> symbols::Modules::read_struc(proc_t proc, const std::string& module, const std::string& struc)
 {
-    const auto mod = find(proc, module);
+    const auto mod = find_deep(*d_, proc, module);
     if(!mod)
         return {};
 
@@ -295,6 +607,50 @@ opt<symbols::Struc> symbols::read_struc(core::Core& core, proc_t proc, const std
     return core.symbols_->read_struc(proc, module, struc);
 }
 
+opt<uint64_t> symbols::member_offset(core::Core& core, proc_t proc, const std::string& module, const std::string& struc, const std::string& member)
+{
+    auto& d        = *core.symbols_->d_;
+    const auto mod = find_deep(d, proc, module);
+    if(!mod)
+        return {};
+
+    auto key      = std::string{mod->id()} + '!' + struc + '.' + member;
+    const auto it = d.member_offsets.find(key);
+    if(it != d.member_offsets.end())
+        return it->second;
+
+    auto ret             = opt<uint64_t>{};
+    const auto opt_struc = mod->read_struc(struc);
+    if(opt_struc)
+    {
+        const auto opt_mb = find_member(*opt_struc, member);
+        if(opt_mb)
+            ret = opt_mb->offset;
+    }
+    d.member_offsets.emplace(std::move(key), ret);
+    return ret;
+}
+
+opt<uint64_t> symbols::struc_size(core::Core& core, proc_t proc, const std::string& module, const std::string& struc)
+{
+    auto& d        = *core.symbols_->d_;
+    const auto mod = find_deep(d, proc, module);
+    if(!mod)
+        return {};
+
+    auto key      = std::string{mod->id()} + '!' + struc;
+    const auto it = d.struc_sizes.find(key);
+    if(it != d.struc_sizes.end())
+        return it->second;
+
+    auto ret             = opt<uint64_t>{};
+    const auto opt_struc = mod->read_struc(struc);
+    if(opt_struc)
+        ret = opt_struc->bytes;
+    d.struc_sizes.emplace(std::move(key), ret);
+    return ret;
+}
+
 opt<symbols::Member> symbols::find_member(const Struc& struc, const std::string& member)
 {
     for(const auto& m : struc.members)
@@ -313,6 +669,96 @@ opt<symbols::Member> symbols::read_member(core::Core& core, proc_t proc, const s
     return find_member(*opt_struc, member);
 }
 
+namespace
+{
+    size_t member_bytes(const symbols::Member& member)
+    {
+        const auto bytes = static_cast<size_t>(member.bits) / 8;
+        return std::min<size_t>(std::max<size_t>(bytes, 1), sizeof(uint64_t));
+    }
+}
+
+bool symbols::read_fields(core::Core& core, proc_t proc, const memory::Io& io, const std::string& module, const std::string& struc, uint64_t ptr, field_t* fields, size_t count)
+{
+    if(!count)
+        return true;
+
+    const auto opt_struc = read_struc(core, proc, module, struc);
+    if(!opt_struc)
+        return false;
+
+    // resolve every offset once & compute the covering byte range
+    struct slot_t
+    {
+        Member   member;
+        field_t* field;
+    };
+    auto slots = std::vector<slot_t>{};
+    slots.reserve(count);
+    auto lo = size_t{~0ull};
+    auto hi = size_t{};
+    for(size_t i = 0; i < count; ++i)
+    {
+        fields[i].value        = {};
+        const auto opt_member  = find_member(*opt_struc, std::string{fields[i].name});
+        if(!opt_member)
+            continue;
+
+        slots.push_back({*opt_member, &fields[i]});
+        lo = std::min<size_t>(lo, opt_member->offset);
+        hi = std::max<size_t>(hi, opt_member->offset + member_bytes(*opt_member));
+    }
+    if(slots.empty())
+        return false;
+
+    auto buffer   = std::vector<uint8_t>(hi - lo);
+    const auto ok = io.read_all(&buffer[0], ptr + lo, buffer.size());
+    if(!ok)
+        return false;
+
+    for(const auto& slot : slots)
+    {
+        const auto  bytes = member_bytes(slot.member);
+        const auto* src   = &buffer[slot.member.offset - lo];
+        auto        value = uint64_t{};
+        for(size_t i = 0; i < bytes; ++i)
+            value |= static_cast<uint64_t>(src[i]) << (8 * i);
+        slot.field->value = value;
+    }
+    return true;
+}
+
+bool symbols::resolve_offsets(core::Core& core, proc_t proc, const std::string& module, const offset_desc_t* descs, size_t count, uint64_t* offsets)
+{
+    auto fail      = false;
+    auto last_name = static_cast<const char*>(nullptr);
+    auto opt_struc = opt<Struc>{};
+    for(size_t i = 0; i < count; ++i)
+    {
+        const auto& desc = descs[i];
+        fail |= desc.e_id != i;
+        offsets[i] = 0;
+        // consecutive members usually share their struct, read it once
+        if(!last_name || strcmp(last_name, desc.struc) != 0)
+        {
+            last_name = desc.struc;
+            opt_struc = read_struc(core, proc, module, desc.struc);
+        }
+        const auto opt_mb = opt_struc ? find_member(*opt_struc, desc.member) : opt<Member>{};
+        if(!opt_mb)
+        {
+            fail |= desc.required;
+            if(desc.required)
+                LOG(ERROR, "unable to read %s!%s.%s member offset", module.data(), desc.struc, desc.member);
+            else
+                LOG(WARNING, "unable to read optional %s!%s.%s member offset", module.data(), desc.struc, desc.member);
+            continue;
+        }
+        offsets[i] = opt_mb->offset;
+    }
+    return !fail;
+}
+
 namespace
 {
     struct ModPair
@@ -338,6 +784,7 @@ namespace
 
     auto find_mod(Data& s, proc_t proc, uint64_t addr)
     {
+        drain_pending_inserts(s);
         const auto p = find(s, proc, addr);
         if(p)
             return p;
@@ -414,16 +861,98 @@ namespace
 
 std::string symbols::Modules::string(proc_t proc, uint64_t addr)
 {
-    auto& d      = *d_;
+    auto& d        = *d_;
+    const auto key = NameKey{proc.id, addr};
+    const auto it  = d.names.find(key);
+    if(it != d.names.end() && it->second.generation == d.generation)
+    {
+        counters::bump(counters::get().symbol_cache_hits);
+        return it->second.name;
+    }
+
+    counters::bump(counters::get().symbol_cache_misses);
     const auto p = ::find_mod(d, proc, addr);
     if(!p)
         return read_empty_symbol(d.core, proc, addr);
 
     const auto cur = p->mod.module->find_symbol(addr - p->mod.span.addr);
-    if(!cur)
-        return p->name + to_offset('+', addr - p->mod.span.addr);
+    auto ret       = cur ?
+                         p->name + '!' + cur->symbol + to_offset('+', cur->offset) :
+                         p->name + to_offset('+', addr - p->mod.span.addr);
+    if(d.names.size() >= max_cached_names)
+        d.names.clear();
+    d.names[key] = {d.generation, ret};
+    return ret;
+}
+
+std::vector<std::string> symbols::Modules::string_many(proc_t proc, const uint64_t* addrs, size_t count)
+{
+    auto& d  = *d_;
+    auto ret = std::vector<std::string>(count);
+    if(!count)
+        return ret;
+
+    drain_pending_inserts(d);
+    // snapshot the process & kernel spans once, sorted by base
+    struct SpanRef
+    {
+        uint64_t           addr;
+        uint64_t           size;
+        const std::string* name;
+        const Mod*         mod;
+    };
+    auto spans = std::vector<SpanRef>{};
+    spans.reserve(d.mods.size());
+    for(const auto& m : d.mods)
+        if(m.first.proc.id == proc.id || m.first.proc.id == symbols::kernel.id)
+            spans.push_back({m.second.span.addr, m.second.span.size, &m.first.name, &m.second});
+    std::sort(spans.begin(), spans.end(), [](const SpanRef& a, const SpanRef& b)
+    {
+        return a.addr < b.addr;
+    });
+
+    // answer queries in address order: module attribution becomes a
+    // merge join over the span list instead of a scan per address
+    auto order = std::vector<size_t>(count);
+    for(size_t i = 0; i < count; ++i)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b)
+    {
+        return addrs[a] < addrs[b];
+    });
+
+    auto it = spans.begin();
+    for(const auto i : order)
+    {
+        const auto addr   = addrs[i];
+        const auto key    = NameKey{proc.id, addr};
+        const auto cached = d.names.find(key);
+        if(cached != d.names.end() && cached->second.generation == d.generation)
+        {
+            counters::bump(counters::get().symbol_cache_hits);
+            ret[i] = cached->second.name;
+            continue;
+        }
 
-    return p->name + '!' + cur->symbol + to_offset('+', cur->offset);
+        counters::bump(counters::get().symbol_cache_misses);
+        while(it != spans.end() && it->addr + it->size <= addr)
+            ++it;
+        if(it == spans.end() || addr < it->addr)
+        {
+            ret[i] = read_empty_symbol(d.core, proc, addr);
+        }
+        else
+        {
+            const auto cur = it->mod->module->find_symbol(addr - it->addr);
+            ret[i]         = cur ?
+                                 *it->name + '!' + cur->symbol + to_offset('+', cur->offset) :
+                                 *it->name + to_offset('+', addr - it->addr);
+        }
+        if(d.names.size() >= max_cached_names)
+            d.names.clear();
+        d.names[key] = {d.generation, ret[i]};
+    }
+    return ret;
 }
 
 bool symbols::load_module_memory(core::Core& core, proc_t proc, const memory::Io& io, span_t span)
@@ -452,11 +981,11 @@ namespace
         return insert_module(d, proc, module, opt_mod->span, opt_mod->module, insert_e::cached);
     }
 
-    bool is_target(span_t span, const memory::Io& io, const std::string& name)
+    bool is_target(Data& d, span_t span, const memory::Io& io, const std::string& name)
     {
         for(const auto& h : g_helpers)
         {
-            const auto opt_id = h.identify(span, io);
+            const auto opt_id = identify_module(d, span, io, h.identify);
             if(!opt_id)
                 continue;
 
@@ -473,7 +1002,7 @@ namespace
         if(!opt_span)
             return false;
 
-        return is_target(*opt_span, io, name);
+        return is_target(*core.symbols_->d_, *opt_span, io, name);
     }
 
     opt<mod_t> wait_for_module(core::Core& core, proc_t proc, const std::string& name)
@@ -529,24 +1058,207 @@ bool symbols::load_module(core::Core& core, proc_t proc, const std::string& name
     return load_module_from(core, proc, *opt_mod);
 }
 
+namespace
+{
+    struct ParseJob
+    {
+        ModulePtr (*make)(const std::string& name, const std::string& guid);
+        std::string name;
+        std::string id;
+        proc_t      proc;
+        span_t      span;
+    };
+
+    // identification reads guest memory & stays on the caller thread,
+    // parsing is cpu-bound and file-local so it scales with host cores
+    bool queue_module(Data& d, std::vector<ParseJob>& jobs, proc_t proc, const memory::Io& io, span_t span)
+    {
+        for(const auto& h : g_helpers)
+        {
+            const auto opt_id = identify_module(d, span, io, h.identify);
+            if(!opt_id)
+                continue;
+
+            const auto name = fix_module_name(opt_id->name);
+            const auto tier = tier_of(d, name);
+            if(tier == symbols::tier_e::none)
+                return true; // policy: keep this module unloaded
+
+            const auto it = d.mod_by_ids.find(opt_id->id);
+            if(it != d.mod_by_ids.end())
+            {
+                // an already-parsed identity is free to share, any
+                // tier reuses it
+                insert_module(d, proc, name, span, it->second, insert_e::cached);
+                return true;
+            }
+
+            // exports tier: serve the export table now & remember the
+            // identity so the first deep query upgrades to the pdb
+            if(tier == symbols::tier_e::exports && h.make == &symbols::make_pdb)
+            {
+                auto is_cached = false;
+                const auto mod = make_module_exports(d, io, span, *opt_id, is_cached);
+                if(!mod)
+                    return true; // export read failed, leave unloaded
+
+                insert_module(d, proc, name, span, mod, is_cached ? insert_e::cached : insert_e::loaded);
+                d.demoted.emplace(demote_key(name, proc), Demoted{opt_id->name, opt_id->id, proc, span});
+                return true;
+            }
+
+            jobs.push_back({h.make, opt_id->name, opt_id->id, proc, span});
+            return true;
+        }
+        return false;
+    }
+
+    ModulePtr make_named_dwarf(const std::string& name, const std::string& /*id*/)
+    {
+        return symbols::make_dwarf(name);
+    }
+
+    // linux kernel modules carry no guest-readable debug identity,
+    // match their debug files on disk by module name instead
+    void queue_driver_name(Data& d, std::vector<ParseJob>& jobs, core::Core& core, driver_t driver, span_t span)
+    {
+        const auto opt_name = drivers::name(core, driver);
+        if(!opt_name || opt_name->empty())
+            return;
+
+        const auto it = d.mod_by_ids.find(*opt_name);
+        if(it != d.mod_by_ids.end())
+        {
+            insert_module(d, symbols::kernel, *opt_name, span, it->second, insert_e::cached);
+            return;
+        }
+
+        jobs.push_back({&make_named_dwarf, *opt_name, *opt_name, symbols::kernel, span});
+    }
+
+    void parse_modules(Data& d, const memory::Io& io, std::vector<ParseJob>& jobs)
+    {
+        if(jobs.empty())
+            return;
+
+        auto       results  = std::vector<ModulePtr>(jobs.size());
+        auto       next     = std::atomic<size_t>{0};
+        const auto nthreads = std::min<size_t>(jobs.size(), std::max(std::thread::hardware_concurrency(), 1u));
+        auto       workers  = std::vector<std::thread>{};
+        workers.reserve(nthreads);
+        for(size_t t = 0; t < nthreads; ++t)
+            workers.emplace_back([&]
+            {
+                while(true)
+                {
+                    const auto i = next.fetch_add(1);
+                    if(i >= jobs.size())
+                        return;
+
+                    results[i] = jobs[i].make(jobs[i].name, jobs[i].id);
+                }
+            });
+        for(auto& worker : workers)
+            worker.join();
+
+        for(size_t i = 0; i < jobs.size(); ++i)
+        {
+            auto is_cached = false;
+            // pe modules without a pdb fall back to their export table,
+            // parsed on the caller thread as it reads guest memory
+            if(!results[i] && jobs[i].make == &symbols::make_pdb)
+                results[i] = make_module_exports(d, io, jobs[i].span, {jobs[i].name, jobs[i].id}, is_cached);
+            if(results[i])
+                insert_module(d, jobs[i].proc, fix_module_name(jobs[i].name), jobs[i].span, results[i], is_cached ? insert_e::cached : insert_e::loaded);
+        }
+    }
+}
+
 bool symbols::load_modules(core::Core& core, proc_t proc)
 {
+    auto& d = *core.symbols_->d_;
+    drain_pending_inserts(d);
+    auto jobs     = std::vector<ParseJob>{};
+    const auto io = memory::make_io(core, proc);
     modules::list(core, proc, [&](mod_t mod)
     {
-        load_module_from(core, proc, mod);
+        const auto opt_span = modules::span(core, proc, mod);
+        if(opt_span)
+            queue_module(d, jobs, proc, io, *opt_span);
         return walk_e::next;
     });
+    parse_modules(d, io, jobs);
     return true;
 }
 
+namespace
+{
+    void defer_parse_jobs(Data& d, const std::vector<ParseJob>& jobs)
+    {
+        for(const auto& job : jobs)
+            queue_prefetch_task(d, [&d, job]
+            {
+                auto p         = PendingInsert{};
+                p.name         = job.name;
+                p.id           = job.id;
+                p.proc         = job.proc;
+                p.span         = job.span;
+                p.pdb_fallback = job.make == &symbols::make_pdb;
+                p.module       = job.make(job.name, job.id);
+
+                const auto lock = std::lock_guard<std::mutex>{d.pending_mutex};
+                d.pending_inserts.emplace_back(std::move(p));
+            });
+    }
+}
+
+// list & identify modules inline while the guest is reachable, then
+// push the cpu-bound parses onto the background workers: the caller
+// regains control immediately & the next symbols query splices in
+// whatever has landed
+bool symbols::load_modules_deferred(core::Core& core, proc_t proc)
+{
+    auto& d = *core.symbols_->d_;
+    drain_pending_inserts(d);
+    auto jobs     = std::vector<ParseJob>{};
+    const auto io = memory::make_io(core, proc);
+    modules::list(core, proc, [&](mod_t mod)
+    {
+        const auto opt_span = modules::span(core, proc, mod);
+        if(opt_span)
+            queue_module(d, jobs, proc, io, *opt_span);
+        return walk_e::next;
+    });
+    defer_parse_jobs(d, jobs);
+    return true;
+}
+
+// module events arrive in bursts during process startup; identify the
+// entry once while the guest is paused (the pe header reads share the
+// page cache) & push the cpu-bound parse onto the background workers,
+// so a burst costs cheap reads & one batched splice instead of one
+// synchronous load per dll with the guest paused throughout
 opt<bpid_t> symbols::autoload_modules(core::Core& core, proc_t proc)
 {
     load_modules(core, proc);
     const auto ptr   = &core;
+    const auto seen  = std::make_shared<std::unordered_set<uint64_t>>();
     const auto flags = process::flags(core, proc);
     return modules::listen_create(core, proc, flags, [=](mod_t mod)
     {
-        load_module_from(*ptr, proc, mod);
+        const auto opt_span = modules::span(*ptr, proc, mod);
+        if(!opt_span)
+            return;
+
+        // both ldr notification paths can fire for the same entry
+        if(!seen->insert(opt_span->addr).second)
+            return;
+
+        auto& d       = *ptr->symbols_->d_;
+        auto jobs     = std::vector<ParseJob>{};
+        const auto io = memory::make_io(*ptr, proc);
+        queue_module(d, jobs, proc, io, *opt_span);
+        defer_parse_jobs(d, jobs);
     });
 }
 
@@ -568,7 +1280,7 @@ namespace
             if(!opt_span)
                 return walk_e::next;
 
-            if(!is_target(*opt_span, io, name))
+            if(!is_target(*core.symbols_->d_, *opt_span, io, name))
                 return walk_e::next;
 
             found = drv;
@@ -616,14 +1328,151 @@ bool symbols::load_driver(core::Core& core, const std::string& name)
 
 bool symbols::load_drivers(core::Core& core)
 {
+    auto& d       = *core.symbols_->d_;
+    auto jobs     = std::vector<ParseJob>{};
+    const auto io = memory::make_io_kernel(core);
     drivers::list(core, [&](driver_t driver)
     {
         const auto opt_span = drivers::span(core, driver);
-        if(opt_span)
-            load_driver_memory(core, *opt_span);
+        if(!opt_span)
+            return walk_e::next;
+
+        if(!queue_module(d, jobs, symbols::kernel, io, *opt_span))
+            queue_driver_name(d, jobs, core, driver, *opt_span);
+
+        return walk_e::next;
+    });
+    parse_modules(d, io, jobs);
+    return true;
+}
+
+namespace
+{
+    // splice mod under its fixed name, replacing any stale stand-in
+    void refresh_module(Data& d, const std::string& name, span_t span, const ModulePtr& mod)
+    {
+        const auto it = d.mods.find({name, symbols::kernel});
+        if(it == d.mods.end())
+        {
+            insert_module(d, symbols::kernel, name, span, mod, insert_e::loaded);
+            return;
+        }
+
+        it->second = Mod{mod, span};
+        d.mod_by_ids.emplace(mod->id(), mod);
+        ++d.generation;
+    }
+}
+
+bool symbols::refresh_drivers(core::Core& core, const on_refresh_fn& on_progress)
+{
+    auto& d = *core.symbols_->d_;
+    drain_pending_inserts(d);
+
+    // identify everything up front, while the guest is reachable
+    struct refresh_job_t
+    {
+        std::string name;
+        std::string id;
+        span_t      span;
+    };
+    auto jobs     = std::vector<refresh_job_t>{};
+    const auto io = memory::make_io_kernel(core);
+    drivers::list(core, [&](driver_t driver)
+    {
+        const auto opt_span = drivers::span(core, driver);
+        if(!opt_span)
+            return walk_e::next;
+
+        const auto opt_id = identify_module(d, *opt_span, io, &symbols::identify_pdb);
+        if(!opt_id)
+            return walk_e::next;
 
+        const auto it = d.mod_by_ids.find(opt_id->id);
+        if(it != d.mod_by_ids.end())
+        {
+            // unchanged guid, the cached identity is still valid
+            insert_module(d, symbols::kernel, fix_module_name(opt_id->name), *opt_span, it->second, insert_e::cached);
+            return walk_e::next;
+        }
+
+        jobs.push_back({opt_id->name, opt_id->id, *opt_span});
         return walk_e::next;
     });
+
+    // changed modules answer from a previous-guid index right away,
+    // mostly-right symbols beat none while the fresh parse runs
+    for(const auto& job : jobs)
+    {
+        const auto stale = symbols::make_stale_pdb(job.name, job.id);
+        if(!stale)
+            continue;
+
+        LOG(INFO, "stale %s %s", stale->id().data(), job.name.data());
+        refresh_module(d, fix_module_name(job.name), job.span, stale);
+        if(on_progress)
+            on_progress({0, jobs.size(), job.name.data(), true});
+    }
+
+    // fresh pdbs parse & index on the worker pool; completions land
+    // here and are spliced on this thread so lookups stay lock-free
+    struct done_t
+    {
+        size_t    index;
+        ModulePtr module;
+    };
+    auto       mutex    = std::mutex{};
+    auto       finished = std::vector<done_t>{};
+    auto       next     = std::atomic<size_t>{0};
+    const auto nthreads = std::min<size_t>(jobs.size(), std::max(std::thread::hardware_concurrency(), 1u));
+    auto       workers  = std::vector<std::thread>{};
+    workers.reserve(nthreads);
+    for(size_t t = 0; t < nthreads; ++t)
+        workers.emplace_back([&]
+        {
+            while(true)
+            {
+                const auto i = next.fetch_add(1);
+                if(i >= jobs.size())
+                    return;
+
+                auto mod = symbols::make_pdb(jobs[i].name, jobs[i].id);
+                if(mod)
+                    mod->symbol_offset(std::string{}); // materialize the index off the caller thread
+                const auto lock = std::lock_guard<std::mutex>{mutex};
+                finished.push_back({i, std::move(mod)});
+            }
+        });
+
+    auto done = size_t{0};
+    while(done < jobs.size())
+    {
+        auto batch = std::vector<done_t>{};
+        {
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            batch.swap(finished);
+        }
+        if(batch.empty())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+
+        for(auto& it : batch)
+        {
+            const auto& job       = jobs[it.index];
+            auto        is_cached = false;
+            if(!it.module)
+                it.module = make_module_exports(d, io, job.span, {job.name, job.id}, is_cached);
+            if(it.module)
+                refresh_module(d, fix_module_name(job.name), job.span, it.module);
+            ++done;
+            if(on_progress)
+                on_progress({done, jobs.size(), job.name.data(), false});
+        }
+    }
+    for(auto& worker : workers)
+        worker.join();
     return true;
 }
 
@@ -632,6 +1481,11 @@ bool symbols::unload(core::Core& core, proc_t proc, const std::string& module)
     return core.symbols_->remove(proc, module);
 }
 
+void symbols::set_load_policy(core::Core& core, const std::string& pattern, tier_e tier)
+{
+    core.symbols_->d_->policy.emplace_back(pattern, tier);
+}
+
 opt<uint64_t> symbols::address(core::Core& core, proc_t proc, const std::string& module, const std::string& symbol)
 {
     return core.symbols_->address(proc, module, symbol);
@@ -641,3 +1495,8 @@ std::string symbols::string(core::Core& core, proc_t proc, uint64_t addr)
 {
     return core.symbols_->string(proc, addr);
 }
+
+std::vector<std::string> symbols::string_many(core::Core& core, proc_t proc, const uint64_t* addrs, size_t count)
+{
+    return core.symbols_->string_many(proc, addrs, count);
+}
@@ -31,6 +31,16 @@ uint64_t threads::tid(core::Core& core, proc_t proc, thread_t thread)
     return core.os_->thread_id(proc, thread);
 }
 
+opt<thread_t> threads::find_tid(core::Core& core, uint64_t tid)
+{
+    return core.os_->thread_find(tid);
+}
+
+bool threads::list_info(core::Core& core, threads::on_info_fn on_info)
+{
+    return core.os_->thread_list_info(std::move(on_info));
+}
+
 opt<bpid_t> threads::listen_create(core::Core& core, const on_event_fn& on_thread_event)
 {
     return core.os_->listen_thread_create(on_thread_event);
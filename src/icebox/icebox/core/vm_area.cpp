@@ -16,6 +16,11 @@ opt<vm_area_t> vm_area::find(core::Core& core, proc_t proc, uint64_t addr)
     return core.os_->vm_area_find(proc, addr);
 }
 
+void vm_area::refresh(core::Core& core, proc_t proc)
+{
+    return core.os_->vm_area_refresh(proc);
+}
+
 opt<span_t> vm_area::span(core::Core& core, proc_t proc, vm_area_t vm_area)
 {
     return core.os_->vm_area_span(proc, vm_area);
@@ -0,0 +1,86 @@
+#include "counters.hpp"
+
+#include <cstring>
+#include <deque>
+#include <mutex>
+
+counters::counters_t& counters::get()
+{
+    static counters_t g_counters;
+    return g_counters;
+}
+
+namespace
+{
+    struct channels_t
+    {
+        std::mutex              mutex; // guards registration only
+        std::deque<counters::channel_t> all; // deque: addresses are stable
+    };
+
+    channels_t& channels()
+    {
+        static channels_t g_channels;
+        return g_channels;
+    }
+
+    thread_local counters::channel_t* g_current = nullptr;
+}
+
+counters::channel_t& counters::channel(const char* module)
+{
+    auto&      chans = channels();
+    const auto lock  = std::lock_guard{chans.mutex};
+    for(auto& chan : chans.all)
+        if(!strcmp(chan.name, module))
+            return chan;
+
+    auto& chan = chans.all.emplace_back();
+    chan.name  = module;
+    return chan;
+}
+
+counters::channel_t* counters::current_channel()
+{
+    return g_current;
+}
+
+void counters::visit_channels(const std::function<void(const channel_t&)>& on_channel)
+{
+    auto&      chans = channels();
+    const auto lock  = std::lock_guard{chans.mutex};
+    for(const auto& chan : chans.all)
+        on_channel(chan);
+}
+
+counters::channel_scope::channel_scope(channel_t& chan)
+    : owner(!g_current)
+{
+    if(owner)
+        g_current = &chan;
+}
+
+counters::channel_scope::~channel_scope()
+{
+    if(owner)
+        g_current = nullptr;
+}
+
+void counters::reset()
+{
+    auto& c = get();
+    c.fdp_calls.store(0, std::memory_order_relaxed);
+    c.fdp_bytes.store(0, std::memory_order_relaxed);
+    c.breakpoint_hits.store(0, std::memory_order_relaxed);
+    c.page_cache_hits.store(0, std::memory_order_relaxed);
+    c.page_cache_misses.store(0, std::memory_order_relaxed);
+    c.symbol_cache_hits.store(0, std::memory_order_relaxed);
+    c.symbol_cache_misses.store(0, std::memory_order_relaxed);
+    auto&      chans = channels();
+    const auto lock  = std::lock_guard{chans.mutex};
+    for(auto& chan : chans.all)
+    {
+        chan.calls.store(0, std::memory_order_relaxed);
+        chan.bytes.store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace counters
+{
+    // process-wide monitoring counters, bumped relaxed on hot paths &
+    // read without synchronization: values are approximate under load
+    struct counters_t
+    {
+        std::atomic<uint64_t> fdp_calls;
+        std::atomic<uint64_t> fdp_bytes;
+        std::atomic<uint64_t> breakpoint_hits;
+        std::atomic<uint64_t> page_cache_hits;
+        std::atomic<uint64_t> page_cache_misses;
+        std::atomic<uint64_t> symbol_cache_hits;
+        std::atomic<uint64_t> symbol_cache_misses;
+    };
+
+    counters_t& get();
+    void        reset();
+
+    inline void bump(std::atomic<uint64_t>& counter)
+    {
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // per-module channel accounting: every fdp round trip & its payload
+    // bytes are attributed to the outermost channel_scope on the calling
+    // thread, so higher layers claim attribution from the subsystems
+    // they drive with a single CHANNEL_SCOPE() line
+    struct channel_t
+    {
+        const char*           name;
+        std::atomic<uint64_t> calls;
+        std::atomic<uint64_t> bytes;
+    };
+
+    channel_t&  channel         (const char* module);
+    channel_t*  current_channel ();
+    void        visit_channels  (const std::function<void(const channel_t&)>& on_channel);
+
+    struct channel_scope
+    {
+        channel_scope(channel_t& chan);
+        ~channel_scope();
+
+        bool owner;
+    };
+} // namespace counters
+
+#define CHANNEL_SCOPE()                                                   \
+    static auto& g_channel_scope_chan = counters::channel(FDP_MODULE);    \
+    const auto   g_channel_scope_hold = counters::channel_scope{g_channel_scope_chan}
@@ -15,6 +15,9 @@ namespace
 #    define bswap64 _byteswap_uint64
 #else
 #    include <byteswap.h>
+#    ifdef __SSSE3__
+#        include <tmmintrin.h>
+#    endif
 #    define bswap16 __builtin_bswap16
 #    define bswap32 __builtin_bswap32
 #    define bswap64 __builtin_bswap64
@@ -41,6 +44,34 @@ namespace endian
         value = swap ? bswap(value) : value;
         memcpy(ptr, &value, sizeof value);
     }
+
+    // batched array decode for bulk struct loops: one wide copy when
+    // host & data agree on endianness, byte shuffles otherwise; both
+    // compile to plain unaligned vector loads on x86 & arm
+    template <typename T, bool swap>
+    static inline void read_array(T* dst, const void* vsrc, size_t count)
+    {
+        if(!swap)
+        {
+            memcpy(dst, vsrc, count * sizeof(T));
+            return;
+        }
+
+        const uint8_t* src = static_cast<const uint8_t*>(vsrc);
+        size_t         i   = 0;
+#ifdef __SSSE3__
+        const auto mask = sizeof(T) == 8
+                              ? _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7)
+                              : _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+        for(/**/; (i + 16 / sizeof(T)) <= count; i += 16 / sizeof(T))
+        {
+            const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i * sizeof(T)]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i]), _mm_shuffle_epi8(x, mask));
+        }
+#endif
+        for(/**/; i < count; ++i)
+            dst[i] = read_bits<T, true>(&src[i * sizeof(T)]);
+    }
 } // namespace endian
 
 static inline uint8_t read_byte(const void* ptr) { return endian::read_bits<uint8_t, !is_little_endian>(ptr); }
@@ -51,6 +82,11 @@ static inline uint16_t read_be16(const void* ptr) { return endian::read_bits<uin
 static inline uint32_t read_be32(const void* ptr) { return endian::read_bits<uint32_t, is_little_endian>(ptr); }
 static inline uint64_t read_be64(const void* ptr) { return endian::read_bits<uint64_t, is_little_endian>(ptr); }
 
+static inline void read_le32x4(uint32_t* dst, const void* ptr) { endian::read_array<uint32_t, !is_little_endian>(dst, ptr, 4); }
+static inline void read_le64x4(uint64_t* dst, const void* ptr) { endian::read_array<uint64_t, !is_little_endian>(dst, ptr, 4); }
+static inline void read_be32x4(uint32_t* dst, const void* ptr) { endian::read_array<uint32_t, is_little_endian>(dst, ptr, 4); }
+static inline void read_be64x4(uint64_t* dst, const void* ptr) { endian::read_array<uint64_t, is_little_endian>(dst, ptr, 4); }
+
 static inline void write_byte(void* ptr, uint8_t x) { endian::write_bits<!is_little_endian>(ptr, x); }
 static inline void write_le16(void* ptr, uint16_t x) { endian::write_bits<!is_little_endian>(ptr, x); }
 static inline void write_le32(void* ptr, uint32_t x) { endian::write_bits<!is_little_endian>(ptr, x); }
@@ -41,7 +41,8 @@ enum class msr_e : uint32_t
     fs_base,
     gs_base,
     kernel_gs_base,
-    last = kernel_gs_base, // must be last
+    tsc,
+    last = tsc, // must be last
 };
 
 enum class mode_e
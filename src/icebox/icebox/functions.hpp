@@ -13,6 +13,7 @@ namespace functions
 
     opt<arg_t>      read_stack      (core::Core& core, size_t index);
     opt<arg_t>      read_arg        (core::Core& core, size_t index);
+    bool            read_args       (core::Core& core, arg_t* args, size_t count);
     bool            write_arg       (core::Core& core, size_t index, arg_t arg);
     opt<uint64_t>   return_address  (core::Core& core, proc_t proc);
     bool            break_on_return (core::Core& core, std::string_view name, const on_return_fn& on_return);
@@ -17,9 +17,17 @@ namespace os
 
         virtual bool        setup               () = 0;
         virtual bool        is_kernel_address   (uint64_t ptr) = 0;
+        // first kernel address; everything below translates with the user dtb
+        virtual uint64_t    kernel_split        () = 0;
         virtual bool        read_page           (void* dst, uint64_t ptr, proc_t* proc, dtb_t dtb) = 0;
         virtual bool        write_page          (uint64_t ptr, const void* src, proc_t* proc, dtb_t dtb) = 0;
         virtual opt<phy_t>  virtual_to_physical (proc_t* proc, dtb_t dtb, uint64_t ptr) = 0;
+        // walk-only variant, never faults pages in, phy_t{0} means not resident
+        virtual opt<phy_t>  virtual_to_physical_walk(proc_t* proc, dtb_t dtb, uint64_t ptr) = 0;
+        // one memory::page_state_e byte per page covering span
+        virtual bool        residency_map       (proc_t* proc, dtb_t dtb, span_t span, uint8_t* states) = 0;
+        // fault in every non-resident page of span & return the count
+        virtual size_t      page_in             (proc_t proc, span_t span) = 0;
         virtual dtb_t       kernel_dtb          () = 0;
 
         virtual bool                proc_list       (process::on_proc_fn on_proc) = 0;
@@ -35,9 +43,13 @@ namespace os
 
         virtual bool            thread_list     (proc_t proc, threads::on_thread_fn on_thread) = 0;
         virtual opt<thread_t>   thread_current  () = 0;
+        // virtual address of the slot holding the current thread pointer
+        virtual opt<uint64_t>   thread_current_slot() = 0;
         virtual opt<proc_t>     thread_proc     (thread_t thread) = 0;
         virtual opt<uint64_t>   thread_pc       (proc_t proc, thread_t thread) = 0;
         virtual uint64_t        thread_id       (proc_t proc, thread_t thread) = 0;
+        virtual opt<thread_t>   thread_find     (uint64_t tid) = 0;
+        virtual bool            thread_list_info(threads::on_info_fn on_info) = 0;
 
         virtual bool                mod_list(proc_t proc, modules::on_mod_fn on_mod) = 0;
         virtual opt<std::string>    mod_name(proc_t proc, mod_t mod) = 0;
@@ -46,6 +58,7 @@ namespace os
 
         virtual bool                vm_area_list    (proc_t proc, vm_area::on_vm_area_fn on_vm_area) = 0;
         virtual opt<vm_area_t>      vm_area_find    (proc_t proc, uint64_t addr) = 0;
+        virtual void                vm_area_refresh (proc_t proc) = 0;
         virtual opt<span_t>         vm_area_span    (proc_t proc, vm_area_t vm_area) = 0;
         virtual vma_access_e        vm_area_access  (proc_t proc, vm_area_t vm_area) = 0;
         virtual vma_type_e          vm_area_type    (proc_t proc, vm_area_t vm_area) = 0;
@@ -64,6 +77,7 @@ namespace os
 
         virtual opt<arg_t>  read_stack  (size_t index) = 0;
         virtual opt<arg_t>  read_arg    (size_t index) = 0;
+        virtual bool        read_args   (arg_t* args, size_t count) = 0;
         virtual bool        write_arg   (size_t index, arg_t arg) = 0;
 
         virtual void debug_print() = 0;
@@ -73,4 +87,7 @@ namespace os
     void                    attach      (core::Core&, nt::Os&);
     std::unique_ptr<Module> make_linux  (core::Core& core);
     std::unique_ptr<Module> make_none   ();
+    // forwards every call after running os detection once, so an
+    // attach_lazy core pays detection on first os-dependent use only
+    std::unique_ptr<Module> make_lazy   (core::Core& core);
 } // namespace os
@@ -37,7 +37,12 @@ namespace symbols
     opt<Identity> identify_pdb(span_t span, const memory::Io& io);
 
     std::shared_ptr<Module> make_pdb    (const std::string& module, const std::string& guid);
+    // serialized index of the same module under any previous guid, the
+    // freshest one wins; stale by definition, see refresh_drivers
+    std::shared_ptr<Module> make_stale_pdb(const std::string& module, const std::string& guid);
+    std::shared_ptr<Module> make_exports(const memory::Io& io, span_t span, const std::string& module, const std::string& guid);
     std::shared_ptr<Module> make_dwarf  (const std::string& module, const std::string& guid);
+    std::shared_ptr<Module> make_dwarf  (const std::string& module); // _LINUX_SYMBOL_PATH/<module>/elf
     std::shared_ptr<Module> make_map    (const std::string& module, const std::string& guid);
 
     struct Modules
@@ -57,6 +62,7 @@ namespace symbols
         void                list_strucs (proc_t proc, const std::string& module, const symbols::on_name_fn& on_struc);
         opt<symbols::Struc> read_struc  (proc_t proc, const std::string& module, const std::string& struc);
         std::string         string      (proc_t proc, uint64_t addr);
+        std::vector<std::string> string_many(proc_t proc, const uint64_t* addrs, size_t count);
 
         // remove me
         static Modules& modules(core::Core& core);
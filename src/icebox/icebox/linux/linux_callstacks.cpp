@@ -0,0 +1,313 @@
+#include "callstacks.hpp"
+
+#define FDP_MODULE "linux_callstacks"
+#include "core.hpp"
+#include "endian.hpp"
+#include "interfaces/if_callstacks.hpp"
+#include "log.hpp"
+#include "memory.hpp"
+#include "os.hpp"
+#include "registers.hpp"
+#include "symbols.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    using caller_t  = callstacks::caller_t;
+    using context_t = callstacks::context_t;
+
+    // arch/x86/include/asm/orc_types.h
+    constexpr uint8_t orc_reg_undefined   = 0;
+    constexpr uint8_t orc_reg_prev_sp     = 1;
+    constexpr uint8_t orc_reg_bp          = 4;
+    constexpr uint8_t orc_reg_sp          = 5;
+    constexpr uint8_t orc_reg_bp_indirect = 8;
+    constexpr uint8_t orc_reg_sp_indirect = 9;
+
+    constexpr uint8_t orc_type_call         = 0;
+    constexpr uint8_t orc_type_regs         = 1;
+    constexpr uint8_t orc_type_regs_partial = 2;
+
+    constexpr size_t orc_raw_size = 6; // packed {s16 sp_offset; s16 bp_offset; u16 bits}
+
+    struct OrcEntry
+    {
+        int16_t sp_offset;
+        int16_t bp_offset;
+        uint8_t sp_reg;
+        uint8_t bp_reg;
+        uint8_t type;
+    };
+    using OrcTable = std::vector<std::pair<uint64_t, OrcEntry>>; // sorted by entry address
+
+    struct PtRegsOffsets
+    {
+        uint64_t ip;
+        uint64_t sp;
+        uint64_t bp;
+    };
+
+    struct LinuxCallstacks
+        : public callstacks::Module
+    {
+        LinuxCallstacks(core::Core& core);
+
+        // callstacks::Module
+        size_t  read        (caller_t* callers, size_t num_callers, proc_t proc) override;
+        size_t  read_from   (caller_t* callers, size_t num_callers, proc_t proc, const context_t& where) override;
+        size_t  read_partial(caller_t* callers, size_t num_callers, proc_t proc, const callstacks::options_t& opts) override;
+        bool    preload     (proc_t proc, const std::string& name, span_t span) override;
+
+        // members
+        core::Core&        core_;
+        bool               orc_tried_ = false;
+        OrcTable           orc_;
+        opt<PtRegsOffsets> pt_regs_;
+    };
+}
+
+LinuxCallstacks::LinuxCallstacks(core::Core& core)
+    : core_(core)
+{
+}
+
+std::unique_ptr<callstacks::Module> callstacks::make_linux(core::Core& core)
+{
+    return std::make_unique<LinuxCallstacks>(core);
+}
+
+namespace
+{
+    // the whole table is pulled from the guest once & indexed in host memory
+    bool load_orc(LinuxCallstacks& c)
+    {
+        if(c.orc_tried_)
+            return !c.orc_.empty();
+
+        c.orc_tried_         = true;
+        const auto start_ip  = symbols::address(c.core_, symbols::kernel, "kernel_sym", "__start_orc_unwind_ip");
+        const auto stop_ip   = symbols::address(c.core_, symbols::kernel, "kernel_sym", "__stop_orc_unwind_ip");
+        const auto start_orc = symbols::address(c.core_, symbols::kernel, "kernel_sym", "__start_orc_unwind");
+        const auto stop_orc  = symbols::address(c.core_, symbols::kernel, "kernel_sym", "__stop_orc_unwind");
+        if(!start_ip || !stop_ip || !start_orc || !stop_orc)
+            return FAIL(false, "no orc unwind tables in this kernel, using frame pointers");
+
+        const auto count = (*stop_ip - *start_ip) / 4;
+        if(!count || count != (*stop_orc - *start_orc) / orc_raw_size)
+            return FAIL(false, "orc unwind table sizes mismatch");
+
+        auto ips      = std::vector<uint8_t>(count * 4);
+        auto raw      = std::vector<uint8_t>(count * orc_raw_size);
+        const auto io = memory::make_io_kernel(c.core_);
+        if(!io.read_all(&ips[0], *start_ip, ips.size()) || !io.read_all(&raw[0], *start_orc, raw.size()))
+            return FAIL(false, "unable to read orc unwind tables");
+
+        c.orc_.reserve(count);
+        for(size_t i = 0; i < count; ++i)
+        {
+            // ip slots are self-relative, so guest addresses carry kaslr already
+            const auto rel  = static_cast<int32_t>(read_le32(&ips[i * 4]));
+            const auto* e   = &raw[i * orc_raw_size];
+            const auto bits = read_le16(&e[4]);
+            auto entry      = OrcEntry{};
+            entry.sp_offset = static_cast<int16_t>(read_le16(&e[0]));
+            entry.bp_offset = static_cast<int16_t>(read_le16(&e[2]));
+            entry.sp_reg    = bits & 0xf;
+            entry.bp_reg    = (bits >> 4) & 0xf;
+            entry.type      = (bits >> 8) & 0x3;
+            c.orc_.emplace_back(*start_ip + i * 4 + rel, entry);
+        }
+        if(!std::is_sorted(c.orc_.begin(), c.orc_.end(), [](const auto& a, const auto& b)
+        {
+            return a.first < b.first;
+        }))
+            std::sort(c.orc_.begin(), c.orc_.end(), [](const auto& a, const auto& b)
+            {
+                return a.first < b.first;
+            });
+
+        LOG(INFO, "%zd orc unwind entries loaded", c.orc_.size());
+        return true;
+    }
+
+    bool load_pt_regs(LinuxCallstacks& c)
+    {
+        if(c.pt_regs_)
+            return true;
+
+        const auto ip = symbols::read_member(c.core_, symbols::kernel, "kernel", "pt_regs", "ip");
+        const auto sp = symbols::read_member(c.core_, symbols::kernel, "kernel", "pt_regs", "sp");
+        const auto bp = symbols::read_member(c.core_, symbols::kernel, "kernel", "pt_regs", "bp");
+        if(!ip || !sp || !bp)
+            return FAIL(false, "unable to read pt_regs member offsets");
+
+        c.pt_regs_ = PtRegsOffsets{ip->offset, sp->offset, bp->offset};
+        return true;
+    }
+
+    bool get_next_context_orc(LinuxCallstacks& c, const memory::Io& io, context_t& ctx)
+    {
+        const auto it = std::upper_bound(c.orc_.begin(), c.orc_.end(), ctx.ip, [](uint64_t ip, const auto& e)
+        {
+            return ip < e.first;
+        });
+        if(it == c.orc_.begin())
+            return false;
+
+        const auto& orc = std::prev(it)->second;
+        auto cfa        = opt<uint64_t>{};
+        switch(orc.sp_reg)
+        {
+            case orc_reg_sp:            cfa = ctx.sp + orc.sp_offset; break;
+            case orc_reg_bp:            cfa = ctx.bp + orc.sp_offset; break;
+            case orc_reg_sp_indirect:   cfa = io.read(ctx.sp + orc.sp_offset); break;
+            case orc_reg_bp_indirect:   cfa = io.read(ctx.bp + orc.sp_offset); break;
+            default:                    return false; // rare bases, leave them to the fp fallback
+        }
+        if(!cfa || !*cfa)
+            return false;
+
+        const auto prev_bp = ctx.bp;
+        switch(orc.bp_reg)
+        {
+            case orc_reg_undefined: break;
+            case orc_reg_prev_sp:
+            {
+                const auto bp = io.read(*cfa + orc.bp_offset);
+                if(bp)
+                    ctx.bp = *bp;
+                break;
+            }
+            case orc_reg_bp:
+            {
+                const auto bp = io.read(prev_bp + orc.bp_offset);
+                if(bp)
+                    ctx.bp = *bp;
+                break;
+            }
+            default: break;
+        }
+
+        switch(orc.type)
+        {
+            case orc_type_call:
+            {
+                const auto ret = io.read(*cfa - 8);
+                if(!ret || !*ret)
+                    return false;
+
+                ctx.ip = *ret;
+                ctx.sp = *cfa;
+                return true;
+            }
+            case orc_type_regs:
+            {
+                if(!load_pt_regs(c))
+                    return false;
+
+                const auto ip = io.read(*cfa + c.pt_regs_->ip);
+                const auto sp = io.read(*cfa + c.pt_regs_->sp);
+                const auto bp = io.read(*cfa + c.pt_regs_->bp);
+                if(!ip || !*ip || !sp)
+                    return false;
+
+                ctx.ip = *ip;
+                ctx.sp = *sp;
+                ctx.bp = bp ? *bp : ctx.bp;
+                return true;
+            }
+            case orc_type_regs_partial:
+            {
+                // hardware iret frame: ip, cs, flags, sp, ss
+                const auto ip = io.read(*cfa);
+                const auto sp = io.read(*cfa + 3 * 8);
+                if(!ip || !*ip || !sp)
+                    return false;
+
+                ctx.ip = *ip;
+                ctx.sp = *sp;
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+
+    bool get_next_context_fp(const memory::Io& io, context_t& ctx)
+    {
+        if(!ctx.bp)
+            return false;
+
+        const auto bp  = io.read(ctx.bp);
+        const auto ret = io.read(ctx.bp + 8);
+        if(!bp || !ret || !*ret)
+            return false;
+
+        if(*bp && *bp <= ctx.bp)
+            return false; // the frame chain must walk up the stack
+
+        ctx.ip = *ret;
+        ctx.sp = ctx.bp + 2 * 8;
+        ctx.bp = *bp;
+        return true;
+    }
+}
+
+namespace
+{
+    size_t read_callers(LinuxCallstacks& c, caller_t* callers, size_t num_callers, proc_t proc, const context_t& first, bool fp_only)
+    {
+        const auto io = memory::make_io(c.core_, proc);
+        auto ctx      = first;
+        size_t i      = 0;
+        while(i < num_callers)
+        {
+            callers[i++].addr = ctx.ip;
+            auto ok           = false;
+            if(!fp_only && os::is_kernel_address(c.core_, ctx.ip) && load_orc(c))
+                ok = get_next_context_orc(c, io, ctx);
+            if(!ok)
+                ok = get_next_context_fp(io, ctx);
+            if(!ok)
+                break;
+        }
+        return i;
+    }
+}
+
+size_t LinuxCallstacks::read_from(caller_t* callers, size_t num_callers, proc_t proc, const context_t& where)
+{
+    return read_callers(*this, callers, num_callers, proc, where, false);
+}
+
+size_t LinuxCallstacks::read_partial(caller_t* callers, size_t num_callers, proc_t proc, const callstacks::options_t& opts)
+{
+    // same_module_only is ignored here, orc tables have no per-module boundaries
+    if(opts.max_depth)
+        num_callers = std::min(num_callers, opts.max_depth);
+
+    const auto ip  = registers::read(core_, reg_e::rip);
+    const auto sp  = registers::read(core_, reg_e::rsp);
+    const auto bp  = registers::read(core_, reg_e::rbp);
+    const auto cs  = registers::read(core_, reg_e::cs);
+    const auto ctx = context_t{ip, sp, bp, cs, flags::x64};
+    return read_callers(*this, callers, num_callers, proc, ctx, opts.frame_pointer_only);
+}
+
+size_t LinuxCallstacks::read(caller_t* callers, size_t num_callers, proc_t proc)
+{
+    const auto ip  = registers::read(core_, reg_e::rip);
+    const auto sp  = registers::read(core_, reg_e::rsp);
+    const auto bp  = registers::read(core_, reg_e::rbp);
+    const auto cs  = registers::read(core_, reg_e::cs);
+    const auto ctx = context_t{ip, sp, bp, cs, flags::x64};
+    return read_from(callers, num_callers, proc, ctx);
+}
+
+bool LinuxCallstacks::preload(proc_t /*proc*/, const std::string& /*name*/, span_t /*span*/)
+{
+    // orc tables are global to the kernel, there is nothing per-module to warm up
+    return load_orc(*this);
+}
@@ -4,18 +4,25 @@
 #include "core.hpp"
 #include "interfaces/if_os.hpp"
 #include "interfaces/if_symbols.hpp"
+#include "lists.hpp"
 #include "log.hpp"
+#include "utils/file.hpp"
 #include "utils/utils.hpp"
 
 #include <mbedtls/sha1.h>
 
 #include <algorithm>
 #include <array>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <iomanip>
+#include <map>
 #include <regex>
 #include <sstream>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace
 {
@@ -192,6 +199,8 @@ namespace
         CURRENT_TASK,
         KASAN_INIT,
         MODULES,
+        WAKE_UP_NEW_TASK,
+        DO_EXIT,
         SYMBOL_COUNT,
     };
 
@@ -209,6 +218,8 @@ namespace
             {cat_e::REQUIRED,   CURRENT_TASK,               "kernel_sym",   "current_task"      },
             {cat_e::OPTIONAL,   KASAN_INIT,                 "kernel_sym",   "kasan_init"        },
             {cat_e::REQUIRED,   MODULES,                    "kernel_sym",   "modules"           },
+            {cat_e::OPTIONAL,   WAKE_UP_NEW_TASK,           "kernel_sym",   "wake_up_new_task"  },
+            {cat_e::OPTIONAL,   DO_EXIT,                    "kernel_sym",   "do_exit"           },
     };
     // clang-format on
     static_assert(COUNT_OF(g_symbols) == SYMBOL_COUNT, "invalid symbols");
@@ -216,6 +227,23 @@ namespace
     using LinuxOffsets = std::array<opt<uint64_t>, OFFSET_COUNT>;
     using LinuxSymbols = std::array<opt<uint64_t>, SYMBOL_COUNT>;
 
+    struct TaskEntry
+    {
+        proc_t      proc;
+        uint64_t    pid;
+        std::string name;
+    };
+
+    struct VmaEntry
+    {
+        uint64_t vma;
+        uint64_t end;
+    };
+    struct VmaTree
+    {
+        std::map<uint64_t, VmaEntry> spans; // sorted by vm_start
+    };
+
     struct OsLinux
         : public os::Module
     {
@@ -224,9 +252,13 @@ namespace
         // os::IModule
         bool        setup               () override;
         bool        is_kernel_address   (uint64_t ptr) override;
+        uint64_t    kernel_split        () override;
         bool        read_page           (void* dst, uint64_t ptr, proc_t* proc, dtb_t dtb) override;
         bool        write_page          (uint64_t ptr, const void* src, proc_t* proc, dtb_t dtb) override;
         opt<phy_t>  virtual_to_physical (proc_t* proc, dtb_t dtb, uint64_t ptr) override;
+        opt<phy_t>  virtual_to_physical_walk(proc_t* proc, dtb_t dtb, uint64_t ptr) override;
+        bool        residency_map       (proc_t* proc, dtb_t dtb, span_t span, uint8_t* states) override;
+        size_t      page_in             (proc_t proc, span_t span) override;
         dtb_t       kernel_dtb          () override;
 
         bool                proc_list       (process::on_proc_fn on_process) override;
@@ -242,9 +274,12 @@ namespace
 
         bool            thread_list     (proc_t proc, threads::on_thread_fn on_thread) override;
         opt<thread_t>   thread_current  () override;
+        opt<uint64_t>   thread_current_slot() override;
         opt<proc_t>     thread_proc     (thread_t thread) override;
         opt<uint64_t>   thread_pc       (proc_t proc, thread_t thread) override;
         uint64_t        thread_id       (proc_t proc, thread_t thread) override;
+        opt<thread_t>   thread_find     (uint64_t tid) override;
+        bool            thread_list_info(threads::on_info_fn on_info) override;
 
         bool                mod_list(proc_t proc, modules::on_mod_fn on_module) override;
         opt<std::string>    mod_name(proc_t proc, mod_t mod) override;
@@ -253,6 +288,7 @@ namespace
 
         bool                vm_area_list    (proc_t proc, vm_area::on_vm_area_fn on_vm_area) override;
         opt<vm_area_t>      vm_area_find    (proc_t proc, uint64_t addr) override;
+        void                vm_area_refresh (proc_t proc) override;
         opt<span_t>         vm_area_span    (proc_t proc, vm_area_t vm_area) override;
         vma_access_e        vm_area_access  (proc_t proc, vm_area_t vm_area) override;
         vma_type_e          vm_area_type    (proc_t proc, vm_area_t vm_area) override;
@@ -271,6 +307,7 @@ namespace
 
         opt<arg_t>  read_stack  (size_t index) override;
         opt<arg_t>  read_arg    (size_t index) override;
+        bool        read_args   (arg_t* args, size_t count) override;
         bool        write_arg   (size_t index, arg_t arg) override;
 
         void debug_print() override;
@@ -284,6 +321,23 @@ namespace
         uint64_t kpgd    = 0;
         version  kversion = {"0"};
         uint64_t pt_regs_size;
+
+        // task snapshot kept current by process events, see load_task_cache
+        std::unordered_map<uint64_t, TaskEntry> tasks_;
+        bool                                    tasks_ready_ = false;
+        opt<bpid_t>                             bp_task_create_;
+        opt<bpid_t>                             bp_task_delete_;
+
+        // per-process vma snapshots, see load_vma_cache
+        std::unordered_map<uint64_t, VmaTree> vmas_;
+
+        // remembered guest list chains, revalidated in one batched read
+        lists::Walker lists_;
+
+        // current task resolved once per pause epoch, see thread_current
+        uint64_t      cpu_generation_ = ~uint64_t{0};
+        opt<thread_t> cpu_thread_;
+        opt<proc_t>   cpu_proc_;
     };
 }
 
@@ -298,21 +352,11 @@ namespace
     // dmesg -t | grep -i "Linux version" | sha1sum | cut -c1-40
     opt<std::string> read_str(const memory::Io& io, const uint64_t& addr, const unsigned int& buffer_size)
     {
-        std::string ret;
-        std::vector<char> buffer(buffer_size + 1);
-        uint64_t offset = 0;
-
-        do
-        {
-            const auto ok = io.read_all(&buffer[0], addr + offset, buffer_size);
-            if(!ok)
-                return FAIL(std::nullopt, "unable to read %u bytes at address (0x%" PRIx64 ")", buffer_size, addr + offset);
-
-            buffer.back() = 0;
-            ret.append(&buffer[0]);
-            offset += buffer_size;
-
-        } while(strlen(&buffer[0]) >= buffer_size);
+        // buffer_size is the structural maximum of the target field,
+        // read_cstr stops on the terminator & fetches page-sized chunks
+        auto ret = io.read_cstr(addr, buffer_size);
+        if(!ret)
+            return FAIL(std::nullopt, "unable to read %u bytes at address (0x%" PRIx64 ")", buffer_size, addr);
 
         return ret;
     }
@@ -535,6 +579,95 @@ namespace
         }
         return !fail;
     }
+
+    // resolved profile persisted per kernel build, symbols stored without kaslr
+    struct ProfileHeader
+    {
+        char     magic[4];
+        uint32_t version;
+        uint64_t banner; // linux_banner address without kaslr
+        uint64_t pt_regs_size;
+        uint64_t offset_count;
+        uint64_t symbol_count;
+    };
+    STATIC_ASSERT_EQ(sizeof(ProfileHeader), 40);
+
+    constexpr char     profile_magic[]   = {'I', 'B', 'L', 'P'};
+    constexpr uint32_t profile_version   = 1;
+    constexpr uint64_t profile_sentinel  = ~uint64_t{0}; // missing optional slot
+
+    opt<fs::path> profile_path(const std::string& hash)
+    {
+        const auto path = getenv("_LINUX_SYMBOL_PATH");
+        if(!path)
+            return {};
+
+        return fs::path(path) / "kernel" / hash / "profile.lpx";
+    }
+
+    bool load_profile(OsLinux& p, const std::string& hash, uint64_t candidate)
+    {
+        const auto path = profile_path(hash);
+        if(!path)
+            return false;
+
+        auto map = file::Map{};
+        if(!file::map_read(map, *path))
+            return false;
+
+        bool ok          = false;
+        const auto* src  = static_cast<const uint8_t*>(map.data);
+        auto        head = ProfileHeader{};
+        if(map.size >= sizeof head)
+        {
+            memcpy(&head, src, sizeof head);
+            ok = !memcmp(head.magic, profile_magic, sizeof head.magic)
+              && head.version == profile_version
+              && head.offset_count == OFFSET_COUNT
+              && head.symbol_count == SYMBOL_COUNT
+              && map.size == sizeof head + (OFFSET_COUNT + SYMBOL_COUNT) * sizeof(uint64_t);
+        }
+        if(ok)
+        {
+            const auto kaslr = candidate - head.banner;
+            auto       slots = std::array<uint64_t, OFFSET_COUNT + SYMBOL_COUNT>{};
+            memcpy(&slots[0], src + sizeof head, sizeof slots);
+            for(size_t i = 0; i < OFFSET_COUNT; ++i)
+                p.offsets_[i] = slots[i] != profile_sentinel ? opt<uint64_t>{slots[i]} : std::nullopt;
+            for(size_t i = 0; i < SYMBOL_COUNT; ++i)
+                p.symbols_[i] = slots[OFFSET_COUNT + i] != profile_sentinel ? opt<uint64_t>{slots[OFFSET_COUNT + i] + kaslr} : std::nullopt;
+            p.pt_regs_size = head.pt_regs_size;
+        }
+        file::unmap(map);
+        return ok;
+    }
+
+    void save_profile(OsLinux& p, const std::string& hash, uint64_t candidate, uint64_t kaslr)
+    {
+        const auto path = profile_path(hash);
+        if(!path)
+            return;
+
+        auto head = ProfileHeader{};
+        memcpy(head.magic, profile_magic, sizeof head.magic);
+        head.version      = profile_version;
+        head.banner       = candidate - kaslr;
+        head.pt_regs_size = p.pt_regs_size;
+        head.offset_count = OFFSET_COUNT;
+        head.symbol_count = SYMBOL_COUNT;
+
+        auto buffer = std::vector<uint8_t>{};
+        buffer.resize(sizeof head + (OFFSET_COUNT + SYMBOL_COUNT) * sizeof(uint64_t));
+        memcpy(&buffer[0], &head, sizeof head);
+        auto* slots = reinterpret_cast<uint64_t*>(&buffer[sizeof head]);
+        for(size_t i = 0; i < OFFSET_COUNT; ++i)
+            slots[i] = p.offsets_[i] ? *p.offsets_[i] : profile_sentinel;
+        for(size_t i = 0; i < SYMBOL_COUNT; ++i)
+            slots[OFFSET_COUNT + i] = p.symbols_[i] ? *p.symbols_[i] - kaslr : profile_sentinel;
+
+        if(!file::write_async(*path, std::move(buffer)))
+            LOG(ERROR, "unable to queue kernel profile %s", path->generic_string().data());
+    }
 }
 
 bool OsLinux::setup()
@@ -571,6 +704,23 @@ bool OsLinux::setup()
         const auto hash = guid(*linux_banner);
         LOG(INFO, "hash of linux banner : %s", hash.data());
 
+        if(!std::regex_search(*linux_banner, match, pattern))
+            return FAIL(walk_e::next, "unable to parse kernel version in this linux banner");
+
+        kversion = match[1].str();
+
+        // a known kernel restores its resolved profile & skips dwarf queries
+        if(load_profile(*this, hash, candidate))
+        {
+            if(check_setup(*this))
+            {
+                LOG(INFO, "kernel %s loaded from cached profile", kversion.get().data());
+                return walk_e::stop;
+            }
+            offsets_ = {};
+            symbols_ = {};
+        }
+
         const auto kaslr = make_symbols(core_, hash, "linux_banner", candidate);
         if(!kaslr)
             return walk_e::next;
@@ -585,15 +735,12 @@ bool OsLinux::setup()
         if(!check_setup(*this))
             return walk_e::next;
 
-        if(!std::regex_search(*linux_banner, match, pattern))
-            return FAIL(walk_e::next, "unable to parse kernel version in this linux banner");
-
-        kversion             = match[1].str();
         const auto opt_struc = symbols::read_struc(core_, symbols::kernel, "kernel", "pt_regs");
         if(!opt_struc)
             return FAIL(walk_e::next, "unable to read the size of pt_regs structure");
 
         pt_regs_size = opt_struc->bytes;
+        save_profile(*this, hash, candidate, *kaslr);
         LOG(INFO, "kernel %s loaded with kaslr 0x%" PRIx64, kversion.get().data(), *kaslr);
         return walk_e::stop;
     });
@@ -609,26 +756,77 @@ std::unique_ptr<os::Module> os::make_linux(core::Core& core)
     return std::make_unique<OsLinux>(core);
 }
 
-bool OsLinux::proc_list(process::on_proc_fn on_process)
+namespace
 {
-    const auto current = proc_current();
-    if(!current)
-        return false;
-
-    const auto head    = current->id + *offsets_[TASKSTRUCT_TASKS];
-    opt<uint64_t> link = head;
-    do
+    bool list_tasks_from_guest(OsLinux& p, const process::on_proc_fn& on_process)
     {
-        const auto thread = thread_t{*link - *offsets_[TASKSTRUCT_TASKS]};
-        const auto proc   = thread_proc(thread);
-        if(proc)
+        const auto current = p.proc_current();
+        if(!current)
+            return false;
+
+        // the head task is reported first, lists::walk yields the others
+        if(const auto proc = p.thread_proc(thread_t{current->id}))
             if(on_process(*proc) == walk_e::stop)
                 return true;
 
-        link = io_.read(*link);
-        if(!link)
-            return FAIL(false, "unable to read next process address");
-    } while(link != head);
+        const auto head = current->id + *p.offsets_[TASKSTRUCT_TASKS];
+        return lists::walk(p.lists_, p.io_, head, [&](uint64_t link)
+        {
+            const auto thread = thread_t{link - *p.offsets_[TASKSTRUCT_TASKS]};
+            const auto proc   = p.thread_proc(thread);
+            if(!proc)
+                return walk_e::next;
+
+            return on_process(*proc);
+        });
+    }
+
+    void cache_task(OsLinux& p, proc_t proc)
+    {
+        const auto name   = p.proc_name(proc);
+        p.tasks_[proc.id] = TaskEntry{proc, p.proc_id(proc), name ? *name : std::string{}};
+    }
+
+    bool load_task_cache(OsLinux& p)
+    {
+        if(p.tasks_ready_)
+            return true;
+
+        if(!p.symbols_[WAKE_UP_NEW_TASK] || !p.symbols_[DO_EXIT])
+            return false;
+
+        // one full guest walk, then task events keep the table current
+        p.tasks_.clear();
+        const auto ok = list_tasks_from_guest(p, [&](proc_t proc)
+        {
+            cache_task(p, proc);
+            return walk_e::next;
+        });
+        if(!ok)
+            return false;
+
+        p.bp_task_create_ = p.listen_proc_create([&p](proc_t proc)
+        {
+            cache_task(p, proc);
+        });
+        p.bp_task_delete_ = p.listen_proc_delete([&p](proc_t proc)
+        {
+            p.tasks_.erase(proc.id);
+            p.vmas_.erase(proc.id);
+        });
+        p.tasks_ready_ = p.bp_task_create_ && p.bp_task_delete_;
+        return p.tasks_ready_;
+    }
+}
+
+bool OsLinux::proc_list(process::on_proc_fn on_process)
+{
+    if(!load_task_cache(*this))
+        return list_tasks_from_guest(*this, on_process);
+
+    for(const auto& it : tasks_)
+        if(on_process(it.second.proc) == walk_e::stop)
+            break;
 
     return true;
 }
@@ -639,11 +837,36 @@ opt<proc_t> OsLinux::proc_current()
     if(!thread)
         return {};
 
-    return thread_proc(*thread);
+    if(cpu_proc_)
+        return cpu_proc_; // same pause epoch, resolved by a previous call
+
+    cpu_proc_ = thread_proc(*thread);
+    return cpu_proc_;
 }
 
 opt<proc_t> OsLinux::proc_find(std::string_view name, flags_t /*flags*/)
 {
+    if(load_task_cache(*this))
+    {
+        for(const auto& it : tasks_)
+            if(it.second.name == name)
+                return it.second.proc;
+
+        // exec rewrites comm after the fork hook fired, refresh names on miss
+        auto found = opt<proc_t>{};
+        for(auto& it : tasks_)
+        {
+            const auto got = proc_name(it.second.proc);
+            if(!got)
+                continue;
+
+            it.second.name = *got;
+            if(!found && *got == name)
+                found = it.second.proc;
+        }
+        return found;
+    }
+
     opt<proc_t> found;
     proc_list([&](proc_t proc)
     {
@@ -659,6 +882,15 @@ opt<proc_t> OsLinux::proc_find(std::string_view name, flags_t /*flags*/)
 
 opt<proc_t> OsLinux::proc_find(uint64_t pid)
 {
+    if(load_task_cache(*this))
+    {
+        for(const auto& it : tasks_)
+            if(it.second.pid == pid)
+                return it.second.proc;
+
+        return {};
+    }
+
     opt<proc_t> ret;
     proc_list([&](proc_t proc)
     {
@@ -700,11 +932,31 @@ bool OsLinux::is_kernel_address(uint64_t ptr)
     return (ptr > 0x7fffffffffffffff); // middle of 64bits address space, under -> user space, upper -> kernel space
 }
 
+uint64_t OsLinux::kernel_split()
+{
+    return 0x8000000000000000;
+}
+
 opt<phy_t> OsLinux::virtual_to_physical(proc_t* /*proc*/, dtb_t /*dtb*/, uint64_t /*ptr*/)
 {
     return {};
 }
 
+opt<phy_t> OsLinux::virtual_to_physical_walk(proc_t* /*proc*/, dtb_t /*dtb*/, uint64_t /*ptr*/)
+{
+    return {};
+}
+
+bool OsLinux::residency_map(proc_t* /*proc*/, dtb_t /*dtb*/, span_t /*span*/, uint8_t* /*states*/)
+{
+    return false;
+}
+
+size_t OsLinux::page_in(proc_t /*proc*/, span_t /*span*/)
+{
+    return 0; // no fault injection support on linux guests yet
+}
+
 bool OsLinux::read_page(void* /*dst*/, uint64_t /*ptr*/, proc_t* /*proc*/, dtb_t /*dtb*/)
 {
     return false;
@@ -917,11 +1169,32 @@ bool OsLinux::thread_list(proc_t proc, threads::on_thread_fn on_thread)
 
 opt<thread_t> OsLinux::thread_current()
 {
-    const auto addr = io_.read(per_cpu + *symbols_[CURRENT_TASK] - *symbols_[PER_CPU_START]);
+    const auto generation = memory::cache_generation(core_);
+    if(generation == cpu_generation_ && cpu_thread_)
+        return cpu_thread_;
+
+    cpu_generation_ = generation;
+    cpu_thread_     = {};
+    cpu_proc_       = {};
+
+    // gs_base follows the running vcpu, refresh it once per pause epoch
+    auto base = registers::read_msr(core_, msr_e::gs_base);
+    if(!is_kernel_address(base))
+        base = registers::read_msr(core_, msr_e::kernel_gs_base);
+    if(!is_kernel_address(base))
+        base = per_cpu; // fall back to the setup-time area
+
+    const auto addr = io_.read(base + *symbols_[CURRENT_TASK] - *symbols_[PER_CPU_START]);
     if(!addr)
         return FAIL(std::nullopt, "unable to read current_task in per_cpu area");
 
-    return thread_t{*addr};
+    cpu_thread_ = thread_t{*addr};
+    return cpu_thread_;
+}
+
+opt<uint64_t> OsLinux::thread_current_slot()
+{
+    return {};
 }
 
 namespace
@@ -992,6 +1265,39 @@ uint64_t OsLinux::thread_id(proc_t /*proc*/, thread_t thread)
     return *pid;
 }
 
+bool OsLinux::thread_list_info(threads::on_info_fn on_info)
+{
+    auto walk = walk_e::next;
+    proc_list([&](proc_t proc)
+    {
+        thread_list(proc, [&](thread_t thread)
+        {
+            walk = on_info(threads::info_t{thread, proc, thread_id(proc, thread), thread_pc(proc, thread).value_or(0)});
+            return walk;
+        });
+        return walk;
+    });
+    return true;
+}
+
+opt<thread_t> OsLinux::thread_find(uint64_t tid)
+{
+    auto found = opt<thread_t>{};
+    proc_list([&](proc_t proc)
+    {
+        thread_list(proc, [&](thread_t thread)
+        {
+            if(thread_id(proc, thread) != tid)
+                return walk_e::next;
+
+            found = thread;
+            return walk_e::stop;
+        });
+        return found ? walk_e::stop : walk_e::next;
+    });
+    return found;
+}
+
 namespace
 {
     template <typename T>
@@ -1187,8 +1493,71 @@ opt<mod_t> OsLinux::mod_find(proc_t proc, uint64_t addr)
     return found;
 }
 
+namespace
+{
+    const VmaTree* load_vma_cache(OsLinux& p, proc_t proc)
+    {
+        const auto it = p.vmas_.find(proc.id);
+        if(it != p.vmas_.end())
+            return &it->second;
+
+        const auto mm = proc_mm(p, proc.id);
+        if(!mm)
+            return nullptr;
+
+        const auto first = p.io_.read(*mm + *p.offsets_[MMSTRUCT_MMAP]);
+        if(!first)
+            return FAIL(nullptr, "unable to read mmap of process 0x%" PRIx64, proc.id);
+
+        // follow the chain once, then batch every span in one read pass
+        auto nodes = std::vector<uint64_t>{};
+        for(auto vma = *first; vma;)
+        {
+            nodes.push_back(vma);
+            const auto next = p.io_.read(vma + *p.offsets_[VMAREASTRUCT_VMNEXT]);
+            if(!next)
+                return FAIL(nullptr, "unable to read the next vm_area_struct pointer");
+
+            vma = *next;
+        }
+
+        struct raw_t
+        {
+            uint64_t start;
+            uint64_t end;
+        };
+        auto raws = std::vector<raw_t>(nodes.size());
+        auto ranges = std::vector<memory::io_range_t>{};
+        ranges.reserve(nodes.size() * 2);
+        for(size_t i = 0; i < nodes.size(); ++i)
+        {
+            ranges.push_back(memory::io_range_t{nodes[i] + *p.offsets_[VMAREASTRUCT_VMSTART], &raws[i].start, sizeof raws[i].start});
+            ranges.push_back(memory::io_range_t{nodes[i] + *p.offsets_[VMAREASTRUCT_VMEND], &raws[i].end, sizeof raws[i].end});
+        }
+        if(!ranges.empty())
+            if(!p.io_.read_many(&ranges[0], ranges.size()))
+                return FAIL(nullptr, "unable to batch-read vm_area spans");
+
+        auto tree = VmaTree{};
+        for(size_t i = 0; i < nodes.size(); ++i)
+            tree.spans[raws[i].start] = VmaEntry{nodes[i], raws[i].end};
+
+        return &(p.vmas_[proc.id] = std::move(tree));
+    }
+}
+
 bool OsLinux::vm_area_list(proc_t proc, vm_area::on_vm_area_fn on_vm_area)
 {
+    // the snapshot is sorted by vm_start, like the guest chain
+    if(const auto* tree = load_vma_cache(*this, proc))
+    {
+        for(const auto& it : tree->spans)
+            if(on_vm_area(vm_area_t{it.second.vma}) == walk_e::stop)
+                break;
+
+        return true;
+    }
+
     const auto mm = proc_mm(*this, proc.id);
     if(!mm)
         return false;
@@ -1202,6 +1571,19 @@ bool OsLinux::vm_area_list(proc_t proc, vm_area::on_vm_area_fn on_vm_area)
 
 opt<vm_area_t> OsLinux::vm_area_find(proc_t proc, uint64_t addr)
 {
+    if(const auto* tree = load_vma_cache(*this, proc))
+    {
+        auto it = tree->spans.upper_bound(addr);
+        if(it == tree->spans.begin())
+            return {};
+
+        --it;
+        if(!(it->first <= addr && addr < it->second.end))
+            return {};
+
+        return vm_area_t{it->second.vma};
+    }
+
     opt<vm_area_t> found = {};
     vm_area_list(proc, [&](vm_area_t vm_area)
     {
@@ -1218,6 +1600,12 @@ opt<vm_area_t> OsLinux::vm_area_find(proc_t proc, uint64_t addr)
     return found;
 }
 
+void OsLinux::vm_area_refresh(proc_t proc)
+{
+    // drop the snapshot, the next query reloads it from the guest
+    vmas_.erase(proc.id);
+}
+
 opt<span_t> OsLinux::vm_area_span(proc_t /*proc*/, vm_area_t vm_area)
 {
     const auto start = io_.read(vm_area.id + *offsets_[VMAREASTRUCT_VMSTART]);
@@ -1366,6 +1754,11 @@ opt<arg_t> OsLinux::read_arg(size_t /*index*/)
     return {};
 }
 
+bool OsLinux::read_args(arg_t* /*args*/, size_t /*count*/)
+{
+    return false;
+}
+
 bool OsLinux::write_arg(size_t /*index*/, arg_t /*arg*/)
 {
     return false;
@@ -1375,14 +1768,39 @@ void OsLinux::debug_print()
 {
 }
 
-opt<bpid_t> OsLinux::listen_proc_create(const process::on_event_fn& /*on_create*/)
+opt<bpid_t> OsLinux::listen_proc_create(const process::on_event_fn& on_create)
 {
-    return {};
+    if(!symbols_[WAKE_UP_NEW_TASK])
+        return {};
+
+    const auto bp = state::break_on(core_, "wake_up_new_task", *symbols_[WAKE_UP_NEW_TASK], [=]
+    {
+        // the new task_struct is the first argument
+        const auto task = registers::read(core_, reg_e::rdi);
+        const auto proc = thread_proc(thread_t{task});
+        if(proc)
+            on_create(*proc);
+    });
+    return state::save_breakpoint(core_, bp);
 }
 
-opt<bpid_t> OsLinux::listen_proc_delete(const process::on_event_fn& /*on_delete*/)
+opt<bpid_t> OsLinux::listen_proc_delete(const process::on_event_fn& on_delete)
 {
-    return {};
+    if(!symbols_[DO_EXIT])
+        return {};
+
+    const auto bp = state::break_on(core_, "do_exit", *symbols_[DO_EXIT], [=]
+    {
+        // do_exit fires per task, only the group leader retires the process
+        const auto thread = thread_current();
+        if(!thread)
+            return;
+
+        const auto proc = thread_proc(*thread);
+        if(proc && proc->id == thread->id)
+            on_delete(*proc);
+    });
+    return state::save_breakpoint(core_, bp);
 }
 
 opt<bpid_t> OsLinux::listen_thread_create(const threads::on_event_fn& /*on_create*/)
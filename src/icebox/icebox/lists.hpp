@@ -0,0 +1,26 @@
+#pragma once
+
+#include "enums.hpp"
+#include "types.hpp"
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace memory { struct Io; }
+
+namespace lists
+{
+    using on_node_fn = std::function<walk_e(uint64_t link)>;
+
+    // remembers the nodes seen on previous walks, keyed by list head
+    struct Walker
+    {
+        std::unordered_map<uint64_t, std::vector<uint64_t>> chains;
+    };
+
+    // walk a circular guest list & report every link after the head;
+    // a remembered chain is revalidated in one batched read, so repeat
+    // walks cost one round trip instead of one read per node
+    bool walk(Walker& walker, const memory::Io& io, uint64_t head, const on_node_fn& on_node);
+} // namespace lists
@@ -19,6 +19,7 @@ namespace logg
     void    init    (int argc, char** argv);
     void    redirect(log_fn on_log);
     void    print   (level_t level, const char* fmt, ...);
+    void    flush   (); // block until queued messages hit the sink
 } // namespace logg
 
 #define LOG_WITH(LEVEL, FMT, ...)                                 \
@@ -29,9 +30,34 @@ namespace logg
         logg::print((LEVEL), FDP_MODULE ": " FMT, ##__VA_ARGS__); \
     } while(0)
 
-#define LOG(LEVEL, FMT, ...) LOG_WITH(logg::level_t::info, FMT, ##__VA_ARGS__)
+// stripped calls still type-check their format arguments
+#define LOG_STRIP(FMT, ...)               \
+    do                                    \
+    {                                     \
+        if(false)                         \
+            printf((FMT), ##__VA_ARGS__); \
+    } while(0)
+
+// compile-time level stripping: define ICEBOX_LOG_LEVEL to 1 to strip
+// info logs, 2 to strip error logs too
+#ifndef ICEBOX_LOG_LEVEL
+#    define ICEBOX_LOG_LEVEL 0
+#endif
 
-#define FAIL(VALUE, FMT, ...) [&] {                     \
-    LOG_WITH(logg::level_t::error, FMT, ##__VA_ARGS__); \
-    return VALUE;                                       \
-}()
+#if ICEBOX_LOG_LEVEL >= 1
+#    define LOG(LEVEL, FMT, ...) LOG_STRIP(FMT, ##__VA_ARGS__)
+#else
+#    define LOG(LEVEL, FMT, ...) LOG_WITH(logg::level_t::info, FMT, ##__VA_ARGS__)
+#endif
+
+#if ICEBOX_LOG_LEVEL >= 2
+#    define FAIL(VALUE, FMT, ...) [&] {   \
+        LOG_STRIP(FMT, ##__VA_ARGS__);    \
+        return VALUE;                     \
+    }()
+#else
+#    define FAIL(VALUE, FMT, ...) [&] {                     \
+        LOG_WITH(logg::level_t::error, FMT, ##__VA_ARGS__); \
+        return VALUE;                                       \
+    }()
+#endif
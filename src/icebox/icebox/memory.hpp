@@ -2,19 +2,101 @@
 
 #include "types.hpp"
 
+#include <functional>
+#include <string>
+#include <vector>
+
 namespace core { struct Core; }
 
 namespace memory
 {
     opt<phy_t>  virtual_to_physical         (core::Core& core, proc_t proc, uint64_t ptr);
     opt<phy_t>  virtual_to_physical_with_dtb(core::Core& core, dtb_t dtb, uint64_t ptr);
+    size_t      virtual_to_physical_many    (core::Core& core, proc_t proc, const uint64_t* ptrs, opt<phy_t>* phys, size_t count);
+
+    enum page_state_e : uint8_t
+    {
+        page_none   = 0, // not resident
+        page_valid  = 1 << 0,
+        page_write  = 1 << 1,
+        page_user   = 1 << 2,
+        page_noexec = 1 << 3,
+        page_large  = 1 << 4,
+    };
+
+    // fill one page_state_e byte per page covering span
+    bool        residency_map               (core::Core& core, proc_t proc, span_t span, uint8_t* states);
+
+    // compact va-space snapshot: one bit per resident executable page,
+    // grouped per private executable vm area so sparse address spaces
+    // stay small, see snapshot_exec & diff_exec
+    struct va_snapshot_t
+    {
+        struct region_t
+        {
+            uint64_t base;  // first page of the vm area
+            uint64_t pages; // pages covered by the bitmap
+            size_t   first; // index of the region's first word in bits
+        };
+        std::vector<region_t> regions;
+        std::vector<uint64_t> bits;
+    };
+    // bitmap built from the residency engine alone, no page content is read
+    opt<va_snapshot_t> snapshot_exec(core::Core& core, proc_t proc);
+    // walk ranges executable in next but not in prev; an unchanged
+    // region costs one bitmap compare and no guest access at all
+    using on_span_fn = std::function<walk_e(span_t)>;
+    bool               diff_exec    (const va_snapshot_t& prev, const va_snapshot_t& next, const on_span_fn& on_range);
+    // explicit warm-up: walk the process vm areas, translate them with
+    // the batch walker & stream every resident page into the host cache
+    // so a trace session pays its faults here instead of on first events;
+    // returns the number of pages streamed
+    size_t      prefetch                    (core::Core& core, proc_t proc);
+    // fault queue for swapped-out ranges: every non-resident page of
+    // span is paged in through injected faults driven off one shared
+    // return breakpoint; returns the number of pages faulted in
+    size_t      page_in                     (core::Core& core, proc_t proc, span_t span);
+    // residency-driven copy for sparse mappings: the residency map is
+    // read once, resident extents stream in large chunked reads & each
+    // non-resident extent is reported once as a hole with null data,
+    // so dumps over swapped ranges never enter the per-page fallback
+    using on_extent_fn = std::function<walk_e(span_t extent, const uint8_t* data)>;
+    bool        read_sparse                 (core::Core& core, proc_t proc, span_t span, const on_extent_fn& on_extent);
+    // total guest physical memory size in bytes
+    opt<uint64_t> physical_size             (core::Core& core);
     bool        read_virtual                (core::Core& core, proc_t proc, void* dst, uint64_t src, size_t size);
     bool        read_virtual_with_dtb       (core::Core& core, dtb_t dtb, void* dst, uint64_t src, size_t size);
+    // io contexts pre-select the dtb but keep the owning process for page-in fallbacks
+    bool        read_virtual_with_proc_dtb  (core::Core& core, proc_t proc, dtb_t dtb, void* dst, uint64_t src, size_t size);
     bool        read_physical               (core::Core& core, void* dst, uint64_t src, size_t size);
+    // pause-less gauge sampling: reads go straight to the guest while
+    // it runs, bypassing every cache, values may tear
+    bool        sample_physical             (core::Core& core, void* dst, uint64_t src, size_t size);
     bool        write_virtual               (core::Core& core, proc_t proc, uint64_t dst, const void*, size_t size);
     bool        write_virtual_with_dtb      (core::Core& core, dtb_t dtb, uint64_t dst, const void*, size_t size);
+    bool        write_virtual_with_proc_dtb (core::Core& core, proc_t proc, dtb_t dtb, uint64_t dst, const void*, size_t size);
     bool        write_physical              (core::Core& core, uint64_t dst, const void* src, size_t size);
 
+    // bumped whenever cached guest state is flushed, e.g. on resume or single step
+    uint64_t    cache_generation            (core::Core& core);
+    // bumped on every guest write; code rarely changes, so decoded
+    // instruction caches stay valid across pauses until it moves
+    uint64_t    write_generation            (core::Core& core);
+
+    struct io_range_t
+    {
+        uint64_t ptr;
+        void*    dst;
+        size_t   size;
+    };
+
+    struct write_range_t
+    {
+        uint64_t    ptr;
+        const void* src;
+        size_t      size;
+    };
+
     struct Io
     {
         ~Io() = default;
@@ -29,6 +111,11 @@ namespace memory
         opt<uint64_t>   be64    (uint64_t ptr) const;
         opt<uint64_t>   read    (uint64_t ptr) const;
         bool            read_all(void* dst, uint64_t ptr, size_t size) const;
+        bool            read_many(const io_range_t* ranges, size_t count) const;
+
+        // string readers, fetch page-sized chunks & stop on the terminator
+        opt<std::string>    read_cstr   (uint64_t ptr, size_t max_size) const;
+        opt<std::string>    read_utf16  (uint64_t ptr, size_t max_size) const;
         opt<phy_t>      physical(uint64_t ptr) const;
 
         // write methods
@@ -41,10 +128,18 @@ namespace memory
         bool    write_be64  (uint64_t dst, uint64_t arg) const;
         bool    write       (uint64_t dst, uint64_t arg) const;
         bool    write_all   (uint64_t dst, const void* src, size_t size) const;
+        // group ranges by touched page: one batched fetch of every
+        // page, a single patch pass, then one write per contiguous
+        // page run, whatever the range count; later ranges win on
+        // overlap, as if written sequentially
+        bool    write_many  (const write_range_t* ranges, size_t count) const;
 
         core::Core& core;
         opt<proc_t> proc;
         dtb_t       dtb;
+        // first kernel address, pinned at construction so every access
+        // selects its dtb with a compare instead of an os lookup
+        uint64_t    split;
     };
 
     Io  make_io_kernel  (core::Core& core);
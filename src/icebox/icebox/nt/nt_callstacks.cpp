@@ -9,11 +9,16 @@
 #include "log.hpp"
 #include "nt_os.hpp"
 #include "nt_types.hpp"
+#include "interfaces/if_symbols.hpp"
+#include "utils/file.hpp"
+#include "utils/hash.hpp"
 #include "utils/path.hpp"
 #include "utils/pe.hpp"
 #include "utils/utils.hpp"
 
 #include <array>
+#include <cstdlib>
+#include <cstring>
 #include <map>
 #include <tuple>
 
@@ -76,6 +81,73 @@ namespace
         Unwinds         unwinds;
     };
 
+    struct FrameKey
+    {
+        const FunctionTable* table;
+        uint32_t             off;
+    };
+
+    inline bool operator==(const FrameKey& a, const FrameKey& b)
+    {
+        return a.table == b.table && a.off == b.off;
+    }
+
+    // stack adjustment & register slots, decoded once per rip
+    struct FrameUnwind
+    {
+        uint64_t stack_frame_size;
+        uint64_t prev_frame_reg;
+        uint32_t machframe_rip_off;
+        uint8_t  frame_reg_offset;
+    };
+}
+
+namespace std
+{
+    template <>
+    struct hash<FrameKey>
+    {
+        size_t operator()(const FrameKey& arg) const
+        {
+            size_t seed = 0;
+            ::hash::combine(seed, arg.table, arg.off);
+            return seed;
+        }
+    };
+} // namespace std
+
+namespace
+{
+    // x86 has no in-image unwind tables, classify call sites instead
+    struct RetKey
+    {
+        uint64_t proc;
+        uint64_t addr;
+    };
+
+    inline bool operator==(const RetKey& a, const RetKey& b)
+    {
+        return a.proc == b.proc && a.addr == b.addr;
+    }
+}
+
+namespace std
+{
+    template <>
+    struct hash<RetKey>
+    {
+        size_t operator()(const RetKey& arg) const
+        {
+            size_t seed = 0;
+            ::hash::combine(seed, arg.proc, arg.addr);
+            return seed;
+        }
+    };
+} // namespace std
+
+namespace
+{
+
     enum unwind_op_codes_e
     {
         UWOP_PUSH_NONVOL,     // info : register number
@@ -111,18 +183,12 @@ namespace
         OFFSET_COUNT,
     };
 
-    struct UserOffset
-    {
-        offsets_e   e_id;
-        const char* struc;
-        const char* member;
-    };
     // clang-format off
-    const UserOffset g_user_offsets[] =
+    const symbols::offset_desc_t g_user_offsets[] =
     {
-        {TEB_NtTib,         "_TEB",     "NtTib"},
-        {NT_TIB_StackBase,  "_NT_TIB",  "StackBase"},
-        {NT_TIB_StackLimit, "_NT_TIB",  "StackLimit"},
+        {TEB_NtTib,         true, "_TEB",     "NtTib"},
+        {NT_TIB_StackBase,  true, "_NT_TIB",  "StackBase"},
+        {NT_TIB_StackLimit, true, "_NT_TIB",  "StackLimit"},
     };
     // clang-format on
     STATIC_ASSERT_EQ(COUNT_OF(g_user_offsets), OFFSET_COUNT);
@@ -142,9 +208,19 @@ namespace
     using Drivers       = std::map<uint64_t, driver_t>;
     using AllModules    = std::unordered_map<proc_t, Modules>;
     using ExceptionDirs = std::unordered_map<std::string, FunctionTable>;
+    using FrameCache    = std::unordered_map<FrameKey, FrameUnwind>;
+    struct CachedRet
+    {
+        uint64_t generation; // see memory::write_generation
+        bool     is_ret;
+    };
+    using RetCache      = std::unordered_map<RetKey, CachedRet>;
     using UserOffsets   = std::array<uint64_t, OFFSET_COUNT>;
     using Buffer        = std::vector<uint8_t>;
     using caller_t      = callstacks::caller_t;
+
+    // flushed whole when full, cheaper than per-hit lru bookkeeping
+    constexpr size_t max_cached_frames = 0x10000;
     using context_t     = callstacks::context_t;
 
     struct NtCallstacks
@@ -155,6 +231,7 @@ namespace
         // callstacks::Module
         size_t  read        (caller_t* callers, size_t num_callers, proc_t proc) override;
         size_t  read_from   (caller_t* callers, size_t num_callers, proc_t proc, const context_t& where) override;
+        size_t  read_partial(caller_t* callers, size_t num_callers, proc_t proc, const callstacks::options_t& opts) override;
         bool    preload     (proc_t proc, const std::string& name, span_t span) override;
 
         // members
@@ -162,6 +239,9 @@ namespace
         Drivers          all_drivers_;
         AllModules       all_modules_;
         ExceptionDirs    exception_dirs_;
+        FrameCache       frames_;
+        RetCache         x86_rets_;
+        opt<uint64_t>    teb_tls_slot_;
         opt<UserOffsets> offsets_x64_;
         opt<UserOffsets> offsets_x86_;
         Buffer           buffer_;
@@ -185,6 +265,8 @@ namespace
         return a.start_address < b.start_address;
     }
 
+    const function_entry_t* lookup_function_entry(uint32_t offset_in_mod, const FunctionEntries& function_entries);
+
     opt<int> get_unwind_nb_max(uint64_t off_in_mod, const FunctionTable& function_table, const function_entry_t& function_entry)
     {
         const auto off_in_prolog = off_in_mod - function_entry.start_address;
@@ -498,32 +580,156 @@ namespace
         return function_table;
     }
 
-    opt<FunctionTable> parse_module_unwind(NtCallstacks& c, proc_t proc, const std::string& name, const span_t span)
+    const FunctionTable* parse_module_unwind(NtCallstacks& c, proc_t proc, const std::string& name, const span_t span)
     {
         LOG(INFO, "loading %s", name.data());
         const auto io            = memory::make_io(c.core_, proc);
         const auto exception_dir = pe::find_image_directory(io, span, pe::IMAGE_DIRECTORY_ENTRY_EXCEPTION);
         if(!exception_dir)
-            return FAIL(std::nullopt, "unable to get span of exception_dir");
+            return FAIL(nullptr, "unable to get span of exception_dir");
 
         const auto function_table = parse_exception_dir(c, proc, span.addr, *exception_dir, name);
         if(!function_table)
-            return FAIL(std::nullopt, "unable to parse exception dir from %s", name.data());
+            return FAIL(nullptr, "unable to parse exception dir from %s", name.data());
 
         const auto ret = c.exception_dirs_.emplace(name, *function_table);
-        if(!ret.second)
+        return &ret.first->second;
+    }
+
+    constexpr char     unwind_magic[4] = {'I', 'B', 'U', 'W'};
+    constexpr uint32_t unwind_version  = 1;
+
+    struct UnwindHeader
+    {
+        char     magic[4];
+        uint32_t version;
+        uint64_t entry_count;
+        uint64_t unwind_count;
+    };
+    STATIC_ASSERT_EQ(sizeof(UnwindHeader), 24);
+
+    // parsed tables live next to the symbol cache, keyed by pdb
+    // identity so every process & session shares them
+    opt<fs::path> unwind_cache_path(NtCallstacks& c, proc_t proc, span_t span)
+    {
+        const auto path = getenv("_NT_SYMBOL_PATH");
+        if(!path)
             return {};
 
-        return function_table;
+        const auto io     = memory::make_io(c.core_, proc);
+        const auto opt_id = symbols::identify_pdb(span, io);
+        if(!opt_id)
+            return {};
+
+        return fs::path(path) / opt_id->name / opt_id->id / "unwind.uwx";
     }
 
-    opt<FunctionTable> get_module_unwind(NtCallstacks& c, proc_t proc, const std::string& name, const span_t span)
+    bool save_function_table(const fs::path& path, const FunctionTable& table)
+    {
+        const auto entry_size  = table.function_entries.size() * sizeof(function_entry_t);
+        const auto unwind_size = table.unwinds.size() * sizeof(unwind_code_t);
+        auto header            = UnwindHeader{};
+        memcpy(header.magic, unwind_magic, sizeof unwind_magic);
+        header.version      = unwind_version;
+        header.entry_count  = table.function_entries.size();
+        header.unwind_count = table.unwinds.size();
+
+        auto buffer = std::vector<uint8_t>(sizeof header + entry_size + unwind_size);
+        memcpy(&buffer[0], &header, sizeof header);
+        if(entry_size)
+            memcpy(&buffer[sizeof header], &table.function_entries[0], entry_size);
+        if(unwind_size)
+            memcpy(&buffer[sizeof header + entry_size], &table.unwinds[0], unwind_size);
+        return file::write(path, &buffer[0], buffer.size());
+    }
+
+    opt<FunctionTable> load_function_table(const fs::path& path)
+    {
+        auto map = file::Map{};
+        if(!file::map_read(map, path))
+            return {};
+
+        auto table      = opt<FunctionTable>{};
+        auto header     = UnwindHeader{};
+        const auto* src = static_cast<const uint8_t*>(map.data);
+        if(map.size >= sizeof header)
+        {
+            memcpy(&header, src, sizeof header);
+            const auto entry_size  = static_cast<size_t>(header.entry_count) * sizeof(function_entry_t);
+            const auto unwind_size = static_cast<size_t>(header.unwind_count) * sizeof(unwind_code_t);
+            const auto valid       = !memcmp(header.magic, unwind_magic, sizeof unwind_magic)
+                                  && header.version == unwind_version
+                                  && map.size == sizeof header + entry_size + unwind_size;
+            if(valid)
+            {
+                table = FunctionTable{};
+                table->function_entries.resize(static_cast<size_t>(header.entry_count));
+                table->unwinds.resize(static_cast<size_t>(header.unwind_count));
+                if(entry_size)
+                    memcpy(&table->function_entries[0], &src[sizeof header], entry_size);
+                if(unwind_size)
+                    memcpy(&table->unwinds[0], &src[sizeof header + entry_size], unwind_size);
+            }
+        }
+        file::unmap(map);
+        return table;
+    }
+
+    const FunctionTable* get_module_unwind(NtCallstacks& c, proc_t proc, const std::string& name, const span_t span)
     {
         const auto it = c.exception_dirs_.find(name);
         if(it != c.exception_dirs_.end())
-            return it->second;
+            return &it->second;
+
+        const auto cache = unwind_cache_path(c, proc, span);
+        if(cache)
+            if(auto table = load_function_table(*cache))
+            {
+                const auto ret = c.exception_dirs_.emplace(name, std::move(*table));
+                return &ret.first->second;
+            }
+
+        const auto table = parse_module_unwind(c, proc, name, span);
+        if(table && cache)
+            save_function_table(*cache, *table);
+
+        return table;
+    }
+
+    opt<FrameUnwind> compute_frame_unwind(const FunctionTable& table, uint32_t off_in_mod)
+    {
+        const auto function_entry = lookup_function_entry(off_in_mod, table.function_entries);
+        if(!function_entry)
+            return FAIL(std::nullopt, "No matching function entry");
+
+        const auto stack_frame_size = get_stack_frame_size(off_in_mod, table, *function_entry);
+        if(!stack_frame_size)
+            return FAIL(std::nullopt, "cannot calculate stack frame size");
+
+        const auto prev_frame_reg = get_prev_frame_reg(off_in_mod, table, *function_entry);
+        if(!prev_frame_reg)
+            return FAIL(std::nullopt, "cannot calculate previous frame register offset");
+
+        return FrameUnwind{*stack_frame_size, *prev_frame_reg, function_entry->machframe_rip_off, function_entry->frame_reg_offset};
+    }
+
+    // hot syscall frames resolve to the same rips millions of times,
+    // make the steady state a single hash probe
+    const FrameUnwind* get_frame_unwind(NtCallstacks& c, const FunctionTable* table, uint32_t off_in_mod)
+    {
+        const auto key = FrameKey{table, off_in_mod};
+        const auto it  = c.frames_.find(key);
+        if(it != c.frames_.end())
+            return &it->second;
+
+        const auto computed = compute_frame_unwind(*table, off_in_mod);
+        if(!computed)
+            return nullptr;
 
-        return parse_module_unwind(c, proc, name, span);
+        if(c.frames_.size() >= max_cached_frames)
+            c.frames_.clear();
+
+        return &c.frames_.emplace(key, *computed).first->second;
     }
 
     bool read_user_offsets(NtCallstacks& c, flags_t flags)
@@ -533,20 +739,9 @@ namespace
             return true;
 
         const auto name = flags.is_x86 ? "wntdll" : "ntdll";
-        bool fail       = false;
         auto offsets    = UserOffsets{};
-        for(size_t i = 0; i < OFFSET_COUNT; ++i)
-        {
-            fail |= g_user_offsets[i].e_id != i;
-            const auto opt_mb = symbols::read_member(c.core_, symbols::kernel, name, g_user_offsets[i].struc, g_user_offsets[i].member);
-            if(!opt_mb)
-            {
-                LOG(ERROR, "unable to read %s!%s.%s member offset", name, g_user_offsets[i].struc, g_user_offsets[i].member);
-                continue;
-            }
-            offsets[i] = opt_mb->offset;
-        }
-        if(fail)
+        const auto ok   = symbols::resolve_offsets(c.core_, symbols::kernel, name, g_user_offsets, OFFSET_COUNT, &offsets[0]);
+        if(!ok)
             return false;
 
         opt_offsets = offsets;
@@ -664,7 +859,62 @@ namespace
         return check_previous_exist(--it, end, offset_in_mod);
     }
 
-    bool get_next_context_x64(NtCallstacks& c, proc_t proc, const memory::Io& io, const span_t& stack, context_t& ctx)
+    // whole-stack capture: unwinding touches the stack slot by slot, so
+    // the live span is fetched once and slots resolve from a local buffer
+    struct StackIo
+    {
+        const memory::Io& io;
+        span_t            stack;
+        uint64_t          addr; // guest address of bytes[0]
+        Buffer            bytes;
+    };
+
+    // capture window, slots above it fall back to per-slot reads
+    constexpr size_t max_captured_pages = 16;
+
+    void capture_stack(StackIo& s, uint64_t sp)
+    {
+        s.bytes.clear();
+        s.addr          = utils::align<PAGE_SIZE>(sp);
+        const auto base = s.stack.addr; // the stack grows down from addr
+        if(s.addr >= base || s.addr < base - s.stack.size)
+            return;
+
+        const auto top = std::min<uint64_t>(base, s.addr + max_captured_pages * PAGE_SIZE);
+        s.bytes.resize(top - s.addr);
+        if(s.io.read_all(&s.bytes[0], s.addr, s.bytes.size()))
+            return;
+
+        // discontiguous or partly paged-out stack, keep the readable prefix
+        size_t got = 0;
+        while(got < s.bytes.size())
+        {
+            const auto chunk = std::min<size_t>(PAGE_SIZE, s.bytes.size() - got);
+            if(!s.io.read_all(&s.bytes[got], s.addr + got, chunk))
+                break;
+
+            got += chunk;
+        }
+        s.bytes.resize(got);
+    }
+
+    opt<uint64_t> stack_read(const StackIo& s, uint64_t ptr)
+    {
+        if(ptr >= s.addr && ptr + sizeof(uint64_t) <= s.addr + s.bytes.size())
+            return read_le64(&s.bytes[ptr - s.addr]);
+
+        return s.io.read(ptr);
+    }
+
+    opt<uint32_t> stack_le32(const StackIo& s, uint64_t ptr)
+    {
+        if(ptr >= s.addr && ptr + sizeof(uint32_t) <= s.addr + s.bytes.size())
+            return read_le32(&s.bytes[ptr - s.addr]);
+
+        return s.io.le32(ptr);
+    }
+
+    bool get_next_context_x64(NtCallstacks& c, proc_t proc, const memory::Io& io, const StackIo& sio, context_t& ctx)
     {
         constexpr auto reg_size = 8;
 
@@ -679,33 +929,25 @@ namespace
         if(!function_table)
             return false;
 
-        const auto off_in_mod     = static_cast<uint32_t>(ctx.ip - span.addr);
-        const auto function_entry = lookup_function_entry(off_in_mod, function_table->function_entries);
-        if(!function_entry)
-            return FAIL(false, "No matching function entry");
-
-        const auto stack_frame_size = get_stack_frame_size(off_in_mod, *function_table, *function_entry);
-        if(!stack_frame_size)
-            return FAIL(false, "cannot calculate stack frame size");
-
-        if(function_entry->frame_reg_offset != 0)
-            ctx.sp = ctx.bp - function_entry->frame_reg_offset;
+        const auto off_in_mod = static_cast<uint32_t>(ctx.ip - span.addr);
+        const auto frame      = get_frame_unwind(c, function_table, off_in_mod);
+        if(!frame)
+            return false;
 
-        const auto prev_frame_reg = get_prev_frame_reg(off_in_mod, *function_table, *function_entry);
-        if(!prev_frame_reg)
-            return FAIL(false, "cannot calculate previous frame register offset");
+        if(frame->frame_reg_offset != 0)
+            ctx.sp = ctx.bp - frame->frame_reg_offset;
 
-        if(*prev_frame_reg != 0)
-            if(const auto bp = io.read(ctx.sp + *prev_frame_reg))
+        if(frame->prev_frame_reg != 0)
+            if(const auto bp = stack_read(sio, ctx.sp + frame->prev_frame_reg))
                 ctx.bp = *bp;
 
-        const auto caller_addr_on_stack = ctx.sp + *stack_frame_size - function_entry->machframe_rip_off;
+        const auto caller_addr_on_stack = ctx.sp + frame->stack_frame_size - frame->machframe_rip_off;
 
         // Check if caller's address on stack is consistent, if not we suppose that the end of the callstack has been reached
-        if(!(stack.addr > caller_addr_on_stack && caller_addr_on_stack > (stack.addr - stack.size)))
+        if(!(sio.stack.addr > caller_addr_on_stack && caller_addr_on_stack > (sio.stack.addr - sio.stack.size)))
             return false;
 
-        const auto return_addr = io.read(caller_addr_on_stack);
+        const auto return_addr = stack_read(sio, caller_addr_on_stack);
         if(!return_addr)
             return FAIL(false, "unable to read return address at 0x%" PRIx64, caller_addr_on_stack);
 
@@ -729,28 +971,109 @@ namespace
         return true;
     }
 
-    bool get_next_context_x86(NtCallstacks& /*c*/, proc_t /*proc*/, const memory::Io& io, const span_t& stack, context_t& ctx)
+    bool check_return_site(NtCallstacks& c, proc_t proc, const memory::Io& io, uint64_t addr)
+    {
+        // must land inside a known module or driver...
+        const auto is_kernel = os::is_kernel_address(c.core_, addr);
+        if(is_kernel ? !find_drv(c, addr) : !find_mod(c, proc, addr))
+            return false;
+
+        // ...and follow a call instruction
+        auto code     = std::array<uint8_t, 7>{};
+        const auto ok = io.read_all(&code[0], addr - code.size(), code.size());
+        if(!ok)
+            return false;
+
+        if(code[2] == 0xE8 || code[0] == 0x9A) // call rel32, call ptr16:32
+            return true;
+
+        // call r/m32 with its register, disp8, disp32 & sib encodings
+        for(const auto idx : {5, 4, 1, 0})
+            if(code[idx] == 0xFF && (code[idx + 1] & 0x38) == 0x10)
+                return true;
+
+        return false;
+    }
+
+    bool is_return_site(NtCallstacks& c, proc_t proc, const memory::Io& io, uint64_t addr)
+    {
+        // kernel code is shared, cache those sites once for every process
+        const auto is_kernel = os::is_kernel_address(c.core_, addr);
+        const auto key       = RetKey{is_kernel ? ~uint64_t{0} : proc.id, addr};
+        const auto gen       = memory::write_generation(c.core_);
+        const auto it        = c.x86_rets_.find(key);
+        if(it != c.x86_rets_.end() && it->second.generation == gen)
+            return it->second.is_ret;
+
+        const auto ret = check_return_site(c, proc, io, addr);
+        if(c.x86_rets_.size() >= max_cached_frames)
+            c.x86_rets_.clear();
+
+        c.x86_rets_[key] = CachedRet{gen, ret};
+        return ret;
+    }
+
+    bool get_next_context_x86_fp(NtCallstacks& c, proc_t proc, const memory::Io& io, const StackIo& sio, context_t& ctx)
     {
         constexpr auto reg_size = 4;
-        if(!ctx.bp)
+        if(!ctx.bp || sio.stack.addr <= ctx.bp || ctx.bp <= sio.stack.addr - sio.stack.size)
+            return false;
+
+        const auto caller_bp   = stack_le32(sio, ctx.bp);
+        const auto return_addr = stack_le32(sio, ctx.bp + reg_size);
+        if(!caller_bp || !return_addr || !is_return_site(c, proc, io, *return_addr))
             return false;
 
-        if(!(stack.addr < ctx.bp && ctx.bp < (stack.addr - stack.size)))
-            return FAIL(false, "ebp out of stack bounds, ebp: 0x%" PRIx64 " stack bounds: 0x%" PRIx64 "-0x%" PRIx64, ctx.bp, stack.addr, stack.addr + stack.size);
+        ctx.ip = *return_addr;
+        ctx.sp = ctx.bp + 2 * reg_size;
+        ctx.bp = *caller_bp;
+        return true;
+    }
 
-        const auto caller_addr_on_stack = io.le32(ctx.bp);
-        if(!caller_addr_on_stack)
-            return FAIL(false, "unable to read caller address on stack at 0x%" PRIx64, ctx.bp);
+    // frame-pointer chain only: fast, but frames omitting rbp are lost
+    bool get_next_context_x64_fp(NtCallstacks& /*c*/, proc_t /*proc*/, const memory::Io& /*io*/, const StackIo& sio, context_t& ctx)
+    {
+        constexpr auto reg_size = 8;
+        if(!ctx.bp || sio.stack.addr <= ctx.bp || ctx.bp <= sio.stack.addr - sio.stack.size)
+            return false;
 
-        const auto return_addr = io.le32(ctx.bp + reg_size);
-        if(!return_addr)
-            return FAIL(false, "unable to read return address at 0x%" PRIx64, ctx.bp + reg_size);
+        const auto caller_bp   = stack_read(sio, ctx.bp);
+        const auto return_addr = stack_read(sio, ctx.bp + reg_size);
+        if(!caller_bp || !return_addr || !*return_addr)
+            return false;
 
         ctx.ip = *return_addr;
-        ctx.bp = *caller_addr_on_stack;
+        ctx.sp = ctx.bp + 2 * reg_size;
+        ctx.bp = *caller_bp;
         return true;
     }
 
+    bool get_next_context_x86(NtCallstacks& c, proc_t proc, const memory::Io& io, const StackIo& sio, context_t& ctx)
+    {
+        constexpr auto reg_size = 4;
+        // try the ebp chain first
+        if(get_next_context_x86_fp(c, proc, io, sio, ctx))
+            return true;
+
+        // frame pointer omitted, scan the stack for the next return site
+        constexpr auto max_scanned_slots = size_t{0x100};
+        auto sp                          = std::max(ctx.sp, sio.stack.addr - sio.stack.size);
+        for(size_t i = 0; i < max_scanned_slots && sp + reg_size <= sio.stack.addr; ++i, sp += reg_size)
+        {
+            const auto value = stack_le32(sio, sp);
+            if(!value || !*value)
+                continue;
+
+            if(!is_return_site(c, proc, io, *value))
+                continue;
+
+            ctx.ip = *value;
+            ctx.sp = sp + reg_size;
+            return true;
+        }
+        return false;
+    }
+
     bool get_state(NtCallstacks& c, const context_t& ctx, land_e& land)
     {
         switch(land)
@@ -784,12 +1107,16 @@ namespace
 
         stack = *opt_stack;
         // wow64 context is stored by wow64cpu.dll
-        const auto teb        = registers::read_msr(c.core_, msr_e::gs_base); // always in kernel ctx here
-        const auto opt_member = symbols::read_member(c.core_, symbols::kernel, "nt", "_TEB", "TlsSlots");
-        if(!opt_member)
-            return false;
+        const auto teb = registers::read_msr(c.core_, msr_e::gs_base); // always in kernel ctx here
+        if(!c.teb_tls_slot_)
+        {
+            const auto opt_member = symbols::read_member(c.core_, symbols::kernel, "nt", "_TEB", "TlsSlots");
+            if(!opt_member)
+                return false;
 
-        const auto TlsSlot       = teb + opt_member->offset + 8;
+            c.teb_tls_slot_ = opt_member->offset;
+        }
+        const auto TlsSlot       = teb + *c.teb_tls_slot_ + 8;
         const auto WOW64_CONTEXT = io.read(TlsSlot);
         if(!WOW64_CONTEXT)
             return false;
@@ -893,27 +1220,41 @@ namespace
         return switch_ctx_x64(c, proc, io, stack, ctx);
     }
 
-    size_t read_callers(NtCallstacks& c, caller_t* callers, size_t num_callers, proc_t proc, const context_t& first)
+    size_t read_callers(NtCallstacks& c, caller_t* callers, size_t num_callers, proc_t proc, const context_t& first, const callstacks::options_t& opts)
     {
+        if(opts.max_depth)
+            num_callers = std::min(num_callers, opts.max_depth);
+
         const auto io        = memory::make_io(c.core_, proc);
         const auto opt_stack = get_stack(c, io, first);
         if(!opt_stack)
             return 0;
 
-        auto stack      = *opt_stack;
+        auto sio        = StackIo{io, *opt_stack, 0, {}};
         auto ctx        = first;
         callers[0].addr = ctx.ip;
+        capture_stack(sio, ctx.sp);
+
+        auto bound = opt<span_t>{};
+        if(opts.same_module_only)
+            if(const auto tuple = get_name_span(c, proc, ctx))
+                bound = std::get<1>(*tuple);
 
         auto land = land_e::unknown;
         get_state(c, ctx, land);
 
-        const auto next_context = first.flags.is_x86 ? &get_next_context_x86 : &get_next_context_x64;
+        const auto next_context = first.flags.is_x86
+                                      ? (opts.frame_pointer_only ? &get_next_context_x86_fp : &get_next_context_x86)
+                                      : (opts.frame_pointer_only ? &get_next_context_x64_fp : &get_next_context_x64);
         for(size_t i = 1; i < num_callers; ++i)
         {
-            auto ok = next_context(c, proc, io, stack, ctx);
+            auto ok = next_context(c, proc, io, sio, ctx);
             if(!ok)
                 return i;
 
+            if(bound && (ctx.ip < bound->addr || ctx.ip >= bound->addr + bound->size))
+                return i;
+
             callers[i].addr = ctx.ip;
 
             ok = get_state(c, ctx, land);
@@ -923,9 +1264,12 @@ namespace
             if(land != land_e::switched_k2u)
                 continue;
 
-            ok = switch_ctx(c, proc, io, stack, ctx);
+            ok = switch_ctx(c, proc, io, sio.stack, ctx);
             if(!ok)
                 return i;
+
+            // new stack after the kernel to user transition
+            capture_stack(sio, ctx.sp);
         }
         return num_callers;
     }
@@ -934,7 +1278,20 @@ namespace
 size_t NtCallstacks::read_from(caller_t* callers, size_t num_callers, proc_t proc, const context_t& where)
 {
     memset(callers, 0, num_callers * sizeof *callers);
-    return read_callers(*this, callers, num_callers, proc, where);
+    return read_callers(*this, callers, num_callers, proc, where, {});
+}
+
+size_t NtCallstacks::read_partial(caller_t* callers, size_t num_callers, proc_t proc, const callstacks::options_t& opts)
+{
+    const auto ip         = registers::read(core_, reg_e::rip);
+    const auto sp         = registers::read(core_, reg_e::rsp);
+    const auto bp         = registers::read(core_, reg_e::rbp);
+    const auto cs         = registers::read(core_, reg_e::cs);
+    constexpr auto x86_cs = 0x23;
+    const auto flags      = cs == x86_cs ? flags::x86 : flags::x64;
+    const auto ctx        = context_t{ip, sp, bp, cs, flags};
+    memset(callers, 0, num_callers * sizeof *callers);
+    return read_callers(*this, callers, num_callers, proc, ctx, opts);
 }
 
 size_t NtCallstacks::read(caller_t* callers, size_t num_callers, proc_t proc)
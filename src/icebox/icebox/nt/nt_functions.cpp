@@ -1,7 +1,11 @@
 #include "nt_os.hpp"
 
 #define FDP_MODULE "nt::functions"
+#include "endian.hpp"
 #include "log.hpp"
+#include "utils/utils.hpp"
+
+#include <vector>
 
 namespace
 {
@@ -59,6 +63,37 @@ namespace
         }
     }
 
+    bool read_args32(const memory::Io& io, uint64_t sp, arg_t* args, size_t count)
+    {
+        // the whole argument span sits above the return address
+        auto buf = std::vector<uint8_t>(count * sizeof(uint32_t));
+        if(!io.read_all(&buf[0], sp + sizeof(uint32_t), buf.size()))
+            return false;
+
+        for(size_t i = 0; i < count; ++i)
+            args[i] = arg_t{read_le32(&buf[i * sizeof(uint32_t)])};
+        return true;
+    }
+
+    bool read_args64(core::Core& core, const memory::Io& io, uint64_t sp, arg_t* args, size_t count)
+    {
+        static constexpr reg_e arg_regs[] = {reg_e::rcx, reg_e::rdx, reg_e::r8, reg_e::r9};
+        for(size_t i = 0; i < count && i < COUNT_OF(arg_regs); ++i)
+            args[i] = arg_t{registers::read(core, arg_regs[i])};
+        if(count <= COUNT_OF(arg_regs))
+            return true;
+
+        // stack args start after the return address & the shadow space
+        const auto remain = count - COUNT_OF(arg_regs);
+        auto buf          = std::vector<uint8_t>(remain * sizeof(uint64_t));
+        if(!io.read_all(&buf[0], sp + 5 * sizeof(uint64_t), buf.size()))
+            return false;
+
+        for(size_t i = 0; i < remain; ++i)
+            args[COUNT_OF(arg_regs) + i] = arg_t{read_le64(&buf[i * sizeof(uint64_t)])};
+        return true;
+    }
+
     bool write_arg64(core::Core& core, size_t index, arg_t arg)
     {
         switch(index)
@@ -96,6 +131,21 @@ opt<arg_t> nt::Os::read_arg(size_t index)
     return read_arg64(core_, io, sp, index);
 }
 
+bool nt::Os::read_args(arg_t* args, size_t count)
+{
+    if(!count)
+        return true;
+
+    const auto cs       = registers::read(core_, reg_e::cs);
+    const auto is_32bit = cs == x86_cs;
+    const auto sp       = registers::read(core_, reg_e::rsp);
+    const auto io       = memory::make_io_current(core_);
+    if(is_32bit)
+        return read_args32(io, sp, args, count);
+
+    return read_args64(core_, io, sp, args, count);
+}
+
 bool nt::Os::write_arg(size_t index, arg_t arg)
 {
     const auto cs       = registers::read(core_, reg_e::cs);
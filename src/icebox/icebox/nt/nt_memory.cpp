@@ -4,12 +4,21 @@
 #include "endian.hpp"
 #include "log.hpp"
 #include "nt_mmu.hpp"
+#include "utils/utils.hpp"
+
+#include <array>
+#include <cstring>
 
 bool nt::Os::is_kernel_address(uint64_t ptr)
 {
     return !!(ptr & 0xFFF0000000000000);
 }
 
+uint64_t nt::Os::kernel_split()
+{
+    return 0x0010000000000000; // lowest address with a canonical kernel mask bit set
+}
+
 namespace
 {
     struct ntphy_t
@@ -32,27 +41,44 @@ namespace
     constexpr auto page_fault_required = ntphy_t{0, false, false};
     // constexpr auto zero_page        = ntphy_t{0, false, true};
 
-    opt<MMPTE> read_pml4e(nt::Os& os, const virt_t& virt, dtb_t dtb)
+    // upper levels are shared by every address in a region, cache their
+    // entries per physical pointer until the next vm state change
+    opt<MMPTE> read_cached_entry(nt::Os& os, uint64_t entry_ptr)
     {
-        const auto pml4e_base = dtb.val & (mask(40) << 12);
-        const auto pml4e_ptr  = pml4e_base + virt.u.f.pml4 * 8;
-        auto pml4e            = MMPTE{};
-        const auto ok         = memory::read_physical(os.core_, &pml4e, pml4e_ptr, sizeof pml4e);
+        const auto generation = memory::cache_generation(os.core_);
+        if(generation != os.mmu_generation_)
+        {
+            os.mmu_entries_.clear();
+            os.mmu_generation_ = generation;
+        }
+        const auto it = os.mmu_entries_.find(entry_ptr);
+        if(it != os.mmu_entries_.end())
+        {
+            auto entry    = MMPTE{};
+            entry.u.value = it->second;
+            return entry;
+        }
+
+        auto entry    = MMPTE{};
+        const auto ok = memory::read_physical(os.core_, &entry, entry_ptr, sizeof entry);
         if(!ok)
             return {};
 
-        return pml4e;
+        os.mmu_entries_.emplace(entry_ptr, entry.u.value);
+        return entry;
     }
 
-    opt<MMPTE> read_pdpe(nt::Os& os, const virt_t& virt, const MMPTE& pml4e)
+    opt<MMPTE> read_pml4e(nt::Os& os, const virt_t& virt, dtb_t dtb)
     {
-        auto pdpe           = MMPTE{};
-        const auto pdpe_ptr = pml4e.u.hard.PageFrameNumber * PAGE_SIZE + virt.u.f.pdp * sizeof pdpe;
-        auto ok             = memory::read_physical(os.core_, &pdpe, pdpe_ptr, sizeof pdpe);
-        if(!ok)
-            return {};
+        const auto pml4e_base = dtb.val & (mask(40) << 12);
+        const auto pml4e_ptr  = pml4e_base + virt.u.f.pml4 * 8;
+        return read_cached_entry(os, pml4e_ptr);
+    }
 
-        return pdpe;
+    opt<MMPTE> read_pdpe(nt::Os& os, const virt_t& virt, const MMPTE& pml4e)
+    {
+        const auto pdpe_ptr = pml4e.u.hard.PageFrameNumber * PAGE_SIZE + virt.u.f.pdp * sizeof(MMPTE);
+        return read_cached_entry(os, pdpe_ptr);
     }
 
     opt<MMPTE> read_pte(nt::Os& os, const virt_t& virt, const MMPTE& pde)
@@ -68,13 +94,8 @@ namespace
 
     opt<MMPTE> read_pde(nt::Os& os, const virt_t& virt, const MMPTE& pdpe)
     {
-        auto pde           = MMPTE{};
-        const auto pde_ptr = pdpe.u.hard.PageFrameNumber * PAGE_SIZE + virt.u.f.pd * sizeof pde;
-        auto ok            = memory::read_physical(os.core_, &pde, pde_ptr, sizeof pde);
-        if(!ok)
-            return {};
-
-        return pde;
+        const auto pde_ptr = pdpe.u.hard.PageFrameNumber * PAGE_SIZE + virt.u.f.pd * sizeof(MMPTE);
+        return read_cached_entry(os, pde_ptr);
     }
 
     opt<ntphy_t> virtual_to_physical(nt::Os& os, uint64_t ptr, proc_t* /*proc*/, dtb_t dtb)
@@ -208,6 +229,86 @@ bool nt::Os::read_page(void* dst, uint64_t ptr, proc_t* proc, dtb_t dtb)
     return memory::read_virtual_with_dtb(core_, dtb, dst, ptr, PAGE_SIZE);
 }
 
+size_t nt::Os::page_in(proc_t proc, span_t span)
+{
+    if(!span.size)
+        return 0;
+
+    // one batched residency walk picks the fault targets
+    const auto first = utils::align<PAGE_SIZE>(span.addr);
+    const auto last  = utils::align<PAGE_SIZE>(span.addr + span.size - 1);
+    if(is_kernel_address(first) || is_kernel_address(last))
+        return 0;
+
+    const auto count  = (last - first) / PAGE_SIZE + 1;
+    auto       states = std::vector<uint8_t>(count);
+    if(!residency_map(&proc, proc.udtb, {first, count * PAGE_SIZE}, &states[0]))
+        return 0;
+
+    auto targets = std::vector<uint64_t>{};
+    for(size_t i = 0; i < count; ++i)
+        if(!(states[i] & memory::page_valid))
+            targets.push_back(first + i * PAGE_SIZE);
+    if(targets.empty())
+        return 0;
+
+    // context gating once for the whole queue, not per fault
+    const auto irql = read_irql(core_);
+    if(irql >= irql_e::dispatch)
+        return 0;
+
+    const auto cr3 = registers::read(core_, reg_e::cr3);
+    if(cr3 != proc.kdtb.val && cr3 != proc.udtb.val)
+        return 0;
+
+    const auto thread = threads::current(core_);
+    if(!thread)
+        return 0;
+
+    // one shared return breakpoint drives every fault/resume cycle,
+    // instead of an arm & disarm round trip per page
+    const auto rip = registers::read(core_, reg_e::rip);
+    const auto rsp = registers::read(core_, reg_e::rsp);
+    const auto bp  = state::break_on_thread(core_, "page_in", *thread, rip, [] {});
+    if(!bp)
+        return 0;
+
+    const auto cs      = registers::read(core_, reg_e::cs);
+    const auto code    = nt::is_user_mode(cs) ? uint32_t{1 << 2} : uint32_t{0};
+    auto       faulted = size_t{0};
+    for(const auto page : targets)
+    {
+        // the vad must cover the whole page, the fault would kill the
+        // process otherwise; lookups hit the vad cache
+        const auto opt_vma = vm_area_find(proc, page);
+        if(!opt_vma)
+            continue;
+
+        const auto vma_span = vm_area_span(proc, *opt_vma);
+        if(!vma_span || page + PAGE_SIZE > vma_span->addr + vma_span->size)
+            continue;
+
+        ++num_page_faults_;
+        if(!state::inject_interrupt(core_, PAGE_FAULT, code, page))
+            continue;
+
+        // back-to-back cycle: resume & wait until the guest returns to
+        // the injection site, the breakpoint stays armed throughout
+        while(true)
+        {
+            state::resume(core_);
+            state::wait(core_);
+            if(registers::read(core_, reg_e::rip) != rip)
+                continue;
+
+            if(registers::read(core_, reg_e::rsp) == rsp)
+                break;
+        }
+        ++faulted;
+    }
+    return faulted;
+}
+
 bool nt::Os::write_page(uint64_t ptr, const void* src, proc_t* proc, dtb_t dtb)
 {
     const auto nt_phy = ::virtual_to_physical(*this, ptr, proc, dtb);
@@ -224,6 +325,102 @@ bool nt::Os::write_page(uint64_t ptr, const void* src, proc_t* proc, dtb_t dtb)
     return memory::write_virtual_with_dtb(core_, dtb, ptr, src, PAGE_SIZE);
 }
 
+namespace
+{
+    uint8_t page_state(const MMPTE& entry, bool large)
+    {
+        if(!entry.u.hard.Valid)
+            return memory::page_none;
+
+        auto state = uint8_t{memory::page_valid};
+        if(entry.u.hard.Write)
+            state |= memory::page_write;
+        if(entry.u.hard.Owner)
+            state |= memory::page_user;
+        if(entry.u.hard.NoExecute)
+            state |= memory::page_noexec;
+        if(large)
+            state |= memory::page_large;
+        return state;
+    }
+}
+
+bool nt::Os::residency_map(proc_t* /*proc*/, dtb_t dtb, span_t span, uint8_t* states)
+{
+    constexpr uint64_t block_size = 512 * PAGE_SIZE;
+
+    const auto first = utils::align<PAGE_SIZE>(span.addr);
+    const auto last  = utils::align<PAGE_SIZE>(span.addr + span.size - 1) + PAGE_SIZE;
+    auto       idx   = size_t{};
+    auto       ptr   = first;
+    while(ptr < last)
+    {
+        // entries from one pte table cover until the next 2mb boundary
+        const auto virt      = virt_t{read_le64(&ptr)};
+        const auto block_end = std::min<uint64_t>(last, utils::align<block_size>(ptr) + block_size);
+        const auto npages    = (block_end - ptr) / PAGE_SIZE;
+        const auto fill      = [&](uint8_t state)
+        {
+            memset(&states[idx], state, npages);
+            idx += npages;
+            ptr = block_end;
+        };
+
+        const auto pml4e = read_pml4e(*this, virt, dtb);
+        if(!pml4e)
+            return false;
+
+        if(!pml4e->u.hard.Valid)
+        {
+            fill(memory::page_none);
+            continue;
+        }
+
+        const auto pdpe = read_pdpe(*this, virt, *pml4e);
+        if(!pdpe)
+            return false;
+
+        if(!pdpe->u.hard.Valid || pdpe->u.hard.LargePage)
+        {
+            fill(page_state(*pdpe, true));
+            continue;
+        }
+
+        const auto pde = read_pde(*this, virt, *pdpe);
+        if(!pde)
+            return false;
+
+        if(!pde->u.hard.Valid || pde->u.hard.LargePage)
+        {
+            fill(page_state(*pde, true));
+            continue;
+        }
+
+        // one physical read covers the whole 512-entry table
+        auto table           = std::array<MMPTE, 512>{};
+        const auto table_ptr = pde->u.hard.PageFrameNumber * PAGE_SIZE;
+        const auto ok        = memory::read_physical(core_, &table[0], table_ptr, sizeof table);
+        if(!ok)
+            return false;
+
+        for(auto i = virt.u.f.pt; ptr < block_end; ++i, ptr += PAGE_SIZE)
+            states[idx++] = page_state(table[i], false);
+    }
+    return true;
+}
+
+opt<phy_t> nt::Os::virtual_to_physical_walk(proc_t* proc, dtb_t dtb, uint64_t ptr)
+{
+    const auto nt_phy = ::virtual_to_physical(*this, ptr, proc, dtb);
+    if(!nt_phy)
+        return {};
+
+    if(!nt_phy->valid_page)
+        return phy_t{0}; // resolved but not resident
+
+    return phy_t{nt_phy->ptr};
+}
+
 opt<phy_t> nt::Os::virtual_to_physical(proc_t* proc, dtb_t dtb, uint64_t ptr)
 {
     auto nt_phy = ::virtual_to_physical(*this, ptr, proc, dtb);
@@ -118,6 +118,27 @@ opt<bpid_t> nt::Os::listen_drv_create(const drivers::on_event_fn& on_load)
 
 namespace
 {
+    // one instantiation per bitness: pointer width, reader and field
+    // offsets are folded in at compile time, the per-node loop carries
+    // no arch branch at all
+    template <typename Arch>
+    opt<walk_e> walk_ldr_list(const memory::Io& io, uint64_t ldr, const modules::on_mod_fn& on_mod)
+    {
+        // Ldr = 0 before the process loads it's first module
+        if(!ldr)
+            return walk_e::next;
+
+        const auto head = ldr + nt_arch::truncate<Arch>(offsetof(typename Arch::PEB_LDR_DATA, InLoadOrderModuleList));
+        for(auto link = Arch::read_ptr(io, head); link && link != head; link = Arch::read_ptr(io, *link))
+        {
+            const auto ret = on_mod({*link - nt_arch::truncate<Arch>(offsetof(typename Arch::LDR_DATA_TABLE_ENTRY, InLoadOrderLinks)), Arch::arch_flags, {}});
+            if(ret == walk_e::stop)
+                return ret;
+        }
+
+        return walk_e::next;
+    }
+
     opt<walk_e> mod_list_64(const nt::Os& os, proc_t proc, const memory::Io& io, const modules::on_mod_fn& on_mod)
     {
         const auto peb = io.read(proc.id + os.offsets_[EPROCESS_Peb]);
@@ -132,19 +153,7 @@ namespace
         if(!ldr)
             return FAIL(std::nullopt, "unable to read PEB.Ldr");
 
-        // Ldr = 0 before the process loads it's first module
-        if(!*ldr)
-            return walk_e::next;
-
-        const auto head = *ldr + offsetof(nt::_PEB_LDR_DATA, InLoadOrderModuleList);
-        for(auto link = io.read(head); link && link != head; link = io.read(*link))
-        {
-            const auto ret = on_mod({*link - offsetof(nt::_LDR_DATA_TABLE_ENTRY, InLoadOrderLinks), flags::x64, {}});
-            if(ret == walk_e::stop)
-                return ret;
-        }
-
-        return walk_e::next;
+        return walk_ldr_list<nt_arch::x64>(io, *ldr, on_mod);
     }
 
     opt<uint64_t> read_wow64_peb(const nt::Os& os, const memory::Io& io, proc_t proc)
@@ -166,8 +175,6 @@ namespace
         return *peb32;
     }
 
-#define offsetof32(x, y) static_cast<uint32_t>(offsetof(x, y))
-
     opt<walk_e> mod_list_32(const nt::Os& os, proc_t proc, const memory::Io& io, const modules::on_mod_fn& on_mod)
     {
         const auto peb32 = read_wow64_peb(os, io, proc);
@@ -182,19 +189,13 @@ namespace
         if(!ldr32)
             return FAIL(std::nullopt, "unable to read PEB32.Ldr");
 
-        // Ldr = 0 before the process loads it's first module
-        if(!*ldr32)
-            return walk_e::next;
-
-        const auto head = *ldr32 + offsetof32(wow64::_PEB_LDR_DATA, InLoadOrderModuleList);
-        for(auto link = io.le32(head); link && link != head; link = io.le32(*link))
-        {
-            const auto ret = on_mod({*link - offsetof32(wow64::_LDR_DATA_TABLE_ENTRY, InLoadOrderLinks), flags::x86, {}});
-            if(ret == walk_e::stop)
-                return ret;
-        }
+        return walk_ldr_list<nt_arch::x86>(io, *ldr32, on_mod);
+    }
 
-        return walk_e::next;
+    template <typename Arch>
+    opt<std::string> read_mod_name(const memory::Io& io, mod_t mod)
+    {
+        return Arch::read_unicode(io, mod.id + nt_arch::truncate<Arch>(offsetof(typename Arch::LDR_DATA_TABLE_ENTRY, FullDllName)));
     }
 }
 
@@ -215,27 +216,86 @@ opt<std::string> nt::Os::mod_name(proc_t proc, mod_t mod)
 {
     const auto io = memory::make_io(core_, proc);
     if(mod.flags.is_x86)
-        return wow64::read_unicode_string(io, mod.id + offsetof32(wow64::_LDR_DATA_TABLE_ENTRY, FullDllName));
+        return read_mod_name<nt_arch::x86>(io, mod);
 
-    return nt::read_unicode_string(io, mod.id + offsetof(nt::_LDR_DATA_TABLE_ENTRY, FullDllName));
+    return read_mod_name<nt_arch::x64>(io, mod);
 }
 
-opt<mod_t> nt::Os::mod_find(proc_t proc, uint64_t addr)
+namespace
 {
-    opt<mod_t> found = {};
-    mod_list(proc, [&](mod_t mod)
+    void cache_mod(nt::Os& os, nt::ProcMods& mods, proc_t proc, mod_t mod)
     {
-        const auto span = mod_span(proc, mod);
+        const auto span = os.mod_span(proc, mod);
         if(!span)
-            return walk_e::next;
+            return;
 
-        if(!(span->addr <= addr && addr < span->addr + span->size))
+        mods.spans[span->addr] = nt::ModSpan{mod, span->size};
+    }
+
+    nt::ProcMods& load_mod_cache(nt::Os& os, proc_t proc)
+    {
+        const auto it = os.mods_.find(proc.id);
+        if(it != os.mods_.end())
+            return it->second;
+
+        auto& mods = os.mods_[proc.id];
+        os.mod_list(proc, [&](mod_t mod)
+        {
+            cache_mod(os, mods, proc, mod);
             return walk_e::next;
+        });
+        // loads patch the map as they happen,
+        // unloads are caught by the span check on lookup
+        mods.bp = os.listen_mod_create(proc, os.proc_flags(proc), [&os, proc](mod_t mod)
+        {
+            const auto found = os.mods_.find(proc.id);
+            if(found != os.mods_.end())
+                cache_mod(os, found->second, proc, mod);
+        });
+        return os.mods_[proc.id];
+    }
 
-        found = mod;
-        return walk_e::stop;
-    });
-    return found;
+    const nt::ModSpan* find_mod_span(const nt::ProcMods& mods, uint64_t addr)
+    {
+        auto it = mods.spans.upper_bound(addr);
+        if(it == mods.spans.begin())
+            return nullptr;
+
+        --it;
+        if(addr >= it->first + it->second.size)
+            return nullptr;
+
+        return &it->second;
+    }
+}
+
+void nt::reset_mod_cache(nt::Os& os, proc_t proc)
+{
+    const auto it = os.mods_.find(proc.id);
+    if(it == os.mods_.end())
+        return;
+
+    if(it->second.bp)
+        state::drop_breakpoint(os.core_, *it->second.bp);
+    os.mods_.erase(it);
+}
+
+opt<mod_t> nt::Os::mod_find(proc_t proc, uint64_t addr)
+{
+    const auto& mods = load_mod_cache(*this, proc);
+    const auto found = find_mod_span(mods, addr);
+    if(!found)
+        return {};
+
+    // one targeted read to confirm before trusting the snapshot
+    const auto span = mod_span(proc, found->mod);
+    if(span && span->addr <= addr && addr < span->addr + span->size)
+        return found->mod;
+
+    // stale entry, rebuild from the guest list
+    nt::reset_mod_cache(*this, proc);
+    const auto retry = find_mod_span(load_mod_cache(*this, proc), addr);
+    return retry ? std::make_optional(retry->mod) : std::nullopt;
 }
 
 namespace
@@ -256,9 +316,9 @@ opt<span_t> nt::Os::mod_span(proc_t proc, mod_t mod)
 {
     const auto io = memory::make_io(core_, proc);
     if(mod.flags.is_x86)
-        return read_ldr_span<wow64::_LDR_DATA_TABLE_ENTRY>(io, mod.id);
+        return read_ldr_span<nt_arch::x86::LDR_DATA_TABLE_ENTRY>(io, mod.id);
 
-    return read_ldr_span<nt::_LDR_DATA_TABLE_ENTRY>(io, mod.id);
+    return read_ldr_span<nt_arch::x64::LDR_DATA_TABLE_ENTRY>(io, mod.id);
 }
 
 bool nt::Os::driver_list(drivers::on_driver_fn on_driver)
@@ -11,6 +11,8 @@
 #include "utils/utils.hpp"
 #include "wow64.hpp"
 
+#include <array>
+
 #ifdef _MSC_VER
 #    include <string.h>
 #    define strncasecmp _strnicmp
@@ -73,57 +75,9 @@ namespace
         if(!handle_table)
             return FAIL(std::nullopt, "unable to read handle table");
 
-        auto handle_table_code = d.io.read(*handle_table + d.nt.offsets_[HANDLE_TABLE_TableCode]);
-        if(!handle_table_code)
-            return FAIL(std::nullopt, "unable to read handle table code");
-
-        const auto handle_table_level = *handle_table_code & 3;
-        *handle_table_code &= ~3;
-
-        constexpr auto HANDLE_VALUE_INC        = 0x04; // Amount to increment the Value to get to the next handle
-        constexpr auto HANDLE_TABLE_ENTRY_SIZE = 0x10;
-        constexpr auto PAGE_SIZE               = 4096;
-        constexpr auto POINTER_SIZE            = 8;
-
-        auto i = uint64_t{};
-        auto j = uint64_t{};
-        auto k = uint64_t{};
-        switch(handle_table_level)
-        {
-            case 0:
-                i = handle;
-                break;
-
-            case 1:
-                i = handle % ((PAGE_SIZE / HANDLE_TABLE_ENTRY_SIZE) * HANDLE_VALUE_INC);
-                handle -= i;
-                j = handle / (((PAGE_SIZE / HANDLE_TABLE_ENTRY_SIZE) * HANDLE_VALUE_INC) / POINTER_SIZE);
-
-                handle_table_code = d.io.read(*handle_table_code + j);
-                // handle_table_code = *handle_table_code + j;
-                break;
-
-            case 2:
-                i = handle % ((PAGE_SIZE / HANDLE_TABLE_ENTRY_SIZE) * HANDLE_VALUE_INC);
-                handle -= i;
-                k = handle / (((PAGE_SIZE / HANDLE_TABLE_ENTRY_SIZE) * HANDLE_VALUE_INC) / POINTER_SIZE);
-                j = k % PAGE_SIZE;
-                k -= j;
-                k /= (PAGE_SIZE / POINTER_SIZE);
-
-                handle_table_code = d.io.read(*handle_table_code + k);
-                handle_table_code = d.io.read(*handle_table_code + j);
-                break;
-
-            default:
-                return FAIL(std::nullopt, "Unknown table level");
-        }
-        if(!*handle_table_code)
-            return std::nullopt;
-
-        const auto handle_table_entry = d.io.read(*handle_table_code + i * (HANDLE_TABLE_ENTRY_SIZE / HANDLE_VALUE_INC));
+        const auto handle_table_entry = nt::read_handle_table_entry(d.nt, d.io, *handle_table, handle);
         if(!handle_table_entry)
-            return FAIL(std::nullopt, "unable to read table entry");
+            return std::nullopt;
 
         // TODO deal with theses shifts on x32
         uint64_t p                = 0xffff;
@@ -138,6 +92,97 @@ opt<objects::obj_t> objects::read(Data& d, nt::HANDLE handle)
     return object_read(d, handle);
 }
 
+namespace
+{
+    constexpr size_t handle_page_size  = 4096;
+    constexpr size_t handle_entry_size = 0x10;
+    constexpr size_t handle_ptr_size   = 8;
+    constexpr size_t handles_per_page  = handle_page_size / handle_entry_size;
+    constexpr size_t ptrs_per_page     = handle_page_size / handle_ptr_size;
+
+    objects::obj_t decode_handle_entry(const Data& d, uint64_t entry)
+    {
+        // TODO deal with theses shifts on x32
+        constexpr uint64_t p      = 0xffff;
+        const uint64_t obj_header = (((entry >> 16) | (p << 48)) >> 4) << 4;
+        return objects::obj_t{obj_header + d.nt.offsets_[OBJECT_HEADER_Body]};
+    }
+
+    // one guest read per table page, entries decoded locally
+    walk_e list_handle_page(const Data& d, uint64_t page, uint64_t handle_base, const objects::on_handle_fn& on_handle)
+    {
+        auto buffer   = std::array<uint8_t, handle_page_size>{};
+        const auto ok = d.io.read_all(&buffer[0], page, sizeof buffer);
+        if(!ok)
+            return FAIL(walk_e::next, "unable to read handle table page 0x%" PRIx64, page);
+
+        for(size_t i = 0; i < handles_per_page; ++i)
+        {
+            const auto entry = read_le64(&buffer[i * handle_entry_size]);
+            if(!entry)
+                continue;
+
+            const auto handle = static_cast<nt::HANDLE>(handle_base + i * 4);
+            if(on_handle(handle, decode_handle_entry(d, entry)) == walk_e::stop)
+                return walk_e::stop;
+        }
+        return walk_e::next;
+    }
+
+    walk_e list_handle_pointers(const Data& d, uint64_t page, uint64_t handle_base, int level, const objects::on_handle_fn& on_handle)
+    {
+        auto buffer   = std::array<uint8_t, handle_page_size>{};
+        const auto ok = d.io.read_all(&buffer[0], page, sizeof buffer);
+        if(!ok)
+            return FAIL(walk_e::next, "unable to read handle table directory 0x%" PRIx64, page);
+
+        // handles covered by one child of this level
+        const auto stride = level == 1 ? handles_per_page * 4 : ptrs_per_page * handles_per_page * 4;
+        for(size_t i = 0; i < ptrs_per_page; i += 4)
+        {
+            // batched decode, four pointers per load
+            uint64_t children[4];
+            read_le64x4(children, &buffer[i * handle_ptr_size]);
+            for(size_t j = 0; j < 4; ++j)
+            {
+                const auto child = children[j];
+                if(!child)
+                    continue;
+
+                const auto base = handle_base + (i + j) * stride;
+                const auto ret  = level == 1
+                                      ? list_handle_page(d, child, base, on_handle)
+                                      : list_handle_pointers(d, child, base, level - 1, on_handle);
+                if(ret == walk_e::stop)
+                    return walk_e::stop;
+            }
+        }
+        return walk_e::next;
+    }
+}
+
+bool objects::list_handles(Data& d, const on_handle_fn& on_handle)
+{
+    const auto handle_table = d.io.read(d.proc.id + d.nt.offsets_[EPROCESS_ObjectTable]);
+    if(!handle_table)
+        return FAIL(false, "unable to read handle table");
+
+    const auto table_code = d.io.read(*handle_table + d.nt.offsets_[HANDLE_TABLE_TableCode]);
+    if(!table_code)
+        return FAIL(false, "unable to read handle table code");
+
+    const auto level = static_cast<int>(*table_code & 3);
+    const auto root  = *table_code & ~uint64_t{3};
+    if(level > 2)
+        return FAIL(false, "Unknown table level");
+
+    if(level == 0)
+        list_handle_page(d, root, 0, on_handle);
+    else
+        list_handle_pointers(d, root, 0, level, on_handle);
+    return true;
+}
+
 namespace
 {
     opt<std::string> object_type(const Data& d, objects::obj_t obj)
@@ -3,6 +3,7 @@
 #include "icebox/types.hpp"
 #include "nt.hpp"
 
+#include <functional>
 #include <memory>
 #include <string_view>
 
@@ -48,8 +49,11 @@ namespace objects
     struct Data;
     using Handler = std::shared_ptr<Data>;
 
+    using on_handle_fn = std::function<walk_e(nt::HANDLE, obj_t)>;
+
     Handler             make                (core::Core& core, proc_t proc);
     opt<obj_t>          read                (Data& data, nt::HANDLE handle);
+    bool                list_handles        (Data& data, const on_handle_fn& on_handle);
     opt<std::string>    name                (Data& data, obj_t obj);
     opt<std::string>    type                (Data& data, obj_t obj);
     opt<file_t>         file_read           (Data& data, nt::HANDLE handle);
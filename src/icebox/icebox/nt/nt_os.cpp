@@ -5,15 +5,20 @@
 #include "core/core_private.hpp"
 #include "interfaces/if_symbols.hpp"
 #include "log.hpp"
+#include "utils/file.hpp"
 #include "utils/hex.hpp"
 #include "utils/pe.hpp"
 #include "utils/utils.hpp"
 
+#include <cstring>
+
 nt::Os::Os(core::Core& core)
     : core_(core)
     , kpcr_(0)
     , io_(memory::make_io_current(core))
     , num_page_faults_(0)
+    , mmu_generation_(0)
+    , procs_ready_(false)
     , LdrpInitializeProcess_{0}
     , LdrpSendDllNotifications_{0}
     , NtMajorVersion_{0}
@@ -67,6 +72,95 @@ namespace
         return {};
     }
 
+    // kernel anchors remembered across attaches of the same vm,
+    // they spare the backward page scan behind lstar on reconnect
+    struct AnchorCache
+    {
+        char     magic[4];
+        uint32_t version;
+        uint64_t kernel_addr;
+        uint64_t kernel_size;
+        uint64_t kpcr;
+        uint64_t dtb;
+    };
+    STATIC_ASSERT_EQ(40, sizeof(AnchorCache));
+
+    constexpr char     anchor_magic[4] = {'I', 'B', 'N', 'T'};
+    constexpr uint32_t anchor_version  = 1;
+
+    fs::path anchor_path(const nt::Os& os)
+    {
+        auto ec        = std::error_code{};
+        const auto dir = fs::temp_directory_path(ec);
+        if(ec)
+            return {};
+
+        return dir / ("icebox." + os.core_.name_ + ".nt");
+    }
+
+    opt<span_t> load_kernel_anchors(nt::Os& os)
+    {
+        const auto path = anchor_path(os);
+        if(path.empty())
+            return {};
+
+        auto map = file::Map{};
+        if(!file::map_read(map, path))
+            return {};
+
+        auto head    = AnchorCache{};
+        const auto n = std::min(map.size, sizeof head);
+        memcpy(&head, map.data, n);
+        file::unmap(map);
+        if(n != sizeof head || memcmp(head.magic, anchor_magic, sizeof head.magic) != 0 || head.version != anchor_version)
+            return {};
+
+        // the anchors die on reboot with kaslr, revalidate them:
+        // the cached base must still hold a pe image of the same size
+        if(!is_kernel(os.kpcr_) && is_kernel(head.kpcr))
+            os.kpcr_ = head.kpcr;
+
+        auto buf     = std::array<uint8_t, PAGE_SIZE>{};
+        const auto cur = os.io_.dtb;
+        auto ok      = os.io_.read_all(&buf[0], head.kernel_addr, sizeof buf);
+        if(!ok && head.dtb)
+        {
+            os.io_.dtb = dtb_t{head.dtb};
+            ok         = os.io_.read_all(&buf[0], head.kernel_addr, sizeof buf);
+        }
+        if(!ok)
+        {
+            os.io_.dtb = cur;
+            return {};
+        }
+
+        const auto size = pe::read_image_size(&buf[0], sizeof buf);
+        if(!size || *size != head.kernel_size)
+        {
+            os.io_.dtb = cur;
+            return {};
+        }
+
+        LOG(INFO, "kernel anchors reused from %s", path.generic_string().data());
+        return span_t{head.kernel_addr, head.kernel_size};
+    }
+
+    void save_kernel_anchors(const nt::Os& os, span_t kernel)
+    {
+        const auto path = anchor_path(os);
+        if(path.empty())
+            return;
+
+        auto head = AnchorCache{};
+        memcpy(head.magic, anchor_magic, sizeof head.magic);
+        head.version     = anchor_version;
+        head.kernel_addr = kernel.addr;
+        head.kernel_size = kernel.size;
+        head.kpcr        = os.kpcr_;
+        head.dtb         = os.io_.dtb.val;
+        file::write_async(path, &head, sizeof head);
+    }
+
     bool read_phy_symbol(nt::Os& os, phy_t& dst, const memory::Io& io, const char* module, const char* name)
     {
         const auto where = symbols::address(os.core_, symbols::kernel, module, name);
@@ -235,10 +329,14 @@ bool nt::Os::setup()
     kpcr_ = registers::read_msr(core_, msr_e::gs_base);
     if(!is_kernel(kpcr_))
         kpcr_ = registers::read_msr(core_, msr_e::kernel_gs_base);
+
+    // anchors may also supply the kpcr when the msrs hold user values
+    auto kernel = load_kernel_anchors(*this);
     if(!is_kernel(kpcr_))
         return FAIL(false, "unable to read KPCR");
 
-    const auto kernel = find_kernel(*this, core_);
+    if(!kernel)
+        kernel = find_kernel(*this, core_);
     if(!kernel)
         return FAIL(false, "unable to find kernel");
 
@@ -256,7 +354,7 @@ bool nt::Os::setup()
     if(!ok)
         return FAIL(false, "unable to load symbols from kernel module");
 
-    ok = nt::load_kernel_symbols(*this);
+    ok = nt::load_kernel_symbols(*this, *kernel, *opt_id);
     if(!ok)
         return false;
 
@@ -290,10 +388,89 @@ bool nt::Os::setup()
         return false;
 
     init_nt_mmu(*this);
+    save_kernel_anchors(*this, *kernel);
     LOG(WARNING, "kernel: kpcr:0x%" PRIx64 " kdtb:0x%" PRIx64 " version:%d.%d", kpcr_, io_.dtb.val, NtMajorVersion_, NtMinorVersion_);
     return try_load_ntdll(*this, core_);
 }
 
+opt<uint64_t> nt::read_handle_table_entry(nt::Os& os, const memory::Io& io, uint64_t handle_table, uint64_t handle)
+{
+    auto handle_table_code = io.read(handle_table + os.offsets_[HANDLE_TABLE_TableCode]);
+    if(!handle_table_code)
+        return FAIL(std::nullopt, "unable to read handle table code");
+
+    const auto handle_table_level = *handle_table_code & 3;
+    *handle_table_code &= ~3;
+
+    constexpr auto HANDLE_VALUE_INC        = 0x04; // Amount to increment the Value to get to the next handle
+    constexpr auto HANDLE_TABLE_ENTRY_SIZE = 0x10;
+    constexpr auto POINTER_SIZE            = 8;
+
+    auto i = uint64_t{};
+    auto j = uint64_t{};
+    auto k = uint64_t{};
+    switch(handle_table_level)
+    {
+        case 0:
+            i = handle;
+            break;
+
+        case 1:
+            i = handle % ((PAGE_SIZE / HANDLE_TABLE_ENTRY_SIZE) * HANDLE_VALUE_INC);
+            handle -= i;
+            j = handle / (((PAGE_SIZE / HANDLE_TABLE_ENTRY_SIZE) * HANDLE_VALUE_INC) / POINTER_SIZE);
+
+            handle_table_code = io.read(*handle_table_code + j);
+            break;
+
+        case 2:
+            i = handle % ((PAGE_SIZE / HANDLE_TABLE_ENTRY_SIZE) * HANDLE_VALUE_INC);
+            handle -= i;
+            k = handle / (((PAGE_SIZE / HANDLE_TABLE_ENTRY_SIZE) * HANDLE_VALUE_INC) / POINTER_SIZE);
+            j = k % PAGE_SIZE;
+            k -= j;
+            k /= (PAGE_SIZE / POINTER_SIZE);
+
+            handle_table_code = io.read(*handle_table_code + k);
+            if(!handle_table_code)
+                return {};
+
+            handle_table_code = io.read(*handle_table_code + j);
+            break;
+
+        default:
+            return FAIL(std::nullopt, "Unknown table level");
+    }
+    if(!handle_table_code || !*handle_table_code)
+        return {};
+
+    const auto entry = io.read(*handle_table_code + i * (HANDLE_TABLE_ENTRY_SIZE / HANDLE_VALUE_INC));
+    if(!entry)
+        return FAIL(std::nullopt, "unable to read table entry");
+
+    return entry;
+}
+
+opt<uint64_t> nt::read_cid_object(nt::Os& os, uint64_t id)
+{
+    // PspCidTable maps pids & tids straight to EPROCESS/ETHREAD
+    const auto cid_table = os.symbols_[PspCidTable];
+    if(!cid_table)
+        return {};
+
+    const auto table = os.io_.read(*cid_table);
+    if(!table || !*table)
+        return {};
+
+    const auto entry = read_handle_table_entry(os, os.io_, *table, id);
+    if(!entry || !*entry)
+        return {};
+
+    // cid entries point at the object itself, not at an object header
+    constexpr uint64_t p = 0xffff;
+    return (((*entry >> 16) | (p << 48)) >> 4) << 4;
+}
+
 std::shared_ptr<nt::Os> os::make_nt(core::Core& core)
 {
     return std::make_shared<nt::Os>(core);
@@ -1,7 +1,12 @@
 #include "core.hpp"
 #include "interfaces/if_os.hpp"
+#include "lists.hpp"
 
 #include <array>
+#include <map>
+#include <unordered_map>
+
+namespace symbols { struct Identity; }
 
 enum offset_e
 {
@@ -51,6 +56,9 @@ enum offset_e
     OBJECT_TYPE_Name,
     PEB_Ldr,
     PEB32_Ldr,
+    POOL_TRACKER_BIG_PAGES_Key,
+    POOL_TRACKER_BIG_PAGES_NumberOfBytes,
+    POOL_TRACKER_BIG_PAGES_Va,
     SE_AUDIT_PROCESS_CREATION_INFO_ImageFileName,
     SUBSECTION_ControlArea,
     OFFSET_COUNT,
@@ -69,8 +77,11 @@ enum symbol_e
     ObpKernelHandleTable,
     ObpRootDirectoryObject,
     ObTypeIndexTable,
+    PoolBigPageTable,
+    PoolBigPageTableSize,
     PsActiveProcessHead,
     PsLoadedModuleList,
+    PspCidTable,
     PspExitProcess,
     PspExitThread,
     PspInsertThread,
@@ -83,9 +94,51 @@ namespace nt
     using Offsets = std::array<uint64_t, OFFSET_COUNT>;
     using Symbols = std::array<opt<uint64_t>, SYMBOL_COUNT>;
 
+    struct ProcEntry
+    {
+        proc_t      proc;
+        std::string name;
+    };
+    using ProcCache = std::unordered_map<uint64_t, ProcEntry>;
+
+    struct ModSpan
+    {
+        mod_t    mod;
+        uint64_t size;
+    };
+    struct ProcMods
+    {
+        std::map<uint64_t, ModSpan> spans; // sorted by base address
+        opt<bpid_t>                 bp;
+    };
+    using ModCache = std::unordered_map<uint64_t, ProcMods>;
+
+    struct VadEntry
+    {
+        uint64_t vad;
+        uint64_t ending_vpn;
+    };
+    struct VadTree
+    {
+        std::map<uint64_t, VadEntry> spans; // sorted by starting vpn
+    };
+    using VadCache = std::unordered_map<uint64_t, VadTree>;
+
+    struct ThreadCache
+    {
+        std::unordered_map<uint64_t, uint64_t> threads; // ethread -> eproc
+        bool                                   ready = false;
+        opt<bpid_t>                            bp_create;
+        opt<bpid_t>                            bp_delete;
+    };
+
     struct Os;
-    bool            load_kernel_symbols (nt::Os& os);
+    bool            load_kernel_symbols (nt::Os& os, span_t kernel, const symbols::Identity& id);
     opt<proc_t>     make_proc           (nt::Os& os, uint64_t eproc);
+    opt<uint64_t>   read_handle_table_entry (nt::Os& os, const memory::Io& io, uint64_t handle_table, uint64_t handle);
+    opt<uint64_t>   read_cid_object     (nt::Os& os, uint64_t id);
+    void            reset_mod_cache     (nt::Os& os, proc_t proc);
+    void            forget_proc_threads (nt::Os& os, proc_t proc);
     opt<uint64_t>   read_vad_root_addr  (nt::Os& os, const memory::Io& io, proc_t proc, uint64_t vad_root_offset);
     bool            is_user_mode        (uint64_t cs);
 
@@ -97,9 +150,13 @@ namespace nt
         // os::IModule
         bool        setup               () override;
         bool        is_kernel_address   (uint64_t ptr) override;
+        uint64_t    kernel_split        () override;
         bool        read_page           (void* dst, uint64_t ptr, proc_t* proc, dtb_t dtb) override;
         bool        write_page          (uint64_t ptr, const void* src, proc_t* proc, dtb_t dtb) override;
         opt<phy_t>  virtual_to_physical (proc_t* proc, dtb_t dtb, uint64_t ptr) override;
+        opt<phy_t>  virtual_to_physical_walk(proc_t* proc, dtb_t dtb, uint64_t ptr) override;
+        bool        residency_map       (proc_t* proc, dtb_t dtb, span_t span, uint8_t* states) override;
+        size_t      page_in             (proc_t proc, span_t span) override;
         dtb_t       kernel_dtb          () override;
 
         bool                proc_list       (process::on_proc_fn on_process) override;
@@ -115,9 +172,12 @@ namespace nt
 
         bool            thread_list     (proc_t proc, threads::on_thread_fn on_thread) override;
         opt<thread_t>   thread_current  () override;
+        opt<uint64_t>   thread_current_slot() override;
         opt<proc_t>     thread_proc     (thread_t thread) override;
         opt<uint64_t>   thread_pc       (proc_t proc, thread_t thread) override;
         uint64_t        thread_id       (proc_t proc, thread_t thread) override;
+        opt<thread_t>   thread_find     (uint64_t tid) override;
+        bool            thread_list_info(threads::on_info_fn on_info) override;
 
         bool                mod_list(proc_t proc, modules::on_mod_fn on_module) override;
         opt<std::string>    mod_name(proc_t proc, mod_t mod) override;
@@ -127,6 +187,7 @@ namespace nt
         bool                vm_area_list    (proc_t proc, vm_area::on_vm_area_fn on_vm_area) override;
         opt<vm_area_t>      vm_area_find    (proc_t proc, uint64_t addr) override;
         opt<span_t>         vm_area_span    (proc_t proc, vm_area_t vm_area) override;
+        void                vm_area_refresh (proc_t proc) override;
         vma_access_e        vm_area_access  (proc_t proc, vm_area_t vm_area) override;
         vma_type_e          vm_area_type    (proc_t proc, vm_area_t vm_area) override;
         opt<std::string>    vm_area_name    (proc_t proc, vm_area_t vm_area) override;
@@ -144,6 +205,7 @@ namespace nt
 
         opt<arg_t>  read_stack  (size_t index) override;
         opt<arg_t>  read_arg    (size_t index) override;
+        bool        read_args   (arg_t* args, size_t count) override;
         bool        write_arg   (size_t index, arg_t arg) override;
 
         void debug_print() override;
@@ -157,6 +219,28 @@ namespace nt
         memory::Io  io_;
         size_t      num_page_faults_;
 
+        // upper page-table entries cached while the vm stays paused
+        std::unordered_map<uint64_t, uint64_t> mmu_entries_;
+        uint64_t                               mmu_generation_;
+
+        // process snapshot kept current by process events, see load_proc_cache
+        ProcCache   procs_;
+
+        // per-process module spans, see load_mod_cache
+        ModCache    mods_;
+
+        // per-process vad snapshots, see load_vad_cache
+        VadCache    vads_;
+
+        // remembered guest list chains, revalidated in one batched read
+        lists::Walker lists_;
+
+        // thread table kept current by thread events, see load_thread_cache
+        ThreadCache threads_;
+        bool        procs_ready_;
+        opt<bpid_t> bp_proc_create_;
+        opt<bpid_t> bp_proc_delete_;
+
         // constants
         phy_t    LdrpInitializeProcess_;
         phy_t    LdrpSendDllNotifications_;
@@ -0,0 +1,140 @@
+#include "nt_pool.hpp"
+
+#define PRIVATE_CORE__
+#define FDP_MODULE "nt_pool"
+#include "core.hpp"
+#include "core/core_private.hpp"
+#include "endian.hpp"
+#include "log.hpp"
+#include "memory.hpp"
+#include "nt_os.hpp"
+#include "scanner.hpp"
+#include "symbols.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t protected_pool = 0x80000000; // quota allocations set the top tag bit
+    constexpr uint64_t big_entry_free = 1;          // freed tracker entries keep Va with bit 0 set
+
+    constexpr uint64_t block_shift = 4; // pool blocks & headers are 16 bytes on x64
+    constexpr uint64_t block_size  = 1 << block_shift;
+    constexpr uint64_t page_size   = 0x1000;
+}
+
+uint32_t pools::tag(std::string_view name)
+{
+    auto ret = uint32_t{};
+    for(size_t i = 0; i < 4 && i < name.size(); ++i)
+        ret |= static_cast<uint32_t>(static_cast<uint8_t>(name[i])) << (8 * i);
+    return ret;
+}
+
+bool pools::list_big(core::Core& core, uint32_t tag, const pools::on_alloc_fn& on_alloc)
+{
+    auto& os = *core.nt_;
+    if(!os.symbols_[PoolBigPageTable] || !os.symbols_[PoolBigPageTableSize])
+        return FAIL(false, "big pool tracker symbols missing from this kernel");
+
+    const auto table = os.io_.read(*os.symbols_[PoolBigPageTable]);
+    const auto count = os.io_.read(*os.symbols_[PoolBigPageTableSize]);
+    if(!table || !count || !*table || !*count)
+        return FAIL(false, "unable to read big pool tracker table");
+
+    const auto struc = symbols::read_struc(core, symbols::kernel, "nt", "_POOL_TRACKER_BIG_PAGES");
+    if(!struc)
+        return FAIL(false, "unable to read _POOL_TRACKER_BIG_PAGES");
+
+    const auto entry_size = struc->bytes;
+    const auto off_va     = os.offsets_[POOL_TRACKER_BIG_PAGES_Va];
+    const auto off_key    = os.offsets_[POOL_TRACKER_BIG_PAGES_Key];
+    const auto off_bytes  = os.offsets_[POOL_TRACKER_BIG_PAGES_NumberOfBytes];
+
+    // stream the table in batched reads, skipping any unmapped span
+    constexpr size_t entries_per_read = 0x1000;
+    auto             buffer           = std::vector<uint8_t>{};
+    for(uint64_t i = 0; i < *count; i += entries_per_read)
+    {
+        const auto n = std::min<uint64_t>(entries_per_read, *count - i);
+        buffer.resize(n * entry_size);
+        const auto ok = os.io_.read_all(&buffer[0], *table + i * entry_size, buffer.size());
+        if(!ok)
+            continue;
+
+        for(uint64_t e = 0; e < n; ++e)
+        {
+            const auto* entry = &buffer[e * entry_size];
+            const auto  va    = read_le64(&entry[off_va]);
+            if(!va || (va & big_entry_free))
+                continue;
+
+            const auto key = read_le32(&entry[off_key]);
+            if((key & ~protected_pool) != tag)
+                continue;
+
+            const auto bytes = read_le64(&entry[off_bytes]);
+            if(on_alloc({va, bytes, tag, true}) == walk_e::stop)
+                return true;
+        }
+    }
+    return true;
+}
+
+namespace
+{
+    // small-pool hits are physical addresses, the scanner has no reverse mapping
+    walk_e check_pool_header(core::Core& core, phy_t phy, uint32_t tag, const pools::on_alloc_fn& on_alloc)
+    {
+        // the tag matched at _POOL_HEADER+4, headers are block-aligned
+        if(phy.val < 4 || ((phy.val - 4) & (block_size - 1)))
+            return walk_e::next;
+
+        const auto header = phy_t{phy.val - 4};
+        auto       raw    = std::array<uint8_t, 4>{};
+        const auto ok     = memory::read_physical(core, &raw[0], header.val, sizeof raw);
+        if(!ok)
+            return walk_e::next;
+
+        // PreviousSize:8 PoolIndex:8 BlockSize:8 PoolType:8
+        const auto bits       = read_le32(&raw[0]);
+        const auto prev_size  = (bits >> 0) & 0xff;
+        const auto num_blocks = (bits >> 16) & 0xff;
+        const auto pool_type  = (bits >> 24) & 0xff;
+        if(!num_blocks || !pool_type)
+            return walk_e::next; // free or not a header
+
+        const auto size = num_blocks << block_shift;
+        if(size > page_size || (header.val & (page_size - 1)) + size > page_size)
+            return walk_e::next; // small allocations never span pages
+
+        if((prev_size << block_shift) > (header.val & (page_size - 1)))
+            return walk_e::next;
+
+        return on_alloc({header.val + block_size, size - block_size, tag, false});
+    }
+}
+
+bool pools::scan(core::Core& core, uint32_t tag, const pools::on_alloc_fn& on_alloc)
+{
+    // one parallel sweep anchored on the tag bytes, with & without the protected bit
+    auto keys = std::vector<uint32_t>{tag};
+    if(!(tag & protected_pool))
+        keys.push_back(tag | protected_pool);
+
+    auto patterns = std::vector<scanner::pattern_t>{};
+    for(const auto key : keys)
+    {
+        auto pat = scanner::pattern_t{};
+        pat.bytes.resize(sizeof key);
+        memcpy(&pat.bytes[0], &key, sizeof key);
+        patterns.push_back(std::move(pat));
+    }
+    return scanner::scan_physical(core, patterns, [&](scanner::match_t match)
+    {
+        return check_pool_header(core, match.phy, tag, on_alloc);
+    });
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "icebox/types.hpp"
+
+#include <functional>
+#include <string_view>
+
+namespace core { struct Core; }
+
+namespace pools
+{
+    struct alloc_t
+    {
+        uint64_t addr; // payload start: virtual for big pool, physical for scans
+        uint64_t size; // payload size in bytes
+        uint32_t tag;
+        bool     big;
+    };
+
+    using on_alloc_fn = std::function<walk_e(alloc_t)>;
+
+    uint32_t tag     (std::string_view name); // "File" -> 0x656c6946
+    bool     list_big(core::Core& core, uint32_t tag, const on_alloc_fn& on_alloc);
+    bool     scan    (core::Core& core, uint32_t tag, const on_alloc_fn& on_alloc);
+} // namespace pools
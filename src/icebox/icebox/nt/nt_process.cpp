@@ -37,17 +37,69 @@ opt<proc_t> nt::make_proc(nt::Os& os, uint64_t eproc)
     return proc_t{eproc, dtb_t{*kdtb}, *dtb};
 }
 
-bool nt::Os::proc_list(process::on_proc_fn on_process)
+namespace
 {
-    const auto head = *symbols_[PsActiveProcessHead];
-    for(auto link = io_.read(head); link != head; link = io_.read(*link))
+    bool list_procs_from_guest(nt::Os& os, const process::on_proc_fn& on_process)
     {
-        const auto eproc = *link - offsets_[EPROCESS_ActiveProcessLinks];
-        const auto proc  = make_proc(*this, eproc);
-        if(!proc)
-            continue;
+        const auto head = *os.symbols_[PsActiveProcessHead];
+        return lists::walk(os.lists_, os.io_, head, [&](uint64_t link)
+        {
+            const auto eproc = link - os.offsets_[EPROCESS_ActiveProcessLinks];
+            const auto proc  = nt::make_proc(os, eproc);
+            if(!proc)
+                return walk_e::next;
+
+            return on_process(*proc);
+        });
+    }
+
+    void cache_proc(nt::Os& os, proc_t proc)
+    {
+        const auto name     = os.proc_name(proc);
+        os.procs_[os.proc_id(proc)] = nt::ProcEntry{proc, name ? *name : std::string{}};
+    }
+
+    bool load_proc_cache(nt::Os& os)
+    {
+        if(os.procs_ready_)
+            return true;
+
+        // process events are only reachable once ntdll is known
+        if(!os.LdrpInitializeProcess_.val)
+            return false;
+
+        // one full guest walk, then creation & deletion events keep
+        // the snapshot current without further ActiveProcessLinks reads
+        os.procs_.clear();
+        list_procs_from_guest(os, [&](proc_t proc)
+        {
+            cache_proc(os, proc);
+            return walk_e::next;
+        });
+        os.bp_proc_create_ = os.listen_proc_create([&os](proc_t proc)
+        {
+            cache_proc(os, proc);
+        });
+        os.bp_proc_delete_ = os.listen_proc_delete([&os](proc_t proc)
+        {
+            os.procs_.erase(os.proc_id(proc));
+            nt::reset_mod_cache(os, proc);
+            nt::forget_proc_threads(os, proc);
+            os.vads_.erase(proc.id);
+        });
+        os.procs_ready_ = os.bp_proc_create_ && os.bp_proc_delete_;
+        return os.procs_ready_;
+    }
+}
 
-        const auto err = on_process(*proc);
+bool nt::Os::proc_list(process::on_proc_fn on_process)
+{
+    if(!load_proc_cache(*this))
+        return list_procs_from_guest(*this, on_process);
+
+    for(const auto& it : procs_)
+    {
+        const auto err = on_process(it.second.proc);
         if(err == walk_e::stop)
             break;
     }
@@ -63,41 +115,93 @@ opt<proc_t> nt::Os::proc_current()
     return thread_proc(*current);
 }
 
+namespace
+{
+    opt<proc_t> find_name_from_guest(nt::Os& os, std::string_view name, flags_t flags)
+    {
+        opt<proc_t> found;
+        list_procs_from_guest(os, [&](proc_t proc)
+        {
+            const auto got = os.proc_name(proc);
+            if(*got != name)
+                return walk_e::next;
+
+            const auto f = os.proc_flags(proc);
+            if(!os::check_flags(f, flags))
+                return walk_e::next;
+
+            if(!os.proc_is_valid(proc))
+                return walk_e::next;
+
+            found = proc;
+            return walk_e::stop;
+        });
+        return found;
+    }
+
+    opt<proc_t> find_pid_from_guest(nt::Os& os, uint64_t pid)
+    {
+        opt<proc_t> found;
+        list_procs_from_guest(os, [&](proc_t proc)
+        {
+            const auto got = os.proc_id(proc);
+            if(got != pid)
+                return walk_e::next;
+
+            found = proc;
+            return walk_e::stop;
+        });
+        return found;
+    }
+}
+
 opt<proc_t> nt::Os::proc_find(std::string_view name, flags_t flags)
 {
-    opt<proc_t> found;
-    proc_list([&](proc_t proc)
+    if(!load_proc_cache(*this))
+        return find_name_from_guest(*this, name, flags);
+
+    for(const auto& it : procs_)
     {
-        const auto got = proc_name(proc);
-        if(*got != name)
-            return walk_e::next;
+        if(it.second.name != name)
+            continue;
 
-        const auto f = proc_flags(proc);
-        if(!os::check_flags(f, flags))
-            return walk_e::next;
+        if(!os::check_flags(proc_flags(it.second.proc), flags))
+            continue;
 
-        if(!proc_is_valid(proc))
-            return walk_e::next;
+        if(!proc_is_valid(it.second.proc))
+            continue;
 
-        found = proc;
-        return walk_e::stop;
-    });
-    return found;
+        return it.second.proc;
+    }
+    // processes past creation but before ldr initialization
+    // are only visible on the guest list
+    return find_name_from_guest(*this, name, flags);
 }
 
 opt<proc_t> nt::Os::proc_find(uint64_t pid)
 {
-    opt<proc_t> found;
-    proc_list([&](proc_t proc)
+    if(load_proc_cache(*this))
     {
-        const auto got = proc_id(proc);
-        if(got != pid)
-            return walk_e::next;
+        const auto it = procs_.find(pid);
+        if(it != procs_.end())
+            return it->second.proc;
+    }
 
-        found = proc;
-        return walk_e::stop;
-    });
-    return found;
+    // a couple of targeted reads through PspCidTable when available
+    if(symbols_[PspCidTable])
+    {
+        const auto eproc = nt::read_cid_object(*this, pid);
+        if(!eproc)
+            return {};
+
+        const auto proc = make_proc(*this, *eproc);
+        if(!proc || proc_id(*proc) != pid)
+            return {};
+
+        return proc;
+    }
+
+    return find_pid_from_guest(*this, pid);
 }
 
 opt<std::string> nt::Os::proc_name(proc_t proc)
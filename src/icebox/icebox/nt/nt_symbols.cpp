@@ -1,9 +1,13 @@
 #include "nt_os.hpp"
 
 #define FDP_MODULE "nt"
+#include "interfaces/if_symbols.hpp"
 #include "log.hpp"
+#include "symbols.hpp"
+#include "utils/file.hpp"
 #include "utils/utils.hpp"
 
+#include <cstdlib>
 #include <cstring>
 
 namespace
@@ -14,65 +18,60 @@ namespace
         OPTIONAL,
     };
 
-    struct NtOffset
-    {
-        offset_e    e_id;
-        cat_e       e_cat;
-        const char* module;
-        const char* struc;
-        const char* member;
-    };
     // clang-format off
-    const NtOffset g_offsets[] =
+    const symbols::offset_desc_t g_offsets[] =
     {
-        {CLIENT_ID_UniqueThread,                       cat_e::REQUIRED, "nt", "_CLIENT_ID",                       "UniqueThread"},
-        {CONTROL_AREA_FilePointer,                     cat_e::REQUIRED, "nt", "_CONTROL_AREA",                    "FilePointer"},
-        {DEVICE_OBJECT_DriverObject,                   cat_e::REQUIRED, "nt", "_DEVICE_OBJECT",                   "DriverObject"},
-        {DRIVER_OBJECT_DriverName,                     cat_e::REQUIRED, "nt", "_DRIVER_OBJECT",                   "DriverName"},
-        {EPROCESS_ActiveProcessLinks,                  cat_e::REQUIRED, "nt", "_EPROCESS",                        "ActiveProcessLinks"},
-        {EPROCESS_ImageFileName,                       cat_e::REQUIRED, "nt", "_EPROCESS",                        "ImageFileName"},
-        {EPROCESS_InheritedFromUniqueProcessId,        cat_e::REQUIRED, "nt", "_EPROCESS",                        "InheritedFromUniqueProcessId"},
-        {EPROCESS_ObjectTable,                         cat_e::REQUIRED, "nt", "_EPROCESS",                        "ObjectTable"},
-        {EPROCESS_Pcb,                                 cat_e::REQUIRED, "nt", "_EPROCESS",                        "Pcb"},
-        {EPROCESS_Peb,                                 cat_e::REQUIRED, "nt", "_EPROCESS",                        "Peb"},
-        {EPROCESS_SeAuditProcessCreationInfo,          cat_e::REQUIRED, "nt", "_EPROCESS",                        "SeAuditProcessCreationInfo"},
-        {EPROCESS_ThreadListHead,                      cat_e::REQUIRED, "nt", "_EPROCESS",                        "ThreadListHead"},
-        {EPROCESS_UniqueProcessId,                     cat_e::REQUIRED, "nt", "_EPROCESS",                        "UniqueProcessId"},
-        {EPROCESS_VadRoot,                             cat_e::REQUIRED, "nt", "_EPROCESS",                        "VadRoot"},
-        {EPROCESS_Wow64Process,                        cat_e::REQUIRED, "nt", "_EPROCESS",                        "Wow64Process"},
-        {ETHREAD_Cid,                                  cat_e::REQUIRED, "nt", "_ETHREAD",                         "Cid"},
-        {ETHREAD_Tcb,                                  cat_e::REQUIRED, "nt", "_ETHREAD",                         "Tcb"},
-        {ETHREAD_ThreadListEntry,                      cat_e::REQUIRED, "nt", "_ETHREAD",                         "ThreadListEntry"},
-        {EWOW64PROCESS_NtdllType,                      cat_e::OPTIONAL, "nt", "_EWOW64PROCESS",                   "NtdllType"},
-        {EWOW64PROCESS_Peb,                            cat_e::OPTIONAL, "nt", "_EWOW64PROCESS",                   "Peb"},
-        {FILE_OBJECT_DeviceObject,                     cat_e::REQUIRED, "nt", "_FILE_OBJECT",                     "DeviceObject"},
-        {FILE_OBJECT_FileName,                         cat_e::REQUIRED, "nt", "_FILE_OBJECT",                     "FileName"},
-        {HANDLE_TABLE_TableCode,                       cat_e::REQUIRED, "nt", "_HANDLE_TABLE",                    "TableCode"},
-        {KPCR_Prcb,                                    cat_e::REQUIRED, "nt", "_KPCR",                            "Prcb"},
-        {KPRCB_CurrentThread,                          cat_e::REQUIRED, "nt", "_KPRCB",                           "CurrentThread"},
-        {KPRCB_KernelDirectoryTableBase,               cat_e::OPTIONAL, "nt", "_KPRCB",                           "KernelDirectoryTableBase"},
-        {KPRCB_RspBase,                                cat_e::REQUIRED, "nt", "_KPRCB",                           "RspBase"},
-        {KPRCB_RspBaseShadow,                          cat_e::OPTIONAL, "nt", "_KPRCB",                           "RspBaseShadow"},
-        {KPRCB_UserRspShadow,                          cat_e::OPTIONAL, "nt", "_KPRCB",                           "UserRspShadow"},
-        {KPROCESS_DirectoryTableBase,                  cat_e::REQUIRED, "nt", "_KPROCESS",                        "DirectoryTableBase"},
-        {KPROCESS_UserDirectoryTableBase,              cat_e::OPTIONAL, "nt", "_KPROCESS",                        "UserDirectoryTableBase"},
-        {KTHREAD_Process,                              cat_e::REQUIRED, "nt", "_KTHREAD",                         "Process"},
-        {KTHREAD_TrapFrame,                            cat_e::REQUIRED, "nt", "_KTHREAD",                         "TrapFrame"},
-        {KTRAP_FRAME_Rip,                              cat_e::REQUIRED, "nt", "_KTRAP_FRAME",                     "Rip"},
-        {KUSER_SHARED_DATA_NtMajorVersion,             cat_e::REQUIRED, "nt", "_KUSER_SHARED_DATA",               "NtMajorVersion"},
-        {KUSER_SHARED_DATA_NtMinorVersion,             cat_e::REQUIRED, "nt", "_KUSER_SHARED_DATA",               "NtMinorVersion"},
-        {MMVAD_FirstPrototypePte,                      cat_e::REQUIRED, "nt", "_MMVAD",                           "FirstPrototypePte"},
-        {MMVAD_SubSection,                             cat_e::REQUIRED, "nt", "_MMVAD",                           "Subsection"},
-        {OBJECT_ATTRIBUTES_ObjectName,                 cat_e::REQUIRED, "nt", "_OBJECT_ATTRIBUTES",               "ObjectName"},
-        {OBJECT_HEADER_Body,                           cat_e::REQUIRED, "nt", "_OBJECT_HEADER",                   "Body"},
-        {OBJECT_HEADER_InfoMask,                       cat_e::REQUIRED, "nt", "_OBJECT_HEADER",                   "InfoMask"},
-        {OBJECT_HEADER_TypeIndex,                      cat_e::REQUIRED, "nt", "_OBJECT_HEADER",                   "TypeIndex"},
-        {OBJECT_NAME_INFORMATION_Name,                 cat_e::REQUIRED, "nt", "_OBJECT_NAME_INFORMATION",         "Name"},
-        {OBJECT_TYPE_Name,                             cat_e::REQUIRED, "nt", "_OBJECT_TYPE",                     "Name"},
-        {PEB_Ldr,                                      cat_e::REQUIRED, "nt", "_PEB",                             "Ldr"},
-        {PEB32_Ldr,                                    cat_e::REQUIRED, "nt", "_PEB32",                           "Ldr"},
-        {SE_AUDIT_PROCESS_CREATION_INFO_ImageFileName, cat_e::REQUIRED, "nt", "_SE_AUDIT_PROCESS_CREATION_INFO",  "ImageFileName"},
-        {SUBSECTION_ControlArea,                       cat_e::REQUIRED, "nt", "_SUBSECTION",                      "ControlArea"},
+        {CLIENT_ID_UniqueThread,                       true,  "_CLIENT_ID",                       "UniqueThread"},
+        {CONTROL_AREA_FilePointer,                     true,  "_CONTROL_AREA",                    "FilePointer"},
+        {DEVICE_OBJECT_DriverObject,                   true,  "_DEVICE_OBJECT",                   "DriverObject"},
+        {DRIVER_OBJECT_DriverName,                     true,  "_DRIVER_OBJECT",                   "DriverName"},
+        {EPROCESS_ActiveProcessLinks,                  true,  "_EPROCESS",                        "ActiveProcessLinks"},
+        {EPROCESS_ImageFileName,                       true,  "_EPROCESS",                        "ImageFileName"},
+        {EPROCESS_InheritedFromUniqueProcessId,        true,  "_EPROCESS",                        "InheritedFromUniqueProcessId"},
+        {EPROCESS_ObjectTable,                         true,  "_EPROCESS",                        "ObjectTable"},
+        {EPROCESS_Pcb,                                 true,  "_EPROCESS",                        "Pcb"},
+        {EPROCESS_Peb,                                 true,  "_EPROCESS",                        "Peb"},
+        {EPROCESS_SeAuditProcessCreationInfo,          true,  "_EPROCESS",                        "SeAuditProcessCreationInfo"},
+        {EPROCESS_ThreadListHead,                      true,  "_EPROCESS",                        "ThreadListHead"},
+        {EPROCESS_UniqueProcessId,                     true,  "_EPROCESS",                        "UniqueProcessId"},
+        {EPROCESS_VadRoot,                             true,  "_EPROCESS",                        "VadRoot"},
+        {EPROCESS_Wow64Process,                        true,  "_EPROCESS",                        "Wow64Process"},
+        {ETHREAD_Cid,                                  true,  "_ETHREAD",                         "Cid"},
+        {ETHREAD_Tcb,                                  true,  "_ETHREAD",                         "Tcb"},
+        {ETHREAD_ThreadListEntry,                      true,  "_ETHREAD",                         "ThreadListEntry"},
+        {EWOW64PROCESS_NtdllType,                      false, "_EWOW64PROCESS",                   "NtdllType"},
+        {EWOW64PROCESS_Peb,                            false, "_EWOW64PROCESS",                   "Peb"},
+        {FILE_OBJECT_DeviceObject,                     true,  "_FILE_OBJECT",                     "DeviceObject"},
+        {FILE_OBJECT_FileName,                         true,  "_FILE_OBJECT",                     "FileName"},
+        {HANDLE_TABLE_TableCode,                       true,  "_HANDLE_TABLE",                    "TableCode"},
+        {KPCR_Prcb,                                    true,  "_KPCR",                            "Prcb"},
+        {KPRCB_CurrentThread,                          true,  "_KPRCB",                           "CurrentThread"},
+        {KPRCB_KernelDirectoryTableBase,               false, "_KPRCB",                           "KernelDirectoryTableBase"},
+        {KPRCB_RspBase,                                true,  "_KPRCB",                           "RspBase"},
+        {KPRCB_RspBaseShadow,                          false, "_KPRCB",                           "RspBaseShadow"},
+        {KPRCB_UserRspShadow,                          false, "_KPRCB",                           "UserRspShadow"},
+        {KPROCESS_DirectoryTableBase,                  true,  "_KPROCESS",                        "DirectoryTableBase"},
+        {KPROCESS_UserDirectoryTableBase,              false, "_KPROCESS",                        "UserDirectoryTableBase"},
+        {KTHREAD_Process,                              true,  "_KTHREAD",                         "Process"},
+        {KTHREAD_TrapFrame,                            true,  "_KTHREAD",                         "TrapFrame"},
+        {KTRAP_FRAME_Rip,                              true,  "_KTRAP_FRAME",                     "Rip"},
+        {KUSER_SHARED_DATA_NtMajorVersion,             true,  "_KUSER_SHARED_DATA",               "NtMajorVersion"},
+        {KUSER_SHARED_DATA_NtMinorVersion,             true,  "_KUSER_SHARED_DATA",               "NtMinorVersion"},
+        {MMVAD_FirstPrototypePte,                      true,  "_MMVAD",                           "FirstPrototypePte"},
+        {MMVAD_SubSection,                             true,  "_MMVAD",                           "Subsection"},
+        {OBJECT_ATTRIBUTES_ObjectName,                 true,  "_OBJECT_ATTRIBUTES",               "ObjectName"},
+        {OBJECT_HEADER_Body,                           true,  "_OBJECT_HEADER",                   "Body"},
+        {OBJECT_HEADER_InfoMask,                       true,  "_OBJECT_HEADER",                   "InfoMask"},
+        {OBJECT_HEADER_TypeIndex,                      true,  "_OBJECT_HEADER",                   "TypeIndex"},
+        {OBJECT_NAME_INFORMATION_Name,                 true,  "_OBJECT_NAME_INFORMATION",         "Name"},
+        {OBJECT_TYPE_Name,                             true,  "_OBJECT_TYPE",                     "Name"},
+        {PEB_Ldr,                                      true,  "_PEB",                             "Ldr"},
+        {PEB32_Ldr,                                    true,  "_PEB32",                           "Ldr"},
+        {POOL_TRACKER_BIG_PAGES_Key,                   false, "_POOL_TRACKER_BIG_PAGES",          "Key"},
+        {POOL_TRACKER_BIG_PAGES_NumberOfBytes,         false, "_POOL_TRACKER_BIG_PAGES",          "NumberOfBytes"},
+        {POOL_TRACKER_BIG_PAGES_Va,                    false, "_POOL_TRACKER_BIG_PAGES",          "Va"},
+        {SE_AUDIT_PROCESS_CREATION_INFO_ImageFileName, true,  "_SE_AUDIT_PROCESS_CREATION_INFO",  "ImageFileName"},
+        {SUBSECTION_ControlArea,                       true,  "_SUBSECTION",                      "ControlArea"},
     };
     // clang-format on
     STATIC_ASSERT_EQ(COUNT_OF(g_offsets), OFFSET_COUNT);
@@ -98,8 +97,11 @@ namespace
         {ObpKernelHandleTable,                  cat_e::REQUIRED, "nt", "ObpKernelHandleTable"},
         {ObpRootDirectoryObject,                cat_e::REQUIRED, "nt", "ObpRootDirectoryObject"},
         {ObTypeIndexTable,                      cat_e::REQUIRED, "nt", "ObTypeIndexTable"},
+        {PoolBigPageTable,                      cat_e::OPTIONAL, "nt", "PoolBigPageTable"},
+        {PoolBigPageTableSize,                  cat_e::OPTIONAL, "nt", "PoolBigPageTableSize"},
         {PsActiveProcessHead,                   cat_e::REQUIRED, "nt", "PsActiveProcessHead"},
         {PsLoadedModuleList,                    cat_e::REQUIRED, "nt", "PsLoadedModuleList"},
+        {PspCidTable,                           cat_e::OPTIONAL, "nt", "PspCidTable"},
         {PspExitProcess,                        cat_e::REQUIRED, "nt", "PspExitProcess"},
         {PspExitThread,                         cat_e::REQUIRED, "nt", "PspExitThread"},
         {PspInsertThread,                       cat_e::REQUIRED, "nt", "PspInsertThread"},
@@ -107,10 +109,96 @@ namespace
     };
     // clang-format on
     static_assert(COUNT_OF(g_symbols) == SYMBOL_COUNT, "invalid symbols");
+
+    constexpr char     tables_magic[4] = {'I', 'B', 'K', 'T'};
+    constexpr uint32_t tables_version  = 1;
+    constexpr uint64_t no_symbol       = ~uint64_t{0};
+
+    struct TablesHeader
+    {
+        char     magic[4];
+        uint32_t version;
+        uint64_t kernel_size;
+    };
+    STATIC_ASSERT_EQ(sizeof(TablesHeader), 16);
+
+    // resolved tables bundled per kernel build next to the symbol
+    // index & unwind caches, keyed by pdb guid; symbol slots are
+    // stored relative to the kernel base so kaslr cannot stale them
+    opt<fs::path> tables_path(const symbols::Identity& id)
+    {
+        const auto path = getenv("_NT_SYMBOL_PATH");
+        if(!path)
+            return {};
+
+        return fs::path(path) / id.name / id.id / "nt.tables";
+    }
+
+    bool load_nt_tables(nt::Os& os, span_t kernel, const symbols::Identity& id)
+    {
+        const auto path = tables_path(id);
+        if(!path)
+            return false;
+
+        auto map = file::Map{};
+        if(!file::map_read(map, *path))
+            return false;
+
+        auto ok                  = false;
+        auto header              = TablesHeader{};
+        constexpr auto slot_size = SYMBOL_COUNT * sizeof(uint64_t);
+        if(map.size == sizeof header + sizeof os.offsets_ + slot_size)
+        {
+            const auto* src = static_cast<const uint8_t*>(map.data);
+            memcpy(&header, src, sizeof header);
+            ok = !memcmp(header.magic, tables_magic, sizeof tables_magic)
+              && header.version == tables_version
+              && header.kernel_size == kernel.size;
+            if(ok)
+            {
+                memcpy(&os.offsets_[0], &src[sizeof header], sizeof os.offsets_);
+                auto slots = std::array<uint64_t, SYMBOL_COUNT>{};
+                memcpy(&slots[0], &src[sizeof header + sizeof os.offsets_], slot_size);
+                os.symbols_ = {};
+                for(size_t i = 0; i < SYMBOL_COUNT; ++i)
+                    if(slots[i] != no_symbol)
+                        os.symbols_[i] = kernel.addr + slots[i];
+            }
+        }
+        file::unmap(map);
+        if(ok)
+            LOG(INFO, "kernel tables reused from %s", path->generic_string().data());
+        return ok;
+    }
+
+    void save_nt_tables(const nt::Os& os, span_t kernel, const symbols::Identity& id)
+    {
+        const auto path = tables_path(id);
+        if(!path)
+            return;
+
+        auto header = TablesHeader{};
+        memcpy(header.magic, tables_magic, sizeof tables_magic);
+        header.version     = tables_version;
+        header.kernel_size = kernel.size;
+
+        auto slots = std::array<uint64_t, SYMBOL_COUNT>{};
+        for(size_t i = 0; i < SYMBOL_COUNT; ++i)
+            slots[i] = os.symbols_[i] ? *os.symbols_[i] - kernel.addr : no_symbol;
+
+        auto buffer = std::vector<uint8_t>(sizeof header + sizeof os.offsets_ + sizeof slots);
+        memcpy(&buffer[0], &header, sizeof header);
+        memcpy(&buffer[sizeof header], &os.offsets_[0], sizeof os.offsets_);
+        memcpy(&buffer[sizeof header + sizeof os.offsets_], &slots[0], sizeof slots);
+        file::write_async(*path, std::move(buffer));
+    }
 }
 
-bool nt::load_kernel_symbols(nt::Os& os)
+bool nt::load_kernel_symbols(nt::Os& os, span_t kernel, const symbols::Identity& id)
 {
+    if(load_nt_tables(os, kernel, id))
+        return true;
+
     bool fail   = false;
     int i       = -1;
     os.symbols_ = {};
@@ -130,22 +218,9 @@ bool nt::load_kernel_symbols(nt::Os& os)
         os.symbols_[i] = *addr;
     }
 
-    i           = -1;
     os.offsets_ = {};
-    for(const auto& off : g_offsets)
-    {
-        fail |= off.e_id != ++i;
-        const auto opt_mb = symbols::read_member(os.core_, symbols::kernel, off.module, off.struc, off.member);
-        if(!opt_mb)
-        {
-            fail |= off.e_cat == cat_e::REQUIRED;
-            if(off.e_cat == cat_e::REQUIRED)
-                LOG(ERROR, "unable to read %s!%s.%s member", off.module, off.struc, off.member);
-            else
-                LOG(WARNING, "unable to read optional %s!%s.%s member", off.module, off.struc, off.member);
-            continue;
-        }
-        os.offsets_[i] = opt_mb->offset;
-    }
+    fail |= !symbols::resolve_offsets(os.core_, symbols::kernel, "nt", g_offsets, OFFSET_COUNT, &os.offsets_[0]);
+    if(!fail)
+        save_nt_tables(os, kernel, id);
     return !fail;
 }
@@ -3,6 +3,9 @@
 #define FDP_MODULE "nt::threads"
 #include "log.hpp"
 
+#include <unordered_map>
+#include <vector>
+
 opt<bpid_t> nt::Os::listen_thread_create(const threads::on_event_fn& on_create)
 {
     const auto bp = state::break_on(core_, "PspInsertThread", *symbols_[PspInsertThread], [=]
@@ -23,13 +26,71 @@ opt<bpid_t> nt::Os::listen_thread_delete(const threads::on_event_fn& on_delete)
     return state::save_breakpoint(core_, bp);
 }
 
+namespace
+{
+    bool list_threads_from_guest(nt::Os& os, proc_t proc, const threads::on_thread_fn& on_thread)
+    {
+        const auto head = proc.id + os.offsets_[EPROCESS_ThreadListHead];
+        return lists::walk(os.lists_, os.io_, head, [&](uint64_t link)
+        {
+            return on_thread({link - os.offsets_[ETHREAD_ThreadListEntry]});
+        });
+    }
+
+    bool load_thread_cache(nt::Os& os)
+    {
+        auto& cache = os.threads_;
+        if(cache.ready)
+            return true;
+
+        // one full guest walk, then thread events keep the table current
+        cache.threads.clear();
+        os.proc_list([&](proc_t proc)
+        {
+            list_threads_from_guest(os, proc, [&](thread_t thread)
+            {
+                cache.threads.emplace(thread.id, proc.id);
+                return walk_e::next;
+            });
+            return walk_e::next;
+        });
+        cache.bp_create = os.listen_thread_create([&os](thread_t thread)
+        {
+            const auto proc = os.thread_proc(thread);
+            if(proc)
+                os.threads_.threads[thread.id] = proc->id;
+        });
+        cache.bp_delete = os.listen_thread_delete([&os](thread_t thread)
+        {
+            os.threads_.threads.erase(thread.id);
+        });
+        cache.ready = cache.bp_create && cache.bp_delete;
+        return cache.ready;
+    }
+}
+
+void nt::forget_proc_threads(nt::Os& os, proc_t proc)
+{
+    for(auto it = os.threads_.threads.begin(); it != os.threads_.threads.end();)
+        if(it->second == proc.id)
+            it = os.threads_.threads.erase(it);
+        else
+            ++it;
+}
+
 bool nt::Os::thread_list(proc_t proc, threads::on_thread_fn on_thread)
 {
-    const auto head = proc.id + offsets_[EPROCESS_ThreadListHead];
-    for(auto link = io_.read(head); link && link != head; link = io_.read(*link))
-        if(on_thread({*link - offsets_[ETHREAD_ThreadListEntry]}) == walk_e::stop)
-            break;
+    if(!load_thread_cache(*this))
+        return list_threads_from_guest(*this, proc, on_thread);
+
+    for(const auto& it : threads_.threads)
+    {
+        if(it.second != proc.id)
+            continue;
 
+        if(on_thread({it.first}) == walk_e::stop)
+            break;
+    }
     return true;
 }
 
@@ -42,6 +103,11 @@ opt<thread_t> nt::Os::thread_current()
     return thread_t{*thread};
 }
 
+opt<uint64_t> nt::Os::thread_current_slot()
+{
+    return kpcr_ + offsets_[KPCR_Prcb] + offsets_[KPRCB_CurrentThread];
+}
+
 opt<proc_t> nt::Os::thread_proc(thread_t thread)
 {
     const auto kproc = io_.read(thread.id + offsets_[KTHREAD_Process]);
@@ -76,3 +142,107 @@ uint64_t nt::Os::thread_id(proc_t /*proc*/, thread_t thread)
 
     return *tid;
 }
+
+opt<thread_t> nt::Os::thread_find(uint64_t tid)
+{
+    if(symbols_[PspCidTable])
+    {
+        const auto ethread = nt::read_cid_object(*this, tid);
+        if(!ethread)
+            return {};
+
+        const auto thread = thread_t{*ethread};
+        if(thread_id({}, thread) != tid)
+            return {};
+
+        return thread;
+    }
+
+    // no cid table on this build, scan every thread list
+    auto found = opt<thread_t>{};
+    proc_list([&](proc_t proc)
+    {
+        thread_list(proc, [&](thread_t thread)
+        {
+            if(thread_id(proc, thread) != tid)
+                return walk_e::next;
+
+            found = thread;
+            return walk_e::stop;
+        });
+        return found ? walk_e::stop : walk_e::next;
+    });
+    return found;
+}
+
+bool nt::Os::thread_list_info(threads::on_info_fn on_info)
+{
+    if(!load_thread_cache(*this))
+    {
+        auto walk = walk_e::next;
+        proc_list([&](proc_t proc)
+        {
+            thread_list(proc, [&](thread_t thread)
+            {
+                walk = on_info(threads::info_t{thread, proc, thread_id(proc, thread), thread_pc(proc, thread).value_or(0)});
+                return walk;
+            });
+            return walk;
+        });
+        return true;
+    }
+
+    // census in two batched read passes: cid & trap frame, then rips
+    struct raw_t
+    {
+        uint64_t ethread;
+        uint64_t eproc;
+        uint64_t tid;
+        uint64_t trap;
+        uint64_t rip;
+    };
+    auto raws = std::vector<raw_t>{};
+    raws.reserve(threads_.threads.size());
+    for(const auto& it : threads_.threads)
+        raws.push_back(raw_t{it.first, it.second, 0, 0, 0});
+
+    auto ranges = std::vector<memory::io_range_t>{};
+    ranges.reserve(raws.size() * 2);
+    for(auto& raw : raws)
+    {
+        ranges.push_back(memory::io_range_t{raw.ethread + offsets_[ETHREAD_Cid] + offsets_[CLIENT_ID_UniqueThread], &raw.tid, sizeof raw.tid});
+        ranges.push_back(memory::io_range_t{raw.ethread + offsets_[ETHREAD_Tcb] + offsets_[KTHREAD_TrapFrame], &raw.trap, sizeof raw.trap});
+    }
+    auto ok = io_.read_many(&ranges[0], ranges.size());
+    if(!ok)
+        LOG(WARNING, "unable to batch-read thread states");
+
+    ranges.clear();
+    for(auto& raw : raws)
+        if(raw.trap)
+            ranges.push_back(memory::io_range_t{raw.trap + offsets_[KTRAP_FRAME_Rip], &raw.rip, sizeof raw.rip});
+    if(!ranges.empty())
+    {
+        ok = io_.read_many(&ranges[0], ranges.size());
+        if(!ok)
+            LOG(WARNING, "unable to batch-read thread rips");
+    }
+
+    auto procs = std::unordered_map<uint64_t, proc_t>{};
+    for(const auto& raw : raws)
+    {
+        auto it = procs.find(raw.eproc);
+        if(it == procs.end())
+        {
+            const auto proc = make_proc(*this, raw.eproc);
+            if(!proc)
+                continue;
+
+            it = procs.emplace(raw.eproc, *proc).first;
+        }
+        const auto walk = on_info(threads::info_t{thread_t{raw.ethread}, it->second, raw.tid, raw.rip});
+        if(walk == walk_e::stop)
+            break;
+    }
+    return true;
+}
@@ -4,6 +4,11 @@
 #include "log.hpp"
 #include "nt.hpp"
 
+#include <array>
+#include <cstring>
+#include <unordered_set>
+#include <vector>
+
 opt<uint64_t> nt::read_vad_root_addr(nt::Os& os, const memory::Io& io, proc_t proc, uint64_t vad_root_offset)
 {
     if(os.NtMajorVersion_ > 6)
@@ -52,31 +57,40 @@ namespace
         return ret;
     }
 
-    bool read_vad(nt::Os& os, vad_t& vad, const memory::Io& io, uint64_t current_vad)
+    size_t vad_node_size(nt::Os& os)
+    {
+        return os.NtMajorVersion_ > 6 ? sizeof(nt::win10::_MMVAD_SHORT) : sizeof(nt::win7::_MMVAD_SHORT);
+    }
+
+    void decode_vad(nt::Os& os, vad_t& vad, const void* src)
     {
         if(os.NtMajorVersion_ > 6)
         {
             auto temp_vad = nt::win10::_MMVAD_SHORT{};
-            auto ok       = io.read_all(&temp_vad, current_vad, sizeof temp_vad);
-            if(!ok)
-                return FAIL(false, "unable to read _MMVAD_SHORT_WIN10");
-
+            memcpy(&temp_vad, src, sizeof temp_vad);
             vad.Left        = temp_vad.VadNode.Left;
             vad.Right       = temp_vad.VadNode.Right;
             vad.StartingVpn = vad_starting(temp_vad).QuadPart;
             vad.EndingVpn   = vad_ending(temp_vad).QuadPart;
-            return true;
+            return;
         }
 
         auto temp_vad = nt::win7::_MMVAD_SHORT{};
-        const auto ok = io.read_all(&temp_vad, current_vad, sizeof temp_vad);
-        if(!ok)
-            return FAIL(false, "unable to read _MMVAD_SHORT_WIN7");
-
+        memcpy(&temp_vad, src, sizeof temp_vad);
         vad.Left        = temp_vad.LeftChild;
         vad.Right       = temp_vad.RightChild;
         vad.StartingVpn = temp_vad.StartingVpn;
         vad.EndingVpn   = temp_vad.EndingVpn;
+    }
+
+    bool read_vad(nt::Os& os, vad_t& vad, const memory::Io& io, uint64_t current_vad)
+    {
+        auto buffer   = std::array<uint8_t, 0x100>{};
+        const auto ok = io.read_all(&buffer[0], current_vad, vad_node_size(os));
+        if(!ok)
+            return FAIL(false, "unable to read _MMVAD_SHORT");
+
+        decode_vad(os, vad, &buffer[0]);
         return true;
     }
 
@@ -107,6 +121,59 @@ namespace
         return span_t{vad.StartingVpn << 12, ((vad.EndingVpn - vad.StartingVpn) + 1) << 12};
     }
 
+    // fetch one tree level per read_many batch instead of one guest
+    // read per node, visited guard protects against corrupt trees
+    bool load_vad_level(nt::Os& os, const memory::Io& io, nt::VadTree& tree, std::unordered_set<uint64_t>& seen, std::vector<uint64_t>& level, std::vector<uint64_t>& next)
+    {
+        const auto node_size = vad_node_size(os);
+        auto buffer          = std::vector<uint8_t>(node_size * level.size());
+        auto ranges          = std::vector<memory::io_range_t>(level.size());
+        for(size_t i = 0; i < level.size(); ++i)
+            ranges[i] = memory::io_range_t{level[i], &buffer[i * node_size], node_size};
+
+        const auto ok = io.read_many(&ranges[0], ranges.size());
+        if(!ok)
+            return FAIL(false, "unable to read vad nodes");
+
+        auto vad = vad_t{};
+        for(size_t i = 0; i < level.size(); ++i)
+        {
+            decode_vad(os, vad, &buffer[i * node_size]);
+            tree.spans[vad.StartingVpn] = nt::VadEntry{level[i], vad.EndingVpn};
+            if(vad.Left && seen.insert(vad.Left).second)
+                next.push_back(vad.Left);
+            if(vad.Right && seen.insert(vad.Right).second)
+                next.push_back(vad.Right);
+        }
+        return true;
+    }
+
+    const nt::VadTree* load_vad_cache(nt::Os& os, proc_t proc)
+    {
+        const auto it = os.vads_.find(proc.id);
+        if(it != os.vads_.end())
+            return &it->second;
+
+        const auto io       = memory::make_io(os.core_, proc);
+        const auto vad_root = nt::read_vad_root_addr(os, io, proc, os.offsets_[EPROCESS_VadRoot]);
+        if(!vad_root || !*vad_root)
+            return nullptr;
+
+        auto tree  = nt::VadTree{};
+        auto seen  = std::unordered_set<uint64_t>{{*vad_root}};
+        auto level = std::vector<uint64_t>{*vad_root};
+        auto next  = std::vector<uint64_t>{};
+        while(!level.empty())
+        {
+            next.clear();
+            if(!load_vad_level(os, io, tree, seen, level, next))
+                return nullptr;
+
+            std::swap(level, next);
+        }
+        return &(os.vads_[proc.id] = std::move(tree));
+    }
+
     bool rec_walk_vad_tree(nt::Os& os, const memory::Io& io, proc_t proc, uint64_t current_vad, uint32_t level, const vm_area::on_vm_area_fn& on_vm_area)
     {
         auto vad      = vad_t{};
@@ -132,6 +199,14 @@ namespace
 
 bool nt::Os::vm_area_list(proc_t proc, vm_area::on_vm_area_fn on_vm_area)
 {
+    if(const auto* tree = load_vad_cache(*this, proc))
+    {
+        for(const auto& it : tree->spans)
+            if(on_vm_area(vm_area_t{it.second.vad}) == walk_e::stop)
+                break;
+        return true;
+    }
+
     const auto io       = memory::make_io(core_, proc);
     const auto vad_root = read_vad_root_addr(*this, io, proc, offsets_[EPROCESS_VadRoot]);
     if(!vad_root)
@@ -142,6 +217,20 @@ bool nt::Os::vm_area_list(proc_t proc, vm_area::on_vm_area_fn on_vm_area)
 
 opt<vm_area_t> nt::Os::vm_area_find(proc_t proc, uint64_t addr)
 {
+    if(const auto* tree = load_vad_cache(*this, proc))
+    {
+        const auto vpn = addr >> 12;
+        auto it        = tree->spans.upper_bound(vpn);
+        if(it == tree->spans.begin())
+            return {};
+
+        --it;
+        if(vpn > it->second.ending_vpn)
+            return {};
+
+        return vm_area_t{it->second.vad};
+    }
+
     const auto io       = memory::make_io(core_, proc);
     const auto vad_root = read_vad_root_addr(*this, io, proc, offsets_[EPROCESS_VadRoot]);
     if(!vad_root)
@@ -154,6 +243,11 @@ opt<vm_area_t> nt::Os::vm_area_find(proc_t proc, uint64_t addr)
     return vm_area_t{vad};
 }
 
+void nt::Os::vm_area_refresh(proc_t proc)
+{
+    vads_.erase(proc.id);
+}
+
 opt<span_t> nt::Os::vm_area_span(proc_t proc, vm_area_t vm_area)
 {
     const auto io = memory::make_io(core_, proc);
@@ -5,3 +5,57 @@
 #define nt_namespace wow64
 #define WOW64
 #include "nt_arch.hpp"
+
+#include "icebox/memory.hpp"
+#include "nt.hpp"
+
+// compile-time bitness traits: decoders templated on one of these fold
+// the pointer width and every field offset into their instantiation, so
+// a walk selects its arch once instead of re-branching on every node
+namespace nt_arch
+{
+    struct x64
+    {
+        using ptr_t                = nt::ptr_t;
+        using PEB_LDR_DATA         = nt::_PEB_LDR_DATA;
+        using LDR_DATA_TABLE_ENTRY = nt::_LDR_DATA_TABLE_ENTRY;
+
+        static constexpr flags_t arch_flags = flags::x64;
+
+        static opt<uint64_t> read_ptr(const memory::Io& io, uint64_t ptr)
+        {
+            return io.read(ptr);
+        }
+
+        static opt<std::string> read_unicode(const memory::Io& io, uint64_t addr)
+        {
+            return nt::read_unicode_string(io, addr);
+        }
+    };
+
+    struct x86
+    {
+        using ptr_t                = wow64::ptr_t;
+        using PEB_LDR_DATA         = wow64::_PEB_LDR_DATA;
+        using LDR_DATA_TABLE_ENTRY = wow64::_LDR_DATA_TABLE_ENTRY;
+
+        static constexpr flags_t arch_flags = flags::x86;
+
+        static opt<uint64_t> read_ptr(const memory::Io& io, uint64_t ptr)
+        {
+            return io.le32(ptr);
+        }
+
+        static opt<std::string> read_unicode(const memory::Io& io, uint64_t addr)
+        {
+            return wow64::read_unicode_string(io, addr);
+        }
+    };
+
+    // field offsets truncated to the arch pointer width at compile time
+    template <typename Arch>
+    constexpr uint64_t truncate(size_t offset)
+    {
+        return static_cast<typename Arch::ptr_t>(offset);
+    }
+} // namespace nt_arch
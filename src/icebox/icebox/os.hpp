@@ -11,6 +11,9 @@ namespace os
     bool        read_page           (core::Core& core, void* dst, uint64_t ptr, proc_t* proc, dtb_t dtb);
     bool        write_page          (core::Core& core, uint64_t dst, const void* src, proc_t* proc, dtb_t dtb);
     opt<phy_t>  virtual_to_physical (core::Core& core, proc_t* proc, dtb_t dtb, uint64_t ptr);
+    opt<phy_t>  virtual_to_physical_walk(core::Core& core, proc_t* proc, dtb_t dtb, uint64_t ptr);
+    bool        residency_map       (core::Core& core, proc_t* proc, dtb_t dtb, span_t span, uint8_t* states);
+    size_t      page_in             (core::Core& core, proc_t proc, span_t span);
     void        debug_print         (core::Core&);
     bool        check_flags         (flags_t got, flags_t want);
 } // namespace os
@@ -0,0 +1,86 @@
+#include "coverage.hpp"
+
+#define FDP_MODULE "coverage"
+#include "core.hpp"
+#include "log.hpp"
+#include "tracer/tracer.hpp"
+
+#include <unordered_map>
+
+namespace
+{
+    using Blocks = std::unordered_map<uint64_t, state::Breakpoint>;
+    using Data   = plugins::Coverage::Data;
+
+    // hit records are self-describing in the trace, see binlog.cpp
+    constexpr tracer::callcfg_t g_block_hit = {"coverage_block", 1, {{"UINT64", "Address", sizeof(uint64_t)}}};
+}
+
+struct plugins::Coverage::Data
+{
+    Data(core::Core& core, proc_t proc);
+
+    core::Core&    core_;
+    proc_t         proc_;
+    tracer::Binlog log_;
+    Blocks         blocks_;
+    size_t         hits_;
+};
+
+plugins::Coverage::Data::Data(core::Core& core, proc_t proc)
+    : core_(core)
+    , proc_(proc)
+    , hits_()
+{
+}
+
+plugins::Coverage::Coverage(core::Core& core, proc_t proc, const fs::path& trace)
+    : d_(std::make_unique<Data>(core, proc))
+{
+    tracer::open_binlog(d_->log_, trace);
+}
+
+plugins::Coverage::~Coverage() = default;
+
+namespace
+{
+    void on_block_hit(Data& d, uint64_t addr)
+    {
+        const auto arg = addr;
+        tracer::log_event_with(d.log_, d.core_, g_block_hit, &arg);
+        ++d.hits_;
+        // one-shot: the vm is already paused on this block, dropping the
+        // breakpoint here costs no extra round trip & the block is free
+        // from now on
+        d.blocks_.erase(addr);
+    }
+}
+
+size_t plugins::Coverage::add_blocks(const uint64_t* addrs, size_t count)
+{
+    auto&       d     = *d_;
+    auto*       pd    = d_.get();
+    auto        added = size_t{};
+    for(size_t i = 0; i < count; ++i)
+    {
+        const auto addr = addrs[i];
+        if(d.blocks_.count(addr))
+            continue;
+
+        const auto bp = state::break_on_process(d.core_, "coverage_block", d.proc_, addr, [=]
+        {
+            on_block_hit(*pd, addr);
+        });
+        if(!bp)
+            continue;
+
+        d.blocks_.emplace(addr, bp);
+        ++added;
+    }
+    return added;
+}
+
+size_t plugins::Coverage::hits() const
+{
+    return d_->hits_;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "icebox/types.hpp"
+
+#include <memory>
+
+namespace core { struct Core; }
+
+namespace plugins
+{
+    // one-shot basic-block coverage: software breakpoints are placed on
+    // block entries supplied by static analysis, every hit streams into
+    // the binary trace & removes its own breakpoint, so steady-state
+    // overhead vanishes as coverage saturates
+    struct Coverage
+    {
+         Coverage(core::Core& core, proc_t proc, const fs::path& trace);
+        ~Coverage();
+
+        size_t add_blocks   (const uint64_t* addrs, size_t count);
+        size_t hits         () const;
+
+        struct Data;
+        std::unique_ptr<Data> d_;
+    };
+} // namespace plugins
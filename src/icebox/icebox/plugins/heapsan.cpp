@@ -1,6 +1,7 @@
 #include "heapsan.hpp"
 
 #define FDP_MODULE "heapsan"
+#include "callstacks.hpp"
 #include "core.hpp"
 #include "log.hpp"
 #include "nt/nt.hpp"
@@ -8,7 +9,14 @@
 #include "utils/hash.hpp"
 #include "utils/utils.hpp"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <map>
+#include <memory>
+#include <vector>
+#include "utils/small_vector.hpp"
+
 #include <unordered_map>
 #include <unordered_set>
 
@@ -26,17 +34,6 @@ namespace
                && a.HeapHandle == b.HeapHandle;
     }
 
-    struct heap_t
-    {
-        nt::PVOID HeapHandle;
-        nt::PVOID BaseAddress;
-    };
-
-    inline bool operator==(const heap_t& a, const heap_t& b)
-    {
-        return a.HeapHandle == b.HeapHandle
-               && a.BaseAddress == b.BaseAddress;
-    }
 }
 
 namespace std
@@ -51,27 +48,101 @@ namespace std
             return seed;
         }
     };
-
-    template <>
-    struct hash<heap_t>
-    {
-        size_t operator()(const heap_t& arg) const
-        {
-            size_t seed = 0;
-            ::hash::combine(seed, arg.HeapHandle, arg.BaseAddress);
-            return seed;
-        }
-    };
 } // namespace std
 
 namespace
 {
     using Reallocs = std::unordered_set<realloc_t>;
-    using Heaps    = std::unordered_set<heap_t>;
     using Data     = plugins::HeapSan::Data;
 
     constexpr size_t ptr_prolog = 0x20;
     constexpr size_t ptr_epilog = 0x20;
+
+    // sparse shadow over the guest address space: a top-level table maps
+    // 2mb regions to bit blocks, one bit per 16-byte granule, so tracking
+    // a pointer is one region lookup & a bit test whatever the allocation
+    // count; heap segments never share a region, which makes destroying
+    // a whole heap a matter of dropping its blocks
+    constexpr uint64_t region_bits = 21;
+    constexpr uint64_t granule     = 16; // heap allocation alignment
+
+    struct ShadowBlock
+    {
+        uint64_t                                              heap;
+        std::array<uint64_t, (1ull << region_bits) / granule / 64> bits;
+    };
+
+    struct Shadow
+    {
+        std::unordered_map<uint64_t, std::unique_ptr<ShadowBlock>> regions;
+    };
+
+    uint64_t shadow_slot(uint64_t addr)
+    {
+        return (addr & ((1ull << region_bits) - 1)) / granule;
+    }
+
+    void shadow_set(Shadow& s, uint64_t heap, uint64_t addr)
+    {
+        auto& block = s.regions[addr >> region_bits];
+        if(!block)
+        {
+            block       = std::make_unique<ShadowBlock>();
+            block->heap = heap;
+        }
+        const auto slot = shadow_slot(addr);
+        block->bits[slot >> 6] |= 1ull << (slot & 63);
+    }
+
+    bool shadow_test(const Shadow& s, uint64_t heap, uint64_t addr)
+    {
+        const auto it = s.regions.find(addr >> region_bits);
+        if(it == s.regions.end() || it->second->heap != heap)
+            return false;
+
+        const auto slot = shadow_slot(addr);
+        return !!(it->second->bits[slot >> 6] & 1ull << (slot & 63));
+    }
+
+    void shadow_clear(Shadow& s, uint64_t addr)
+    {
+        const auto it = s.regions.find(addr >> region_bits);
+        if(it == s.regions.end())
+            return;
+
+        const auto slot = shadow_slot(addr);
+        it->second->bits[slot >> 6] &= ~(1ull << (slot & 63));
+    }
+
+    void shadow_destroy(Shadow& s, uint64_t heap)
+    {
+        for(auto it = s.regions.begin(); it != s.regions.end();)
+            it = it->second->heap == heap ? s.regions.erase(it) : std::next(it);
+    }
+
+    // profile mode: per-callsite aggregates keyed by interned stack id
+    struct SiteStats
+    {
+        uint64_t count       = 0; // completed allocations
+        uint64_t bytes       = 0; // total requested bytes
+        uint64_t live        = 0;
+        uint64_t live_bytes  = 0;
+        uint64_t freed       = 0;
+        uint64_t lifetime_ns = 0; // summed alloc-to-free over freed blocks
+    };
+
+    struct LiveAlloc
+    {
+        uint64_t stack_id;
+        uint64_t size;
+        uint64_t time;
+    };
+
+    using Sites = std::unordered_map<uint64_t, SiteStats>;
+    using Lives = std::unordered_map<uint64_t, LiveAlloc>; // keyed by guest pointer
+
+    // attribution needs only the top frames, see read_partial
+    constexpr size_t max_profile_depth = 16;
 }
 
 struct plugins::HeapSan::Data
@@ -81,8 +152,10 @@ struct plugins::HeapSan::Data
     core::Core& core_;
     nt::heaps   tracer_;
     Reallocs    reallocs_;
-    Heaps       heaps_;
+    Shadow      shadow_;
     proc_t      target_;
+    Sites       sites_;
+    Lives       lives_;
 };
 
 Data::Data(core::Core& core, proc_t target)
@@ -123,24 +196,27 @@ namespace
             if(!ok)
                 return;
 
-            d.heaps_.emplace(heap_t{HeapHandle, new_ptr});
+            shadow_set(d.shadow_, HeapHandle, new_ptr);
         });
     }
 
+    void on_RtlDestroyHeap(Data& d, nt::PVOID HeapHandle)
+    {
+        shadow_destroy(d.shadow_, HeapHandle);
+    }
+
     void on_RtlFreeHeap(Data& d, nt::PVOID HeapHandle, nt::ULONG /*Flags*/, nt::PVOID BaseAddress)
     {
-        const auto it = d.heaps_.find(heap_t{HeapHandle, BaseAddress});
-        if(it == d.heaps_.end())
+        if(!shadow_test(d.shadow_, HeapHandle, BaseAddress))
             return;
 
         functions::write_arg(d.core_, 2, {BaseAddress - ptr_prolog});
-        d.heaps_.erase(it);
+        shadow_clear(d.shadow_, BaseAddress);
     }
 
     void on_RtlSizeHeap(Data& d, nt::PVOID HeapHandle, nt::ULONG /*Flags*/, nt::PVOID BaseAddress)
     {
-        const auto it = d.heaps_.find(heap_t{HeapHandle, BaseAddress});
-        if(it == d.heaps_.end())
+        if(!shadow_test(d.shadow_, HeapHandle, BaseAddress))
             return;
 
         const auto ok = functions::write_arg(d.core_, 2, {BaseAddress - ptr_prolog});
@@ -161,8 +237,7 @@ namespace
 
     void on_RtlGetUserInfoHeap(Data& d, nt::PVOID HeapHandle, nt::ULONG /*Flags*/, nt::PVOID BaseAddress)
     {
-        const auto it = d.heaps_.find(heap_t{HeapHandle, BaseAddress});
-        if(it == d.heaps_.end())
+        if(!shadow_test(d.shadow_, HeapHandle, BaseAddress))
             return;
 
         functions::write_arg(d.core_, 2, {BaseAddress - ptr_prolog});
@@ -170,8 +245,7 @@ namespace
 
     void on_RtlSetUserValueHeap(Data& d, nt::PVOID HeapHandle, nt::ULONG /*Flags*/, nt::PVOID BaseAddress)
     {
-        const auto it = d.heaps_.find(heap_t{HeapHandle, BaseAddress});
-        if(it == d.heaps_.end())
+        if(!shadow_test(d.shadow_, HeapHandle, BaseAddress))
             return;
 
         functions::write_arg(d.core_, 2, {BaseAddress - ptr_prolog});
@@ -198,8 +272,7 @@ namespace
         if(!BaseAddress)
             return;
 
-        const auto it = d.heaps_.find(heap_t{HeapHandle, BaseAddress});
-        if(it == d.heaps_.end())
+        if(!shadow_test(d.shadow_, HeapHandle, BaseAddress))
             return realloc_unknown_pointer(d, HeapHandle, Flags, BaseAddress, Size);
 
         const auto thread = threads::current(d.core_);
@@ -220,7 +293,7 @@ namespace
         d.reallocs_.insert(realloc_t{*thread, HeapHandle});
 
         // remove pointer from heap because it can be freed with original value
-        d.heaps_.erase(it);
+        shadow_clear(d.shadow_, BaseAddress);
         const auto pdata = &d;
         functions::break_on_return(d.core_, "return RtlpReAllocateHeapInternal known", [=]
         {
@@ -232,17 +305,72 @@ namespace
 
             // store new pointer which always have prolog
             const auto new_ptr = ptr + ptr_prolog;
-            d.heaps_.emplace(heap_t{HeapHandle, new_ptr});
+            shadow_set(d.shadow_, HeapHandle, new_ptr);
             registers::write(d.core_, reg_e::rax, new_ptr);
         });
     }
 
+    uint64_t now_ns()
+    {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    }
+
+    uint64_t alloc_site(Data& d)
+    {
+        auto callers = utils::small_vector<callstacks::caller_t, max_profile_depth>(max_profile_depth);
+        const auto n = callstacks::read_partial(d.core_, &callers[0], callers.size(), d.target_, {max_profile_depth, false, false});
+        return callstacks::intern(d.core_, d.target_, &callers[0], n);
+    }
+
+    void profile_alloc(Data& d, nt::SIZE_T Size)
+    {
+        const auto site  = alloc_site(d);
+        const auto pdata = &d;
+        functions::break_on_return(d.core_, "return RtlpAllocateHeapInternal profile", [=]
+        {
+            auto& d        = *pdata;
+            const auto ptr = registers::read(d.core_, reg_e::rax);
+            if(!ptr)
+                return;
+
+            auto& stats = d.sites_[site];
+            stats.count++;
+            stats.bytes += Size;
+            stats.live++;
+            stats.live_bytes += Size;
+            d.lives_[ptr] = LiveAlloc{site, Size, now_ns()};
+        });
+    }
+
+    void profile_free(Data& d, nt::PVOID BaseAddress)
+    {
+        const auto it = d.lives_.find(BaseAddress);
+        if(it == d.lives_.end())
+            return;
+
+        auto& stats = d.sites_[it->second.stack_id];
+        stats.live--;
+        stats.live_bytes -= it->second.size;
+        stats.freed++;
+        stats.lifetime_ns += now_ns() - it->second.time;
+        d.lives_.erase(it);
+    }
+
+    void profile_realloc(Data& d, nt::PVOID BaseAddress, nt::ULONG Size)
+    {
+        // a realloc frees the old block & allocates from the same site
+        if(BaseAddress)
+            profile_free(d, BaseAddress);
+        profile_alloc(d, Size);
+    }
+
     void get_callstack(Data& d)
     {
         if(true)
             return;
 
-        auto callers = std::vector<callstacks::caller_t>(128);
+        auto callers = utils::small_vector<callstacks::caller_t, 128>(128);
         const auto n = callstacks::read(d.core_, &callers[0], callers.size(), d.target_);
         for(size_t i = 0; i < n; ++i)
         {
@@ -254,15 +382,47 @@ namespace
 }
 
 plugins::HeapSan::HeapSan(core::Core& core, proc_t target)
+    : HeapSan(core, target, mode_e::redzones)
+{
+}
+
+plugins::HeapSan::HeapSan(core::Core& core, proc_t target, mode_e mode)
     : d_(std::make_unique<Data>(core, target))
 {
     auto& d = *d_;
+    if(mode == mode_e::profile)
+    {
+        // no padding writes, the guest heap layout is left untouched
+        d.tracer_.register_RtlpAllocateHeapInternal(d.target_, [=](nt::PVOID /*HeapHandle*/, nt::SIZE_T Size)
+        {
+            profile_alloc(*d_, Size);
+            return 0;
+        });
+        d.tracer_.register_RtlFreeHeap(d.target_, [=](nt::PVOID /*HeapHandle*/, nt::ULONG /*Flags*/, nt::PVOID BaseAddress)
+        {
+            profile_free(*d_, BaseAddress);
+            return 0;
+        });
+        d.tracer_.register_RtlpReAllocateHeapInternal(d.target_, [=](nt::PVOID /*HeapHandle*/, nt::ULONG /*Flags*/, nt::PVOID BaseAddress, nt::ULONG Size)
+        {
+            profile_realloc(*d_, BaseAddress, Size);
+            return 0;
+        });
+        return;
+    }
+
     d.tracer_.register_RtlpAllocateHeapInternal(d.target_, [=](nt::PVOID HeapHandle, nt::SIZE_T Size)
     {
         get_callstack(*d_);
         on_RtlpAllocateHeapInternal(*d_, HeapHandle, Size);
         return 0;
     });
+    d.tracer_.register_RtlDestroyHeap(d.target_, [=](nt::PVOID HeapHandle)
+    {
+        get_callstack(*d_);
+        on_RtlDestroyHeap(*d_, HeapHandle);
+        return 0;
+    });
     d.tracer_.register_RtlFreeHeap(d.target_, [=](nt::PVOID HeapHandle, nt::ULONG Flags, nt::PVOID BaseAddress)
     {
         get_callstack(*d_);
@@ -294,3 +454,27 @@ plugins::HeapSan::HeapSan(core::Core& core, proc_t target)
         return 0;
     });
 }
+
+void plugins::HeapSan::report(size_t top_n)
+{
+    auto& d     = *d_;
+    auto sorted = std::vector<std::pair<uint64_t, SiteStats>>{d.sites_.begin(), d.sites_.end()};
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b)
+    {
+        return a.second.bytes > b.second.bytes;
+    });
+    if(sorted.size() > top_n)
+        sorted.resize(top_n);
+    for(const auto& [site, stats] : sorted)
+    {
+        const auto avg_us = stats.freed ? stats.lifetime_ns / stats.freed / 1000 : 0;
+        LOG(INFO, "%" PRIu64 " allocs %" PRIu64 " bytes, %" PRIu64 " live %" PRIu64 " bytes, avg lifetime %" PRIu64 " us",
+            stats.count, stats.bytes, stats.live, stats.live_bytes, avg_us);
+        const auto* frames = callstacks::symbolized(d.core_, site);
+        if(!frames)
+            continue;
+
+        for(size_t i = 0; i < frames->size() && i < 4; ++i)
+            LOG(INFO, "  %s", (*frames)[i].data());
+    }
+}
@@ -10,9 +10,19 @@ namespace plugins
 {
     struct HeapSan
     {
+        enum class mode_e
+        {
+            redzones, // pad allocations & poison redzones
+            profile,  // per-callsite statistics only, no guest writes
+        };
+
          HeapSan(core::Core& core, proc_t target);
+         HeapSan(core::Core& core, proc_t target, mode_e mode);
         ~HeapSan();
 
+        // log the top-n allocation callsites, profile mode only
+        void report(size_t top_n);
+
         struct Data;
         std::unique_ptr<Data> d_;
     };
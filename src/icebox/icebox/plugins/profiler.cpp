@@ -0,0 +1,135 @@
+#include "profiler.hpp"
+
+#define FDP_MODULE "profiler"
+#include "core.hpp"
+#include "log.hpp"
+#include "utils/file.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr size_t max_depth = 128;
+
+    using Data = plugins::Profiler::Data;
+}
+
+// stacks are folded into a trie: every node is one frame under its
+// parent path, only leaf counters move on the hot path and frames are
+// interned so captures in the steady state allocate nothing
+struct plugins::Profiler::Data
+{
+    Data(core::Core& core, proc_t proc);
+
+    core::Core& core_;
+    proc_t      proc_;
+
+    // interned frames, id is the index in frames_
+    std::unordered_map<uint64_t, uint32_t> frame_ids_;
+    std::vector<uint64_t>                  frames_;
+
+    // trie nodes, children keyed on parent node id & frame id
+    std::unordered_map<uint64_t, uint32_t> children_;
+    std::vector<uint64_t>                  counts_;
+    std::vector<uint32_t>                  parents_;
+    std::vector<uint32_t>                  node_frames_;
+
+    // capture buffer reused across hits
+    std::vector<callstacks::caller_t> callers_;
+};
+
+plugins::Profiler::Data::Data(core::Core& core, proc_t proc)
+    : core_(core)
+    , proc_(proc)
+    , counts_(1)
+    , parents_(1)
+    , node_frames_(1)
+    , callers_(max_depth)
+{
+}
+
+plugins::Profiler::Profiler(core::Core& core, proc_t proc)
+    : d_(std::make_unique<Data>(core, proc))
+{
+}
+
+plugins::Profiler::~Profiler() = default;
+
+namespace
+{
+    uint32_t intern_frame(Data& d, uint64_t addr)
+    {
+        const auto it = d.frame_ids_.find(addr);
+        if(it != d.frame_ids_.end())
+            return it->second;
+
+        const auto id = static_cast<uint32_t>(d.frames_.size());
+        d.frames_.push_back(addr);
+        d.frame_ids_.emplace(addr, id);
+        return id;
+    }
+
+    uint32_t walk_child(Data& d, uint32_t node, uint32_t frame)
+    {
+        const auto key = uint64_t{node} << 32 | frame;
+        const auto it  = d.children_.find(key);
+        if(it != d.children_.end())
+            return it->second;
+
+        const auto child = static_cast<uint32_t>(d.counts_.size());
+        d.counts_.push_back(0);
+        d.parents_.push_back(node);
+        d.node_frames_.push_back(frame);
+        d.children_.emplace(key, child);
+        return child;
+    }
+}
+
+bool plugins::Profiler::hit()
+{
+    auto& d      = *d_;
+    const auto n = callstacks::read(d.core_, &d.callers_[0], d.callers_.size(), d.proc_);
+    if(!n)
+        return false;
+
+    // callers come leaf-first, the trie is walked from the root
+    auto node = uint32_t{0};
+    for(auto i = n; i-- > 0;)
+        node = walk_child(d, node, intern_frame(d, d.callers_[i].addr));
+
+    ++d.counts_[node];
+    return true;
+}
+
+bool plugins::Profiler::generate(const fs::path& file_name)
+{
+    auto& d = *d_;
+
+    // symbolication is deferred to the dump, off the capture path
+    auto names = std::vector<std::string>(d.frames_.size());
+    for(size_t i = 0; i < d.frames_.size(); ++i)
+        names[i] = symbols::string(d.core_, d.proc_, d.frames_[i]);
+
+    auto out   = std::string{};
+    auto stack = std::vector<uint32_t>{};
+    for(size_t node = 1; node < d.counts_.size(); ++node)
+    {
+        if(!d.counts_[node])
+            continue;
+
+        stack.clear();
+        for(auto n = static_cast<uint32_t>(node); n; n = d.parents_[n])
+            stack.push_back(d.node_frames_[n]);
+
+        for(auto it = stack.rbegin(); it != stack.rend(); ++it)
+        {
+            out += names[*it];
+            out += it + 1 != stack.rend() ? ";" : " ";
+        }
+        out += std::to_string(d.counts_[node]);
+        out += '\n';
+    }
+    return file::write(file_name, out.data(), out.size());
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "icebox/types.hpp"
+
+#include <memory>
+
+namespace core { struct Core; }
+
+namespace plugins
+{
+    // in-process flamegraph aggregation: hit() captures the current
+    // callstack & folds it into a counted trie, generate() writes the
+    // counts in folded-stack format
+    struct Profiler
+    {
+         Profiler(core::Core& core, proc_t proc);
+        ~Profiler();
+
+        bool hit        ();
+        bool generate   (const fs::path& file_name);
+
+        struct Data;
+        std::unique_ptr<Data> d_;
+    };
+} // namespace plugins
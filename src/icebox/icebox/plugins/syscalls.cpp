@@ -8,6 +8,8 @@
 #include "utils/file.hpp"
 #include "utils/pe.hpp"
 
+#include "utils/arena.hpp"
+
 #include <nlohmann/json.hpp>
 
 namespace
@@ -129,7 +131,7 @@ bool Data::setup()
                                               nt::PIO_STATUS_BLOCK /*IoStatusBlock*/, nt::PVOID Buffer, nt::ULONG Length,
                                               nt::PLARGE_INTEGER /*ByteOffsetm*/, nt::PULONG /*Key*/)
     {
-        std::vector<char> buf(Length);
+        auto buf = arena::vector<char>(Length);
         const auto io = memory::make_io(core_, proc_);
         const auto ok = io.read_all(&buf[0], Buffer, Length);
         if(!ok)
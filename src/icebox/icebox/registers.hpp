@@ -7,6 +7,17 @@ namespace core { struct Core; }
 
 namespace registers
 {
+    // full register file read in a single command round trip
+    struct snapshot_t
+    {
+        uint64_t rip, rax, rcx, rdx, rbx, rsp, rbp, rsi, rdi;
+        uint64_t r8, r9, r10, r11, r12, r13, r14, r15;
+        uint64_t es, cs, ss, ds, fs, gs;
+        uint64_t rflags, cr0, cr2, cr3, cr4;
+        uint64_t lstar, gs_base, kernel_gs_base, tsc;
+    };
+
+    opt<snapshot_t>     snapshot    (core::Core& core);
     uint64_t            read        (core::Core& core, reg_e reg);
     bool                write       (core::Core& core, reg_e reg, uint64_t value);
     std::string_view    to_string   (reg_e reg);
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "enums.hpp"
+#include "types.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace core { struct Core; }
+
+namespace scanner
+{
+    struct pattern_t
+    {
+        std::vector<uint8_t> bytes;
+        std::vector<uint8_t> mask; // empty for exact matches, else one byte per pattern byte
+    };
+
+    struct match_t
+    {
+        phy_t  phy;     // physical address of the first matched byte
+        size_t pattern; // index into the input patterns
+    };
+
+    using on_match_fn = std::function<walk_e(match_t)>;
+
+    // scan the whole physical memory once & report every pattern hit
+    bool scan_physical(core::Core& core, const std::vector<pattern_t>& patterns, const on_match_fn& on_match);
+} // namespace scanner
@@ -1,10 +1,14 @@
 #pragma once
 
+#include "registers.hpp"
 #include "types.hpp"
 
+#include <array>
 #include <functional>
 #include <memory>
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 namespace core { struct Core; }
 
@@ -14,6 +18,15 @@ namespace state
     struct BreakpointPrivate;
     using Breakpoint = std::shared_ptr<BreakpointPrivate>;
 
+    // breakpoint set armed & disarmed as one batch
+    struct BreakpointGroupPrivate;
+    using BreakpointGroup = std::shared_ptr<BreakpointGroupPrivate>;
+
+    // compiled run_to targets, translations & breakpoints
+    // stay cached across invocations
+    struct TargetSetPrivate;
+    using TargetSet = std::shared_ptr<TargetSetPrivate>;
+
     enum bp_cr3_e
     {
         BP_CR3_ON_WRITINGS,
@@ -26,19 +39,82 @@ namespace state
     bool        pause                       (core::Core& core);
     bool        resume                      (core::Core& core);
     bool        single_step                 (core::Core& core);
+    // step count instructions or stop at until, return the final context
+    opt<registers::snapshot_t> step_many    (core::Core& core, uint64_t count, opt<uint64_t> until);
     bool        wait                        (core::Core& core);
     bool        save                        (core::Core& core);
     bool        restore                     (core::Core& core);
+    // flight recorder: refresh the incremental snapshot every interval
+    // breakpoint events, bounding how far a rewind must replay; 0 disables
+    void        flight_recorder             (core::Core& core, uint64_t interval);
+    // restore the latest snapshot & replay forward, pausing just before
+    // the n-th most recent event; returns the number of events replayed
+    opt<uint64_t> rewind                    (core::Core& core, uint64_t events);
     void        wait_for                    (core::Core& core, int timeout_ms);
     void        exec                        (core::Core& core);
+    // drain pending events & run observers, never blocks past timeout_ms
+    bool        poll                        (core::Core& core, int timeout_ms);
+    // select()-able fd signaled while events are pending, -1 when unsupported
+    int         wait_fd                     (core::Core& core);
     Breakpoint  break_on                    (core::Core& core, std::string_view name, uint64_t ptr, const Task& task);
     Breakpoint  break_on_process            (core::Core& core, std::string_view name, proc_t proc, uint64_t ptr, const Task& task);
     Breakpoint  break_on_thread             (core::Core& core, std::string_view name, thread_t thread, uint64_t ptr, const Task& task);
+    // one-shot variants expire on first hit, disarmed server-side when
+    // supported so no unset round-trip nor duplicate-hit handling
+    Breakpoint  break_on_once               (core::Core& core, std::string_view name, uint64_t ptr, const Task& task);
+    Breakpoint  break_on_process_once       (core::Core& core, std::string_view name, proc_t proc, uint64_t ptr, const Task& task);
+    Breakpoint  break_on_thread_once        (core::Core& core, std::string_view name, thread_t thread, uint64_t ptr, const Task& task);
     Breakpoint  break_on_physical           (core::Core& core, std::string_view name, phy_t phy, const Task& task);
     Breakpoint  break_on_physical_process   (core::Core& core, std::string_view name, dtb_t dtb, phy_t phy, const Task& task);
+    // page-granularity data watch: the span is write-protected through
+    // a server page breakpoint, faulting accesses are decoded, filtered
+    // back to [ptr, ptr+size) & reported while the vm is paused
+    struct watch_access_t
+    {
+        uint64_t rip;
+        uint64_t addr;
+    };
+    using on_watch_fn = std::function<void(const watch_access_t&)>;
+    opt<bpid_t> watch_memory                (core::Core& core, std::string_view name, proc_t proc, uint64_t ptr, uint64_t size, const on_watch_fn& on_access);
+    bool        unwatch_memory              (core::Core& core, bpid_t bpid);
+    BreakpointGroup breakpoint_group        (core::Core& core);
+    // collects currently-disarmed breakpoints, armed in one batch by group_rearm
+    BreakpointGroup breakpoint_group_disarmed(core::Core& core);
+    void        group_add                   (BreakpointGroup& group, const Breakpoint& bp);
+    bool        group_disarm                (core::Core& core, BreakpointGroup& group);
+    bool        group_rearm                 (core::Core& core, BreakpointGroup& group);
+    // per-observer instrumentation, times in nanoseconds
+    struct observer_stats_t
+    {
+        std::string name;
+        uint64_t    hits;
+        uint64_t    task_ns;   // time spent inside the observer task
+        uint64_t    paused_ns; // guest wall time paused on this observer
+        std::array<uint64_t, 32> histogram; // task time slices, bucket i counts [2^i, 2^i+1) ns
+    };
+    std::vector<observer_stats_t> observer_stats(core::Core& core);
+    void        reset_observer_stats        (core::Core& core);
+    void        log_observer_stats          (core::Core& core);
+    // end-to-end latency budget over breakpoint round trips: the
+    // server stamps every event at trap & publish time, we stamp the
+    // client wake, dispatch bounds & the closing resume, correlated
+    // per event id; per-stage histograms show which layer a slow
+    // round trip actually spent its time in
+    struct stage_stats_t
+    {
+        const char* name; // trap, canal, wake, dispatch, resume
+        uint64_t    count;
+        uint64_t    total_ns;
+        std::array<uint64_t, 32> histogram; // bucket i counts [2^i, 2^i+1) ns
+    };
+    std::array<stage_stats_t, 5> latency_budget(core::Core& core);
+    void        reset_latency_budget        (core::Core& core);
+    void        log_latency_budget          (core::Core& core);
     bool        run_to_cr_write             (core::Core& core, reg_e reg);
     void        run_to_current              (core::Core& core, std::string_view name);
     void        run_to                      (core::Core& core, std::string_view name, std::unordered_set<uint64_t> ptrs, bp_cr3_e bp_cr3, std::function<walk_e(proc_t, thread_t)> on_bp);
+    TargetSet   compile_targets             (core::Core& core, std::string_view name, const std::unordered_set<uint64_t>& ptrs);
+    void        run_to_targets              (core::Core& core, TargetSet& targets, bp_cr3_e bp_cr3, std::function<walk_e(proc_t, thread_t)> on_bp);
     bool        inject_interrupt            (core::Core& core, uint32_t code, uint32_t error, uint64_t cr2);
     bpid_t      save_breakpoint             (core::Core& core, const Breakpoint& bp);
     bpid_t      acquire_breakpoint_id       (core::Core& core);
@@ -26,13 +26,41 @@ namespace symbols
 
     constexpr auto kernel = proc_t{~0ull, {~0ull}, {~0ull}};
 
+    // per-module symbol tier applied when module events load symbols:
+    // none keeps the module out of the tables, exports serves its
+    // export table & upgrades to the full debug file on the first
+    // struc query, full is the default; patterns use '*' wildcards,
+    // matched case-insensitive against the fixed module name, the
+    // longest matching pattern wins
+    enum class tier_e
+    {
+        none,
+        exports,
+        full,
+    };
+    void        set_load_policy     (core::Core& core, const std::string& pattern, tier_e tier);
+
     bool        load_module_memory  (core::Core& core, proc_t proc, const memory::Io& io, span_t span);
     bool        load_module         (core::Core& core, proc_t proc, const std::string& name);
     bool        load_modules        (core::Core& core, proc_t proc);
+    bool        load_modules_deferred(core::Core& core, proc_t proc);
     opt<bpid_t> autoload_modules    (core::Core& core, proc_t proc);
     bool        load_driver_memory  (core::Core& core, span_t span);
     bool        load_driver         (core::Core& core, const std::string& name);
     bool        load_drivers        (core::Core& core);
+    // bulk cache refresh after a guest update: identify every driver
+    // up front, serve a stale index from a previous guid while the
+    // changed pdbs parse on the worker pool & splice each fresh module
+    // in as it lands, reporting progress from the caller thread
+    struct refresh_progress_t
+    {
+        size_t      done;  // fresh modules spliced in so far
+        size_t      total; // modules whose guid changed
+        const char* name;
+        bool        stale; // true when a previous-guid index was served
+    };
+    using on_refresh_fn = std::function<void(const refresh_progress_t&)>;
+    bool        refresh_drivers     (core::Core& core, const on_refresh_fn& on_progress);
     bool        unload              (core::Core& core, proc_t proc, const std::string& module);
 
     opt<uint64_t>   address     (core::Core& core, proc_t proc, const std::string& module, const std::string& symbol);
@@ -40,5 +68,30 @@ namespace symbols
     opt<Struc>      read_struc  (core::Core& core, proc_t proc, const std::string& module, const std::string& struc);
     opt<Member>     find_member (const Struc& struc, const std::string& member);
     opt<Member>     read_member (core::Core& core, proc_t proc, const std::string& module, const std::string& struc, const std::string& member);
+    // memoized handles for plugin hot loops: the string lookup runs
+    // once per module identity, every later call is one hash probe
+    opt<uint64_t>   member_offset(core::Core& core, proc_t proc, const std::string& module, const std::string& struc, const std::string& member);
+    opt<uint64_t>   struc_size  (core::Core& core, proc_t proc, const std::string& module, const std::string& struc);
+
+    struct field_t
+    {
+        std::string_view name;  // member to read
+        opt<uint64_t>    value; // little-endian value, integer members up to 8 bytes
+    };
+    bool            read_fields (core::Core& core, proc_t proc, const memory::Io& io, const std::string& module, const std::string& struc, uint64_t ptr, field_t* fields, size_t count);
+
+    // declarative offset table: resolve every struct/member pair once,
+    // index the results by enum afterwards, no lookups left in hot paths
+    struct offset_desc_t
+    {
+        size_t      e_id;     // expected index, must match the array order
+        bool        required;
+        const char* struc;
+        const char* member;
+    };
+    bool            resolve_offsets(core::Core& core, proc_t proc, const std::string& module, const offset_desc_t* descs, size_t count, uint64_t* offsets);
     std::string     string      (core::Core& core, proc_t proc, uint64_t addr);
+    // batch nearest-symbol queries: sorted input answered in a single
+    // pass over the loaded spans, for trace post-processing volumes
+    std::vector<std::string> string_many(core::Core& core, proc_t proc, const uint64_t* addrs, size_t count);
 } // namespace symbols
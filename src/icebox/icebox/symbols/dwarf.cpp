@@ -291,20 +291,46 @@ namespace
     }
 }
 
+namespace
+{
+    std::shared_ptr<symbols::Module> make_dwarf_from(const fs::path& dir, const std::string& id)
+    {
+        // one dwarf walk per debug file, reuse the serialized index afterwards
+        const auto cache = dir / "elf.idx";
+        if(auto cached = symbols::load_indexer(id, cache))
+            return cached;
+
+        auto indexer = symbols::make_indexer(id);
+        if(!indexer)
+            return nullptr;
+
+        const auto ok = setup(*indexer, dir / "elf");
+        if(!ok)
+            return nullptr;
+
+        indexer->finalize();
+        if(!indexer->save(cache))
+            LOG(ERROR, "unable to write symbol index %s", cache.generic_string().data());
+
+        return indexer;
+    }
+}
+
 std::shared_ptr<symbols::Module> symbols::make_dwarf(const std::string& module, const std::string& guid)
 {
     const auto path = getenv("_LINUX_SYMBOL_PATH");
     if(!path)
         return nullptr;
 
-    auto indexer = symbols::make_indexer(guid);
-    if(!indexer)
-        return nullptr;
+    return make_dwarf_from(fs::path(path) / module / guid, guid);
+}
 
-    const auto ok = setup(*indexer, fs::path(path) / module / guid / "elf");
-    if(!ok)
+std::shared_ptr<symbols::Module> symbols::make_dwarf(const std::string& module)
+{
+    const auto path = getenv("_LINUX_SYMBOL_PATH");
+    if(!path)
         return nullptr;
 
-    indexer->finalize();
-    return indexer;
+    // kernel modules have no guest-readable debug id, match them by name
+    return make_dwarf_from(fs::path(path) / module, module);
 }
@@ -0,0 +1,116 @@
+#include "symbols.hpp"
+
+#define FDP_MODULE "exports"
+#include "endian.hpp"
+#include "indexer.hpp"
+#include "log.hpp"
+#include "memory.hpp"
+#include "utils/pe.hpp"
+#include "utils/utils.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    struct IMAGE_EXPORT_DIRECTORY
+    {
+        uint32_t Characteristics;
+        uint32_t TimeDateStamp;
+        uint16_t MajorVersion;
+        uint16_t MinorVersion;
+        uint32_t Name;
+        uint32_t Base;
+        uint32_t NumberOfFunctions;
+        uint32_t NumberOfNames;
+        uint32_t AddressOfFunctions;
+        uint32_t AddressOfNames;
+        uint32_t AddressOfNameOrdinals;
+    };
+    STATIC_ASSERT_EQ(40, sizeof(IMAGE_EXPORT_DIRECTORY));
+
+    bool setup_exports(symbols::Indexer& indexer, const memory::Io& io, span_t span)
+    {
+        const auto dir = pe::find_image_directory(io, span, pe::IMAGE_DIRECTORY_ENTRY_EXPORT);
+        if(!dir || dir->size < sizeof(IMAGE_EXPORT_DIRECTORY))
+            return FAIL(false, "module at 0x%" PRIx64 " has no export directory", span.addr);
+
+        // the name strings & rva arrays live inside the directory span,
+        // one bulk read replaces per-export guest accesses
+        auto buf = std::vector<uint8_t>(dir->size);
+        if(!io.read_all(&buf[0], dir->addr, dir->size))
+            return FAIL(false, "unable to read export directory at 0x%" PRIx64, dir->addr);
+
+        const auto dir_rva = dir->addr - span.addr;
+        const auto in_dir  = [&](uint64_t rva, uint64_t size)
+        {
+            return rva >= dir_rva && rva - dir_rva + size <= buf.size();
+        };
+        const auto at = [&](uint64_t rva)
+        {
+            return &buf[rva - dir_rva];
+        };
+
+        const auto num_funcs = read_le32(&buf[offsetof(IMAGE_EXPORT_DIRECTORY, NumberOfFunctions)]);
+        const auto num_names = read_le32(&buf[offsetof(IMAGE_EXPORT_DIRECTORY, NumberOfNames)]);
+        const auto funcs     = read_le32(&buf[offsetof(IMAGE_EXPORT_DIRECTORY, AddressOfFunctions)]);
+        const auto names     = read_le32(&buf[offsetof(IMAGE_EXPORT_DIRECTORY, AddressOfNames)]);
+        const auto ordinals  = read_le32(&buf[offsetof(IMAGE_EXPORT_DIRECTORY, AddressOfNameOrdinals)]);
+        if(!in_dir(funcs, num_funcs * 4ull) || !in_dir(names, num_names * 4ull) || !in_dir(ordinals, num_names * 2ull))
+            return FAIL(false, "export directory tables out of bounds");
+
+        for(uint32_t i = 0; i < num_names; ++i)
+        {
+            const auto name_rva = read_le32(at(names + i * 4ull));
+            const auto ordinal  = read_le16(at(ordinals + i * 2ull));
+            if(ordinal >= num_funcs || !in_dir(name_rva, 1))
+                continue;
+
+            // forwarder exports point back into the directory, skip them
+            const auto func_rva = read_le32(at(funcs + ordinal * 4ull));
+            if(!func_rva || in_dir(func_rva, 1))
+                continue;
+
+            const auto* name = reinterpret_cast<const char*>(at(name_rva));
+            const auto* end  = static_cast<const char*>(memchr(name, 0, buf.size() - (name_rva - dir_rva)));
+            if(!end || end == name)
+                continue;
+
+            indexer.add_symbol(std::string_view{name, static_cast<size_t>(end - name)}, func_rva);
+        }
+        indexer.finalize();
+        return true;
+    }
+}
+
+std::shared_ptr<symbols::Module> symbols::make_exports(const memory::Io& io, span_t span, const std::string& module, const std::string& guid)
+{
+    const auto path = getenv("_NT_SYMBOL_PATH");
+    if(!path)
+        return FAIL(nullptr, "missing _NT_SYMBOL_PATH environment variable");
+
+    // exports share the pdb cache directory but carry their own identity,
+    // so a pdb fetched later still replaces them cleanly
+    const auto id    = guid + "#exports";
+    const auto dir   = fs::path(path) / module / guid;
+    const auto cache = dir / "exports.idx";
+    if(auto cached = symbols::load_indexer(id, cache))
+        return cached;
+
+    auto indexer = symbols::make_indexer(id);
+    if(!indexer)
+        return nullptr;
+
+    if(!setup_exports(*indexer, io, span))
+        return nullptr;
+
+    // pdb-less modules have no cache directory yet
+    auto ec = std::error_code{};
+    fs::create_directories(dir, ec);
+    if(!indexer->save(cache))
+        LOG(ERROR, "unable to write symbol index %s", cache.generic_string().data());
+
+    return indexer;
+}
@@ -1,11 +1,15 @@
 #include "indexer.hpp"
+#include "utils/file.hpp"
 #include "utils/utils.hpp"
 
 #include <cstring>
 
+// name_ofs fields are insertion ordinals while indexing & become byte
+// offsets into the string arena once finalized, removing any per-name
+// table from lookups and from the serialized format
 struct symbols::IndexerStruc
 {
-    uint32_t name_idx;
+    uint32_t name_ofs;
     uint32_t size;
     uint32_t member_idx;
     uint32_t member_end;
@@ -15,14 +19,14 @@ namespace
 {
     struct Sym
     {
-        uint32_t name_idx;
+        uint32_t name_ofs;
         uint64_t offset;
     };
     STATIC_ASSERT_EQ(sizeof(Sym), 16);
 
     struct Member
     {
-        uint32_t name_idx;
+        uint32_t name_ofs;
         uint32_t offset;
     };
 
@@ -31,6 +35,7 @@ namespace
     using Symbols    = std::vector<Sym>;
     using Strucs     = std::vector<symbols::IndexerStruc>;
     using Members    = std::vector<Member>;
+    using Filter     = std::vector<uint64_t>;
 
     struct Data
         : public symbols::Indexer
@@ -42,6 +47,7 @@ namespace
         symbols::IndexerStruc&  add_struc   (std::string_view name, size_t size) override;
         void                    add_member  (symbols::IndexerStruc& struc, std::string_view name, size_t offset) override;
         void                    finalize    () override;
+        bool                    save        (const fs::path& path) override;
 
         // symbols::Module methods
         std::string_view        id              () override;
@@ -53,13 +59,13 @@ namespace
         void                    rebase_symbols  (uint64_t offset) override;
 
         const std::string guid;
-        uint32_t          last_name_idx;
+        uint32_t          last_name_ofs;
         StringData        data;
-        Strings           strings;
         Symbols           symbols;
         Symbols           offsets;
         Strucs            strucs;
         Members           members;
+        Filter            filter;
     };
 
     void save_string_data(StringData& data, std::string_view item)
@@ -75,57 +81,96 @@ namespace
     void remap_and_shrink(T& items, const std::vector<uint32_t>& reverse)
     {
         for(auto& item : items)
-            item.name_idx = reverse[item.name_idx];
+            item.name_ofs = reverse[item.name_ofs];
         items.shrink_to_fit();
     }
+
+    std::string_view view_of(const char* names, uint32_t ofs)
+    {
+        return std::string_view{&names[ofs]};
+    }
+
+    // two-probe bloom filter over symbol names, ~8 bits per name,
+    // so missing names die in a couple of cache lines instead of a
+    // full binary search per loaded module
+    uint64_t hash_name(std::string_view name)
+    {
+        auto hash = UINT64_C(0xcbf29ce484222325);
+        for(const auto c : name)
+            hash = (hash ^ static_cast<uint8_t>(c)) * UINT64_C(0x100000001b3);
+        return hash;
+    }
+
+    void filter_insert(Filter& filter, std::string_view name)
+    {
+        const auto hash  = hash_name(name);
+        const auto mask  = filter.size() * 64 - 1;
+        const auto bit_a = hash & mask;
+        const auto bit_b = (hash >> 32) & mask;
+        filter[bit_a / 64] |= uint64_t{1} << (bit_a % 64);
+        filter[bit_b / 64] |= uint64_t{1} << (bit_b % 64);
+    }
+
+    bool filter_may_contain(const uint64_t* filter, size_t words, std::string_view name)
+    {
+        if(!words)
+            return true; // indexes saved before version 3 have no filter
+
+        const auto hash  = hash_name(name);
+        const auto mask  = words * 64 - 1;
+        const auto bit_a = hash & mask;
+        const auto bit_b = (hash >> 32) & mask;
+        return ((filter[bit_a / 64] >> (bit_a % 64)) & (filter[bit_b / 64] >> (bit_b % 64))) & 1;
+    }
 }
 
 Data::Data(std::string_view id)
     : guid(id)
-    , last_name_idx(0)
+    , last_name_ofs(0)
 {
 }
 
 void Data::add_symbol(std::string_view name, size_t offset)
 {
-    const auto name_idx = last_name_idx++;
+    const auto name_ofs = last_name_ofs++;
     save_string_data(data, name);
-    const auto sym = Sym{name_idx, static_cast<uint64_t>(offset)};
+    const auto sym = Sym{name_ofs, static_cast<uint64_t>(offset)};
     symbols.emplace_back(sym);
     offsets.emplace_back(sym);
 }
 
 symbols::IndexerStruc& Data::add_struc(std::string_view name, size_t size)
 {
-    const auto name_idx = last_name_idx++;
+    const auto name_ofs = last_name_ofs++;
     save_string_data(data, name);
     const auto usize      = static_cast<uint32_t>(size);
     const auto member_idx = static_cast<uint32_t>(members.size());
-    strucs.emplace_back(symbols::IndexerStruc{name_idx, usize, member_idx, member_idx});
+    strucs.emplace_back(symbols::IndexerStruc{name_ofs, usize, member_idx, member_idx});
     return strucs.back();
 }
 
 void Data::add_member(symbols::IndexerStruc& struc, std::string_view name, size_t offset)
 {
-    const auto name_idx = last_name_idx++;
+    const auto name_ofs = last_name_ofs++;
     save_string_data(data, name);
-    members.emplace_back(Member{name_idx, static_cast<uint32_t>(offset)});
+    members.emplace_back(Member{name_ofs, static_cast<uint32_t>(offset)});
     struc.member_end = static_cast<uint32_t>(members.size());
 }
 
 namespace
 {
-    void fill_strings(Strings& strings, const StringData& data)
+    void fill_strings(Strings& strings, const char* data, size_t size)
     {
-        for(size_t i = 0; i < data.size(); i += strings.back().size() + 1)
+        for(size_t i = 0; i < size; i += strings.back().size() + 1)
             strings.emplace_back(std::string_view{&data[i]});
     }
 }
 
 void Data::finalize()
 {
-    // sort & map strings
-    fill_strings(strings, data);
+    // sort strings
+    auto strings = Strings{};
+    fill_strings(strings, data.data(), data.size());
     auto sorted = std::vector<size_t>{};
     sorted.resize(strings.size());
     for(size_t i = 0; i < strings.size(); ++i)
@@ -135,7 +180,7 @@ void Data::finalize()
         return strings[a] < strings[b];
     });
 
-    // reverse indexes & rebuild string buffers
+    // map ordinals to arena byte offsets & rebuild string buffers
     auto reverse = std::vector<uint32_t>{};
     reverse.resize(strings.size());
     auto new_data = StringData{};
@@ -143,18 +188,15 @@ void Data::finalize()
     for(size_t i = 0; i < strings.size(); ++i)
     {
         const auto idx = sorted[i];
-        reverse[idx]   = static_cast<uint32_t>(i);
+        reverse[idx]   = static_cast<uint32_t>(new_data.size());
         save_string_data(new_data, strings[idx]);
     }
     data.swap(new_data);
-    strings.resize(0);
-    fill_strings(strings, data);
-    strings.shrink_to_fit();
 
-    // index all remaining buffers
+    // index all remaining buffers, name order matches arena order
     const auto by_name = [](const auto& a, const auto& b)
     {
-        return a.name_idx < b.name_idx;
+        return a.name_ofs < b.name_ofs;
     };
     const auto by_offset = [](const auto& a, const auto& b)
     {
@@ -167,26 +209,89 @@ void Data::finalize()
     remap_and_shrink(strucs, reverse);
     std::sort(strucs.begin(), strucs.end(), by_name);
     remap_and_shrink(members, reverse);
+
+    // negative symbol lookups short-circuit on this filter
+    auto words = size_t{1};
+    while(words * 64 < symbols.size() * 8)
+        words *= 2;
+    filter.assign(words, 0);
+    for(const auto& sym : symbols)
+        filter_insert(filter, view_of(data.data(), sym.name_ofs));
 }
 
 namespace
 {
     template <typename T, typename U>
-    opt<T> binary_search(const Strings& strings, const std::vector<T>& vec, const U& item)
+    opt<T> binary_search(const char* names, const T* begin, const T* end, const U& item)
     {
-        const auto it = std::lower_bound(std::begin(vec), std::end(vec), item, [&](const auto& a, const auto& b)
+        const auto it = std::lower_bound(begin, end, item, [&](const auto& a, const auto& b)
         {
-            return strings[a.name_idx] < b;
+            return view_of(names, a.name_ofs) < b;
         });
-        if(it == std::end(vec))
+        if(it == end)
             return {};
 
-        const auto& str = strings[it->name_idx];
+        const auto str = view_of(names, it->name_ofs);
         if(str != item)
             return {};
 
         return *it;
     }
+
+    opt<symbols::Struc> read_struc_from(const char* names, const symbols::IndexerStruc* begin, const symbols::IndexerStruc* end, const Member* all_members, const std::string& struc)
+    {
+        const auto opt_struc = binary_search(names, begin, end, struc);
+        if(!opt_struc)
+            return {};
+
+        auto ret  = symbols::Struc{};
+        ret.name  = view_of(names, opt_struc->name_ofs);
+        ret.bytes = opt_struc->size;
+        ret.members.reserve(opt_struc->member_end - opt_struc->member_idx);
+        for(auto idx = opt_struc->member_idx; idx < opt_struc->member_end; ++idx)
+        {
+            const auto& m = all_members[idx];
+            ret.members.emplace_back(symbols::Member{view_of(names, m.name_ofs), m.offset, 0});
+        }
+
+        auto last_offset = ret.bytes;
+        for(auto it = ret.members.rbegin(); it != ret.members.rend(); ++it)
+        {
+            const auto max_offset = std::max<size_t>(last_offset, it->offset);
+            it->bits              = static_cast<uint32_t>(max_offset - it->offset) * 8;
+            last_offset           = it->offset;
+        }
+        return ret;
+    }
+
+    opt<symbols::Offset> make_cursor(const char* names, const Sym* it, const Sym* end, size_t offset)
+    {
+        if(it == end)
+            return {};
+
+        return symbols::Offset{std::string{view_of(names, it->name_ofs)}, offset - it->offset};
+    }
+
+    opt<symbols::Offset> find_symbol_from(const char* names, const Sym* begin, const Sym* end, size_t offset)
+    {
+        // lower bound returns first item greater or equal
+        auto it = std::lower_bound(begin, end, offset, [](const auto& a, const auto& b)
+        {
+            return a.offset < b;
+        });
+        if(it == end)
+            return begin == end ? opt<symbols::Offset>{} : make_cursor(names, end - 1, end, offset);
+
+        // equal
+        if(it->offset == offset)
+            return make_cursor(names, it, end, offset);
+
+        if(it == begin)
+            return {};
+
+        // strictly greater, go to previous item
+        return make_cursor(names, --it, end, offset);
+    }
 }
 
 std::string_view Data::id()
@@ -196,7 +301,10 @@ std::string_view Data::id()
 
 opt<size_t> Data::symbol_offset(const std::string& symbol)
 {
-    const auto opt_sym = binary_search(strings, symbols, symbol);
+    if(!filter_may_contain(filter.data(), filter.size(), symbol))
+        return {};
+
+    const auto opt_sym = binary_search(data.data(), symbols.data(), symbols.data() + symbols.size(), symbol);
     if(!opt_sym)
         return {};
 
@@ -206,87 +314,229 @@ opt<size_t> Data::symbol_offset(const std::string& symbol)
 void Data::list_strucs(const symbols::on_name_fn& on_struc)
 {
     for(const auto& struc : strucs)
-        on_struc(strings[struc.name_idx]);
+        on_struc(view_of(data.data(), struc.name_ofs));
 }
 
 opt<symbols::Struc> Data::read_struc(const std::string& struc)
 {
-    const auto opt_struc = binary_search(strings, strucs, struc);
-    if(!opt_struc)
-        return {};
+    return read_struc_from(data.data(), strucs.data(), strucs.data() + strucs.size(), members.data(), struc);
+}
+
+opt<symbols::Offset> Data::find_symbol(size_t offset)
+{
+    return find_symbol_from(data.data(), offsets.data(), offsets.data() + offsets.size(), offset);
+}
+
+bool Data::list_symbols(symbols::on_symbol_fn on_sym)
+{
+    for(const auto& it : offsets)
+        if(on_sym(std::string{view_of(data.data(), it.name_ofs)}, it.offset) == walk_e::stop)
+            break;
+
+    return true;
+}
+
+void Data::rebase_symbols(uint64_t offset)
+{
+    for(auto& sym : symbols)
+        sym.offset += offset;
+    for(auto& sym : offsets)
+        sym.offset += offset;
+}
 
-    auto ret  = symbols::Struc{};
-    ret.name  = strings[opt_struc->name_idx];
-    ret.bytes = opt_struc->size;
-    ret.members.reserve(opt_struc->member_end - opt_struc->member_idx);
-    for(auto idx = opt_struc->member_idx; idx < opt_struc->member_end; ++idx)
+std::shared_ptr<symbols::Indexer> symbols::make_indexer(std::string_view id)
+{
+    return std::make_shared<Data>(id);
+}
+
+// persistent index: every finalized buffer dumped verbatim behind a small
+// header, then mapped read-only so reloads skip parsing entirely and pages
+// are shared across concurrent processes
+namespace
+{
+    constexpr char     index_magic[4] = {'I', 'B', 'S', 'X'};
+    constexpr uint32_t index_version  = 3; // 2: name references are arena byte offsets
+                                           // 3: trailing bloom filter over symbol names
+
+    struct FileHeader
     {
-        const auto& m = members[idx];
-        ret.members.emplace_back(symbols::Member{strings[m.name_idx], m.offset, 0});
+        char     magic[4];
+        uint32_t version;
+        uint64_t data_size;
+        uint64_t symbol_count;
+        uint64_t struc_count;
+        uint64_t member_count;
+        uint64_t filter_words;
+    };
+    STATIC_ASSERT_EQ(sizeof(FileHeader), 48);
+
+    size_t align8(size_t size)
+    {
+        return (size + 7) & ~size_t{7};
     }
 
-    auto last_offset = ret.bytes;
-    for(auto it = ret.members.rbegin(); it != ret.members.rend(); ++it)
+    void append(std::vector<uint8_t>& dst, const void* src, size_t size)
     {
-        const auto max_offset = std::max<size_t>(last_offset, it->offset);
-        it->bits              = static_cast<uint32_t>(max_offset - it->offset) * 8;
-        last_offset           = it->offset;
+        const auto idx = dst.size();
+        dst.resize(align8(idx + size));
+        if(size)
+            memcpy(&dst[idx], src, size);
     }
-    return ret;
+}
+
+bool Data::save(const fs::path& path)
+{
+    auto header = FileHeader{};
+    memcpy(header.magic, index_magic, sizeof index_magic);
+    header.version      = index_version;
+    header.data_size    = data.size();
+    header.symbol_count = symbols.size();
+    header.struc_count  = strucs.size();
+    header.member_count = members.size();
+    header.filter_words = filter.size();
+
+    auto buffer = std::vector<uint8_t>{};
+    buffer.reserve(align8(sizeof header) + align8(data.size()) + 2 * symbols.size() * sizeof(Sym) + strucs.size() * sizeof(symbols::IndexerStruc) + members.size() * sizeof(Member));
+    append(buffer, &header, sizeof header);
+    append(buffer, data.data(), data.size());
+    append(buffer, symbols.data(), symbols.size() * sizeof(Sym));
+    append(buffer, offsets.data(), offsets.size() * sizeof(Sym));
+    append(buffer, strucs.data(), strucs.size() * sizeof(symbols::IndexerStruc));
+    append(buffer, members.data(), members.size() * sizeof(Member));
+    append(buffer, filter.data(), filter.size() * sizeof(uint64_t));
+    return file::write_async(path, std::move(buffer));
 }
 
 namespace
 {
-    template <typename T>
-    opt<symbols::Offset> make_cursor(Data& d, const T& it, const T& end, size_t offset)
+    struct MappedData
+        : public symbols::Module
     {
-        if(it == end)
-            return {};
+        MappedData(std::string_view id)
+            : guid(id)
+        {
+        }
 
-        return symbols::Offset{std::string{d.strings[it->name_idx]}, offset - it->offset};
-    }
+        ~MappedData() override
+        {
+            file::unmap(map);
+        }
+
+        // symbols::Module methods
+        std::string_view        id              () override;
+        opt<size_t>             symbol_offset   (const std::string& symbol) override;
+        void                    list_strucs     (const symbols::on_name_fn& on_struc) override;
+        opt<symbols::Struc>     read_struc      (const std::string& struc) override;
+        opt<symbols::Offset>    find_symbol     (size_t offset) override;
+        bool                    list_symbols    (symbols::on_symbol_fn on_symbol) override;
+        void                    rebase_symbols  (uint64_t offset) override;
+
+        const std::string guid;
+        file::Map         map;
+        const char*       names    = nullptr; // string arena
+        const Sym*        syms     = nullptr; // sorted by name
+        const Sym*        offs     = nullptr; // sorted by offset
+        const symbols::IndexerStruc* mstrucs = nullptr;
+        const Member*     mmembers = nullptr;
+        const uint64_t*   filter   = nullptr;
+        size_t            nsymbols = 0;
+        size_t            nstrucs  = 0;
+        size_t            nfilter  = 0;
+        // rebasing keeps the mapped arrays untouched & applies this
+        // delta at lookup time, so n processes indexing the same guest
+        // os share one copy of the index pages in page cache
+        uint64_t          rebase   = 0;
+    };
 }
 
-opt<symbols::Offset> Data::find_symbol(size_t offset)
+std::string_view MappedData::id()
 {
-    // lower bound returns first item greater or equal
-    auto it        = std::lower_bound(offsets.begin(), offsets.end(), offset, [](const auto& a, const auto& b)
-    {
-        return a.offset < b;
-    });
-    const auto end = offsets.end();
-    if(it == end)
-        return make_cursor(*this, offsets.rbegin(), offsets.rend(), offset);
+    return this->guid;
+}
 
-    // equal
-    if(it->offset == offset)
-        return make_cursor(*this, it, end, offset);
+opt<size_t> MappedData::symbol_offset(const std::string& symbol)
+{
+    if(!filter_may_contain(filter, nfilter, symbol))
+        return {};
 
-    if(it == offsets.begin())
+    const auto opt_sym = binary_search(names, syms, syms + nsymbols, symbol);
+    if(!opt_sym)
         return {};
 
-    // strictly greater, go to previous item
-    return make_cursor(*this, --it, end, offset);
+    return opt_sym->offset + rebase;
 }
 
-bool Data::list_symbols(symbols::on_symbol_fn on_sym)
+void MappedData::list_strucs(const symbols::on_name_fn& on_struc)
 {
-    for(const auto& it : offsets)
-        if(on_sym(std::string{strings[it.name_idx]}, it.offset) == walk_e::stop)
+    for(size_t i = 0; i < nstrucs; ++i)
+        on_struc(view_of(names, mstrucs[i].name_ofs));
+}
+
+opt<symbols::Struc> MappedData::read_struc(const std::string& struc)
+{
+    return read_struc_from(names, mstrucs, mstrucs + nstrucs, mmembers, struc);
+}
+
+opt<symbols::Offset> MappedData::find_symbol(size_t offset)
+{
+    if(offset < rebase)
+        return {};
+
+    // search in file coordinates, the cursor only carries the delta
+    // from the matched symbol so the result needs no translation
+    return find_symbol_from(names, offs, offs + nsymbols, offset - rebase);
+}
+
+bool MappedData::list_symbols(symbols::on_symbol_fn on_sym)
+{
+    for(size_t i = 0; i < nsymbols; ++i)
+        if(on_sym(std::string{view_of(names, offs[i].name_ofs)}, offs[i].offset + rebase) == walk_e::stop)
             break;
 
     return true;
 }
 
-void Data::rebase_symbols(uint64_t offset)
+void MappedData::rebase_symbols(uint64_t offset)
 {
-    for(auto& sym : symbols)
-        sym.offset += offset;
-    for(auto& sym : offsets)
-        sym.offset += offset;
+    rebase += offset;
 }
 
-std::shared_ptr<symbols::Indexer> symbols::make_indexer(std::string_view id)
+std::shared_ptr<symbols::Module> symbols::load_indexer(std::string_view id, const fs::path& path)
 {
-    return std::make_shared<Data>(id);
+    auto ret = std::make_shared<MappedData>(id);
+    if(!file::map_read(ret->map, path))
+        return nullptr;
+
+    if(ret->map.size < sizeof(FileHeader))
+        return nullptr;
+
+    auto header = FileHeader{};
+    memcpy(&header, ret->map.data, sizeof header);
+    if(memcmp(header.magic, index_magic, sizeof index_magic) != 0)
+        return nullptr;
+
+    if(header.version != index_version)
+        return nullptr;
+
+    const auto* base = static_cast<const char*>(ret->map.data);
+    auto ofs   = align8(sizeof header);
+    ret->names = &base[ofs];
+    ofs += align8(static_cast<size_t>(header.data_size));
+    ret->syms = reinterpret_cast<const Sym*>(&base[ofs]);
+    ofs += static_cast<size_t>(header.symbol_count) * sizeof(Sym);
+    ret->offs = reinterpret_cast<const Sym*>(&base[ofs]);
+    ofs += static_cast<size_t>(header.symbol_count) * sizeof(Sym);
+    ret->mstrucs = reinterpret_cast<const symbols::IndexerStruc*>(&base[ofs]);
+    ofs += static_cast<size_t>(header.struc_count) * sizeof(symbols::IndexerStruc);
+    ret->mmembers = reinterpret_cast<const ::Member*>(&base[ofs]);
+    ofs += align8(static_cast<size_t>(header.member_count) * sizeof(::Member));
+    ret->filter = reinterpret_cast<const uint64_t*>(&base[ofs]);
+    ofs += static_cast<size_t>(header.filter_words) * sizeof(uint64_t);
+    if(ofs > ret->map.size)
+        return nullptr;
+
+    ret->nsymbols = static_cast<size_t>(header.symbol_count);
+    ret->nstrucs  = static_cast<size_t>(header.struc_count);
+    ret->nfilter  = static_cast<size_t>(header.filter_words);
+    return ret;
 }
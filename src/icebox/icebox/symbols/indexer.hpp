@@ -19,7 +19,13 @@ namespace symbols
         virtual void            add_member      (IndexerStruc& struc, std::string_view name, size_t offset) = 0;
         virtual void            finalize        () = 0;
         virtual void            rebase_symbols  (uint64_t offset) = 0;
+
+        // serialize every finalized buffer, see load_indexer
+        virtual bool            save            (const fs::path& path) = 0;
     };
 
     std::shared_ptr<Indexer> make_indexer(std::string_view id);
+
+    // map a saved index read-only, near-instant & shared across processes
+    std::shared_ptr<Module> load_indexer(std::string_view id, const fs::path& path);
 } // namespace symbols
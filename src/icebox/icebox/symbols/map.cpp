@@ -4,31 +4,98 @@
 #include "indexer.hpp"
 #include "interfaces/if_symbols.hpp"
 #include "log.hpp"
+#include "utils/file.hpp"
 
-#include <fstream>
-#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
 
 namespace
 {
+    const char* parse_hex(const char* ptr, const char* end, uint64_t& value)
+    {
+        auto got = false;
+        value    = 0;
+        while(ptr != end)
+        {
+            const auto c = *ptr;
+            auto digit   = 0;
+            if(c >= '0' && c <= '9')
+                digit = c - '0';
+            else if(c >= 'a' && c <= 'f')
+                digit = c - 'a' + 10;
+            else if(c >= 'A' && c <= 'F')
+                digit = c - 'A' + 10;
+            else
+                break;
+
+            value = (value << 4) + digit;
+            got   = true;
+            ++ptr;
+        }
+        return got ? ptr : nullptr;
+    }
+
+    const char* skip_blanks(const char* ptr, const char* end)
+    {
+        while(ptr != end && (*ptr == ' ' || *ptr == '\t'))
+            ++ptr;
+        return ptr;
+    }
+
+    // System.map & kallsyms rows: hex address, type letter, name
+    // kallsyms may append "\t[module]", which the name scan stops before
+    bool parse_row(symbols::Indexer& indexer, const char* ptr, const char* end)
+    {
+        auto offset = uint64_t{};
+        ptr         = parse_hex(skip_blanks(ptr, end), end, offset);
+        if(!ptr || ptr == end || (*ptr != ' ' && *ptr != '\t'))
+            return false;
+
+        ptr = skip_blanks(ptr, end);
+        if(ptr == end)
+            return false;
+
+        ++ptr; // type letter
+        ptr = skip_blanks(ptr, end);
+        if(ptr == end)
+            return false;
+
+        const auto* name = ptr;
+        while(ptr != end && *ptr != ' ' && *ptr != '\t' && *ptr != '\r')
+            ++ptr;
+        if(ptr == name)
+            return false;
+
+        indexer.add_symbol(std::string_view{name, static_cast<size_t>(ptr - name)}, offset);
+        return true;
+    }
+
     bool setup(symbols::Indexer& indexer, const fs::path& filename)
     {
-        auto filestream = std::ifstream(filename);
-        if(!filestream)
+        // one read-only mapping, names are interned straight from the buffer
+        auto map = file::Map{};
+        if(!file::map_read(map, filename))
             return FAIL(false, "unable to open %s", filename.generic_string().data());
 
-        auto row    = std::string{};
-        auto offset = uint64_t{};
-        auto type   = char{};
-        auto symbol = std::string{};
-        while(std::getline(filestream, row))
+        auto ok         = true;
+        const auto* ptr = static_cast<const char*>(map.data);
+        const auto* end = ptr + map.size;
+        while(ptr != end)
         {
-            auto ok = !!(std::istringstream{row} >> std::hex >> offset >> std::dec >> type >> symbol);
-            if(!ok)
-                return FAIL(false, "unable to parse row '%s' in file %s", row.data(), filename.generic_string().data());
-
-            indexer.add_symbol(symbol, offset);
+            // memchr runs on the vectorized libc implementation
+            const auto* eol  = static_cast<const char*>(memchr(ptr, '\n', end - ptr));
+            const auto* stop = eol ? eol : end;
+            if(skip_blanks(ptr, stop) != stop)
+                if(!parse_row(indexer, ptr, stop))
+                {
+                    ok = FAIL(false, "unable to parse row '%.*s' in file %s", static_cast<int>(stop - ptr), ptr, filename.generic_string().data());
+                    break;
+                }
+            ptr = eol ? eol + 1 : end;
         }
-        return true;
+        file::unmap(map);
+        return ok;
     }
 }
 
@@ -42,7 +109,10 @@ std::shared_ptr<symbols::Module> symbols::make_map(const std::string& module, co
     if(!indexer)
         return nullptr;
 
-    const auto ok = setup(*indexer, fs::path(path) / module / guid / "System.map");
+    const auto dir = fs::path(path) / module / guid;
+    auto ok        = setup(*indexer, dir / "System.map");
+    if(!ok)
+        ok = setup(*indexer, dir / "kallsyms");
     if(!ok)
         return nullptr;
 
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <cctype>
 #include <functional>
+#include <mutex>
 
 #include "pdbparser.hpp"
 namespace pdb = retdec::pdbparser;
@@ -103,7 +104,7 @@ namespace
             memcpy(&guid[8], &rsds[4 + 8], 8);             // Data4
 
             char strguid[sizeof guid * 2];
-            hex::convert(strguid, hex::chars_upper, guid, sizeof guid);
+            hex::encode(strguid, guid, sizeof guid);
 
             uint32_t age    = read_le32(&rsds[4 + 16]);
             const auto name = read_pdb_name(&rsds[4 + 16 + 4], name_end);
@@ -134,19 +135,152 @@ opt<symbols::Identity> symbols::identify_pdb(span_t span, const memory::Io& io)
     return symbols::Identity{pdb->name, pdb->guid};
 }
 
-std::shared_ptr<symbols::Module> symbols::make_pdb(const std::string& module, const std::string& guid)
+namespace
+{
+    std::shared_ptr<symbols::Module> load_pdb_now(const fs::path& dir, const std::string& module, const std::string& guid)
+    {
+        // reuse the serialized index when this pdb has been parsed once already
+        const auto cache = dir / (module + ".idx");
+        if(auto cached = symbols::load_indexer(guid, cache))
+            return cached;
+
+        auto indexer = symbols::make_indexer(guid);
+        if(!indexer)
+            return nullptr;
+
+        const auto ok = setup_pdb(*indexer, dir / module);
+        if(!ok)
+            return nullptr;
+
+        if(!indexer->save(cache))
+            LOG(ERROR, "unable to write symbol index %s", cache.generic_string().data());
+
+        return indexer;
+    }
+
+    // retdec only parses whole streams, so laziness is per-module: the
+    // expensive parse is deferred until the first actual symbol query
+    struct LazyPdb
+        : public symbols::Module
+    {
+        LazyPdb(fs::path dir, std::string module, std::string guid)
+            : dir_(std::move(dir))
+            , module_(std::move(module))
+            , guid_(std::move(guid))
+        {
+        }
+
+        symbols::Module* load()
+        {
+            // concurrent first queries (prefetcher vs caller) block here
+            std::call_once(once_, [&]
+            {
+                mod_ = load_pdb_now(dir_, module_, guid_);
+            });
+            return mod_.get();
+        }
+
+        std::string_view id() override
+        {
+            return guid_;
+        }
+
+        opt<size_t> symbol_offset(const std::string& symbol) override
+        {
+            const auto mod = load();
+            return mod ? mod->symbol_offset(symbol) : opt<size_t>{};
+        }
+
+        void list_strucs(const symbols::on_name_fn& on_struc) override
+        {
+            if(const auto mod = load())
+                mod->list_strucs(on_struc);
+        }
+
+        opt<symbols::Struc> read_struc(const std::string& struc) override
+        {
+            const auto mod = load();
+            return mod ? mod->read_struc(struc) : opt<symbols::Struc>{};
+        }
+
+        opt<symbols::Offset> find_symbol(size_t offset) override
+        {
+            const auto mod = load();
+            return mod ? mod->find_symbol(offset) : opt<symbols::Offset>{};
+        }
+
+        bool list_symbols(symbols::on_symbol_fn on_symbol) override
+        {
+            const auto mod = load();
+            return mod ? mod->list_symbols(std::move(on_symbol)) : false;
+        }
+
+        void rebase_symbols(uint64_t offset) override
+        {
+            if(const auto mod = load())
+                mod->rebase_symbols(offset);
+        }
+
+        const fs::path    dir_;
+        const std::string module_;
+        const std::string guid_;
+        std::once_flag    once_;
+        std::shared_ptr<symbols::Module> mod_;
+    };
+}
+
+std::shared_ptr<symbols::Module> symbols::make_stale_pdb(const std::string& module, const std::string& guid)
 {
     const auto path = getenv("_NT_SYMBOL_PATH");
     if(!path)
-        return FAIL(nullptr, "missing _NT_SYMBOL_PATH environment variable");
-
-    auto indexer = symbols::make_indexer(guid);
-    if(!indexer)
         return nullptr;
 
-    const auto ok = setup_pdb(*indexer, fs::path(path) / module / guid / module);
-    if(!ok)
+    // only ever serve an index parsed from a real pdb of this module:
+    // a previous guid is wrong by definition, but mostly-right beats
+    // nothing while the fresh debug file is fetched & parsed
+    auto       best    = fs::path{};
+    auto       best_id = std::string{};
+    auto       best_at = fs::file_time_type::min();
+    auto       ec      = std::error_code{};
+    const auto root    = fs::path(path) / module;
+    for(const auto& entry : fs::directory_iterator(root, ec))
+    {
+        if(!fs::is_directory(entry.path(), ec))
+            continue;
+
+        const auto id = entry.path().filename().generic_string();
+        if(id == guid)
+            continue;
+
+        const auto cache = entry.path() / (module + ".idx");
+        if(!fs::exists(cache, ec))
+            continue;
+
+        const auto at = fs::last_write_time(cache, ec);
+        if(!best.empty() && at <= best_at)
+            continue;
+
+        best    = cache;
+        best_id = id;
+        best_at = at;
+    }
+    if(best.empty())
         return nullptr;
 
-    return indexer;
+    return symbols::load_indexer(best_id, best);
+}
+
+std::shared_ptr<symbols::Module> symbols::make_pdb(const std::string& module, const std::string& guid)
+{
+    const auto path = getenv("_NT_SYMBOL_PATH");
+    if(!path)
+        return FAIL(nullptr, "missing _NT_SYMBOL_PATH environment variable");
+
+    // fail missing pdbs now, parse present ones on first query only
+    const auto dir = fs::path(path) / module / guid;
+    auto ec        = std::error_code{};
+    if(!fs::exists(dir / module, ec))
+        return FAIL(nullptr, "missing pdb %s", (dir / module).generic_string().data());
+
+    return std::make_shared<LazyPdb>(dir, module, guid);
 }
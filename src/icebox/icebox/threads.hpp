@@ -12,11 +12,23 @@ namespace threads
     using on_thread_fn = std::function<walk_e(thread_t)>;
     using on_event_fn  = std::function<void(thread_t)>;
 
+    // full-system thread census, filled in one batched read pass
+    struct info_t
+    {
+        thread_t thread;
+        proc_t   proc;
+        uint64_t tid;
+        uint64_t pc;
+    };
+    using on_info_fn = std::function<walk_e(const info_t&)>;
+
     bool            list            (core::Core&, proc_t proc, on_thread_fn on_thread);
     opt<thread_t>   current         (core::Core&);
     opt<proc_t>     process         (core::Core&, thread_t thread);
     opt<uint64_t>   program_counter (core::Core&, proc_t proc, thread_t thread);
     uint64_t        tid             (core::Core&, proc_t proc, thread_t thread);
+    opt<thread_t>   find_tid        (core::Core&, uint64_t tid);
+    bool            list_info       (core::Core&, on_info_fn on_info);
     opt<bpid_t>     listen_create   (core::Core&, const on_event_fn& on_thread_event);
     opt<bpid_t>     listen_delete   (core::Core&, const on_event_fn& on_thread_event);
 } // namespace threads
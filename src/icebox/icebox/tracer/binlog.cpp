@@ -0,0 +1,695 @@
+#include "tracer.hpp"
+
+#define FDP_MODULE "binlog"
+#include "core.hpp"
+#include "endian.hpp"
+#include "log.hpp"
+#include "os.hpp"
+#include "utils/file.hpp"
+#include "utils/lz.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    // file layout: header, then records
+    //   header: magic 'IBTR', u32 version
+    //   define: u8 type, u16 id, u8 argc, str name, argc * {u8 size, str type, str name}
+    //   event:  u8 type, u16 id, u64 timestamp, u64 proc, u64 thread, packed args
+    // strings are u8 length + bytes; the first event of every callcfg_t
+    // is preceded by its define record, so the trace is self-describing
+    // and arg sizes are known without the source json
+    constexpr char     binlog_magic[4] = {'I', 'B', 'T', 'R'};
+    constexpr uint32_t binlog_version  = 1;
+
+    constexpr uint8_t record_define = 0;
+    constexpr uint8_t record_event  = 1;
+    constexpr uint8_t record_pad    = 0xff; // fills the tail gap before a wrap
+
+    constexpr size_t binlog_chunk = 16 << 20; // grow the file 16mb at a time
+
+    using CallIds = std::unordered_map<const tracer::callcfg_t*, uint16_t>;
+}
+
+struct tracer::Binlog::Data
+{
+    file::Writer writer;
+    CallIds      ids;
+};
+
+tracer::Binlog::Binlog()
+    : d_(std::make_unique<Data>())
+{
+}
+
+tracer::Binlog::~Binlog()
+{
+    close_binlog(*this);
+}
+
+namespace
+{
+    size_t str_size(const char* str)
+    {
+        return 1 + std::min<size_t>(strlen(str), 255);
+    }
+
+    uint8_t* write_str(uint8_t* dst, const char* str)
+    {
+        const auto n = std::min<size_t>(strlen(str), 255);
+        *dst++       = static_cast<uint8_t>(n);
+        memcpy(dst, str, n);
+        return dst + n;
+    }
+
+    opt<uint16_t> define_call(tracer::Binlog::Data& d, const tracer::callcfg_t& call)
+    {
+        const auto it = d.ids.find(&call);
+        if(it != d.ids.end())
+            return it->second;
+
+        auto size = 1 + sizeof(uint16_t) + 1 + str_size(call.name);
+        for(size_t i = 0; i < call.argc; ++i)
+            size += 1 + str_size(call.args[i].type) + str_size(call.args[i].name);
+
+        auto* dst = static_cast<uint8_t*>(file::map_grow(d.writer, size));
+        if(!dst)
+            return {};
+
+        const auto id = static_cast<uint16_t>(d.ids.size());
+        *dst++        = record_define;
+        write_le16(dst, id);
+        dst += sizeof id;
+        *dst++ = static_cast<uint8_t>(call.argc);
+        dst    = write_str(dst, call.name);
+        for(size_t i = 0; i < call.argc; ++i)
+        {
+            *dst++ = static_cast<uint8_t>(call.args[i].size);
+            dst    = write_str(dst, call.args[i].type);
+            dst    = write_str(dst, call.args[i].name);
+        }
+        d.ids.emplace(&call, id);
+        return id;
+    }
+}
+
+bool tracer::open_binlog(tracer::Binlog& log, const fs::path& path)
+{
+    auto& d = *log.d_;
+    if(!file::map_write(d.writer, path, binlog_chunk))
+        return FAIL(false, "unable to create trace %s", path.generic_string().data());
+
+    auto* dst = static_cast<uint8_t*>(file::map_grow(d.writer, sizeof binlog_magic + sizeof binlog_version));
+    if(!dst)
+        return false;
+
+    memcpy(dst, binlog_magic, sizeof binlog_magic);
+    write_le32(dst + sizeof binlog_magic, binlog_version);
+    return true;
+}
+
+bool tracer::close_binlog(tracer::Binlog& log)
+{
+    auto& d = *log.d_;
+    if(!d.writer.os_a)
+        return false;
+
+    d.ids.clear();
+    return file::map_close(d.writer);
+}
+
+bool tracer::log_event_with(tracer::Binlog& log, core::Core& core, const tracer::callcfg_t& call, const uint64_t* args)
+{
+    auto& d       = *log.d_;
+    const auto id = define_call(d, call);
+    if(!id)
+        return false;
+
+    auto size = size_t{1 + sizeof(uint16_t) + 3 * sizeof(uint64_t)};
+    for(size_t i = 0; i < call.argc; ++i)
+        size += call.args[i].size;
+
+    auto* dst = static_cast<uint8_t*>(file::map_grow(d.writer, size));
+    if(!dst)
+        return false;
+
+    const auto now    = std::chrono::steady_clock::now().time_since_epoch();
+    const auto ts     = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    const auto proc   = process::current(core);
+    const auto thread = threads::current(core);
+    *dst++            = record_event;
+    write_le16(dst, *id);
+    dst += sizeof *id;
+    write_le64(dst, static_cast<uint64_t>(ts));
+    dst += sizeof(uint64_t);
+    write_le64(dst, proc ? proc->id : 0);
+    dst += sizeof(uint64_t);
+    write_le64(dst, thread ? thread->id : 0);
+    dst += sizeof(uint64_t);
+    for(size_t i = 0; i < call.argc; ++i)
+    {
+        // packed little-endian, truncated to the declared arg size
+        auto le = std::array<uint8_t, sizeof(uint64_t)>{};
+        write_le64(&le[0], args[i]);
+        memcpy(dst, &le[0], call.args[i].size);
+        dst += call.args[i].size;
+    }
+    return true;
+}
+
+bool tracer::log_event(tracer::Binlog& log, core::Core& core, const tracer::callcfg_t& call)
+{
+    // guest reads must happen here, while the vm is paused on the breakpoint
+    auto args = std::array<uint64_t, 20>{}; // matches callcfg_t capacity
+    for(size_t i = 0; i < call.argc; ++i)
+    {
+        const auto arg = functions::read_arg(core, i);
+        args[i]        = arg ? arg->val : 0;
+    }
+    return log_event_with(log, core, call, &args[0]);
+}
+
+namespace
+{
+    // segment layout: shm_header_t, then a byte ring holding the same
+    // define & event records as the trace file
+    //   sequence: seqlock over the ring, odd while a write is in
+    //             flight, readers retry when it changed or is odd
+    //   head:     total bytes ever written, offset = head % capacity
+    // records never split across the wrap: the tail gap is filled with
+    // record_pad bytes and the write restarts at offset zero; defines
+    // are re-emitted after every wrap so a late-joining consumer
+    // resynchronizes within one lap of the ring
+    constexpr char     shm_magic[4] = {'I', 'B', 'S', 'H'};
+    constexpr uint32_t shm_version  = 1;
+
+    struct shm_header_t
+    {
+        char                  magic[4];
+        uint32_t              version;
+        uint64_t              capacity;
+        std::atomic<uint64_t> sequence;
+        std::atomic<uint64_t> head;
+    };
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "readers poll the header across processes");
+}
+
+struct tracer::ShmExport::Data
+{
+    file::Shared         shm;
+    CallIds              ids;
+    std::vector<uint8_t> scratch; // record built here, copied under the seqlock
+};
+
+tracer::ShmExport::ShmExport()
+    : d_(std::make_unique<Data>())
+{
+}
+
+tracer::ShmExport::~ShmExport()
+{
+    close_shm_export(*this);
+}
+
+namespace
+{
+    shm_header_t& shm_header(tracer::ShmExport::Data& d)
+    {
+        return *static_cast<shm_header_t*>(d.shm.data);
+    }
+
+    void append_str(std::vector<uint8_t>& dst, const char* str)
+    {
+        const auto n = std::min<size_t>(strlen(str), 255);
+        dst.push_back(static_cast<uint8_t>(n));
+        dst.insert(dst.end(), str, str + n);
+    }
+
+    void append_le(std::vector<uint8_t>& dst, uint64_t value, size_t size)
+    {
+        auto le = std::array<uint8_t, sizeof(uint64_t)>{};
+        write_le64(&le[0], value);
+        dst.insert(dst.end(), &le[0], &le[0] + size);
+    }
+
+    uint16_t shm_define_call(tracer::ShmExport::Data& d, const tracer::callcfg_t& call)
+    {
+        const auto it = d.ids.find(&call);
+        if(it != d.ids.end())
+            return it->second;
+
+        const auto id = static_cast<uint16_t>(d.ids.size());
+        d.scratch.push_back(record_define);
+        append_le(d.scratch, id, sizeof id);
+        d.scratch.push_back(static_cast<uint8_t>(call.argc));
+        append_str(d.scratch, call.name);
+        for(size_t i = 0; i < call.argc; ++i)
+        {
+            d.scratch.push_back(static_cast<uint8_t>(call.args[i].size));
+            append_str(d.scratch, call.args[i].type);
+            append_str(d.scratch, call.args[i].name);
+        }
+        d.ids.emplace(&call, id);
+        return id;
+    }
+
+    // true when size bytes at the current head land past the wrap;
+    // the producer is single-threaded so head cannot move in between
+    bool shm_wraps(tracer::ShmExport::Data& d, size_t size)
+    {
+        auto&      hdr      = shm_header(d);
+        const auto capacity = hdr.capacity;
+        const auto offset   = hdr.head.load(std::memory_order_relaxed) % capacity;
+        return offset + size > capacity;
+    }
+
+    bool shm_write(tracer::ShmExport::Data& d, const uint8_t* src, size_t size)
+    {
+        auto&      hdr      = shm_header(d);
+        const auto capacity = hdr.capacity;
+        if(size > capacity)
+            return FAIL(false, "record too large for the shared ring");
+
+        auto*      ring = reinterpret_cast<uint8_t*>(&hdr + 1);
+        const auto seq  = hdr.sequence.load(std::memory_order_relaxed);
+        hdr.sequence.store(seq + 1, std::memory_order_release);
+        auto head   = hdr.head.load(std::memory_order_relaxed);
+        auto offset = head % capacity;
+        if(offset + size > capacity)
+        {
+            memset(ring + offset, record_pad, capacity - offset);
+            head += capacity - offset;
+            offset = 0;
+        }
+        memcpy(ring + offset, src, size);
+        hdr.head.store(head + size, std::memory_order_relaxed);
+        hdr.sequence.store(seq + 2, std::memory_order_release);
+        return true;
+    }
+}
+
+bool tracer::open_shm_export(tracer::ShmExport& exporter, const std::string& name, size_t capacity)
+{
+    auto& d = *exporter.d_;
+    if(!file::map_shared(d.shm, name, sizeof(shm_header_t) + capacity))
+        return FAIL(false, "unable to create shared segment %s", name.data());
+
+    auto& hdr = shm_header(d);
+    memcpy(hdr.magic, shm_magic, sizeof shm_magic);
+    hdr.capacity = capacity;
+    hdr.sequence.store(0, std::memory_order_relaxed);
+    hdr.head.store(0, std::memory_order_relaxed);
+    // the version write publishes the header, readers spin on it
+    hdr.version = shm_version;
+    return true;
+}
+
+bool tracer::close_shm_export(tracer::ShmExport& exporter)
+{
+    auto& d = *exporter.d_;
+    if(!d.shm.data)
+        return false;
+
+    d.ids.clear();
+    file::unmap_shared(d.shm);
+    return true;
+}
+
+bool tracer::publish_event_with(tracer::ShmExport& exporter, core::Core& core, const tracer::callcfg_t& call, const uint64_t* args)
+{
+    auto& d = *exporter.d_;
+    if(!d.shm.data)
+        return false;
+
+    const auto now    = std::chrono::steady_clock::now().time_since_epoch();
+    const auto ts     = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    const auto proc   = process::current(core);
+    const auto thread = threads::current(core);
+    const auto build  = [&]
+    {
+        // the define & its event land in one seqlock section so a reader
+        // never sees an event whose define is still in flight
+        d.scratch.clear();
+        const auto id = shm_define_call(d, call);
+        d.scratch.push_back(record_event);
+        append_le(d.scratch, id, sizeof id);
+        append_le(d.scratch, static_cast<uint64_t>(ts), sizeof(uint64_t));
+        append_le(d.scratch, proc ? proc->id : 0, sizeof(uint64_t));
+        append_le(d.scratch, thread ? thread->id : 0, sizeof(uint64_t));
+        for(size_t i = 0; i < call.argc; ++i)
+            append_le(d.scratch, args[i], call.args[i].size);
+    };
+    build();
+    // the first record past the wrap can only reference defines a late
+    // joiner starting there will see: drop the table & rebuild so the
+    // define rides along in the same record
+    if(shm_wraps(d, d.scratch.size()))
+    {
+        d.ids.clear();
+        build();
+    }
+    return shm_write(d, d.scratch.data(), d.scratch.size());
+}
+
+bool tracer::publish_event(tracer::ShmExport& exporter, core::Core& core, const tracer::callcfg_t& call)
+{
+    // guest reads must happen here, while the vm is paused on the breakpoint
+    auto args = std::array<uint64_t, 20>{}; // matches callcfg_t capacity
+    for(size_t i = 0; i < call.argc; ++i)
+    {
+        const auto arg = functions::read_arg(core, i);
+        args[i]        = arg ? arg->val : 0;
+    }
+    return publish_event_with(exporter, core, call, &args[0]);
+}
+
+// frame-compressed trace: header, compressed frames, footer
+//   header: magic 'IBTZ', u32 version
+//   frame:  u32 raw_size, u32 comp_size, comp_size bytes
+//   footer: frame_count * {u64 file_offset, u64 comp_size, u64 raw_offset,
+//           u64 raw_size}, u64 frame_count, magic 'IBTZ'
+// every frame restarts the define table, so a seek lands on a
+// self-describing record stream like the uncompressed trace
+namespace
+{
+    constexpr char     zlog_magic[4] = {'I', 'B', 'T', 'Z'};
+    constexpr uint32_t zlog_version  = 1;
+
+    constexpr size_t zlog_frame_size = 1 << 20; // raw bytes per frame
+
+    struct pending_frame_t
+    {
+        uint64_t             seq;
+        uint64_t             raw_offset;
+        std::vector<uint8_t> raw;
+    };
+
+    struct done_frame_t
+    {
+        uint64_t             raw_offset;
+        uint64_t             raw_size;
+        std::vector<uint8_t> comp;
+    };
+}
+
+struct tracer::Zlog::Data
+{
+    file::Writer writer;
+    CallIds      ids;
+
+    // hot path only touches these
+    std::vector<uint8_t> frame;
+    uint64_t             raw_offset = 0;
+    uint64_t             next_seq   = 0;
+
+    // compression pipeline
+    std::mutex                       mutex;
+    std::condition_variable          todo;
+    std::condition_variable          done_cv;
+    std::deque<pending_frame_t>      pending;
+    std::map<uint64_t, done_frame_t> done; // reordered by seq before writing
+    std::vector<std::thread>         workers;
+    std::thread                      writer_thread;
+    bool                             stop = false;
+
+    std::atomic<int>                  level{6};
+    std::vector<tracer::zlog_frame_t> index;
+};
+
+tracer::Zlog::Zlog()
+    : d_(std::make_unique<Data>())
+{
+}
+
+tracer::Zlog::~Zlog()
+{
+    close_zlog(*this);
+}
+
+namespace
+{
+    void zlog_worker(tracer::Zlog::Data& d)
+    {
+        while(true)
+        {
+            auto item   = pending_frame_t{};
+            auto queued = size_t{0};
+            {
+                auto lock = std::unique_lock{d.mutex};
+                d.todo.wait(lock, [&] { return d.stop || !d.pending.empty(); });
+                if(d.pending.empty())
+                    return;
+
+                item = std::move(d.pending.front());
+                d.pending.pop_front();
+                queued = d.pending.size();
+            }
+            // under backpressure drop to the fastest level, whatever
+            // the requested one: disk & cpu are already behind
+            const auto level = queued > 2 * d.workers.size() ? lz::min_level : d.level.load(std::memory_order_relaxed);
+            auto       comp   = std::vector<uint8_t>(lz::compress_bound(item.raw.size()));
+            const auto size   = lz::compress(comp.data(), comp.size(), item.raw.data(), item.raw.size(), level);
+            comp.resize(size);
+            {
+                const auto lock = std::lock_guard{d.mutex};
+                d.done.emplace(item.seq, done_frame_t{item.raw_offset, item.raw.size(), std::move(comp)});
+            }
+            d.done_cv.notify_one();
+        }
+    }
+
+    bool write_frame(tracer::Zlog::Data& d, const done_frame_t& frame)
+    {
+        const auto offset = d.writer.size;
+        auto*      dst    = static_cast<uint8_t*>(file::map_grow(d.writer, 2 * sizeof(uint32_t) + frame.comp.size()));
+        if(!dst)
+            return false;
+
+        write_le32(dst, static_cast<uint32_t>(frame.raw_size));
+        write_le32(dst + sizeof(uint32_t), static_cast<uint32_t>(frame.comp.size()));
+        memcpy(dst + 2 * sizeof(uint32_t), frame.comp.data(), frame.comp.size());
+        d.index.push_back({offset + 2 * sizeof(uint32_t), frame.comp.size(), frame.raw_offset, frame.raw_size});
+        return true;
+    }
+
+    // single writer keeps frames in sequence order on disk
+    void zlog_writer(tracer::Zlog::Data& d)
+    {
+        auto seq = uint64_t{0};
+        while(true)
+        {
+            auto frame = done_frame_t{};
+            {
+                auto lock = std::unique_lock{d.mutex};
+                d.done_cv.wait(lock, [&]
+                {
+                    const auto it = d.done.begin();
+                    if(it != d.done.end() && it->first == seq)
+                        return true;
+                    // drain by sequence: empty queues lie while a worker
+                    // holds a popped frame, seq only reaches next_seq
+                    // once every cut frame has landed on disk
+                    return d.stop && seq == d.next_seq;
+                });
+                const auto it = d.done.begin();
+                if(it == d.done.end() || it->first != seq)
+                    return;
+
+                frame = std::move(it->second);
+                d.done.erase(it);
+            }
+            if(!write_frame(d, frame))
+                LOG(ERROR, "unable to write trace frame %" PRIu64, seq);
+            ++seq;
+        }
+    }
+
+    void zlog_cut_frame(tracer::Zlog::Data& d)
+    {
+        if(d.frame.empty())
+            return;
+
+        const auto size = d.frame.size();
+        {
+            const auto lock = std::lock_guard{d.mutex};
+            d.pending.push_back({d.next_seq++, d.raw_offset, std::move(d.frame)});
+        }
+        d.todo.notify_one();
+        d.raw_offset += size;
+        d.frame = {};
+        d.frame.reserve(zlog_frame_size);
+    }
+}
+
+bool tracer::open_zlog(tracer::Zlog& log, const fs::path& path, size_t workers)
+{
+    auto& d = *log.d_;
+    if(!file::map_write(d.writer, path, binlog_chunk))
+        return FAIL(false, "unable to create trace %s", path.generic_string().data());
+
+    auto* dst = static_cast<uint8_t*>(file::map_grow(d.writer, sizeof zlog_magic + sizeof zlog_version));
+    if(!dst)
+        return false;
+
+    memcpy(dst, zlog_magic, sizeof zlog_magic);
+    write_le32(dst + sizeof zlog_magic, zlog_version);
+    d.frame.reserve(zlog_frame_size);
+    d.writer_thread = std::thread{[&d] { zlog_writer(d); }};
+    for(size_t i = 0; i < std::max<size_t>(workers, 1); ++i)
+        d.workers.emplace_back([&d] { zlog_worker(d); });
+    return true;
+}
+
+bool tracer::close_zlog(tracer::Zlog& log)
+{
+    auto& d = *log.d_;
+    if(!d.writer.os_a)
+        return false;
+
+    zlog_cut_frame(d);
+    {
+        const auto lock = std::lock_guard{d.mutex};
+        d.stop          = true;
+    }
+    d.todo.notify_all();
+    for(auto& worker : d.workers)
+        worker.join();
+    d.done_cv.notify_all();
+    if(d.writer_thread.joinable())
+        d.writer_thread.join();
+
+    // footer: the index, its count & a trailing magic for validation
+    const auto count = d.index.size();
+    auto*      dst   = static_cast<uint8_t*>(file::map_grow(d.writer, count * sizeof(zlog_frame_t) + sizeof(uint64_t) + sizeof zlog_magic));
+    if(dst)
+    {
+        for(const auto& frame : d.index)
+        {
+            write_le64(dst + 0x00, frame.file_offset);
+            write_le64(dst + 0x08, frame.comp_size);
+            write_le64(dst + 0x10, frame.raw_offset);
+            write_le64(dst + 0x18, frame.raw_size);
+            dst += sizeof(zlog_frame_t);
+        }
+        write_le64(dst, count);
+        memcpy(dst + sizeof(uint64_t), zlog_magic, sizeof zlog_magic);
+    }
+    d.ids.clear();
+    d.index.clear();
+    d.workers.clear();
+    d.stop = false;
+    return file::map_close(d.writer);
+}
+
+bool tracer::zlog_event(tracer::Zlog& log, core::Core& core, const tracer::callcfg_t& call)
+{
+    auto& d = *log.d_;
+    if(!d.writer.os_a)
+        return false;
+
+    // every frame is self-describing: restart defines on a cut so a
+    // reader can start from any frame in the index
+    const auto it = d.ids.find(&call);
+    auto       id = uint16_t{};
+    if(it != d.ids.end())
+        id = it->second;
+    else
+    {
+        id = static_cast<uint16_t>(d.ids.size());
+        d.frame.push_back(record_define);
+        append_le(d.frame, id, sizeof id);
+        d.frame.push_back(static_cast<uint8_t>(call.argc));
+        append_str(d.frame, call.name);
+        for(size_t i = 0; i < call.argc; ++i)
+        {
+            d.frame.push_back(static_cast<uint8_t>(call.args[i].size));
+            append_str(d.frame, call.args[i].type);
+            append_str(d.frame, call.args[i].name);
+        }
+        d.ids.emplace(&call, id);
+    }
+
+    const auto now    = std::chrono::steady_clock::now().time_since_epoch();
+    const auto ts     = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    const auto proc   = process::current(core);
+    const auto thread = threads::current(core);
+    d.frame.push_back(record_event);
+    append_le(d.frame, id, sizeof id);
+    append_le(d.frame, static_cast<uint64_t>(ts), sizeof(uint64_t));
+    append_le(d.frame, proc ? proc->id : 0, sizeof(uint64_t));
+    append_le(d.frame, thread ? thread->id : 0, sizeof(uint64_t));
+    for(size_t i = 0; i < call.argc; ++i)
+    {
+        // guest reads must happen here, while the vm is paused on the breakpoint
+        const auto arg = functions::read_arg(core, i);
+        append_le(d.frame, arg ? arg->val : 0, call.args[i].size);
+    }
+    if(d.frame.size() >= zlog_frame_size)
+    {
+        zlog_cut_frame(d);
+        d.ids.clear();
+    }
+    return true;
+}
+
+void tracer::zlog_set_level(tracer::Zlog& log, int level)
+{
+    log.d_->level.store(std::clamp(level, lz::min_level, lz::max_level), std::memory_order_relaxed);
+}
+
+opt<std::vector<tracer::zlog_frame_t>> tracer::zlog_index(const fs::path& path)
+{
+    auto map = file::Map{};
+    if(!file::map_read(map, path))
+        return {};
+
+    const auto* base = static_cast<const uint8_t*>(map.data);
+    auto        ret  = opt<std::vector<zlog_frame_t>>{};
+    const auto  tail = sizeof(uint64_t) + sizeof zlog_magic;
+    if(map.size >= sizeof zlog_magic + tail
+       && !memcmp(base, zlog_magic, sizeof zlog_magic)
+       && !memcmp(&base[map.size - sizeof zlog_magic], zlog_magic, sizeof zlog_magic))
+    {
+        const auto count = read_le64(&base[map.size - tail]);
+        const auto bytes = count * sizeof(zlog_frame_t);
+        if(bytes + tail <= map.size)
+        {
+            auto index      = std::vector<zlog_frame_t>{};
+            index.reserve(count);
+            const auto* ptr = &base[map.size - tail - bytes];
+            for(uint64_t i = 0; i < count; ++i, ptr += sizeof(zlog_frame_t))
+                index.push_back({read_le64(ptr + 0x00), read_le64(ptr + 0x08), read_le64(ptr + 0x10), read_le64(ptr + 0x18)});
+            ret = std::move(index);
+        }
+    }
+    file::unmap(map);
+    return ret;
+}
+
+bool tracer::zlog_read_frame(const fs::path& path, const tracer::zlog_frame_t& frame, std::vector<uint8_t>& dst)
+{
+    auto map = file::Map{};
+    if(!file::map_read(map, path))
+        return false;
+
+    auto ok = false;
+    if(frame.file_offset + frame.comp_size <= map.size)
+    {
+        dst.resize(frame.raw_size);
+        const auto* base = static_cast<const uint8_t*>(map.data);
+        ok               = lz::decompress(dst.data(), dst.size(), &base[frame.file_offset], frame.comp_size) == frame.raw_size;
+    }
+    file::unmap(map);
+    return ok;
+}
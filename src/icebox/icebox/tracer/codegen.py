@@ -34,6 +34,9 @@ def generate_header(json_data, filename, namespace, pad, wow64):
 
 #include <array>
 #include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace core {{ struct Core; }}
 
@@ -48,9 +51,15 @@ namespace {namespace}
 
         using on_call_fn = std::function<void(const tracer::callcfg_t& callcfg)>;
         using callcfgs_t = std::array<tracer::callcfg_t, {size}>;
+        // filter entries are exact names or prefixes ending with '*'
+        using filter_t   = std::vector<std::string>;
 
         opt<bpid_t>                 register_all(proc_t proc, const on_call_fn& on_call);
+        opt<bpid_t>                 register_filtered(proc_t proc, const filter_t& filter, const on_call_fn& on_call);
+        bool                        refilter    (const filter_t& filter);
+        void                        set_sampling(std::string_view name, uint64_t one_in);
         static const callcfgs_t&    callcfgs    ();
+        static const tracer::callcfg_t* find(std::string_view name);
 
 {listens}
 
@@ -80,11 +89,16 @@ def generate_definitions(json_data, filename, namespace, wow64):
         read_args = ""
         names = []
         for name, typeof in args:
-            read_args += "\n        const auto %s = arg<%s::%s>(core, %d);" % (name.ljust(pad), namespace, typeof, idx)
+            read_args += "\n        const auto %s = arg<%s::%s>(args, %d);" % (name.ljust(pad), namespace, typeof, idx)
             idx += 1
             names.append(name)
         if idx > 0:
-            read_args += "\n"
+            read_args = """
+        auto args = std::array<arg_t, %d>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+%s
+""" % (idx, read_args)
 
         definitions += """
 opt<bpid_t> {namespace}::{filename}::register_{target}(proc_t proc, const on_{target}_fn& on_func)
@@ -119,16 +133,39 @@ def generate_impl(json_data, filename, namespace, pad, wow64):
 #include "log.hpp"
 #include "core.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace
 {{
     constexpr bool g_debug = false;
 
+    // 1-in-n sampling counter, see set_sampling
+    struct sample_t
+    {{
+        uint64_t one_in;
+        uint64_t count;
+    }};
+
+    // one entry per filtered callcfg, flipped between armed & disarmed
+    struct armed_t
+    {{
+        const tracer::callcfg_t* cfg;
+        state::Breakpoint        bp;
+        bool                     armed;
+    }};
+
     constexpr {namespace}::{filename}::callcfgs_t g_callcfgs =
     {{{{
 {callers}
     }}}};
+
+    // published to the runtime prototype registry so typed breakpoints
+    // resolve these apis by name, see tracer::break_on_prototype
+    [[maybe_unused]] const auto g_prototypes_registered = tracer::register_prototypes(&g_callcfgs[0], g_callcfgs.size());
 }}
 
 struct {namespace}::{filename}::Data
@@ -137,11 +174,21 @@ struct {namespace}::{filename}::Data
 
     core::Core&   core;
     std::string   module;
+
+    std::unordered_map<std::string, sample_t> sampling;
+
+    // filtered registration state, see register_filtered
+    bpid_t               filter_bpid;
+    proc_t               filter_proc;
+    on_call_fn           filter_on_call;
+    std::vector<armed_t> filter_bps;
 }};
 
 {namespace}::{filename}::Data::Data(core::Core& core, std::string_view module)
     : core(core)
     , module(module)
+    , filter_bpid()
+    , filter_proc()
 {{
 }}
 
@@ -152,20 +199,80 @@ struct {namespace}::{filename}::Data
 
 {namespace}::{filename}::~{filename}() = default;
 
+namespace
+{{
+    // constexpr name index, no map construction at startup
+    constexpr auto g_callcfg_index = tracer::index_names(g_callcfgs);
+}}
+
 const {namespace}::{filename}::callcfgs_t& {namespace}::{filename}::callcfgs()
 {{
     return g_callcfgs;
 }}
 
+const tracer::callcfg_t* {namespace}::{filename}::find(std::string_view name)
+{{
+    return tracer::find_name(g_callcfgs, g_callcfg_index, name);
+}}
+
+void {namespace}::{filename}::set_sampling(std::string_view name, uint64_t one_in)
+{{
+    if(!find(name))
+    {{
+        LOG(ERROR, "unknown call %.*s", static_cast<int>(name.size()), name.data());
+        return;
+    }}
+
+    if(one_in < 2)
+        d_->sampling.erase(std::string{{name}});
+    else
+        d_->sampling[std::string{{name}}] = sample_t{{one_in, 0}};
+}}
+
 namespace
 {{
+    bool keep_call({namespace}::{filename}::Data& d, const char* name)
+    {{
+        if(d.sampling.empty())
+            return true;
+
+        const auto it = d.sampling.find(name);
+        if(it == d.sampling.end())
+            return true;
+
+        return it->second.count++ % it->second.one_in == 0;
+    }}
+
+    bool match_filter(const {namespace}::{filename}::filter_t& filter, std::string_view name)
+    {{
+        for(const auto& entry : filter)
+        {{
+            if(!entry.empty() && entry.back() == '*')
+            {{
+                const auto prefix = std::string_view{{entry.data(), entry.size() - 1}};
+                if(name.substr(0, prefix.size()) == prefix)
+                    return true;
+            }}
+            else if(name == entry)
+                return true;
+        }}
+        return false;
+    }}
+
     opt<bpid_t> register_callback_with({namespace}::{filename}::Data& d, bpid_t bpid, proc_t proc, const char* name, const state::Task& on_call)
     {{
         const auto addr = symbols::address(d.core, proc, d.module, name);
         if(!addr)
             return FAIL(std::nullopt, "unable to find symbole %s!%s", d.module.data(), name);
 
-        const auto bp = state::break_on_process(d.core, name, proc, *addr, on_call);
+        // sampled-out calls return before any argument read or
+        // callstack capture, the expensive part of every trigger
+        auto& data    = d;
+        const auto bp = state::break_on_process(d.core, name, proc, *addr, [&data, name, on_call]
+        {{
+            if(keep_call(data, name))
+                on_call();
+        }});
         if(!bp)
             return FAIL(std::nullopt, "unable to set breakpoint");
 
@@ -178,16 +285,33 @@ namespace
         return register_callback_with(d, bpid, proc, name, on_call);
     }}
 
-    template <typename T>
-    T arg(core::Core& core, size_t i)
+    state::Breakpoint arm_filtered({namespace}::{filename}::Data& d, bpid_t bpid, proc_t proc, const tracer::callcfg_t& cfg, const {namespace}::{filename}::on_call_fn& on_call)
     {{
-        const auto arg = functions::read_arg(core, i);
-        if(!arg)
-            return {{}};
+        const auto addr = symbols::address(d.core, proc, d.module, cfg.name);
+        if(!addr)
+            return FAIL(nullptr, "unable to find symbole %s!%s", d.module.data(), cfg.name);
+
+        auto& data    = d;
+        const auto bp = state::break_on_process(d.core, cfg.name, proc, *addr, [&data, &cfg, on_call]
+        {{
+            if(keep_call(data, cfg.name))
+                on_call(cfg);
+        }});
+        if(!bp)
+            return FAIL(nullptr, "unable to set breakpoint");
+
+        state::save_breakpoint_with(d.core, bpid, bp);
+        return bp;
+    }}
 
+    // registers & the stack span are fetched in one batched
+    // functions::read_args call, args are then decoded locally
+    template <typename T, size_t N>
+    T arg(const std::array<arg_t, N>& args, size_t i)
+    {{
         T value = {{}};
-        static_assert(sizeof value <= sizeof arg->val, "invalid size");
-        memcpy(&value, &arg->val, sizeof value);
+        static_assert(sizeof value <= sizeof args[0].val, "invalid size");
+        memcpy(&value, &args[i].val, sizeof value);
         return value;
     }}
 }}
@@ -200,6 +324,69 @@ opt<bpid_t> {namespace}::{filename}::register_all(proc_t proc, const {namespace}
         register_callback_with(d, bpid, proc, cfg.name, [=]{{ on_call(cfg); }});
     return bpid;
 }}
+
+opt<bpid_t> {namespace}::{filename}::register_filtered(proc_t proc, const filter_t& filter, const on_call_fn& on_call)
+{{
+    auto& d          = *d_;
+    d.filter_bpid    = state::acquire_breakpoint_id(d.core);
+    d.filter_proc    = proc;
+    d.filter_on_call = on_call;
+    d.filter_bps.clear();
+    // only matching entries get a breakpoint, every other target stays
+    // free of foreign hits & channel traffic
+    for(const auto& cfg : g_callcfgs)
+    {{
+        if(!match_filter(filter, cfg.name))
+            continue;
+
+        const auto bp = arm_filtered(d, d.filter_bpid, proc, cfg, on_call);
+        if(bp)
+            d.filter_bps.push_back({{&cfg, bp, true}});
+    }}
+    return d.filter_bpid;
+}}
+
+bool {namespace}::{filename}::refilter(const filter_t& filter)
+{{
+    auto& d = *d_;
+    if(!d.filter_on_call)
+        return false;
+
+    // flip existing breakpoints in two batches, one per direction
+    auto disarm = state::breakpoint_group(d.core);
+    auto rearm  = state::breakpoint_group_disarmed(d.core);
+    for(auto& entry : d.filter_bps)
+    {{
+        const auto keep = match_filter(filter, entry.cfg->name);
+        if(keep == entry.armed)
+            continue;
+
+        state::group_add(keep ? rearm : disarm, entry.bp);
+        entry.armed = keep;
+    }}
+    auto ok = state::group_disarm(d.core, disarm);
+    ok &= state::group_rearm(d.core, rearm);
+    // newly-matched targets without a breakpoint yet are armed on creation
+    for(const auto& cfg : g_callcfgs)
+    {{
+        if(!match_filter(filter, cfg.name))
+            continue;
+
+        const auto it = std::find_if(d.filter_bps.begin(), d.filter_bps.end(), [&](const armed_t& entry)
+        {{
+            return entry.cfg == &cfg;
+        }});
+        if(it != d.filter_bps.end())
+            continue;
+
+        const auto bp = arm_filtered(d, d.filter_bpid, d.filter_proc, cfg, d.filter_on_call);
+        if(bp)
+            d.filter_bps.push_back({{&cfg, bp, true}});
+        else
+            ok = false;
+    }}
+    return ok;
+}}
 """.format(filename=filename, namespace=namespace,
         definitions=generate_definitions(json_data, filename, namespace, wow64),
         callers=generate_callers(json_data, namespace, wow64))
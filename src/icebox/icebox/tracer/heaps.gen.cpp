@@ -4,14 +4,34 @@
 #include "log.hpp"
 #include "core.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace
 {
     constexpr bool g_debug = false;
 
+    // 1-in-n sampling counter, see set_sampling
+    struct sample_t
+    {
+        uint64_t one_in;
+        uint64_t count;
+    };
+
+    // one entry per filtered callcfg, flipped between armed & disarmed
+    struct armed_t
+    {
+        const tracer::callcfg_t* cfg;
+        state::Breakpoint        bp;
+        bool                     armed;
+    };
+
     constexpr nt::heaps::callcfgs_t g_callcfgs =
     {{
+        {"RtlDestroyHeap", 1, {{"PVOID", "HeapHandle", sizeof(nt::PVOID)}}},
         {"RtlFreeHeap", 3, {{"PVOID", "HeapHandle", sizeof(nt::PVOID)}, {"ULONG", "Flags", sizeof(nt::ULONG)}, {"PVOID", "BaseAddress", sizeof(nt::PVOID)}}},
         {"RtlGetUserInfoHeap", 5, {{"PVOID", "HeapHandle", sizeof(nt::PVOID)}, {"ULONG", "Flags", sizeof(nt::ULONG)}, {"PVOID", "BaseAddress", sizeof(nt::PVOID)}, {"PVOID", "UserValue", sizeof(nt::PVOID)}, {"PULONG", "UserFlags", sizeof(nt::PULONG)}}},
         {"RtlSetUserValueHeap", 4, {{"PVOID", "HeapHandle", sizeof(nt::PVOID)}, {"ULONG", "Flags", sizeof(nt::ULONG)}, {"PVOID", "BaseAddress", sizeof(nt::PVOID)}, {"PVOID", "UserValue", sizeof(nt::PVOID)}}},
@@ -19,6 +39,10 @@ namespace
         {"RtlpAllocateHeapInternal", 2, {{"PVOID", "HeapHandle", sizeof(nt::PVOID)}, {"SIZE_T", "Size", sizeof(nt::SIZE_T)}}},
         {"RtlpReAllocateHeapInternal", 4, {{"PVOID", "HeapHandle", sizeof(nt::PVOID)}, {"ULONG", "Flags", sizeof(nt::ULONG)}, {"PVOID", "BaseAddress", sizeof(nt::PVOID)}, {"ULONG", "Size", sizeof(nt::ULONG)}}},
     }};
+
+    // published to the runtime prototype registry so typed breakpoints
+    // resolve these apis by name, see tracer::break_on_prototype
+    [[maybe_unused]] const auto g_prototypes_registered = tracer::register_prototypes(&g_callcfgs[0], g_callcfgs.size());
 }
 
 struct nt::heaps::Data
@@ -27,11 +51,21 @@ struct nt::heaps::Data
 
     core::Core&   core;
     std::string   module;
+
+    std::unordered_map<std::string, sample_t> sampling;
+
+    // filtered registration state, see register_filtered
+    bpid_t               filter_bpid;
+    proc_t               filter_proc;
+    on_call_fn           filter_on_call;
+    std::vector<armed_t> filter_bps;
 };
 
 nt::heaps::Data::Data(core::Core& core, std::string_view module)
     : core(core)
     , module(module)
+    , filter_bpid()
+    , filter_proc()
 {
 }
 
@@ -42,20 +76,80 @@ nt::heaps::heaps(core::Core& core, std::string_view module)
 
 nt::heaps::~heaps() = default;
 
+namespace
+{
+    // constexpr name index, no map construction at startup
+    constexpr auto g_callcfg_index = tracer::index_names(g_callcfgs);
+}
+
 const nt::heaps::callcfgs_t& nt::heaps::callcfgs()
 {
     return g_callcfgs;
 }
 
+const tracer::callcfg_t* nt::heaps::find(std::string_view name)
+{
+    return tracer::find_name(g_callcfgs, g_callcfg_index, name);
+}
+
+void nt::heaps::set_sampling(std::string_view name, uint64_t one_in)
+{
+    if(!find(name))
+    {
+        LOG(ERROR, "unknown call %.*s", static_cast<int>(name.size()), name.data());
+        return;
+    }
+
+    if(one_in < 2)
+        d_->sampling.erase(std::string{name});
+    else
+        d_->sampling[std::string{name}] = sample_t{one_in, 0};
+}
+
 namespace
 {
+    bool keep_call(nt::heaps::Data& d, const char* name)
+    {
+        if(d.sampling.empty())
+            return true;
+
+        const auto it = d.sampling.find(name);
+        if(it == d.sampling.end())
+            return true;
+
+        return it->second.count++ % it->second.one_in == 0;
+    }
+
+    bool match_filter(const nt::heaps::filter_t& filter, std::string_view name)
+    {
+        for(const auto& entry : filter)
+        {
+            if(!entry.empty() && entry.back() == '*')
+            {
+                const auto prefix = std::string_view{entry.data(), entry.size() - 1};
+                if(name.substr(0, prefix.size()) == prefix)
+                    return true;
+            }
+            else if(name == entry)
+                return true;
+        }
+        return false;
+    }
+
     opt<bpid_t> register_callback_with(nt::heaps::Data& d, bpid_t bpid, proc_t proc, const char* name, const state::Task& on_call)
     {
         const auto addr = symbols::address(d.core, proc, d.module, name);
         if(!addr)
             return FAIL(std::nullopt, "unable to find symbole %s!%s", d.module.data(), name);
 
-        const auto bp = state::break_on_process(d.core, name, proc, *addr, on_call);
+        // sampled-out calls return before any argument read or
+        // callstack capture, the expensive part of every trigger
+        auto& data    = d;
+        const auto bp = state::break_on_process(d.core, name, proc, *addr, [&data, name, on_call]
+        {
+            if(keep_call(data, name))
+                on_call();
+        });
         if(!bp)
             return FAIL(std::nullopt, "unable to set breakpoint");
 
@@ -68,32 +162,72 @@ namespace
         return register_callback_with(d, bpid, proc, name, on_call);
     }
 
-    template <typename T>
-    T arg(core::Core& core, size_t i)
+    state::Breakpoint arm_filtered(nt::heaps::Data& d, bpid_t bpid, proc_t proc, const tracer::callcfg_t& cfg, const nt::heaps::on_call_fn& on_call)
     {
-        const auto arg = functions::read_arg(core, i);
-        if(!arg)
-            return {};
+        const auto addr = symbols::address(d.core, proc, d.module, cfg.name);
+        if(!addr)
+            return FAIL(nullptr, "unable to find symbole %s!%s", d.module.data(), cfg.name);
+
+        auto& data    = d;
+        const auto bp = state::break_on_process(d.core, cfg.name, proc, *addr, [&data, &cfg, on_call]
+        {
+            if(keep_call(data, cfg.name))
+                on_call(cfg);
+        });
+        if(!bp)
+            return FAIL(nullptr, "unable to set breakpoint");
+
+        state::save_breakpoint_with(d.core, bpid, bp);
+        return bp;
+    }
 
+    // registers & the stack span are fetched in one batched
+    // functions::read_args call, args are then decoded locally
+    template <typename T, size_t N>
+    T arg(const std::array<arg_t, N>& args, size_t i)
+    {
         T value = {};
-        static_assert(sizeof value <= sizeof arg->val, "invalid size");
-        memcpy(&value, &arg->val, sizeof value);
+        static_assert(sizeof value <= sizeof args[0].val, "invalid size");
+        memcpy(&value, &args[i].val, sizeof value);
         return value;
     }
 }
 
+opt<bpid_t> nt::heaps::register_RtlDestroyHeap(proc_t proc, const on_RtlDestroyHeap_fn& on_func)
+{
+    return register_callback(*d_, proc, "RtlDestroyHeap", [=]
+    {
+        auto& core = d_->core;
+
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto HeapHandle = arg<nt::PVOID>(args, 0);
+
+        if constexpr(g_debug)
+            tracer::log_call(core, g_callcfgs[0]);
+
+        on_func(HeapHandle);
+    });
+}
+
 opt<bpid_t> nt::heaps::register_RtlFreeHeap(proc_t proc, const on_RtlFreeHeap_fn& on_func)
 {
     return register_callback(*d_, proc, "RtlFreeHeap", [=]
     {
         auto& core = d_->core;
 
-        const auto HeapHandle  = arg<nt::PVOID>(core, 0);
-        const auto Flags       = arg<nt::ULONG>(core, 1);
-        const auto BaseAddress = arg<nt::PVOID>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto HeapHandle  = arg<nt::PVOID>(args, 0);
+        const auto Flags       = arg<nt::ULONG>(args, 1);
+        const auto BaseAddress = arg<nt::PVOID>(args, 2);
 
         if constexpr(g_debug)
-            tracer::log_call(core, g_callcfgs[0]);
+            tracer::log_call(core, g_callcfgs[1]);
 
         on_func(HeapHandle, Flags, BaseAddress);
     });
@@ -105,14 +239,18 @@ opt<bpid_t> nt::heaps::register_RtlGetUserInfoHeap(proc_t proc, const on_RtlGetU
     {
         auto& core = d_->core;
 
-        const auto HeapHandle  = arg<nt::PVOID>(core, 0);
-        const auto Flags       = arg<nt::ULONG>(core, 1);
-        const auto BaseAddress = arg<nt::PVOID>(core, 2);
-        const auto UserValue   = arg<nt::PVOID>(core, 3);
-        const auto UserFlags   = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto HeapHandle  = arg<nt::PVOID>(args, 0);
+        const auto Flags       = arg<nt::ULONG>(args, 1);
+        const auto BaseAddress = arg<nt::PVOID>(args, 2);
+        const auto UserValue   = arg<nt::PVOID>(args, 3);
+        const auto UserFlags   = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
-            tracer::log_call(core, g_callcfgs[1]);
+            tracer::log_call(core, g_callcfgs[2]);
 
         on_func(HeapHandle, Flags, BaseAddress, UserValue, UserFlags);
     });
@@ -124,13 +262,17 @@ opt<bpid_t> nt::heaps::register_RtlSetUserValueHeap(proc_t proc, const on_RtlSet
     {
         auto& core = d_->core;
 
-        const auto HeapHandle  = arg<nt::PVOID>(core, 0);
-        const auto Flags       = arg<nt::ULONG>(core, 1);
-        const auto BaseAddress = arg<nt::PVOID>(core, 2);
-        const auto UserValue   = arg<nt::PVOID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto HeapHandle  = arg<nt::PVOID>(args, 0);
+        const auto Flags       = arg<nt::ULONG>(args, 1);
+        const auto BaseAddress = arg<nt::PVOID>(args, 2);
+        const auto UserValue   = arg<nt::PVOID>(args, 3);
 
         if constexpr(g_debug)
-            tracer::log_call(core, g_callcfgs[2]);
+            tracer::log_call(core, g_callcfgs[3]);
 
         on_func(HeapHandle, Flags, BaseAddress, UserValue);
     });
@@ -142,12 +284,16 @@ opt<bpid_t> nt::heaps::register_RtlSizeHeap(proc_t proc, const on_RtlSizeHeap_fn
     {
         auto& core = d_->core;
 
-        const auto HeapHandle  = arg<nt::PVOID>(core, 0);
-        const auto Flags       = arg<nt::ULONG>(core, 1);
-        const auto BaseAddress = arg<nt::PVOID>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto HeapHandle  = arg<nt::PVOID>(args, 0);
+        const auto Flags       = arg<nt::ULONG>(args, 1);
+        const auto BaseAddress = arg<nt::PVOID>(args, 2);
 
         if constexpr(g_debug)
-            tracer::log_call(core, g_callcfgs[3]);
+            tracer::log_call(core, g_callcfgs[4]);
 
         on_func(HeapHandle, Flags, BaseAddress);
     });
@@ -159,11 +305,15 @@ opt<bpid_t> nt::heaps::register_RtlpAllocateHeapInternal(proc_t proc, const on_R
     {
         auto& core = d_->core;
 
-        const auto HeapHandle = arg<nt::PVOID>(core, 0);
-        const auto Size       = arg<nt::SIZE_T>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto HeapHandle = arg<nt::PVOID>(args, 0);
+        const auto Size       = arg<nt::SIZE_T>(args, 1);
 
         if constexpr(g_debug)
-            tracer::log_call(core, g_callcfgs[4]);
+            tracer::log_call(core, g_callcfgs[5]);
 
         on_func(HeapHandle, Size);
     });
@@ -175,13 +325,17 @@ opt<bpid_t> nt::heaps::register_RtlpReAllocateHeapInternal(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto HeapHandle  = arg<nt::PVOID>(core, 0);
-        const auto Flags       = arg<nt::ULONG>(core, 1);
-        const auto BaseAddress = arg<nt::PVOID>(core, 2);
-        const auto Size        = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto HeapHandle  = arg<nt::PVOID>(args, 0);
+        const auto Flags       = arg<nt::ULONG>(args, 1);
+        const auto BaseAddress = arg<nt::PVOID>(args, 2);
+        const auto Size        = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
-            tracer::log_call(core, g_callcfgs[5]);
+            tracer::log_call(core, g_callcfgs[6]);
 
         on_func(HeapHandle, Flags, BaseAddress, Size);
     });
@@ -195,3 +349,66 @@ opt<bpid_t> nt::heaps::register_all(proc_t proc, const nt::heaps::on_call_fn& on
         register_callback_with(d, bpid, proc, cfg.name, [=]{ on_call(cfg); });
     return bpid;
 }
+
+opt<bpid_t> nt::heaps::register_filtered(proc_t proc, const filter_t& filter, const on_call_fn& on_call)
+{
+    auto& d          = *d_;
+    d.filter_bpid    = state::acquire_breakpoint_id(d.core);
+    d.filter_proc    = proc;
+    d.filter_on_call = on_call;
+    d.filter_bps.clear();
+    // only matching entries get a breakpoint, every other target stays
+    // free of foreign hits & channel traffic
+    for(const auto& cfg : g_callcfgs)
+    {
+        if(!match_filter(filter, cfg.name))
+            continue;
+
+        const auto bp = arm_filtered(d, d.filter_bpid, proc, cfg, on_call);
+        if(bp)
+            d.filter_bps.push_back({&cfg, bp, true});
+    }
+    return d.filter_bpid;
+}
+
+bool nt::heaps::refilter(const filter_t& filter)
+{
+    auto& d = *d_;
+    if(!d.filter_on_call)
+        return false;
+
+    // flip existing breakpoints in two batches, one per direction
+    auto disarm = state::breakpoint_group(d.core);
+    auto rearm  = state::breakpoint_group_disarmed(d.core);
+    for(auto& entry : d.filter_bps)
+    {
+        const auto keep = match_filter(filter, entry.cfg->name);
+        if(keep == entry.armed)
+            continue;
+
+        state::group_add(keep ? rearm : disarm, entry.bp);
+        entry.armed = keep;
+    }
+    auto ok = state::group_disarm(d.core, disarm);
+    ok &= state::group_rearm(d.core, rearm);
+    // newly-matched targets without a breakpoint yet are armed on creation
+    for(const auto& cfg : g_callcfgs)
+    {
+        if(!match_filter(filter, cfg.name))
+            continue;
+
+        const auto it = std::find_if(d.filter_bps.begin(), d.filter_bps.end(), [&](const armed_t& entry)
+        {
+            return entry.cfg == &cfg;
+        });
+        if(it != d.filter_bps.end())
+            continue;
+
+        const auto bp = arm_filtered(d, d.filter_bpid, d.filter_proc, cfg, d.filter_on_call);
+        if(bp)
+            d.filter_bps.push_back({&cfg, bp, true});
+        else
+            ok = false;
+    }
+    return ok;
+}
@@ -6,11 +6,15 @@
 
 #include <array>
 #include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace core { struct Core; }
 
 namespace nt
 {
+    using on_RtlDestroyHeap_fn             = std::function<void(PVOID)>;
     using on_RtlFreeHeap_fn                = std::function<void(PVOID, ULONG, PVOID)>;
     using on_RtlGetUserInfoHeap_fn         = std::function<void(PVOID, ULONG, PVOID, PVOID, PULONG)>;
     using on_RtlSetUserValueHeap_fn        = std::function<void(PVOID, ULONG, PVOID, PVOID)>;
@@ -24,11 +28,18 @@ namespace nt
         ~heaps();
 
         using on_call_fn = std::function<void(const tracer::callcfg_t& callcfg)>;
-        using callcfgs_t = std::array<tracer::callcfg_t, 6>;
+        using callcfgs_t = std::array<tracer::callcfg_t, 7>;
+        // filter entries are exact names or prefixes ending with '*'
+        using filter_t   = std::vector<std::string>;
 
         opt<bpid_t>                 register_all(proc_t proc, const on_call_fn& on_call);
+        opt<bpid_t>                 register_filtered(proc_t proc, const filter_t& filter, const on_call_fn& on_call);
+        bool                        refilter    (const filter_t& filter);
+        void                        set_sampling(std::string_view name, uint64_t one_in);
         static const callcfgs_t&    callcfgs    ();
+        static const tracer::callcfg_t* find(std::string_view name);
 
+        opt<bpid_t> register_RtlDestroyHeap            (proc_t proc, const on_RtlDestroyHeap_fn& on_func);
         opt<bpid_t> register_RtlFreeHeap               (proc_t proc, const on_RtlFreeHeap_fn& on_func);
         opt<bpid_t> register_RtlGetUserInfoHeap        (proc_t proc, const on_RtlGetUserInfoHeap_fn& on_func);
         opt<bpid_t> register_RtlSetUserValueHeap       (proc_t proc, const on_RtlSetUserValueHeap_fn& on_func);
@@ -4,12 +4,31 @@
 #include "log.hpp"
 #include "core.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace
 {
     constexpr bool g_debug = false;
 
+    // 1-in-n sampling counter, see set_sampling
+    struct sample_t
+    {
+        uint64_t one_in;
+        uint64_t count;
+    };
+
+    // one entry per filtered callcfg, flipped between armed & disarmed
+    struct armed_t
+    {
+        const tracer::callcfg_t* cfg;
+        state::Breakpoint        bp;
+        bool                     armed;
+    };
+
     constexpr nt::syscalls::callcfgs_t g_callcfgs =
     {{
         {"NtAcceptConnectPort", 6, {{"PHANDLE", "PortHandle", sizeof(nt::PHANDLE)}, {"PVOID", "PortContext", sizeof(nt::PVOID)}, {"PPORT_MESSAGE", "ConnectionRequest", sizeof(nt::PPORT_MESSAGE)}, {"BOOLEAN", "AcceptConnection", sizeof(nt::BOOLEAN)}, {"PPORT_VIEW", "ServerView", sizeof(nt::PPORT_VIEW)}, {"PREMOTE_PORT_VIEW", "ClientView", sizeof(nt::PREMOTE_PORT_VIEW)}}},
@@ -412,6 +431,10 @@ namespace
         {"ZwWriteRequestData", 6, {{"HANDLE", "PortHandle", sizeof(nt::HANDLE)}, {"PPORT_MESSAGE", "Message", sizeof(nt::PPORT_MESSAGE)}, {"ULONG", "DataEntryIndex", sizeof(nt::ULONG)}, {"PVOID", "Buffer", sizeof(nt::PVOID)}, {"SIZE_T", "BufferSize", sizeof(nt::SIZE_T)}, {"PSIZE_T", "NumberOfBytesWritten", sizeof(nt::PSIZE_T)}}},
         {"ZwYieldExecution", 0, {}},
     }};
+
+    // published to the runtime prototype registry so typed breakpoints
+    // resolve these apis by name, see tracer::break_on_prototype
+    [[maybe_unused]] const auto g_prototypes_registered = tracer::register_prototypes(&g_callcfgs[0], g_callcfgs.size());
 }
 
 struct nt::syscalls::Data
@@ -420,11 +443,21 @@ struct nt::syscalls::Data
 
     core::Core&   core;
     std::string   module;
+
+    std::unordered_map<std::string, sample_t> sampling;
+
+    // filtered registration state, see register_filtered
+    bpid_t               filter_bpid;
+    proc_t               filter_proc;
+    on_call_fn           filter_on_call;
+    std::vector<armed_t> filter_bps;
 };
 
 nt::syscalls::Data::Data(core::Core& core, std::string_view module)
     : core(core)
     , module(module)
+    , filter_bpid()
+    , filter_proc()
 {
 }
 
@@ -435,20 +468,80 @@ nt::syscalls::syscalls(core::Core& core, std::string_view module)
 
 nt::syscalls::~syscalls() = default;
 
+namespace
+{
+    // constexpr name index, no map construction at startup
+    constexpr auto g_callcfg_index = tracer::index_names(g_callcfgs);
+}
+
 const nt::syscalls::callcfgs_t& nt::syscalls::callcfgs()
 {
     return g_callcfgs;
 }
 
+const tracer::callcfg_t* nt::syscalls::find(std::string_view name)
+{
+    return tracer::find_name(g_callcfgs, g_callcfg_index, name);
+}
+
+void nt::syscalls::set_sampling(std::string_view name, uint64_t one_in)
+{
+    if(!find(name))
+    {
+        LOG(ERROR, "unknown call %.*s", static_cast<int>(name.size()), name.data());
+        return;
+    }
+
+    if(one_in < 2)
+        d_->sampling.erase(std::string{name});
+    else
+        d_->sampling[std::string{name}] = sample_t{one_in, 0};
+}
+
 namespace
 {
+    bool keep_call(nt::syscalls::Data& d, const char* name)
+    {
+        if(d.sampling.empty())
+            return true;
+
+        const auto it = d.sampling.find(name);
+        if(it == d.sampling.end())
+            return true;
+
+        return it->second.count++ % it->second.one_in == 0;
+    }
+
+    bool match_filter(const nt::syscalls::filter_t& filter, std::string_view name)
+    {
+        for(const auto& entry : filter)
+        {
+            if(!entry.empty() && entry.back() == '*')
+            {
+                const auto prefix = std::string_view{entry.data(), entry.size() - 1};
+                if(name.substr(0, prefix.size()) == prefix)
+                    return true;
+            }
+            else if(name == entry)
+                return true;
+        }
+        return false;
+    }
+
     opt<bpid_t> register_callback_with(nt::syscalls::Data& d, bpid_t bpid, proc_t proc, const char* name, const state::Task& on_call)
     {
         const auto addr = symbols::address(d.core, proc, d.module, name);
         if(!addr)
             return FAIL(std::nullopt, "unable to find symbole %s!%s", d.module.data(), name);
 
-        const auto bp = state::break_on_process(d.core, name, proc, *addr, on_call);
+        // sampled-out calls return before any argument read or
+        // callstack capture, the expensive part of every trigger
+        auto& data    = d;
+        const auto bp = state::break_on_process(d.core, name, proc, *addr, [&data, name, on_call]
+        {
+            if(keep_call(data, name))
+                on_call();
+        });
         if(!bp)
             return FAIL(std::nullopt, "unable to set breakpoint");
 
@@ -461,16 +554,33 @@ namespace
         return register_callback_with(d, bpid, proc, name, on_call);
     }
 
-    template <typename T>
-    T arg(core::Core& core, size_t i)
+    state::Breakpoint arm_filtered(nt::syscalls::Data& d, bpid_t bpid, proc_t proc, const tracer::callcfg_t& cfg, const nt::syscalls::on_call_fn& on_call)
     {
-        const auto arg = functions::read_arg(core, i);
-        if(!arg)
-            return {};
+        const auto addr = symbols::address(d.core, proc, d.module, cfg.name);
+        if(!addr)
+            return FAIL(nullptr, "unable to find symbole %s!%s", d.module.data(), cfg.name);
+
+        auto& data    = d;
+        const auto bp = state::break_on_process(d.core, cfg.name, proc, *addr, [&data, &cfg, on_call]
+        {
+            if(keep_call(data, cfg.name))
+                on_call(cfg);
+        });
+        if(!bp)
+            return FAIL(nullptr, "unable to set breakpoint");
+
+        state::save_breakpoint_with(d.core, bpid, bp);
+        return bp;
+    }
 
+    // registers & the stack span are fetched in one batched
+    // functions::read_args call, args are then decoded locally
+    template <typename T, size_t N>
+    T arg(const std::array<arg_t, N>& args, size_t i)
+    {
         T value = {};
-        static_assert(sizeof value <= sizeof arg->val, "invalid size");
-        memcpy(&value, &arg->val, sizeof value);
+        static_assert(sizeof value <= sizeof args[0].val, "invalid size");
+        memcpy(&value, &args[i].val, sizeof value);
         return value;
     }
 }
@@ -481,12 +591,16 @@ opt<bpid_t> nt::syscalls::register_NtAcceptConnectPort(proc_t proc, const on_NtA
     {
         auto& core = d_->core;
 
-        const auto PortHandle        = arg<nt::PHANDLE>(core, 0);
-        const auto PortContext       = arg<nt::PVOID>(core, 1);
-        const auto ConnectionRequest = arg<nt::PPORT_MESSAGE>(core, 2);
-        const auto AcceptConnection  = arg<nt::BOOLEAN>(core, 3);
-        const auto ServerView        = arg<nt::PPORT_VIEW>(core, 4);
-        const auto ClientView        = arg<nt::PREMOTE_PORT_VIEW>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle        = arg<nt::PHANDLE>(args, 0);
+        const auto PortContext       = arg<nt::PVOID>(args, 1);
+        const auto ConnectionRequest = arg<nt::PPORT_MESSAGE>(args, 2);
+        const auto AcceptConnection  = arg<nt::BOOLEAN>(args, 3);
+        const auto ServerView        = arg<nt::PPORT_VIEW>(args, 4);
+        const auto ClientView        = arg<nt::PREMOTE_PORT_VIEW>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[0]);
@@ -501,8 +615,12 @@ opt<bpid_t> nt::syscalls::register_NtAddDriverEntry(proc_t proc, const on_NtAddD
     {
         auto& core = d_->core;
 
-        const auto DriverEntry = arg<nt::PEFI_DRIVER_ENTRY>(core, 0);
-        const auto Id          = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DriverEntry = arg<nt::PEFI_DRIVER_ENTRY>(args, 0);
+        const auto Id          = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[1]);
@@ -517,12 +635,16 @@ opt<bpid_t> nt::syscalls::register_NtAdjustGroupsToken(proc_t proc, const on_NtA
     {
         auto& core = d_->core;
 
-        const auto TokenHandle    = arg<nt::HANDLE>(core, 0);
-        const auto ResetToDefault = arg<nt::BOOLEAN>(core, 1);
-        const auto NewState       = arg<nt::PTOKEN_GROUPS>(core, 2);
-        const auto BufferLength   = arg<nt::ULONG>(core, 3);
-        const auto PreviousState  = arg<nt::PTOKEN_GROUPS>(core, 4);
-        const auto ReturnLength   = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle    = arg<nt::HANDLE>(args, 0);
+        const auto ResetToDefault = arg<nt::BOOLEAN>(args, 1);
+        const auto NewState       = arg<nt::PTOKEN_GROUPS>(args, 2);
+        const auto BufferLength   = arg<nt::ULONG>(args, 3);
+        const auto PreviousState  = arg<nt::PTOKEN_GROUPS>(args, 4);
+        const auto ReturnLength   = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[2]);
@@ -537,12 +659,16 @@ opt<bpid_t> nt::syscalls::register_NtAdjustPrivilegesToken(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto TokenHandle          = arg<nt::HANDLE>(core, 0);
-        const auto DisableAllPrivileges = arg<nt::BOOLEAN>(core, 1);
-        const auto NewState             = arg<nt::PTOKEN_PRIVILEGES>(core, 2);
-        const auto BufferLength         = arg<nt::ULONG>(core, 3);
-        const auto PreviousState        = arg<nt::PTOKEN_PRIVILEGES>(core, 4);
-        const auto ReturnLength         = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle          = arg<nt::HANDLE>(args, 0);
+        const auto DisableAllPrivileges = arg<nt::BOOLEAN>(args, 1);
+        const auto NewState             = arg<nt::PTOKEN_PRIVILEGES>(args, 2);
+        const auto BufferLength         = arg<nt::ULONG>(args, 3);
+        const auto PreviousState        = arg<nt::PTOKEN_PRIVILEGES>(args, 4);
+        const auto ReturnLength         = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[3]);
@@ -557,7 +683,11 @@ opt<bpid_t> nt::syscalls::register_NtAlertThread(proc_t proc, const on_NtAlertTh
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[4]);
@@ -572,9 +702,13 @@ opt<bpid_t> nt::syscalls::register_NtAllocateReserveObject(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto MemoryReserveHandle = arg<nt::PHANDLE>(core, 0);
-        const auto ObjectAttributes    = arg<nt::POBJECT_ATTRIBUTES>(core, 1);
-        const auto Type                = arg<nt::MEMORY_RESERVE_TYPE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MemoryReserveHandle = arg<nt::PHANDLE>(args, 0);
+        const auto ObjectAttributes    = arg<nt::POBJECT_ATTRIBUTES>(args, 1);
+        const auto Type                = arg<nt::MEMORY_RESERVE_TYPE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[5]);
@@ -589,9 +723,13 @@ opt<bpid_t> nt::syscalls::register_NtAlpcCancelMessage(proc_t proc, const on_NtA
     {
         auto& core = d_->core;
 
-        const auto PortHandle     = arg<nt::HANDLE>(core, 0);
-        const auto Flags          = arg<nt::ULONG>(core, 1);
-        const auto MessageContext = arg<nt::PALPC_CONTEXT_ATTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle     = arg<nt::HANDLE>(args, 0);
+        const auto Flags          = arg<nt::ULONG>(args, 1);
+        const auto MessageContext = arg<nt::PALPC_CONTEXT_ATTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[6]);
@@ -606,17 +744,21 @@ opt<bpid_t> nt::syscalls::register_NtAlpcConnectPort(proc_t proc, const on_NtAlp
     {
         auto& core = d_->core;
 
-        const auto PortHandle           = arg<nt::PHANDLE>(core, 0);
-        const auto PortName             = arg<nt::PUNICODE_STRING>(core, 1);
-        const auto ObjectAttributes     = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto PortAttributes       = arg<nt::PALPC_PORT_ATTRIBUTES>(core, 3);
-        const auto Flags                = arg<nt::ULONG>(core, 4);
-        const auto RequiredServerSid    = arg<nt::PSID>(core, 5);
-        const auto ConnectionMessage    = arg<nt::PPORT_MESSAGE>(core, 6);
-        const auto BufferLength         = arg<nt::PULONG>(core, 7);
-        const auto OutMessageAttributes = arg<nt::PALPC_MESSAGE_ATTRIBUTES>(core, 8);
-        const auto InMessageAttributes  = arg<nt::PALPC_MESSAGE_ATTRIBUTES>(core, 9);
-        const auto Timeout              = arg<nt::PLARGE_INTEGER>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle           = arg<nt::PHANDLE>(args, 0);
+        const auto PortName             = arg<nt::PUNICODE_STRING>(args, 1);
+        const auto ObjectAttributes     = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto PortAttributes       = arg<nt::PALPC_PORT_ATTRIBUTES>(args, 3);
+        const auto Flags                = arg<nt::ULONG>(args, 4);
+        const auto RequiredServerSid    = arg<nt::PSID>(args, 5);
+        const auto ConnectionMessage    = arg<nt::PPORT_MESSAGE>(args, 6);
+        const auto BufferLength         = arg<nt::PULONG>(args, 7);
+        const auto OutMessageAttributes = arg<nt::PALPC_MESSAGE_ATTRIBUTES>(args, 8);
+        const auto InMessageAttributes  = arg<nt::PALPC_MESSAGE_ATTRIBUTES>(args, 9);
+        const auto Timeout              = arg<nt::PLARGE_INTEGER>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[7]);
@@ -631,9 +773,13 @@ opt<bpid_t> nt::syscalls::register_NtAlpcCreatePort(proc_t proc, const on_NtAlpc
     {
         auto& core = d_->core;
 
-        const auto PortHandle       = arg<nt::PHANDLE>(core, 0);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 1);
-        const auto PortAttributes   = arg<nt::PALPC_PORT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle       = arg<nt::PHANDLE>(args, 0);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 1);
+        const auto PortAttributes   = arg<nt::PALPC_PORT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[8]);
@@ -648,9 +794,13 @@ opt<bpid_t> nt::syscalls::register_NtAlpcCreateSectionView(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto PortHandle     = arg<nt::HANDLE>(core, 0);
-        const auto Flags          = arg<nt::ULONG>(core, 1);
-        const auto ViewAttributes = arg<nt::PALPC_DATA_VIEW_ATTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle     = arg<nt::HANDLE>(args, 0);
+        const auto Flags          = arg<nt::ULONG>(args, 1);
+        const auto ViewAttributes = arg<nt::PALPC_DATA_VIEW_ATTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[9]);
@@ -665,9 +815,13 @@ opt<bpid_t> nt::syscalls::register_NtAlpcCreateSecurityContext(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto PortHandle        = arg<nt::HANDLE>(core, 0);
-        const auto Flags             = arg<nt::ULONG>(core, 1);
-        const auto SecurityAttribute = arg<nt::PALPC_SECURITY_ATTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle        = arg<nt::HANDLE>(args, 0);
+        const auto Flags             = arg<nt::ULONG>(args, 1);
+        const auto SecurityAttribute = arg<nt::PALPC_SECURITY_ATTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[10]);
@@ -682,9 +836,13 @@ opt<bpid_t> nt::syscalls::register_NtAlpcDeletePortSection(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto PortHandle    = arg<nt::HANDLE>(core, 0);
-        const auto Flags         = arg<nt::ULONG>(core, 1);
-        const auto SectionHandle = arg<nt::ALPC_HANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle    = arg<nt::HANDLE>(args, 0);
+        const auto Flags         = arg<nt::ULONG>(args, 1);
+        const auto SectionHandle = arg<nt::ALPC_HANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[11]);
@@ -699,9 +857,13 @@ opt<bpid_t> nt::syscalls::register_NtAlpcDeleteResourceReserve(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<nt::HANDLE>(core, 0);
-        const auto Flags      = arg<nt::ULONG>(core, 1);
-        const auto ResourceId = arg<nt::ALPC_HANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<nt::HANDLE>(args, 0);
+        const auto Flags      = arg<nt::ULONG>(args, 1);
+        const auto ResourceId = arg<nt::ALPC_HANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[12]);
@@ -716,8 +878,12 @@ opt<bpid_t> nt::syscalls::register_NtAlpcDisconnectPort(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<nt::HANDLE>(core, 0);
-        const auto Flags      = arg<nt::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<nt::HANDLE>(args, 0);
+        const auto Flags      = arg<nt::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[13]);
@@ -732,9 +898,13 @@ opt<bpid_t> nt::syscalls::register_NtAlpcImpersonateClientOfPort(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto PortHandle  = arg<nt::HANDLE>(core, 0);
-        const auto PortMessage = arg<nt::PPORT_MESSAGE>(core, 1);
-        const auto Reserved    = arg<nt::PVOID>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle  = arg<nt::HANDLE>(args, 0);
+        const auto PortMessage = arg<nt::PPORT_MESSAGE>(args, 1);
+        const auto Reserved    = arg<nt::PVOID>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[14]);
@@ -749,12 +919,16 @@ opt<bpid_t> nt::syscalls::register_NtAlpcOpenSenderProcess(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<nt::PHANDLE>(core, 0);
-        const auto PortHandle       = arg<nt::HANDLE>(core, 1);
-        const auto PortMessage      = arg<nt::PPORT_MESSAGE>(core, 2);
-        const auto Flags            = arg<nt::ULONG>(core, 3);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 4);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<nt::PHANDLE>(args, 0);
+        const auto PortHandle       = arg<nt::HANDLE>(args, 1);
+        const auto PortMessage      = arg<nt::PPORT_MESSAGE>(args, 2);
+        const auto Flags            = arg<nt::ULONG>(args, 3);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 4);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[15]);
@@ -769,12 +943,16 @@ opt<bpid_t> nt::syscalls::register_NtAlpcOpenSenderThread(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle     = arg<nt::PHANDLE>(core, 0);
-        const auto PortHandle       = arg<nt::HANDLE>(core, 1);
-        const auto PortMessage      = arg<nt::PPORT_MESSAGE>(core, 2);
-        const auto Flags            = arg<nt::ULONG>(core, 3);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 4);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle     = arg<nt::PHANDLE>(args, 0);
+        const auto PortHandle       = arg<nt::HANDLE>(args, 1);
+        const auto PortMessage      = arg<nt::PPORT_MESSAGE>(args, 2);
+        const auto Flags            = arg<nt::ULONG>(args, 3);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 4);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[16]);
@@ -789,9 +967,13 @@ opt<bpid_t> nt::syscalls::register_NtAlpcRevokeSecurityContext(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto PortHandle    = arg<nt::HANDLE>(core, 0);
-        const auto Flags         = arg<nt::ULONG>(core, 1);
-        const auto ContextHandle = arg<nt::ALPC_HANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle    = arg<nt::HANDLE>(args, 0);
+        const auto Flags         = arg<nt::ULONG>(args, 1);
+        const auto ContextHandle = arg<nt::ALPC_HANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[17]);
@@ -806,10 +988,14 @@ opt<bpid_t> nt::syscalls::register_NtAlpcSetInformation(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto PortHandle           = arg<nt::HANDLE>(core, 0);
-        const auto PortInformationClass = arg<nt::ALPC_PORT_INFORMATION_CLASS>(core, 1);
-        const auto PortInformation      = arg<nt::PVOID>(core, 2);
-        const auto Length               = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle           = arg<nt::HANDLE>(args, 0);
+        const auto PortInformationClass = arg<nt::ALPC_PORT_INFORMATION_CLASS>(args, 1);
+        const auto PortInformation      = arg<nt::PVOID>(args, 2);
+        const auto Length               = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[18]);
@@ -824,8 +1010,12 @@ opt<bpid_t> nt::syscalls::register_NtApphelpCacheControl(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto type = arg<nt::APPHELPCOMMAND>(core, 0);
-        const auto buf  = arg<nt::PVOID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto type = arg<nt::APPHELPCOMMAND>(args, 0);
+        const auto buf  = arg<nt::PVOID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[19]);
@@ -840,8 +1030,12 @@ opt<bpid_t> nt::syscalls::register_NtAssignProcessToJobObject(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto JobHandle     = arg<nt::HANDLE>(core, 0);
-        const auto ProcessHandle = arg<nt::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle     = arg<nt::HANDLE>(args, 0);
+        const auto ProcessHandle = arg<nt::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[20]);
@@ -856,8 +1050,12 @@ opt<bpid_t> nt::syscalls::register_NtCancelTimer(proc_t proc, const on_NtCancelT
     {
         auto& core = d_->core;
 
-        const auto TimerHandle  = arg<nt::HANDLE>(core, 0);
-        const auto CurrentState = arg<nt::PBOOLEAN>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle  = arg<nt::HANDLE>(args, 0);
+        const auto CurrentState = arg<nt::PBOOLEAN>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[21]);
@@ -872,7 +1070,11 @@ opt<bpid_t> nt::syscalls::register_NtClearEvent(proc_t proc, const on_NtClearEve
     {
         auto& core = d_->core;
 
-        const auto EventHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[22]);
@@ -887,7 +1089,11 @@ opt<bpid_t> nt::syscalls::register_NtClose(proc_t proc, const on_NtClose_fn& on_
     {
         auto& core = d_->core;
 
-        const auto Handle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[23]);
@@ -902,8 +1108,12 @@ opt<bpid_t> nt::syscalls::register_NtCommitComplete(proc_t proc, const on_NtComm
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<nt::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<nt::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[24]);
@@ -918,8 +1128,12 @@ opt<bpid_t> nt::syscalls::register_NtCompactKeys(proc_t proc, const on_NtCompact
     {
         auto& core = d_->core;
 
-        const auto Count    = arg<nt::ULONG>(core, 0);
-        const auto KeyArray = arg<nt::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Count    = arg<nt::ULONG>(args, 0);
+        const auto KeyArray = arg<nt::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[25]);
@@ -934,7 +1148,11 @@ opt<bpid_t> nt::syscalls::register_NtCompleteConnectPort(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[26]);
@@ -949,7 +1167,11 @@ opt<bpid_t> nt::syscalls::register_NtCompressKey(proc_t proc, const on_NtCompres
     {
         auto& core = d_->core;
 
-        const auto Key = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Key = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[27]);
@@ -964,10 +1186,14 @@ opt<bpid_t> nt::syscalls::register_NtCreateDebugObject(proc_t proc, const on_NtC
     {
         auto& core = d_->core;
 
-        const auto DebugObjectHandle = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Flags             = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DebugObjectHandle = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Flags             = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[28]);
@@ -982,9 +1208,13 @@ opt<bpid_t> nt::syscalls::register_NtCreateDirectoryObject(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto DirectoryHandle  = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DirectoryHandle  = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[29]);
@@ -999,14 +1229,18 @@ opt<bpid_t> nt::syscalls::register_NtCreateEnlistment(proc_t proc, const on_NtCr
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle      = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess         = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ResourceManagerHandle = arg<nt::HANDLE>(core, 2);
-        const auto TransactionHandle     = arg<nt::HANDLE>(core, 3);
-        const auto ObjectAttributes      = arg<nt::POBJECT_ATTRIBUTES>(core, 4);
-        const auto CreateOptions         = arg<nt::ULONG>(core, 5);
-        const auto NotificationMask      = arg<nt::NOTIFICATION_MASK>(core, 6);
-        const auto EnlistmentKey         = arg<nt::PVOID>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle      = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess         = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ResourceManagerHandle = arg<nt::HANDLE>(args, 2);
+        const auto TransactionHandle     = arg<nt::HANDLE>(args, 3);
+        const auto ObjectAttributes      = arg<nt::POBJECT_ATTRIBUTES>(args, 4);
+        const auto CreateOptions         = arg<nt::ULONG>(args, 5);
+        const auto NotificationMask      = arg<nt::NOTIFICATION_MASK>(args, 6);
+        const auto EnlistmentKey         = arg<nt::PVOID>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[30]);
@@ -1021,10 +1255,14 @@ opt<bpid_t> nt::syscalls::register_NtCreateIoCompletion(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Count              = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Count              = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[31]);
@@ -1039,10 +1277,14 @@ opt<bpid_t> nt::syscalls::register_NtCreateMutant(proc_t proc, const on_NtCreate
     {
         auto& core = d_->core;
 
-        const auto MutantHandle     = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto InitialOwner     = arg<nt::BOOLEAN>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MutantHandle     = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto InitialOwner     = arg<nt::BOOLEAN>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[32]);
@@ -1057,20 +1299,24 @@ opt<bpid_t> nt::syscalls::register_NtCreateNamedPipeFile(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto FileHandle        = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<nt::ULONG>(core, 1);
-        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(core, 3);
-        const auto ShareAccess       = arg<nt::ULONG>(core, 4);
-        const auto CreateDisposition = arg<nt::ULONG>(core, 5);
-        const auto CreateOptions     = arg<nt::ULONG>(core, 6);
-        const auto NamedPipeType     = arg<nt::ULONG>(core, 7);
-        const auto ReadMode          = arg<nt::ULONG>(core, 8);
-        const auto CompletionMode    = arg<nt::ULONG>(core, 9);
-        const auto MaximumInstances  = arg<nt::ULONG>(core, 10);
-        const auto InboundQuota      = arg<nt::ULONG>(core, 11);
-        const auto OutboundQuota     = arg<nt::ULONG>(core, 12);
-        const auto DefaultTimeout    = arg<nt::PLARGE_INTEGER>(core, 13);
+        auto args = std::array<arg_t, 14>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle        = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<nt::ULONG>(args, 1);
+        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(args, 3);
+        const auto ShareAccess       = arg<nt::ULONG>(args, 4);
+        const auto CreateDisposition = arg<nt::ULONG>(args, 5);
+        const auto CreateOptions     = arg<nt::ULONG>(args, 6);
+        const auto NamedPipeType     = arg<nt::ULONG>(args, 7);
+        const auto ReadMode          = arg<nt::ULONG>(args, 8);
+        const auto CompletionMode    = arg<nt::ULONG>(args, 9);
+        const auto MaximumInstances  = arg<nt::ULONG>(args, 10);
+        const auto InboundQuota      = arg<nt::ULONG>(args, 11);
+        const auto OutboundQuota     = arg<nt::ULONG>(args, 12);
+        const auto DefaultTimeout    = arg<nt::PLARGE_INTEGER>(args, 13);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[33]);
@@ -1085,10 +1331,14 @@ opt<bpid_t> nt::syscalls::register_NtCreatePagingFile(proc_t proc, const on_NtCr
     {
         auto& core = d_->core;
 
-        const auto PageFileName = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto MinimumSize  = arg<nt::PLARGE_INTEGER>(core, 1);
-        const auto MaximumSize  = arg<nt::PLARGE_INTEGER>(core, 2);
-        const auto Priority     = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PageFileName = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto MinimumSize  = arg<nt::PLARGE_INTEGER>(args, 1);
+        const auto MaximumSize  = arg<nt::PLARGE_INTEGER>(args, 2);
+        const auto Priority     = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[34]);
@@ -1103,14 +1353,18 @@ opt<bpid_t> nt::syscalls::register_NtCreateProcess(proc_t proc, const on_NtCreat
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle      = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ParentProcess      = arg<nt::HANDLE>(core, 3);
-        const auto InheritObjectTable = arg<nt::BOOLEAN>(core, 4);
-        const auto SectionHandle      = arg<nt::HANDLE>(core, 5);
-        const auto DebugPort          = arg<nt::HANDLE>(core, 6);
-        const auto ExceptionPort      = arg<nt::HANDLE>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle      = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ParentProcess      = arg<nt::HANDLE>(args, 3);
+        const auto InheritObjectTable = arg<nt::BOOLEAN>(args, 4);
+        const auto SectionHandle      = arg<nt::HANDLE>(args, 5);
+        const auto DebugPort          = arg<nt::HANDLE>(args, 6);
+        const auto ExceptionPort      = arg<nt::HANDLE>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[35]);
@@ -1125,13 +1379,17 @@ opt<bpid_t> nt::syscalls::register_NtCreateResourceManager(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess         = arg<nt::ACCESS_MASK>(core, 1);
-        const auto TmHandle              = arg<nt::HANDLE>(core, 2);
-        const auto RmGuid                = arg<nt::LPGUID>(core, 3);
-        const auto ObjectAttributes      = arg<nt::POBJECT_ATTRIBUTES>(core, 4);
-        const auto CreateOptions         = arg<nt::ULONG>(core, 5);
-        const auto Description           = arg<nt::PUNICODE_STRING>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess         = arg<nt::ACCESS_MASK>(args, 1);
+        const auto TmHandle              = arg<nt::HANDLE>(args, 2);
+        const auto RmGuid                = arg<nt::LPGUID>(args, 3);
+        const auto ObjectAttributes      = arg<nt::POBJECT_ATTRIBUTES>(args, 4);
+        const auto CreateOptions         = arg<nt::ULONG>(args, 5);
+        const auto Description           = arg<nt::PUNICODE_STRING>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[36]);
@@ -1146,13 +1404,17 @@ opt<bpid_t> nt::syscalls::register_NtCreateSection(proc_t proc, const on_NtCreat
     {
         auto& core = d_->core;
 
-        const auto SectionHandle         = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess         = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes      = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto MaximumSize           = arg<nt::PLARGE_INTEGER>(core, 3);
-        const auto SectionPageProtection = arg<nt::ULONG>(core, 4);
-        const auto AllocationAttributes  = arg<nt::ULONG>(core, 5);
-        const auto FileHandle            = arg<nt::HANDLE>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionHandle         = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess         = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes      = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto MaximumSize           = arg<nt::PLARGE_INTEGER>(args, 3);
+        const auto SectionPageProtection = arg<nt::ULONG>(args, 4);
+        const auto AllocationAttributes  = arg<nt::ULONG>(args, 5);
+        const auto FileHandle            = arg<nt::HANDLE>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[37]);
@@ -1167,11 +1429,15 @@ opt<bpid_t> nt::syscalls::register_NtCreateSemaphore(proc_t proc, const on_NtCre
     {
         auto& core = d_->core;
 
-        const auto SemaphoreHandle  = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto InitialCount     = arg<nt::LONG>(core, 3);
-        const auto MaximumCount     = arg<nt::LONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SemaphoreHandle  = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto InitialCount     = arg<nt::LONG>(args, 3);
+        const auto MaximumCount     = arg<nt::LONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[38]);
@@ -1186,14 +1452,18 @@ opt<bpid_t> nt::syscalls::register_NtCreateThread(proc_t proc, const on_NtCreate
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle     = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ProcessHandle    = arg<nt::HANDLE>(core, 3);
-        const auto ClientId         = arg<nt::PCLIENT_ID>(core, 4);
-        const auto ThreadContext    = arg<nt::PCONTEXT>(core, 5);
-        const auto InitialTeb       = arg<nt::PINITIAL_TEB>(core, 6);
-        const auto CreateSuspended  = arg<nt::BOOLEAN>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle     = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ProcessHandle    = arg<nt::HANDLE>(args, 3);
+        const auto ClientId         = arg<nt::PCLIENT_ID>(args, 4);
+        const auto ThreadContext    = arg<nt::PCONTEXT>(args, 5);
+        const auto InitialTeb       = arg<nt::PINITIAL_TEB>(args, 6);
+        const auto CreateSuspended  = arg<nt::BOOLEAN>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[39]);
@@ -1208,17 +1478,21 @@ opt<bpid_t> nt::syscalls::register_NtCreateThreadEx(proc_t proc, const on_NtCrea
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle     = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ProcessHandle    = arg<nt::HANDLE>(core, 3);
-        const auto StartRoutine     = arg<nt::PVOID>(core, 4);
-        const auto Argument         = arg<nt::PVOID>(core, 5);
-        const auto CreateFlags      = arg<nt::ULONG>(core, 6);
-        const auto ZeroBits         = arg<nt::ULONG_PTR>(core, 7);
-        const auto StackSize        = arg<nt::SIZE_T>(core, 8);
-        const auto MaximumStackSize = arg<nt::SIZE_T>(core, 9);
-        const auto AttributeList    = arg<nt::PPS_ATTRIBUTE_LIST>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle     = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ProcessHandle    = arg<nt::HANDLE>(args, 3);
+        const auto StartRoutine     = arg<nt::PVOID>(args, 4);
+        const auto Argument         = arg<nt::PVOID>(args, 5);
+        const auto CreateFlags      = arg<nt::ULONG>(args, 6);
+        const auto ZeroBits         = arg<nt::ULONG_PTR>(args, 7);
+        const auto StackSize        = arg<nt::SIZE_T>(args, 8);
+        const auto MaximumStackSize = arg<nt::SIZE_T>(args, 9);
+        const auto AttributeList    = arg<nt::PPS_ATTRIBUTE_LIST>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[40]);
@@ -1233,19 +1507,23 @@ opt<bpid_t> nt::syscalls::register_NtCreateToken(proc_t proc, const on_NtCreateT
     {
         auto& core = d_->core;
 
-        const auto TokenHandle      = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto TokenType        = arg<nt::TOKEN_TYPE>(core, 3);
-        const auto AuthenticationId = arg<nt::PLUID>(core, 4);
-        const auto ExpirationTime   = arg<nt::PLARGE_INTEGER>(core, 5);
-        const auto User             = arg<nt::PTOKEN_USER>(core, 6);
-        const auto Groups           = arg<nt::PTOKEN_GROUPS>(core, 7);
-        const auto Privileges       = arg<nt::PTOKEN_PRIVILEGES>(core, 8);
-        const auto Owner            = arg<nt::PTOKEN_OWNER>(core, 9);
-        const auto PrimaryGroup     = arg<nt::PTOKEN_PRIMARY_GROUP>(core, 10);
-        const auto DefaultDacl      = arg<nt::PTOKEN_DEFAULT_DACL>(core, 11);
-        const auto TokenSource      = arg<nt::PTOKEN_SOURCE>(core, 12);
+        auto args = std::array<arg_t, 13>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle      = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto TokenType        = arg<nt::TOKEN_TYPE>(args, 3);
+        const auto AuthenticationId = arg<nt::PLUID>(args, 4);
+        const auto ExpirationTime   = arg<nt::PLARGE_INTEGER>(args, 5);
+        const auto User             = arg<nt::PTOKEN_USER>(args, 6);
+        const auto Groups           = arg<nt::PTOKEN_GROUPS>(args, 7);
+        const auto Privileges       = arg<nt::PTOKEN_PRIVILEGES>(args, 8);
+        const auto Owner            = arg<nt::PTOKEN_OWNER>(args, 9);
+        const auto PrimaryGroup     = arg<nt::PTOKEN_PRIMARY_GROUP>(args, 10);
+        const auto DefaultDacl      = arg<nt::PTOKEN_DEFAULT_DACL>(args, 11);
+        const auto TokenSource      = arg<nt::PTOKEN_SOURCE>(args, 12);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[41]);
@@ -1260,16 +1538,20 @@ opt<bpid_t> nt::syscalls::register_NtCreateTransaction(proc_t proc, const on_NtC
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Uow               = arg<nt::LPGUID>(core, 3);
-        const auto TmHandle          = arg<nt::HANDLE>(core, 4);
-        const auto CreateOptions     = arg<nt::ULONG>(core, 5);
-        const auto IsolationLevel    = arg<nt::ULONG>(core, 6);
-        const auto IsolationFlags    = arg<nt::ULONG>(core, 7);
-        const auto Timeout           = arg<nt::PLARGE_INTEGER>(core, 8);
-        const auto Description       = arg<nt::PUNICODE_STRING>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Uow               = arg<nt::LPGUID>(args, 3);
+        const auto TmHandle          = arg<nt::HANDLE>(args, 4);
+        const auto CreateOptions     = arg<nt::ULONG>(args, 5);
+        const auto IsolationLevel    = arg<nt::ULONG>(args, 6);
+        const auto IsolationFlags    = arg<nt::ULONG>(args, 7);
+        const auto Timeout           = arg<nt::PLARGE_INTEGER>(args, 8);
+        const auto Description       = arg<nt::PUNICODE_STRING>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[42]);
@@ -1284,17 +1566,21 @@ opt<bpid_t> nt::syscalls::register_NtCreateUserProcess(proc_t proc, const on_NtC
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle           = arg<nt::PHANDLE>(core, 0);
-        const auto ThreadHandle            = arg<nt::PHANDLE>(core, 1);
-        const auto ProcessDesiredAccess    = arg<nt::ACCESS_MASK>(core, 2);
-        const auto ThreadDesiredAccess     = arg<nt::ACCESS_MASK>(core, 3);
-        const auto ProcessObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 4);
-        const auto ThreadObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(core, 5);
-        const auto ProcessFlags            = arg<nt::ULONG>(core, 6);
-        const auto ThreadFlags             = arg<nt::ULONG>(core, 7);
-        const auto ProcessParameters       = arg<nt::PRTL_USER_PROCESS_PARAMETERS>(core, 8);
-        const auto CreateInfo              = arg<nt::PPROCESS_CREATE_INFO>(core, 9);
-        const auto AttributeList           = arg<nt::PPROCESS_ATTRIBUTE_LIST>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle           = arg<nt::PHANDLE>(args, 0);
+        const auto ThreadHandle            = arg<nt::PHANDLE>(args, 1);
+        const auto ProcessDesiredAccess    = arg<nt::ACCESS_MASK>(args, 2);
+        const auto ThreadDesiredAccess     = arg<nt::ACCESS_MASK>(args, 3);
+        const auto ProcessObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 4);
+        const auto ThreadObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(args, 5);
+        const auto ProcessFlags            = arg<nt::ULONG>(args, 6);
+        const auto ThreadFlags             = arg<nt::ULONG>(args, 7);
+        const auto ProcessParameters       = arg<nt::PRTL_USER_PROCESS_PARAMETERS>(args, 8);
+        const auto CreateInfo              = arg<nt::PPROCESS_CREATE_INFO>(args, 9);
+        const auto AttributeList           = arg<nt::PPROCESS_ATTRIBUTE_LIST>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[43]);
@@ -1309,11 +1595,15 @@ opt<bpid_t> nt::syscalls::register_NtCreateWaitablePort(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto PortHandle              = arg<nt::PHANDLE>(core, 0);
-        const auto ObjectAttributes        = arg<nt::POBJECT_ATTRIBUTES>(core, 1);
-        const auto MaxConnectionInfoLength = arg<nt::ULONG>(core, 2);
-        const auto MaxMessageLength        = arg<nt::ULONG>(core, 3);
-        const auto MaxPoolUsage            = arg<nt::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle              = arg<nt::PHANDLE>(args, 0);
+        const auto ObjectAttributes        = arg<nt::POBJECT_ATTRIBUTES>(args, 1);
+        const auto MaxConnectionInfoLength = arg<nt::ULONG>(args, 2);
+        const auto MaxMessageLength        = arg<nt::ULONG>(args, 3);
+        const auto MaxPoolUsage            = arg<nt::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[44]);
@@ -1328,16 +1618,20 @@ opt<bpid_t> nt::syscalls::register_NtCreateWorkerFactory(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandleReturn = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess             = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes          = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto CompletionPortHandle      = arg<nt::HANDLE>(core, 3);
-        const auto WorkerProcessHandle       = arg<nt::HANDLE>(core, 4);
-        const auto StartRoutine              = arg<nt::PVOID>(core, 5);
-        const auto StartParameter            = arg<nt::PVOID>(core, 6);
-        const auto MaxThreadCount            = arg<nt::ULONG>(core, 7);
-        const auto StackReserve              = arg<nt::SIZE_T>(core, 8);
-        const auto StackCommit               = arg<nt::SIZE_T>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandleReturn = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess             = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes          = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto CompletionPortHandle      = arg<nt::HANDLE>(args, 3);
+        const auto WorkerProcessHandle       = arg<nt::HANDLE>(args, 4);
+        const auto StartRoutine              = arg<nt::PVOID>(args, 5);
+        const auto StartParameter            = arg<nt::PVOID>(args, 6);
+        const auto MaxThreadCount            = arg<nt::ULONG>(args, 7);
+        const auto StackReserve              = arg<nt::SIZE_T>(args, 8);
+        const auto StackCommit               = arg<nt::SIZE_T>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[45]);
@@ -1352,8 +1646,12 @@ opt<bpid_t> nt::syscalls::register_NtDebugActiveProcess(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle     = arg<nt::HANDLE>(core, 0);
-        const auto DebugObjectHandle = arg<nt::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle     = arg<nt::HANDLE>(args, 0);
+        const auto DebugObjectHandle = arg<nt::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[46]);
@@ -1368,9 +1666,13 @@ opt<bpid_t> nt::syscalls::register_NtDebugContinue(proc_t proc, const on_NtDebug
     {
         auto& core = d_->core;
 
-        const auto DebugObjectHandle = arg<nt::HANDLE>(core, 0);
-        const auto ClientId          = arg<nt::PCLIENT_ID>(core, 1);
-        const auto ContinueStatus    = arg<nt::NTSTATUS>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DebugObjectHandle = arg<nt::HANDLE>(args, 0);
+        const auto ClientId          = arg<nt::PCLIENT_ID>(args, 1);
+        const auto ContinueStatus    = arg<nt::NTSTATUS>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[47]);
@@ -1385,7 +1687,11 @@ opt<bpid_t> nt::syscalls::register_NtDeleteAtom(proc_t proc, const on_NtDeleteAt
     {
         auto& core = d_->core;
 
-        const auto Atom = arg<nt::RTL_ATOM>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Atom = arg<nt::RTL_ATOM>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[48]);
@@ -1400,7 +1706,11 @@ opt<bpid_t> nt::syscalls::register_NtDeleteBootEntry(proc_t proc, const on_NtDel
     {
         auto& core = d_->core;
 
-        const auto Id = arg<nt::ULONG>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Id = arg<nt::ULONG>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[49]);
@@ -1415,7 +1725,11 @@ opt<bpid_t> nt::syscalls::register_NtDeleteFile(proc_t proc, const on_NtDeleteFi
     {
         auto& core = d_->core;
 
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[50]);
@@ -1430,7 +1744,11 @@ opt<bpid_t> nt::syscalls::register_NtDeleteKey(proc_t proc, const on_NtDeleteKey
     {
         auto& core = d_->core;
 
-        const auto KeyHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[51]);
@@ -1445,7 +1763,11 @@ opt<bpid_t> nt::syscalls::register_NtDeletePrivateNamespace(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto NamespaceHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto NamespaceHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[52]);
@@ -1460,16 +1782,20 @@ opt<bpid_t> nt::syscalls::register_NtDeviceIoControlFile(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto FileHandle         = arg<nt::HANDLE>(core, 0);
-        const auto Event              = arg<nt::HANDLE>(core, 1);
-        const auto ApcRoutine         = arg<nt::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext         = arg<nt::PVOID>(core, 3);
-        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(core, 4);
-        const auto IoControlCode      = arg<nt::ULONG>(core, 5);
-        const auto InputBuffer        = arg<nt::PVOID>(core, 6);
-        const auto InputBufferLength  = arg<nt::ULONG>(core, 7);
-        const auto OutputBuffer       = arg<nt::PVOID>(core, 8);
-        const auto OutputBufferLength = arg<nt::ULONG>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle         = arg<nt::HANDLE>(args, 0);
+        const auto Event              = arg<nt::HANDLE>(args, 1);
+        const auto ApcRoutine         = arg<nt::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext         = arg<nt::PVOID>(args, 3);
+        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(args, 4);
+        const auto IoControlCode      = arg<nt::ULONG>(args, 5);
+        const auto InputBuffer        = arg<nt::PVOID>(args, 6);
+        const auto InputBufferLength  = arg<nt::ULONG>(args, 7);
+        const auto OutputBuffer       = arg<nt::PVOID>(args, 8);
+        const auto OutputBufferLength = arg<nt::ULONG>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[53]);
@@ -1497,7 +1823,11 @@ opt<bpid_t> nt::syscalls::register_NtDrawText(proc_t proc, const on_NtDrawText_f
     {
         auto& core = d_->core;
 
-        const auto Text = arg<nt::PUNICODE_STRING>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Text = arg<nt::PUNICODE_STRING>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[55]);
@@ -1512,12 +1842,16 @@ opt<bpid_t> nt::syscalls::register_NtDuplicateToken(proc_t proc, const on_NtDupl
     {
         auto& core = d_->core;
 
-        const auto ExistingTokenHandle = arg<nt::HANDLE>(core, 0);
-        const auto DesiredAccess       = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes    = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto EffectiveOnly       = arg<nt::BOOLEAN>(core, 3);
-        const auto TokenType           = arg<nt::TOKEN_TYPE>(core, 4);
-        const auto NewTokenHandle      = arg<nt::PHANDLE>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ExistingTokenHandle = arg<nt::HANDLE>(args, 0);
+        const auto DesiredAccess       = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes    = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto EffectiveOnly       = arg<nt::BOOLEAN>(args, 3);
+        const auto TokenType           = arg<nt::TOKEN_TYPE>(args, 4);
+        const auto NewTokenHandle      = arg<nt::PHANDLE>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[56]);
@@ -1545,8 +1879,12 @@ opt<bpid_t> nt::syscalls::register_NtEnumerateBootEntries(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto Buffer       = arg<nt::PVOID>(core, 0);
-        const auto BufferLength = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Buffer       = arg<nt::PVOID>(args, 0);
+        const auto BufferLength = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[58]);
@@ -1561,12 +1899,16 @@ opt<bpid_t> nt::syscalls::register_NtEnumerateKey(proc_t proc, const on_NtEnumer
     {
         auto& core = d_->core;
 
-        const auto KeyHandle           = arg<nt::HANDLE>(core, 0);
-        const auto Index               = arg<nt::ULONG>(core, 1);
-        const auto KeyInformationClass = arg<nt::KEY_INFORMATION_CLASS>(core, 2);
-        const auto KeyInformation      = arg<nt::PVOID>(core, 3);
-        const auto Length              = arg<nt::ULONG>(core, 4);
-        const auto ResultLength        = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle           = arg<nt::HANDLE>(args, 0);
+        const auto Index               = arg<nt::ULONG>(args, 1);
+        const auto KeyInformationClass = arg<nt::KEY_INFORMATION_CLASS>(args, 2);
+        const auto KeyInformation      = arg<nt::PVOID>(args, 3);
+        const auto Length              = arg<nt::ULONG>(args, 4);
+        const auto ResultLength        = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[59]);
@@ -1581,9 +1923,13 @@ opt<bpid_t> nt::syscalls::register_NtEnumerateSystemEnvironmentValuesEx(proc_t p
     {
         auto& core = d_->core;
 
-        const auto InformationClass = arg<nt::ULONG>(core, 0);
-        const auto Buffer           = arg<nt::PVOID>(core, 1);
-        const auto BufferLength     = arg<nt::PULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto InformationClass = arg<nt::ULONG>(args, 0);
+        const auto Buffer           = arg<nt::PVOID>(args, 1);
+        const auto BufferLength     = arg<nt::PULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[60]);
@@ -1598,11 +1944,15 @@ opt<bpid_t> nt::syscalls::register_NtEnumerateTransactionObject(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto RootObjectHandle   = arg<nt::HANDLE>(core, 0);
-        const auto QueryType          = arg<nt::KTMOBJECT_TYPE>(core, 1);
-        const auto ObjectCursor       = arg<nt::PKTMOBJECT_CURSOR>(core, 2);
-        const auto ObjectCursorLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength       = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto RootObjectHandle   = arg<nt::HANDLE>(args, 0);
+        const auto QueryType          = arg<nt::KTMOBJECT_TYPE>(args, 1);
+        const auto ObjectCursor       = arg<nt::PKTMOBJECT_CURSOR>(args, 2);
+        const auto ObjectCursorLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength       = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[61]);
@@ -1617,8 +1967,12 @@ opt<bpid_t> nt::syscalls::register_NtExtendSection(proc_t proc, const on_NtExten
     {
         auto& core = d_->core;
 
-        const auto SectionHandle  = arg<nt::HANDLE>(core, 0);
-        const auto NewSectionSize = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionHandle  = arg<nt::HANDLE>(args, 0);
+        const auto NewSectionSize = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[62]);
@@ -1633,8 +1987,12 @@ opt<bpid_t> nt::syscalls::register_NtFlushInstallUILanguage(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto InstallUILanguage = arg<nt::LANGID>(core, 0);
-        const auto SetComittedFlag   = arg<nt::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto InstallUILanguage = arg<nt::LANGID>(args, 0);
+        const auto SetComittedFlag   = arg<nt::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[63]);
@@ -1649,9 +2007,13 @@ opt<bpid_t> nt::syscalls::register_NtFlushInstructionCache(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<nt::HANDLE>(core, 0);
-        const auto BaseAddress   = arg<nt::PVOID>(core, 1);
-        const auto Length        = arg<nt::SIZE_T>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<nt::HANDLE>(args, 0);
+        const auto BaseAddress   = arg<nt::PVOID>(args, 1);
+        const auto Length        = arg<nt::SIZE_T>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[64]);
@@ -1679,7 +2041,11 @@ opt<bpid_t> nt::syscalls::register_NtFreezeRegistry(proc_t proc, const on_NtFree
     {
         auto& core = d_->core;
 
-        const auto TimeOutInSeconds = arg<nt::ULONG>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimeOutInSeconds = arg<nt::ULONG>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[66]);
@@ -1694,11 +2060,15 @@ opt<bpid_t> nt::syscalls::register_NtGetNextProcess(proc_t proc, const on_NtGetN
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<nt::HANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto HandleAttributes = arg<nt::ULONG>(core, 2);
-        const auto Flags            = arg<nt::ULONG>(core, 3);
-        const auto NewProcessHandle = arg<nt::PHANDLE>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<nt::HANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto HandleAttributes = arg<nt::ULONG>(args, 2);
+        const auto Flags            = arg<nt::ULONG>(args, 3);
+        const auto NewProcessHandle = arg<nt::PHANDLE>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[67]);
@@ -1713,13 +2083,17 @@ opt<bpid_t> nt::syscalls::register_NtGetNotificationResourceManager(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle   = arg<nt::HANDLE>(core, 0);
-        const auto TransactionNotification = arg<nt::PTRANSACTION_NOTIFICATION>(core, 1);
-        const auto NotificationLength      = arg<nt::ULONG>(core, 2);
-        const auto Timeout                 = arg<nt::PLARGE_INTEGER>(core, 3);
-        const auto ReturnLength            = arg<nt::PULONG>(core, 4);
-        const auto Asynchronous            = arg<nt::ULONG>(core, 5);
-        const auto AsynchronousContext     = arg<nt::ULONG_PTR>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle   = arg<nt::HANDLE>(args, 0);
+        const auto TransactionNotification = arg<nt::PTRANSACTION_NOTIFICATION>(args, 1);
+        const auto NotificationLength      = arg<nt::ULONG>(args, 2);
+        const auto Timeout                 = arg<nt::PLARGE_INTEGER>(args, 3);
+        const auto ReturnLength            = arg<nt::PULONG>(args, 4);
+        const auto Asynchronous            = arg<nt::ULONG>(args, 5);
+        const auto AsynchronousContext     = arg<nt::ULONG_PTR>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[68]);
@@ -1734,9 +2108,13 @@ opt<bpid_t> nt::syscalls::register_NtInitializeNlsFiles(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto STARBaseAddress        = arg<nt::PVOID>(core, 0);
-        const auto DefaultLocaleId        = arg<nt::PLCID>(core, 1);
-        const auto DefaultCasingTableSize = arg<nt::PLARGE_INTEGER>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto STARBaseAddress        = arg<nt::PVOID>(args, 0);
+        const auto DefaultLocaleId        = arg<nt::PLCID>(args, 1);
+        const auto DefaultCasingTableSize = arg<nt::PLARGE_INTEGER>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[69]);
@@ -1751,7 +2129,11 @@ opt<bpid_t> nt::syscalls::register_NtInitializeRegistry(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto BootCondition = arg<nt::USHORT>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto BootCondition = arg<nt::USHORT>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[70]);
@@ -1766,10 +2148,14 @@ opt<bpid_t> nt::syscalls::register_NtInitiatePowerAction(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto SystemAction   = arg<nt::POWER_ACTION>(core, 0);
-        const auto MinSystemState = arg<nt::SYSTEM_POWER_STATE>(core, 1);
-        const auto Flags          = arg<nt::ULONG>(core, 2);
-        const auto Asynchronous   = arg<nt::BOOLEAN>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemAction   = arg<nt::POWER_ACTION>(args, 0);
+        const auto MinSystemState = arg<nt::SYSTEM_POWER_STATE>(args, 1);
+        const auto Flags          = arg<nt::ULONG>(args, 2);
+        const auto Asynchronous   = arg<nt::BOOLEAN>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[71]);
@@ -1784,8 +2170,12 @@ opt<bpid_t> nt::syscalls::register_NtIsProcessInJob(proc_t proc, const on_NtIsPr
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<nt::HANDLE>(core, 0);
-        const auto JobHandle     = arg<nt::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<nt::HANDLE>(args, 0);
+        const auto JobHandle     = arg<nt::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[72]);
@@ -1813,8 +2203,12 @@ opt<bpid_t> nt::syscalls::register_NtListenPort(proc_t proc, const on_NtListenPo
     {
         auto& core = d_->core;
 
-        const auto PortHandle        = arg<nt::HANDLE>(core, 0);
-        const auto ConnectionRequest = arg<nt::PPORT_MESSAGE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle        = arg<nt::HANDLE>(args, 0);
+        const auto ConnectionRequest = arg<nt::PPORT_MESSAGE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[74]);
@@ -1829,8 +2223,12 @@ opt<bpid_t> nt::syscalls::register_NtLoadKey(proc_t proc, const on_NtLoadKey_fn&
     {
         auto& core = d_->core;
 
-        const auto TargetKey  = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
-        const auto SourceFile = arg<nt::POBJECT_ATTRIBUTES>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey  = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
+        const auto SourceFile = arg<nt::POBJECT_ATTRIBUTES>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[75]);
@@ -1845,10 +2243,14 @@ opt<bpid_t> nt::syscalls::register_NtLoadKeyEx(proc_t proc, const on_NtLoadKeyEx
     {
         auto& core = d_->core;
 
-        const auto TargetKey     = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
-        const auto SourceFile    = arg<nt::POBJECT_ATTRIBUTES>(core, 1);
-        const auto Flags         = arg<nt::ULONG>(core, 2);
-        const auto TrustClassKey = arg<nt::HANDLE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey     = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
+        const auto SourceFile    = arg<nt::POBJECT_ATTRIBUTES>(args, 1);
+        const auto Flags         = arg<nt::ULONG>(args, 2);
+        const auto TrustClassKey = arg<nt::HANDLE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[76]);
@@ -1863,8 +2265,12 @@ opt<bpid_t> nt::syscalls::register_NtLockProductActivationKeys(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto STARpPrivateVer = arg<nt::ULONG>(core, 0);
-        const auto STARpSafeMode   = arg<nt::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto STARpPrivateVer = arg<nt::ULONG>(args, 0);
+        const auto STARpSafeMode   = arg<nt::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[77]);
@@ -1879,10 +2285,14 @@ opt<bpid_t> nt::syscalls::register_NtLockVirtualMemory(proc_t proc, const on_NtL
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<nt::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<nt::PVOID>(core, 1);
-        const auto RegionSize      = arg<nt::PSIZE_T>(core, 2);
-        const auto MapType         = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<nt::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<nt::PVOID>(args, 1);
+        const auto RegionSize      = arg<nt::PSIZE_T>(args, 2);
+        const auto MapType         = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[78]);
@@ -1897,7 +2307,11 @@ opt<bpid_t> nt::syscalls::register_NtMakePermanentObject(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto Handle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[79]);
@@ -1912,7 +2326,11 @@ opt<bpid_t> nt::syscalls::register_NtMakeTemporaryObject(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto Handle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[80]);
@@ -1927,12 +2345,16 @@ opt<bpid_t> nt::syscalls::register_NtMapCMFModule(proc_t proc, const on_NtMapCMF
     {
         auto& core = d_->core;
 
-        const auto What            = arg<nt::ULONG>(core, 0);
-        const auto Index           = arg<nt::ULONG>(core, 1);
-        const auto CacheIndexOut   = arg<nt::PULONG>(core, 2);
-        const auto CacheFlagsOut   = arg<nt::PULONG>(core, 3);
-        const auto ViewSizeOut     = arg<nt::PULONG>(core, 4);
-        const auto STARBaseAddress = arg<nt::PVOID>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto What            = arg<nt::ULONG>(args, 0);
+        const auto Index           = arg<nt::ULONG>(args, 1);
+        const auto CacheIndexOut   = arg<nt::PULONG>(args, 2);
+        const auto CacheFlagsOut   = arg<nt::PULONG>(args, 3);
+        const auto ViewSizeOut     = arg<nt::PULONG>(args, 4);
+        const auto STARBaseAddress = arg<nt::PVOID>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[81]);
@@ -1947,9 +2369,13 @@ opt<bpid_t> nt::syscalls::register_NtMapUserPhysicalPages(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto VirtualAddress = arg<nt::PVOID>(core, 0);
-        const auto NumberOfPages  = arg<nt::ULONG_PTR>(core, 1);
-        const auto UserPfnArra    = arg<nt::PULONG_PTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto VirtualAddress = arg<nt::PVOID>(args, 0);
+        const auto NumberOfPages  = arg<nt::ULONG_PTR>(args, 1);
+        const auto UserPfnArra    = arg<nt::PULONG_PTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[82]);
@@ -1964,7 +2390,11 @@ opt<bpid_t> nt::syscalls::register_NtModifyBootEntry(proc_t proc, const on_NtMod
     {
         auto& core = d_->core;
 
-        const auto BootEntry = arg<nt::PBOOT_ENTRY>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto BootEntry = arg<nt::PBOOT_ENTRY>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[83]);
@@ -1979,15 +2409,19 @@ opt<bpid_t> nt::syscalls::register_NtNotifyChangeDirectoryFile(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto FileHandle       = arg<nt::HANDLE>(core, 0);
-        const auto Event            = arg<nt::HANDLE>(core, 1);
-        const auto ApcRoutine       = arg<nt::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext       = arg<nt::PVOID>(core, 3);
-        const auto IoStatusBlock    = arg<nt::PIO_STATUS_BLOCK>(core, 4);
-        const auto Buffer           = arg<nt::PVOID>(core, 5);
-        const auto Length           = arg<nt::ULONG>(core, 6);
-        const auto CompletionFilter = arg<nt::ULONG>(core, 7);
-        const auto WatchTree        = arg<nt::BOOLEAN>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle       = arg<nt::HANDLE>(args, 0);
+        const auto Event            = arg<nt::HANDLE>(args, 1);
+        const auto ApcRoutine       = arg<nt::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext       = arg<nt::PVOID>(args, 3);
+        const auto IoStatusBlock    = arg<nt::PIO_STATUS_BLOCK>(args, 4);
+        const auto Buffer           = arg<nt::PVOID>(args, 5);
+        const auto Length           = arg<nt::ULONG>(args, 6);
+        const auto CompletionFilter = arg<nt::ULONG>(args, 7);
+        const auto WatchTree        = arg<nt::BOOLEAN>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[84]);
@@ -2002,18 +2436,22 @@ opt<bpid_t> nt::syscalls::register_NtNotifyChangeMultipleKeys(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto MasterKeyHandle  = arg<nt::HANDLE>(core, 0);
-        const auto Count            = arg<nt::ULONG>(core, 1);
-        const auto SlaveObjects     = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Event            = arg<nt::HANDLE>(core, 3);
-        const auto ApcRoutine       = arg<nt::PIO_APC_ROUTINE>(core, 4);
-        const auto ApcContext       = arg<nt::PVOID>(core, 5);
-        const auto IoStatusBlock    = arg<nt::PIO_STATUS_BLOCK>(core, 6);
-        const auto CompletionFilter = arg<nt::ULONG>(core, 7);
-        const auto WatchTree        = arg<nt::BOOLEAN>(core, 8);
-        const auto Buffer           = arg<nt::PVOID>(core, 9);
-        const auto BufferSize       = arg<nt::ULONG>(core, 10);
-        const auto Asynchronous     = arg<nt::BOOLEAN>(core, 11);
+        auto args = std::array<arg_t, 12>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MasterKeyHandle  = arg<nt::HANDLE>(args, 0);
+        const auto Count            = arg<nt::ULONG>(args, 1);
+        const auto SlaveObjects     = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Event            = arg<nt::HANDLE>(args, 3);
+        const auto ApcRoutine       = arg<nt::PIO_APC_ROUTINE>(args, 4);
+        const auto ApcContext       = arg<nt::PVOID>(args, 5);
+        const auto IoStatusBlock    = arg<nt::PIO_STATUS_BLOCK>(args, 6);
+        const auto CompletionFilter = arg<nt::ULONG>(args, 7);
+        const auto WatchTree        = arg<nt::BOOLEAN>(args, 8);
+        const auto Buffer           = arg<nt::PVOID>(args, 9);
+        const auto BufferSize       = arg<nt::ULONG>(args, 10);
+        const auto Asynchronous     = arg<nt::BOOLEAN>(args, 11);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[85]);
@@ -2028,14 +2466,18 @@ opt<bpid_t> nt::syscalls::register_NtNotifyChangeSession(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto Session         = arg<nt::HANDLE>(core, 0);
-        const auto IoStateSequence = arg<nt::ULONG>(core, 1);
-        const auto Reserved        = arg<nt::PVOID>(core, 2);
-        const auto Action          = arg<nt::ULONG>(core, 3);
-        const auto IoState         = arg<nt::IO_SESSION_STATE>(core, 4);
-        const auto IoState2        = arg<nt::IO_SESSION_STATE>(core, 5);
-        const auto Buffer          = arg<nt::PVOID>(core, 6);
-        const auto BufferSize      = arg<nt::ULONG>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Session         = arg<nt::HANDLE>(args, 0);
+        const auto IoStateSequence = arg<nt::ULONG>(args, 1);
+        const auto Reserved        = arg<nt::PVOID>(args, 2);
+        const auto Action          = arg<nt::ULONG>(args, 3);
+        const auto IoState         = arg<nt::IO_SESSION_STATE>(args, 4);
+        const auto IoState2        = arg<nt::IO_SESSION_STATE>(args, 5);
+        const auto Buffer          = arg<nt::PVOID>(args, 6);
+        const auto BufferSize      = arg<nt::ULONG>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[86]);
@@ -2050,11 +2492,15 @@ opt<bpid_t> nt::syscalls::register_NtOpenEnlistment(proc_t proc, const on_NtOpen
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle      = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess         = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ResourceManagerHandle = arg<nt::HANDLE>(core, 2);
-        const auto EnlistmentGuid        = arg<nt::LPGUID>(core, 3);
-        const auto ObjectAttributes      = arg<nt::POBJECT_ATTRIBUTES>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle      = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess         = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ResourceManagerHandle = arg<nt::HANDLE>(args, 2);
+        const auto EnlistmentGuid        = arg<nt::LPGUID>(args, 3);
+        const auto ObjectAttributes      = arg<nt::POBJECT_ATTRIBUTES>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[87]);
@@ -2069,9 +2515,13 @@ opt<bpid_t> nt::syscalls::register_NtOpenEvent(proc_t proc, const on_NtOpenEvent
     {
         auto& core = d_->core;
 
-        const auto EventHandle      = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle      = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[88]);
@@ -2086,12 +2536,16 @@ opt<bpid_t> nt::syscalls::register_NtOpenFile(proc_t proc, const on_NtOpenFile_f
     {
         auto& core = d_->core;
 
-        const auto FileHandle       = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto IoStatusBlock    = arg<nt::PIO_STATUS_BLOCK>(core, 3);
-        const auto ShareAccess      = arg<nt::ULONG>(core, 4);
-        const auto OpenOptions      = arg<nt::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle       = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto IoStatusBlock    = arg<nt::PIO_STATUS_BLOCK>(args, 3);
+        const auto ShareAccess      = arg<nt::ULONG>(args, 4);
+        const auto OpenOptions      = arg<nt::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[89]);
@@ -2106,9 +2560,13 @@ opt<bpid_t> nt::syscalls::register_NtOpenIoCompletion(proc_t proc, const on_NtOp
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[90]);
@@ -2123,9 +2581,13 @@ opt<bpid_t> nt::syscalls::register_NtOpenJobObject(proc_t proc, const on_NtOpenJ
     {
         auto& core = d_->core;
 
-        const auto JobHandle        = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle        = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[91]);
@@ -2140,9 +2602,13 @@ opt<bpid_t> nt::syscalls::register_NtOpenKey(proc_t proc, const on_NtOpenKey_fn&
     {
         auto& core = d_->core;
 
-        const auto KeyHandle        = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle        = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[92]);
@@ -2157,10 +2623,14 @@ opt<bpid_t> nt::syscalls::register_NtOpenKeyEx(proc_t proc, const on_NtOpenKeyEx
     {
         auto& core = d_->core;
 
-        const auto KeyHandle        = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto OpenOptions      = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle        = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto OpenOptions      = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[93]);
@@ -2175,9 +2645,13 @@ opt<bpid_t> nt::syscalls::register_NtOpenKeyedEvent(proc_t proc, const on_NtOpen
     {
         auto& core = d_->core;
 
-        const auto KeyedEventHandle = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyedEventHandle = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[94]);
@@ -2192,9 +2666,13 @@ opt<bpid_t> nt::syscalls::register_NtOpenMutant(proc_t proc, const on_NtOpenMuta
     {
         auto& core = d_->core;
 
-        const auto MutantHandle     = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MutantHandle     = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[95]);
@@ -2209,10 +2687,14 @@ opt<bpid_t> nt::syscalls::register_NtOpenPrivateNamespace(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto NamespaceHandle    = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto BoundaryDescriptor = arg<nt::PVOID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto NamespaceHandle    = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto BoundaryDescriptor = arg<nt::PVOID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[96]);
@@ -2227,10 +2709,14 @@ opt<bpid_t> nt::syscalls::register_NtOpenProcess(proc_t proc, const on_NtOpenPro
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ClientId         = arg<nt::PCLIENT_ID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ClientId         = arg<nt::PCLIENT_ID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[97]);
@@ -2245,9 +2731,13 @@ opt<bpid_t> nt::syscalls::register_NtOpenProcessToken(proc_t proc, const on_NtOp
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<nt::HANDLE>(core, 0);
-        const auto DesiredAccess = arg<nt::ACCESS_MASK>(core, 1);
-        const auto TokenHandle   = arg<nt::PHANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<nt::HANDLE>(args, 0);
+        const auto DesiredAccess = arg<nt::ACCESS_MASK>(args, 1);
+        const auto TokenHandle   = arg<nt::PHANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[98]);
@@ -2262,10 +2752,14 @@ opt<bpid_t> nt::syscalls::register_NtOpenProcessTokenEx(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<nt::HANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto HandleAttributes = arg<nt::ULONG>(core, 2);
-        const auto TokenHandle      = arg<nt::PHANDLE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<nt::HANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto HandleAttributes = arg<nt::ULONG>(args, 2);
+        const auto TokenHandle      = arg<nt::PHANDLE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[99]);
@@ -2280,11 +2774,15 @@ opt<bpid_t> nt::syscalls::register_NtOpenResourceManager(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess         = arg<nt::ACCESS_MASK>(core, 1);
-        const auto TmHandle              = arg<nt::HANDLE>(core, 2);
-        const auto ResourceManagerGuid   = arg<nt::LPGUID>(core, 3);
-        const auto ObjectAttributes      = arg<nt::POBJECT_ATTRIBUTES>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess         = arg<nt::ACCESS_MASK>(args, 1);
+        const auto TmHandle              = arg<nt::HANDLE>(args, 2);
+        const auto ResourceManagerGuid   = arg<nt::LPGUID>(args, 3);
+        const auto ObjectAttributes      = arg<nt::POBJECT_ATTRIBUTES>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[100]);
@@ -2299,9 +2797,13 @@ opt<bpid_t> nt::syscalls::register_NtOpenSection(proc_t proc, const on_NtOpenSec
     {
         auto& core = d_->core;
 
-        const auto SectionHandle    = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionHandle    = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[101]);
@@ -2316,10 +2818,14 @@ opt<bpid_t> nt::syscalls::register_NtOpenThreadToken(proc_t proc, const on_NtOpe
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle  = arg<nt::HANDLE>(core, 0);
-        const auto DesiredAccess = arg<nt::ACCESS_MASK>(core, 1);
-        const auto OpenAsSelf    = arg<nt::BOOLEAN>(core, 2);
-        const auto TokenHandle   = arg<nt::PHANDLE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle  = arg<nt::HANDLE>(args, 0);
+        const auto DesiredAccess = arg<nt::ACCESS_MASK>(args, 1);
+        const auto OpenAsSelf    = arg<nt::BOOLEAN>(args, 2);
+        const auto TokenHandle   = arg<nt::PHANDLE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[102]);
@@ -2334,11 +2840,15 @@ opt<bpid_t> nt::syscalls::register_NtOpenThreadTokenEx(proc_t proc, const on_NtO
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle     = arg<nt::HANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto OpenAsSelf       = arg<nt::BOOLEAN>(core, 2);
-        const auto HandleAttributes = arg<nt::ULONG>(core, 3);
-        const auto TokenHandle      = arg<nt::PHANDLE>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle     = arg<nt::HANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto OpenAsSelf       = arg<nt::BOOLEAN>(args, 2);
+        const auto HandleAttributes = arg<nt::ULONG>(args, 3);
+        const auto TokenHandle      = arg<nt::PHANDLE>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[103]);
@@ -2353,12 +2863,16 @@ opt<bpid_t> nt::syscalls::register_NtOpenTransactionManager(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto TmHandle         = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto LogFileName      = arg<nt::PUNICODE_STRING>(core, 3);
-        const auto TmIdentity       = arg<nt::LPGUID>(core, 4);
-        const auto OpenOptions      = arg<nt::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TmHandle         = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto LogFileName      = arg<nt::PUNICODE_STRING>(args, 3);
+        const auto TmIdentity       = arg<nt::LPGUID>(args, 4);
+        const auto OpenOptions      = arg<nt::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[104]);
@@ -2373,11 +2887,15 @@ opt<bpid_t> nt::syscalls::register_NtPowerInformation(proc_t proc, const on_NtPo
     {
         auto& core = d_->core;
 
-        const auto InformationLevel   = arg<nt::POWER_INFORMATION_LEVEL>(core, 0);
-        const auto InputBuffer        = arg<nt::PVOID>(core, 1);
-        const auto InputBufferLength  = arg<nt::ULONG>(core, 2);
-        const auto OutputBuffer       = arg<nt::PVOID>(core, 3);
-        const auto OutputBufferLength = arg<nt::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto InformationLevel   = arg<nt::POWER_INFORMATION_LEVEL>(args, 0);
+        const auto InputBuffer        = arg<nt::PVOID>(args, 1);
+        const auto InputBufferLength  = arg<nt::ULONG>(args, 2);
+        const auto OutputBuffer       = arg<nt::PVOID>(args, 3);
+        const auto OutputBufferLength = arg<nt::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[105]);
@@ -2392,8 +2910,12 @@ opt<bpid_t> nt::syscalls::register_NtPrePrepareEnlistment(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<nt::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<nt::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[106]);
@@ -2408,12 +2930,16 @@ opt<bpid_t> nt::syscalls::register_NtPrivilegeObjectAuditAlarm(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto SubsystemName = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto HandleId      = arg<nt::PVOID>(core, 1);
-        const auto ClientToken   = arg<nt::HANDLE>(core, 2);
-        const auto DesiredAccess = arg<nt::ACCESS_MASK>(core, 3);
-        const auto Privileges    = arg<nt::PPRIVILEGE_SET>(core, 4);
-        const auto AccessGranted = arg<nt::BOOLEAN>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto HandleId      = arg<nt::PVOID>(args, 1);
+        const auto ClientToken   = arg<nt::HANDLE>(args, 2);
+        const auto DesiredAccess = arg<nt::ACCESS_MASK>(args, 3);
+        const auto Privileges    = arg<nt::PPRIVILEGE_SET>(args, 4);
+        const auto AccessGranted = arg<nt::BOOLEAN>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[107]);
@@ -2428,10 +2954,14 @@ opt<bpid_t> nt::syscalls::register_NtPropagationComplete(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle = arg<nt::HANDLE>(core, 0);
-        const auto RequestCookie         = arg<nt::ULONG>(core, 1);
-        const auto BufferLength          = arg<nt::ULONG>(core, 2);
-        const auto Buffer                = arg<nt::PVOID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle = arg<nt::HANDLE>(args, 0);
+        const auto RequestCookie         = arg<nt::ULONG>(args, 1);
+        const auto BufferLength          = arg<nt::ULONG>(args, 2);
+        const auto Buffer                = arg<nt::PVOID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[108]);
@@ -2446,9 +2976,13 @@ opt<bpid_t> nt::syscalls::register_NtPropagationFailed(proc_t proc, const on_NtP
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle = arg<nt::HANDLE>(core, 0);
-        const auto RequestCookie         = arg<nt::ULONG>(core, 1);
-        const auto PropStatus            = arg<nt::NTSTATUS>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle = arg<nt::HANDLE>(args, 0);
+        const auto RequestCookie         = arg<nt::ULONG>(args, 1);
+        const auto PropStatus            = arg<nt::NTSTATUS>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[109]);
@@ -2463,8 +2997,12 @@ opt<bpid_t> nt::syscalls::register_NtQueryBootOptions(proc_t proc, const on_NtQu
     {
         auto& core = d_->core;
 
-        const auto BootOptions       = arg<nt::PBOOT_OPTIONS>(core, 0);
-        const auto BootOptionsLength = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto BootOptions       = arg<nt::PBOOT_OPTIONS>(args, 0);
+        const auto BootOptionsLength = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[110]);
@@ -2479,8 +3017,12 @@ opt<bpid_t> nt::syscalls::register_NtQueryDefaultLocale(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto UserProfile     = arg<nt::BOOLEAN>(core, 0);
-        const auto DefaultLocaleId = arg<nt::PLCID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto UserProfile     = arg<nt::BOOLEAN>(args, 0);
+        const auto DefaultLocaleId = arg<nt::PLCID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[111]);
@@ -2495,17 +3037,21 @@ opt<bpid_t> nt::syscalls::register_NtQueryDirectoryFile(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto FileHandle           = arg<nt::HANDLE>(core, 0);
-        const auto Event                = arg<nt::HANDLE>(core, 1);
-        const auto ApcRoutine           = arg<nt::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext           = arg<nt::PVOID>(core, 3);
-        const auto IoStatusBlock        = arg<nt::PIO_STATUS_BLOCK>(core, 4);
-        const auto FileInformation      = arg<nt::PVOID>(core, 5);
-        const auto Length               = arg<nt::ULONG>(core, 6);
-        const auto FileInformationClass = arg<nt::FILE_INFORMATION_CLASS>(core, 7);
-        const auto ReturnSingleEntry    = arg<nt::BOOLEAN>(core, 8);
-        const auto FileName             = arg<nt::PUNICODE_STRING>(core, 9);
-        const auto RestartScan          = arg<nt::BOOLEAN>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle           = arg<nt::HANDLE>(args, 0);
+        const auto Event                = arg<nt::HANDLE>(args, 1);
+        const auto ApcRoutine           = arg<nt::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext           = arg<nt::PVOID>(args, 3);
+        const auto IoStatusBlock        = arg<nt::PIO_STATUS_BLOCK>(args, 4);
+        const auto FileInformation      = arg<nt::PVOID>(args, 5);
+        const auto Length               = arg<nt::ULONG>(args, 6);
+        const auto FileInformationClass = arg<nt::FILE_INFORMATION_CLASS>(args, 7);
+        const auto ReturnSingleEntry    = arg<nt::BOOLEAN>(args, 8);
+        const auto FileName             = arg<nt::PUNICODE_STRING>(args, 9);
+        const auto RestartScan          = arg<nt::BOOLEAN>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[112]);
@@ -2520,8 +3066,12 @@ opt<bpid_t> nt::syscalls::register_NtQueryDriverEntryOrder(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto Ids   = arg<nt::PULONG>(core, 0);
-        const auto Count = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Ids   = arg<nt::PULONG>(args, 0);
+        const auto Count = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[113]);
@@ -2536,11 +3086,15 @@ opt<bpid_t> nt::syscalls::register_NtQueryEvent(proc_t proc, const on_NtQueryEve
     {
         auto& core = d_->core;
 
-        const auto EventHandle            = arg<nt::HANDLE>(core, 0);
-        const auto EventInformationClass  = arg<nt::EVENT_INFORMATION_CLASS>(core, 1);
-        const auto EventInformation       = arg<nt::PVOID>(core, 2);
-        const auto EventInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength           = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle            = arg<nt::HANDLE>(args, 0);
+        const auto EventInformationClass  = arg<nt::EVENT_INFORMATION_CLASS>(args, 1);
+        const auto EventInformation       = arg<nt::PVOID>(args, 2);
+        const auto EventInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength           = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[114]);
@@ -2555,8 +3109,12 @@ opt<bpid_t> nt::syscalls::register_NtQueryFullAttributesFile(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
-        const auto FileInformation  = arg<nt::PFILE_NETWORK_OPEN_INFORMATION>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
+        const auto FileInformation  = arg<nt::PFILE_NETWORK_OPEN_INFORMATION>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[115]);
@@ -2571,11 +3129,15 @@ opt<bpid_t> nt::syscalls::register_NtQueryInformationAtom(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto Atom                  = arg<nt::RTL_ATOM>(core, 0);
-        const auto InformationClass      = arg<nt::ATOM_INFORMATION_CLASS>(core, 1);
-        const auto AtomInformation       = arg<nt::PVOID>(core, 2);
-        const auto AtomInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength          = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Atom                  = arg<nt::RTL_ATOM>(args, 0);
+        const auto InformationClass      = arg<nt::ATOM_INFORMATION_CLASS>(args, 1);
+        const auto AtomInformation       = arg<nt::PVOID>(args, 2);
+        const auto AtomInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength          = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[116]);
@@ -2590,11 +3152,15 @@ opt<bpid_t> nt::syscalls::register_NtQueryInformationEnlistment(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle            = arg<nt::HANDLE>(core, 0);
-        const auto EnlistmentInformationClass  = arg<nt::ENLISTMENT_INFORMATION_CLASS>(core, 1);
-        const auto EnlistmentInformation       = arg<nt::PVOID>(core, 2);
-        const auto EnlistmentInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength                = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle            = arg<nt::HANDLE>(args, 0);
+        const auto EnlistmentInformationClass  = arg<nt::ENLISTMENT_INFORMATION_CLASS>(args, 1);
+        const auto EnlistmentInformation       = arg<nt::PVOID>(args, 2);
+        const auto EnlistmentInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength                = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[117]);
@@ -2609,11 +3175,15 @@ opt<bpid_t> nt::syscalls::register_NtQueryInformationFile(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto FileHandle           = arg<nt::HANDLE>(core, 0);
-        const auto IoStatusBlock        = arg<nt::PIO_STATUS_BLOCK>(core, 1);
-        const auto FileInformation      = arg<nt::PVOID>(core, 2);
-        const auto Length               = arg<nt::ULONG>(core, 3);
-        const auto FileInformationClass = arg<nt::FILE_INFORMATION_CLASS>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle           = arg<nt::HANDLE>(args, 0);
+        const auto IoStatusBlock        = arg<nt::PIO_STATUS_BLOCK>(args, 1);
+        const auto FileInformation      = arg<nt::PVOID>(args, 2);
+        const auto Length               = arg<nt::ULONG>(args, 3);
+        const auto FileInformationClass = arg<nt::FILE_INFORMATION_CLASS>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[118]);
@@ -2628,11 +3198,15 @@ opt<bpid_t> nt::syscalls::register_NtQueryInformationJobObject(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto JobHandle                  = arg<nt::HANDLE>(core, 0);
-        const auto JobObjectInformationClass  = arg<nt::JOBOBJECTINFOCLASS>(core, 1);
-        const auto JobObjectInformation       = arg<nt::PVOID>(core, 2);
-        const auto JobObjectInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength               = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle                  = arg<nt::HANDLE>(args, 0);
+        const auto JobObjectInformationClass  = arg<nt::JOBOBJECTINFOCLASS>(args, 1);
+        const auto JobObjectInformation       = arg<nt::PVOID>(args, 2);
+        const auto JobObjectInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength               = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[119]);
@@ -2647,11 +3221,15 @@ opt<bpid_t> nt::syscalls::register_NtQueryInformationPort(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto PortHandle           = arg<nt::HANDLE>(core, 0);
-        const auto PortInformationClass = arg<nt::PORT_INFORMATION_CLASS>(core, 1);
-        const auto PortInformation      = arg<nt::PVOID>(core, 2);
-        const auto Length               = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength         = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle           = arg<nt::HANDLE>(args, 0);
+        const auto PortInformationClass = arg<nt::PORT_INFORMATION_CLASS>(args, 1);
+        const auto PortInformation      = arg<nt::PVOID>(args, 2);
+        const auto Length               = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength         = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[120]);
@@ -2666,11 +3244,15 @@ opt<bpid_t> nt::syscalls::register_NtQueryInformationProcess(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle            = arg<nt::HANDLE>(core, 0);
-        const auto ProcessInformationClass  = arg<nt::PROCESSINFOCLASS>(core, 1);
-        const auto ProcessInformation       = arg<nt::PVOID>(core, 2);
-        const auto ProcessInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength             = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle            = arg<nt::HANDLE>(args, 0);
+        const auto ProcessInformationClass  = arg<nt::PROCESSINFOCLASS>(args, 1);
+        const auto ProcessInformation       = arg<nt::PVOID>(args, 2);
+        const auto ProcessInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength             = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[121]);
@@ -2685,11 +3267,15 @@ opt<bpid_t> nt::syscalls::register_NtQueryInformationResourceManager(proc_t proc
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle            = arg<nt::HANDLE>(core, 0);
-        const auto ResourceManagerInformationClass  = arg<nt::RESOURCEMANAGER_INFORMATION_CLASS>(core, 1);
-        const auto ResourceManagerInformation       = arg<nt::PVOID>(core, 2);
-        const auto ResourceManagerInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength                     = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle            = arg<nt::HANDLE>(args, 0);
+        const auto ResourceManagerInformationClass  = arg<nt::RESOURCEMANAGER_INFORMATION_CLASS>(args, 1);
+        const auto ResourceManagerInformation       = arg<nt::PVOID>(args, 2);
+        const auto ResourceManagerInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength                     = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[122]);
@@ -2704,11 +3290,15 @@ opt<bpid_t> nt::syscalls::register_NtQueryInformationToken(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto TokenHandle            = arg<nt::HANDLE>(core, 0);
-        const auto TokenInformationClass  = arg<nt::TOKEN_INFORMATION_CLASS>(core, 1);
-        const auto TokenInformation       = arg<nt::PVOID>(core, 2);
-        const auto TokenInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength           = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle            = arg<nt::HANDLE>(args, 0);
+        const auto TokenInformationClass  = arg<nt::TOKEN_INFORMATION_CLASS>(args, 1);
+        const auto TokenInformation       = arg<nt::PVOID>(args, 2);
+        const auto TokenInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength           = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[123]);
@@ -2723,11 +3313,15 @@ opt<bpid_t> nt::syscalls::register_NtQueryInformationTransactionManager(proc_t p
     {
         auto& core = d_->core;
 
-        const auto TransactionManagerHandle            = arg<nt::HANDLE>(core, 0);
-        const auto TransactionManagerInformationClass  = arg<nt::TRANSACTIONMANAGER_INFORMATION_CLASS>(core, 1);
-        const auto TransactionManagerInformation       = arg<nt::PVOID>(core, 2);
-        const auto TransactionManagerInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength                        = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionManagerHandle            = arg<nt::HANDLE>(args, 0);
+        const auto TransactionManagerInformationClass  = arg<nt::TRANSACTIONMANAGER_INFORMATION_CLASS>(args, 1);
+        const auto TransactionManagerInformation       = arg<nt::PVOID>(args, 2);
+        const auto TransactionManagerInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength                        = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[124]);
@@ -2742,7 +3336,11 @@ opt<bpid_t> nt::syscalls::register_NtQueryInstallUILanguage(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto STARInstallUILanguageId = arg<nt::LANGID>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto STARInstallUILanguageId = arg<nt::LANGID>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[125]);
@@ -2757,8 +3355,12 @@ opt<bpid_t> nt::syscalls::register_NtQueryIntervalProfile(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto ProfileSource = arg<nt::KPROFILE_SOURCE>(core, 0);
-        const auto Interval      = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProfileSource = arg<nt::KPROFILE_SOURCE>(args, 0);
+        const auto Interval      = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[126]);
@@ -2773,11 +3375,15 @@ opt<bpid_t> nt::syscalls::register_NtQueryIoCompletion(proc_t proc, const on_NtQ
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle            = arg<nt::HANDLE>(core, 0);
-        const auto IoCompletionInformationClass  = arg<nt::IO_COMPLETION_INFORMATION_CLASS>(core, 1);
-        const auto IoCompletionInformation       = arg<nt::PVOID>(core, 2);
-        const auto IoCompletionInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength                  = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle            = arg<nt::HANDLE>(args, 0);
+        const auto IoCompletionInformationClass  = arg<nt::IO_COMPLETION_INFORMATION_CLASS>(args, 1);
+        const auto IoCompletionInformation       = arg<nt::PVOID>(args, 2);
+        const auto IoCompletionInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength                  = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[127]);
@@ -2792,8 +3398,12 @@ opt<bpid_t> nt::syscalls::register_NtQueryOpenSubKeys(proc_t proc, const on_NtQu
     {
         auto& core = d_->core;
 
-        const auto TargetKey   = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
-        const auto HandleCount = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey   = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
+        const auto HandleCount = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[128]);
@@ -2808,10 +3418,14 @@ opt<bpid_t> nt::syscalls::register_NtQueryOpenSubKeysEx(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto TargetKey    = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
-        const auto BufferLength = arg<nt::ULONG>(core, 1);
-        const auto Buffer       = arg<nt::PVOID>(core, 2);
-        const auto RequiredSize = arg<nt::PULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey    = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
+        const auto BufferLength = arg<nt::ULONG>(args, 1);
+        const auto Buffer       = arg<nt::PVOID>(args, 2);
+        const auto RequiredSize = arg<nt::PULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[129]);
@@ -2826,8 +3440,12 @@ opt<bpid_t> nt::syscalls::register_NtQueryPerformanceCounter(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto PerformanceCounter   = arg<nt::PLARGE_INTEGER>(core, 0);
-        const auto PerformanceFrequency = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PerformanceCounter   = arg<nt::PLARGE_INTEGER>(args, 0);
+        const auto PerformanceFrequency = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[130]);
@@ -2855,15 +3473,19 @@ opt<bpid_t> nt::syscalls::register_NtQueryQuotaInformationFile(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto FileHandle        = arg<nt::HANDLE>(core, 0);
-        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(core, 1);
-        const auto Buffer            = arg<nt::PVOID>(core, 2);
-        const auto Length            = arg<nt::ULONG>(core, 3);
-        const auto ReturnSingleEntry = arg<nt::BOOLEAN>(core, 4);
-        const auto SidList           = arg<nt::PVOID>(core, 5);
-        const auto SidListLength     = arg<nt::ULONG>(core, 6);
-        const auto StartSid          = arg<nt::PULONG>(core, 7);
-        const auto RestartScan       = arg<nt::BOOLEAN>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle        = arg<nt::HANDLE>(args, 0);
+        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(args, 1);
+        const auto Buffer            = arg<nt::PVOID>(args, 2);
+        const auto Length            = arg<nt::ULONG>(args, 3);
+        const auto ReturnSingleEntry = arg<nt::BOOLEAN>(args, 4);
+        const auto SidList           = arg<nt::PVOID>(args, 5);
+        const auto SidListLength     = arg<nt::ULONG>(args, 6);
+        const auto StartSid          = arg<nt::PULONG>(args, 7);
+        const auto RestartScan       = arg<nt::BOOLEAN>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[132]);
@@ -2878,11 +3500,15 @@ opt<bpid_t> nt::syscalls::register_NtQuerySection(proc_t proc, const on_NtQueryS
     {
         auto& core = d_->core;
 
-        const auto SectionHandle            = arg<nt::HANDLE>(core, 0);
-        const auto SectionInformationClass  = arg<nt::SECTION_INFORMATION_CLASS>(core, 1);
-        const auto SectionInformation       = arg<nt::PVOID>(core, 2);
-        const auto SectionInformationLength = arg<nt::SIZE_T>(core, 3);
-        const auto ReturnLength             = arg<nt::PSIZE_T>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionHandle            = arg<nt::HANDLE>(args, 0);
+        const auto SectionInformationClass  = arg<nt::SECTION_INFORMATION_CLASS>(args, 1);
+        const auto SectionInformation       = arg<nt::PVOID>(args, 2);
+        const auto SectionInformationLength = arg<nt::SIZE_T>(args, 3);
+        const auto ReturnLength             = arg<nt::PSIZE_T>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[133]);
@@ -2897,11 +3523,15 @@ opt<bpid_t> nt::syscalls::register_NtQuerySecurityObject(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto Handle              = arg<nt::HANDLE>(core, 0);
-        const auto SecurityInformation = arg<nt::SECURITY_INFORMATION>(core, 1);
-        const auto SecurityDescriptor  = arg<nt::PSECURITY_DESCRIPTOR>(core, 2);
-        const auto Length              = arg<nt::ULONG>(core, 3);
-        const auto LengthNeeded        = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle              = arg<nt::HANDLE>(args, 0);
+        const auto SecurityInformation = arg<nt::SECURITY_INFORMATION>(args, 1);
+        const auto SecurityDescriptor  = arg<nt::PSECURITY_DESCRIPTOR>(args, 2);
+        const auto Length              = arg<nt::ULONG>(args, 3);
+        const auto LengthNeeded        = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[134]);
@@ -2916,9 +3546,13 @@ opt<bpid_t> nt::syscalls::register_NtQuerySymbolicLinkObject(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto LinkHandle     = arg<nt::HANDLE>(core, 0);
-        const auto LinkTarget     = arg<nt::PUNICODE_STRING>(core, 1);
-        const auto ReturnedLength = arg<nt::PULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto LinkHandle     = arg<nt::HANDLE>(args, 0);
+        const auto LinkTarget     = arg<nt::PUNICODE_STRING>(args, 1);
+        const auto ReturnedLength = arg<nt::PULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[135]);
@@ -2933,10 +3567,14 @@ opt<bpid_t> nt::syscalls::register_NtQuerySystemEnvironmentValue(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto VariableName  = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto VariableValue = arg<nt::PWSTR>(core, 1);
-        const auto ValueLength   = arg<nt::USHORT>(core, 2);
-        const auto ReturnLength  = arg<nt::PUSHORT>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto VariableName  = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto VariableValue = arg<nt::PWSTR>(args, 1);
+        const auto ValueLength   = arg<nt::USHORT>(args, 2);
+        const auto ReturnLength  = arg<nt::PUSHORT>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[136]);
@@ -2951,11 +3589,15 @@ opt<bpid_t> nt::syscalls::register_NtQuerySystemEnvironmentValueEx(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto VariableName = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto VendorGuid   = arg<nt::LPGUID>(core, 1);
-        const auto Value        = arg<nt::PVOID>(core, 2);
-        const auto ValueLength  = arg<nt::PULONG>(core, 3);
-        const auto Attributes   = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto VariableName = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto VendorGuid   = arg<nt::LPGUID>(args, 1);
+        const auto Value        = arg<nt::PVOID>(args, 2);
+        const auto ValueLength  = arg<nt::PULONG>(args, 3);
+        const auto Attributes   = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[137]);
@@ -2970,10 +3612,14 @@ opt<bpid_t> nt::syscalls::register_NtQuerySystemInformation(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto SystemInformationClass  = arg<nt::SYSTEM_INFORMATION_CLASS>(core, 0);
-        const auto SystemInformation       = arg<nt::PVOID>(core, 1);
-        const auto SystemInformationLength = arg<nt::ULONG>(core, 2);
-        const auto ReturnLength            = arg<nt::PULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemInformationClass  = arg<nt::SYSTEM_INFORMATION_CLASS>(args, 0);
+        const auto SystemInformation       = arg<nt::PVOID>(args, 1);
+        const auto SystemInformationLength = arg<nt::ULONG>(args, 2);
+        const auto ReturnLength            = arg<nt::PULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[138]);
@@ -2988,12 +3634,16 @@ opt<bpid_t> nt::syscalls::register_NtQuerySystemInformationEx(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto SystemInformationClass  = arg<nt::SYSTEM_INFORMATION_CLASS>(core, 0);
-        const auto QueryInformation        = arg<nt::PVOID>(core, 1);
-        const auto QueryInformationLength  = arg<nt::ULONG>(core, 2);
-        const auto SystemInformation       = arg<nt::PVOID>(core, 3);
-        const auto SystemInformationLength = arg<nt::ULONG>(core, 4);
-        const auto ReturnLength            = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemInformationClass  = arg<nt::SYSTEM_INFORMATION_CLASS>(args, 0);
+        const auto QueryInformation        = arg<nt::PVOID>(args, 1);
+        const auto QueryInformationLength  = arg<nt::ULONG>(args, 2);
+        const auto SystemInformation       = arg<nt::PVOID>(args, 3);
+        const auto SystemInformationLength = arg<nt::ULONG>(args, 4);
+        const auto ReturnLength            = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[139]);
@@ -3008,12 +3658,16 @@ opt<bpid_t> nt::syscalls::register_NtQueryValueKey(proc_t proc, const on_NtQuery
     {
         auto& core = d_->core;
 
-        const auto KeyHandle                = arg<nt::HANDLE>(core, 0);
-        const auto ValueName                = arg<nt::PUNICODE_STRING>(core, 1);
-        const auto KeyValueInformationClass = arg<nt::KEY_VALUE_INFORMATION_CLASS>(core, 2);
-        const auto KeyValueInformation      = arg<nt::PVOID>(core, 3);
-        const auto Length                   = arg<nt::ULONG>(core, 4);
-        const auto ResultLength             = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle                = arg<nt::HANDLE>(args, 0);
+        const auto ValueName                = arg<nt::PUNICODE_STRING>(args, 1);
+        const auto KeyValueInformationClass = arg<nt::KEY_VALUE_INFORMATION_CLASS>(args, 2);
+        const auto KeyValueInformation      = arg<nt::PVOID>(args, 3);
+        const auto Length                   = arg<nt::ULONG>(args, 4);
+        const auto ResultLength             = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[140]);
@@ -3028,11 +3682,15 @@ opt<bpid_t> nt::syscalls::register_NtQueueApcThread(proc_t proc, const on_NtQueu
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle = arg<nt::HANDLE>(core, 0);
-        const auto ApcRoutine   = arg<nt::PPS_APC_ROUTINE>(core, 1);
-        const auto ApcArgument1 = arg<nt::PVOID>(core, 2);
-        const auto ApcArgument2 = arg<nt::PVOID>(core, 3);
-        const auto ApcArgument3 = arg<nt::PVOID>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle = arg<nt::HANDLE>(args, 0);
+        const auto ApcRoutine   = arg<nt::PPS_APC_ROUTINE>(args, 1);
+        const auto ApcArgument1 = arg<nt::PVOID>(args, 2);
+        const auto ApcArgument2 = arg<nt::PVOID>(args, 3);
+        const auto ApcArgument3 = arg<nt::PVOID>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[141]);
@@ -3047,12 +3705,16 @@ opt<bpid_t> nt::syscalls::register_NtQueueApcThreadEx(proc_t proc, const on_NtQu
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle         = arg<nt::HANDLE>(core, 0);
-        const auto UserApcReserveHandle = arg<nt::HANDLE>(core, 1);
-        const auto ApcRoutine           = arg<nt::PPS_APC_ROUTINE>(core, 2);
-        const auto ApcArgument1         = arg<nt::PVOID>(core, 3);
-        const auto ApcArgument2         = arg<nt::PVOID>(core, 4);
-        const auto ApcArgument3         = arg<nt::PVOID>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle         = arg<nt::HANDLE>(args, 0);
+        const auto UserApcReserveHandle = arg<nt::HANDLE>(args, 1);
+        const auto ApcRoutine           = arg<nt::PPS_APC_ROUTINE>(args, 2);
+        const auto ApcArgument1         = arg<nt::PVOID>(args, 3);
+        const auto ApcArgument2         = arg<nt::PVOID>(args, 4);
+        const auto ApcArgument3         = arg<nt::PVOID>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[142]);
@@ -3067,12 +3729,16 @@ opt<bpid_t> nt::syscalls::register_NtRaiseHardError(proc_t proc, const on_NtRais
     {
         auto& core = d_->core;
 
-        const auto ErrorStatus                = arg<nt::NTSTATUS>(core, 0);
-        const auto NumberOfParameters         = arg<nt::ULONG>(core, 1);
-        const auto UnicodeStringParameterMask = arg<nt::ULONG>(core, 2);
-        const auto Parameters                 = arg<nt::PULONG_PTR>(core, 3);
-        const auto ValidResponseOptions       = arg<nt::ULONG>(core, 4);
-        const auto Response                   = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ErrorStatus                = arg<nt::NTSTATUS>(args, 0);
+        const auto NumberOfParameters         = arg<nt::ULONG>(args, 1);
+        const auto UnicodeStringParameterMask = arg<nt::ULONG>(args, 2);
+        const auto Parameters                 = arg<nt::PULONG_PTR>(args, 3);
+        const auto ValidResponseOptions       = arg<nt::ULONG>(args, 4);
+        const auto Response                   = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[143]);
@@ -3087,15 +3753,19 @@ opt<bpid_t> nt::syscalls::register_NtReadFile(proc_t proc, const on_NtReadFile_f
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<nt::HANDLE>(core, 0);
-        const auto Event         = arg<nt::HANDLE>(core, 1);
-        const auto ApcRoutine    = arg<nt::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext    = arg<nt::PVOID>(core, 3);
-        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(core, 4);
-        const auto Buffer        = arg<nt::PVOID>(core, 5);
-        const auto Length        = arg<nt::ULONG>(core, 6);
-        const auto ByteOffset    = arg<nt::PLARGE_INTEGER>(core, 7);
-        const auto Key           = arg<nt::PULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<nt::HANDLE>(args, 0);
+        const auto Event         = arg<nt::HANDLE>(args, 1);
+        const auto ApcRoutine    = arg<nt::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext    = arg<nt::PVOID>(args, 3);
+        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(args, 4);
+        const auto Buffer        = arg<nt::PVOID>(args, 5);
+        const auto Length        = arg<nt::ULONG>(args, 6);
+        const auto ByteOffset    = arg<nt::PLARGE_INTEGER>(args, 7);
+        const auto Key           = arg<nt::PULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[144]);
@@ -3110,12 +3780,16 @@ opt<bpid_t> nt::syscalls::register_NtReadRequestData(proc_t proc, const on_NtRea
     {
         auto& core = d_->core;
 
-        const auto PortHandle        = arg<nt::HANDLE>(core, 0);
-        const auto Message           = arg<nt::PPORT_MESSAGE>(core, 1);
-        const auto DataEntryIndex    = arg<nt::ULONG>(core, 2);
-        const auto Buffer            = arg<nt::PVOID>(core, 3);
-        const auto BufferSize        = arg<nt::SIZE_T>(core, 4);
-        const auto NumberOfBytesRead = arg<nt::PSIZE_T>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle        = arg<nt::HANDLE>(args, 0);
+        const auto Message           = arg<nt::PPORT_MESSAGE>(args, 1);
+        const auto DataEntryIndex    = arg<nt::ULONG>(args, 2);
+        const auto Buffer            = arg<nt::PVOID>(args, 3);
+        const auto BufferSize        = arg<nt::SIZE_T>(args, 4);
+        const auto NumberOfBytesRead = arg<nt::PSIZE_T>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[145]);
@@ -3130,7 +3804,11 @@ opt<bpid_t> nt::syscalls::register_NtRecoverTransactionManager(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto TransactionManagerHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionManagerHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[146]);
@@ -3145,11 +3823,15 @@ opt<bpid_t> nt::syscalls::register_NtRegisterProtocolAddressInformation(proc_t p
     {
         auto& core = d_->core;
 
-        const auto ResourceManager         = arg<nt::HANDLE>(core, 0);
-        const auto ProtocolId              = arg<nt::PCRM_PROTOCOL_ID>(core, 1);
-        const auto ProtocolInformationSize = arg<nt::ULONG>(core, 2);
-        const auto ProtocolInformation     = arg<nt::PVOID>(core, 3);
-        const auto CreateOptions           = arg<nt::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManager         = arg<nt::HANDLE>(args, 0);
+        const auto ProtocolId              = arg<nt::PCRM_PROTOCOL_ID>(args, 1);
+        const auto ProtocolInformationSize = arg<nt::ULONG>(args, 2);
+        const auto ProtocolInformation     = arg<nt::PVOID>(args, 3);
+        const auto CreateOptions           = arg<nt::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[147]);
@@ -3164,7 +3846,11 @@ opt<bpid_t> nt::syscalls::register_NtRegisterThreadTerminatePort(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[148]);
@@ -3179,10 +3865,14 @@ opt<bpid_t> nt::syscalls::register_NtReleaseKeyedEvent(proc_t proc, const on_NtR
     {
         auto& core = d_->core;
 
-        const auto KeyedEventHandle = arg<nt::HANDLE>(core, 0);
-        const auto KeyValue         = arg<nt::PVOID>(core, 1);
-        const auto Alertable        = arg<nt::BOOLEAN>(core, 2);
-        const auto Timeout          = arg<nt::PLARGE_INTEGER>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyedEventHandle = arg<nt::HANDLE>(args, 0);
+        const auto KeyValue         = arg<nt::PVOID>(args, 1);
+        const auto Alertable        = arg<nt::BOOLEAN>(args, 2);
+        const auto Timeout          = arg<nt::PLARGE_INTEGER>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[149]);
@@ -3197,7 +3887,11 @@ opt<bpid_t> nt::syscalls::register_NtReleaseWorkerFactoryWorker(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[150]);
@@ -3212,8 +3906,12 @@ opt<bpid_t> nt::syscalls::register_NtRenameKey(proc_t proc, const on_NtRenameKey
     {
         auto& core = d_->core;
 
-        const auto KeyHandle = arg<nt::HANDLE>(core, 0);
-        const auto NewName   = arg<nt::PUNICODE_STRING>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle = arg<nt::HANDLE>(args, 0);
+        const auto NewName   = arg<nt::PUNICODE_STRING>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[151]);
@@ -3228,8 +3926,12 @@ opt<bpid_t> nt::syscalls::register_NtRenameTransactionManager(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto LogFileName                    = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto ExistingTransactionManagerGuid = arg<nt::LPGUID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto LogFileName                    = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto ExistingTransactionManagerGuid = arg<nt::LPGUID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[152]);
@@ -3244,9 +3946,13 @@ opt<bpid_t> nt::syscalls::register_NtReplaceKey(proc_t proc, const on_NtReplaceK
     {
         auto& core = d_->core;
 
-        const auto NewFile      = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
-        const auto TargetHandle = arg<nt::HANDLE>(core, 1);
-        const auto OldFile      = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto NewFile      = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
+        const auto TargetHandle = arg<nt::HANDLE>(args, 1);
+        const auto OldFile      = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[153]);
@@ -3261,9 +3967,13 @@ opt<bpid_t> nt::syscalls::register_NtReplacePartitionUnit(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto TargetInstancePath = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto SpareInstancePath  = arg<nt::PUNICODE_STRING>(core, 1);
-        const auto Flags              = arg<nt::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetInstancePath = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto SpareInstancePath  = arg<nt::PUNICODE_STRING>(args, 1);
+        const auto Flags              = arg<nt::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[154]);
@@ -3278,8 +3988,12 @@ opt<bpid_t> nt::syscalls::register_NtReplyPort(proc_t proc, const on_NtReplyPort
     {
         auto& core = d_->core;
 
-        const auto PortHandle   = arg<nt::HANDLE>(core, 0);
-        const auto ReplyMessage = arg<nt::PPORT_MESSAGE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle   = arg<nt::HANDLE>(args, 0);
+        const auto ReplyMessage = arg<nt::PPORT_MESSAGE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[155]);
@@ -3294,8 +4008,12 @@ opt<bpid_t> nt::syscalls::register_NtReplyWaitReplyPort(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto PortHandle   = arg<nt::HANDLE>(core, 0);
-        const auto ReplyMessage = arg<nt::PPORT_MESSAGE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle   = arg<nt::HANDLE>(args, 0);
+        const auto ReplyMessage = arg<nt::PPORT_MESSAGE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[156]);
@@ -3310,8 +4028,12 @@ opt<bpid_t> nt::syscalls::register_NtRequestPort(proc_t proc, const on_NtRequest
     {
         auto& core = d_->core;
 
-        const auto PortHandle     = arg<nt::HANDLE>(core, 0);
-        const auto RequestMessage = arg<nt::PPORT_MESSAGE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle     = arg<nt::HANDLE>(args, 0);
+        const auto RequestMessage = arg<nt::PPORT_MESSAGE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[157]);
@@ -3326,9 +4048,13 @@ opt<bpid_t> nt::syscalls::register_NtRestoreKey(proc_t proc, const on_NtRestoreK
     {
         auto& core = d_->core;
 
-        const auto KeyHandle  = arg<nt::HANDLE>(core, 0);
-        const auto FileHandle = arg<nt::HANDLE>(core, 1);
-        const auto Flags      = arg<nt::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle  = arg<nt::HANDLE>(args, 0);
+        const auto FileHandle = arg<nt::HANDLE>(args, 1);
+        const auto Flags      = arg<nt::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[158]);
@@ -3343,8 +4069,12 @@ opt<bpid_t> nt::syscalls::register_NtRollbackEnlistment(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<nt::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<nt::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[159]);
@@ -3359,8 +4089,12 @@ opt<bpid_t> nt::syscalls::register_NtRollforwardTransactionManager(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto TransactionManagerHandle = arg<nt::HANDLE>(core, 0);
-        const auto TmVirtualClock           = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionManagerHandle = arg<nt::HANDLE>(args, 0);
+        const auto TmVirtualClock           = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[160]);
@@ -3375,8 +4109,12 @@ opt<bpid_t> nt::syscalls::register_NtSaveKey(proc_t proc, const on_NtSaveKey_fn&
     {
         auto& core = d_->core;
 
-        const auto KeyHandle  = arg<nt::HANDLE>(core, 0);
-        const auto FileHandle = arg<nt::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle  = arg<nt::HANDLE>(args, 0);
+        const auto FileHandle = arg<nt::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[161]);
@@ -3391,9 +4129,13 @@ opt<bpid_t> nt::syscalls::register_NtSaveKeyEx(proc_t proc, const on_NtSaveKeyEx
     {
         auto& core = d_->core;
 
-        const auto KeyHandle  = arg<nt::HANDLE>(core, 0);
-        const auto FileHandle = arg<nt::HANDLE>(core, 1);
-        const auto Format     = arg<nt::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle  = arg<nt::HANDLE>(args, 0);
+        const auto FileHandle = arg<nt::HANDLE>(args, 1);
+        const auto Format     = arg<nt::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[162]);
@@ -3408,15 +4150,19 @@ opt<bpid_t> nt::syscalls::register_NtSecureConnectPort(proc_t proc, const on_NtS
     {
         auto& core = d_->core;
 
-        const auto PortHandle                  = arg<nt::PHANDLE>(core, 0);
-        const auto PortName                    = arg<nt::PUNICODE_STRING>(core, 1);
-        const auto SecurityQos                 = arg<nt::PSECURITY_QUALITY_OF_SERVICE>(core, 2);
-        const auto ClientView                  = arg<nt::PPORT_VIEW>(core, 3);
-        const auto RequiredServerSid           = arg<nt::PSID>(core, 4);
-        const auto ServerView                  = arg<nt::PREMOTE_PORT_VIEW>(core, 5);
-        const auto MaxMessageLength            = arg<nt::PULONG>(core, 6);
-        const auto ConnectionInformation       = arg<nt::PVOID>(core, 7);
-        const auto ConnectionInformationLength = arg<nt::PULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle                  = arg<nt::PHANDLE>(args, 0);
+        const auto PortName                    = arg<nt::PUNICODE_STRING>(args, 1);
+        const auto SecurityQos                 = arg<nt::PSECURITY_QUALITY_OF_SERVICE>(args, 2);
+        const auto ClientView                  = arg<nt::PPORT_VIEW>(args, 3);
+        const auto RequiredServerSid           = arg<nt::PSID>(args, 4);
+        const auto ServerView                  = arg<nt::PREMOTE_PORT_VIEW>(args, 5);
+        const auto MaxMessageLength            = arg<nt::PULONG>(args, 6);
+        const auto ConnectionInformation       = arg<nt::PVOID>(args, 7);
+        const auto ConnectionInformationLength = arg<nt::PULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[163]);
@@ -3431,8 +4177,12 @@ opt<bpid_t> nt::syscalls::register_NtSetBootOptions(proc_t proc, const on_NtSetB
     {
         auto& core = d_->core;
 
-        const auto BootOptions    = arg<nt::PBOOT_OPTIONS>(core, 0);
-        const auto FieldsToChange = arg<nt::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto BootOptions    = arg<nt::PBOOT_OPTIONS>(args, 0);
+        const auto FieldsToChange = arg<nt::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[164]);
@@ -3447,8 +4197,12 @@ opt<bpid_t> nt::syscalls::register_NtSetContextThread(proc_t proc, const on_NtSe
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle  = arg<nt::HANDLE>(core, 0);
-        const auto ThreadContext = arg<nt::PCONTEXT>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle  = arg<nt::HANDLE>(args, 0);
+        const auto ThreadContext = arg<nt::PCONTEXT>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[165]);
@@ -3463,7 +4217,11 @@ opt<bpid_t> nt::syscalls::register_NtSetDefaultHardErrorPort(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto DefaultHardErrorPort = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DefaultHardErrorPort = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[166]);
@@ -3478,8 +4236,12 @@ opt<bpid_t> nt::syscalls::register_NtSetDefaultLocale(proc_t proc, const on_NtSe
     {
         auto& core = d_->core;
 
-        const auto UserProfile     = arg<nt::BOOLEAN>(core, 0);
-        const auto DefaultLocaleId = arg<nt::LCID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto UserProfile     = arg<nt::BOOLEAN>(args, 0);
+        const auto DefaultLocaleId = arg<nt::LCID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[167]);
@@ -3494,8 +4256,12 @@ opt<bpid_t> nt::syscalls::register_NtSetDriverEntryOrder(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto Ids   = arg<nt::PULONG>(core, 0);
-        const auto Count = arg<nt::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Ids   = arg<nt::PULONG>(args, 0);
+        const auto Count = arg<nt::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[168]);
@@ -3510,7 +4276,11 @@ opt<bpid_t> nt::syscalls::register_NtSetHighEventPair(proc_t proc, const on_NtSe
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[169]);
@@ -3525,11 +4295,15 @@ opt<bpid_t> nt::syscalls::register_NtSetInformationDebugObject(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto DebugObjectHandle           = arg<nt::HANDLE>(core, 0);
-        const auto DebugObjectInformationClass = arg<nt::DEBUGOBJECTINFOCLASS>(core, 1);
-        const auto DebugInformation            = arg<nt::PVOID>(core, 2);
-        const auto DebugInformationLength      = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength                = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DebugObjectHandle           = arg<nt::HANDLE>(args, 0);
+        const auto DebugObjectInformationClass = arg<nt::DEBUGOBJECTINFOCLASS>(args, 1);
+        const auto DebugInformation            = arg<nt::PVOID>(args, 2);
+        const auto DebugInformationLength      = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength                = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[170]);
@@ -3544,10 +4318,14 @@ opt<bpid_t> nt::syscalls::register_NtSetInformationEnlistment(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle            = arg<nt::HANDLE>(core, 0);
-        const auto EnlistmentInformationClass  = arg<nt::ENLISTMENT_INFORMATION_CLASS>(core, 1);
-        const auto EnlistmentInformation       = arg<nt::PVOID>(core, 2);
-        const auto EnlistmentInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle            = arg<nt::HANDLE>(args, 0);
+        const auto EnlistmentInformationClass  = arg<nt::ENLISTMENT_INFORMATION_CLASS>(args, 1);
+        const auto EnlistmentInformation       = arg<nt::PVOID>(args, 2);
+        const auto EnlistmentInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[171]);
@@ -3562,10 +4340,14 @@ opt<bpid_t> nt::syscalls::register_NtSetInformationObject(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto Handle                  = arg<nt::HANDLE>(core, 0);
-        const auto ObjectInformationClass  = arg<nt::OBJECT_INFORMATION_CLASS>(core, 1);
-        const auto ObjectInformation       = arg<nt::PVOID>(core, 2);
-        const auto ObjectInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle                  = arg<nt::HANDLE>(args, 0);
+        const auto ObjectInformationClass  = arg<nt::OBJECT_INFORMATION_CLASS>(args, 1);
+        const auto ObjectInformation       = arg<nt::PVOID>(args, 2);
+        const auto ObjectInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[172]);
@@ -3580,10 +4362,14 @@ opt<bpid_t> nt::syscalls::register_NtSetInformationProcess(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle            = arg<nt::HANDLE>(core, 0);
-        const auto ProcessInformationClass  = arg<nt::PROCESSINFOCLASS>(core, 1);
-        const auto ProcessInformation       = arg<nt::PVOID>(core, 2);
-        const auto ProcessInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle            = arg<nt::HANDLE>(args, 0);
+        const auto ProcessInformationClass  = arg<nt::PROCESSINFOCLASS>(args, 1);
+        const auto ProcessInformation       = arg<nt::PVOID>(args, 2);
+        const auto ProcessInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[173]);
@@ -3598,10 +4384,14 @@ opt<bpid_t> nt::syscalls::register_NtSetInformationResourceManager(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle            = arg<nt::HANDLE>(core, 0);
-        const auto ResourceManagerInformationClass  = arg<nt::RESOURCEMANAGER_INFORMATION_CLASS>(core, 1);
-        const auto ResourceManagerInformation       = arg<nt::PVOID>(core, 2);
-        const auto ResourceManagerInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle            = arg<nt::HANDLE>(args, 0);
+        const auto ResourceManagerInformationClass  = arg<nt::RESOURCEMANAGER_INFORMATION_CLASS>(args, 1);
+        const auto ResourceManagerInformation       = arg<nt::PVOID>(args, 2);
+        const auto ResourceManagerInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[174]);
@@ -3616,10 +4406,14 @@ opt<bpid_t> nt::syscalls::register_NtSetInformationThread(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle            = arg<nt::HANDLE>(core, 0);
-        const auto ThreadInformationClass  = arg<nt::THREADINFOCLASS>(core, 1);
-        const auto ThreadInformation       = arg<nt::PVOID>(core, 2);
-        const auto ThreadInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle            = arg<nt::HANDLE>(args, 0);
+        const auto ThreadInformationClass  = arg<nt::THREADINFOCLASS>(args, 1);
+        const auto ThreadInformation       = arg<nt::PVOID>(args, 2);
+        const auto ThreadInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[175]);
@@ -3634,10 +4428,14 @@ opt<bpid_t> nt::syscalls::register_NtSetInformationToken(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto TokenHandle            = arg<nt::HANDLE>(core, 0);
-        const auto TokenInformationClass  = arg<nt::TOKEN_INFORMATION_CLASS>(core, 1);
-        const auto TokenInformation       = arg<nt::PVOID>(core, 2);
-        const auto TokenInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle            = arg<nt::HANDLE>(args, 0);
+        const auto TokenInformationClass  = arg<nt::TOKEN_INFORMATION_CLASS>(args, 1);
+        const auto TokenInformation       = arg<nt::PVOID>(args, 2);
+        const auto TokenInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[176]);
@@ -3652,10 +4450,14 @@ opt<bpid_t> nt::syscalls::register_NtSetInformationTransaction(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle            = arg<nt::HANDLE>(core, 0);
-        const auto TransactionInformationClass  = arg<nt::TRANSACTION_INFORMATION_CLASS>(core, 1);
-        const auto TransactionInformation       = arg<nt::PVOID>(core, 2);
-        const auto TransactionInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle            = arg<nt::HANDLE>(args, 0);
+        const auto TransactionInformationClass  = arg<nt::TRANSACTION_INFORMATION_CLASS>(args, 1);
+        const auto TransactionInformation       = arg<nt::PVOID>(args, 2);
+        const auto TransactionInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[177]);
@@ -3670,10 +4472,14 @@ opt<bpid_t> nt::syscalls::register_NtSetInformationWorkerFactory(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle            = arg<nt::HANDLE>(core, 0);
-        const auto WorkerFactoryInformationClass  = arg<nt::WORKERFACTORYINFOCLASS>(core, 1);
-        const auto WorkerFactoryInformation       = arg<nt::PVOID>(core, 2);
-        const auto WorkerFactoryInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle            = arg<nt::HANDLE>(args, 0);
+        const auto WorkerFactoryInformationClass  = arg<nt::WORKERFACTORYINFOCLASS>(args, 1);
+        const auto WorkerFactoryInformation       = arg<nt::PVOID>(args, 2);
+        const auto WorkerFactoryInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[178]);
@@ -3688,8 +4494,12 @@ opt<bpid_t> nt::syscalls::register_NtSetIntervalProfile(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto Interval = arg<nt::ULONG>(core, 0);
-        const auto Source   = arg<nt::KPROFILE_SOURCE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Interval = arg<nt::ULONG>(args, 0);
+        const auto Source   = arg<nt::KPROFILE_SOURCE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[179]);
@@ -3704,9 +4514,13 @@ opt<bpid_t> nt::syscalls::register_NtSetSecurityObject(proc_t proc, const on_NtS
     {
         auto& core = d_->core;
 
-        const auto Handle              = arg<nt::HANDLE>(core, 0);
-        const auto SecurityInformation = arg<nt::SECURITY_INFORMATION>(core, 1);
-        const auto SecurityDescriptor  = arg<nt::PSECURITY_DESCRIPTOR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle              = arg<nt::HANDLE>(args, 0);
+        const auto SecurityInformation = arg<nt::SECURITY_INFORMATION>(args, 1);
+        const auto SecurityDescriptor  = arg<nt::PSECURITY_DESCRIPTOR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[180]);
@@ -3721,8 +4535,12 @@ opt<bpid_t> nt::syscalls::register_NtSetThreadExecutionState(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto esFlags           = arg<nt::EXECUTION_STATE>(core, 0);
-        const auto STARPreviousFlags = arg<nt::EXECUTION_STATE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto esFlags           = arg<nt::EXECUTION_STATE>(args, 0);
+        const auto STARPreviousFlags = arg<nt::EXECUTION_STATE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[181]);
@@ -3737,9 +4555,13 @@ opt<bpid_t> nt::syscalls::register_NtSetTimerResolution(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto DesiredTime   = arg<nt::ULONG>(core, 0);
-        const auto SetResolution = arg<nt::BOOLEAN>(core, 1);
-        const auto ActualTime    = arg<nt::PULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DesiredTime   = arg<nt::ULONG>(args, 0);
+        const auto SetResolution = arg<nt::BOOLEAN>(args, 1);
+        const auto ActualTime    = arg<nt::PULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[182]);
@@ -3754,7 +4576,11 @@ opt<bpid_t> nt::syscalls::register_NtSetUuidSeed(proc_t proc, const on_NtSetUuid
     {
         auto& core = d_->core;
 
-        const auto Seed = arg<nt::PCHAR>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Seed = arg<nt::PCHAR>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[183]);
@@ -3769,8 +4595,12 @@ opt<bpid_t> nt::syscalls::register_NtSuspendThread(proc_t proc, const on_NtSuspe
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle         = arg<nt::HANDLE>(core, 0);
-        const auto PreviousSuspendCount = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle         = arg<nt::HANDLE>(args, 0);
+        const auto PreviousSuspendCount = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[184]);
@@ -3785,8 +4615,12 @@ opt<bpid_t> nt::syscalls::register_NtTerminateJobObject(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto JobHandle  = arg<nt::HANDLE>(core, 0);
-        const auto ExitStatus = arg<nt::NTSTATUS>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle  = arg<nt::HANDLE>(args, 0);
+        const auto ExitStatus = arg<nt::NTSTATUS>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[185]);
@@ -3801,8 +4635,12 @@ opt<bpid_t> nt::syscalls::register_NtTerminateThread(proc_t proc, const on_NtTer
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle = arg<nt::HANDLE>(core, 0);
-        const auto ExitStatus   = arg<nt::NTSTATUS>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle = arg<nt::HANDLE>(args, 0);
+        const auto ExitStatus   = arg<nt::NTSTATUS>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[186]);
@@ -3817,12 +4655,16 @@ opt<bpid_t> nt::syscalls::register_NtTraceControl(proc_t proc, const on_NtTraceC
     {
         auto& core = d_->core;
 
-        const auto FunctionCode = arg<nt::ULONG>(core, 0);
-        const auto InBuffer     = arg<nt::PVOID>(core, 1);
-        const auto InBufferLen  = arg<nt::ULONG>(core, 2);
-        const auto OutBuffer    = arg<nt::PVOID>(core, 3);
-        const auto OutBufferLen = arg<nt::ULONG>(core, 4);
-        const auto ReturnLength = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FunctionCode = arg<nt::ULONG>(args, 0);
+        const auto InBuffer     = arg<nt::PVOID>(args, 1);
+        const auto InBufferLen  = arg<nt::ULONG>(args, 2);
+        const auto OutBuffer    = arg<nt::PVOID>(args, 3);
+        const auto OutBufferLen = arg<nt::ULONG>(args, 4);
+        const auto ReturnLength = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[187]);
@@ -3837,10 +4679,14 @@ opt<bpid_t> nt::syscalls::register_NtTraceEvent(proc_t proc, const on_NtTraceEve
     {
         auto& core = d_->core;
 
-        const auto TraceHandle = arg<nt::HANDLE>(core, 0);
-        const auto Flags       = arg<nt::ULONG>(core, 1);
-        const auto FieldSize   = arg<nt::ULONG>(core, 2);
-        const auto Fields      = arg<nt::PVOID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TraceHandle = arg<nt::HANDLE>(args, 0);
+        const auto Flags       = arg<nt::ULONG>(args, 1);
+        const auto FieldSize   = arg<nt::ULONG>(args, 2);
+        const auto Fields      = arg<nt::PVOID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[188]);
@@ -3855,10 +4701,14 @@ opt<bpid_t> nt::syscalls::register_NtTranslateFilePath(proc_t proc, const on_NtT
     {
         auto& core = d_->core;
 
-        const auto InputFilePath        = arg<nt::PFILE_PATH>(core, 0);
-        const auto OutputType           = arg<nt::ULONG>(core, 1);
-        const auto OutputFilePath       = arg<nt::PFILE_PATH>(core, 2);
-        const auto OutputFilePathLength = arg<nt::PULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto InputFilePath        = arg<nt::PFILE_PATH>(args, 0);
+        const auto OutputType           = arg<nt::ULONG>(args, 1);
+        const auto OutputFilePath       = arg<nt::PFILE_PATH>(args, 2);
+        const auto OutputFilePathLength = arg<nt::PULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[189]);
@@ -3873,7 +4723,11 @@ opt<bpid_t> nt::syscalls::register_NtUnloadKey(proc_t proc, const on_NtUnloadKey
     {
         auto& core = d_->core;
 
-        const auto TargetKey = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[190]);
@@ -3888,8 +4742,12 @@ opt<bpid_t> nt::syscalls::register_NtUnloadKey2(proc_t proc, const on_NtUnloadKe
     {
         auto& core = d_->core;
 
-        const auto TargetKey = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
-        const auto Flags     = arg<nt::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
+        const auto Flags     = arg<nt::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[191]);
@@ -3904,8 +4762,12 @@ opt<bpid_t> nt::syscalls::register_NtUnmapViewOfSection(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<nt::HANDLE>(core, 0);
-        const auto BaseAddress   = arg<nt::PVOID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<nt::HANDLE>(args, 0);
+        const auto BaseAddress   = arg<nt::PVOID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[192]);
@@ -3920,10 +4782,14 @@ opt<bpid_t> nt::syscalls::register_NtWaitForKeyedEvent(proc_t proc, const on_NtW
     {
         auto& core = d_->core;
 
-        const auto KeyedEventHandle = arg<nt::HANDLE>(core, 0);
-        const auto KeyValue         = arg<nt::PVOID>(core, 1);
-        const auto Alertable        = arg<nt::BOOLEAN>(core, 2);
-        const auto Timeout          = arg<nt::PLARGE_INTEGER>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyedEventHandle = arg<nt::HANDLE>(args, 0);
+        const auto KeyValue         = arg<nt::PVOID>(args, 1);
+        const auto Alertable        = arg<nt::BOOLEAN>(args, 2);
+        const auto Timeout          = arg<nt::PLARGE_INTEGER>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[193]);
@@ -3938,11 +4804,15 @@ opt<bpid_t> nt::syscalls::register_NtWaitForMultipleObjects(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto Count     = arg<nt::ULONG>(core, 0);
-        const auto Handles   = arg<nt::HANDLE>(core, 1);
-        const auto WaitType  = arg<nt::WAIT_TYPE>(core, 2);
-        const auto Alertable = arg<nt::BOOLEAN>(core, 3);
-        const auto Timeout   = arg<nt::PLARGE_INTEGER>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Count     = arg<nt::ULONG>(args, 0);
+        const auto Handles   = arg<nt::HANDLE>(args, 1);
+        const auto WaitType  = arg<nt::WAIT_TYPE>(args, 2);
+        const auto Alertable = arg<nt::BOOLEAN>(args, 3);
+        const auto Timeout   = arg<nt::PLARGE_INTEGER>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[194]);
@@ -3957,9 +4827,13 @@ opt<bpid_t> nt::syscalls::register_NtWaitForSingleObject(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto Handle    = arg<nt::HANDLE>(core, 0);
-        const auto Alertable = arg<nt::BOOLEAN>(core, 1);
-        const auto Timeout   = arg<nt::PLARGE_INTEGER>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle    = arg<nt::HANDLE>(args, 0);
+        const auto Alertable = arg<nt::BOOLEAN>(args, 1);
+        const auto Timeout   = arg<nt::PLARGE_INTEGER>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[195]);
@@ -3974,7 +4848,11 @@ opt<bpid_t> nt::syscalls::register_NtWaitLowEventPair(proc_t proc, const on_NtWa
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[196]);
@@ -3989,7 +4867,11 @@ opt<bpid_t> nt::syscalls::register_NtWorkerFactoryWorkerReady(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[197]);
@@ -4004,15 +4886,19 @@ opt<bpid_t> nt::syscalls::register_NtWriteFile(proc_t proc, const on_NtWriteFile
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<nt::HANDLE>(core, 0);
-        const auto Event         = arg<nt::HANDLE>(core, 1);
-        const auto ApcRoutine    = arg<nt::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext    = arg<nt::PVOID>(core, 3);
-        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(core, 4);
-        const auto Buffer        = arg<nt::PVOID>(core, 5);
-        const auto Length        = arg<nt::ULONG>(core, 6);
-        const auto ByteOffset    = arg<nt::PLARGE_INTEGER>(core, 7);
-        const auto Key           = arg<nt::PULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<nt::HANDLE>(args, 0);
+        const auto Event         = arg<nt::HANDLE>(args, 1);
+        const auto ApcRoutine    = arg<nt::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext    = arg<nt::PVOID>(args, 3);
+        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(args, 4);
+        const auto Buffer        = arg<nt::PVOID>(args, 5);
+        const auto Length        = arg<nt::ULONG>(args, 6);
+        const auto ByteOffset    = arg<nt::PLARGE_INTEGER>(args, 7);
+        const auto Key           = arg<nt::PULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[198]);
@@ -4027,11 +4913,15 @@ opt<bpid_t> nt::syscalls::register_NtWriteVirtualMemory(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle        = arg<nt::HANDLE>(core, 0);
-        const auto BaseAddress          = arg<nt::PVOID>(core, 1);
-        const auto Buffer               = arg<nt::PVOID>(core, 2);
-        const auto BufferSize           = arg<nt::SIZE_T>(core, 3);
-        const auto NumberOfBytesWritten = arg<nt::PSIZE_T>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle        = arg<nt::HANDLE>(args, 0);
+        const auto BaseAddress          = arg<nt::PVOID>(args, 1);
+        const auto Buffer               = arg<nt::PVOID>(args, 2);
+        const auto BufferSize           = arg<nt::SIZE_T>(args, 3);
+        const auto NumberOfBytesWritten = arg<nt::PSIZE_T>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[199]);
@@ -4046,14 +4936,18 @@ opt<bpid_t> nt::syscalls::register_ZwAccessCheck(proc_t proc, const on_ZwAccessC
     {
         auto& core = d_->core;
 
-        const auto SecurityDescriptor = arg<nt::PSECURITY_DESCRIPTOR>(core, 0);
-        const auto ClientToken        = arg<nt::HANDLE>(core, 1);
-        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(core, 2);
-        const auto GenericMapping     = arg<nt::PGENERIC_MAPPING>(core, 3);
-        const auto PrivilegeSet       = arg<nt::PPRIVILEGE_SET>(core, 4);
-        const auto PrivilegeSetLength = arg<nt::PULONG>(core, 5);
-        const auto GrantedAccess      = arg<nt::PACCESS_MASK>(core, 6);
-        const auto AccessStatus       = arg<nt::PNTSTATUS>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SecurityDescriptor = arg<nt::PSECURITY_DESCRIPTOR>(args, 0);
+        const auto ClientToken        = arg<nt::HANDLE>(args, 1);
+        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(args, 2);
+        const auto GenericMapping     = arg<nt::PGENERIC_MAPPING>(args, 3);
+        const auto PrivilegeSet       = arg<nt::PPRIVILEGE_SET>(args, 4);
+        const auto PrivilegeSetLength = arg<nt::PULONG>(args, 5);
+        const auto GrantedAccess      = arg<nt::PACCESS_MASK>(args, 6);
+        const auto AccessStatus       = arg<nt::PNTSTATUS>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[200]);
@@ -4068,17 +4962,21 @@ opt<bpid_t> nt::syscalls::register_ZwAccessCheckAndAuditAlarm(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto SubsystemName      = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto HandleId           = arg<nt::PVOID>(core, 1);
-        const auto ObjectTypeName     = arg<nt::PUNICODE_STRING>(core, 2);
-        const auto ObjectName         = arg<nt::PUNICODE_STRING>(core, 3);
-        const auto SecurityDescriptor = arg<nt::PSECURITY_DESCRIPTOR>(core, 4);
-        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(core, 5);
-        const auto GenericMapping     = arg<nt::PGENERIC_MAPPING>(core, 6);
-        const auto ObjectCreation     = arg<nt::BOOLEAN>(core, 7);
-        const auto GrantedAccess      = arg<nt::PACCESS_MASK>(core, 8);
-        const auto AccessStatus       = arg<nt::PNTSTATUS>(core, 9);
-        const auto GenerateOnClose    = arg<nt::PBOOLEAN>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName      = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto HandleId           = arg<nt::PVOID>(args, 1);
+        const auto ObjectTypeName     = arg<nt::PUNICODE_STRING>(args, 2);
+        const auto ObjectName         = arg<nt::PUNICODE_STRING>(args, 3);
+        const auto SecurityDescriptor = arg<nt::PSECURITY_DESCRIPTOR>(args, 4);
+        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(args, 5);
+        const auto GenericMapping     = arg<nt::PGENERIC_MAPPING>(args, 6);
+        const auto ObjectCreation     = arg<nt::BOOLEAN>(args, 7);
+        const auto GrantedAccess      = arg<nt::PACCESS_MASK>(args, 8);
+        const auto AccessStatus       = arg<nt::PNTSTATUS>(args, 9);
+        const auto GenerateOnClose    = arg<nt::PBOOLEAN>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[201]);
@@ -4093,17 +4991,21 @@ opt<bpid_t> nt::syscalls::register_ZwAccessCheckByType(proc_t proc, const on_ZwA
     {
         auto& core = d_->core;
 
-        const auto SecurityDescriptor   = arg<nt::PSECURITY_DESCRIPTOR>(core, 0);
-        const auto PrincipalSelfSid     = arg<nt::PSID>(core, 1);
-        const auto ClientToken          = arg<nt::HANDLE>(core, 2);
-        const auto DesiredAccess        = arg<nt::ACCESS_MASK>(core, 3);
-        const auto ObjectTypeList       = arg<nt::POBJECT_TYPE_LIST>(core, 4);
-        const auto ObjectTypeListLength = arg<nt::ULONG>(core, 5);
-        const auto GenericMapping       = arg<nt::PGENERIC_MAPPING>(core, 6);
-        const auto PrivilegeSet         = arg<nt::PPRIVILEGE_SET>(core, 7);
-        const auto PrivilegeSetLength   = arg<nt::PULONG>(core, 8);
-        const auto GrantedAccess        = arg<nt::PACCESS_MASK>(core, 9);
-        const auto AccessStatus         = arg<nt::PNTSTATUS>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SecurityDescriptor   = arg<nt::PSECURITY_DESCRIPTOR>(args, 0);
+        const auto PrincipalSelfSid     = arg<nt::PSID>(args, 1);
+        const auto ClientToken          = arg<nt::HANDLE>(args, 2);
+        const auto DesiredAccess        = arg<nt::ACCESS_MASK>(args, 3);
+        const auto ObjectTypeList       = arg<nt::POBJECT_TYPE_LIST>(args, 4);
+        const auto ObjectTypeListLength = arg<nt::ULONG>(args, 5);
+        const auto GenericMapping       = arg<nt::PGENERIC_MAPPING>(args, 6);
+        const auto PrivilegeSet         = arg<nt::PPRIVILEGE_SET>(args, 7);
+        const auto PrivilegeSetLength   = arg<nt::PULONG>(args, 8);
+        const auto GrantedAccess        = arg<nt::PACCESS_MASK>(args, 9);
+        const auto AccessStatus         = arg<nt::PNTSTATUS>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[202]);
@@ -4118,22 +5020,26 @@ opt<bpid_t> nt::syscalls::register_ZwAccessCheckByTypeAndAuditAlarm(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto SubsystemName        = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto HandleId             = arg<nt::PVOID>(core, 1);
-        const auto ObjectTypeName       = arg<nt::PUNICODE_STRING>(core, 2);
-        const auto ObjectName           = arg<nt::PUNICODE_STRING>(core, 3);
-        const auto SecurityDescriptor   = arg<nt::PSECURITY_DESCRIPTOR>(core, 4);
-        const auto PrincipalSelfSid     = arg<nt::PSID>(core, 5);
-        const auto DesiredAccess        = arg<nt::ACCESS_MASK>(core, 6);
-        const auto AuditType            = arg<nt::AUDIT_EVENT_TYPE>(core, 7);
-        const auto Flags                = arg<nt::ULONG>(core, 8);
-        const auto ObjectTypeList       = arg<nt::POBJECT_TYPE_LIST>(core, 9);
-        const auto ObjectTypeListLength = arg<nt::ULONG>(core, 10);
-        const auto GenericMapping       = arg<nt::PGENERIC_MAPPING>(core, 11);
-        const auto ObjectCreation       = arg<nt::BOOLEAN>(core, 12);
-        const auto GrantedAccess        = arg<nt::PACCESS_MASK>(core, 13);
-        const auto AccessStatus         = arg<nt::PNTSTATUS>(core, 14);
-        const auto GenerateOnClose      = arg<nt::PBOOLEAN>(core, 15);
+        auto args = std::array<arg_t, 16>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName        = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto HandleId             = arg<nt::PVOID>(args, 1);
+        const auto ObjectTypeName       = arg<nt::PUNICODE_STRING>(args, 2);
+        const auto ObjectName           = arg<nt::PUNICODE_STRING>(args, 3);
+        const auto SecurityDescriptor   = arg<nt::PSECURITY_DESCRIPTOR>(args, 4);
+        const auto PrincipalSelfSid     = arg<nt::PSID>(args, 5);
+        const auto DesiredAccess        = arg<nt::ACCESS_MASK>(args, 6);
+        const auto AuditType            = arg<nt::AUDIT_EVENT_TYPE>(args, 7);
+        const auto Flags                = arg<nt::ULONG>(args, 8);
+        const auto ObjectTypeList       = arg<nt::POBJECT_TYPE_LIST>(args, 9);
+        const auto ObjectTypeListLength = arg<nt::ULONG>(args, 10);
+        const auto GenericMapping       = arg<nt::PGENERIC_MAPPING>(args, 11);
+        const auto ObjectCreation       = arg<nt::BOOLEAN>(args, 12);
+        const auto GrantedAccess        = arg<nt::PACCESS_MASK>(args, 13);
+        const auto AccessStatus         = arg<nt::PNTSTATUS>(args, 14);
+        const auto GenerateOnClose      = arg<nt::PBOOLEAN>(args, 15);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[203]);
@@ -4148,17 +5054,21 @@ opt<bpid_t> nt::syscalls::register_ZwAccessCheckByTypeResultList(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto SecurityDescriptor   = arg<nt::PSECURITY_DESCRIPTOR>(core, 0);
-        const auto PrincipalSelfSid     = arg<nt::PSID>(core, 1);
-        const auto ClientToken          = arg<nt::HANDLE>(core, 2);
-        const auto DesiredAccess        = arg<nt::ACCESS_MASK>(core, 3);
-        const auto ObjectTypeList       = arg<nt::POBJECT_TYPE_LIST>(core, 4);
-        const auto ObjectTypeListLength = arg<nt::ULONG>(core, 5);
-        const auto GenericMapping       = arg<nt::PGENERIC_MAPPING>(core, 6);
-        const auto PrivilegeSet         = arg<nt::PPRIVILEGE_SET>(core, 7);
-        const auto PrivilegeSetLength   = arg<nt::PULONG>(core, 8);
-        const auto GrantedAccess        = arg<nt::PACCESS_MASK>(core, 9);
-        const auto AccessStatus         = arg<nt::PNTSTATUS>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SecurityDescriptor   = arg<nt::PSECURITY_DESCRIPTOR>(args, 0);
+        const auto PrincipalSelfSid     = arg<nt::PSID>(args, 1);
+        const auto ClientToken          = arg<nt::HANDLE>(args, 2);
+        const auto DesiredAccess        = arg<nt::ACCESS_MASK>(args, 3);
+        const auto ObjectTypeList       = arg<nt::POBJECT_TYPE_LIST>(args, 4);
+        const auto ObjectTypeListLength = arg<nt::ULONG>(args, 5);
+        const auto GenericMapping       = arg<nt::PGENERIC_MAPPING>(args, 6);
+        const auto PrivilegeSet         = arg<nt::PPRIVILEGE_SET>(args, 7);
+        const auto PrivilegeSetLength   = arg<nt::PULONG>(args, 8);
+        const auto GrantedAccess        = arg<nt::PACCESS_MASK>(args, 9);
+        const auto AccessStatus         = arg<nt::PNTSTATUS>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[204]);
@@ -4173,22 +5083,26 @@ opt<bpid_t> nt::syscalls::register_ZwAccessCheckByTypeResultListAndAuditAlarm(pr
     {
         auto& core = d_->core;
 
-        const auto SubsystemName        = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto HandleId             = arg<nt::PVOID>(core, 1);
-        const auto ObjectTypeName       = arg<nt::PUNICODE_STRING>(core, 2);
-        const auto ObjectName           = arg<nt::PUNICODE_STRING>(core, 3);
-        const auto SecurityDescriptor   = arg<nt::PSECURITY_DESCRIPTOR>(core, 4);
-        const auto PrincipalSelfSid     = arg<nt::PSID>(core, 5);
-        const auto DesiredAccess        = arg<nt::ACCESS_MASK>(core, 6);
-        const auto AuditType            = arg<nt::AUDIT_EVENT_TYPE>(core, 7);
-        const auto Flags                = arg<nt::ULONG>(core, 8);
-        const auto ObjectTypeList       = arg<nt::POBJECT_TYPE_LIST>(core, 9);
-        const auto ObjectTypeListLength = arg<nt::ULONG>(core, 10);
-        const auto GenericMapping       = arg<nt::PGENERIC_MAPPING>(core, 11);
-        const auto ObjectCreation       = arg<nt::BOOLEAN>(core, 12);
-        const auto GrantedAccess        = arg<nt::PACCESS_MASK>(core, 13);
-        const auto AccessStatus         = arg<nt::PNTSTATUS>(core, 14);
-        const auto GenerateOnClose      = arg<nt::PBOOLEAN>(core, 15);
+        auto args = std::array<arg_t, 16>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName        = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto HandleId             = arg<nt::PVOID>(args, 1);
+        const auto ObjectTypeName       = arg<nt::PUNICODE_STRING>(args, 2);
+        const auto ObjectName           = arg<nt::PUNICODE_STRING>(args, 3);
+        const auto SecurityDescriptor   = arg<nt::PSECURITY_DESCRIPTOR>(args, 4);
+        const auto PrincipalSelfSid     = arg<nt::PSID>(args, 5);
+        const auto DesiredAccess        = arg<nt::ACCESS_MASK>(args, 6);
+        const auto AuditType            = arg<nt::AUDIT_EVENT_TYPE>(args, 7);
+        const auto Flags                = arg<nt::ULONG>(args, 8);
+        const auto ObjectTypeList       = arg<nt::POBJECT_TYPE_LIST>(args, 9);
+        const auto ObjectTypeListLength = arg<nt::ULONG>(args, 10);
+        const auto GenericMapping       = arg<nt::PGENERIC_MAPPING>(args, 11);
+        const auto ObjectCreation       = arg<nt::BOOLEAN>(args, 12);
+        const auto GrantedAccess        = arg<nt::PACCESS_MASK>(args, 13);
+        const auto AccessStatus         = arg<nt::PNTSTATUS>(args, 14);
+        const auto GenerateOnClose      = arg<nt::PBOOLEAN>(args, 15);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[205]);
@@ -4203,23 +5117,27 @@ opt<bpid_t> nt::syscalls::register_ZwAccessCheckByTypeResultListAndAuditAlarmByH
     {
         auto& core = d_->core;
 
-        const auto SubsystemName        = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto HandleId             = arg<nt::PVOID>(core, 1);
-        const auto ClientToken          = arg<nt::HANDLE>(core, 2);
-        const auto ObjectTypeName       = arg<nt::PUNICODE_STRING>(core, 3);
-        const auto ObjectName           = arg<nt::PUNICODE_STRING>(core, 4);
-        const auto SecurityDescriptor   = arg<nt::PSECURITY_DESCRIPTOR>(core, 5);
-        const auto PrincipalSelfSid     = arg<nt::PSID>(core, 6);
-        const auto DesiredAccess        = arg<nt::ACCESS_MASK>(core, 7);
-        const auto AuditType            = arg<nt::AUDIT_EVENT_TYPE>(core, 8);
-        const auto Flags                = arg<nt::ULONG>(core, 9);
-        const auto ObjectTypeList       = arg<nt::POBJECT_TYPE_LIST>(core, 10);
-        const auto ObjectTypeListLength = arg<nt::ULONG>(core, 11);
-        const auto GenericMapping       = arg<nt::PGENERIC_MAPPING>(core, 12);
-        const auto ObjectCreation       = arg<nt::BOOLEAN>(core, 13);
-        const auto GrantedAccess        = arg<nt::PACCESS_MASK>(core, 14);
-        const auto AccessStatus         = arg<nt::PNTSTATUS>(core, 15);
-        const auto GenerateOnClose      = arg<nt::PBOOLEAN>(core, 16);
+        auto args = std::array<arg_t, 17>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName        = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto HandleId             = arg<nt::PVOID>(args, 1);
+        const auto ClientToken          = arg<nt::HANDLE>(args, 2);
+        const auto ObjectTypeName       = arg<nt::PUNICODE_STRING>(args, 3);
+        const auto ObjectName           = arg<nt::PUNICODE_STRING>(args, 4);
+        const auto SecurityDescriptor   = arg<nt::PSECURITY_DESCRIPTOR>(args, 5);
+        const auto PrincipalSelfSid     = arg<nt::PSID>(args, 6);
+        const auto DesiredAccess        = arg<nt::ACCESS_MASK>(args, 7);
+        const auto AuditType            = arg<nt::AUDIT_EVENT_TYPE>(args, 8);
+        const auto Flags                = arg<nt::ULONG>(args, 9);
+        const auto ObjectTypeList       = arg<nt::POBJECT_TYPE_LIST>(args, 10);
+        const auto ObjectTypeListLength = arg<nt::ULONG>(args, 11);
+        const auto GenericMapping       = arg<nt::PGENERIC_MAPPING>(args, 12);
+        const auto ObjectCreation       = arg<nt::BOOLEAN>(args, 13);
+        const auto GrantedAccess        = arg<nt::PACCESS_MASK>(args, 14);
+        const auto AccessStatus         = arg<nt::PNTSTATUS>(args, 15);
+        const auto GenerateOnClose      = arg<nt::PBOOLEAN>(args, 16);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[206]);
@@ -4234,9 +5152,13 @@ opt<bpid_t> nt::syscalls::register_ZwAddAtom(proc_t proc, const on_ZwAddAtom_fn&
     {
         auto& core = d_->core;
 
-        const auto AtomName = arg<nt::PWSTR>(core, 0);
-        const auto Length   = arg<nt::ULONG>(core, 1);
-        const auto Atom     = arg<nt::PRTL_ATOM>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto AtomName = arg<nt::PWSTR>(args, 0);
+        const auto Length   = arg<nt::ULONG>(args, 1);
+        const auto Atom     = arg<nt::PRTL_ATOM>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[207]);
@@ -4251,8 +5173,12 @@ opt<bpid_t> nt::syscalls::register_ZwAddBootEntry(proc_t proc, const on_ZwAddBoo
     {
         auto& core = d_->core;
 
-        const auto BootEntry = arg<nt::PBOOT_ENTRY>(core, 0);
-        const auto Id        = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto BootEntry = arg<nt::PBOOT_ENTRY>(args, 0);
+        const auto Id        = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[208]);
@@ -4267,8 +5193,12 @@ opt<bpid_t> nt::syscalls::register_ZwAlertResumeThread(proc_t proc, const on_ZwA
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle         = arg<nt::HANDLE>(core, 0);
-        const auto PreviousSuspendCount = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle         = arg<nt::HANDLE>(args, 0);
+        const auto PreviousSuspendCount = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[209]);
@@ -4283,7 +5213,11 @@ opt<bpid_t> nt::syscalls::register_ZwAllocateLocallyUniqueId(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Luid = arg<nt::PLUID>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Luid = arg<nt::PLUID>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[210]);
@@ -4298,9 +5232,13 @@ opt<bpid_t> nt::syscalls::register_ZwAllocateUserPhysicalPages(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<nt::HANDLE>(core, 0);
-        const auto NumberOfPages = arg<nt::PULONG_PTR>(core, 1);
-        const auto UserPfnArra   = arg<nt::PULONG_PTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<nt::HANDLE>(args, 0);
+        const auto NumberOfPages = arg<nt::PULONG_PTR>(args, 1);
+        const auto UserPfnArra   = arg<nt::PULONG_PTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[211]);
@@ -4315,10 +5253,14 @@ opt<bpid_t> nt::syscalls::register_ZwAllocateUuids(proc_t proc, const on_ZwAlloc
     {
         auto& core = d_->core;
 
-        const auto Time     = arg<nt::PULARGE_INTEGER>(core, 0);
-        const auto Range    = arg<nt::PULONG>(core, 1);
-        const auto Sequence = arg<nt::PULONG>(core, 2);
-        const auto Seed     = arg<nt::PCHAR>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Time     = arg<nt::PULARGE_INTEGER>(args, 0);
+        const auto Range    = arg<nt::PULONG>(args, 1);
+        const auto Sequence = arg<nt::PULONG>(args, 2);
+        const auto Seed     = arg<nt::PCHAR>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[212]);
@@ -4333,12 +5275,16 @@ opt<bpid_t> nt::syscalls::register_ZwAllocateVirtualMemory(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<nt::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<nt::PVOID>(core, 1);
-        const auto ZeroBits        = arg<nt::ULONG_PTR>(core, 2);
-        const auto RegionSize      = arg<nt::PSIZE_T>(core, 3);
-        const auto AllocationType  = arg<nt::ULONG>(core, 4);
-        const auto Protect         = arg<nt::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<nt::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<nt::PVOID>(args, 1);
+        const auto ZeroBits        = arg<nt::ULONG_PTR>(args, 2);
+        const auto RegionSize      = arg<nt::PSIZE_T>(args, 3);
+        const auto AllocationType  = arg<nt::ULONG>(args, 4);
+        const auto Protect         = arg<nt::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[213]);
@@ -4353,15 +5299,19 @@ opt<bpid_t> nt::syscalls::register_ZwAlpcAcceptConnectPort(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto PortHandle                  = arg<nt::PHANDLE>(core, 0);
-        const auto ConnectionPortHandle        = arg<nt::HANDLE>(core, 1);
-        const auto Flags                       = arg<nt::ULONG>(core, 2);
-        const auto ObjectAttributes            = arg<nt::POBJECT_ATTRIBUTES>(core, 3);
-        const auto PortAttributes              = arg<nt::PALPC_PORT_ATTRIBUTES>(core, 4);
-        const auto PortContext                 = arg<nt::PVOID>(core, 5);
-        const auto ConnectionRequest           = arg<nt::PPORT_MESSAGE>(core, 6);
-        const auto ConnectionMessageAttributes = arg<nt::PALPC_MESSAGE_ATTRIBUTES>(core, 7);
-        const auto AcceptConnection            = arg<nt::BOOLEAN>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle                  = arg<nt::PHANDLE>(args, 0);
+        const auto ConnectionPortHandle        = arg<nt::HANDLE>(args, 1);
+        const auto Flags                       = arg<nt::ULONG>(args, 2);
+        const auto ObjectAttributes            = arg<nt::POBJECT_ATTRIBUTES>(args, 3);
+        const auto PortAttributes              = arg<nt::PALPC_PORT_ATTRIBUTES>(args, 4);
+        const auto PortContext                 = arg<nt::PVOID>(args, 5);
+        const auto ConnectionRequest           = arg<nt::PPORT_MESSAGE>(args, 6);
+        const auto ConnectionMessageAttributes = arg<nt::PALPC_MESSAGE_ATTRIBUTES>(args, 7);
+        const auto AcceptConnection            = arg<nt::BOOLEAN>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[214]);
@@ -4376,12 +5326,16 @@ opt<bpid_t> nt::syscalls::register_ZwAlpcCreatePortSection(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto PortHandle        = arg<nt::HANDLE>(core, 0);
-        const auto Flags             = arg<nt::ULONG>(core, 1);
-        const auto SectionHandle     = arg<nt::HANDLE>(core, 2);
-        const auto SectionSize       = arg<nt::SIZE_T>(core, 3);
-        const auto AlpcSectionHandle = arg<nt::PALPC_HANDLE>(core, 4);
-        const auto ActualSectionSize = arg<nt::PSIZE_T>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle        = arg<nt::HANDLE>(args, 0);
+        const auto Flags             = arg<nt::ULONG>(args, 1);
+        const auto SectionHandle     = arg<nt::HANDLE>(args, 2);
+        const auto SectionSize       = arg<nt::SIZE_T>(args, 3);
+        const auto AlpcSectionHandle = arg<nt::PALPC_HANDLE>(args, 4);
+        const auto ActualSectionSize = arg<nt::PSIZE_T>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[215]);
@@ -4396,10 +5350,14 @@ opt<bpid_t> nt::syscalls::register_ZwAlpcCreateResourceReserve(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto PortHandle  = arg<nt::HANDLE>(core, 0);
-        const auto Flags       = arg<nt::ULONG>(core, 1);
-        const auto MessageSize = arg<nt::SIZE_T>(core, 2);
-        const auto ResourceId  = arg<nt::PALPC_HANDLE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle  = arg<nt::HANDLE>(args, 0);
+        const auto Flags       = arg<nt::ULONG>(args, 1);
+        const auto MessageSize = arg<nt::SIZE_T>(args, 2);
+        const auto ResourceId  = arg<nt::PALPC_HANDLE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[216]);
@@ -4414,9 +5372,13 @@ opt<bpid_t> nt::syscalls::register_ZwAlpcDeleteSectionView(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<nt::HANDLE>(core, 0);
-        const auto Flags      = arg<nt::ULONG>(core, 1);
-        const auto ViewBase   = arg<nt::PVOID>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<nt::HANDLE>(args, 0);
+        const auto Flags      = arg<nt::ULONG>(args, 1);
+        const auto ViewBase   = arg<nt::PVOID>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[217]);
@@ -4431,9 +5393,13 @@ opt<bpid_t> nt::syscalls::register_ZwAlpcDeleteSecurityContext(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto PortHandle    = arg<nt::HANDLE>(core, 0);
-        const auto Flags         = arg<nt::ULONG>(core, 1);
-        const auto ContextHandle = arg<nt::ALPC_HANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle    = arg<nt::HANDLE>(args, 0);
+        const auto Flags         = arg<nt::ULONG>(args, 1);
+        const auto ContextHandle = arg<nt::ALPC_HANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[218]);
@@ -4448,11 +5414,15 @@ opt<bpid_t> nt::syscalls::register_ZwAlpcQueryInformation(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto PortHandle           = arg<nt::HANDLE>(core, 0);
-        const auto PortInformationClass = arg<nt::ALPC_PORT_INFORMATION_CLASS>(core, 1);
-        const auto PortInformation      = arg<nt::PVOID>(core, 2);
-        const auto Length               = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength         = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle           = arg<nt::HANDLE>(args, 0);
+        const auto PortInformationClass = arg<nt::ALPC_PORT_INFORMATION_CLASS>(args, 1);
+        const auto PortInformation      = arg<nt::PVOID>(args, 2);
+        const auto Length               = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength         = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[219]);
@@ -4467,12 +5437,16 @@ opt<bpid_t> nt::syscalls::register_ZwAlpcQueryInformationMessage(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto PortHandle              = arg<nt::HANDLE>(core, 0);
-        const auto PortMessage             = arg<nt::PPORT_MESSAGE>(core, 1);
-        const auto MessageInformationClass = arg<nt::ALPC_MESSAGE_INFORMATION_CLASS>(core, 2);
-        const auto MessageInformation      = arg<nt::PVOID>(core, 3);
-        const auto Length                  = arg<nt::ULONG>(core, 4);
-        const auto ReturnLength            = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle              = arg<nt::HANDLE>(args, 0);
+        const auto PortMessage             = arg<nt::PPORT_MESSAGE>(args, 1);
+        const auto MessageInformationClass = arg<nt::ALPC_MESSAGE_INFORMATION_CLASS>(args, 2);
+        const auto MessageInformation      = arg<nt::PVOID>(args, 3);
+        const auto Length                  = arg<nt::ULONG>(args, 4);
+        const auto ReturnLength            = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[220]);
@@ -4487,14 +5461,18 @@ opt<bpid_t> nt::syscalls::register_ZwAlpcSendWaitReceivePort(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto PortHandle               = arg<nt::HANDLE>(core, 0);
-        const auto Flags                    = arg<nt::ULONG>(core, 1);
-        const auto SendMessage              = arg<nt::PPORT_MESSAGE>(core, 2);
-        const auto SendMessageAttributes    = arg<nt::PALPC_MESSAGE_ATTRIBUTES>(core, 3);
-        const auto ReceiveMessage           = arg<nt::PPORT_MESSAGE>(core, 4);
-        const auto BufferLength             = arg<nt::PULONG>(core, 5);
-        const auto ReceiveMessageAttributes = arg<nt::PALPC_MESSAGE_ATTRIBUTES>(core, 6);
-        const auto Timeout                  = arg<nt::PLARGE_INTEGER>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle               = arg<nt::HANDLE>(args, 0);
+        const auto Flags                    = arg<nt::ULONG>(args, 1);
+        const auto SendMessage              = arg<nt::PPORT_MESSAGE>(args, 2);
+        const auto SendMessageAttributes    = arg<nt::PALPC_MESSAGE_ATTRIBUTES>(args, 3);
+        const auto ReceiveMessage           = arg<nt::PPORT_MESSAGE>(args, 4);
+        const auto BufferLength             = arg<nt::PULONG>(args, 5);
+        const auto ReceiveMessageAttributes = arg<nt::PALPC_MESSAGE_ATTRIBUTES>(args, 6);
+        const auto Timeout                  = arg<nt::PLARGE_INTEGER>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[221]);
@@ -4509,8 +5487,12 @@ opt<bpid_t> nt::syscalls::register_ZwAreMappedFilesTheSame(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto File1MappedAsAnImage = arg<nt::PVOID>(core, 0);
-        const auto File2MappedAsFile    = arg<nt::PVOID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto File1MappedAsAnImage = arg<nt::PVOID>(args, 0);
+        const auto File2MappedAsFile    = arg<nt::PVOID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[222]);
@@ -4525,8 +5507,12 @@ opt<bpid_t> nt::syscalls::register_ZwCancelIoFile(proc_t proc, const on_ZwCancel
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<nt::HANDLE>(core, 0);
-        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<nt::HANDLE>(args, 0);
+        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[223]);
@@ -4541,9 +5527,13 @@ opt<bpid_t> nt::syscalls::register_ZwCancelIoFileEx(proc_t proc, const on_ZwCanc
     {
         auto& core = d_->core;
 
-        const auto FileHandle        = arg<nt::HANDLE>(core, 0);
-        const auto IoRequestToCancel = arg<nt::PIO_STATUS_BLOCK>(core, 1);
-        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle        = arg<nt::HANDLE>(args, 0);
+        const auto IoRequestToCancel = arg<nt::PIO_STATUS_BLOCK>(args, 1);
+        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[224]);
@@ -4558,9 +5548,13 @@ opt<bpid_t> nt::syscalls::register_ZwCancelSynchronousIoFile(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle      = arg<nt::HANDLE>(core, 0);
-        const auto IoRequestToCancel = arg<nt::PIO_STATUS_BLOCK>(core, 1);
-        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle      = arg<nt::HANDLE>(args, 0);
+        const auto IoRequestToCancel = arg<nt::PIO_STATUS_BLOCK>(args, 1);
+        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[225]);
@@ -4575,9 +5569,13 @@ opt<bpid_t> nt::syscalls::register_ZwCloseObjectAuditAlarm(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto SubsystemName   = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto HandleId        = arg<nt::PVOID>(core, 1);
-        const auto GenerateOnClose = arg<nt::BOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName   = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto HandleId        = arg<nt::PVOID>(args, 1);
+        const auto GenerateOnClose = arg<nt::BOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[226]);
@@ -4592,8 +5590,12 @@ opt<bpid_t> nt::syscalls::register_ZwCommitEnlistment(proc_t proc, const on_ZwCo
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<nt::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<nt::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[227]);
@@ -4608,8 +5610,12 @@ opt<bpid_t> nt::syscalls::register_ZwCommitTransaction(proc_t proc, const on_ZwC
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle = arg<nt::HANDLE>(core, 0);
-        const auto Wait              = arg<nt::BOOLEAN>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle = arg<nt::HANDLE>(args, 0);
+        const auto Wait              = arg<nt::BOOLEAN>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[228]);
@@ -4624,9 +5630,13 @@ opt<bpid_t> nt::syscalls::register_ZwCompareTokens(proc_t proc, const on_ZwCompa
     {
         auto& core = d_->core;
 
-        const auto FirstTokenHandle  = arg<nt::HANDLE>(core, 0);
-        const auto SecondTokenHandle = arg<nt::HANDLE>(core, 1);
-        const auto Equal             = arg<nt::PBOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FirstTokenHandle  = arg<nt::HANDLE>(args, 0);
+        const auto SecondTokenHandle = arg<nt::HANDLE>(args, 1);
+        const auto Equal             = arg<nt::PBOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[229]);
@@ -4641,14 +5651,18 @@ opt<bpid_t> nt::syscalls::register_ZwConnectPort(proc_t proc, const on_ZwConnect
     {
         auto& core = d_->core;
 
-        const auto PortHandle                  = arg<nt::PHANDLE>(core, 0);
-        const auto PortName                    = arg<nt::PUNICODE_STRING>(core, 1);
-        const auto SecurityQos                 = arg<nt::PSECURITY_QUALITY_OF_SERVICE>(core, 2);
-        const auto ClientView                  = arg<nt::PPORT_VIEW>(core, 3);
-        const auto ServerView                  = arg<nt::PREMOTE_PORT_VIEW>(core, 4);
-        const auto MaxMessageLength            = arg<nt::PULONG>(core, 5);
-        const auto ConnectionInformation       = arg<nt::PVOID>(core, 6);
-        const auto ConnectionInformationLength = arg<nt::PULONG>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle                  = arg<nt::PHANDLE>(args, 0);
+        const auto PortName                    = arg<nt::PUNICODE_STRING>(args, 1);
+        const auto SecurityQos                 = arg<nt::PSECURITY_QUALITY_OF_SERVICE>(args, 2);
+        const auto ClientView                  = arg<nt::PPORT_VIEW>(args, 3);
+        const auto ServerView                  = arg<nt::PREMOTE_PORT_VIEW>(args, 4);
+        const auto MaxMessageLength            = arg<nt::PULONG>(args, 5);
+        const auto ConnectionInformation       = arg<nt::PVOID>(args, 6);
+        const auto ConnectionInformationLength = arg<nt::PULONG>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[230]);
@@ -4663,8 +5677,12 @@ opt<bpid_t> nt::syscalls::register_ZwContinue(proc_t proc, const on_ZwContinue_f
     {
         auto& core = d_->core;
 
-        const auto ContextRecord = arg<nt::PCONTEXT>(core, 0);
-        const auto TestAlert     = arg<nt::BOOLEAN>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ContextRecord = arg<nt::PCONTEXT>(args, 0);
+        const auto TestAlert     = arg<nt::BOOLEAN>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[231]);
@@ -4679,11 +5697,15 @@ opt<bpid_t> nt::syscalls::register_ZwCreateEvent(proc_t proc, const on_ZwCreateE
     {
         auto& core = d_->core;
 
-        const auto EventHandle      = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto EventType        = arg<nt::EVENT_TYPE>(core, 3);
-        const auto InitialState     = arg<nt::BOOLEAN>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle      = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto EventType        = arg<nt::EVENT_TYPE>(args, 3);
+        const auto InitialState     = arg<nt::BOOLEAN>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[232]);
@@ -4698,9 +5720,13 @@ opt<bpid_t> nt::syscalls::register_ZwCreateEventPair(proc_t proc, const on_ZwCre
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle  = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle  = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[233]);
@@ -4715,17 +5741,21 @@ opt<bpid_t> nt::syscalls::register_ZwCreateFile(proc_t proc, const on_ZwCreateFi
     {
         auto& core = d_->core;
 
-        const auto FileHandle        = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(core, 3);
-        const auto AllocationSize    = arg<nt::PLARGE_INTEGER>(core, 4);
-        const auto FileAttributes    = arg<nt::ULONG>(core, 5);
-        const auto ShareAccess       = arg<nt::ULONG>(core, 6);
-        const auto CreateDisposition = arg<nt::ULONG>(core, 7);
-        const auto CreateOptions     = arg<nt::ULONG>(core, 8);
-        const auto EaBuffer          = arg<nt::PVOID>(core, 9);
-        const auto EaLength          = arg<nt::ULONG>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle        = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(args, 3);
+        const auto AllocationSize    = arg<nt::PLARGE_INTEGER>(args, 4);
+        const auto FileAttributes    = arg<nt::ULONG>(args, 5);
+        const auto ShareAccess       = arg<nt::ULONG>(args, 6);
+        const auto CreateDisposition = arg<nt::ULONG>(args, 7);
+        const auto CreateOptions     = arg<nt::ULONG>(args, 8);
+        const auto EaBuffer          = arg<nt::PVOID>(args, 9);
+        const auto EaLength          = arg<nt::ULONG>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[234]);
@@ -4740,9 +5770,13 @@ opt<bpid_t> nt::syscalls::register_ZwCreateJobObject(proc_t proc, const on_ZwCre
     {
         auto& core = d_->core;
 
-        const auto JobHandle        = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle        = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[235]);
@@ -4757,9 +5791,13 @@ opt<bpid_t> nt::syscalls::register_ZwCreateJobSet(proc_t proc, const on_ZwCreate
     {
         auto& core = d_->core;
 
-        const auto NumJob     = arg<nt::ULONG>(core, 0);
-        const auto UserJobSet = arg<nt::PJOB_SET_ARRAY>(core, 1);
-        const auto Flags      = arg<nt::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto NumJob     = arg<nt::ULONG>(args, 0);
+        const auto UserJobSet = arg<nt::PJOB_SET_ARRAY>(args, 1);
+        const auto Flags      = arg<nt::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[236]);
@@ -4774,13 +5812,17 @@ opt<bpid_t> nt::syscalls::register_ZwCreateKey(proc_t proc, const on_ZwCreateKey
     {
         auto& core = d_->core;
 
-        const auto KeyHandle        = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto TitleIndex       = arg<nt::ULONG>(core, 3);
-        const auto Class            = arg<nt::PUNICODE_STRING>(core, 4);
-        const auto CreateOptions    = arg<nt::ULONG>(core, 5);
-        const auto Disposition      = arg<nt::PULONG>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle        = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto TitleIndex       = arg<nt::ULONG>(args, 3);
+        const auto Class            = arg<nt::PUNICODE_STRING>(args, 4);
+        const auto CreateOptions    = arg<nt::ULONG>(args, 5);
+        const auto Disposition      = arg<nt::PULONG>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[237]);
@@ -4795,14 +5837,18 @@ opt<bpid_t> nt::syscalls::register_ZwCreateKeyTransacted(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto KeyHandle         = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto TitleIndex        = arg<nt::ULONG>(core, 3);
-        const auto Class             = arg<nt::PUNICODE_STRING>(core, 4);
-        const auto CreateOptions     = arg<nt::ULONG>(core, 5);
-        const auto TransactionHandle = arg<nt::HANDLE>(core, 6);
-        const auto Disposition       = arg<nt::PULONG>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle         = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto TitleIndex        = arg<nt::ULONG>(args, 3);
+        const auto Class             = arg<nt::PUNICODE_STRING>(args, 4);
+        const auto CreateOptions     = arg<nt::ULONG>(args, 5);
+        const auto TransactionHandle = arg<nt::HANDLE>(args, 6);
+        const auto Disposition       = arg<nt::PULONG>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[238]);
@@ -4817,10 +5863,14 @@ opt<bpid_t> nt::syscalls::register_ZwCreateKeyedEvent(proc_t proc, const on_ZwCr
     {
         auto& core = d_->core;
 
-        const auto KeyedEventHandle = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Flags            = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyedEventHandle = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Flags            = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[239]);
@@ -4835,14 +5885,18 @@ opt<bpid_t> nt::syscalls::register_ZwCreateMailslotFile(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto FileHandle         = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<nt::ULONG>(core, 1);
-        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(core, 3);
-        const auto CreateOptions      = arg<nt::ULONG>(core, 4);
-        const auto MailslotQuota      = arg<nt::ULONG>(core, 5);
-        const auto MaximumMessageSize = arg<nt::ULONG>(core, 6);
-        const auto ReadTimeout        = arg<nt::PLARGE_INTEGER>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle         = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<nt::ULONG>(args, 1);
+        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(args, 3);
+        const auto CreateOptions      = arg<nt::ULONG>(args, 4);
+        const auto MailslotQuota      = arg<nt::ULONG>(args, 5);
+        const auto MaximumMessageSize = arg<nt::ULONG>(args, 6);
+        const auto ReadTimeout        = arg<nt::PLARGE_INTEGER>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[240]);
@@ -4857,11 +5911,15 @@ opt<bpid_t> nt::syscalls::register_ZwCreatePort(proc_t proc, const on_ZwCreatePo
     {
         auto& core = d_->core;
 
-        const auto PortHandle              = arg<nt::PHANDLE>(core, 0);
-        const auto ObjectAttributes        = arg<nt::POBJECT_ATTRIBUTES>(core, 1);
-        const auto MaxConnectionInfoLength = arg<nt::ULONG>(core, 2);
-        const auto MaxMessageLength        = arg<nt::ULONG>(core, 3);
-        const auto MaxPoolUsage            = arg<nt::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle              = arg<nt::PHANDLE>(args, 0);
+        const auto ObjectAttributes        = arg<nt::POBJECT_ATTRIBUTES>(args, 1);
+        const auto MaxConnectionInfoLength = arg<nt::ULONG>(args, 2);
+        const auto MaxMessageLength        = arg<nt::ULONG>(args, 3);
+        const auto MaxPoolUsage            = arg<nt::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[241]);
@@ -4876,10 +5934,14 @@ opt<bpid_t> nt::syscalls::register_ZwCreatePrivateNamespace(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto NamespaceHandle    = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto BoundaryDescriptor = arg<nt::PVOID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto NamespaceHandle    = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes   = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto BoundaryDescriptor = arg<nt::PVOID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[242]);
@@ -4894,15 +5956,19 @@ opt<bpid_t> nt::syscalls::register_ZwCreateProcessEx(proc_t proc, const on_ZwCre
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ParentProcess    = arg<nt::HANDLE>(core, 3);
-        const auto Flags            = arg<nt::ULONG>(core, 4);
-        const auto SectionHandle    = arg<nt::HANDLE>(core, 5);
-        const auto DebugPort        = arg<nt::HANDLE>(core, 6);
-        const auto ExceptionPort    = arg<nt::HANDLE>(core, 7);
-        const auto JobMemberLevel   = arg<nt::ULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ParentProcess    = arg<nt::HANDLE>(args, 3);
+        const auto Flags            = arg<nt::ULONG>(args, 4);
+        const auto SectionHandle    = arg<nt::HANDLE>(args, 5);
+        const auto DebugPort        = arg<nt::HANDLE>(args, 6);
+        const auto ExceptionPort    = arg<nt::HANDLE>(args, 7);
+        const auto JobMemberLevel   = arg<nt::ULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[243]);
@@ -4917,15 +5983,19 @@ opt<bpid_t> nt::syscalls::register_ZwCreateProfile(proc_t proc, const on_ZwCreat
     {
         auto& core = d_->core;
 
-        const auto ProfileHandle = arg<nt::PHANDLE>(core, 0);
-        const auto Process       = arg<nt::HANDLE>(core, 1);
-        const auto RangeBase     = arg<nt::PVOID>(core, 2);
-        const auto RangeSize     = arg<nt::SIZE_T>(core, 3);
-        const auto BucketSize    = arg<nt::ULONG>(core, 4);
-        const auto Buffer        = arg<nt::PULONG>(core, 5);
-        const auto BufferSize    = arg<nt::ULONG>(core, 6);
-        const auto ProfileSource = arg<nt::KPROFILE_SOURCE>(core, 7);
-        const auto Affinity      = arg<nt::KAFFINITY>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProfileHandle = arg<nt::PHANDLE>(args, 0);
+        const auto Process       = arg<nt::HANDLE>(args, 1);
+        const auto RangeBase     = arg<nt::PVOID>(args, 2);
+        const auto RangeSize     = arg<nt::SIZE_T>(args, 3);
+        const auto BucketSize    = arg<nt::ULONG>(args, 4);
+        const auto Buffer        = arg<nt::PULONG>(args, 5);
+        const auto BufferSize    = arg<nt::ULONG>(args, 6);
+        const auto ProfileSource = arg<nt::KPROFILE_SOURCE>(args, 7);
+        const auto Affinity      = arg<nt::KAFFINITY>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[244]);
@@ -4940,16 +6010,20 @@ opt<bpid_t> nt::syscalls::register_ZwCreateProfileEx(proc_t proc, const on_ZwCre
     {
         auto& core = d_->core;
 
-        const auto ProfileHandle      = arg<nt::PHANDLE>(core, 0);
-        const auto Process            = arg<nt::HANDLE>(core, 1);
-        const auto ProfileBase        = arg<nt::PVOID>(core, 2);
-        const auto ProfileSize        = arg<nt::SIZE_T>(core, 3);
-        const auto BucketSize         = arg<nt::ULONG>(core, 4);
-        const auto Buffer             = arg<nt::PULONG>(core, 5);
-        const auto BufferSize         = arg<nt::ULONG>(core, 6);
-        const auto ProfileSource      = arg<nt::KPROFILE_SOURCE>(core, 7);
-        const auto GroupAffinityCount = arg<nt::ULONG>(core, 8);
-        const auto GroupAffinity      = arg<nt::PGROUP_AFFINITY>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProfileHandle      = arg<nt::PHANDLE>(args, 0);
+        const auto Process            = arg<nt::HANDLE>(args, 1);
+        const auto ProfileBase        = arg<nt::PVOID>(args, 2);
+        const auto ProfileSize        = arg<nt::SIZE_T>(args, 3);
+        const auto BucketSize         = arg<nt::ULONG>(args, 4);
+        const auto Buffer             = arg<nt::PULONG>(args, 5);
+        const auto BufferSize         = arg<nt::ULONG>(args, 6);
+        const auto ProfileSource      = arg<nt::KPROFILE_SOURCE>(args, 7);
+        const auto GroupAffinityCount = arg<nt::ULONG>(args, 8);
+        const auto GroupAffinity      = arg<nt::PGROUP_AFFINITY>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[245]);
@@ -4964,10 +6038,14 @@ opt<bpid_t> nt::syscalls::register_ZwCreateSymbolicLinkObject(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto LinkHandle       = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto LinkTarget       = arg<nt::PUNICODE_STRING>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto LinkHandle       = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto LinkTarget       = arg<nt::PUNICODE_STRING>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[246]);
@@ -4982,10 +6060,14 @@ opt<bpid_t> nt::syscalls::register_ZwCreateTimer(proc_t proc, const on_ZwCreateT
     {
         auto& core = d_->core;
 
-        const auto TimerHandle      = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto TimerType        = arg<nt::TIMER_TYPE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle      = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto TimerType        = arg<nt::TIMER_TYPE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[247]);
@@ -5000,12 +6082,16 @@ opt<bpid_t> nt::syscalls::register_ZwCreateTransactionManager(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto TmHandle         = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto LogFileName      = arg<nt::PUNICODE_STRING>(core, 3);
-        const auto CreateOptions    = arg<nt::ULONG>(core, 4);
-        const auto CommitStrength   = arg<nt::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TmHandle         = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto LogFileName      = arg<nt::PUNICODE_STRING>(args, 3);
+        const auto CreateOptions    = arg<nt::ULONG>(args, 4);
+        const auto CommitStrength   = arg<nt::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[248]);
@@ -5020,8 +6106,12 @@ opt<bpid_t> nt::syscalls::register_ZwDelayExecution(proc_t proc, const on_ZwDela
     {
         auto& core = d_->core;
 
-        const auto Alertable     = arg<nt::BOOLEAN>(core, 0);
-        const auto DelayInterval = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Alertable     = arg<nt::BOOLEAN>(args, 0);
+        const auto DelayInterval = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[249]);
@@ -5036,7 +6126,11 @@ opt<bpid_t> nt::syscalls::register_ZwDeleteDriverEntry(proc_t proc, const on_ZwD
     {
         auto& core = d_->core;
 
-        const auto Id = arg<nt::ULONG>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Id = arg<nt::ULONG>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[250]);
@@ -5051,9 +6145,13 @@ opt<bpid_t> nt::syscalls::register_ZwDeleteObjectAuditAlarm(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto SubsystemName   = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto HandleId        = arg<nt::PVOID>(core, 1);
-        const auto GenerateOnClose = arg<nt::BOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName   = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto HandleId        = arg<nt::PVOID>(args, 1);
+        const auto GenerateOnClose = arg<nt::BOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[251]);
@@ -5068,8 +6166,12 @@ opt<bpid_t> nt::syscalls::register_ZwDeleteValueKey(proc_t proc, const on_ZwDele
     {
         auto& core = d_->core;
 
-        const auto KeyHandle = arg<nt::HANDLE>(core, 0);
-        const auto ValueName = arg<nt::PUNICODE_STRING>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle = arg<nt::HANDLE>(args, 0);
+        const auto ValueName = arg<nt::PUNICODE_STRING>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[252]);
@@ -5084,7 +6186,11 @@ opt<bpid_t> nt::syscalls::register_ZwDisplayString(proc_t proc, const on_ZwDispl
     {
         auto& core = d_->core;
 
-        const auto String = arg<nt::PUNICODE_STRING>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto String = arg<nt::PUNICODE_STRING>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[253]);
@@ -5099,13 +6205,17 @@ opt<bpid_t> nt::syscalls::register_ZwDuplicateObject(proc_t proc, const on_ZwDup
     {
         auto& core = d_->core;
 
-        const auto SourceProcessHandle = arg<nt::HANDLE>(core, 0);
-        const auto SourceHandle        = arg<nt::HANDLE>(core, 1);
-        const auto TargetProcessHandle = arg<nt::HANDLE>(core, 2);
-        const auto TargetHandle        = arg<nt::PHANDLE>(core, 3);
-        const auto DesiredAccess       = arg<nt::ACCESS_MASK>(core, 4);
-        const auto HandleAttributes    = arg<nt::ULONG>(core, 5);
-        const auto Options             = arg<nt::ULONG>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SourceProcessHandle = arg<nt::HANDLE>(args, 0);
+        const auto SourceHandle        = arg<nt::HANDLE>(args, 1);
+        const auto TargetProcessHandle = arg<nt::HANDLE>(args, 2);
+        const auto TargetHandle        = arg<nt::PHANDLE>(args, 3);
+        const auto DesiredAccess       = arg<nt::ACCESS_MASK>(args, 4);
+        const auto HandleAttributes    = arg<nt::ULONG>(args, 5);
+        const auto Options             = arg<nt::ULONG>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[254]);
@@ -5120,8 +6230,12 @@ opt<bpid_t> nt::syscalls::register_ZwEnumerateDriverEntries(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto Buffer       = arg<nt::PVOID>(core, 0);
-        const auto BufferLength = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Buffer       = arg<nt::PVOID>(args, 0);
+        const auto BufferLength = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[255]);
@@ -5136,12 +6250,16 @@ opt<bpid_t> nt::syscalls::register_ZwEnumerateValueKey(proc_t proc, const on_ZwE
     {
         auto& core = d_->core;
 
-        const auto KeyHandle                = arg<nt::HANDLE>(core, 0);
-        const auto Index                    = arg<nt::ULONG>(core, 1);
-        const auto KeyValueInformationClass = arg<nt::KEY_VALUE_INFORMATION_CLASS>(core, 2);
-        const auto KeyValueInformation      = arg<nt::PVOID>(core, 3);
-        const auto Length                   = arg<nt::ULONG>(core, 4);
-        const auto ResultLength             = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle                = arg<nt::HANDLE>(args, 0);
+        const auto Index                    = arg<nt::ULONG>(args, 1);
+        const auto KeyValueInformationClass = arg<nt::KEY_VALUE_INFORMATION_CLASS>(args, 2);
+        const auto KeyValueInformation      = arg<nt::PVOID>(args, 3);
+        const auto Length                   = arg<nt::ULONG>(args, 4);
+        const auto ResultLength             = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[256]);
@@ -5156,12 +6274,16 @@ opt<bpid_t> nt::syscalls::register_ZwFilterToken(proc_t proc, const on_ZwFilterT
     {
         auto& core = d_->core;
 
-        const auto ExistingTokenHandle = arg<nt::HANDLE>(core, 0);
-        const auto Flags               = arg<nt::ULONG>(core, 1);
-        const auto SidsToDisable       = arg<nt::PTOKEN_GROUPS>(core, 2);
-        const auto PrivilegesToDelete  = arg<nt::PTOKEN_PRIVILEGES>(core, 3);
-        const auto RestrictedSids      = arg<nt::PTOKEN_GROUPS>(core, 4);
-        const auto NewTokenHandle      = arg<nt::PHANDLE>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ExistingTokenHandle = arg<nt::HANDLE>(args, 0);
+        const auto Flags               = arg<nt::ULONG>(args, 1);
+        const auto SidsToDisable       = arg<nt::PTOKEN_GROUPS>(args, 2);
+        const auto PrivilegesToDelete  = arg<nt::PTOKEN_PRIVILEGES>(args, 3);
+        const auto RestrictedSids      = arg<nt::PTOKEN_GROUPS>(args, 4);
+        const auto NewTokenHandle      = arg<nt::PHANDLE>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[257]);
@@ -5176,9 +6298,13 @@ opt<bpid_t> nt::syscalls::register_ZwFindAtom(proc_t proc, const on_ZwFindAtom_f
     {
         auto& core = d_->core;
 
-        const auto AtomName = arg<nt::PWSTR>(core, 0);
-        const auto Length   = arg<nt::ULONG>(core, 1);
-        const auto Atom     = arg<nt::PRTL_ATOM>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto AtomName = arg<nt::PWSTR>(args, 0);
+        const auto Length   = arg<nt::ULONG>(args, 1);
+        const auto Atom     = arg<nt::PRTL_ATOM>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[258]);
@@ -5193,8 +6319,12 @@ opt<bpid_t> nt::syscalls::register_ZwFlushBuffersFile(proc_t proc, const on_ZwFl
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<nt::HANDLE>(core, 0);
-        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<nt::HANDLE>(args, 0);
+        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[259]);
@@ -5209,7 +6339,11 @@ opt<bpid_t> nt::syscalls::register_ZwFlushKey(proc_t proc, const on_ZwFlushKey_f
     {
         auto& core = d_->core;
 
-        const auto KeyHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[260]);
@@ -5237,10 +6371,14 @@ opt<bpid_t> nt::syscalls::register_ZwFlushVirtualMemory(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<nt::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<nt::PVOID>(core, 1);
-        const auto RegionSize      = arg<nt::PSIZE_T>(core, 2);
-        const auto IoStatus        = arg<nt::PIO_STATUS_BLOCK>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<nt::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<nt::PVOID>(args, 1);
+        const auto RegionSize      = arg<nt::PSIZE_T>(args, 2);
+        const auto IoStatus        = arg<nt::PIO_STATUS_BLOCK>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[262]);
@@ -5255,9 +6393,13 @@ opt<bpid_t> nt::syscalls::register_ZwFreeUserPhysicalPages(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<nt::HANDLE>(core, 0);
-        const auto NumberOfPages = arg<nt::PULONG_PTR>(core, 1);
-        const auto UserPfnArra   = arg<nt::PULONG_PTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<nt::HANDLE>(args, 0);
+        const auto NumberOfPages = arg<nt::PULONG_PTR>(args, 1);
+        const auto UserPfnArra   = arg<nt::PULONG_PTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[263]);
@@ -5272,10 +6414,14 @@ opt<bpid_t> nt::syscalls::register_ZwFreeVirtualMemory(proc_t proc, const on_ZwF
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<nt::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<nt::PVOID>(core, 1);
-        const auto RegionSize      = arg<nt::PSIZE_T>(core, 2);
-        const auto FreeType        = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<nt::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<nt::PVOID>(args, 1);
+        const auto RegionSize      = arg<nt::PSIZE_T>(args, 2);
+        const auto FreeType        = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[264]);
@@ -5290,8 +6436,12 @@ opt<bpid_t> nt::syscalls::register_ZwFreezeTransactions(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto FreezeTimeout = arg<nt::PLARGE_INTEGER>(core, 0);
-        const auto ThawTimeout   = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FreezeTimeout = arg<nt::PLARGE_INTEGER>(args, 0);
+        const auto ThawTimeout   = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[265]);
@@ -5306,16 +6456,20 @@ opt<bpid_t> nt::syscalls::register_ZwFsControlFile(proc_t proc, const on_ZwFsCon
     {
         auto& core = d_->core;
 
-        const auto FileHandle         = arg<nt::HANDLE>(core, 0);
-        const auto Event              = arg<nt::HANDLE>(core, 1);
-        const auto ApcRoutine         = arg<nt::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext         = arg<nt::PVOID>(core, 3);
-        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(core, 4);
-        const auto IoControlCode      = arg<nt::ULONG>(core, 5);
-        const auto InputBuffer        = arg<nt::PVOID>(core, 6);
-        const auto InputBufferLength  = arg<nt::ULONG>(core, 7);
-        const auto OutputBuffer       = arg<nt::PVOID>(core, 8);
-        const auto OutputBufferLength = arg<nt::ULONG>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle         = arg<nt::HANDLE>(args, 0);
+        const auto Event              = arg<nt::HANDLE>(args, 1);
+        const auto ApcRoutine         = arg<nt::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext         = arg<nt::PVOID>(args, 3);
+        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(args, 4);
+        const auto IoControlCode      = arg<nt::ULONG>(args, 5);
+        const auto InputBuffer        = arg<nt::PVOID>(args, 6);
+        const auto InputBufferLength  = arg<nt::ULONG>(args, 7);
+        const auto OutputBuffer       = arg<nt::PVOID>(args, 8);
+        const auto OutputBufferLength = arg<nt::ULONG>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[266]);
@@ -5330,8 +6484,12 @@ opt<bpid_t> nt::syscalls::register_ZwGetContextThread(proc_t proc, const on_ZwGe
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle  = arg<nt::HANDLE>(core, 0);
-        const auto ThreadContext = arg<nt::PCONTEXT>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle  = arg<nt::HANDLE>(args, 0);
+        const auto ThreadContext = arg<nt::PCONTEXT>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[267]);
@@ -5359,8 +6517,12 @@ opt<bpid_t> nt::syscalls::register_ZwGetDevicePowerState(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto Device    = arg<nt::HANDLE>(core, 0);
-        const auto STARState = arg<nt::DEVICE_POWER_STATE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Device    = arg<nt::HANDLE>(args, 0);
+        const auto STARState = arg<nt::DEVICE_POWER_STATE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[269]);
@@ -5375,9 +6537,13 @@ opt<bpid_t> nt::syscalls::register_ZwGetMUIRegistryInfo(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto Flags    = arg<nt::ULONG>(core, 0);
-        const auto DataSize = arg<nt::PULONG>(core, 1);
-        const auto Data     = arg<nt::PVOID>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Flags    = arg<nt::ULONG>(args, 0);
+        const auto DataSize = arg<nt::PULONG>(args, 1);
+        const auto Data     = arg<nt::PVOID>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[270]);
@@ -5392,12 +6558,16 @@ opt<bpid_t> nt::syscalls::register_ZwGetNextThread(proc_t proc, const on_ZwGetNe
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<nt::HANDLE>(core, 0);
-        const auto ThreadHandle     = arg<nt::HANDLE>(core, 1);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 2);
-        const auto HandleAttributes = arg<nt::ULONG>(core, 3);
-        const auto Flags            = arg<nt::ULONG>(core, 4);
-        const auto NewThreadHandle  = arg<nt::PHANDLE>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<nt::HANDLE>(args, 0);
+        const auto ThreadHandle     = arg<nt::HANDLE>(args, 1);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 2);
+        const auto HandleAttributes = arg<nt::ULONG>(args, 3);
+        const auto Flags            = arg<nt::ULONG>(args, 4);
+        const auto NewThreadHandle  = arg<nt::PHANDLE>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[271]);
@@ -5412,11 +6582,15 @@ opt<bpid_t> nt::syscalls::register_ZwGetNlsSectionPtr(proc_t proc, const on_ZwGe
     {
         auto& core = d_->core;
 
-        const auto SectionType        = arg<nt::ULONG>(core, 0);
-        const auto SectionData        = arg<nt::ULONG>(core, 1);
-        const auto ContextData        = arg<nt::PVOID>(core, 2);
-        const auto STARSectionPointer = arg<nt::PVOID>(core, 3);
-        const auto SectionSize        = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionType        = arg<nt::ULONG>(args, 0);
+        const auto SectionData        = arg<nt::ULONG>(args, 1);
+        const auto ContextData        = arg<nt::PVOID>(args, 2);
+        const auto STARSectionPointer = arg<nt::PVOID>(args, 3);
+        const auto SectionSize        = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[272]);
@@ -5431,13 +6605,17 @@ opt<bpid_t> nt::syscalls::register_ZwGetWriteWatch(proc_t proc, const on_ZwGetWr
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle             = arg<nt::HANDLE>(core, 0);
-        const auto Flags                     = arg<nt::ULONG>(core, 1);
-        const auto BaseAddress               = arg<nt::PVOID>(core, 2);
-        const auto RegionSize                = arg<nt::SIZE_T>(core, 3);
-        const auto STARUserAddressArray      = arg<nt::PVOID>(core, 4);
-        const auto EntriesInUserAddressArray = arg<nt::PULONG_PTR>(core, 5);
-        const auto Granularity               = arg<nt::PULONG>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle             = arg<nt::HANDLE>(args, 0);
+        const auto Flags                     = arg<nt::ULONG>(args, 1);
+        const auto BaseAddress               = arg<nt::PVOID>(args, 2);
+        const auto RegionSize                = arg<nt::SIZE_T>(args, 3);
+        const auto STARUserAddressArray      = arg<nt::PVOID>(args, 4);
+        const auto EntriesInUserAddressArray = arg<nt::PULONG_PTR>(args, 5);
+        const auto Granularity               = arg<nt::PULONG>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[273]);
@@ -5452,7 +6630,11 @@ opt<bpid_t> nt::syscalls::register_ZwImpersonateAnonymousToken(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[274]);
@@ -5467,8 +6649,12 @@ opt<bpid_t> nt::syscalls::register_ZwImpersonateClientOfPort(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<nt::HANDLE>(core, 0);
-        const auto Message    = arg<nt::PPORT_MESSAGE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<nt::HANDLE>(args, 0);
+        const auto Message    = arg<nt::PPORT_MESSAGE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[275]);
@@ -5483,9 +6669,13 @@ opt<bpid_t> nt::syscalls::register_ZwImpersonateThread(proc_t proc, const on_ZwI
     {
         auto& core = d_->core;
 
-        const auto ServerThreadHandle = arg<nt::HANDLE>(core, 0);
-        const auto ClientThreadHandle = arg<nt::HANDLE>(core, 1);
-        const auto SecurityQos        = arg<nt::PSECURITY_QUALITY_OF_SERVICE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ServerThreadHandle = arg<nt::HANDLE>(args, 0);
+        const auto ClientThreadHandle = arg<nt::HANDLE>(args, 1);
+        const auto SecurityQos        = arg<nt::PSECURITY_QUALITY_OF_SERVICE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[276]);
@@ -5513,7 +6703,11 @@ opt<bpid_t> nt::syscalls::register_ZwLoadDriver(proc_t proc, const on_ZwLoadDriv
     {
         auto& core = d_->core;
 
-        const auto DriverServiceName = arg<nt::PUNICODE_STRING>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DriverServiceName = arg<nt::PUNICODE_STRING>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[278]);
@@ -5528,9 +6722,13 @@ opt<bpid_t> nt::syscalls::register_ZwLoadKey2(proc_t proc, const on_ZwLoadKey2_f
     {
         auto& core = d_->core;
 
-        const auto TargetKey  = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
-        const auto SourceFile = arg<nt::POBJECT_ATTRIBUTES>(core, 1);
-        const auto Flags      = arg<nt::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey  = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
+        const auto SourceFile = arg<nt::POBJECT_ATTRIBUTES>(args, 1);
+        const auto Flags      = arg<nt::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[279]);
@@ -5545,16 +6743,20 @@ opt<bpid_t> nt::syscalls::register_ZwLockFile(proc_t proc, const on_ZwLockFile_f
     {
         auto& core = d_->core;
 
-        const auto FileHandle      = arg<nt::HANDLE>(core, 0);
-        const auto Event           = arg<nt::HANDLE>(core, 1);
-        const auto ApcRoutine      = arg<nt::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext      = arg<nt::PVOID>(core, 3);
-        const auto IoStatusBlock   = arg<nt::PIO_STATUS_BLOCK>(core, 4);
-        const auto ByteOffset      = arg<nt::PLARGE_INTEGER>(core, 5);
-        const auto Length          = arg<nt::PLARGE_INTEGER>(core, 6);
-        const auto Key             = arg<nt::ULONG>(core, 7);
-        const auto FailImmediately = arg<nt::BOOLEAN>(core, 8);
-        const auto ExclusiveLock   = arg<nt::BOOLEAN>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle      = arg<nt::HANDLE>(args, 0);
+        const auto Event           = arg<nt::HANDLE>(args, 1);
+        const auto ApcRoutine      = arg<nt::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext      = arg<nt::PVOID>(args, 3);
+        const auto IoStatusBlock   = arg<nt::PIO_STATUS_BLOCK>(args, 4);
+        const auto ByteOffset      = arg<nt::PLARGE_INTEGER>(args, 5);
+        const auto Length          = arg<nt::PLARGE_INTEGER>(args, 6);
+        const auto Key             = arg<nt::ULONG>(args, 7);
+        const auto FailImmediately = arg<nt::BOOLEAN>(args, 8);
+        const auto ExclusiveLock   = arg<nt::BOOLEAN>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[280]);
@@ -5569,7 +6771,11 @@ opt<bpid_t> nt::syscalls::register_ZwLockRegistryKey(proc_t proc, const on_ZwLoc
     {
         auto& core = d_->core;
 
-        const auto KeyHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[281]);
@@ -5584,9 +6790,13 @@ opt<bpid_t> nt::syscalls::register_ZwMapUserPhysicalPagesScatter(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto STARVirtualAddresses = arg<nt::PVOID>(core, 0);
-        const auto NumberOfPages        = arg<nt::ULONG_PTR>(core, 1);
-        const auto UserPfnArray         = arg<nt::PULONG_PTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto STARVirtualAddresses = arg<nt::PVOID>(args, 0);
+        const auto NumberOfPages        = arg<nt::ULONG_PTR>(args, 1);
+        const auto UserPfnArray         = arg<nt::PULONG_PTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[282]);
@@ -5601,16 +6811,20 @@ opt<bpid_t> nt::syscalls::register_ZwMapViewOfSection(proc_t proc, const on_ZwMa
     {
         auto& core = d_->core;
 
-        const auto SectionHandle      = arg<nt::HANDLE>(core, 0);
-        const auto ProcessHandle      = arg<nt::HANDLE>(core, 1);
-        const auto STARBaseAddress    = arg<nt::PVOID>(core, 2);
-        const auto ZeroBits           = arg<nt::ULONG_PTR>(core, 3);
-        const auto CommitSize         = arg<nt::SIZE_T>(core, 4);
-        const auto SectionOffset      = arg<nt::PLARGE_INTEGER>(core, 5);
-        const auto ViewSize           = arg<nt::PSIZE_T>(core, 6);
-        const auto InheritDisposition = arg<nt::SECTION_INHERIT>(core, 7);
-        const auto AllocationType     = arg<nt::ULONG>(core, 8);
-        const auto Win32Protect       = arg<nt::WIN32_PROTECTION_MASK>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionHandle      = arg<nt::HANDLE>(args, 0);
+        const auto ProcessHandle      = arg<nt::HANDLE>(args, 1);
+        const auto STARBaseAddress    = arg<nt::PVOID>(args, 2);
+        const auto ZeroBits           = arg<nt::ULONG_PTR>(args, 3);
+        const auto CommitSize         = arg<nt::SIZE_T>(args, 4);
+        const auto SectionOffset      = arg<nt::PLARGE_INTEGER>(args, 5);
+        const auto ViewSize           = arg<nt::PSIZE_T>(args, 6);
+        const auto InheritDisposition = arg<nt::SECTION_INHERIT>(args, 7);
+        const auto AllocationType     = arg<nt::ULONG>(args, 8);
+        const auto Win32Protect       = arg<nt::WIN32_PROTECTION_MASK>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[283]);
@@ -5625,7 +6839,11 @@ opt<bpid_t> nt::syscalls::register_ZwModifyDriverEntry(proc_t proc, const on_ZwM
     {
         auto& core = d_->core;
 
-        const auto DriverEntry = arg<nt::PEFI_DRIVER_ENTRY>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DriverEntry = arg<nt::PEFI_DRIVER_ENTRY>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[284]);
@@ -5640,16 +6858,20 @@ opt<bpid_t> nt::syscalls::register_ZwNotifyChangeKey(proc_t proc, const on_ZwNot
     {
         auto& core = d_->core;
 
-        const auto KeyHandle        = arg<nt::HANDLE>(core, 0);
-        const auto Event            = arg<nt::HANDLE>(core, 1);
-        const auto ApcRoutine       = arg<nt::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext       = arg<nt::PVOID>(core, 3);
-        const auto IoStatusBlock    = arg<nt::PIO_STATUS_BLOCK>(core, 4);
-        const auto CompletionFilter = arg<nt::ULONG>(core, 5);
-        const auto WatchTree        = arg<nt::BOOLEAN>(core, 6);
-        const auto Buffer           = arg<nt::PVOID>(core, 7);
-        const auto BufferSize       = arg<nt::ULONG>(core, 8);
-        const auto Asynchronous     = arg<nt::BOOLEAN>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle        = arg<nt::HANDLE>(args, 0);
+        const auto Event            = arg<nt::HANDLE>(args, 1);
+        const auto ApcRoutine       = arg<nt::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext       = arg<nt::PVOID>(args, 3);
+        const auto IoStatusBlock    = arg<nt::PIO_STATUS_BLOCK>(args, 4);
+        const auto CompletionFilter = arg<nt::ULONG>(args, 5);
+        const auto WatchTree        = arg<nt::BOOLEAN>(args, 6);
+        const auto Buffer           = arg<nt::PVOID>(args, 7);
+        const auto BufferSize       = arg<nt::ULONG>(args, 8);
+        const auto Asynchronous     = arg<nt::BOOLEAN>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[285]);
@@ -5664,9 +6886,13 @@ opt<bpid_t> nt::syscalls::register_ZwOpenDirectoryObject(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto DirectoryHandle  = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DirectoryHandle  = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[286]);
@@ -5681,9 +6907,13 @@ opt<bpid_t> nt::syscalls::register_ZwOpenEventPair(proc_t proc, const on_ZwOpenE
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle  = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle  = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[287]);
@@ -5698,10 +6928,14 @@ opt<bpid_t> nt::syscalls::register_ZwOpenKeyTransacted(proc_t proc, const on_ZwO
     {
         auto& core = d_->core;
 
-        const auto KeyHandle         = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto TransactionHandle = arg<nt::HANDLE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle         = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto TransactionHandle = arg<nt::HANDLE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[288]);
@@ -5716,11 +6950,15 @@ opt<bpid_t> nt::syscalls::register_ZwOpenKeyTransactedEx(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto KeyHandle         = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto OpenOptions       = arg<nt::ULONG>(core, 3);
-        const auto TransactionHandle = arg<nt::HANDLE>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle         = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto OpenOptions       = arg<nt::ULONG>(args, 3);
+        const auto TransactionHandle = arg<nt::HANDLE>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[289]);
@@ -5735,18 +6973,22 @@ opt<bpid_t> nt::syscalls::register_ZwOpenObjectAuditAlarm(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto SubsystemName      = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto HandleId           = arg<nt::PVOID>(core, 1);
-        const auto ObjectTypeName     = arg<nt::PUNICODE_STRING>(core, 2);
-        const auto ObjectName         = arg<nt::PUNICODE_STRING>(core, 3);
-        const auto SecurityDescriptor = arg<nt::PSECURITY_DESCRIPTOR>(core, 4);
-        const auto ClientToken        = arg<nt::HANDLE>(core, 5);
-        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(core, 6);
-        const auto GrantedAccess      = arg<nt::ACCESS_MASK>(core, 7);
-        const auto Privileges         = arg<nt::PPRIVILEGE_SET>(core, 8);
-        const auto ObjectCreation     = arg<nt::BOOLEAN>(core, 9);
-        const auto AccessGranted      = arg<nt::BOOLEAN>(core, 10);
-        const auto GenerateOnClose    = arg<nt::PBOOLEAN>(core, 11);
+        auto args = std::array<arg_t, 12>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName      = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto HandleId           = arg<nt::PVOID>(args, 1);
+        const auto ObjectTypeName     = arg<nt::PUNICODE_STRING>(args, 2);
+        const auto ObjectName         = arg<nt::PUNICODE_STRING>(args, 3);
+        const auto SecurityDescriptor = arg<nt::PSECURITY_DESCRIPTOR>(args, 4);
+        const auto ClientToken        = arg<nt::HANDLE>(args, 5);
+        const auto DesiredAccess      = arg<nt::ACCESS_MASK>(args, 6);
+        const auto GrantedAccess      = arg<nt::ACCESS_MASK>(args, 7);
+        const auto Privileges         = arg<nt::PPRIVILEGE_SET>(args, 8);
+        const auto ObjectCreation     = arg<nt::BOOLEAN>(args, 9);
+        const auto AccessGranted      = arg<nt::BOOLEAN>(args, 10);
+        const auto GenerateOnClose    = arg<nt::PBOOLEAN>(args, 11);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[290]);
@@ -5761,9 +7003,13 @@ opt<bpid_t> nt::syscalls::register_ZwOpenSemaphore(proc_t proc, const on_ZwOpenS
     {
         auto& core = d_->core;
 
-        const auto SemaphoreHandle  = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SemaphoreHandle  = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[291]);
@@ -5778,9 +7024,13 @@ opt<bpid_t> nt::syscalls::register_ZwOpenSession(proc_t proc, const on_ZwOpenSes
     {
         auto& core = d_->core;
 
-        const auto SessionHandle    = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SessionHandle    = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[292]);
@@ -5795,9 +7045,13 @@ opt<bpid_t> nt::syscalls::register_ZwOpenSymbolicLinkObject(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto LinkHandle       = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto LinkHandle       = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[293]);
@@ -5812,10 +7066,14 @@ opt<bpid_t> nt::syscalls::register_ZwOpenThread(proc_t proc, const on_ZwOpenThre
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle     = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ClientId         = arg<nt::PCLIENT_ID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle     = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ClientId         = arg<nt::PCLIENT_ID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[294]);
@@ -5830,9 +7088,13 @@ opt<bpid_t> nt::syscalls::register_ZwOpenTimer(proc_t proc, const on_ZwOpenTimer
     {
         auto& core = d_->core;
 
-        const auto TimerHandle      = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle      = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[295]);
@@ -5847,11 +7109,15 @@ opt<bpid_t> nt::syscalls::register_ZwOpenTransaction(proc_t proc, const on_ZwOpe
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle = arg<nt::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Uow               = arg<nt::LPGUID>(core, 3);
-        const auto TmHandle          = arg<nt::HANDLE>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle = arg<nt::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<nt::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<nt::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Uow               = arg<nt::LPGUID>(args, 3);
+        const auto TmHandle          = arg<nt::HANDLE>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[296]);
@@ -5866,9 +7132,13 @@ opt<bpid_t> nt::syscalls::register_ZwPlugPlayControl(proc_t proc, const on_ZwPlu
     {
         auto& core = d_->core;
 
-        const auto PnPControlClass      = arg<nt::PLUGPLAY_CONTROL_CLASS>(core, 0);
-        const auto PnPControlData       = arg<nt::PVOID>(core, 1);
-        const auto PnPControlDataLength = arg<nt::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PnPControlClass      = arg<nt::PLUGPLAY_CONTROL_CLASS>(args, 0);
+        const auto PnPControlData       = arg<nt::PVOID>(args, 1);
+        const auto PnPControlDataLength = arg<nt::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[297]);
@@ -5883,8 +7153,12 @@ opt<bpid_t> nt::syscalls::register_ZwPrePrepareComplete(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<nt::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<nt::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[298]);
@@ -5899,8 +7173,12 @@ opt<bpid_t> nt::syscalls::register_ZwPrepareComplete(proc_t proc, const on_ZwPre
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<nt::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<nt::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[299]);
@@ -5915,8 +7193,12 @@ opt<bpid_t> nt::syscalls::register_ZwPrepareEnlistment(proc_t proc, const on_ZwP
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<nt::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<nt::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[300]);
@@ -5931,9 +7213,13 @@ opt<bpid_t> nt::syscalls::register_ZwPrivilegeCheck(proc_t proc, const on_ZwPriv
     {
         auto& core = d_->core;
 
-        const auto ClientToken        = arg<nt::HANDLE>(core, 0);
-        const auto RequiredPrivileges = arg<nt::PPRIVILEGE_SET>(core, 1);
-        const auto Result             = arg<nt::PBOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ClientToken        = arg<nt::HANDLE>(args, 0);
+        const auto RequiredPrivileges = arg<nt::PPRIVILEGE_SET>(args, 1);
+        const auto Result             = arg<nt::PBOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[301]);
@@ -5948,11 +7234,15 @@ opt<bpid_t> nt::syscalls::register_ZwPrivilegedServiceAuditAlarm(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto SubsystemName = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto ServiceName   = arg<nt::PUNICODE_STRING>(core, 1);
-        const auto ClientToken   = arg<nt::HANDLE>(core, 2);
-        const auto Privileges    = arg<nt::PPRIVILEGE_SET>(core, 3);
-        const auto AccessGranted = arg<nt::BOOLEAN>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto ServiceName   = arg<nt::PUNICODE_STRING>(args, 1);
+        const auto ClientToken   = arg<nt::HANDLE>(args, 2);
+        const auto Privileges    = arg<nt::PPRIVILEGE_SET>(args, 3);
+        const auto AccessGranted = arg<nt::BOOLEAN>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[302]);
@@ -5967,11 +7257,15 @@ opt<bpid_t> nt::syscalls::register_ZwProtectVirtualMemory(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<nt::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<nt::PVOID>(core, 1);
-        const auto RegionSize      = arg<nt::PSIZE_T>(core, 2);
-        const auto NewProtectWin32 = arg<nt::WIN32_PROTECTION_MASK>(core, 3);
-        const auto OldProtect      = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<nt::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<nt::PVOID>(args, 1);
+        const auto RegionSize      = arg<nt::PSIZE_T>(args, 2);
+        const auto NewProtectWin32 = arg<nt::WIN32_PROTECTION_MASK>(args, 3);
+        const auto OldProtect      = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[303]);
@@ -5986,8 +7280,12 @@ opt<bpid_t> nt::syscalls::register_ZwPulseEvent(proc_t proc, const on_ZwPulseEve
     {
         auto& core = d_->core;
 
-        const auto EventHandle   = arg<nt::HANDLE>(core, 0);
-        const auto PreviousState = arg<nt::PLONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle   = arg<nt::HANDLE>(args, 0);
+        const auto PreviousState = arg<nt::PLONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[304]);
@@ -6002,8 +7300,12 @@ opt<bpid_t> nt::syscalls::register_ZwQueryAttributesFile(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
-        const auto FileInformation  = arg<nt::PFILE_BASIC_INFORMATION>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ObjectAttributes = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
+        const auto FileInformation  = arg<nt::PFILE_BASIC_INFORMATION>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[305]);
@@ -6018,8 +7320,12 @@ opt<bpid_t> nt::syscalls::register_ZwQueryBootEntryOrder(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto Ids   = arg<nt::PULONG>(core, 0);
-        const auto Count = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Ids   = arg<nt::PULONG>(args, 0);
+        const auto Count = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[306]);
@@ -6034,8 +7340,12 @@ opt<bpid_t> nt::syscalls::register_ZwQueryDebugFilterState(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ComponentId = arg<nt::ULONG>(core, 0);
-        const auto Level       = arg<nt::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ComponentId = arg<nt::ULONG>(args, 0);
+        const auto Level       = arg<nt::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[307]);
@@ -6050,7 +7360,11 @@ opt<bpid_t> nt::syscalls::register_ZwQueryDefaultUILanguage(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto STARDefaultUILanguageId = arg<nt::LANGID>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto STARDefaultUILanguageId = arg<nt::LANGID>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[308]);
@@ -6065,13 +7379,17 @@ opt<bpid_t> nt::syscalls::register_ZwQueryDirectoryObject(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto DirectoryHandle   = arg<nt::HANDLE>(core, 0);
-        const auto Buffer            = arg<nt::PVOID>(core, 1);
-        const auto Length            = arg<nt::ULONG>(core, 2);
-        const auto ReturnSingleEntry = arg<nt::BOOLEAN>(core, 3);
-        const auto RestartScan       = arg<nt::BOOLEAN>(core, 4);
-        const auto Context           = arg<nt::PULONG>(core, 5);
-        const auto ReturnLength      = arg<nt::PULONG>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DirectoryHandle   = arg<nt::HANDLE>(args, 0);
+        const auto Buffer            = arg<nt::PVOID>(args, 1);
+        const auto Length            = arg<nt::ULONG>(args, 2);
+        const auto ReturnSingleEntry = arg<nt::BOOLEAN>(args, 3);
+        const auto RestartScan       = arg<nt::BOOLEAN>(args, 4);
+        const auto Context           = arg<nt::PULONG>(args, 5);
+        const auto ReturnLength      = arg<nt::PULONG>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[309]);
@@ -6086,15 +7404,19 @@ opt<bpid_t> nt::syscalls::register_ZwQueryEaFile(proc_t proc, const on_ZwQueryEa
     {
         auto& core = d_->core;
 
-        const auto FileHandle        = arg<nt::HANDLE>(core, 0);
-        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(core, 1);
-        const auto Buffer            = arg<nt::PVOID>(core, 2);
-        const auto Length            = arg<nt::ULONG>(core, 3);
-        const auto ReturnSingleEntry = arg<nt::BOOLEAN>(core, 4);
-        const auto EaList            = arg<nt::PVOID>(core, 5);
-        const auto EaListLength      = arg<nt::ULONG>(core, 6);
-        const auto EaIndex           = arg<nt::PULONG>(core, 7);
-        const auto RestartScan       = arg<nt::BOOLEAN>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle        = arg<nt::HANDLE>(args, 0);
+        const auto IoStatusBlock     = arg<nt::PIO_STATUS_BLOCK>(args, 1);
+        const auto Buffer            = arg<nt::PVOID>(args, 2);
+        const auto Length            = arg<nt::ULONG>(args, 3);
+        const auto ReturnSingleEntry = arg<nt::BOOLEAN>(args, 4);
+        const auto EaList            = arg<nt::PVOID>(args, 5);
+        const auto EaListLength      = arg<nt::ULONG>(args, 6);
+        const auto EaIndex           = arg<nt::PULONG>(args, 7);
+        const auto RestartScan       = arg<nt::BOOLEAN>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[310]);
@@ -6109,11 +7431,15 @@ opt<bpid_t> nt::syscalls::register_ZwQueryInformationThread(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle            = arg<nt::HANDLE>(core, 0);
-        const auto ThreadInformationClass  = arg<nt::THREADINFOCLASS>(core, 1);
-        const auto ThreadInformation       = arg<nt::PVOID>(core, 2);
-        const auto ThreadInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength            = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle            = arg<nt::HANDLE>(args, 0);
+        const auto ThreadInformationClass  = arg<nt::THREADINFOCLASS>(args, 1);
+        const auto ThreadInformation       = arg<nt::PVOID>(args, 2);
+        const auto ThreadInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength            = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[311]);
@@ -6128,11 +7454,15 @@ opt<bpid_t> nt::syscalls::register_ZwQueryInformationTransaction(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle            = arg<nt::HANDLE>(core, 0);
-        const auto TransactionInformationClass  = arg<nt::TRANSACTION_INFORMATION_CLASS>(core, 1);
-        const auto TransactionInformation       = arg<nt::PVOID>(core, 2);
-        const auto TransactionInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength                 = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle            = arg<nt::HANDLE>(args, 0);
+        const auto TransactionInformationClass  = arg<nt::TRANSACTION_INFORMATION_CLASS>(args, 1);
+        const auto TransactionInformation       = arg<nt::PVOID>(args, 2);
+        const auto TransactionInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength                 = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[312]);
@@ -6147,11 +7477,15 @@ opt<bpid_t> nt::syscalls::register_ZwQueryInformationWorkerFactory(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle            = arg<nt::HANDLE>(core, 0);
-        const auto WorkerFactoryInformationClass  = arg<nt::WORKERFACTORYINFOCLASS>(core, 1);
-        const auto WorkerFactoryInformation       = arg<nt::PVOID>(core, 2);
-        const auto WorkerFactoryInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength                   = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle            = arg<nt::HANDLE>(args, 0);
+        const auto WorkerFactoryInformationClass  = arg<nt::WORKERFACTORYINFOCLASS>(args, 1);
+        const auto WorkerFactoryInformation       = arg<nt::PVOID>(args, 2);
+        const auto WorkerFactoryInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength                   = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[313]);
@@ -6166,11 +7500,15 @@ opt<bpid_t> nt::syscalls::register_ZwQueryKey(proc_t proc, const on_ZwQueryKey_f
     {
         auto& core = d_->core;
 
-        const auto KeyHandle           = arg<nt::HANDLE>(core, 0);
-        const auto KeyInformationClass = arg<nt::KEY_INFORMATION_CLASS>(core, 1);
-        const auto KeyInformation      = arg<nt::PVOID>(core, 2);
-        const auto Length              = arg<nt::ULONG>(core, 3);
-        const auto ResultLength        = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle           = arg<nt::HANDLE>(args, 0);
+        const auto KeyInformationClass = arg<nt::KEY_INFORMATION_CLASS>(args, 1);
+        const auto KeyInformation      = arg<nt::PVOID>(args, 2);
+        const auto Length              = arg<nt::ULONG>(args, 3);
+        const auto ResultLength        = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[314]);
@@ -6185,11 +7523,15 @@ opt<bpid_t> nt::syscalls::register_ZwQueryLicenseValue(proc_t proc, const on_ZwQ
     {
         auto& core = d_->core;
 
-        const auto Name           = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto Type           = arg<nt::PULONG>(core, 1);
-        const auto Buffer         = arg<nt::PVOID>(core, 2);
-        const auto Length         = arg<nt::ULONG>(core, 3);
-        const auto ReturnedLength = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Name           = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto Type           = arg<nt::PULONG>(args, 1);
+        const auto Buffer         = arg<nt::PVOID>(args, 2);
+        const auto Length         = arg<nt::ULONG>(args, 3);
+        const auto ReturnedLength = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[315]);
@@ -6204,12 +7546,16 @@ opt<bpid_t> nt::syscalls::register_ZwQueryMultipleValueKey(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto KeyHandle            = arg<nt::HANDLE>(core, 0);
-        const auto ValueEntries         = arg<nt::PKEY_VALUE_ENTRY>(core, 1);
-        const auto EntryCount           = arg<nt::ULONG>(core, 2);
-        const auto ValueBuffer          = arg<nt::PVOID>(core, 3);
-        const auto BufferLength         = arg<nt::PULONG>(core, 4);
-        const auto RequiredBufferLength = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle            = arg<nt::HANDLE>(args, 0);
+        const auto ValueEntries         = arg<nt::PKEY_VALUE_ENTRY>(args, 1);
+        const auto EntryCount           = arg<nt::ULONG>(args, 2);
+        const auto ValueBuffer          = arg<nt::PVOID>(args, 3);
+        const auto BufferLength         = arg<nt::PULONG>(args, 4);
+        const auto RequiredBufferLength = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[316]);
@@ -6224,11 +7570,15 @@ opt<bpid_t> nt::syscalls::register_ZwQueryMutant(proc_t proc, const on_ZwQueryMu
     {
         auto& core = d_->core;
 
-        const auto MutantHandle            = arg<nt::HANDLE>(core, 0);
-        const auto MutantInformationClass  = arg<nt::MUTANT_INFORMATION_CLASS>(core, 1);
-        const auto MutantInformation       = arg<nt::PVOID>(core, 2);
-        const auto MutantInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength            = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MutantHandle            = arg<nt::HANDLE>(args, 0);
+        const auto MutantInformationClass  = arg<nt::MUTANT_INFORMATION_CLASS>(args, 1);
+        const auto MutantInformation       = arg<nt::PVOID>(args, 2);
+        const auto MutantInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength            = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[317]);
@@ -6243,11 +7593,15 @@ opt<bpid_t> nt::syscalls::register_ZwQueryObject(proc_t proc, const on_ZwQueryOb
     {
         auto& core = d_->core;
 
-        const auto Handle                  = arg<nt::HANDLE>(core, 0);
-        const auto ObjectInformationClass  = arg<nt::OBJECT_INFORMATION_CLASS>(core, 1);
-        const auto ObjectInformation       = arg<nt::PVOID>(core, 2);
-        const auto ObjectInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength            = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle                  = arg<nt::HANDLE>(args, 0);
+        const auto ObjectInformationClass  = arg<nt::OBJECT_INFORMATION_CLASS>(args, 1);
+        const auto ObjectInformation       = arg<nt::PVOID>(args, 2);
+        const auto ObjectInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength            = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[318]);
@@ -6262,12 +7616,16 @@ opt<bpid_t> nt::syscalls::register_ZwQuerySecurityAttributesToken(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto TokenHandle        = arg<nt::HANDLE>(core, 0);
-        const auto Attributes         = arg<nt::PUNICODE_STRING>(core, 1);
-        const auto NumberOfAttributes = arg<nt::ULONG>(core, 2);
-        const auto Buffer             = arg<nt::PVOID>(core, 3);
-        const auto Length             = arg<nt::ULONG>(core, 4);
-        const auto ReturnLength       = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle        = arg<nt::HANDLE>(args, 0);
+        const auto Attributes         = arg<nt::PUNICODE_STRING>(args, 1);
+        const auto NumberOfAttributes = arg<nt::ULONG>(args, 2);
+        const auto Buffer             = arg<nt::PVOID>(args, 3);
+        const auto Length             = arg<nt::ULONG>(args, 4);
+        const auto ReturnLength       = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[319]);
@@ -6282,11 +7640,15 @@ opt<bpid_t> nt::syscalls::register_ZwQuerySemaphore(proc_t proc, const on_ZwQuer
     {
         auto& core = d_->core;
 
-        const auto SemaphoreHandle            = arg<nt::HANDLE>(core, 0);
-        const auto SemaphoreInformationClass  = arg<nt::SEMAPHORE_INFORMATION_CLASS>(core, 1);
-        const auto SemaphoreInformation       = arg<nt::PVOID>(core, 2);
-        const auto SemaphoreInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength               = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SemaphoreHandle            = arg<nt::HANDLE>(args, 0);
+        const auto SemaphoreInformationClass  = arg<nt::SEMAPHORE_INFORMATION_CLASS>(args, 1);
+        const auto SemaphoreInformation       = arg<nt::PVOID>(args, 2);
+        const auto SemaphoreInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength               = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[320]);
@@ -6301,7 +7663,11 @@ opt<bpid_t> nt::syscalls::register_ZwQuerySystemTime(proc_t proc, const on_ZwQue
     {
         auto& core = d_->core;
 
-        const auto SystemTime = arg<nt::PLARGE_INTEGER>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemTime = arg<nt::PLARGE_INTEGER>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[321]);
@@ -6316,11 +7682,15 @@ opt<bpid_t> nt::syscalls::register_ZwQueryTimer(proc_t proc, const on_ZwQueryTim
     {
         auto& core = d_->core;
 
-        const auto TimerHandle            = arg<nt::HANDLE>(core, 0);
-        const auto TimerInformationClass  = arg<nt::TIMER_INFORMATION_CLASS>(core, 1);
-        const auto TimerInformation       = arg<nt::PVOID>(core, 2);
-        const auto TimerInformationLength = arg<nt::ULONG>(core, 3);
-        const auto ReturnLength           = arg<nt::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle            = arg<nt::HANDLE>(args, 0);
+        const auto TimerInformationClass  = arg<nt::TIMER_INFORMATION_CLASS>(args, 1);
+        const auto TimerInformation       = arg<nt::PVOID>(args, 2);
+        const auto TimerInformationLength = arg<nt::ULONG>(args, 3);
+        const auto ReturnLength           = arg<nt::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[322]);
@@ -6335,9 +7705,13 @@ opt<bpid_t> nt::syscalls::register_ZwQueryTimerResolution(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto MaximumTime = arg<nt::PULONG>(core, 0);
-        const auto MinimumTime = arg<nt::PULONG>(core, 1);
-        const auto CurrentTime = arg<nt::PULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MaximumTime = arg<nt::PULONG>(args, 0);
+        const auto MinimumTime = arg<nt::PULONG>(args, 1);
+        const auto CurrentTime = arg<nt::PULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[323]);
@@ -6352,12 +7726,16 @@ opt<bpid_t> nt::syscalls::register_ZwQueryVirtualMemory(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle           = arg<nt::HANDLE>(core, 0);
-        const auto BaseAddress             = arg<nt::PVOID>(core, 1);
-        const auto MemoryInformationClass  = arg<nt::MEMORY_INFORMATION_CLASS>(core, 2);
-        const auto MemoryInformation       = arg<nt::PVOID>(core, 3);
-        const auto MemoryInformationLength = arg<nt::SIZE_T>(core, 4);
-        const auto ReturnLength            = arg<nt::PSIZE_T>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle           = arg<nt::HANDLE>(args, 0);
+        const auto BaseAddress             = arg<nt::PVOID>(args, 1);
+        const auto MemoryInformationClass  = arg<nt::MEMORY_INFORMATION_CLASS>(args, 2);
+        const auto MemoryInformation       = arg<nt::PVOID>(args, 3);
+        const auto MemoryInformationLength = arg<nt::SIZE_T>(args, 4);
+        const auto ReturnLength            = arg<nt::PSIZE_T>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[324]);
@@ -6372,11 +7750,15 @@ opt<bpid_t> nt::syscalls::register_ZwQueryVolumeInformationFile(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto FileHandle         = arg<nt::HANDLE>(core, 0);
-        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(core, 1);
-        const auto FsInformation      = arg<nt::PVOID>(core, 2);
-        const auto Length             = arg<nt::ULONG>(core, 3);
-        const auto FsInformationClass = arg<nt::FS_INFORMATION_CLASS>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle         = arg<nt::HANDLE>(args, 0);
+        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(args, 1);
+        const auto FsInformation      = arg<nt::PVOID>(args, 2);
+        const auto Length             = arg<nt::ULONG>(args, 3);
+        const auto FsInformationClass = arg<nt::FS_INFORMATION_CLASS>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[325]);
@@ -6391,9 +7773,13 @@ opt<bpid_t> nt::syscalls::register_ZwRaiseException(proc_t proc, const on_ZwRais
     {
         auto& core = d_->core;
 
-        const auto ExceptionRecord = arg<nt::PEXCEPTION_RECORD>(core, 0);
-        const auto ContextRecord   = arg<nt::PCONTEXT>(core, 1);
-        const auto FirstChance     = arg<nt::BOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ExceptionRecord = arg<nt::PEXCEPTION_RECORD>(args, 0);
+        const auto ContextRecord   = arg<nt::PCONTEXT>(args, 1);
+        const auto FirstChance     = arg<nt::BOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[326]);
@@ -6408,15 +7794,19 @@ opt<bpid_t> nt::syscalls::register_ZwReadFileScatter(proc_t proc, const on_ZwRea
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<nt::HANDLE>(core, 0);
-        const auto Event         = arg<nt::HANDLE>(core, 1);
-        const auto ApcRoutine    = arg<nt::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext    = arg<nt::PVOID>(core, 3);
-        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(core, 4);
-        const auto SegmentArray  = arg<nt::PFILE_SEGMENT_ELEMENT>(core, 5);
-        const auto Length        = arg<nt::ULONG>(core, 6);
-        const auto ByteOffset    = arg<nt::PLARGE_INTEGER>(core, 7);
-        const auto Key           = arg<nt::PULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<nt::HANDLE>(args, 0);
+        const auto Event         = arg<nt::HANDLE>(args, 1);
+        const auto ApcRoutine    = arg<nt::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext    = arg<nt::PVOID>(args, 3);
+        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(args, 4);
+        const auto SegmentArray  = arg<nt::PFILE_SEGMENT_ELEMENT>(args, 5);
+        const auto Length        = arg<nt::ULONG>(args, 6);
+        const auto ByteOffset    = arg<nt::PLARGE_INTEGER>(args, 7);
+        const auto Key           = arg<nt::PULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[327]);
@@ -6431,8 +7821,12 @@ opt<bpid_t> nt::syscalls::register_ZwReadOnlyEnlistment(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<nt::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<nt::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[328]);
@@ -6447,11 +7841,15 @@ opt<bpid_t> nt::syscalls::register_ZwReadVirtualMemory(proc_t proc, const on_ZwR
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle     = arg<nt::HANDLE>(core, 0);
-        const auto BaseAddress       = arg<nt::PVOID>(core, 1);
-        const auto Buffer            = arg<nt::PVOID>(core, 2);
-        const auto BufferSize        = arg<nt::SIZE_T>(core, 3);
-        const auto NumberOfBytesRead = arg<nt::PSIZE_T>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle     = arg<nt::HANDLE>(args, 0);
+        const auto BaseAddress       = arg<nt::PVOID>(args, 1);
+        const auto Buffer            = arg<nt::PVOID>(args, 2);
+        const auto BufferSize        = arg<nt::SIZE_T>(args, 3);
+        const auto NumberOfBytesRead = arg<nt::PSIZE_T>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[329]);
@@ -6466,8 +7864,12 @@ opt<bpid_t> nt::syscalls::register_ZwRecoverEnlistment(proc_t proc, const on_ZwR
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<nt::HANDLE>(core, 0);
-        const auto EnlistmentKey    = arg<nt::PVOID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<nt::HANDLE>(args, 0);
+        const auto EnlistmentKey    = arg<nt::PVOID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[330]);
@@ -6482,7 +7884,11 @@ opt<bpid_t> nt::syscalls::register_ZwRecoverResourceManager(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[331]);
@@ -6497,8 +7903,12 @@ opt<bpid_t> nt::syscalls::register_ZwReleaseMutant(proc_t proc, const on_ZwRelea
     {
         auto& core = d_->core;
 
-        const auto MutantHandle  = arg<nt::HANDLE>(core, 0);
-        const auto PreviousCount = arg<nt::PLONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MutantHandle  = arg<nt::HANDLE>(args, 0);
+        const auto PreviousCount = arg<nt::PLONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[332]);
@@ -6513,9 +7923,13 @@ opt<bpid_t> nt::syscalls::register_ZwReleaseSemaphore(proc_t proc, const on_ZwRe
     {
         auto& core = d_->core;
 
-        const auto SemaphoreHandle = arg<nt::HANDLE>(core, 0);
-        const auto ReleaseCount    = arg<nt::LONG>(core, 1);
-        const auto PreviousCount   = arg<nt::PLONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SemaphoreHandle = arg<nt::HANDLE>(args, 0);
+        const auto ReleaseCount    = arg<nt::LONG>(args, 1);
+        const auto PreviousCount   = arg<nt::PLONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[333]);
@@ -6530,11 +7944,15 @@ opt<bpid_t> nt::syscalls::register_ZwRemoveIoCompletion(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle = arg<nt::HANDLE>(core, 0);
-        const auto STARKeyContext     = arg<nt::PVOID>(core, 1);
-        const auto STARApcContext     = arg<nt::PVOID>(core, 2);
-        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(core, 3);
-        const auto Timeout            = arg<nt::PLARGE_INTEGER>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle = arg<nt::HANDLE>(args, 0);
+        const auto STARKeyContext     = arg<nt::PVOID>(args, 1);
+        const auto STARApcContext     = arg<nt::PVOID>(args, 2);
+        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(args, 3);
+        const auto Timeout            = arg<nt::PLARGE_INTEGER>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[334]);
@@ -6549,12 +7967,16 @@ opt<bpid_t> nt::syscalls::register_ZwRemoveIoCompletionEx(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle      = arg<nt::HANDLE>(core, 0);
-        const auto IoCompletionInformation = arg<nt::PFILE_IO_COMPLETION_INFORMATION>(core, 1);
-        const auto Count                   = arg<nt::ULONG>(core, 2);
-        const auto NumEntriesRemoved       = arg<nt::PULONG>(core, 3);
-        const auto Timeout                 = arg<nt::PLARGE_INTEGER>(core, 4);
-        const auto Alertable               = arg<nt::BOOLEAN>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle      = arg<nt::HANDLE>(args, 0);
+        const auto IoCompletionInformation = arg<nt::PFILE_IO_COMPLETION_INFORMATION>(args, 1);
+        const auto Count                   = arg<nt::ULONG>(args, 2);
+        const auto NumEntriesRemoved       = arg<nt::PULONG>(args, 3);
+        const auto Timeout                 = arg<nt::PLARGE_INTEGER>(args, 4);
+        const auto Alertable               = arg<nt::BOOLEAN>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[335]);
@@ -6569,8 +7991,12 @@ opt<bpid_t> nt::syscalls::register_ZwRemoveProcessDebug(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle     = arg<nt::HANDLE>(core, 0);
-        const auto DebugObjectHandle = arg<nt::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle     = arg<nt::HANDLE>(args, 0);
+        const auto DebugObjectHandle = arg<nt::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[336]);
@@ -6585,10 +8011,14 @@ opt<bpid_t> nt::syscalls::register_ZwReplyWaitReceivePort(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto PortHandle      = arg<nt::HANDLE>(core, 0);
-        const auto STARPortContext = arg<nt::PVOID>(core, 1);
-        const auto ReplyMessage    = arg<nt::PPORT_MESSAGE>(core, 2);
-        const auto ReceiveMessage  = arg<nt::PPORT_MESSAGE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle      = arg<nt::HANDLE>(args, 0);
+        const auto STARPortContext = arg<nt::PVOID>(args, 1);
+        const auto ReplyMessage    = arg<nt::PPORT_MESSAGE>(args, 2);
+        const auto ReceiveMessage  = arg<nt::PPORT_MESSAGE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[337]);
@@ -6603,11 +8033,15 @@ opt<bpid_t> nt::syscalls::register_ZwReplyWaitReceivePortEx(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto PortHandle      = arg<nt::HANDLE>(core, 0);
-        const auto STARPortContext = arg<nt::PVOID>(core, 1);
-        const auto ReplyMessage    = arg<nt::PPORT_MESSAGE>(core, 2);
-        const auto ReceiveMessage  = arg<nt::PPORT_MESSAGE>(core, 3);
-        const auto Timeout         = arg<nt::PLARGE_INTEGER>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle      = arg<nt::HANDLE>(args, 0);
+        const auto STARPortContext = arg<nt::PVOID>(args, 1);
+        const auto ReplyMessage    = arg<nt::PPORT_MESSAGE>(args, 2);
+        const auto ReceiveMessage  = arg<nt::PPORT_MESSAGE>(args, 3);
+        const auto Timeout         = arg<nt::PLARGE_INTEGER>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[338]);
@@ -6622,9 +8056,13 @@ opt<bpid_t> nt::syscalls::register_ZwRequestWaitReplyPort(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto PortHandle     = arg<nt::HANDLE>(core, 0);
-        const auto RequestMessage = arg<nt::PPORT_MESSAGE>(core, 1);
-        const auto ReplyMessage   = arg<nt::PPORT_MESSAGE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle     = arg<nt::HANDLE>(args, 0);
+        const auto RequestMessage = arg<nt::PPORT_MESSAGE>(args, 1);
+        const auto ReplyMessage   = arg<nt::PPORT_MESSAGE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[339]);
@@ -6639,8 +8077,12 @@ opt<bpid_t> nt::syscalls::register_ZwResetEvent(proc_t proc, const on_ZwResetEve
     {
         auto& core = d_->core;
 
-        const auto EventHandle   = arg<nt::HANDLE>(core, 0);
-        const auto PreviousState = arg<nt::PLONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle   = arg<nt::HANDLE>(args, 0);
+        const auto PreviousState = arg<nt::PLONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[340]);
@@ -6655,9 +8097,13 @@ opt<bpid_t> nt::syscalls::register_ZwResetWriteWatch(proc_t proc, const on_ZwRes
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<nt::HANDLE>(core, 0);
-        const auto BaseAddress   = arg<nt::PVOID>(core, 1);
-        const auto RegionSize    = arg<nt::SIZE_T>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<nt::HANDLE>(args, 0);
+        const auto BaseAddress   = arg<nt::PVOID>(args, 1);
+        const auto RegionSize    = arg<nt::SIZE_T>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[341]);
@@ -6672,7 +8118,11 @@ opt<bpid_t> nt::syscalls::register_ZwResumeProcess(proc_t proc, const on_ZwResum
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[342]);
@@ -6687,8 +8137,12 @@ opt<bpid_t> nt::syscalls::register_ZwResumeThread(proc_t proc, const on_ZwResume
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle         = arg<nt::HANDLE>(core, 0);
-        const auto PreviousSuspendCount = arg<nt::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle         = arg<nt::HANDLE>(args, 0);
+        const auto PreviousSuspendCount = arg<nt::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[343]);
@@ -6703,8 +8157,12 @@ opt<bpid_t> nt::syscalls::register_ZwRollbackComplete(proc_t proc, const on_ZwRo
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<nt::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<nt::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[344]);
@@ -6719,8 +8177,12 @@ opt<bpid_t> nt::syscalls::register_ZwRollbackTransaction(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle = arg<nt::HANDLE>(core, 0);
-        const auto Wait              = arg<nt::BOOLEAN>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle = arg<nt::HANDLE>(args, 0);
+        const auto Wait              = arg<nt::BOOLEAN>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[345]);
@@ -6735,9 +8197,13 @@ opt<bpid_t> nt::syscalls::register_ZwSaveMergedKeys(proc_t proc, const on_ZwSave
     {
         auto& core = d_->core;
 
-        const auto HighPrecedenceKeyHandle = arg<nt::HANDLE>(core, 0);
-        const auto LowPrecedenceKeyHandle  = arg<nt::HANDLE>(core, 1);
-        const auto FileHandle              = arg<nt::HANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto HighPrecedenceKeyHandle = arg<nt::HANDLE>(args, 0);
+        const auto LowPrecedenceKeyHandle  = arg<nt::HANDLE>(args, 1);
+        const auto FileHandle              = arg<nt::HANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[346]);
@@ -6765,8 +8231,12 @@ opt<bpid_t> nt::syscalls::register_ZwSetBootEntryOrder(proc_t proc, const on_ZwS
     {
         auto& core = d_->core;
 
-        const auto Ids   = arg<nt::PULONG>(core, 0);
-        const auto Count = arg<nt::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Ids   = arg<nt::PULONG>(args, 0);
+        const auto Count = arg<nt::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[348]);
@@ -6781,9 +8251,13 @@ opt<bpid_t> nt::syscalls::register_ZwSetDebugFilterState(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto ComponentId = arg<nt::ULONG>(core, 0);
-        const auto Level       = arg<nt::ULONG>(core, 1);
-        const auto State       = arg<nt::BOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ComponentId = arg<nt::ULONG>(args, 0);
+        const auto Level       = arg<nt::ULONG>(args, 1);
+        const auto State       = arg<nt::BOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[349]);
@@ -6798,7 +8272,11 @@ opt<bpid_t> nt::syscalls::register_ZwSetDefaultUILanguage(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto DefaultUILanguageId = arg<nt::LANGID>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DefaultUILanguageId = arg<nt::LANGID>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[350]);
@@ -6813,10 +8291,14 @@ opt<bpid_t> nt::syscalls::register_ZwSetEaFile(proc_t proc, const on_ZwSetEaFile
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<nt::HANDLE>(core, 0);
-        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(core, 1);
-        const auto Buffer        = arg<nt::PVOID>(core, 2);
-        const auto Length        = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<nt::HANDLE>(args, 0);
+        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(args, 1);
+        const auto Buffer        = arg<nt::PVOID>(args, 2);
+        const auto Length        = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[351]);
@@ -6831,8 +8313,12 @@ opt<bpid_t> nt::syscalls::register_ZwSetEvent(proc_t proc, const on_ZwSetEvent_f
     {
         auto& core = d_->core;
 
-        const auto EventHandle   = arg<nt::HANDLE>(core, 0);
-        const auto PreviousState = arg<nt::PLONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle   = arg<nt::HANDLE>(args, 0);
+        const auto PreviousState = arg<nt::PLONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[352]);
@@ -6847,7 +8333,11 @@ opt<bpid_t> nt::syscalls::register_ZwSetEventBoostPriority(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto EventHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[353]);
@@ -6862,7 +8352,11 @@ opt<bpid_t> nt::syscalls::register_ZwSetHighWaitLowEventPair(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[354]);
@@ -6877,11 +8371,15 @@ opt<bpid_t> nt::syscalls::register_ZwSetInformationFile(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto FileHandle           = arg<nt::HANDLE>(core, 0);
-        const auto IoStatusBlock        = arg<nt::PIO_STATUS_BLOCK>(core, 1);
-        const auto FileInformation      = arg<nt::PVOID>(core, 2);
-        const auto Length               = arg<nt::ULONG>(core, 3);
-        const auto FileInformationClass = arg<nt::FILE_INFORMATION_CLASS>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle           = arg<nt::HANDLE>(args, 0);
+        const auto IoStatusBlock        = arg<nt::PIO_STATUS_BLOCK>(args, 1);
+        const auto FileInformation      = arg<nt::PVOID>(args, 2);
+        const auto Length               = arg<nt::ULONG>(args, 3);
+        const auto FileInformationClass = arg<nt::FILE_INFORMATION_CLASS>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[355]);
@@ -6896,10 +8394,14 @@ opt<bpid_t> nt::syscalls::register_ZwSetInformationJobObject(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto JobHandle                  = arg<nt::HANDLE>(core, 0);
-        const auto JobObjectInformationClass  = arg<nt::JOBOBJECTINFOCLASS>(core, 1);
-        const auto JobObjectInformation       = arg<nt::PVOID>(core, 2);
-        const auto JobObjectInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle                  = arg<nt::HANDLE>(args, 0);
+        const auto JobObjectInformationClass  = arg<nt::JOBOBJECTINFOCLASS>(args, 1);
+        const auto JobObjectInformation       = arg<nt::PVOID>(args, 2);
+        const auto JobObjectInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[356]);
@@ -6914,10 +8416,14 @@ opt<bpid_t> nt::syscalls::register_ZwSetInformationKey(proc_t proc, const on_ZwS
     {
         auto& core = d_->core;
 
-        const auto KeyHandle               = arg<nt::HANDLE>(core, 0);
-        const auto KeySetInformationClass  = arg<nt::KEY_SET_INFORMATION_CLASS>(core, 1);
-        const auto KeySetInformation       = arg<nt::PVOID>(core, 2);
-        const auto KeySetInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle               = arg<nt::HANDLE>(args, 0);
+        const auto KeySetInformationClass  = arg<nt::KEY_SET_INFORMATION_CLASS>(args, 1);
+        const auto KeySetInformation       = arg<nt::PVOID>(args, 2);
+        const auto KeySetInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[357]);
@@ -6932,10 +8438,14 @@ opt<bpid_t> nt::syscalls::register_ZwSetInformationTransactionManager(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto TmHandle                            = arg<nt::HANDLE>(core, 0);
-        const auto TransactionManagerInformationClass  = arg<nt::TRANSACTIONMANAGER_INFORMATION_CLASS>(core, 1);
-        const auto TransactionManagerInformation       = arg<nt::PVOID>(core, 2);
-        const auto TransactionManagerInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TmHandle                            = arg<nt::HANDLE>(args, 0);
+        const auto TransactionManagerInformationClass  = arg<nt::TRANSACTIONMANAGER_INFORMATION_CLASS>(args, 1);
+        const auto TransactionManagerInformation       = arg<nt::PVOID>(args, 2);
+        const auto TransactionManagerInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[358]);
@@ -6950,11 +8460,15 @@ opt<bpid_t> nt::syscalls::register_ZwSetIoCompletion(proc_t proc, const on_ZwSet
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle  = arg<nt::HANDLE>(core, 0);
-        const auto KeyContext          = arg<nt::PVOID>(core, 1);
-        const auto ApcContext          = arg<nt::PVOID>(core, 2);
-        const auto IoStatus            = arg<nt::NTSTATUS>(core, 3);
-        const auto IoStatusInformation = arg<nt::ULONG_PTR>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle  = arg<nt::HANDLE>(args, 0);
+        const auto KeyContext          = arg<nt::PVOID>(args, 1);
+        const auto ApcContext          = arg<nt::PVOID>(args, 2);
+        const auto IoStatus            = arg<nt::NTSTATUS>(args, 3);
+        const auto IoStatusInformation = arg<nt::ULONG_PTR>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[359]);
@@ -6969,12 +8483,16 @@ opt<bpid_t> nt::syscalls::register_ZwSetIoCompletionEx(proc_t proc, const on_ZwS
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle        = arg<nt::HANDLE>(core, 0);
-        const auto IoCompletionReserveHandle = arg<nt::HANDLE>(core, 1);
-        const auto KeyContext                = arg<nt::PVOID>(core, 2);
-        const auto ApcContext                = arg<nt::PVOID>(core, 3);
-        const auto IoStatus                  = arg<nt::NTSTATUS>(core, 4);
-        const auto IoStatusInformation       = arg<nt::ULONG_PTR>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle        = arg<nt::HANDLE>(args, 0);
+        const auto IoCompletionReserveHandle = arg<nt::HANDLE>(args, 1);
+        const auto KeyContext                = arg<nt::PVOID>(args, 2);
+        const auto ApcContext                = arg<nt::PVOID>(args, 3);
+        const auto IoStatus                  = arg<nt::NTSTATUS>(args, 4);
+        const auto IoStatusInformation       = arg<nt::ULONG_PTR>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[360]);
@@ -6989,12 +8507,16 @@ opt<bpid_t> nt::syscalls::register_ZwSetLdtEntries(proc_t proc, const on_ZwSetLd
     {
         auto& core = d_->core;
 
-        const auto Selector0 = arg<nt::ULONG>(core, 0);
-        const auto Entry0Low = arg<nt::ULONG>(core, 1);
-        const auto Entry0Hi  = arg<nt::ULONG>(core, 2);
-        const auto Selector1 = arg<nt::ULONG>(core, 3);
-        const auto Entry1Low = arg<nt::ULONG>(core, 4);
-        const auto Entry1Hi  = arg<nt::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Selector0 = arg<nt::ULONG>(args, 0);
+        const auto Entry0Low = arg<nt::ULONG>(args, 1);
+        const auto Entry0Hi  = arg<nt::ULONG>(args, 2);
+        const auto Selector1 = arg<nt::ULONG>(args, 3);
+        const auto Entry1Low = arg<nt::ULONG>(args, 4);
+        const auto Entry1Hi  = arg<nt::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[361]);
@@ -7009,7 +8531,11 @@ opt<bpid_t> nt::syscalls::register_ZwSetLowEventPair(proc_t proc, const on_ZwSet
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[362]);
@@ -7024,7 +8550,11 @@ opt<bpid_t> nt::syscalls::register_ZwSetLowWaitHighEventPair(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[363]);
@@ -7039,10 +8569,14 @@ opt<bpid_t> nt::syscalls::register_ZwSetQuotaInformationFile(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<nt::HANDLE>(core, 0);
-        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(core, 1);
-        const auto Buffer        = arg<nt::PVOID>(core, 2);
-        const auto Length        = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<nt::HANDLE>(args, 0);
+        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(args, 1);
+        const auto Buffer        = arg<nt::PVOID>(args, 2);
+        const auto Length        = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[364]);
@@ -7057,8 +8591,12 @@ opt<bpid_t> nt::syscalls::register_ZwSetSystemEnvironmentValue(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto VariableName  = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto VariableValue = arg<nt::PUNICODE_STRING>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto VariableName  = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto VariableValue = arg<nt::PUNICODE_STRING>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[365]);
@@ -7073,11 +8611,15 @@ opt<bpid_t> nt::syscalls::register_ZwSetSystemEnvironmentValueEx(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto VariableName = arg<nt::PUNICODE_STRING>(core, 0);
-        const auto VendorGuid   = arg<nt::LPGUID>(core, 1);
-        const auto Value        = arg<nt::PVOID>(core, 2);
-        const auto ValueLength  = arg<nt::ULONG>(core, 3);
-        const auto Attributes   = arg<nt::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto VariableName = arg<nt::PUNICODE_STRING>(args, 0);
+        const auto VendorGuid   = arg<nt::LPGUID>(args, 1);
+        const auto Value        = arg<nt::PVOID>(args, 2);
+        const auto ValueLength  = arg<nt::ULONG>(args, 3);
+        const auto Attributes   = arg<nt::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[366]);
@@ -7092,9 +8634,13 @@ opt<bpid_t> nt::syscalls::register_ZwSetSystemInformation(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto SystemInformationClass  = arg<nt::SYSTEM_INFORMATION_CLASS>(core, 0);
-        const auto SystemInformation       = arg<nt::PVOID>(core, 1);
-        const auto SystemInformationLength = arg<nt::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemInformationClass  = arg<nt::SYSTEM_INFORMATION_CLASS>(args, 0);
+        const auto SystemInformation       = arg<nt::PVOID>(args, 1);
+        const auto SystemInformationLength = arg<nt::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[367]);
@@ -7109,9 +8655,13 @@ opt<bpid_t> nt::syscalls::register_ZwSetSystemPowerState(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto SystemAction   = arg<nt::POWER_ACTION>(core, 0);
-        const auto MinSystemState = arg<nt::SYSTEM_POWER_STATE>(core, 1);
-        const auto Flags          = arg<nt::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemAction   = arg<nt::POWER_ACTION>(args, 0);
+        const auto MinSystemState = arg<nt::SYSTEM_POWER_STATE>(args, 1);
+        const auto Flags          = arg<nt::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[368]);
@@ -7126,8 +8676,12 @@ opt<bpid_t> nt::syscalls::register_ZwSetSystemTime(proc_t proc, const on_ZwSetSy
     {
         auto& core = d_->core;
 
-        const auto SystemTime   = arg<nt::PLARGE_INTEGER>(core, 0);
-        const auto PreviousTime = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemTime   = arg<nt::PLARGE_INTEGER>(args, 0);
+        const auto PreviousTime = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[369]);
@@ -7142,13 +8696,17 @@ opt<bpid_t> nt::syscalls::register_ZwSetTimer(proc_t proc, const on_ZwSetTimer_f
     {
         auto& core = d_->core;
 
-        const auto TimerHandle     = arg<nt::HANDLE>(core, 0);
-        const auto DueTime         = arg<nt::PLARGE_INTEGER>(core, 1);
-        const auto TimerApcRoutine = arg<nt::PTIMER_APC_ROUTINE>(core, 2);
-        const auto TimerContext    = arg<nt::PVOID>(core, 3);
-        const auto WakeTimer       = arg<nt::BOOLEAN>(core, 4);
-        const auto Period          = arg<nt::LONG>(core, 5);
-        const auto PreviousState   = arg<nt::PBOOLEAN>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle     = arg<nt::HANDLE>(args, 0);
+        const auto DueTime         = arg<nt::PLARGE_INTEGER>(args, 1);
+        const auto TimerApcRoutine = arg<nt::PTIMER_APC_ROUTINE>(args, 2);
+        const auto TimerContext    = arg<nt::PVOID>(args, 3);
+        const auto WakeTimer       = arg<nt::BOOLEAN>(args, 4);
+        const auto Period          = arg<nt::LONG>(args, 5);
+        const auto PreviousState   = arg<nt::PBOOLEAN>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[370]);
@@ -7163,10 +8721,14 @@ opt<bpid_t> nt::syscalls::register_ZwSetTimerEx(proc_t proc, const on_ZwSetTimer
     {
         auto& core = d_->core;
 
-        const auto TimerHandle               = arg<nt::HANDLE>(core, 0);
-        const auto TimerSetInformationClass  = arg<nt::TIMER_SET_INFORMATION_CLASS>(core, 1);
-        const auto TimerSetInformation       = arg<nt::PVOID>(core, 2);
-        const auto TimerSetInformationLength = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle               = arg<nt::HANDLE>(args, 0);
+        const auto TimerSetInformationClass  = arg<nt::TIMER_SET_INFORMATION_CLASS>(args, 1);
+        const auto TimerSetInformation       = arg<nt::PVOID>(args, 2);
+        const auto TimerSetInformationLength = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[371]);
@@ -7181,12 +8743,16 @@ opt<bpid_t> nt::syscalls::register_ZwSetValueKey(proc_t proc, const on_ZwSetValu
     {
         auto& core = d_->core;
 
-        const auto KeyHandle  = arg<nt::HANDLE>(core, 0);
-        const auto ValueName  = arg<nt::PUNICODE_STRING>(core, 1);
-        const auto TitleIndex = arg<nt::ULONG>(core, 2);
-        const auto Type       = arg<nt::ULONG>(core, 3);
-        const auto Data       = arg<nt::PVOID>(core, 4);
-        const auto DataSize   = arg<nt::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle  = arg<nt::HANDLE>(args, 0);
+        const auto ValueName  = arg<nt::PUNICODE_STRING>(args, 1);
+        const auto TitleIndex = arg<nt::ULONG>(args, 2);
+        const auto Type       = arg<nt::ULONG>(args, 3);
+        const auto Data       = arg<nt::PVOID>(args, 4);
+        const auto DataSize   = arg<nt::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[372]);
@@ -7201,11 +8767,15 @@ opt<bpid_t> nt::syscalls::register_ZwSetVolumeInformationFile(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto FileHandle         = arg<nt::HANDLE>(core, 0);
-        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(core, 1);
-        const auto FsInformation      = arg<nt::PVOID>(core, 2);
-        const auto Length             = arg<nt::ULONG>(core, 3);
-        const auto FsInformationClass = arg<nt::FS_INFORMATION_CLASS>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle         = arg<nt::HANDLE>(args, 0);
+        const auto IoStatusBlock      = arg<nt::PIO_STATUS_BLOCK>(args, 1);
+        const auto FsInformation      = arg<nt::PVOID>(args, 2);
+        const auto Length             = arg<nt::ULONG>(args, 3);
+        const auto FsInformationClass = arg<nt::FS_INFORMATION_CLASS>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[373]);
@@ -7220,7 +8790,11 @@ opt<bpid_t> nt::syscalls::register_ZwShutdownSystem(proc_t proc, const on_ZwShut
     {
         auto& core = d_->core;
 
-        const auto Action = arg<nt::SHUTDOWN_ACTION>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Action = arg<nt::SHUTDOWN_ACTION>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[374]);
@@ -7235,8 +8809,12 @@ opt<bpid_t> nt::syscalls::register_ZwShutdownWorkerFactory(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle    = arg<nt::HANDLE>(core, 0);
-        const auto STARPendingWorkerCount = arg<nt::LONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle    = arg<nt::HANDLE>(args, 0);
+        const auto STARPendingWorkerCount = arg<nt::LONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[375]);
@@ -7251,10 +8829,14 @@ opt<bpid_t> nt::syscalls::register_ZwSignalAndWaitForSingleObject(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto SignalHandle = arg<nt::HANDLE>(core, 0);
-        const auto WaitHandle   = arg<nt::HANDLE>(core, 1);
-        const auto Alertable    = arg<nt::BOOLEAN>(core, 2);
-        const auto Timeout      = arg<nt::PLARGE_INTEGER>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SignalHandle = arg<nt::HANDLE>(args, 0);
+        const auto WaitHandle   = arg<nt::HANDLE>(args, 1);
+        const auto Alertable    = arg<nt::BOOLEAN>(args, 2);
+        const auto Timeout      = arg<nt::PLARGE_INTEGER>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[376]);
@@ -7269,8 +8851,12 @@ opt<bpid_t> nt::syscalls::register_ZwSinglePhaseReject(proc_t proc, const on_ZwS
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<nt::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<nt::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<nt::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[377]);
@@ -7285,7 +8871,11 @@ opt<bpid_t> nt::syscalls::register_ZwStartProfile(proc_t proc, const on_ZwStartP
     {
         auto& core = d_->core;
 
-        const auto ProfileHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProfileHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[378]);
@@ -7300,7 +8890,11 @@ opt<bpid_t> nt::syscalls::register_ZwStopProfile(proc_t proc, const on_ZwStopPro
     {
         auto& core = d_->core;
 
-        const auto ProfileHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProfileHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[379]);
@@ -7315,7 +8909,11 @@ opt<bpid_t> nt::syscalls::register_ZwSuspendProcess(proc_t proc, const on_ZwSusp
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[380]);
@@ -7330,12 +8928,16 @@ opt<bpid_t> nt::syscalls::register_ZwSystemDebugControl(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto Command            = arg<nt::SYSDBG_COMMAND>(core, 0);
-        const auto InputBuffer        = arg<nt::PVOID>(core, 1);
-        const auto InputBufferLength  = arg<nt::ULONG>(core, 2);
-        const auto OutputBuffer       = arg<nt::PVOID>(core, 3);
-        const auto OutputBufferLength = arg<nt::ULONG>(core, 4);
-        const auto ReturnLength       = arg<nt::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Command            = arg<nt::SYSDBG_COMMAND>(args, 0);
+        const auto InputBuffer        = arg<nt::PVOID>(args, 1);
+        const auto InputBufferLength  = arg<nt::ULONG>(args, 2);
+        const auto OutputBuffer       = arg<nt::PVOID>(args, 3);
+        const auto OutputBufferLength = arg<nt::ULONG>(args, 4);
+        const auto ReturnLength       = arg<nt::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[381]);
@@ -7350,8 +8952,12 @@ opt<bpid_t> nt::syscalls::register_ZwTerminateProcess(proc_t proc, const on_ZwTe
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<nt::HANDLE>(core, 0);
-        const auto ExitStatus    = arg<nt::NTSTATUS>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<nt::HANDLE>(args, 0);
+        const auto ExitStatus    = arg<nt::NTSTATUS>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[382]);
@@ -7418,7 +9024,11 @@ opt<bpid_t> nt::syscalls::register_ZwUnloadDriver(proc_t proc, const on_ZwUnload
     {
         auto& core = d_->core;
 
-        const auto DriverServiceName = arg<nt::PUNICODE_STRING>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DriverServiceName = arg<nt::PUNICODE_STRING>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[387]);
@@ -7433,8 +9043,12 @@ opt<bpid_t> nt::syscalls::register_ZwUnloadKeyEx(proc_t proc, const on_ZwUnloadK
     {
         auto& core = d_->core;
 
-        const auto TargetKey = arg<nt::POBJECT_ATTRIBUTES>(core, 0);
-        const auto Event     = arg<nt::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey = arg<nt::POBJECT_ATTRIBUTES>(args, 0);
+        const auto Event     = arg<nt::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[388]);
@@ -7449,11 +9063,15 @@ opt<bpid_t> nt::syscalls::register_ZwUnlockFile(proc_t proc, const on_ZwUnlockFi
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<nt::HANDLE>(core, 0);
-        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(core, 1);
-        const auto ByteOffset    = arg<nt::PLARGE_INTEGER>(core, 2);
-        const auto Length        = arg<nt::PLARGE_INTEGER>(core, 3);
-        const auto Key           = arg<nt::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<nt::HANDLE>(args, 0);
+        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(args, 1);
+        const auto ByteOffset    = arg<nt::PLARGE_INTEGER>(args, 2);
+        const auto Length        = arg<nt::PLARGE_INTEGER>(args, 3);
+        const auto Key           = arg<nt::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[389]);
@@ -7468,10 +9086,14 @@ opt<bpid_t> nt::syscalls::register_ZwUnlockVirtualMemory(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<nt::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<nt::PVOID>(core, 1);
-        const auto RegionSize      = arg<nt::PSIZE_T>(core, 2);
-        const auto MapType         = arg<nt::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<nt::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<nt::PVOID>(args, 1);
+        const auto RegionSize      = arg<nt::PSIZE_T>(args, 2);
+        const auto MapType         = arg<nt::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[390]);
@@ -7486,8 +9108,12 @@ opt<bpid_t> nt::syscalls::register_ZwVdmControl(proc_t proc, const on_ZwVdmContr
     {
         auto& core = d_->core;
 
-        const auto Service     = arg<nt::VDMSERVICECLASS>(core, 0);
-        const auto ServiceData = arg<nt::PVOID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Service     = arg<nt::VDMSERVICECLASS>(args, 0);
+        const auto ServiceData = arg<nt::PVOID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[391]);
@@ -7502,10 +9128,14 @@ opt<bpid_t> nt::syscalls::register_ZwWaitForDebugEvent(proc_t proc, const on_ZwW
     {
         auto& core = d_->core;
 
-        const auto DebugObjectHandle = arg<nt::HANDLE>(core, 0);
-        const auto Alertable         = arg<nt::BOOLEAN>(core, 1);
-        const auto Timeout           = arg<nt::PLARGE_INTEGER>(core, 2);
-        const auto WaitStateChange   = arg<nt::PDBGUI_WAIT_STATE_CHANGE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DebugObjectHandle = arg<nt::HANDLE>(args, 0);
+        const auto Alertable         = arg<nt::BOOLEAN>(args, 1);
+        const auto Timeout           = arg<nt::PLARGE_INTEGER>(args, 2);
+        const auto WaitStateChange   = arg<nt::PDBGUI_WAIT_STATE_CHANGE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[392]);
@@ -7520,11 +9150,15 @@ opt<bpid_t> nt::syscalls::register_ZwWaitForMultipleObjects32(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Count     = arg<nt::ULONG>(core, 0);
-        const auto Handles   = arg<nt::LONG>(core, 1);
-        const auto WaitType  = arg<nt::WAIT_TYPE>(core, 2);
-        const auto Alertable = arg<nt::BOOLEAN>(core, 3);
-        const auto Timeout   = arg<nt::PLARGE_INTEGER>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Count     = arg<nt::ULONG>(args, 0);
+        const auto Handles   = arg<nt::LONG>(args, 1);
+        const auto WaitType  = arg<nt::WAIT_TYPE>(args, 2);
+        const auto Alertable = arg<nt::BOOLEAN>(args, 3);
+        const auto Timeout   = arg<nt::PLARGE_INTEGER>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[393]);
@@ -7539,8 +9173,12 @@ opt<bpid_t> nt::syscalls::register_ZwWaitForWorkViaWorkerFactory(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle = arg<nt::HANDLE>(core, 0);
-        const auto MiniPacket          = arg<nt::PFILE_IO_COMPLETION_INFORMATION>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle = arg<nt::HANDLE>(args, 0);
+        const auto MiniPacket          = arg<nt::PFILE_IO_COMPLETION_INFORMATION>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[394]);
@@ -7555,7 +9193,11 @@ opt<bpid_t> nt::syscalls::register_ZwWaitHighEventPair(proc_t proc, const on_ZwW
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<nt::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<nt::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[395]);
@@ -7570,15 +9212,19 @@ opt<bpid_t> nt::syscalls::register_ZwWriteFileGather(proc_t proc, const on_ZwWri
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<nt::HANDLE>(core, 0);
-        const auto Event         = arg<nt::HANDLE>(core, 1);
-        const auto ApcRoutine    = arg<nt::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext    = arg<nt::PVOID>(core, 3);
-        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(core, 4);
-        const auto SegmentArray  = arg<nt::PFILE_SEGMENT_ELEMENT>(core, 5);
-        const auto Length        = arg<nt::ULONG>(core, 6);
-        const auto ByteOffset    = arg<nt::PLARGE_INTEGER>(core, 7);
-        const auto Key           = arg<nt::PULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<nt::HANDLE>(args, 0);
+        const auto Event         = arg<nt::HANDLE>(args, 1);
+        const auto ApcRoutine    = arg<nt::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext    = arg<nt::PVOID>(args, 3);
+        const auto IoStatusBlock = arg<nt::PIO_STATUS_BLOCK>(args, 4);
+        const auto SegmentArray  = arg<nt::PFILE_SEGMENT_ELEMENT>(args, 5);
+        const auto Length        = arg<nt::ULONG>(args, 6);
+        const auto ByteOffset    = arg<nt::PLARGE_INTEGER>(args, 7);
+        const auto Key           = arg<nt::PULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[396]);
@@ -7593,12 +9239,16 @@ opt<bpid_t> nt::syscalls::register_ZwWriteRequestData(proc_t proc, const on_ZwWr
     {
         auto& core = d_->core;
 
-        const auto PortHandle           = arg<nt::HANDLE>(core, 0);
-        const auto Message              = arg<nt::PPORT_MESSAGE>(core, 1);
-        const auto DataEntryIndex       = arg<nt::ULONG>(core, 2);
-        const auto Buffer               = arg<nt::PVOID>(core, 3);
-        const auto BufferSize           = arg<nt::SIZE_T>(core, 4);
-        const auto NumberOfBytesWritten = arg<nt::PSIZE_T>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle           = arg<nt::HANDLE>(args, 0);
+        const auto Message              = arg<nt::PPORT_MESSAGE>(args, 1);
+        const auto DataEntryIndex       = arg<nt::ULONG>(args, 2);
+        const auto Buffer               = arg<nt::PVOID>(args, 3);
+        const auto BufferSize           = arg<nt::SIZE_T>(args, 4);
+        const auto NumberOfBytesWritten = arg<nt::PSIZE_T>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[397]);
@@ -7628,3 +9278,66 @@ opt<bpid_t> nt::syscalls::register_all(proc_t proc, const nt::syscalls::on_call_
         register_callback_with(d, bpid, proc, cfg.name, [=]{ on_call(cfg); });
     return bpid;
 }
+
+opt<bpid_t> nt::syscalls::register_filtered(proc_t proc, const filter_t& filter, const on_call_fn& on_call)
+{
+    auto& d          = *d_;
+    d.filter_bpid    = state::acquire_breakpoint_id(d.core);
+    d.filter_proc    = proc;
+    d.filter_on_call = on_call;
+    d.filter_bps.clear();
+    // only matching entries get a breakpoint, every other target stays
+    // free of foreign hits & channel traffic
+    for(const auto& cfg : g_callcfgs)
+    {
+        if(!match_filter(filter, cfg.name))
+            continue;
+
+        const auto bp = arm_filtered(d, d.filter_bpid, proc, cfg, on_call);
+        if(bp)
+            d.filter_bps.push_back({&cfg, bp, true});
+    }
+    return d.filter_bpid;
+}
+
+bool nt::syscalls::refilter(const filter_t& filter)
+{
+    auto& d = *d_;
+    if(!d.filter_on_call)
+        return false;
+
+    // flip existing breakpoints in two batches, one per direction
+    auto disarm = state::breakpoint_group(d.core);
+    auto rearm  = state::breakpoint_group_disarmed(d.core);
+    for(auto& entry : d.filter_bps)
+    {
+        const auto keep = match_filter(filter, entry.cfg->name);
+        if(keep == entry.armed)
+            continue;
+
+        state::group_add(keep ? rearm : disarm, entry.bp);
+        entry.armed = keep;
+    }
+    auto ok = state::group_disarm(d.core, disarm);
+    ok &= state::group_rearm(d.core, rearm);
+    // newly-matched targets without a breakpoint yet are armed on creation
+    for(const auto& cfg : g_callcfgs)
+    {
+        if(!match_filter(filter, cfg.name))
+            continue;
+
+        const auto it = std::find_if(d.filter_bps.begin(), d.filter_bps.end(), [&](const armed_t& entry)
+        {
+            return entry.cfg == &cfg;
+        });
+        if(it != d.filter_bps.end())
+            continue;
+
+        const auto bp = arm_filtered(d, d.filter_bpid, d.filter_proc, cfg, d.filter_on_call);
+        if(bp)
+            d.filter_bps.push_back({&cfg, bp, true});
+        else
+            ok = false;
+    }
+    return ok;
+}
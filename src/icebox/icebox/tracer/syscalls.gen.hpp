@@ -6,6 +6,9 @@
 
 #include <array>
 #include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace core { struct Core; }
 
@@ -418,9 +421,15 @@ namespace nt
 
         using on_call_fn = std::function<void(const tracer::callcfg_t& callcfg)>;
         using callcfgs_t = std::array<tracer::callcfg_t, 399>;
+        // filter entries are exact names or prefixes ending with '*'
+        using filter_t   = std::vector<std::string>;
 
         opt<bpid_t>                 register_all(proc_t proc, const on_call_fn& on_call);
+        opt<bpid_t>                 register_filtered(proc_t proc, const filter_t& filter, const on_call_fn& on_call);
+        bool                        refilter    (const filter_t& filter);
+        void                        set_sampling(std::string_view name, uint64_t one_in);
         static const callcfgs_t&    callcfgs    ();
+        static const tracer::callcfg_t* find(std::string_view name);
 
         opt<bpid_t> register_NtAcceptConnectPort                               (proc_t proc, const on_NtAcceptConnectPort_fn& on_func);
         opt<bpid_t> register_NtAddDriverEntry                                  (proc_t proc, const on_NtAddDriverEntry_fn& on_func);
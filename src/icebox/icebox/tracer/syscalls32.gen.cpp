@@ -4,12 +4,31 @@
 #include "log.hpp"
 #include "core.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace
 {
     constexpr bool g_debug = false;
 
+    // 1-in-n sampling counter, see set_sampling
+    struct sample_t
+    {
+        uint64_t one_in;
+        uint64_t count;
+    };
+
+    // one entry per filtered callcfg, flipped between armed & disarmed
+    struct armed_t
+    {
+        const tracer::callcfg_t* cfg;
+        state::Breakpoint        bp;
+        bool                     armed;
+    };
+
     constexpr wow64::syscalls32::callcfgs_t g_callcfgs =
     {{
         {"_NtAcceptConnectPort@24", 6, {{"PHANDLE", "PortHandle", sizeof(wow64::PHANDLE)}, {"PVOID", "PortContext", sizeof(wow64::PVOID)}, {"PPORT_MESSAGE", "ConnectionRequest", sizeof(wow64::PPORT_MESSAGE)}, {"BOOLEAN", "AcceptConnection", sizeof(wow64::BOOLEAN)}, {"PPORT_VIEW", "ServerView", sizeof(wow64::PPORT_VIEW)}, {"PREMOTE_PORT_VIEW", "ClientView", sizeof(wow64::PREMOTE_PORT_VIEW)}}},
@@ -412,6 +431,10 @@ namespace
         {"_ZwWaitHighEventPair@4", 1, {{"HANDLE", "EventPairHandle", sizeof(wow64::HANDLE)}}},
         {"_ZwYieldExecution@0", 0, {}},
     }};
+
+    // published to the runtime prototype registry so typed breakpoints
+    // resolve these apis by name, see tracer::break_on_prototype
+    [[maybe_unused]] const auto g_prototypes_registered = tracer::register_prototypes(&g_callcfgs[0], g_callcfgs.size());
 }
 
 struct wow64::syscalls32::Data
@@ -420,11 +443,21 @@ struct wow64::syscalls32::Data
 
     core::Core&   core;
     std::string   module;
+
+    std::unordered_map<std::string, sample_t> sampling;
+
+    // filtered registration state, see register_filtered
+    bpid_t               filter_bpid;
+    proc_t               filter_proc;
+    on_call_fn           filter_on_call;
+    std::vector<armed_t> filter_bps;
 };
 
 wow64::syscalls32::Data::Data(core::Core& core, std::string_view module)
     : core(core)
     , module(module)
+    , filter_bpid()
+    , filter_proc()
 {
 }
 
@@ -435,20 +468,80 @@ wow64::syscalls32::syscalls32(core::Core& core, std::string_view module)
 
 wow64::syscalls32::~syscalls32() = default;
 
+namespace
+{
+    // constexpr name index, no map construction at startup
+    constexpr auto g_callcfg_index = tracer::index_names(g_callcfgs);
+}
+
 const wow64::syscalls32::callcfgs_t& wow64::syscalls32::callcfgs()
 {
     return g_callcfgs;
 }
 
+const tracer::callcfg_t* wow64::syscalls32::find(std::string_view name)
+{
+    return tracer::find_name(g_callcfgs, g_callcfg_index, name);
+}
+
+void wow64::syscalls32::set_sampling(std::string_view name, uint64_t one_in)
+{
+    if(!find(name))
+    {
+        LOG(ERROR, "unknown call %.*s", static_cast<int>(name.size()), name.data());
+        return;
+    }
+
+    if(one_in < 2)
+        d_->sampling.erase(std::string{name});
+    else
+        d_->sampling[std::string{name}] = sample_t{one_in, 0};
+}
+
 namespace
 {
+    bool keep_call(wow64::syscalls32::Data& d, const char* name)
+    {
+        if(d.sampling.empty())
+            return true;
+
+        const auto it = d.sampling.find(name);
+        if(it == d.sampling.end())
+            return true;
+
+        return it->second.count++ % it->second.one_in == 0;
+    }
+
+    bool match_filter(const wow64::syscalls32::filter_t& filter, std::string_view name)
+    {
+        for(const auto& entry : filter)
+        {
+            if(!entry.empty() && entry.back() == '*')
+            {
+                const auto prefix = std::string_view{entry.data(), entry.size() - 1};
+                if(name.substr(0, prefix.size()) == prefix)
+                    return true;
+            }
+            else if(name == entry)
+                return true;
+        }
+        return false;
+    }
+
     opt<bpid_t> register_callback_with(wow64::syscalls32::Data& d, bpid_t bpid, proc_t proc, const char* name, const state::Task& on_call)
     {
         const auto addr = symbols::address(d.core, proc, d.module, name);
         if(!addr)
             return FAIL(std::nullopt, "unable to find symbole %s!%s", d.module.data(), name);
 
-        const auto bp = state::break_on_process(d.core, name, proc, *addr, on_call);
+        // sampled-out calls return before any argument read or
+        // callstack capture, the expensive part of every trigger
+        auto& data    = d;
+        const auto bp = state::break_on_process(d.core, name, proc, *addr, [&data, name, on_call]
+        {
+            if(keep_call(data, name))
+                on_call();
+        });
         if(!bp)
             return FAIL(std::nullopt, "unable to set breakpoint");
 
@@ -461,16 +554,33 @@ namespace
         return register_callback_with(d, bpid, proc, name, on_call);
     }
 
-    template <typename T>
-    T arg(core::Core& core, size_t i)
+    state::Breakpoint arm_filtered(wow64::syscalls32::Data& d, bpid_t bpid, proc_t proc, const tracer::callcfg_t& cfg, const wow64::syscalls32::on_call_fn& on_call)
     {
-        const auto arg = functions::read_arg(core, i);
-        if(!arg)
-            return {};
+        const auto addr = symbols::address(d.core, proc, d.module, cfg.name);
+        if(!addr)
+            return FAIL(nullptr, "unable to find symbole %s!%s", d.module.data(), cfg.name);
+
+        auto& data    = d;
+        const auto bp = state::break_on_process(d.core, cfg.name, proc, *addr, [&data, &cfg, on_call]
+        {
+            if(keep_call(data, cfg.name))
+                on_call(cfg);
+        });
+        if(!bp)
+            return FAIL(nullptr, "unable to set breakpoint");
+
+        state::save_breakpoint_with(d.core, bpid, bp);
+        return bp;
+    }
 
+    // registers & the stack span are fetched in one batched
+    // functions::read_args call, args are then decoded locally
+    template <typename T, size_t N>
+    T arg(const std::array<arg_t, N>& args, size_t i)
+    {
         T value = {};
-        static_assert(sizeof value <= sizeof arg->val, "invalid size");
-        memcpy(&value, &arg->val, sizeof value);
+        static_assert(sizeof value <= sizeof args[0].val, "invalid size");
+        memcpy(&value, &args[i].val, sizeof value);
         return value;
     }
 }
@@ -481,12 +591,16 @@ opt<bpid_t> wow64::syscalls32::register_NtAcceptConnectPort(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto PortHandle        = arg<wow64::PHANDLE>(core, 0);
-        const auto PortContext       = arg<wow64::PVOID>(core, 1);
-        const auto ConnectionRequest = arg<wow64::PPORT_MESSAGE>(core, 2);
-        const auto AcceptConnection  = arg<wow64::BOOLEAN>(core, 3);
-        const auto ServerView        = arg<wow64::PPORT_VIEW>(core, 4);
-        const auto ClientView        = arg<wow64::PREMOTE_PORT_VIEW>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle        = arg<wow64::PHANDLE>(args, 0);
+        const auto PortContext       = arg<wow64::PVOID>(args, 1);
+        const auto ConnectionRequest = arg<wow64::PPORT_MESSAGE>(args, 2);
+        const auto AcceptConnection  = arg<wow64::BOOLEAN>(args, 3);
+        const auto ServerView        = arg<wow64::PPORT_VIEW>(args, 4);
+        const auto ClientView        = arg<wow64::PREMOTE_PORT_VIEW>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[0]);
@@ -501,14 +615,18 @@ opt<bpid_t> wow64::syscalls32::register_NtAccessCheck(proc_t proc, const on_NtAc
     {
         auto& core = d_->core;
 
-        const auto SecurityDescriptor = arg<wow64::PSECURITY_DESCRIPTOR>(core, 0);
-        const auto ClientToken        = arg<wow64::HANDLE>(core, 1);
-        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(core, 2);
-        const auto GenericMapping     = arg<wow64::PGENERIC_MAPPING>(core, 3);
-        const auto PrivilegeSet       = arg<wow64::PPRIVILEGE_SET>(core, 4);
-        const auto PrivilegeSetLength = arg<wow64::PULONG>(core, 5);
-        const auto GrantedAccess      = arg<wow64::PACCESS_MASK>(core, 6);
-        const auto AccessStatus       = arg<wow64::PNTSTATUS>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SecurityDescriptor = arg<wow64::PSECURITY_DESCRIPTOR>(args, 0);
+        const auto ClientToken        = arg<wow64::HANDLE>(args, 1);
+        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(args, 2);
+        const auto GenericMapping     = arg<wow64::PGENERIC_MAPPING>(args, 3);
+        const auto PrivilegeSet       = arg<wow64::PPRIVILEGE_SET>(args, 4);
+        const auto PrivilegeSetLength = arg<wow64::PULONG>(args, 5);
+        const auto GrantedAccess      = arg<wow64::PACCESS_MASK>(args, 6);
+        const auto AccessStatus       = arg<wow64::PNTSTATUS>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[1]);
@@ -523,17 +641,21 @@ opt<bpid_t> wow64::syscalls32::register_NtAccessCheckByType(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto SecurityDescriptor   = arg<wow64::PSECURITY_DESCRIPTOR>(core, 0);
-        const auto PrincipalSelfSid     = arg<wow64::PSID>(core, 1);
-        const auto ClientToken          = arg<wow64::HANDLE>(core, 2);
-        const auto DesiredAccess        = arg<wow64::ACCESS_MASK>(core, 3);
-        const auto ObjectTypeList       = arg<wow64::POBJECT_TYPE_LIST>(core, 4);
-        const auto ObjectTypeListLength = arg<wow64::ULONG>(core, 5);
-        const auto GenericMapping       = arg<wow64::PGENERIC_MAPPING>(core, 6);
-        const auto PrivilegeSet         = arg<wow64::PPRIVILEGE_SET>(core, 7);
-        const auto PrivilegeSetLength   = arg<wow64::PULONG>(core, 8);
-        const auto GrantedAccess        = arg<wow64::PACCESS_MASK>(core, 9);
-        const auto AccessStatus         = arg<wow64::PNTSTATUS>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SecurityDescriptor   = arg<wow64::PSECURITY_DESCRIPTOR>(args, 0);
+        const auto PrincipalSelfSid     = arg<wow64::PSID>(args, 1);
+        const auto ClientToken          = arg<wow64::HANDLE>(args, 2);
+        const auto DesiredAccess        = arg<wow64::ACCESS_MASK>(args, 3);
+        const auto ObjectTypeList       = arg<wow64::POBJECT_TYPE_LIST>(args, 4);
+        const auto ObjectTypeListLength = arg<wow64::ULONG>(args, 5);
+        const auto GenericMapping       = arg<wow64::PGENERIC_MAPPING>(args, 6);
+        const auto PrivilegeSet         = arg<wow64::PPRIVILEGE_SET>(args, 7);
+        const auto PrivilegeSetLength   = arg<wow64::PULONG>(args, 8);
+        const auto GrantedAccess        = arg<wow64::PACCESS_MASK>(args, 9);
+        const auto AccessStatus         = arg<wow64::PNTSTATUS>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[2]);
@@ -548,22 +670,26 @@ opt<bpid_t> wow64::syscalls32::register_NtAccessCheckByTypeAndAuditAlarm(proc_t
     {
         auto& core = d_->core;
 
-        const auto SubsystemName        = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto HandleId             = arg<wow64::PVOID>(core, 1);
-        const auto ObjectTypeName       = arg<wow64::PUNICODE_STRING>(core, 2);
-        const auto ObjectName           = arg<wow64::PUNICODE_STRING>(core, 3);
-        const auto SecurityDescriptor   = arg<wow64::PSECURITY_DESCRIPTOR>(core, 4);
-        const auto PrincipalSelfSid     = arg<wow64::PSID>(core, 5);
-        const auto DesiredAccess        = arg<wow64::ACCESS_MASK>(core, 6);
-        const auto AuditType            = arg<wow64::AUDIT_EVENT_TYPE>(core, 7);
-        const auto Flags                = arg<wow64::ULONG>(core, 8);
-        const auto ObjectTypeList       = arg<wow64::POBJECT_TYPE_LIST>(core, 9);
-        const auto ObjectTypeListLength = arg<wow64::ULONG>(core, 10);
-        const auto GenericMapping       = arg<wow64::PGENERIC_MAPPING>(core, 11);
-        const auto ObjectCreation       = arg<wow64::BOOLEAN>(core, 12);
-        const auto GrantedAccess        = arg<wow64::PACCESS_MASK>(core, 13);
-        const auto AccessStatus         = arg<wow64::PNTSTATUS>(core, 14);
-        const auto GenerateOnClose      = arg<wow64::PBOOLEAN>(core, 15);
+        auto args = std::array<arg_t, 16>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName        = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto HandleId             = arg<wow64::PVOID>(args, 1);
+        const auto ObjectTypeName       = arg<wow64::PUNICODE_STRING>(args, 2);
+        const auto ObjectName           = arg<wow64::PUNICODE_STRING>(args, 3);
+        const auto SecurityDescriptor   = arg<wow64::PSECURITY_DESCRIPTOR>(args, 4);
+        const auto PrincipalSelfSid     = arg<wow64::PSID>(args, 5);
+        const auto DesiredAccess        = arg<wow64::ACCESS_MASK>(args, 6);
+        const auto AuditType            = arg<wow64::AUDIT_EVENT_TYPE>(args, 7);
+        const auto Flags                = arg<wow64::ULONG>(args, 8);
+        const auto ObjectTypeList       = arg<wow64::POBJECT_TYPE_LIST>(args, 9);
+        const auto ObjectTypeListLength = arg<wow64::ULONG>(args, 10);
+        const auto GenericMapping       = arg<wow64::PGENERIC_MAPPING>(args, 11);
+        const auto ObjectCreation       = arg<wow64::BOOLEAN>(args, 12);
+        const auto GrantedAccess        = arg<wow64::PACCESS_MASK>(args, 13);
+        const auto AccessStatus         = arg<wow64::PNTSTATUS>(args, 14);
+        const auto GenerateOnClose      = arg<wow64::PBOOLEAN>(args, 15);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[3]);
@@ -578,17 +704,21 @@ opt<bpid_t> wow64::syscalls32::register_NtAccessCheckByTypeResultList(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto SecurityDescriptor   = arg<wow64::PSECURITY_DESCRIPTOR>(core, 0);
-        const auto PrincipalSelfSid     = arg<wow64::PSID>(core, 1);
-        const auto ClientToken          = arg<wow64::HANDLE>(core, 2);
-        const auto DesiredAccess        = arg<wow64::ACCESS_MASK>(core, 3);
-        const auto ObjectTypeList       = arg<wow64::POBJECT_TYPE_LIST>(core, 4);
-        const auto ObjectTypeListLength = arg<wow64::ULONG>(core, 5);
-        const auto GenericMapping       = arg<wow64::PGENERIC_MAPPING>(core, 6);
-        const auto PrivilegeSet         = arg<wow64::PPRIVILEGE_SET>(core, 7);
-        const auto PrivilegeSetLength   = arg<wow64::PULONG>(core, 8);
-        const auto GrantedAccess        = arg<wow64::PACCESS_MASK>(core, 9);
-        const auto AccessStatus         = arg<wow64::PNTSTATUS>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SecurityDescriptor   = arg<wow64::PSECURITY_DESCRIPTOR>(args, 0);
+        const auto PrincipalSelfSid     = arg<wow64::PSID>(args, 1);
+        const auto ClientToken          = arg<wow64::HANDLE>(args, 2);
+        const auto DesiredAccess        = arg<wow64::ACCESS_MASK>(args, 3);
+        const auto ObjectTypeList       = arg<wow64::POBJECT_TYPE_LIST>(args, 4);
+        const auto ObjectTypeListLength = arg<wow64::ULONG>(args, 5);
+        const auto GenericMapping       = arg<wow64::PGENERIC_MAPPING>(args, 6);
+        const auto PrivilegeSet         = arg<wow64::PPRIVILEGE_SET>(args, 7);
+        const auto PrivilegeSetLength   = arg<wow64::PULONG>(args, 8);
+        const auto GrantedAccess        = arg<wow64::PACCESS_MASK>(args, 9);
+        const auto AccessStatus         = arg<wow64::PNTSTATUS>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[4]);
@@ -603,22 +733,26 @@ opt<bpid_t> wow64::syscalls32::register_NtAccessCheckByTypeResultListAndAuditAla
     {
         auto& core = d_->core;
 
-        const auto SubsystemName        = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto HandleId             = arg<wow64::PVOID>(core, 1);
-        const auto ObjectTypeName       = arg<wow64::PUNICODE_STRING>(core, 2);
-        const auto ObjectName           = arg<wow64::PUNICODE_STRING>(core, 3);
-        const auto SecurityDescriptor   = arg<wow64::PSECURITY_DESCRIPTOR>(core, 4);
-        const auto PrincipalSelfSid     = arg<wow64::PSID>(core, 5);
-        const auto DesiredAccess        = arg<wow64::ACCESS_MASK>(core, 6);
-        const auto AuditType            = arg<wow64::AUDIT_EVENT_TYPE>(core, 7);
-        const auto Flags                = arg<wow64::ULONG>(core, 8);
-        const auto ObjectTypeList       = arg<wow64::POBJECT_TYPE_LIST>(core, 9);
-        const auto ObjectTypeListLength = arg<wow64::ULONG>(core, 10);
-        const auto GenericMapping       = arg<wow64::PGENERIC_MAPPING>(core, 11);
-        const auto ObjectCreation       = arg<wow64::BOOLEAN>(core, 12);
-        const auto GrantedAccess        = arg<wow64::PACCESS_MASK>(core, 13);
-        const auto AccessStatus         = arg<wow64::PNTSTATUS>(core, 14);
-        const auto GenerateOnClose      = arg<wow64::PBOOLEAN>(core, 15);
+        auto args = std::array<arg_t, 16>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName        = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto HandleId             = arg<wow64::PVOID>(args, 1);
+        const auto ObjectTypeName       = arg<wow64::PUNICODE_STRING>(args, 2);
+        const auto ObjectName           = arg<wow64::PUNICODE_STRING>(args, 3);
+        const auto SecurityDescriptor   = arg<wow64::PSECURITY_DESCRIPTOR>(args, 4);
+        const auto PrincipalSelfSid     = arg<wow64::PSID>(args, 5);
+        const auto DesiredAccess        = arg<wow64::ACCESS_MASK>(args, 6);
+        const auto AuditType            = arg<wow64::AUDIT_EVENT_TYPE>(args, 7);
+        const auto Flags                = arg<wow64::ULONG>(args, 8);
+        const auto ObjectTypeList       = arg<wow64::POBJECT_TYPE_LIST>(args, 9);
+        const auto ObjectTypeListLength = arg<wow64::ULONG>(args, 10);
+        const auto GenericMapping       = arg<wow64::PGENERIC_MAPPING>(args, 11);
+        const auto ObjectCreation       = arg<wow64::BOOLEAN>(args, 12);
+        const auto GrantedAccess        = arg<wow64::PACCESS_MASK>(args, 13);
+        const auto AccessStatus         = arg<wow64::PNTSTATUS>(args, 14);
+        const auto GenerateOnClose      = arg<wow64::PBOOLEAN>(args, 15);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[5]);
@@ -633,9 +767,13 @@ opt<bpid_t> wow64::syscalls32::register_NtAddAtom(proc_t proc, const on_NtAddAto
     {
         auto& core = d_->core;
 
-        const auto AtomName = arg<wow64::PWSTR>(core, 0);
-        const auto Length   = arg<wow64::ULONG>(core, 1);
-        const auto Atom     = arg<wow64::PRTL_ATOM>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto AtomName = arg<wow64::PWSTR>(args, 0);
+        const auto Length   = arg<wow64::ULONG>(args, 1);
+        const auto Atom     = arg<wow64::PRTL_ATOM>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[6]);
@@ -650,8 +788,12 @@ opt<bpid_t> wow64::syscalls32::register_NtAddDriverEntry(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto DriverEntry = arg<wow64::PEFI_DRIVER_ENTRY>(core, 0);
-        const auto Id          = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DriverEntry = arg<wow64::PEFI_DRIVER_ENTRY>(args, 0);
+        const auto Id          = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[7]);
@@ -666,8 +808,12 @@ opt<bpid_t> wow64::syscalls32::register_NtAlertResumeThread(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle         = arg<wow64::HANDLE>(core, 0);
-        const auto PreviousSuspendCount = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle         = arg<wow64::HANDLE>(args, 0);
+        const auto PreviousSuspendCount = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[8]);
@@ -682,7 +828,11 @@ opt<bpid_t> wow64::syscalls32::register_NtAlertThread(proc_t proc, const on_NtAl
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[9]);
@@ -697,9 +847,13 @@ opt<bpid_t> wow64::syscalls32::register_NtAllocateReserveObject(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto MemoryReserveHandle = arg<wow64::PHANDLE>(core, 0);
-        const auto ObjectAttributes    = arg<wow64::POBJECT_ATTRIBUTES>(core, 1);
-        const auto Type                = arg<wow64::MEMORY_RESERVE_TYPE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MemoryReserveHandle = arg<wow64::PHANDLE>(args, 0);
+        const auto ObjectAttributes    = arg<wow64::POBJECT_ATTRIBUTES>(args, 1);
+        const auto Type                = arg<wow64::MEMORY_RESERVE_TYPE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[10]);
@@ -714,9 +868,13 @@ opt<bpid_t> wow64::syscalls32::register_NtAllocateUserPhysicalPages(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<wow64::HANDLE>(core, 0);
-        const auto NumberOfPages = arg<wow64::PULONG_PTR>(core, 1);
-        const auto UserPfnArra   = arg<wow64::PULONG_PTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<wow64::HANDLE>(args, 0);
+        const auto NumberOfPages = arg<wow64::PULONG_PTR>(args, 1);
+        const auto UserPfnArra   = arg<wow64::PULONG_PTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[11]);
@@ -731,10 +889,14 @@ opt<bpid_t> wow64::syscalls32::register_NtAllocateUuids(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto Time     = arg<wow64::PULARGE_INTEGER>(core, 0);
-        const auto Range    = arg<wow64::PULONG>(core, 1);
-        const auto Sequence = arg<wow64::PULONG>(core, 2);
-        const auto Seed     = arg<wow64::PCHAR>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Time     = arg<wow64::PULARGE_INTEGER>(args, 0);
+        const auto Range    = arg<wow64::PULONG>(args, 1);
+        const auto Sequence = arg<wow64::PULONG>(args, 2);
+        const auto Seed     = arg<wow64::PCHAR>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[12]);
@@ -749,12 +911,16 @@ opt<bpid_t> wow64::syscalls32::register_NtAllocateVirtualMemory(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<wow64::PVOID>(core, 1);
-        const auto ZeroBits        = arg<wow64::ULONG_PTR>(core, 2);
-        const auto RegionSize      = arg<wow64::PSIZE_T>(core, 3);
-        const auto AllocationType  = arg<wow64::ULONG>(core, 4);
-        const auto Protect         = arg<wow64::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<wow64::PVOID>(args, 1);
+        const auto ZeroBits        = arg<wow64::ULONG_PTR>(args, 2);
+        const auto RegionSize      = arg<wow64::PSIZE_T>(args, 3);
+        const auto AllocationType  = arg<wow64::ULONG>(args, 4);
+        const auto Protect         = arg<wow64::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[13]);
@@ -769,15 +935,19 @@ opt<bpid_t> wow64::syscalls32::register_NtAlpcAcceptConnectPort(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto PortHandle                  = arg<wow64::PHANDLE>(core, 0);
-        const auto ConnectionPortHandle        = arg<wow64::HANDLE>(core, 1);
-        const auto Flags                       = arg<wow64::ULONG>(core, 2);
-        const auto ObjectAttributes            = arg<wow64::POBJECT_ATTRIBUTES>(core, 3);
-        const auto PortAttributes              = arg<wow64::PALPC_PORT_ATTRIBUTES>(core, 4);
-        const auto PortContext                 = arg<wow64::PVOID>(core, 5);
-        const auto ConnectionRequest           = arg<wow64::PPORT_MESSAGE>(core, 6);
-        const auto ConnectionMessageAttributes = arg<wow64::PALPC_MESSAGE_ATTRIBUTES>(core, 7);
-        const auto AcceptConnection            = arg<wow64::BOOLEAN>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle                  = arg<wow64::PHANDLE>(args, 0);
+        const auto ConnectionPortHandle        = arg<wow64::HANDLE>(args, 1);
+        const auto Flags                       = arg<wow64::ULONG>(args, 2);
+        const auto ObjectAttributes            = arg<wow64::POBJECT_ATTRIBUTES>(args, 3);
+        const auto PortAttributes              = arg<wow64::PALPC_PORT_ATTRIBUTES>(args, 4);
+        const auto PortContext                 = arg<wow64::PVOID>(args, 5);
+        const auto ConnectionRequest           = arg<wow64::PPORT_MESSAGE>(args, 6);
+        const auto ConnectionMessageAttributes = arg<wow64::PALPC_MESSAGE_ATTRIBUTES>(args, 7);
+        const auto AcceptConnection            = arg<wow64::BOOLEAN>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[14]);
@@ -792,12 +962,16 @@ opt<bpid_t> wow64::syscalls32::register_NtAlpcCreatePortSection(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto PortHandle        = arg<wow64::HANDLE>(core, 0);
-        const auto Flags             = arg<wow64::ULONG>(core, 1);
-        const auto SectionHandle     = arg<wow64::HANDLE>(core, 2);
-        const auto SectionSize       = arg<wow64::SIZE_T>(core, 3);
-        const auto AlpcSectionHandle = arg<wow64::PALPC_HANDLE>(core, 4);
-        const auto ActualSectionSize = arg<wow64::PSIZE_T>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle        = arg<wow64::HANDLE>(args, 0);
+        const auto Flags             = arg<wow64::ULONG>(args, 1);
+        const auto SectionHandle     = arg<wow64::HANDLE>(args, 2);
+        const auto SectionSize       = arg<wow64::SIZE_T>(args, 3);
+        const auto AlpcSectionHandle = arg<wow64::PALPC_HANDLE>(args, 4);
+        const auto ActualSectionSize = arg<wow64::PSIZE_T>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[15]);
@@ -812,9 +986,13 @@ opt<bpid_t> wow64::syscalls32::register_NtAlpcDeleteResourceReserve(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<wow64::HANDLE>(core, 0);
-        const auto Flags      = arg<wow64::ULONG>(core, 1);
-        const auto ResourceId = arg<wow64::ALPC_HANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<wow64::HANDLE>(args, 0);
+        const auto Flags      = arg<wow64::ULONG>(args, 1);
+        const auto ResourceId = arg<wow64::ALPC_HANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[16]);
@@ -829,9 +1007,13 @@ opt<bpid_t> wow64::syscalls32::register_NtAlpcDeleteSectionView(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<wow64::HANDLE>(core, 0);
-        const auto Flags      = arg<wow64::ULONG>(core, 1);
-        const auto ViewBase   = arg<wow64::PVOID>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<wow64::HANDLE>(args, 0);
+        const auto Flags      = arg<wow64::ULONG>(args, 1);
+        const auto ViewBase   = arg<wow64::PVOID>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[17]);
@@ -846,9 +1028,13 @@ opt<bpid_t> wow64::syscalls32::register_NtAlpcDeleteSecurityContext(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto PortHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto Flags         = arg<wow64::ULONG>(core, 1);
-        const auto ContextHandle = arg<wow64::ALPC_HANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto Flags         = arg<wow64::ULONG>(args, 1);
+        const auto ContextHandle = arg<wow64::ALPC_HANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[18]);
@@ -863,8 +1049,12 @@ opt<bpid_t> wow64::syscalls32::register_NtAlpcDisconnectPort(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<wow64::HANDLE>(core, 0);
-        const auto Flags      = arg<wow64::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<wow64::HANDLE>(args, 0);
+        const auto Flags      = arg<wow64::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[19]);
@@ -879,9 +1069,13 @@ opt<bpid_t> wow64::syscalls32::register_NtAlpcRevokeSecurityContext(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto PortHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto Flags         = arg<wow64::ULONG>(core, 1);
-        const auto ContextHandle = arg<wow64::ALPC_HANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto Flags         = arg<wow64::ULONG>(args, 1);
+        const auto ContextHandle = arg<wow64::ALPC_HANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[20]);
@@ -896,14 +1090,18 @@ opt<bpid_t> wow64::syscalls32::register_NtAlpcSendWaitReceivePort(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto PortHandle               = arg<wow64::HANDLE>(core, 0);
-        const auto Flags                    = arg<wow64::ULONG>(core, 1);
-        const auto SendMessage              = arg<wow64::PPORT_MESSAGE>(core, 2);
-        const auto SendMessageAttributes    = arg<wow64::PALPC_MESSAGE_ATTRIBUTES>(core, 3);
-        const auto ReceiveMessage           = arg<wow64::PPORT_MESSAGE>(core, 4);
-        const auto BufferLength             = arg<wow64::PULONG>(core, 5);
-        const auto ReceiveMessageAttributes = arg<wow64::PALPC_MESSAGE_ATTRIBUTES>(core, 6);
-        const auto Timeout                  = arg<wow64::PLARGE_INTEGER>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle               = arg<wow64::HANDLE>(args, 0);
+        const auto Flags                    = arg<wow64::ULONG>(args, 1);
+        const auto SendMessage              = arg<wow64::PPORT_MESSAGE>(args, 2);
+        const auto SendMessageAttributes    = arg<wow64::PALPC_MESSAGE_ATTRIBUTES>(args, 3);
+        const auto ReceiveMessage           = arg<wow64::PPORT_MESSAGE>(args, 4);
+        const auto BufferLength             = arg<wow64::PULONG>(args, 5);
+        const auto ReceiveMessageAttributes = arg<wow64::PALPC_MESSAGE_ATTRIBUTES>(args, 6);
+        const auto Timeout                  = arg<wow64::PLARGE_INTEGER>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[21]);
@@ -918,10 +1116,14 @@ opt<bpid_t> wow64::syscalls32::register_NtAlpcSetInformation(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto PortHandle           = arg<wow64::HANDLE>(core, 0);
-        const auto PortInformationClass = arg<wow64::ALPC_PORT_INFORMATION_CLASS>(core, 1);
-        const auto PortInformation      = arg<wow64::PVOID>(core, 2);
-        const auto Length               = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle           = arg<wow64::HANDLE>(args, 0);
+        const auto PortInformationClass = arg<wow64::ALPC_PORT_INFORMATION_CLASS>(args, 1);
+        const auto PortInformation      = arg<wow64::PVOID>(args, 2);
+        const auto Length               = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[22]);
@@ -936,8 +1138,12 @@ opt<bpid_t> wow64::syscalls32::register_NtApphelpCacheControl(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto type = arg<wow64::APPHELPCOMMAND>(core, 0);
-        const auto buf  = arg<wow64::PVOID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto type = arg<wow64::APPHELPCOMMAND>(args, 0);
+        const auto buf  = arg<wow64::PVOID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[23]);
@@ -952,9 +1158,13 @@ opt<bpid_t> wow64::syscalls32::register_NtCancelIoFileEx(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto FileHandle        = arg<wow64::HANDLE>(core, 0);
-        const auto IoRequestToCancel = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
-        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle        = arg<wow64::HANDLE>(args, 0);
+        const auto IoRequestToCancel = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
+        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[24]);
@@ -969,9 +1179,13 @@ opt<bpid_t> wow64::syscalls32::register_NtCancelSynchronousIoFile(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle      = arg<wow64::HANDLE>(core, 0);
-        const auto IoRequestToCancel = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
-        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle      = arg<wow64::HANDLE>(args, 0);
+        const auto IoRequestToCancel = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
+        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[25]);
@@ -986,7 +1200,11 @@ opt<bpid_t> wow64::syscalls32::register_NtClearEvent(proc_t proc, const on_NtCle
     {
         auto& core = d_->core;
 
-        const auto EventHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[26]);
@@ -1001,7 +1219,11 @@ opt<bpid_t> wow64::syscalls32::register_NtClose(proc_t proc, const on_NtClose_fn
     {
         auto& core = d_->core;
 
-        const auto Handle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[27]);
@@ -1016,8 +1238,12 @@ opt<bpid_t> wow64::syscalls32::register_NtCommitEnlistment(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<wow64::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<wow64::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[28]);
@@ -1032,8 +1258,12 @@ opt<bpid_t> wow64::syscalls32::register_NtCommitTransaction(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle = arg<wow64::HANDLE>(core, 0);
-        const auto Wait              = arg<wow64::BOOLEAN>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle = arg<wow64::HANDLE>(args, 0);
+        const auto Wait              = arg<wow64::BOOLEAN>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[29]);
@@ -1048,8 +1278,12 @@ opt<bpid_t> wow64::syscalls32::register_NtCompactKeys(proc_t proc, const on_NtCo
     {
         auto& core = d_->core;
 
-        const auto Count    = arg<wow64::ULONG>(core, 0);
-        const auto KeyArray = arg<wow64::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Count    = arg<wow64::ULONG>(args, 0);
+        const auto KeyArray = arg<wow64::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[30]);
@@ -1064,7 +1298,11 @@ opt<bpid_t> wow64::syscalls32::register_NtCompleteConnectPort(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[31]);
@@ -1079,14 +1317,18 @@ opt<bpid_t> wow64::syscalls32::register_NtConnectPort(proc_t proc, const on_NtCo
     {
         auto& core = d_->core;
 
-        const auto PortHandle                  = arg<wow64::PHANDLE>(core, 0);
-        const auto PortName                    = arg<wow64::PUNICODE_STRING>(core, 1);
-        const auto SecurityQos                 = arg<wow64::PSECURITY_QUALITY_OF_SERVICE>(core, 2);
-        const auto ClientView                  = arg<wow64::PPORT_VIEW>(core, 3);
-        const auto ServerView                  = arg<wow64::PREMOTE_PORT_VIEW>(core, 4);
-        const auto MaxMessageLength            = arg<wow64::PULONG>(core, 5);
-        const auto ConnectionInformation       = arg<wow64::PVOID>(core, 6);
-        const auto ConnectionInformationLength = arg<wow64::PULONG>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle                  = arg<wow64::PHANDLE>(args, 0);
+        const auto PortName                    = arg<wow64::PUNICODE_STRING>(args, 1);
+        const auto SecurityQos                 = arg<wow64::PSECURITY_QUALITY_OF_SERVICE>(args, 2);
+        const auto ClientView                  = arg<wow64::PPORT_VIEW>(args, 3);
+        const auto ServerView                  = arg<wow64::PREMOTE_PORT_VIEW>(args, 4);
+        const auto MaxMessageLength            = arg<wow64::PULONG>(args, 5);
+        const auto ConnectionInformation       = arg<wow64::PVOID>(args, 6);
+        const auto ConnectionInformationLength = arg<wow64::PULONG>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[32]);
@@ -1101,11 +1343,15 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateEvent(proc_t proc, const on_NtCr
     {
         auto& core = d_->core;
 
-        const auto EventHandle      = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto EventType        = arg<wow64::EVENT_TYPE>(core, 3);
-        const auto InitialState     = arg<wow64::BOOLEAN>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle      = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto EventType        = arg<wow64::EVENT_TYPE>(args, 3);
+        const auto InitialState     = arg<wow64::BOOLEAN>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[33]);
@@ -1120,9 +1366,13 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateEventPair(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle  = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle  = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[34]);
@@ -1137,17 +1387,21 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateFile(proc_t proc, const on_NtCre
     {
         auto& core = d_->core;
 
-        const auto FileHandle        = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(core, 3);
-        const auto AllocationSize    = arg<wow64::PLARGE_INTEGER>(core, 4);
-        const auto FileAttributes    = arg<wow64::ULONG>(core, 5);
-        const auto ShareAccess       = arg<wow64::ULONG>(core, 6);
-        const auto CreateDisposition = arg<wow64::ULONG>(core, 7);
-        const auto CreateOptions     = arg<wow64::ULONG>(core, 8);
-        const auto EaBuffer          = arg<wow64::PVOID>(core, 9);
-        const auto EaLength          = arg<wow64::ULONG>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle        = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(args, 3);
+        const auto AllocationSize    = arg<wow64::PLARGE_INTEGER>(args, 4);
+        const auto FileAttributes    = arg<wow64::ULONG>(args, 5);
+        const auto ShareAccess       = arg<wow64::ULONG>(args, 6);
+        const auto CreateDisposition = arg<wow64::ULONG>(args, 7);
+        const auto CreateOptions     = arg<wow64::ULONG>(args, 8);
+        const auto EaBuffer          = arg<wow64::PVOID>(args, 9);
+        const auto EaLength          = arg<wow64::ULONG>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[35]);
@@ -1162,10 +1416,14 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateIoCompletion(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Count              = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Count              = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[36]);
@@ -1180,9 +1438,13 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateJobSet(proc_t proc, const on_NtC
     {
         auto& core = d_->core;
 
-        const auto NumJob     = arg<wow64::ULONG>(core, 0);
-        const auto UserJobSet = arg<wow64::PJOB_SET_ARRAY>(core, 1);
-        const auto Flags      = arg<wow64::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto NumJob     = arg<wow64::ULONG>(args, 0);
+        const auto UserJobSet = arg<wow64::PJOB_SET_ARRAY>(args, 1);
+        const auto Flags      = arg<wow64::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[37]);
@@ -1197,14 +1459,18 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateKeyTransacted(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto KeyHandle         = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto TitleIndex        = arg<wow64::ULONG>(core, 3);
-        const auto Class             = arg<wow64::PUNICODE_STRING>(core, 4);
-        const auto CreateOptions     = arg<wow64::ULONG>(core, 5);
-        const auto TransactionHandle = arg<wow64::HANDLE>(core, 6);
-        const auto Disposition       = arg<wow64::PULONG>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle         = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto TitleIndex        = arg<wow64::ULONG>(args, 3);
+        const auto Class             = arg<wow64::PUNICODE_STRING>(args, 4);
+        const auto CreateOptions     = arg<wow64::ULONG>(args, 5);
+        const auto TransactionHandle = arg<wow64::HANDLE>(args, 6);
+        const auto Disposition       = arg<wow64::PULONG>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[38]);
@@ -1219,10 +1485,14 @@ opt<bpid_t> wow64::syscalls32::register_NtCreatePagingFile(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto PageFileName = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto MinimumSize  = arg<wow64::PLARGE_INTEGER>(core, 1);
-        const auto MaximumSize  = arg<wow64::PLARGE_INTEGER>(core, 2);
-        const auto Priority     = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PageFileName = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto MinimumSize  = arg<wow64::PLARGE_INTEGER>(args, 1);
+        const auto MaximumSize  = arg<wow64::PLARGE_INTEGER>(args, 2);
+        const auto Priority     = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[39]);
@@ -1237,10 +1507,14 @@ opt<bpid_t> wow64::syscalls32::register_NtCreatePrivateNamespace(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto NamespaceHandle    = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto BoundaryDescriptor = arg<wow64::PVOID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto NamespaceHandle    = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto BoundaryDescriptor = arg<wow64::PVOID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[40]);
@@ -1255,16 +1529,20 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateProfileEx(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto ProfileHandle      = arg<wow64::PHANDLE>(core, 0);
-        const auto Process            = arg<wow64::HANDLE>(core, 1);
-        const auto ProfileBase        = arg<wow64::PVOID>(core, 2);
-        const auto ProfileSize        = arg<wow64::SIZE_T>(core, 3);
-        const auto BucketSize         = arg<wow64::ULONG>(core, 4);
-        const auto Buffer             = arg<wow64::PULONG>(core, 5);
-        const auto BufferSize         = arg<wow64::ULONG>(core, 6);
-        const auto ProfileSource      = arg<wow64::KPROFILE_SOURCE>(core, 7);
-        const auto GroupAffinityCount = arg<wow64::ULONG>(core, 8);
-        const auto GroupAffinity      = arg<wow64::PGROUP_AFFINITY>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProfileHandle      = arg<wow64::PHANDLE>(args, 0);
+        const auto Process            = arg<wow64::HANDLE>(args, 1);
+        const auto ProfileBase        = arg<wow64::PVOID>(args, 2);
+        const auto ProfileSize        = arg<wow64::SIZE_T>(args, 3);
+        const auto BucketSize         = arg<wow64::ULONG>(args, 4);
+        const auto Buffer             = arg<wow64::PULONG>(args, 5);
+        const auto BufferSize         = arg<wow64::ULONG>(args, 6);
+        const auto ProfileSource      = arg<wow64::KPROFILE_SOURCE>(args, 7);
+        const auto GroupAffinityCount = arg<wow64::ULONG>(args, 8);
+        const auto GroupAffinity      = arg<wow64::PGROUP_AFFINITY>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[41]);
@@ -1279,13 +1557,17 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateSection(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto SectionHandle         = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess         = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes      = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto MaximumSize           = arg<wow64::PLARGE_INTEGER>(core, 3);
-        const auto SectionPageProtection = arg<wow64::ULONG>(core, 4);
-        const auto AllocationAttributes  = arg<wow64::ULONG>(core, 5);
-        const auto FileHandle            = arg<wow64::HANDLE>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionHandle         = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess         = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes      = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto MaximumSize           = arg<wow64::PLARGE_INTEGER>(args, 3);
+        const auto SectionPageProtection = arg<wow64::ULONG>(args, 4);
+        const auto AllocationAttributes  = arg<wow64::ULONG>(args, 5);
+        const auto FileHandle            = arg<wow64::HANDLE>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[42]);
@@ -1300,11 +1582,15 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateSemaphore(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto SemaphoreHandle  = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto InitialCount     = arg<wow64::LONG>(core, 3);
-        const auto MaximumCount     = arg<wow64::LONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SemaphoreHandle  = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto InitialCount     = arg<wow64::LONG>(args, 3);
+        const auto MaximumCount     = arg<wow64::LONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[43]);
@@ -1319,14 +1605,18 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateThread(proc_t proc, const on_NtC
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle     = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ProcessHandle    = arg<wow64::HANDLE>(core, 3);
-        const auto ClientId         = arg<wow64::PCLIENT_ID>(core, 4);
-        const auto ThreadContext    = arg<wow64::PCONTEXT>(core, 5);
-        const auto InitialTeb       = arg<wow64::PINITIAL_TEB>(core, 6);
-        const auto CreateSuspended  = arg<wow64::BOOLEAN>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle     = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ProcessHandle    = arg<wow64::HANDLE>(args, 3);
+        const auto ClientId         = arg<wow64::PCLIENT_ID>(args, 4);
+        const auto ThreadContext    = arg<wow64::PCONTEXT>(args, 5);
+        const auto InitialTeb       = arg<wow64::PINITIAL_TEB>(args, 6);
+        const auto CreateSuspended  = arg<wow64::BOOLEAN>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[44]);
@@ -1341,17 +1631,21 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateThreadEx(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle     = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ProcessHandle    = arg<wow64::HANDLE>(core, 3);
-        const auto StartRoutine     = arg<wow64::PVOID>(core, 4);
-        const auto Argument         = arg<wow64::PVOID>(core, 5);
-        const auto CreateFlags      = arg<wow64::ULONG>(core, 6);
-        const auto ZeroBits         = arg<wow64::ULONG_PTR>(core, 7);
-        const auto StackSize        = arg<wow64::SIZE_T>(core, 8);
-        const auto MaximumStackSize = arg<wow64::SIZE_T>(core, 9);
-        const auto AttributeList    = arg<wow64::PPS_ATTRIBUTE_LIST>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle     = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ProcessHandle    = arg<wow64::HANDLE>(args, 3);
+        const auto StartRoutine     = arg<wow64::PVOID>(args, 4);
+        const auto Argument         = arg<wow64::PVOID>(args, 5);
+        const auto CreateFlags      = arg<wow64::ULONG>(args, 6);
+        const auto ZeroBits         = arg<wow64::ULONG_PTR>(args, 7);
+        const auto StackSize        = arg<wow64::SIZE_T>(args, 8);
+        const auto MaximumStackSize = arg<wow64::SIZE_T>(args, 9);
+        const auto AttributeList    = arg<wow64::PPS_ATTRIBUTE_LIST>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[45]);
@@ -1366,19 +1660,23 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateToken(proc_t proc, const on_NtCr
     {
         auto& core = d_->core;
 
-        const auto TokenHandle      = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto TokenType        = arg<wow64::TOKEN_TYPE>(core, 3);
-        const auto AuthenticationId = arg<wow64::PLUID>(core, 4);
-        const auto ExpirationTime   = arg<wow64::PLARGE_INTEGER>(core, 5);
-        const auto User             = arg<wow64::PTOKEN_USER>(core, 6);
-        const auto Groups           = arg<wow64::PTOKEN_GROUPS>(core, 7);
-        const auto Privileges       = arg<wow64::PTOKEN_PRIVILEGES>(core, 8);
-        const auto Owner            = arg<wow64::PTOKEN_OWNER>(core, 9);
-        const auto PrimaryGroup     = arg<wow64::PTOKEN_PRIMARY_GROUP>(core, 10);
-        const auto DefaultDacl      = arg<wow64::PTOKEN_DEFAULT_DACL>(core, 11);
-        const auto TokenSource      = arg<wow64::PTOKEN_SOURCE>(core, 12);
+        auto args = std::array<arg_t, 13>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle      = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto TokenType        = arg<wow64::TOKEN_TYPE>(args, 3);
+        const auto AuthenticationId = arg<wow64::PLUID>(args, 4);
+        const auto ExpirationTime   = arg<wow64::PLARGE_INTEGER>(args, 5);
+        const auto User             = arg<wow64::PTOKEN_USER>(args, 6);
+        const auto Groups           = arg<wow64::PTOKEN_GROUPS>(args, 7);
+        const auto Privileges       = arg<wow64::PTOKEN_PRIVILEGES>(args, 8);
+        const auto Owner            = arg<wow64::PTOKEN_OWNER>(args, 9);
+        const auto PrimaryGroup     = arg<wow64::PTOKEN_PRIMARY_GROUP>(args, 10);
+        const auto DefaultDacl      = arg<wow64::PTOKEN_DEFAULT_DACL>(args, 11);
+        const auto TokenSource      = arg<wow64::PTOKEN_SOURCE>(args, 12);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[46]);
@@ -1393,16 +1691,20 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateTransaction(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Uow               = arg<wow64::LPGUID>(core, 3);
-        const auto TmHandle          = arg<wow64::HANDLE>(core, 4);
-        const auto CreateOptions     = arg<wow64::ULONG>(core, 5);
-        const auto IsolationLevel    = arg<wow64::ULONG>(core, 6);
-        const auto IsolationFlags    = arg<wow64::ULONG>(core, 7);
-        const auto Timeout           = arg<wow64::PLARGE_INTEGER>(core, 8);
-        const auto Description       = arg<wow64::PUNICODE_STRING>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Uow               = arg<wow64::LPGUID>(args, 3);
+        const auto TmHandle          = arg<wow64::HANDLE>(args, 4);
+        const auto CreateOptions     = arg<wow64::ULONG>(args, 5);
+        const auto IsolationLevel    = arg<wow64::ULONG>(args, 6);
+        const auto IsolationFlags    = arg<wow64::ULONG>(args, 7);
+        const auto Timeout           = arg<wow64::PLARGE_INTEGER>(args, 8);
+        const auto Description       = arg<wow64::PUNICODE_STRING>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[47]);
@@ -1417,17 +1719,21 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateUserProcess(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle           = arg<wow64::PHANDLE>(core, 0);
-        const auto ThreadHandle            = arg<wow64::PHANDLE>(core, 1);
-        const auto ProcessDesiredAccess    = arg<wow64::ACCESS_MASK>(core, 2);
-        const auto ThreadDesiredAccess     = arg<wow64::ACCESS_MASK>(core, 3);
-        const auto ProcessObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 4);
-        const auto ThreadObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(core, 5);
-        const auto ProcessFlags            = arg<wow64::ULONG>(core, 6);
-        const auto ThreadFlags             = arg<wow64::ULONG>(core, 7);
-        const auto ProcessParameters       = arg<wow64::PRTL_USER_PROCESS_PARAMETERS>(core, 8);
-        const auto CreateInfo              = arg<wow64::PPROCESS_CREATE_INFO>(core, 9);
-        const auto AttributeList           = arg<wow64::PPROCESS_ATTRIBUTE_LIST>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle           = arg<wow64::PHANDLE>(args, 0);
+        const auto ThreadHandle            = arg<wow64::PHANDLE>(args, 1);
+        const auto ProcessDesiredAccess    = arg<wow64::ACCESS_MASK>(args, 2);
+        const auto ThreadDesiredAccess     = arg<wow64::ACCESS_MASK>(args, 3);
+        const auto ProcessObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 4);
+        const auto ThreadObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(args, 5);
+        const auto ProcessFlags            = arg<wow64::ULONG>(args, 6);
+        const auto ThreadFlags             = arg<wow64::ULONG>(args, 7);
+        const auto ProcessParameters       = arg<wow64::PRTL_USER_PROCESS_PARAMETERS>(args, 8);
+        const auto CreateInfo              = arg<wow64::PPROCESS_CREATE_INFO>(args, 9);
+        const auto AttributeList           = arg<wow64::PPROCESS_ATTRIBUTE_LIST>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[48]);
@@ -1442,16 +1748,20 @@ opt<bpid_t> wow64::syscalls32::register_NtCreateWorkerFactory(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandleReturn = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess             = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes          = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto CompletionPortHandle      = arg<wow64::HANDLE>(core, 3);
-        const auto WorkerProcessHandle       = arg<wow64::HANDLE>(core, 4);
-        const auto StartRoutine              = arg<wow64::PVOID>(core, 5);
-        const auto StartParameter            = arg<wow64::PVOID>(core, 6);
-        const auto MaxThreadCount            = arg<wow64::ULONG>(core, 7);
-        const auto StackReserve              = arg<wow64::SIZE_T>(core, 8);
-        const auto StackCommit               = arg<wow64::SIZE_T>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandleReturn = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess             = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes          = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto CompletionPortHandle      = arg<wow64::HANDLE>(args, 3);
+        const auto WorkerProcessHandle       = arg<wow64::HANDLE>(args, 4);
+        const auto StartRoutine              = arg<wow64::PVOID>(args, 5);
+        const auto StartParameter            = arg<wow64::PVOID>(args, 6);
+        const auto MaxThreadCount            = arg<wow64::ULONG>(args, 7);
+        const auto StackReserve              = arg<wow64::SIZE_T>(args, 8);
+        const auto StackCommit               = arg<wow64::SIZE_T>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[49]);
@@ -1466,8 +1776,12 @@ opt<bpid_t> wow64::syscalls32::register_NtDebugActiveProcess(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle     = arg<wow64::HANDLE>(core, 0);
-        const auto DebugObjectHandle = arg<wow64::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle     = arg<wow64::HANDLE>(args, 0);
+        const auto DebugObjectHandle = arg<wow64::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[50]);
@@ -1482,7 +1796,11 @@ opt<bpid_t> wow64::syscalls32::register_NtDeleteBootEntry(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto Id = arg<wow64::ULONG>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Id = arg<wow64::ULONG>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[51]);
@@ -1497,7 +1815,11 @@ opt<bpid_t> wow64::syscalls32::register_NtDeleteFile(proc_t proc, const on_NtDel
     {
         auto& core = d_->core;
 
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[52]);
@@ -1512,9 +1834,13 @@ opt<bpid_t> wow64::syscalls32::register_NtDeleteObjectAuditAlarm(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto SubsystemName   = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto HandleId        = arg<wow64::PVOID>(core, 1);
-        const auto GenerateOnClose = arg<wow64::BOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName   = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto HandleId        = arg<wow64::PVOID>(args, 1);
+        const auto GenerateOnClose = arg<wow64::BOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[53]);
@@ -1529,7 +1855,11 @@ opt<bpid_t> wow64::syscalls32::register_NtDeletePrivateNamespace(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto NamespaceHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto NamespaceHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[54]);
@@ -1544,8 +1874,12 @@ opt<bpid_t> wow64::syscalls32::register_NtDeleteValueKey(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto KeyHandle = arg<wow64::HANDLE>(core, 0);
-        const auto ValueName = arg<wow64::PUNICODE_STRING>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle = arg<wow64::HANDLE>(args, 0);
+        const auto ValueName = arg<wow64::PUNICODE_STRING>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[55]);
@@ -1573,7 +1907,11 @@ opt<bpid_t> wow64::syscalls32::register_NtDisplayString(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto String = arg<wow64::PUNICODE_STRING>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto String = arg<wow64::PUNICODE_STRING>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[57]);
@@ -1588,12 +1926,16 @@ opt<bpid_t> wow64::syscalls32::register_NtDuplicateToken(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto ExistingTokenHandle = arg<wow64::HANDLE>(core, 0);
-        const auto DesiredAccess       = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes    = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto EffectiveOnly       = arg<wow64::BOOLEAN>(core, 3);
-        const auto TokenType           = arg<wow64::TOKEN_TYPE>(core, 4);
-        const auto NewTokenHandle      = arg<wow64::PHANDLE>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ExistingTokenHandle = arg<wow64::HANDLE>(args, 0);
+        const auto DesiredAccess       = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes    = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto EffectiveOnly       = arg<wow64::BOOLEAN>(args, 3);
+        const auto TokenType           = arg<wow64::TOKEN_TYPE>(args, 4);
+        const auto NewTokenHandle      = arg<wow64::PHANDLE>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[58]);
@@ -1621,8 +1963,12 @@ opt<bpid_t> wow64::syscalls32::register_NtEnumerateDriverEntries(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto Buffer       = arg<wow64::PVOID>(core, 0);
-        const auto BufferLength = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Buffer       = arg<wow64::PVOID>(args, 0);
+        const auto BufferLength = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[60]);
@@ -1637,12 +1983,16 @@ opt<bpid_t> wow64::syscalls32::register_NtEnumerateValueKey(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto KeyHandle                = arg<wow64::HANDLE>(core, 0);
-        const auto Index                    = arg<wow64::ULONG>(core, 1);
-        const auto KeyValueInformationClass = arg<wow64::KEY_VALUE_INFORMATION_CLASS>(core, 2);
-        const auto KeyValueInformation      = arg<wow64::PVOID>(core, 3);
-        const auto Length                   = arg<wow64::ULONG>(core, 4);
-        const auto ResultLength             = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle                = arg<wow64::HANDLE>(args, 0);
+        const auto Index                    = arg<wow64::ULONG>(args, 1);
+        const auto KeyValueInformationClass = arg<wow64::KEY_VALUE_INFORMATION_CLASS>(args, 2);
+        const auto KeyValueInformation      = arg<wow64::PVOID>(args, 3);
+        const auto Length                   = arg<wow64::ULONG>(args, 4);
+        const auto ResultLength             = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[61]);
@@ -1657,12 +2007,16 @@ opt<bpid_t> wow64::syscalls32::register_NtFilterToken(proc_t proc, const on_NtFi
     {
         auto& core = d_->core;
 
-        const auto ExistingTokenHandle = arg<wow64::HANDLE>(core, 0);
-        const auto Flags               = arg<wow64::ULONG>(core, 1);
-        const auto SidsToDisable       = arg<wow64::PTOKEN_GROUPS>(core, 2);
-        const auto PrivilegesToDelete  = arg<wow64::PTOKEN_PRIVILEGES>(core, 3);
-        const auto RestrictedSids      = arg<wow64::PTOKEN_GROUPS>(core, 4);
-        const auto NewTokenHandle      = arg<wow64::PHANDLE>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ExistingTokenHandle = arg<wow64::HANDLE>(args, 0);
+        const auto Flags               = arg<wow64::ULONG>(args, 1);
+        const auto SidsToDisable       = arg<wow64::PTOKEN_GROUPS>(args, 2);
+        const auto PrivilegesToDelete  = arg<wow64::PTOKEN_PRIVILEGES>(args, 3);
+        const auto RestrictedSids      = arg<wow64::PTOKEN_GROUPS>(args, 4);
+        const auto NewTokenHandle      = arg<wow64::PHANDLE>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[62]);
@@ -1677,9 +2031,13 @@ opt<bpid_t> wow64::syscalls32::register_NtFindAtom(proc_t proc, const on_NtFindA
     {
         auto& core = d_->core;
 
-        const auto AtomName = arg<wow64::PWSTR>(core, 0);
-        const auto Length   = arg<wow64::ULONG>(core, 1);
-        const auto Atom     = arg<wow64::PRTL_ATOM>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto AtomName = arg<wow64::PWSTR>(args, 0);
+        const auto Length   = arg<wow64::ULONG>(args, 1);
+        const auto Atom     = arg<wow64::PRTL_ATOM>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[63]);
@@ -1694,7 +2052,11 @@ opt<bpid_t> wow64::syscalls32::register_NtFlushKey(proc_t proc, const on_NtFlush
     {
         auto& core = d_->core;
 
-        const auto KeyHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[64]);
@@ -1722,9 +2084,13 @@ opt<bpid_t> wow64::syscalls32::register_NtFreeUserPhysicalPages(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<wow64::HANDLE>(core, 0);
-        const auto NumberOfPages = arg<wow64::PULONG_PTR>(core, 1);
-        const auto UserPfnArra   = arg<wow64::PULONG_PTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<wow64::HANDLE>(args, 0);
+        const auto NumberOfPages = arg<wow64::PULONG_PTR>(args, 1);
+        const auto UserPfnArra   = arg<wow64::PULONG_PTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[66]);
@@ -1739,10 +2105,14 @@ opt<bpid_t> wow64::syscalls32::register_NtFreeVirtualMemory(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<wow64::PVOID>(core, 1);
-        const auto RegionSize      = arg<wow64::PSIZE_T>(core, 2);
-        const auto FreeType        = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<wow64::PVOID>(args, 1);
+        const auto RegionSize      = arg<wow64::PSIZE_T>(args, 2);
+        const auto FreeType        = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[67]);
@@ -1757,7 +2127,11 @@ opt<bpid_t> wow64::syscalls32::register_NtFreezeRegistry(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto TimeOutInSeconds = arg<wow64::ULONG>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimeOutInSeconds = arg<wow64::ULONG>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[68]);
@@ -1772,16 +2146,20 @@ opt<bpid_t> wow64::syscalls32::register_NtFsControlFile(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto FileHandle         = arg<wow64::HANDLE>(core, 0);
-        const auto Event              = arg<wow64::HANDLE>(core, 1);
-        const auto ApcRoutine         = arg<wow64::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext         = arg<wow64::PVOID>(core, 3);
-        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(core, 4);
-        const auto IoControlCode      = arg<wow64::ULONG>(core, 5);
-        const auto InputBuffer        = arg<wow64::PVOID>(core, 6);
-        const auto InputBufferLength  = arg<wow64::ULONG>(core, 7);
-        const auto OutputBuffer       = arg<wow64::PVOID>(core, 8);
-        const auto OutputBufferLength = arg<wow64::ULONG>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle         = arg<wow64::HANDLE>(args, 0);
+        const auto Event              = arg<wow64::HANDLE>(args, 1);
+        const auto ApcRoutine         = arg<wow64::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext         = arg<wow64::PVOID>(args, 3);
+        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(args, 4);
+        const auto IoControlCode      = arg<wow64::ULONG>(args, 5);
+        const auto InputBuffer        = arg<wow64::PVOID>(args, 6);
+        const auto InputBufferLength  = arg<wow64::ULONG>(args, 7);
+        const auto OutputBuffer       = arg<wow64::PVOID>(args, 8);
+        const auto OutputBufferLength = arg<wow64::ULONG>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[69]);
@@ -1796,8 +2174,12 @@ opt<bpid_t> wow64::syscalls32::register_NtGetContextThread(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto ThreadContext = arg<wow64::PCONTEXT>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto ThreadContext = arg<wow64::PCONTEXT>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[70]);
@@ -1825,8 +2207,12 @@ opt<bpid_t> wow64::syscalls32::register_NtGetDevicePowerState(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Device    = arg<wow64::HANDLE>(core, 0);
-        const auto STARState = arg<wow64::DEVICE_POWER_STATE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Device    = arg<wow64::HANDLE>(args, 0);
+        const auto STARState = arg<wow64::DEVICE_POWER_STATE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[72]);
@@ -1841,9 +2227,13 @@ opt<bpid_t> wow64::syscalls32::register_NtGetMUIRegistryInfo(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Flags    = arg<wow64::ULONG>(core, 0);
-        const auto DataSize = arg<wow64::PULONG>(core, 1);
-        const auto Data     = arg<wow64::PVOID>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Flags    = arg<wow64::ULONG>(args, 0);
+        const auto DataSize = arg<wow64::PULONG>(args, 1);
+        const auto Data     = arg<wow64::PVOID>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[73]);
@@ -1858,11 +2248,15 @@ opt<bpid_t> wow64::syscalls32::register_NtGetNlsSectionPtr(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto SectionType        = arg<wow64::ULONG>(core, 0);
-        const auto SectionData        = arg<wow64::ULONG>(core, 1);
-        const auto ContextData        = arg<wow64::PVOID>(core, 2);
-        const auto STARSectionPointer = arg<wow64::PVOID>(core, 3);
-        const auto SectionSize        = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionType        = arg<wow64::ULONG>(args, 0);
+        const auto SectionData        = arg<wow64::ULONG>(args, 1);
+        const auto ContextData        = arg<wow64::PVOID>(args, 2);
+        const auto STARSectionPointer = arg<wow64::PVOID>(args, 3);
+        const auto SectionSize        = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[74]);
@@ -1877,13 +2271,17 @@ opt<bpid_t> wow64::syscalls32::register_NtGetWriteWatch(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle             = arg<wow64::HANDLE>(core, 0);
-        const auto Flags                     = arg<wow64::ULONG>(core, 1);
-        const auto BaseAddress               = arg<wow64::PVOID>(core, 2);
-        const auto RegionSize                = arg<wow64::SIZE_T>(core, 3);
-        const auto STARUserAddressArray      = arg<wow64::PVOID>(core, 4);
-        const auto EntriesInUserAddressArray = arg<wow64::PULONG_PTR>(core, 5);
-        const auto Granularity               = arg<wow64::PULONG>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle             = arg<wow64::HANDLE>(args, 0);
+        const auto Flags                     = arg<wow64::ULONG>(args, 1);
+        const auto BaseAddress               = arg<wow64::PVOID>(args, 2);
+        const auto RegionSize                = arg<wow64::SIZE_T>(args, 3);
+        const auto STARUserAddressArray      = arg<wow64::PVOID>(args, 4);
+        const auto EntriesInUserAddressArray = arg<wow64::PULONG_PTR>(args, 5);
+        const auto Granularity               = arg<wow64::PULONG>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[75]);
@@ -1898,7 +2296,11 @@ opt<bpid_t> wow64::syscalls32::register_NtImpersonateAnonymousToken(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[76]);
@@ -1913,9 +2315,13 @@ opt<bpid_t> wow64::syscalls32::register_NtInitializeNlsFiles(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto STARBaseAddress        = arg<wow64::PVOID>(core, 0);
-        const auto DefaultLocaleId        = arg<wow64::PLCID>(core, 1);
-        const auto DefaultCasingTableSize = arg<wow64::PLARGE_INTEGER>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto STARBaseAddress        = arg<wow64::PVOID>(args, 0);
+        const auto DefaultLocaleId        = arg<wow64::PLCID>(args, 1);
+        const auto DefaultCasingTableSize = arg<wow64::PLARGE_INTEGER>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[77]);
@@ -1930,10 +2336,14 @@ opt<bpid_t> wow64::syscalls32::register_NtInitiatePowerAction(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto SystemAction   = arg<wow64::POWER_ACTION>(core, 0);
-        const auto MinSystemState = arg<wow64::SYSTEM_POWER_STATE>(core, 1);
-        const auto Flags          = arg<wow64::ULONG>(core, 2);
-        const auto Asynchronous   = arg<wow64::BOOLEAN>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemAction   = arg<wow64::POWER_ACTION>(args, 0);
+        const auto MinSystemState = arg<wow64::SYSTEM_POWER_STATE>(args, 1);
+        const auto Flags          = arg<wow64::ULONG>(args, 2);
+        const auto Asynchronous   = arg<wow64::BOOLEAN>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[78]);
@@ -1961,7 +2371,11 @@ opt<bpid_t> wow64::syscalls32::register_NtLoadDriver(proc_t proc, const on_NtLoa
     {
         auto& core = d_->core;
 
-        const auto DriverServiceName = arg<wow64::PUNICODE_STRING>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DriverServiceName = arg<wow64::PUNICODE_STRING>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[80]);
@@ -1976,8 +2390,12 @@ opt<bpid_t> wow64::syscalls32::register_NtLoadKey(proc_t proc, const on_NtLoadKe
     {
         auto& core = d_->core;
 
-        const auto TargetKey  = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
-        const auto SourceFile = arg<wow64::POBJECT_ATTRIBUTES>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey  = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
+        const auto SourceFile = arg<wow64::POBJECT_ATTRIBUTES>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[81]);
@@ -1992,9 +2410,13 @@ opt<bpid_t> wow64::syscalls32::register_NtLoadKey2(proc_t proc, const on_NtLoadK
     {
         auto& core = d_->core;
 
-        const auto TargetKey  = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
-        const auto SourceFile = arg<wow64::POBJECT_ATTRIBUTES>(core, 1);
-        const auto Flags      = arg<wow64::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey  = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
+        const auto SourceFile = arg<wow64::POBJECT_ATTRIBUTES>(args, 1);
+        const auto Flags      = arg<wow64::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[82]);
@@ -2009,14 +2431,18 @@ opt<bpid_t> wow64::syscalls32::register_NtLoadKeyEx(proc_t proc, const on_NtLoad
     {
         auto& core = d_->core;
 
-        const auto TargetKey         = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
-        const auto SourceFile        = arg<wow64::POBJECT_ATTRIBUTES>(core, 1);
-        const auto Flags             = arg<wow64::ULONG>(core, 2);
-        const auto TrustClassKey     = arg<wow64::HANDLE>(core, 3);
-        const auto Reserved          = arg<wow64::PVOID>(core, 4);
-        const auto ObjectContext     = arg<wow64::PVOID>(core, 5);
-        const auto CallbackReserverd = arg<wow64::PVOID>(core, 6);
-        const auto IoStatusBlock     = arg<wow64::PVOID>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey         = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
+        const auto SourceFile        = arg<wow64::POBJECT_ATTRIBUTES>(args, 1);
+        const auto Flags             = arg<wow64::ULONG>(args, 2);
+        const auto TrustClassKey     = arg<wow64::HANDLE>(args, 3);
+        const auto Reserved          = arg<wow64::PVOID>(args, 4);
+        const auto ObjectContext     = arg<wow64::PVOID>(args, 5);
+        const auto CallbackReserverd = arg<wow64::PVOID>(args, 6);
+        const auto IoStatusBlock     = arg<wow64::PVOID>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[83]);
@@ -2031,16 +2457,20 @@ opt<bpid_t> wow64::syscalls32::register_NtLockFile(proc_t proc, const on_NtLockF
     {
         auto& core = d_->core;
 
-        const auto FileHandle      = arg<wow64::HANDLE>(core, 0);
-        const auto Event           = arg<wow64::HANDLE>(core, 1);
-        const auto ApcRoutine      = arg<wow64::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext      = arg<wow64::PVOID>(core, 3);
-        const auto IoStatusBlock   = arg<wow64::PIO_STATUS_BLOCK>(core, 4);
-        const auto ByteOffset      = arg<wow64::PLARGE_INTEGER>(core, 5);
-        const auto Length          = arg<wow64::PLARGE_INTEGER>(core, 6);
-        const auto Key             = arg<wow64::ULONG>(core, 7);
-        const auto FailImmediately = arg<wow64::BOOLEAN>(core, 8);
-        const auto ExclusiveLock   = arg<wow64::BOOLEAN>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle      = arg<wow64::HANDLE>(args, 0);
+        const auto Event           = arg<wow64::HANDLE>(args, 1);
+        const auto ApcRoutine      = arg<wow64::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext      = arg<wow64::PVOID>(args, 3);
+        const auto IoStatusBlock   = arg<wow64::PIO_STATUS_BLOCK>(args, 4);
+        const auto ByteOffset      = arg<wow64::PLARGE_INTEGER>(args, 5);
+        const auto Length          = arg<wow64::PLARGE_INTEGER>(args, 6);
+        const auto Key             = arg<wow64::ULONG>(args, 7);
+        const auto FailImmediately = arg<wow64::BOOLEAN>(args, 8);
+        const auto ExclusiveLock   = arg<wow64::BOOLEAN>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[84]);
@@ -2055,7 +2485,11 @@ opt<bpid_t> wow64::syscalls32::register_NtLockRegistryKey(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto KeyHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[85]);
@@ -2070,7 +2504,11 @@ opt<bpid_t> wow64::syscalls32::register_NtMakeTemporaryObject(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Handle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[86]);
@@ -2085,9 +2523,13 @@ opt<bpid_t> wow64::syscalls32::register_NtMapUserPhysicalPages(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto VirtualAddress = arg<wow64::PVOID>(core, 0);
-        const auto NumberOfPages  = arg<wow64::ULONG_PTR>(core, 1);
-        const auto UserPfnArra    = arg<wow64::PULONG_PTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto VirtualAddress = arg<wow64::PVOID>(args, 0);
+        const auto NumberOfPages  = arg<wow64::ULONG_PTR>(args, 1);
+        const auto UserPfnArra    = arg<wow64::PULONG_PTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[87]);
@@ -2102,7 +2544,11 @@ opt<bpid_t> wow64::syscalls32::register_NtModifyBootEntry(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto BootEntry = arg<wow64::PBOOT_ENTRY>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto BootEntry = arg<wow64::PBOOT_ENTRY>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[88]);
@@ -2117,15 +2563,19 @@ opt<bpid_t> wow64::syscalls32::register_NtNotifyChangeDirectoryFile(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto FileHandle       = arg<wow64::HANDLE>(core, 0);
-        const auto Event            = arg<wow64::HANDLE>(core, 1);
-        const auto ApcRoutine       = arg<wow64::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext       = arg<wow64::PVOID>(core, 3);
-        const auto IoStatusBlock    = arg<wow64::PIO_STATUS_BLOCK>(core, 4);
-        const auto Buffer           = arg<wow64::PVOID>(core, 5);
-        const auto Length           = arg<wow64::ULONG>(core, 6);
-        const auto CompletionFilter = arg<wow64::ULONG>(core, 7);
-        const auto WatchTree        = arg<wow64::BOOLEAN>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle       = arg<wow64::HANDLE>(args, 0);
+        const auto Event            = arg<wow64::HANDLE>(args, 1);
+        const auto ApcRoutine       = arg<wow64::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext       = arg<wow64::PVOID>(args, 3);
+        const auto IoStatusBlock    = arg<wow64::PIO_STATUS_BLOCK>(args, 4);
+        const auto Buffer           = arg<wow64::PVOID>(args, 5);
+        const auto Length           = arg<wow64::ULONG>(args, 6);
+        const auto CompletionFilter = arg<wow64::ULONG>(args, 7);
+        const auto WatchTree        = arg<wow64::BOOLEAN>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[89]);
@@ -2140,16 +2590,20 @@ opt<bpid_t> wow64::syscalls32::register_NtNotifyChangeKey(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto KeyHandle        = arg<wow64::HANDLE>(core, 0);
-        const auto Event            = arg<wow64::HANDLE>(core, 1);
-        const auto ApcRoutine       = arg<wow64::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext       = arg<wow64::PVOID>(core, 3);
-        const auto IoStatusBlock    = arg<wow64::PIO_STATUS_BLOCK>(core, 4);
-        const auto CompletionFilter = arg<wow64::ULONG>(core, 5);
-        const auto WatchTree        = arg<wow64::BOOLEAN>(core, 6);
-        const auto Buffer           = arg<wow64::PVOID>(core, 7);
-        const auto BufferSize       = arg<wow64::ULONG>(core, 8);
-        const auto Asynchronous     = arg<wow64::BOOLEAN>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle        = arg<wow64::HANDLE>(args, 0);
+        const auto Event            = arg<wow64::HANDLE>(args, 1);
+        const auto ApcRoutine       = arg<wow64::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext       = arg<wow64::PVOID>(args, 3);
+        const auto IoStatusBlock    = arg<wow64::PIO_STATUS_BLOCK>(args, 4);
+        const auto CompletionFilter = arg<wow64::ULONG>(args, 5);
+        const auto WatchTree        = arg<wow64::BOOLEAN>(args, 6);
+        const auto Buffer           = arg<wow64::PVOID>(args, 7);
+        const auto BufferSize       = arg<wow64::ULONG>(args, 8);
+        const auto Asynchronous     = arg<wow64::BOOLEAN>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[90]);
@@ -2164,18 +2618,22 @@ opt<bpid_t> wow64::syscalls32::register_NtNotifyChangeMultipleKeys(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto MasterKeyHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto Count            = arg<wow64::ULONG>(core, 1);
-        const auto SlaveObjects     = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Event            = arg<wow64::HANDLE>(core, 3);
-        const auto ApcRoutine       = arg<wow64::PIO_APC_ROUTINE>(core, 4);
-        const auto ApcContext       = arg<wow64::PVOID>(core, 5);
-        const auto IoStatusBlock    = arg<wow64::PIO_STATUS_BLOCK>(core, 6);
-        const auto CompletionFilter = arg<wow64::ULONG>(core, 7);
-        const auto WatchTree        = arg<wow64::BOOLEAN>(core, 8);
-        const auto Buffer           = arg<wow64::PVOID>(core, 9);
-        const auto BufferSize       = arg<wow64::ULONG>(core, 10);
-        const auto Asynchronous     = arg<wow64::BOOLEAN>(core, 11);
+        auto args = std::array<arg_t, 12>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MasterKeyHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto Count            = arg<wow64::ULONG>(args, 1);
+        const auto SlaveObjects     = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Event            = arg<wow64::HANDLE>(args, 3);
+        const auto ApcRoutine       = arg<wow64::PIO_APC_ROUTINE>(args, 4);
+        const auto ApcContext       = arg<wow64::PVOID>(args, 5);
+        const auto IoStatusBlock    = arg<wow64::PIO_STATUS_BLOCK>(args, 6);
+        const auto CompletionFilter = arg<wow64::ULONG>(args, 7);
+        const auto WatchTree        = arg<wow64::BOOLEAN>(args, 8);
+        const auto Buffer           = arg<wow64::PVOID>(args, 9);
+        const auto BufferSize       = arg<wow64::ULONG>(args, 10);
+        const auto Asynchronous     = arg<wow64::BOOLEAN>(args, 11);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[91]);
@@ -2190,14 +2648,18 @@ opt<bpid_t> wow64::syscalls32::register_NtNotifyChangeSession(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Session         = arg<wow64::HANDLE>(core, 0);
-        const auto IoStateSequence = arg<wow64::ULONG>(core, 1);
-        const auto Reserved        = arg<wow64::PVOID>(core, 2);
-        const auto Action          = arg<wow64::ULONG>(core, 3);
-        const auto IoState         = arg<wow64::IO_SESSION_STATE>(core, 4);
-        const auto IoState2        = arg<wow64::IO_SESSION_STATE>(core, 5);
-        const auto Buffer          = arg<wow64::PVOID>(core, 6);
-        const auto BufferSize      = arg<wow64::ULONG>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Session         = arg<wow64::HANDLE>(args, 0);
+        const auto IoStateSequence = arg<wow64::ULONG>(args, 1);
+        const auto Reserved        = arg<wow64::PVOID>(args, 2);
+        const auto Action          = arg<wow64::ULONG>(args, 3);
+        const auto IoState         = arg<wow64::IO_SESSION_STATE>(args, 4);
+        const auto IoState2        = arg<wow64::IO_SESSION_STATE>(args, 5);
+        const auto Buffer          = arg<wow64::PVOID>(args, 6);
+        const auto BufferSize      = arg<wow64::ULONG>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[92]);
@@ -2212,9 +2674,13 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenEvent(proc_t proc, const on_NtOpen
     {
         auto& core = d_->core;
 
-        const auto EventHandle      = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle      = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[93]);
@@ -2229,9 +2695,13 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenEventPair(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle  = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle  = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[94]);
@@ -2246,12 +2716,16 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenFile(proc_t proc, const on_NtOpenF
     {
         auto& core = d_->core;
 
-        const auto FileHandle       = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto IoStatusBlock    = arg<wow64::PIO_STATUS_BLOCK>(core, 3);
-        const auto ShareAccess      = arg<wow64::ULONG>(core, 4);
-        const auto OpenOptions      = arg<wow64::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle       = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto IoStatusBlock    = arg<wow64::PIO_STATUS_BLOCK>(args, 3);
+        const auto ShareAccess      = arg<wow64::ULONG>(args, 4);
+        const auto OpenOptions      = arg<wow64::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[95]);
@@ -2266,10 +2740,14 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenKeyTransacted(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto KeyHandle         = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto TransactionHandle = arg<wow64::HANDLE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle         = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto TransactionHandle = arg<wow64::HANDLE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[96]);
@@ -2284,11 +2762,15 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenKeyTransactedEx(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto KeyHandle         = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto OpenOptions       = arg<wow64::ULONG>(core, 3);
-        const auto TransactionHandle = arg<wow64::HANDLE>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle         = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto OpenOptions       = arg<wow64::ULONG>(args, 3);
+        const auto TransactionHandle = arg<wow64::HANDLE>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[97]);
@@ -2303,9 +2785,13 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenKeyedEvent(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto KeyedEventHandle = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyedEventHandle = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[98]);
@@ -2320,9 +2806,13 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenMutant(proc_t proc, const on_NtOpe
     {
         auto& core = d_->core;
 
-        const auto MutantHandle     = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MutantHandle     = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[99]);
@@ -2337,10 +2827,14 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenPrivateNamespace(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto NamespaceHandle    = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto BoundaryDescriptor = arg<wow64::PVOID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto NamespaceHandle    = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto BoundaryDescriptor = arg<wow64::PVOID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[100]);
@@ -2355,9 +2849,13 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenSection(proc_t proc, const on_NtOp
     {
         auto& core = d_->core;
 
-        const auto SectionHandle    = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionHandle    = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[101]);
@@ -2372,9 +2870,13 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenSemaphore(proc_t proc, const on_Nt
     {
         auto& core = d_->core;
 
-        const auto SemaphoreHandle  = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SemaphoreHandle  = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[102]);
@@ -2389,9 +2891,13 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenSession(proc_t proc, const on_NtOp
     {
         auto& core = d_->core;
 
-        const auto SessionHandle    = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SessionHandle    = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[103]);
@@ -2406,9 +2912,13 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenSymbolicLinkObject(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto LinkHandle       = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto LinkHandle       = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[104]);
@@ -2423,10 +2933,14 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenThreadToken(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto DesiredAccess = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto OpenAsSelf    = arg<wow64::BOOLEAN>(core, 2);
-        const auto TokenHandle   = arg<wow64::PHANDLE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto DesiredAccess = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto OpenAsSelf    = arg<wow64::BOOLEAN>(args, 2);
+        const auto TokenHandle   = arg<wow64::PHANDLE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[105]);
@@ -2441,11 +2955,15 @@ opt<bpid_t> wow64::syscalls32::register_NtOpenThreadTokenEx(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle     = arg<wow64::HANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto OpenAsSelf       = arg<wow64::BOOLEAN>(core, 2);
-        const auto HandleAttributes = arg<wow64::ULONG>(core, 3);
-        const auto TokenHandle      = arg<wow64::PHANDLE>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle     = arg<wow64::HANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto OpenAsSelf       = arg<wow64::BOOLEAN>(args, 2);
+        const auto HandleAttributes = arg<wow64::ULONG>(args, 3);
+        const auto TokenHandle      = arg<wow64::PHANDLE>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[106]);
@@ -2460,9 +2978,13 @@ opt<bpid_t> wow64::syscalls32::register_NtPlugPlayControl(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto PnPControlClass      = arg<wow64::PLUGPLAY_CONTROL_CLASS>(core, 0);
-        const auto PnPControlData       = arg<wow64::PVOID>(core, 1);
-        const auto PnPControlDataLength = arg<wow64::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PnPControlClass      = arg<wow64::PLUGPLAY_CONTROL_CLASS>(args, 0);
+        const auto PnPControlData       = arg<wow64::PVOID>(args, 1);
+        const auto PnPControlDataLength = arg<wow64::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[107]);
@@ -2477,8 +2999,12 @@ opt<bpid_t> wow64::syscalls32::register_NtPrePrepareEnlistment(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<wow64::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<wow64::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[108]);
@@ -2493,8 +3019,12 @@ opt<bpid_t> wow64::syscalls32::register_NtPrepareComplete(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<wow64::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<wow64::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[109]);
@@ -2509,11 +3039,15 @@ opt<bpid_t> wow64::syscalls32::register_NtPrivilegedServiceAuditAlarm(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto SubsystemName = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto ServiceName   = arg<wow64::PUNICODE_STRING>(core, 1);
-        const auto ClientToken   = arg<wow64::HANDLE>(core, 2);
-        const auto Privileges    = arg<wow64::PPRIVILEGE_SET>(core, 3);
-        const auto AccessGranted = arg<wow64::BOOLEAN>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto ServiceName   = arg<wow64::PUNICODE_STRING>(args, 1);
+        const auto ClientToken   = arg<wow64::HANDLE>(args, 2);
+        const auto Privileges    = arg<wow64::PPRIVILEGE_SET>(args, 3);
+        const auto AccessGranted = arg<wow64::BOOLEAN>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[110]);
@@ -2528,10 +3062,14 @@ opt<bpid_t> wow64::syscalls32::register_NtPropagationComplete(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle = arg<wow64::HANDLE>(core, 0);
-        const auto RequestCookie         = arg<wow64::ULONG>(core, 1);
-        const auto BufferLength          = arg<wow64::ULONG>(core, 2);
-        const auto Buffer                = arg<wow64::PVOID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle = arg<wow64::HANDLE>(args, 0);
+        const auto RequestCookie         = arg<wow64::ULONG>(args, 1);
+        const auto BufferLength          = arg<wow64::ULONG>(args, 2);
+        const auto Buffer                = arg<wow64::PVOID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[111]);
@@ -2546,8 +3084,12 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryDebugFilterState(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto ComponentId = arg<wow64::ULONG>(core, 0);
-        const auto Level       = arg<wow64::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ComponentId = arg<wow64::ULONG>(args, 0);
+        const auto Level       = arg<wow64::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[112]);
@@ -2562,8 +3104,12 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryDefaultLocale(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto UserProfile     = arg<wow64::BOOLEAN>(core, 0);
-        const auto DefaultLocaleId = arg<wow64::PLCID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto UserProfile     = arg<wow64::BOOLEAN>(args, 0);
+        const auto DefaultLocaleId = arg<wow64::PLCID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[113]);
@@ -2578,8 +3124,12 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryDriverEntryOrder(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto Ids   = arg<wow64::PULONG>(core, 0);
-        const auto Count = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Ids   = arg<wow64::PULONG>(args, 0);
+        const auto Count = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[114]);
@@ -2594,11 +3144,15 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryEvent(proc_t proc, const on_NtQue
     {
         auto& core = d_->core;
 
-        const auto EventHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto EventInformationClass  = arg<wow64::EVENT_INFORMATION_CLASS>(core, 1);
-        const auto EventInformation       = arg<wow64::PVOID>(core, 2);
-        const auto EventInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength           = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto EventInformationClass  = arg<wow64::EVENT_INFORMATION_CLASS>(args, 1);
+        const auto EventInformation       = arg<wow64::PVOID>(args, 2);
+        const auto EventInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength           = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[115]);
@@ -2613,11 +3167,15 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryInformationAtom(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto Atom                  = arg<wow64::RTL_ATOM>(core, 0);
-        const auto InformationClass      = arg<wow64::ATOM_INFORMATION_CLASS>(core, 1);
-        const auto AtomInformation       = arg<wow64::PVOID>(core, 2);
-        const auto AtomInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength          = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Atom                  = arg<wow64::RTL_ATOM>(args, 0);
+        const auto InformationClass      = arg<wow64::ATOM_INFORMATION_CLASS>(args, 1);
+        const auto AtomInformation       = arg<wow64::PVOID>(args, 2);
+        const auto AtomInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength          = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[116]);
@@ -2632,11 +3190,15 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryInformationThread(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto ThreadInformationClass  = arg<wow64::THREADINFOCLASS>(core, 1);
-        const auto ThreadInformation       = arg<wow64::PVOID>(core, 2);
-        const auto ThreadInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength            = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto ThreadInformationClass  = arg<wow64::THREADINFOCLASS>(args, 1);
+        const auto ThreadInformation       = arg<wow64::PVOID>(args, 2);
+        const auto ThreadInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength            = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[117]);
@@ -2651,11 +3213,15 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryInformationTransactionManager(pro
     {
         auto& core = d_->core;
 
-        const auto TransactionManagerHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto TransactionManagerInformationClass  = arg<wow64::TRANSACTIONMANAGER_INFORMATION_CLASS>(core, 1);
-        const auto TransactionManagerInformation       = arg<wow64::PVOID>(core, 2);
-        const auto TransactionManagerInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength                        = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionManagerHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto TransactionManagerInformationClass  = arg<wow64::TRANSACTIONMANAGER_INFORMATION_CLASS>(args, 1);
+        const auto TransactionManagerInformation       = arg<wow64::PVOID>(args, 2);
+        const auto TransactionManagerInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength                        = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[118]);
@@ -2670,7 +3236,11 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryInstallUILanguage(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto STARInstallUILanguageId = arg<wow64::LANGID>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto STARInstallUILanguageId = arg<wow64::LANGID>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[119]);
@@ -2685,8 +3255,12 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryIntervalProfile(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto ProfileSource = arg<wow64::KPROFILE_SOURCE>(core, 0);
-        const auto Interval      = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProfileSource = arg<wow64::KPROFILE_SOURCE>(args, 0);
+        const auto Interval      = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[120]);
@@ -2701,11 +3275,15 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryIoCompletion(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto IoCompletionInformationClass  = arg<wow64::IO_COMPLETION_INFORMATION_CLASS>(core, 1);
-        const auto IoCompletionInformation       = arg<wow64::PVOID>(core, 2);
-        const auto IoCompletionInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength                  = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto IoCompletionInformationClass  = arg<wow64::IO_COMPLETION_INFORMATION_CLASS>(args, 1);
+        const auto IoCompletionInformation       = arg<wow64::PVOID>(args, 2);
+        const auto IoCompletionInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength                  = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[121]);
@@ -2720,11 +3298,15 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryLicenseValue(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto Name           = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto Type           = arg<wow64::PULONG>(core, 1);
-        const auto Buffer         = arg<wow64::PVOID>(core, 2);
-        const auto Length         = arg<wow64::ULONG>(core, 3);
-        const auto ReturnedLength = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Name           = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto Type           = arg<wow64::PULONG>(args, 1);
+        const auto Buffer         = arg<wow64::PVOID>(args, 2);
+        const auto Length         = arg<wow64::ULONG>(args, 3);
+        const auto ReturnedLength = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[122]);
@@ -2739,12 +3321,16 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryMultipleValueKey(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto KeyHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto ValueEntries         = arg<wow64::PKEY_VALUE_ENTRY>(core, 1);
-        const auto EntryCount           = arg<wow64::ULONG>(core, 2);
-        const auto ValueBuffer          = arg<wow64::PVOID>(core, 3);
-        const auto BufferLength         = arg<wow64::PULONG>(core, 4);
-        const auto RequiredBufferLength = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto ValueEntries         = arg<wow64::PKEY_VALUE_ENTRY>(args, 1);
+        const auto EntryCount           = arg<wow64::ULONG>(args, 2);
+        const auto ValueBuffer          = arg<wow64::PVOID>(args, 3);
+        const auto BufferLength         = arg<wow64::PULONG>(args, 4);
+        const auto RequiredBufferLength = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[123]);
@@ -2759,11 +3345,15 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryMutant(proc_t proc, const on_NtQu
     {
         auto& core = d_->core;
 
-        const auto MutantHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto MutantInformationClass  = arg<wow64::MUTANT_INFORMATION_CLASS>(core, 1);
-        const auto MutantInformation       = arg<wow64::PVOID>(core, 2);
-        const auto MutantInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength            = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MutantHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto MutantInformationClass  = arg<wow64::MUTANT_INFORMATION_CLASS>(args, 1);
+        const auto MutantInformation       = arg<wow64::PVOID>(args, 2);
+        const auto MutantInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength            = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[124]);
@@ -2778,11 +3368,15 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryObject(proc_t proc, const on_NtQu
     {
         auto& core = d_->core;
 
-        const auto Handle                  = arg<wow64::HANDLE>(core, 0);
-        const auto ObjectInformationClass  = arg<wow64::OBJECT_INFORMATION_CLASS>(core, 1);
-        const auto ObjectInformation       = arg<wow64::PVOID>(core, 2);
-        const auto ObjectInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength            = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle                  = arg<wow64::HANDLE>(args, 0);
+        const auto ObjectInformationClass  = arg<wow64::OBJECT_INFORMATION_CLASS>(args, 1);
+        const auto ObjectInformation       = arg<wow64::PVOID>(args, 2);
+        const auto ObjectInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength            = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[125]);
@@ -2797,8 +3391,12 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryOpenSubKeys(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto TargetKey   = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
-        const auto HandleCount = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey   = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
+        const auto HandleCount = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[126]);
@@ -2813,10 +3411,14 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryOpenSubKeysEx(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto TargetKey    = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
-        const auto BufferLength = arg<wow64::ULONG>(core, 1);
-        const auto Buffer       = arg<wow64::PVOID>(core, 2);
-        const auto RequiredSize = arg<wow64::PULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey    = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
+        const auto BufferLength = arg<wow64::ULONG>(args, 1);
+        const auto Buffer       = arg<wow64::PVOID>(args, 2);
+        const auto RequiredSize = arg<wow64::PULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[127]);
@@ -2831,8 +3433,12 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryPerformanceCounter(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto PerformanceCounter   = arg<wow64::PLARGE_INTEGER>(core, 0);
-        const auto PerformanceFrequency = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PerformanceCounter   = arg<wow64::PLARGE_INTEGER>(args, 0);
+        const auto PerformanceFrequency = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[128]);
@@ -2847,11 +3453,15 @@ opt<bpid_t> wow64::syscalls32::register_NtQuerySecurityObject(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Handle              = arg<wow64::HANDLE>(core, 0);
-        const auto SecurityInformation = arg<wow64::SECURITY_INFORMATION>(core, 1);
-        const auto SecurityDescriptor  = arg<wow64::PSECURITY_DESCRIPTOR>(core, 2);
-        const auto Length              = arg<wow64::ULONG>(core, 3);
-        const auto LengthNeeded        = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle              = arg<wow64::HANDLE>(args, 0);
+        const auto SecurityInformation = arg<wow64::SECURITY_INFORMATION>(args, 1);
+        const auto SecurityDescriptor  = arg<wow64::PSECURITY_DESCRIPTOR>(args, 2);
+        const auto Length              = arg<wow64::ULONG>(args, 3);
+        const auto LengthNeeded        = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[129]);
@@ -2866,10 +3476,14 @@ opt<bpid_t> wow64::syscalls32::register_NtQuerySystemInformation(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto SystemInformationClass  = arg<wow64::SYSTEM_INFORMATION_CLASS>(core, 0);
-        const auto SystemInformation       = arg<wow64::PVOID>(core, 1);
-        const auto SystemInformationLength = arg<wow64::ULONG>(core, 2);
-        const auto ReturnLength            = arg<wow64::PULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemInformationClass  = arg<wow64::SYSTEM_INFORMATION_CLASS>(args, 0);
+        const auto SystemInformation       = arg<wow64::PVOID>(args, 1);
+        const auto SystemInformationLength = arg<wow64::ULONG>(args, 2);
+        const auto ReturnLength            = arg<wow64::PULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[130]);
@@ -2884,7 +3498,11 @@ opt<bpid_t> wow64::syscalls32::register_NtQuerySystemTime(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto SystemTime = arg<wow64::PLARGE_INTEGER>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemTime = arg<wow64::PLARGE_INTEGER>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[131]);
@@ -2899,9 +3517,13 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryTimerResolution(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto MaximumTime = arg<wow64::PULONG>(core, 0);
-        const auto MinimumTime = arg<wow64::PULONG>(core, 1);
-        const auto CurrentTime = arg<wow64::PULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MaximumTime = arg<wow64::PULONG>(args, 0);
+        const auto MinimumTime = arg<wow64::PULONG>(args, 1);
+        const auto CurrentTime = arg<wow64::PULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[132]);
@@ -2916,12 +3538,16 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryVirtualMemory(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle           = arg<wow64::HANDLE>(core, 0);
-        const auto BaseAddress             = arg<wow64::PVOID>(core, 1);
-        const auto MemoryInformationClass  = arg<wow64::MEMORY_INFORMATION_CLASS>(core, 2);
-        const auto MemoryInformation       = arg<wow64::PVOID>(core, 3);
-        const auto MemoryInformationLength = arg<wow64::SIZE_T>(core, 4);
-        const auto ReturnLength            = arg<wow64::PSIZE_T>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle           = arg<wow64::HANDLE>(args, 0);
+        const auto BaseAddress             = arg<wow64::PVOID>(args, 1);
+        const auto MemoryInformationClass  = arg<wow64::MEMORY_INFORMATION_CLASS>(args, 2);
+        const auto MemoryInformation       = arg<wow64::PVOID>(args, 3);
+        const auto MemoryInformationLength = arg<wow64::SIZE_T>(args, 4);
+        const auto ReturnLength            = arg<wow64::PSIZE_T>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[133]);
@@ -2936,11 +3562,15 @@ opt<bpid_t> wow64::syscalls32::register_NtQueryVolumeInformationFile(proc_t proc
     {
         auto& core = d_->core;
 
-        const auto FileHandle         = arg<wow64::HANDLE>(core, 0);
-        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
-        const auto FsInformation      = arg<wow64::PVOID>(core, 2);
-        const auto Length             = arg<wow64::ULONG>(core, 3);
-        const auto FsInformationClass = arg<wow64::FS_INFORMATION_CLASS>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle         = arg<wow64::HANDLE>(args, 0);
+        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
+        const auto FsInformation      = arg<wow64::PVOID>(args, 2);
+        const auto Length             = arg<wow64::ULONG>(args, 3);
+        const auto FsInformationClass = arg<wow64::FS_INFORMATION_CLASS>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[134]);
@@ -2955,11 +3585,15 @@ opt<bpid_t> wow64::syscalls32::register_NtQueueApcThread(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle = arg<wow64::HANDLE>(core, 0);
-        const auto ApcRoutine   = arg<wow64::PPS_APC_ROUTINE>(core, 1);
-        const auto ApcArgument1 = arg<wow64::PVOID>(core, 2);
-        const auto ApcArgument2 = arg<wow64::PVOID>(core, 3);
-        const auto ApcArgument3 = arg<wow64::PVOID>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle = arg<wow64::HANDLE>(args, 0);
+        const auto ApcRoutine   = arg<wow64::PPS_APC_ROUTINE>(args, 1);
+        const auto ApcArgument1 = arg<wow64::PVOID>(args, 2);
+        const auto ApcArgument2 = arg<wow64::PVOID>(args, 3);
+        const auto ApcArgument3 = arg<wow64::PVOID>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[135]);
@@ -2974,12 +3608,16 @@ opt<bpid_t> wow64::syscalls32::register_NtQueueApcThreadEx(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle         = arg<wow64::HANDLE>(core, 0);
-        const auto UserApcReserveHandle = arg<wow64::HANDLE>(core, 1);
-        const auto ApcRoutine           = arg<wow64::PPS_APC_ROUTINE>(core, 2);
-        const auto ApcArgument1         = arg<wow64::PVOID>(core, 3);
-        const auto ApcArgument2         = arg<wow64::PVOID>(core, 4);
-        const auto ApcArgument3         = arg<wow64::PVOID>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle         = arg<wow64::HANDLE>(args, 0);
+        const auto UserApcReserveHandle = arg<wow64::HANDLE>(args, 1);
+        const auto ApcRoutine           = arg<wow64::PPS_APC_ROUTINE>(args, 2);
+        const auto ApcArgument1         = arg<wow64::PVOID>(args, 3);
+        const auto ApcArgument2         = arg<wow64::PVOID>(args, 4);
+        const auto ApcArgument3         = arg<wow64::PVOID>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[136]);
@@ -2994,15 +3632,19 @@ opt<bpid_t> wow64::syscalls32::register_NtReadFile(proc_t proc, const on_NtReadF
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto Event         = arg<wow64::HANDLE>(core, 1);
-        const auto ApcRoutine    = arg<wow64::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext    = arg<wow64::PVOID>(core, 3);
-        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(core, 4);
-        const auto Buffer        = arg<wow64::PVOID>(core, 5);
-        const auto Length        = arg<wow64::ULONG>(core, 6);
-        const auto ByteOffset    = arg<wow64::PLARGE_INTEGER>(core, 7);
-        const auto Key           = arg<wow64::PULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto Event         = arg<wow64::HANDLE>(args, 1);
+        const auto ApcRoutine    = arg<wow64::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext    = arg<wow64::PVOID>(args, 3);
+        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(args, 4);
+        const auto Buffer        = arg<wow64::PVOID>(args, 5);
+        const auto Length        = arg<wow64::ULONG>(args, 6);
+        const auto ByteOffset    = arg<wow64::PLARGE_INTEGER>(args, 7);
+        const auto Key           = arg<wow64::PULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[137]);
@@ -3017,15 +3659,19 @@ opt<bpid_t> wow64::syscalls32::register_NtReadFileScatter(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto Event         = arg<wow64::HANDLE>(core, 1);
-        const auto ApcRoutine    = arg<wow64::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext    = arg<wow64::PVOID>(core, 3);
-        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(core, 4);
-        const auto SegmentArray  = arg<wow64::PFILE_SEGMENT_ELEMENT>(core, 5);
-        const auto Length        = arg<wow64::ULONG>(core, 6);
-        const auto ByteOffset    = arg<wow64::PLARGE_INTEGER>(core, 7);
-        const auto Key           = arg<wow64::PULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto Event         = arg<wow64::HANDLE>(args, 1);
+        const auto ApcRoutine    = arg<wow64::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext    = arg<wow64::PVOID>(args, 3);
+        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(args, 4);
+        const auto SegmentArray  = arg<wow64::PFILE_SEGMENT_ELEMENT>(args, 5);
+        const auto Length        = arg<wow64::ULONG>(args, 6);
+        const auto ByteOffset    = arg<wow64::PLARGE_INTEGER>(args, 7);
+        const auto Key           = arg<wow64::PULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[138]);
@@ -3040,11 +3686,15 @@ opt<bpid_t> wow64::syscalls32::register_NtReadVirtualMemory(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle     = arg<wow64::HANDLE>(core, 0);
-        const auto BaseAddress       = arg<wow64::PVOID>(core, 1);
-        const auto Buffer            = arg<wow64::PVOID>(core, 2);
-        const auto BufferSize        = arg<wow64::SIZE_T>(core, 3);
-        const auto NumberOfBytesRead = arg<wow64::PSIZE_T>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle     = arg<wow64::HANDLE>(args, 0);
+        const auto BaseAddress       = arg<wow64::PVOID>(args, 1);
+        const auto Buffer            = arg<wow64::PVOID>(args, 2);
+        const auto BufferSize        = arg<wow64::SIZE_T>(args, 3);
+        const auto NumberOfBytesRead = arg<wow64::PSIZE_T>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[139]);
@@ -3059,8 +3709,12 @@ opt<bpid_t> wow64::syscalls32::register_NtRecoverEnlistment(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<wow64::HANDLE>(core, 0);
-        const auto EnlistmentKey    = arg<wow64::PVOID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<wow64::HANDLE>(args, 0);
+        const auto EnlistmentKey    = arg<wow64::PVOID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[140]);
@@ -3075,7 +3729,11 @@ opt<bpid_t> wow64::syscalls32::register_NtRecoverResourceManager(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[141]);
@@ -3090,10 +3748,14 @@ opt<bpid_t> wow64::syscalls32::register_NtReleaseKeyedEvent(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto KeyedEventHandle = arg<wow64::HANDLE>(core, 0);
-        const auto KeyValue         = arg<wow64::PVOID>(core, 1);
-        const auto Alertable        = arg<wow64::BOOLEAN>(core, 2);
-        const auto Timeout          = arg<wow64::PLARGE_INTEGER>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyedEventHandle = arg<wow64::HANDLE>(args, 0);
+        const auto KeyValue         = arg<wow64::PVOID>(args, 1);
+        const auto Alertable        = arg<wow64::BOOLEAN>(args, 2);
+        const auto Timeout          = arg<wow64::PLARGE_INTEGER>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[142]);
@@ -3108,9 +3770,13 @@ opt<bpid_t> wow64::syscalls32::register_NtReleaseSemaphore(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto SemaphoreHandle = arg<wow64::HANDLE>(core, 0);
-        const auto ReleaseCount    = arg<wow64::LONG>(core, 1);
-        const auto PreviousCount   = arg<wow64::PLONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SemaphoreHandle = arg<wow64::HANDLE>(args, 0);
+        const auto ReleaseCount    = arg<wow64::LONG>(args, 1);
+        const auto PreviousCount   = arg<wow64::PLONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[143]);
@@ -3125,8 +3791,12 @@ opt<bpid_t> wow64::syscalls32::register_NtRenameTransactionManager(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto LogFileName                    = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto ExistingTransactionManagerGuid = arg<wow64::LPGUID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto LogFileName                    = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto ExistingTransactionManagerGuid = arg<wow64::LPGUID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[144]);
@@ -3141,9 +3811,13 @@ opt<bpid_t> wow64::syscalls32::register_NtReplacePartitionUnit(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto TargetInstancePath = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto SpareInstancePath  = arg<wow64::PUNICODE_STRING>(core, 1);
-        const auto Flags              = arg<wow64::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetInstancePath = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto SpareInstancePath  = arg<wow64::PUNICODE_STRING>(args, 1);
+        const auto Flags              = arg<wow64::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[145]);
@@ -3158,10 +3832,14 @@ opt<bpid_t> wow64::syscalls32::register_NtReplyWaitReceivePort(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto PortHandle      = arg<wow64::HANDLE>(core, 0);
-        const auto STARPortContext = arg<wow64::PVOID>(core, 1);
-        const auto ReplyMessage    = arg<wow64::PPORT_MESSAGE>(core, 2);
-        const auto ReceiveMessage  = arg<wow64::PPORT_MESSAGE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle      = arg<wow64::HANDLE>(args, 0);
+        const auto STARPortContext = arg<wow64::PVOID>(args, 1);
+        const auto ReplyMessage    = arg<wow64::PPORT_MESSAGE>(args, 2);
+        const auto ReceiveMessage  = arg<wow64::PPORT_MESSAGE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[146]);
@@ -3176,11 +3854,15 @@ opt<bpid_t> wow64::syscalls32::register_NtReplyWaitReceivePortEx(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto PortHandle      = arg<wow64::HANDLE>(core, 0);
-        const auto STARPortContext = arg<wow64::PVOID>(core, 1);
-        const auto ReplyMessage    = arg<wow64::PPORT_MESSAGE>(core, 2);
-        const auto ReceiveMessage  = arg<wow64::PPORT_MESSAGE>(core, 3);
-        const auto Timeout         = arg<wow64::PLARGE_INTEGER>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle      = arg<wow64::HANDLE>(args, 0);
+        const auto STARPortContext = arg<wow64::PVOID>(args, 1);
+        const auto ReplyMessage    = arg<wow64::PPORT_MESSAGE>(args, 2);
+        const auto ReceiveMessage  = arg<wow64::PPORT_MESSAGE>(args, 3);
+        const auto Timeout         = arg<wow64::PLARGE_INTEGER>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[147]);
@@ -3195,8 +3877,12 @@ opt<bpid_t> wow64::syscalls32::register_NtReplyWaitReplyPort(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto PortHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto ReplyMessage = arg<wow64::PPORT_MESSAGE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto ReplyMessage = arg<wow64::PPORT_MESSAGE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[148]);
@@ -3211,9 +3897,13 @@ opt<bpid_t> wow64::syscalls32::register_NtRequestWaitReplyPort(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto PortHandle     = arg<wow64::HANDLE>(core, 0);
-        const auto RequestMessage = arg<wow64::PPORT_MESSAGE>(core, 1);
-        const auto ReplyMessage   = arg<wow64::PPORT_MESSAGE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle     = arg<wow64::HANDLE>(args, 0);
+        const auto RequestMessage = arg<wow64::PPORT_MESSAGE>(args, 1);
+        const auto ReplyMessage   = arg<wow64::PPORT_MESSAGE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[149]);
@@ -3228,8 +3918,12 @@ opt<bpid_t> wow64::syscalls32::register_NtResetEvent(proc_t proc, const on_NtRes
     {
         auto& core = d_->core;
 
-        const auto EventHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto PreviousState = arg<wow64::PLONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto PreviousState = arg<wow64::PLONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[150]);
@@ -3244,9 +3938,13 @@ opt<bpid_t> wow64::syscalls32::register_NtRestoreKey(proc_t proc, const on_NtRes
     {
         auto& core = d_->core;
 
-        const auto KeyHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto FileHandle = arg<wow64::HANDLE>(core, 1);
-        const auto Flags      = arg<wow64::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto FileHandle = arg<wow64::HANDLE>(args, 1);
+        const auto Flags      = arg<wow64::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[151]);
@@ -3261,8 +3959,12 @@ opt<bpid_t> wow64::syscalls32::register_NtRollbackEnlistment(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<wow64::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<wow64::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[152]);
@@ -3277,8 +3979,12 @@ opt<bpid_t> wow64::syscalls32::register_NtRollbackTransaction(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle = arg<wow64::HANDLE>(core, 0);
-        const auto Wait              = arg<wow64::BOOLEAN>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle = arg<wow64::HANDLE>(args, 0);
+        const auto Wait              = arg<wow64::BOOLEAN>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[153]);
@@ -3293,8 +3999,12 @@ opt<bpid_t> wow64::syscalls32::register_NtRollforwardTransactionManager(proc_t p
     {
         auto& core = d_->core;
 
-        const auto TransactionManagerHandle = arg<wow64::HANDLE>(core, 0);
-        const auto TmVirtualClock           = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionManagerHandle = arg<wow64::HANDLE>(args, 0);
+        const auto TmVirtualClock           = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[154]);
@@ -3309,8 +4019,12 @@ opt<bpid_t> wow64::syscalls32::register_NtSaveKey(proc_t proc, const on_NtSaveKe
     {
         auto& core = d_->core;
 
-        const auto KeyHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto FileHandle = arg<wow64::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto FileHandle = arg<wow64::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[155]);
@@ -3325,9 +4039,13 @@ opt<bpid_t> wow64::syscalls32::register_NtSaveKeyEx(proc_t proc, const on_NtSave
     {
         auto& core = d_->core;
 
-        const auto KeyHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto FileHandle = arg<wow64::HANDLE>(core, 1);
-        const auto Format     = arg<wow64::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto FileHandle = arg<wow64::HANDLE>(args, 1);
+        const auto Format     = arg<wow64::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[156]);
@@ -3342,9 +4060,13 @@ opt<bpid_t> wow64::syscalls32::register_NtSaveMergedKeys(proc_t proc, const on_N
     {
         auto& core = d_->core;
 
-        const auto HighPrecedenceKeyHandle = arg<wow64::HANDLE>(core, 0);
-        const auto LowPrecedenceKeyHandle  = arg<wow64::HANDLE>(core, 1);
-        const auto FileHandle              = arg<wow64::HANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto HighPrecedenceKeyHandle = arg<wow64::HANDLE>(args, 0);
+        const auto LowPrecedenceKeyHandle  = arg<wow64::HANDLE>(args, 1);
+        const auto FileHandle              = arg<wow64::HANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[157]);
@@ -3359,15 +4081,19 @@ opt<bpid_t> wow64::syscalls32::register_NtSecureConnectPort(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto PortHandle                  = arg<wow64::PHANDLE>(core, 0);
-        const auto PortName                    = arg<wow64::PUNICODE_STRING>(core, 1);
-        const auto SecurityQos                 = arg<wow64::PSECURITY_QUALITY_OF_SERVICE>(core, 2);
-        const auto ClientView                  = arg<wow64::PPORT_VIEW>(core, 3);
-        const auto RequiredServerSid           = arg<wow64::PSID>(core, 4);
-        const auto ServerView                  = arg<wow64::PREMOTE_PORT_VIEW>(core, 5);
-        const auto MaxMessageLength            = arg<wow64::PULONG>(core, 6);
-        const auto ConnectionInformation       = arg<wow64::PVOID>(core, 7);
-        const auto ConnectionInformationLength = arg<wow64::PULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle                  = arg<wow64::PHANDLE>(args, 0);
+        const auto PortName                    = arg<wow64::PUNICODE_STRING>(args, 1);
+        const auto SecurityQos                 = arg<wow64::PSECURITY_QUALITY_OF_SERVICE>(args, 2);
+        const auto ClientView                  = arg<wow64::PPORT_VIEW>(args, 3);
+        const auto RequiredServerSid           = arg<wow64::PSID>(args, 4);
+        const auto ServerView                  = arg<wow64::PREMOTE_PORT_VIEW>(args, 5);
+        const auto MaxMessageLength            = arg<wow64::PULONG>(args, 6);
+        const auto ConnectionInformation       = arg<wow64::PVOID>(args, 7);
+        const auto ConnectionInformationLength = arg<wow64::PULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[158]);
@@ -3395,9 +4121,13 @@ opt<bpid_t> wow64::syscalls32::register_NtSetDebugFilterState(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ComponentId = arg<wow64::ULONG>(core, 0);
-        const auto Level       = arg<wow64::ULONG>(core, 1);
-        const auto State       = arg<wow64::BOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ComponentId = arg<wow64::ULONG>(args, 0);
+        const auto Level       = arg<wow64::ULONG>(args, 1);
+        const auto State       = arg<wow64::BOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[160]);
@@ -3412,7 +4142,11 @@ opt<bpid_t> wow64::syscalls32::register_NtSetDefaultHardErrorPort(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto DefaultHardErrorPort = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DefaultHardErrorPort = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[161]);
@@ -3427,8 +4161,12 @@ opt<bpid_t> wow64::syscalls32::register_NtSetDefaultLocale(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto UserProfile     = arg<wow64::BOOLEAN>(core, 0);
-        const auto DefaultLocaleId = arg<wow64::LCID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto UserProfile     = arg<wow64::BOOLEAN>(args, 0);
+        const auto DefaultLocaleId = arg<wow64::LCID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[162]);
@@ -3443,8 +4181,12 @@ opt<bpid_t> wow64::syscalls32::register_NtSetDriverEntryOrder(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Ids   = arg<wow64::PULONG>(core, 0);
-        const auto Count = arg<wow64::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Ids   = arg<wow64::PULONG>(args, 0);
+        const auto Count = arg<wow64::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[163]);
@@ -3459,8 +4201,12 @@ opt<bpid_t> wow64::syscalls32::register_NtSetEvent(proc_t proc, const on_NtSetEv
     {
         auto& core = d_->core;
 
-        const auto EventHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto PreviousState = arg<wow64::PLONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto PreviousState = arg<wow64::PLONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[164]);
@@ -3475,7 +4221,11 @@ opt<bpid_t> wow64::syscalls32::register_NtSetEventBoostPriority(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto EventHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[165]);
@@ -3490,7 +4240,11 @@ opt<bpid_t> wow64::syscalls32::register_NtSetHighEventPair(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[166]);
@@ -3505,7 +4259,11 @@ opt<bpid_t> wow64::syscalls32::register_NtSetHighWaitLowEventPair(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[167]);
@@ -3520,10 +4278,14 @@ opt<bpid_t> wow64::syscalls32::register_NtSetInformationEnlistment(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto EnlistmentInformationClass  = arg<wow64::ENLISTMENT_INFORMATION_CLASS>(core, 1);
-        const auto EnlistmentInformation       = arg<wow64::PVOID>(core, 2);
-        const auto EnlistmentInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto EnlistmentInformationClass  = arg<wow64::ENLISTMENT_INFORMATION_CLASS>(args, 1);
+        const auto EnlistmentInformation       = arg<wow64::PVOID>(args, 2);
+        const auto EnlistmentInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[168]);
@@ -3538,8 +4300,12 @@ opt<bpid_t> wow64::syscalls32::register_NtSetIntervalProfile(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Interval = arg<wow64::ULONG>(core, 0);
-        const auto Source   = arg<wow64::KPROFILE_SOURCE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Interval = arg<wow64::ULONG>(args, 0);
+        const auto Source   = arg<wow64::KPROFILE_SOURCE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[169]);
@@ -3554,11 +4320,15 @@ opt<bpid_t> wow64::syscalls32::register_NtSetIoCompletion(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto KeyContext          = arg<wow64::PVOID>(core, 1);
-        const auto ApcContext          = arg<wow64::PVOID>(core, 2);
-        const auto IoStatus            = arg<wow64::NTSTATUS>(core, 3);
-        const auto IoStatusInformation = arg<wow64::ULONG_PTR>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto KeyContext          = arg<wow64::PVOID>(args, 1);
+        const auto ApcContext          = arg<wow64::PVOID>(args, 2);
+        const auto IoStatus            = arg<wow64::NTSTATUS>(args, 3);
+        const auto IoStatusInformation = arg<wow64::ULONG_PTR>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[170]);
@@ -3573,12 +4343,16 @@ opt<bpid_t> wow64::syscalls32::register_NtSetIoCompletionEx(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle        = arg<wow64::HANDLE>(core, 0);
-        const auto IoCompletionReserveHandle = arg<wow64::HANDLE>(core, 1);
-        const auto KeyContext                = arg<wow64::PVOID>(core, 2);
-        const auto ApcContext                = arg<wow64::PVOID>(core, 3);
-        const auto IoStatus                  = arg<wow64::NTSTATUS>(core, 4);
-        const auto IoStatusInformation       = arg<wow64::ULONG_PTR>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle        = arg<wow64::HANDLE>(args, 0);
+        const auto IoCompletionReserveHandle = arg<wow64::HANDLE>(args, 1);
+        const auto KeyContext                = arg<wow64::PVOID>(args, 2);
+        const auto ApcContext                = arg<wow64::PVOID>(args, 3);
+        const auto IoStatus                  = arg<wow64::NTSTATUS>(args, 4);
+        const auto IoStatusInformation       = arg<wow64::ULONG_PTR>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[171]);
@@ -3593,9 +4367,13 @@ opt<bpid_t> wow64::syscalls32::register_NtSetSecurityObject(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto Handle              = arg<wow64::HANDLE>(core, 0);
-        const auto SecurityInformation = arg<wow64::SECURITY_INFORMATION>(core, 1);
-        const auto SecurityDescriptor  = arg<wow64::PSECURITY_DESCRIPTOR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle              = arg<wow64::HANDLE>(args, 0);
+        const auto SecurityInformation = arg<wow64::SECURITY_INFORMATION>(args, 1);
+        const auto SecurityDescriptor  = arg<wow64::PSECURITY_DESCRIPTOR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[172]);
@@ -3610,9 +4388,13 @@ opt<bpid_t> wow64::syscalls32::register_NtSetTimerResolution(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto DesiredTime   = arg<wow64::ULONG>(core, 0);
-        const auto SetResolution = arg<wow64::BOOLEAN>(core, 1);
-        const auto ActualTime    = arg<wow64::PULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DesiredTime   = arg<wow64::ULONG>(args, 0);
+        const auto SetResolution = arg<wow64::BOOLEAN>(args, 1);
+        const auto ActualTime    = arg<wow64::PULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[173]);
@@ -3627,11 +4409,15 @@ opt<bpid_t> wow64::syscalls32::register_NtSetVolumeInformationFile(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto FileHandle         = arg<wow64::HANDLE>(core, 0);
-        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
-        const auto FsInformation      = arg<wow64::PVOID>(core, 2);
-        const auto Length             = arg<wow64::ULONG>(core, 3);
-        const auto FsInformationClass = arg<wow64::FS_INFORMATION_CLASS>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle         = arg<wow64::HANDLE>(args, 0);
+        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
+        const auto FsInformation      = arg<wow64::PVOID>(args, 2);
+        const auto Length             = arg<wow64::ULONG>(args, 3);
+        const auto FsInformationClass = arg<wow64::FS_INFORMATION_CLASS>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[174]);
@@ -3646,8 +4432,12 @@ opt<bpid_t> wow64::syscalls32::register_NtShutdownWorkerFactory(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto STARPendingWorkerCount = arg<wow64::LONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto STARPendingWorkerCount = arg<wow64::LONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[175]);
@@ -3662,7 +4452,11 @@ opt<bpid_t> wow64::syscalls32::register_NtStartProfile(proc_t proc, const on_NtS
     {
         auto& core = d_->core;
 
-        const auto ProfileHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProfileHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[176]);
@@ -3677,12 +4471,16 @@ opt<bpid_t> wow64::syscalls32::register_NtSystemDebugControl(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Command            = arg<wow64::SYSDBG_COMMAND>(core, 0);
-        const auto InputBuffer        = arg<wow64::PVOID>(core, 1);
-        const auto InputBufferLength  = arg<wow64::ULONG>(core, 2);
-        const auto OutputBuffer       = arg<wow64::PVOID>(core, 3);
-        const auto OutputBufferLength = arg<wow64::ULONG>(core, 4);
-        const auto ReturnLength       = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Command            = arg<wow64::SYSDBG_COMMAND>(args, 0);
+        const auto InputBuffer        = arg<wow64::PVOID>(args, 1);
+        const auto InputBufferLength  = arg<wow64::ULONG>(args, 2);
+        const auto OutputBuffer       = arg<wow64::PVOID>(args, 3);
+        const auto OutputBufferLength = arg<wow64::ULONG>(args, 4);
+        const auto ReturnLength       = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[177]);
@@ -3723,10 +4521,14 @@ opt<bpid_t> wow64::syscalls32::register_NtTraceEvent(proc_t proc, const on_NtTra
     {
         auto& core = d_->core;
 
-        const auto TraceHandle = arg<wow64::HANDLE>(core, 0);
-        const auto Flags       = arg<wow64::ULONG>(core, 1);
-        const auto FieldSize   = arg<wow64::ULONG>(core, 2);
-        const auto Fields      = arg<wow64::PVOID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TraceHandle = arg<wow64::HANDLE>(args, 0);
+        const auto Flags       = arg<wow64::ULONG>(args, 1);
+        const auto FieldSize   = arg<wow64::ULONG>(args, 2);
+        const auto Fields      = arg<wow64::PVOID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[180]);
@@ -3741,10 +4543,14 @@ opt<bpid_t> wow64::syscalls32::register_NtTranslateFilePath(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto InputFilePath        = arg<wow64::PFILE_PATH>(core, 0);
-        const auto OutputType           = arg<wow64::ULONG>(core, 1);
-        const auto OutputFilePath       = arg<wow64::PFILE_PATH>(core, 2);
-        const auto OutputFilePathLength = arg<wow64::PULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto InputFilePath        = arg<wow64::PFILE_PATH>(args, 0);
+        const auto OutputType           = arg<wow64::ULONG>(args, 1);
+        const auto OutputFilePath       = arg<wow64::PFILE_PATH>(args, 2);
+        const auto OutputFilePathLength = arg<wow64::PULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[181]);
@@ -3759,7 +4565,11 @@ opt<bpid_t> wow64::syscalls32::register_NtUnloadKey(proc_t proc, const on_NtUnlo
     {
         auto& core = d_->core;
 
-        const auto TargetKey = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[182]);
@@ -3774,10 +4584,14 @@ opt<bpid_t> wow64::syscalls32::register_NtUnlockVirtualMemory(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<wow64::PVOID>(core, 1);
-        const auto RegionSize      = arg<wow64::PSIZE_T>(core, 2);
-        const auto MapType         = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<wow64::PVOID>(args, 1);
+        const auto RegionSize      = arg<wow64::PSIZE_T>(args, 2);
+        const auto MapType         = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[183]);
@@ -3792,8 +4606,12 @@ opt<bpid_t> wow64::syscalls32::register_NtUnmapViewOfSection(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<wow64::HANDLE>(core, 0);
-        const auto BaseAddress   = arg<wow64::PVOID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<wow64::HANDLE>(args, 0);
+        const auto BaseAddress   = arg<wow64::PVOID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[184]);
@@ -3808,8 +4626,12 @@ opt<bpid_t> wow64::syscalls32::register_NtVdmControl(proc_t proc, const on_NtVdm
     {
         auto& core = d_->core;
 
-        const auto Service     = arg<wow64::VDMSERVICECLASS>(core, 0);
-        const auto ServiceData = arg<wow64::PVOID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Service     = arg<wow64::VDMSERVICECLASS>(args, 0);
+        const auto ServiceData = arg<wow64::PVOID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[185]);
@@ -3824,10 +4646,14 @@ opt<bpid_t> wow64::syscalls32::register_NtWaitForDebugEvent(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto DebugObjectHandle = arg<wow64::HANDLE>(core, 0);
-        const auto Alertable         = arg<wow64::BOOLEAN>(core, 1);
-        const auto Timeout           = arg<wow64::PLARGE_INTEGER>(core, 2);
-        const auto WaitStateChange   = arg<wow64::PDBGUI_WAIT_STATE_CHANGE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DebugObjectHandle = arg<wow64::HANDLE>(args, 0);
+        const auto Alertable         = arg<wow64::BOOLEAN>(args, 1);
+        const auto Timeout           = arg<wow64::PLARGE_INTEGER>(args, 2);
+        const auto WaitStateChange   = arg<wow64::PDBGUI_WAIT_STATE_CHANGE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[186]);
@@ -3842,10 +4668,14 @@ opt<bpid_t> wow64::syscalls32::register_NtWaitForKeyedEvent(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto KeyedEventHandle = arg<wow64::HANDLE>(core, 0);
-        const auto KeyValue         = arg<wow64::PVOID>(core, 1);
-        const auto Alertable        = arg<wow64::BOOLEAN>(core, 2);
-        const auto Timeout          = arg<wow64::PLARGE_INTEGER>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyedEventHandle = arg<wow64::HANDLE>(args, 0);
+        const auto KeyValue         = arg<wow64::PVOID>(args, 1);
+        const auto Alertable        = arg<wow64::BOOLEAN>(args, 2);
+        const auto Timeout          = arg<wow64::PLARGE_INTEGER>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[187]);
@@ -3860,11 +4690,15 @@ opt<bpid_t> wow64::syscalls32::register_NtWaitForMultipleObjects(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto Count     = arg<wow64::ULONG>(core, 0);
-        const auto Handles   = arg<wow64::HANDLE>(core, 1);
-        const auto WaitType  = arg<wow64::WAIT_TYPE>(core, 2);
-        const auto Alertable = arg<wow64::BOOLEAN>(core, 3);
-        const auto Timeout   = arg<wow64::PLARGE_INTEGER>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Count     = arg<wow64::ULONG>(args, 0);
+        const auto Handles   = arg<wow64::HANDLE>(args, 1);
+        const auto WaitType  = arg<wow64::WAIT_TYPE>(args, 2);
+        const auto Alertable = arg<wow64::BOOLEAN>(args, 3);
+        const auto Timeout   = arg<wow64::PLARGE_INTEGER>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[188]);
@@ -3879,11 +4713,15 @@ opt<bpid_t> wow64::syscalls32::register_NtWaitForMultipleObjects32(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto Count     = arg<wow64::ULONG>(core, 0);
-        const auto Handles   = arg<wow64::LONG>(core, 1);
-        const auto WaitType  = arg<wow64::WAIT_TYPE>(core, 2);
-        const auto Alertable = arg<wow64::BOOLEAN>(core, 3);
-        const auto Timeout   = arg<wow64::PLARGE_INTEGER>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Count     = arg<wow64::ULONG>(args, 0);
+        const auto Handles   = arg<wow64::LONG>(args, 1);
+        const auto WaitType  = arg<wow64::WAIT_TYPE>(args, 2);
+        const auto Alertable = arg<wow64::BOOLEAN>(args, 3);
+        const auto Timeout   = arg<wow64::PLARGE_INTEGER>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[189]);
@@ -3898,11 +4736,15 @@ opt<bpid_t> wow64::syscalls32::register_NtWaitForWorkViaWorkerFactory(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle = arg<wow64::HANDLE>(core, 0);
-        const auto MiniPacket          = arg<wow64::PFILE_IO_COMPLETION_INFORMATION>(core, 1);
-        const auto Arg2                = arg<wow64::LONG>(core, 2);
-        const auto Arg3                = arg<wow64::LONG>(core, 3);
-        const auto Arg4                = arg<wow64::LONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle = arg<wow64::HANDLE>(args, 0);
+        const auto MiniPacket          = arg<wow64::PFILE_IO_COMPLETION_INFORMATION>(args, 1);
+        const auto Arg2                = arg<wow64::LONG>(args, 2);
+        const auto Arg3                = arg<wow64::LONG>(args, 3);
+        const auto Arg4                = arg<wow64::LONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[190]);
@@ -3917,7 +4759,11 @@ opt<bpid_t> wow64::syscalls32::register_NtWaitLowEventPair(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[191]);
@@ -3932,7 +4778,11 @@ opt<bpid_t> wow64::syscalls32::register_NtWorkerFactoryWorkerReady(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[192]);
@@ -3947,15 +4797,19 @@ opt<bpid_t> wow64::syscalls32::register_NtWriteFile(proc_t proc, const on_NtWrit
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto Event         = arg<wow64::HANDLE>(core, 1);
-        const auto ApcRoutine    = arg<wow64::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext    = arg<wow64::PVOID>(core, 3);
-        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(core, 4);
-        const auto Buffer        = arg<wow64::PVOID>(core, 5);
-        const auto Length        = arg<wow64::ULONG>(core, 6);
-        const auto ByteOffset    = arg<wow64::PLARGE_INTEGER>(core, 7);
-        const auto Key           = arg<wow64::PULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto Event         = arg<wow64::HANDLE>(args, 1);
+        const auto ApcRoutine    = arg<wow64::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext    = arg<wow64::PVOID>(args, 3);
+        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(args, 4);
+        const auto Buffer        = arg<wow64::PVOID>(args, 5);
+        const auto Length        = arg<wow64::ULONG>(args, 6);
+        const auto ByteOffset    = arg<wow64::PLARGE_INTEGER>(args, 7);
+        const auto Key           = arg<wow64::PULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[193]);
@@ -3970,15 +4824,19 @@ opt<bpid_t> wow64::syscalls32::register_NtWriteFileGather(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto Event         = arg<wow64::HANDLE>(core, 1);
-        const auto ApcRoutine    = arg<wow64::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext    = arg<wow64::PVOID>(core, 3);
-        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(core, 4);
-        const auto SegmentArray  = arg<wow64::PFILE_SEGMENT_ELEMENT>(core, 5);
-        const auto Length        = arg<wow64::ULONG>(core, 6);
-        const auto ByteOffset    = arg<wow64::PLARGE_INTEGER>(core, 7);
-        const auto Key           = arg<wow64::PULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto Event         = arg<wow64::HANDLE>(args, 1);
+        const auto ApcRoutine    = arg<wow64::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext    = arg<wow64::PVOID>(args, 3);
+        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(args, 4);
+        const auto SegmentArray  = arg<wow64::PFILE_SEGMENT_ELEMENT>(args, 5);
+        const auto Length        = arg<wow64::ULONG>(args, 6);
+        const auto ByteOffset    = arg<wow64::PLARGE_INTEGER>(args, 7);
+        const auto Key           = arg<wow64::PULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[194]);
@@ -3993,12 +4851,16 @@ opt<bpid_t> wow64::syscalls32::register_NtWriteRequestData(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto PortHandle           = arg<wow64::HANDLE>(core, 0);
-        const auto Message              = arg<wow64::PPORT_MESSAGE>(core, 1);
-        const auto DataEntryIndex       = arg<wow64::ULONG>(core, 2);
-        const auto Buffer               = arg<wow64::PVOID>(core, 3);
-        const auto BufferSize           = arg<wow64::SIZE_T>(core, 4);
-        const auto NumberOfBytesWritten = arg<wow64::PSIZE_T>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle           = arg<wow64::HANDLE>(args, 0);
+        const auto Message              = arg<wow64::PPORT_MESSAGE>(args, 1);
+        const auto DataEntryIndex       = arg<wow64::ULONG>(args, 2);
+        const auto Buffer               = arg<wow64::PVOID>(args, 3);
+        const auto BufferSize           = arg<wow64::SIZE_T>(args, 4);
+        const auto NumberOfBytesWritten = arg<wow64::PSIZE_T>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[195]);
@@ -4013,11 +4875,15 @@ opt<bpid_t> wow64::syscalls32::register_NtWriteVirtualMemory(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle        = arg<wow64::HANDLE>(core, 0);
-        const auto BaseAddress          = arg<wow64::PVOID>(core, 1);
-        const auto Buffer               = arg<wow64::PVOID>(core, 2);
-        const auto BufferSize           = arg<wow64::SIZE_T>(core, 3);
-        const auto NumberOfBytesWritten = arg<wow64::PSIZE_T>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle        = arg<wow64::HANDLE>(args, 0);
+        const auto BaseAddress          = arg<wow64::PVOID>(args, 1);
+        const auto Buffer               = arg<wow64::PVOID>(args, 2);
+        const auto BufferSize           = arg<wow64::SIZE_T>(args, 3);
+        const auto NumberOfBytesWritten = arg<wow64::PSIZE_T>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[196]);
@@ -4032,17 +4898,21 @@ opt<bpid_t> wow64::syscalls32::register_ZwAccessCheckAndAuditAlarm(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto SubsystemName      = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto HandleId           = arg<wow64::PVOID>(core, 1);
-        const auto ObjectTypeName     = arg<wow64::PUNICODE_STRING>(core, 2);
-        const auto ObjectName         = arg<wow64::PUNICODE_STRING>(core, 3);
-        const auto SecurityDescriptor = arg<wow64::PSECURITY_DESCRIPTOR>(core, 4);
-        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(core, 5);
-        const auto GenericMapping     = arg<wow64::PGENERIC_MAPPING>(core, 6);
-        const auto ObjectCreation     = arg<wow64::BOOLEAN>(core, 7);
-        const auto GrantedAccess      = arg<wow64::PACCESS_MASK>(core, 8);
-        const auto AccessStatus       = arg<wow64::PNTSTATUS>(core, 9);
-        const auto GenerateOnClose    = arg<wow64::PBOOLEAN>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName      = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto HandleId           = arg<wow64::PVOID>(args, 1);
+        const auto ObjectTypeName     = arg<wow64::PUNICODE_STRING>(args, 2);
+        const auto ObjectName         = arg<wow64::PUNICODE_STRING>(args, 3);
+        const auto SecurityDescriptor = arg<wow64::PSECURITY_DESCRIPTOR>(args, 4);
+        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(args, 5);
+        const auto GenericMapping     = arg<wow64::PGENERIC_MAPPING>(args, 6);
+        const auto ObjectCreation     = arg<wow64::BOOLEAN>(args, 7);
+        const auto GrantedAccess      = arg<wow64::PACCESS_MASK>(args, 8);
+        const auto AccessStatus       = arg<wow64::PNTSTATUS>(args, 9);
+        const auto GenerateOnClose    = arg<wow64::PBOOLEAN>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[197]);
@@ -4057,23 +4927,27 @@ opt<bpid_t> wow64::syscalls32::register_ZwAccessCheckByTypeResultListAndAuditAla
     {
         auto& core = d_->core;
 
-        const auto SubsystemName        = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto HandleId             = arg<wow64::PVOID>(core, 1);
-        const auto ClientToken          = arg<wow64::HANDLE>(core, 2);
-        const auto ObjectTypeName       = arg<wow64::PUNICODE_STRING>(core, 3);
-        const auto ObjectName           = arg<wow64::PUNICODE_STRING>(core, 4);
-        const auto SecurityDescriptor   = arg<wow64::PSECURITY_DESCRIPTOR>(core, 5);
-        const auto PrincipalSelfSid     = arg<wow64::PSID>(core, 6);
-        const auto DesiredAccess        = arg<wow64::ACCESS_MASK>(core, 7);
-        const auto AuditType            = arg<wow64::AUDIT_EVENT_TYPE>(core, 8);
-        const auto Flags                = arg<wow64::ULONG>(core, 9);
-        const auto ObjectTypeList       = arg<wow64::POBJECT_TYPE_LIST>(core, 10);
-        const auto ObjectTypeListLength = arg<wow64::ULONG>(core, 11);
-        const auto GenericMapping       = arg<wow64::PGENERIC_MAPPING>(core, 12);
-        const auto ObjectCreation       = arg<wow64::BOOLEAN>(core, 13);
-        const auto GrantedAccess        = arg<wow64::PACCESS_MASK>(core, 14);
-        const auto AccessStatus         = arg<wow64::PNTSTATUS>(core, 15);
-        const auto GenerateOnClose      = arg<wow64::PBOOLEAN>(core, 16);
+        auto args = std::array<arg_t, 17>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName        = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto HandleId             = arg<wow64::PVOID>(args, 1);
+        const auto ClientToken          = arg<wow64::HANDLE>(args, 2);
+        const auto ObjectTypeName       = arg<wow64::PUNICODE_STRING>(args, 3);
+        const auto ObjectName           = arg<wow64::PUNICODE_STRING>(args, 4);
+        const auto SecurityDescriptor   = arg<wow64::PSECURITY_DESCRIPTOR>(args, 5);
+        const auto PrincipalSelfSid     = arg<wow64::PSID>(args, 6);
+        const auto DesiredAccess        = arg<wow64::ACCESS_MASK>(args, 7);
+        const auto AuditType            = arg<wow64::AUDIT_EVENT_TYPE>(args, 8);
+        const auto Flags                = arg<wow64::ULONG>(args, 9);
+        const auto ObjectTypeList       = arg<wow64::POBJECT_TYPE_LIST>(args, 10);
+        const auto ObjectTypeListLength = arg<wow64::ULONG>(args, 11);
+        const auto GenericMapping       = arg<wow64::PGENERIC_MAPPING>(args, 12);
+        const auto ObjectCreation       = arg<wow64::BOOLEAN>(args, 13);
+        const auto GrantedAccess        = arg<wow64::PACCESS_MASK>(args, 14);
+        const auto AccessStatus         = arg<wow64::PNTSTATUS>(args, 15);
+        const auto GenerateOnClose      = arg<wow64::PBOOLEAN>(args, 16);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[198]);
@@ -4088,8 +4962,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwAddBootEntry(proc_t proc, const on_ZwA
     {
         auto& core = d_->core;
 
-        const auto BootEntry = arg<wow64::PBOOT_ENTRY>(core, 0);
-        const auto Id        = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto BootEntry = arg<wow64::PBOOT_ENTRY>(args, 0);
+        const auto Id        = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[199]);
@@ -4104,12 +4982,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwAdjustGroupsToken(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto TokenHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto ResetToDefault = arg<wow64::BOOLEAN>(core, 1);
-        const auto NewState       = arg<wow64::PTOKEN_GROUPS>(core, 2);
-        const auto BufferLength   = arg<wow64::ULONG>(core, 3);
-        const auto PreviousState  = arg<wow64::PTOKEN_GROUPS>(core, 4);
-        const auto ReturnLength   = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto ResetToDefault = arg<wow64::BOOLEAN>(args, 1);
+        const auto NewState       = arg<wow64::PTOKEN_GROUPS>(args, 2);
+        const auto BufferLength   = arg<wow64::ULONG>(args, 3);
+        const auto PreviousState  = arg<wow64::PTOKEN_GROUPS>(args, 4);
+        const auto ReturnLength   = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[200]);
@@ -4124,12 +5006,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwAdjustPrivilegesToken(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto TokenHandle          = arg<wow64::HANDLE>(core, 0);
-        const auto DisableAllPrivileges = arg<wow64::BOOLEAN>(core, 1);
-        const auto NewState             = arg<wow64::PTOKEN_PRIVILEGES>(core, 2);
-        const auto BufferLength         = arg<wow64::ULONG>(core, 3);
-        const auto PreviousState        = arg<wow64::PTOKEN_PRIVILEGES>(core, 4);
-        const auto ReturnLength         = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle          = arg<wow64::HANDLE>(args, 0);
+        const auto DisableAllPrivileges = arg<wow64::BOOLEAN>(args, 1);
+        const auto NewState             = arg<wow64::PTOKEN_PRIVILEGES>(args, 2);
+        const auto BufferLength         = arg<wow64::ULONG>(args, 3);
+        const auto PreviousState        = arg<wow64::PTOKEN_PRIVILEGES>(args, 4);
+        const auto ReturnLength         = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[201]);
@@ -4144,7 +5030,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwAllocateLocallyUniqueId(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto Luid = arg<wow64::PLUID>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Luid = arg<wow64::PLUID>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[202]);
@@ -4159,9 +5049,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcCancelMessage(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto PortHandle     = arg<wow64::HANDLE>(core, 0);
-        const auto Flags          = arg<wow64::ULONG>(core, 1);
-        const auto MessageContext = arg<wow64::PALPC_CONTEXT_ATTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle     = arg<wow64::HANDLE>(args, 0);
+        const auto Flags          = arg<wow64::ULONG>(args, 1);
+        const auto MessageContext = arg<wow64::PALPC_CONTEXT_ATTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[203]);
@@ -4176,17 +5070,21 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcConnectPort(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto PortHandle           = arg<wow64::PHANDLE>(core, 0);
-        const auto PortName             = arg<wow64::PUNICODE_STRING>(core, 1);
-        const auto ObjectAttributes     = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto PortAttributes       = arg<wow64::PALPC_PORT_ATTRIBUTES>(core, 3);
-        const auto Flags                = arg<wow64::ULONG>(core, 4);
-        const auto RequiredServerSid    = arg<wow64::PSID>(core, 5);
-        const auto ConnectionMessage    = arg<wow64::PPORT_MESSAGE>(core, 6);
-        const auto BufferLength         = arg<wow64::PULONG>(core, 7);
-        const auto OutMessageAttributes = arg<wow64::PALPC_MESSAGE_ATTRIBUTES>(core, 8);
-        const auto InMessageAttributes  = arg<wow64::PALPC_MESSAGE_ATTRIBUTES>(core, 9);
-        const auto Timeout              = arg<wow64::PLARGE_INTEGER>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle           = arg<wow64::PHANDLE>(args, 0);
+        const auto PortName             = arg<wow64::PUNICODE_STRING>(args, 1);
+        const auto ObjectAttributes     = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto PortAttributes       = arg<wow64::PALPC_PORT_ATTRIBUTES>(args, 3);
+        const auto Flags                = arg<wow64::ULONG>(args, 4);
+        const auto RequiredServerSid    = arg<wow64::PSID>(args, 5);
+        const auto ConnectionMessage    = arg<wow64::PPORT_MESSAGE>(args, 6);
+        const auto BufferLength         = arg<wow64::PULONG>(args, 7);
+        const auto OutMessageAttributes = arg<wow64::PALPC_MESSAGE_ATTRIBUTES>(args, 8);
+        const auto InMessageAttributes  = arg<wow64::PALPC_MESSAGE_ATTRIBUTES>(args, 9);
+        const auto Timeout              = arg<wow64::PLARGE_INTEGER>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[204]);
@@ -4201,9 +5099,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcCreatePort(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto PortHandle       = arg<wow64::PHANDLE>(core, 0);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 1);
-        const auto PortAttributes   = arg<wow64::PALPC_PORT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle       = arg<wow64::PHANDLE>(args, 0);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 1);
+        const auto PortAttributes   = arg<wow64::PALPC_PORT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[205]);
@@ -4218,10 +5120,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcCreateResourceReserve(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto PortHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto Flags       = arg<wow64::ULONG>(core, 1);
-        const auto MessageSize = arg<wow64::SIZE_T>(core, 2);
-        const auto ResourceId  = arg<wow64::PALPC_HANDLE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto Flags       = arg<wow64::ULONG>(args, 1);
+        const auto MessageSize = arg<wow64::SIZE_T>(args, 2);
+        const auto ResourceId  = arg<wow64::PALPC_HANDLE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[206]);
@@ -4236,9 +5142,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcCreateSectionView(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto PortHandle     = arg<wow64::HANDLE>(core, 0);
-        const auto Flags          = arg<wow64::ULONG>(core, 1);
-        const auto ViewAttributes = arg<wow64::PALPC_DATA_VIEW_ATTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle     = arg<wow64::HANDLE>(args, 0);
+        const auto Flags          = arg<wow64::ULONG>(args, 1);
+        const auto ViewAttributes = arg<wow64::PALPC_DATA_VIEW_ATTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[207]);
@@ -4253,9 +5163,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcCreateSecurityContext(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto PortHandle        = arg<wow64::HANDLE>(core, 0);
-        const auto Flags             = arg<wow64::ULONG>(core, 1);
-        const auto SecurityAttribute = arg<wow64::PALPC_SECURITY_ATTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle        = arg<wow64::HANDLE>(args, 0);
+        const auto Flags             = arg<wow64::ULONG>(args, 1);
+        const auto SecurityAttribute = arg<wow64::PALPC_SECURITY_ATTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[208]);
@@ -4270,9 +5184,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcDeletePortSection(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto PortHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto Flags         = arg<wow64::ULONG>(core, 1);
-        const auto SectionHandle = arg<wow64::ALPC_HANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto Flags         = arg<wow64::ULONG>(args, 1);
+        const auto SectionHandle = arg<wow64::ALPC_HANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[209]);
@@ -4287,9 +5205,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcImpersonateClientOfPort(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto PortHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto PortMessage = arg<wow64::PPORT_MESSAGE>(core, 1);
-        const auto Reserved    = arg<wow64::PVOID>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto PortMessage = arg<wow64::PPORT_MESSAGE>(args, 1);
+        const auto Reserved    = arg<wow64::PVOID>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[210]);
@@ -4304,12 +5226,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcOpenSenderProcess(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<wow64::PHANDLE>(core, 0);
-        const auto PortHandle       = arg<wow64::HANDLE>(core, 1);
-        const auto PortMessage      = arg<wow64::PPORT_MESSAGE>(core, 2);
-        const auto Flags            = arg<wow64::ULONG>(core, 3);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 4);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<wow64::PHANDLE>(args, 0);
+        const auto PortHandle       = arg<wow64::HANDLE>(args, 1);
+        const auto PortMessage      = arg<wow64::PPORT_MESSAGE>(args, 2);
+        const auto Flags            = arg<wow64::ULONG>(args, 3);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 4);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[211]);
@@ -4324,12 +5250,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcOpenSenderThread(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle     = arg<wow64::PHANDLE>(core, 0);
-        const auto PortHandle       = arg<wow64::HANDLE>(core, 1);
-        const auto PortMessage      = arg<wow64::PPORT_MESSAGE>(core, 2);
-        const auto Flags            = arg<wow64::ULONG>(core, 3);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 4);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle     = arg<wow64::PHANDLE>(args, 0);
+        const auto PortHandle       = arg<wow64::HANDLE>(args, 1);
+        const auto PortMessage      = arg<wow64::PPORT_MESSAGE>(args, 2);
+        const auto Flags            = arg<wow64::ULONG>(args, 3);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 4);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[212]);
@@ -4344,11 +5274,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcQueryInformation(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto PortHandle           = arg<wow64::HANDLE>(core, 0);
-        const auto PortInformationClass = arg<wow64::ALPC_PORT_INFORMATION_CLASS>(core, 1);
-        const auto PortInformation      = arg<wow64::PVOID>(core, 2);
-        const auto Length               = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength         = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle           = arg<wow64::HANDLE>(args, 0);
+        const auto PortInformationClass = arg<wow64::ALPC_PORT_INFORMATION_CLASS>(args, 1);
+        const auto PortInformation      = arg<wow64::PVOID>(args, 2);
+        const auto Length               = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength         = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[213]);
@@ -4363,12 +5297,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwAlpcQueryInformationMessage(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto PortHandle              = arg<wow64::HANDLE>(core, 0);
-        const auto PortMessage             = arg<wow64::PPORT_MESSAGE>(core, 1);
-        const auto MessageInformationClass = arg<wow64::ALPC_MESSAGE_INFORMATION_CLASS>(core, 2);
-        const auto MessageInformation      = arg<wow64::PVOID>(core, 3);
-        const auto Length                  = arg<wow64::ULONG>(core, 4);
-        const auto ReturnLength            = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle              = arg<wow64::HANDLE>(args, 0);
+        const auto PortMessage             = arg<wow64::PPORT_MESSAGE>(args, 1);
+        const auto MessageInformationClass = arg<wow64::ALPC_MESSAGE_INFORMATION_CLASS>(args, 2);
+        const auto MessageInformation      = arg<wow64::PVOID>(args, 3);
+        const auto Length                  = arg<wow64::ULONG>(args, 4);
+        const auto ReturnLength            = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[214]);
@@ -4383,8 +5321,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwAreMappedFilesTheSame(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto File1MappedAsAnImage = arg<wow64::PVOID>(core, 0);
-        const auto File2MappedAsFile    = arg<wow64::PVOID>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto File1MappedAsAnImage = arg<wow64::PVOID>(args, 0);
+        const auto File2MappedAsFile    = arg<wow64::PVOID>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[215]);
@@ -4399,8 +5341,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwAssignProcessToJobObject(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto JobHandle     = arg<wow64::HANDLE>(core, 0);
-        const auto ProcessHandle = arg<wow64::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle     = arg<wow64::HANDLE>(args, 0);
+        const auto ProcessHandle = arg<wow64::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[216]);
@@ -4415,8 +5361,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwCancelIoFile(proc_t proc, const on_ZwC
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[217]);
@@ -4431,8 +5381,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwCancelTimer(proc_t proc, const on_ZwCa
     {
         auto& core = d_->core;
 
-        const auto TimerHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto CurrentState = arg<wow64::PBOOLEAN>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto CurrentState = arg<wow64::PBOOLEAN>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[218]);
@@ -4447,9 +5401,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwCloseObjectAuditAlarm(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto SubsystemName   = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto HandleId        = arg<wow64::PVOID>(core, 1);
-        const auto GenerateOnClose = arg<wow64::BOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName   = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto HandleId        = arg<wow64::PVOID>(args, 1);
+        const auto GenerateOnClose = arg<wow64::BOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[219]);
@@ -4464,8 +5422,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwCommitComplete(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<wow64::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<wow64::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[220]);
@@ -4480,9 +5442,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwCompareTokens(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto FirstTokenHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto SecondTokenHandle = arg<wow64::HANDLE>(core, 1);
-        const auto Equal             = arg<wow64::PBOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FirstTokenHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto SecondTokenHandle = arg<wow64::HANDLE>(args, 1);
+        const auto Equal             = arg<wow64::PBOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[221]);
@@ -4497,7 +5463,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwCompressKey(proc_t proc, const on_ZwCo
     {
         auto& core = d_->core;
 
-        const auto Key = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Key = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[222]);
@@ -4512,8 +5482,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwContinue(proc_t proc, const on_ZwConti
     {
         auto& core = d_->core;
 
-        const auto ContextRecord = arg<wow64::PCONTEXT>(core, 0);
-        const auto TestAlert     = arg<wow64::BOOLEAN>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ContextRecord = arg<wow64::PCONTEXT>(args, 0);
+        const auto TestAlert     = arg<wow64::BOOLEAN>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[223]);
@@ -4528,10 +5502,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateDebugObject(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto DebugObjectHandle = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Flags             = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DebugObjectHandle = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Flags             = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[224]);
@@ -4546,9 +5524,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateDirectoryObject(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto DirectoryHandle  = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DirectoryHandle  = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[225]);
@@ -4563,14 +5545,18 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateEnlistment(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle      = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess         = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ResourceManagerHandle = arg<wow64::HANDLE>(core, 2);
-        const auto TransactionHandle     = arg<wow64::HANDLE>(core, 3);
-        const auto ObjectAttributes      = arg<wow64::POBJECT_ATTRIBUTES>(core, 4);
-        const auto CreateOptions         = arg<wow64::ULONG>(core, 5);
-        const auto NotificationMask      = arg<wow64::NOTIFICATION_MASK>(core, 6);
-        const auto EnlistmentKey         = arg<wow64::PVOID>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle      = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess         = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ResourceManagerHandle = arg<wow64::HANDLE>(args, 2);
+        const auto TransactionHandle     = arg<wow64::HANDLE>(args, 3);
+        const auto ObjectAttributes      = arg<wow64::POBJECT_ATTRIBUTES>(args, 4);
+        const auto CreateOptions         = arg<wow64::ULONG>(args, 5);
+        const auto NotificationMask      = arg<wow64::NOTIFICATION_MASK>(args, 6);
+        const auto EnlistmentKey         = arg<wow64::PVOID>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[226]);
@@ -4585,9 +5571,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateJobObject(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto JobHandle        = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle        = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[227]);
@@ -4602,13 +5592,17 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateKey(proc_t proc, const on_ZwCrea
     {
         auto& core = d_->core;
 
-        const auto KeyHandle        = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto TitleIndex       = arg<wow64::ULONG>(core, 3);
-        const auto Class            = arg<wow64::PUNICODE_STRING>(core, 4);
-        const auto CreateOptions    = arg<wow64::ULONG>(core, 5);
-        const auto Disposition      = arg<wow64::PULONG>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle        = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto TitleIndex       = arg<wow64::ULONG>(args, 3);
+        const auto Class            = arg<wow64::PUNICODE_STRING>(args, 4);
+        const auto CreateOptions    = arg<wow64::ULONG>(args, 5);
+        const auto Disposition      = arg<wow64::PULONG>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[228]);
@@ -4623,10 +5617,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateKeyedEvent(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto KeyedEventHandle = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Flags            = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyedEventHandle = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Flags            = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[229]);
@@ -4641,14 +5639,18 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateMailslotFile(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto FileHandle         = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<wow64::ULONG>(core, 1);
-        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(core, 3);
-        const auto CreateOptions      = arg<wow64::ULONG>(core, 4);
-        const auto MailslotQuota      = arg<wow64::ULONG>(core, 5);
-        const auto MaximumMessageSize = arg<wow64::ULONG>(core, 6);
-        const auto ReadTimeout        = arg<wow64::PLARGE_INTEGER>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle         = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<wow64::ULONG>(args, 1);
+        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(args, 3);
+        const auto CreateOptions      = arg<wow64::ULONG>(args, 4);
+        const auto MailslotQuota      = arg<wow64::ULONG>(args, 5);
+        const auto MaximumMessageSize = arg<wow64::ULONG>(args, 6);
+        const auto ReadTimeout        = arg<wow64::PLARGE_INTEGER>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[230]);
@@ -4663,10 +5665,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateMutant(proc_t proc, const on_ZwC
     {
         auto& core = d_->core;
 
-        const auto MutantHandle     = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto InitialOwner     = arg<wow64::BOOLEAN>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MutantHandle     = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto InitialOwner     = arg<wow64::BOOLEAN>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[231]);
@@ -4681,20 +5687,24 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateNamedPipeFile(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto FileHandle        = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<wow64::ULONG>(core, 1);
-        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(core, 3);
-        const auto ShareAccess       = arg<wow64::ULONG>(core, 4);
-        const auto CreateDisposition = arg<wow64::ULONG>(core, 5);
-        const auto CreateOptions     = arg<wow64::ULONG>(core, 6);
-        const auto NamedPipeType     = arg<wow64::ULONG>(core, 7);
-        const auto ReadMode          = arg<wow64::ULONG>(core, 8);
-        const auto CompletionMode    = arg<wow64::ULONG>(core, 9);
-        const auto MaximumInstances  = arg<wow64::ULONG>(core, 10);
-        const auto InboundQuota      = arg<wow64::ULONG>(core, 11);
-        const auto OutboundQuota     = arg<wow64::ULONG>(core, 12);
-        const auto DefaultTimeout    = arg<wow64::PLARGE_INTEGER>(core, 13);
+        auto args = std::array<arg_t, 14>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle        = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<wow64::ULONG>(args, 1);
+        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(args, 3);
+        const auto ShareAccess       = arg<wow64::ULONG>(args, 4);
+        const auto CreateDisposition = arg<wow64::ULONG>(args, 5);
+        const auto CreateOptions     = arg<wow64::ULONG>(args, 6);
+        const auto NamedPipeType     = arg<wow64::ULONG>(args, 7);
+        const auto ReadMode          = arg<wow64::ULONG>(args, 8);
+        const auto CompletionMode    = arg<wow64::ULONG>(args, 9);
+        const auto MaximumInstances  = arg<wow64::ULONG>(args, 10);
+        const auto InboundQuota      = arg<wow64::ULONG>(args, 11);
+        const auto OutboundQuota     = arg<wow64::ULONG>(args, 12);
+        const auto DefaultTimeout    = arg<wow64::PLARGE_INTEGER>(args, 13);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[232]);
@@ -4709,11 +5719,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreatePort(proc_t proc, const on_ZwCre
     {
         auto& core = d_->core;
 
-        const auto PortHandle              = arg<wow64::PHANDLE>(core, 0);
-        const auto ObjectAttributes        = arg<wow64::POBJECT_ATTRIBUTES>(core, 1);
-        const auto MaxConnectionInfoLength = arg<wow64::ULONG>(core, 2);
-        const auto MaxMessageLength        = arg<wow64::ULONG>(core, 3);
-        const auto MaxPoolUsage            = arg<wow64::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle              = arg<wow64::PHANDLE>(args, 0);
+        const auto ObjectAttributes        = arg<wow64::POBJECT_ATTRIBUTES>(args, 1);
+        const auto MaxConnectionInfoLength = arg<wow64::ULONG>(args, 2);
+        const auto MaxMessageLength        = arg<wow64::ULONG>(args, 3);
+        const auto MaxPoolUsage            = arg<wow64::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[233]);
@@ -4728,14 +5742,18 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateProcess(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle      = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ParentProcess      = arg<wow64::HANDLE>(core, 3);
-        const auto InheritObjectTable = arg<wow64::BOOLEAN>(core, 4);
-        const auto SectionHandle      = arg<wow64::HANDLE>(core, 5);
-        const auto DebugPort          = arg<wow64::HANDLE>(core, 6);
-        const auto ExceptionPort      = arg<wow64::HANDLE>(core, 7);
+        auto args = std::array<arg_t, 8>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle      = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ParentProcess      = arg<wow64::HANDLE>(args, 3);
+        const auto InheritObjectTable = arg<wow64::BOOLEAN>(args, 4);
+        const auto SectionHandle      = arg<wow64::HANDLE>(args, 5);
+        const auto DebugPort          = arg<wow64::HANDLE>(args, 6);
+        const auto ExceptionPort      = arg<wow64::HANDLE>(args, 7);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[234]);
@@ -4750,15 +5768,19 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateProcessEx(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ParentProcess    = arg<wow64::HANDLE>(core, 3);
-        const auto Flags            = arg<wow64::ULONG>(core, 4);
-        const auto SectionHandle    = arg<wow64::HANDLE>(core, 5);
-        const auto DebugPort        = arg<wow64::HANDLE>(core, 6);
-        const auto ExceptionPort    = arg<wow64::HANDLE>(core, 7);
-        const auto JobMemberLevel   = arg<wow64::ULONG>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ParentProcess    = arg<wow64::HANDLE>(args, 3);
+        const auto Flags            = arg<wow64::ULONG>(args, 4);
+        const auto SectionHandle    = arg<wow64::HANDLE>(args, 5);
+        const auto DebugPort        = arg<wow64::HANDLE>(args, 6);
+        const auto ExceptionPort    = arg<wow64::HANDLE>(args, 7);
+        const auto JobMemberLevel   = arg<wow64::ULONG>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[235]);
@@ -4773,15 +5795,19 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateProfile(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto ProfileHandle = arg<wow64::PHANDLE>(core, 0);
-        const auto Process       = arg<wow64::HANDLE>(core, 1);
-        const auto RangeBase     = arg<wow64::PVOID>(core, 2);
-        const auto RangeSize     = arg<wow64::SIZE_T>(core, 3);
-        const auto BucketSize    = arg<wow64::ULONG>(core, 4);
-        const auto Buffer        = arg<wow64::PULONG>(core, 5);
-        const auto BufferSize    = arg<wow64::ULONG>(core, 6);
-        const auto ProfileSource = arg<wow64::KPROFILE_SOURCE>(core, 7);
-        const auto Affinity      = arg<wow64::KAFFINITY>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProfileHandle = arg<wow64::PHANDLE>(args, 0);
+        const auto Process       = arg<wow64::HANDLE>(args, 1);
+        const auto RangeBase     = arg<wow64::PVOID>(args, 2);
+        const auto RangeSize     = arg<wow64::SIZE_T>(args, 3);
+        const auto BucketSize    = arg<wow64::ULONG>(args, 4);
+        const auto Buffer        = arg<wow64::PULONG>(args, 5);
+        const auto BufferSize    = arg<wow64::ULONG>(args, 6);
+        const auto ProfileSource = arg<wow64::KPROFILE_SOURCE>(args, 7);
+        const auto Affinity      = arg<wow64::KAFFINITY>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[236]);
@@ -4796,13 +5822,17 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateResourceManager(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess         = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto TmHandle              = arg<wow64::HANDLE>(core, 2);
-        const auto RmGuid                = arg<wow64::LPGUID>(core, 3);
-        const auto ObjectAttributes      = arg<wow64::POBJECT_ATTRIBUTES>(core, 4);
-        const auto CreateOptions         = arg<wow64::ULONG>(core, 5);
-        const auto Description           = arg<wow64::PUNICODE_STRING>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess         = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto TmHandle              = arg<wow64::HANDLE>(args, 2);
+        const auto RmGuid                = arg<wow64::LPGUID>(args, 3);
+        const auto ObjectAttributes      = arg<wow64::POBJECT_ATTRIBUTES>(args, 4);
+        const auto CreateOptions         = arg<wow64::ULONG>(args, 5);
+        const auto Description           = arg<wow64::PUNICODE_STRING>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[237]);
@@ -4817,10 +5847,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateSymbolicLinkObject(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto LinkHandle       = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto LinkTarget       = arg<wow64::PUNICODE_STRING>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto LinkHandle       = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto LinkTarget       = arg<wow64::PUNICODE_STRING>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[238]);
@@ -4835,10 +5869,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateTimer(proc_t proc, const on_ZwCr
     {
         auto& core = d_->core;
 
-        const auto TimerHandle      = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto TimerType        = arg<wow64::TIMER_TYPE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle      = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto TimerType        = arg<wow64::TIMER_TYPE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[239]);
@@ -4853,12 +5891,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateTransactionManager(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto TmHandle         = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto LogFileName      = arg<wow64::PUNICODE_STRING>(core, 3);
-        const auto CreateOptions    = arg<wow64::ULONG>(core, 4);
-        const auto CommitStrength   = arg<wow64::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TmHandle         = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto LogFileName      = arg<wow64::PUNICODE_STRING>(args, 3);
+        const auto CreateOptions    = arg<wow64::ULONG>(args, 4);
+        const auto CommitStrength   = arg<wow64::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[240]);
@@ -4873,11 +5915,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwCreateWaitablePort(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto PortHandle              = arg<wow64::PHANDLE>(core, 0);
-        const auto ObjectAttributes        = arg<wow64::POBJECT_ATTRIBUTES>(core, 1);
-        const auto MaxConnectionInfoLength = arg<wow64::ULONG>(core, 2);
-        const auto MaxMessageLength        = arg<wow64::ULONG>(core, 3);
-        const auto MaxPoolUsage            = arg<wow64::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle              = arg<wow64::PHANDLE>(args, 0);
+        const auto ObjectAttributes        = arg<wow64::POBJECT_ATTRIBUTES>(args, 1);
+        const auto MaxConnectionInfoLength = arg<wow64::ULONG>(args, 2);
+        const auto MaxMessageLength        = arg<wow64::ULONG>(args, 3);
+        const auto MaxPoolUsage            = arg<wow64::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[241]);
@@ -4892,9 +5938,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwDebugContinue(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto DebugObjectHandle = arg<wow64::HANDLE>(core, 0);
-        const auto ClientId          = arg<wow64::PCLIENT_ID>(core, 1);
-        const auto ContinueStatus    = arg<wow64::NTSTATUS>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DebugObjectHandle = arg<wow64::HANDLE>(args, 0);
+        const auto ClientId          = arg<wow64::PCLIENT_ID>(args, 1);
+        const auto ContinueStatus    = arg<wow64::NTSTATUS>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[242]);
@@ -4909,8 +5959,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwDelayExecution(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto Alertable     = arg<wow64::BOOLEAN>(core, 0);
-        const auto DelayInterval = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Alertable     = arg<wow64::BOOLEAN>(args, 0);
+        const auto DelayInterval = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[243]);
@@ -4925,7 +5979,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwDeleteAtom(proc_t proc, const on_ZwDel
     {
         auto& core = d_->core;
 
-        const auto Atom = arg<wow64::RTL_ATOM>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Atom = arg<wow64::RTL_ATOM>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[244]);
@@ -4940,7 +5998,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwDeleteDriverEntry(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto Id = arg<wow64::ULONG>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Id = arg<wow64::ULONG>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[245]);
@@ -4955,7 +6017,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwDeleteKey(proc_t proc, const on_ZwDele
     {
         auto& core = d_->core;
 
-        const auto KeyHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[246]);
@@ -4970,16 +6036,20 @@ opt<bpid_t> wow64::syscalls32::register_ZwDeviceIoControlFile(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto FileHandle         = arg<wow64::HANDLE>(core, 0);
-        const auto Event              = arg<wow64::HANDLE>(core, 1);
-        const auto ApcRoutine         = arg<wow64::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext         = arg<wow64::PVOID>(core, 3);
-        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(core, 4);
-        const auto IoControlCode      = arg<wow64::ULONG>(core, 5);
-        const auto InputBuffer        = arg<wow64::PVOID>(core, 6);
-        const auto InputBufferLength  = arg<wow64::ULONG>(core, 7);
-        const auto OutputBuffer       = arg<wow64::PVOID>(core, 8);
-        const auto OutputBufferLength = arg<wow64::ULONG>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle         = arg<wow64::HANDLE>(args, 0);
+        const auto Event              = arg<wow64::HANDLE>(args, 1);
+        const auto ApcRoutine         = arg<wow64::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext         = arg<wow64::PVOID>(args, 3);
+        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(args, 4);
+        const auto IoControlCode      = arg<wow64::ULONG>(args, 5);
+        const auto InputBuffer        = arg<wow64::PVOID>(args, 6);
+        const auto InputBufferLength  = arg<wow64::ULONG>(args, 7);
+        const auto OutputBuffer       = arg<wow64::PVOID>(args, 8);
+        const auto OutputBufferLength = arg<wow64::ULONG>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[247]);
@@ -4994,7 +6064,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwDrawText(proc_t proc, const on_ZwDrawT
     {
         auto& core = d_->core;
 
-        const auto Text = arg<wow64::PUNICODE_STRING>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Text = arg<wow64::PUNICODE_STRING>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[248]);
@@ -5009,13 +6083,17 @@ opt<bpid_t> wow64::syscalls32::register_ZwDuplicateObject(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto SourceProcessHandle = arg<wow64::HANDLE>(core, 0);
-        const auto SourceHandle        = arg<wow64::HANDLE>(core, 1);
-        const auto TargetProcessHandle = arg<wow64::HANDLE>(core, 2);
-        const auto TargetHandle        = arg<wow64::PHANDLE>(core, 3);
-        const auto DesiredAccess       = arg<wow64::ACCESS_MASK>(core, 4);
-        const auto HandleAttributes    = arg<wow64::ULONG>(core, 5);
-        const auto Options             = arg<wow64::ULONG>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SourceProcessHandle = arg<wow64::HANDLE>(args, 0);
+        const auto SourceHandle        = arg<wow64::HANDLE>(args, 1);
+        const auto TargetProcessHandle = arg<wow64::HANDLE>(args, 2);
+        const auto TargetHandle        = arg<wow64::PHANDLE>(args, 3);
+        const auto DesiredAccess       = arg<wow64::ACCESS_MASK>(args, 4);
+        const auto HandleAttributes    = arg<wow64::ULONG>(args, 5);
+        const auto Options             = arg<wow64::ULONG>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[249]);
@@ -5030,8 +6108,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwEnumerateBootEntries(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto Buffer       = arg<wow64::PVOID>(core, 0);
-        const auto BufferLength = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Buffer       = arg<wow64::PVOID>(args, 0);
+        const auto BufferLength = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[250]);
@@ -5046,12 +6128,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwEnumerateKey(proc_t proc, const on_ZwE
     {
         auto& core = d_->core;
 
-        const auto KeyHandle           = arg<wow64::HANDLE>(core, 0);
-        const auto Index               = arg<wow64::ULONG>(core, 1);
-        const auto KeyInformationClass = arg<wow64::KEY_INFORMATION_CLASS>(core, 2);
-        const auto KeyInformation      = arg<wow64::PVOID>(core, 3);
-        const auto Length              = arg<wow64::ULONG>(core, 4);
-        const auto ResultLength        = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle           = arg<wow64::HANDLE>(args, 0);
+        const auto Index               = arg<wow64::ULONG>(args, 1);
+        const auto KeyInformationClass = arg<wow64::KEY_INFORMATION_CLASS>(args, 2);
+        const auto KeyInformation      = arg<wow64::PVOID>(args, 3);
+        const auto Length              = arg<wow64::ULONG>(args, 4);
+        const auto ResultLength        = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[251]);
@@ -5066,9 +6152,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwEnumerateSystemEnvironmentValuesEx(pro
     {
         auto& core = d_->core;
 
-        const auto InformationClass = arg<wow64::ULONG>(core, 0);
-        const auto Buffer           = arg<wow64::PVOID>(core, 1);
-        const auto BufferLength     = arg<wow64::PULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto InformationClass = arg<wow64::ULONG>(args, 0);
+        const auto Buffer           = arg<wow64::PVOID>(args, 1);
+        const auto BufferLength     = arg<wow64::PULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[252]);
@@ -5083,11 +6173,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwEnumerateTransactionObject(proc_t proc
     {
         auto& core = d_->core;
 
-        const auto RootObjectHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto QueryType          = arg<wow64::KTMOBJECT_TYPE>(core, 1);
-        const auto ObjectCursor       = arg<wow64::PKTMOBJECT_CURSOR>(core, 2);
-        const auto ObjectCursorLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength       = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto RootObjectHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto QueryType          = arg<wow64::KTMOBJECT_TYPE>(args, 1);
+        const auto ObjectCursor       = arg<wow64::PKTMOBJECT_CURSOR>(args, 2);
+        const auto ObjectCursorLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength       = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[253]);
@@ -5102,8 +6196,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwExtendSection(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto SectionHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto NewSectionSize = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto NewSectionSize = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[254]);
@@ -5118,8 +6216,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwFlushBuffersFile(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[255]);
@@ -5134,8 +6236,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwFlushInstallUILanguage(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto InstallUILanguage = arg<wow64::LANGID>(core, 0);
-        const auto SetComittedFlag   = arg<wow64::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto InstallUILanguage = arg<wow64::LANGID>(args, 0);
+        const auto SetComittedFlag   = arg<wow64::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[256]);
@@ -5150,9 +6256,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwFlushInstructionCache(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<wow64::HANDLE>(core, 0);
-        const auto BaseAddress   = arg<wow64::PVOID>(core, 1);
-        const auto Length        = arg<wow64::SIZE_T>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<wow64::HANDLE>(args, 0);
+        const auto BaseAddress   = arg<wow64::PVOID>(args, 1);
+        const auto Length        = arg<wow64::SIZE_T>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[257]);
@@ -5180,10 +6290,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwFlushVirtualMemory(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<wow64::PVOID>(core, 1);
-        const auto RegionSize      = arg<wow64::PSIZE_T>(core, 2);
-        const auto IoStatus        = arg<wow64::PIO_STATUS_BLOCK>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<wow64::PVOID>(args, 1);
+        const auto RegionSize      = arg<wow64::PSIZE_T>(args, 2);
+        const auto IoStatus        = arg<wow64::PIO_STATUS_BLOCK>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[259]);
@@ -5198,8 +6312,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwFreezeTransactions(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto FreezeTimeout = arg<wow64::PLARGE_INTEGER>(core, 0);
-        const auto ThawTimeout   = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FreezeTimeout = arg<wow64::PLARGE_INTEGER>(args, 0);
+        const auto ThawTimeout   = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[260]);
@@ -5214,11 +6332,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwGetNextProcess(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto HandleAttributes = arg<wow64::ULONG>(core, 2);
-        const auto Flags            = arg<wow64::ULONG>(core, 3);
-        const auto NewProcessHandle = arg<wow64::PHANDLE>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto HandleAttributes = arg<wow64::ULONG>(args, 2);
+        const auto Flags            = arg<wow64::ULONG>(args, 3);
+        const auto NewProcessHandle = arg<wow64::PHANDLE>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[261]);
@@ -5233,12 +6355,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwGetNextThread(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto ThreadHandle     = arg<wow64::HANDLE>(core, 1);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 2);
-        const auto HandleAttributes = arg<wow64::ULONG>(core, 3);
-        const auto Flags            = arg<wow64::ULONG>(core, 4);
-        const auto NewThreadHandle  = arg<wow64::PHANDLE>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto ThreadHandle     = arg<wow64::HANDLE>(args, 1);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 2);
+        const auto HandleAttributes = arg<wow64::ULONG>(args, 3);
+        const auto Flags            = arg<wow64::ULONG>(args, 4);
+        const auto NewThreadHandle  = arg<wow64::PHANDLE>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[262]);
@@ -5253,13 +6379,17 @@ opt<bpid_t> wow64::syscalls32::register_ZwGetNotificationResourceManager(proc_t
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto TransactionNotification = arg<wow64::PTRANSACTION_NOTIFICATION>(core, 1);
-        const auto NotificationLength      = arg<wow64::ULONG>(core, 2);
-        const auto Timeout                 = arg<wow64::PLARGE_INTEGER>(core, 3);
-        const auto ReturnLength            = arg<wow64::PULONG>(core, 4);
-        const auto Asynchronous            = arg<wow64::ULONG>(core, 5);
-        const auto AsynchronousContext     = arg<wow64::ULONG_PTR>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto TransactionNotification = arg<wow64::PTRANSACTION_NOTIFICATION>(args, 1);
+        const auto NotificationLength      = arg<wow64::ULONG>(args, 2);
+        const auto Timeout                 = arg<wow64::PLARGE_INTEGER>(args, 3);
+        const auto ReturnLength            = arg<wow64::PULONG>(args, 4);
+        const auto Asynchronous            = arg<wow64::ULONG>(args, 5);
+        const auto AsynchronousContext     = arg<wow64::ULONG_PTR>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[263]);
@@ -5274,8 +6404,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwImpersonateClientOfPort(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<wow64::HANDLE>(core, 0);
-        const auto Message    = arg<wow64::PPORT_MESSAGE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<wow64::HANDLE>(args, 0);
+        const auto Message    = arg<wow64::PPORT_MESSAGE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[264]);
@@ -5290,9 +6424,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwImpersonateThread(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto ServerThreadHandle = arg<wow64::HANDLE>(core, 0);
-        const auto ClientThreadHandle = arg<wow64::HANDLE>(core, 1);
-        const auto SecurityQos        = arg<wow64::PSECURITY_QUALITY_OF_SERVICE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ServerThreadHandle = arg<wow64::HANDLE>(args, 0);
+        const auto ClientThreadHandle = arg<wow64::HANDLE>(args, 1);
+        const auto SecurityQos        = arg<wow64::PSECURITY_QUALITY_OF_SERVICE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[265]);
@@ -5307,7 +6445,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwInitializeRegistry(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto BootCondition = arg<wow64::USHORT>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto BootCondition = arg<wow64::USHORT>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[266]);
@@ -5322,8 +6464,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwIsProcessInJob(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<wow64::HANDLE>(core, 0);
-        const auto JobHandle     = arg<wow64::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<wow64::HANDLE>(args, 0);
+        const auto JobHandle     = arg<wow64::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[267]);
@@ -5351,8 +6497,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwListenPort(proc_t proc, const on_ZwLis
     {
         auto& core = d_->core;
 
-        const auto PortHandle        = arg<wow64::HANDLE>(core, 0);
-        const auto ConnectionRequest = arg<wow64::PPORT_MESSAGE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle        = arg<wow64::HANDLE>(args, 0);
+        const auto ConnectionRequest = arg<wow64::PPORT_MESSAGE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[269]);
@@ -5367,8 +6517,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwLockProductActivationKeys(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto STARpPrivateVer = arg<wow64::ULONG>(core, 0);
-        const auto STARpSafeMode   = arg<wow64::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto STARpPrivateVer = arg<wow64::ULONG>(args, 0);
+        const auto STARpSafeMode   = arg<wow64::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[270]);
@@ -5383,10 +6537,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwLockVirtualMemory(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<wow64::PVOID>(core, 1);
-        const auto RegionSize      = arg<wow64::PSIZE_T>(core, 2);
-        const auto MapType         = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<wow64::PVOID>(args, 1);
+        const auto RegionSize      = arg<wow64::PSIZE_T>(args, 2);
+        const auto MapType         = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[271]);
@@ -5401,7 +6559,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwMakePermanentObject(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Handle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[272]);
@@ -5416,12 +6578,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwMapCMFModule(proc_t proc, const on_ZwM
     {
         auto& core = d_->core;
 
-        const auto What            = arg<wow64::ULONG>(core, 0);
-        const auto Index           = arg<wow64::ULONG>(core, 1);
-        const auto CacheIndexOut   = arg<wow64::PULONG>(core, 2);
-        const auto CacheFlagsOut   = arg<wow64::PULONG>(core, 3);
-        const auto ViewSizeOut     = arg<wow64::PULONG>(core, 4);
-        const auto STARBaseAddress = arg<wow64::PVOID>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto What            = arg<wow64::ULONG>(args, 0);
+        const auto Index           = arg<wow64::ULONG>(args, 1);
+        const auto CacheIndexOut   = arg<wow64::PULONG>(args, 2);
+        const auto CacheFlagsOut   = arg<wow64::PULONG>(args, 3);
+        const auto ViewSizeOut     = arg<wow64::PULONG>(args, 4);
+        const auto STARBaseAddress = arg<wow64::PVOID>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[273]);
@@ -5436,9 +6602,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwMapUserPhysicalPagesScatter(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto STARVirtualAddresses = arg<wow64::PVOID>(core, 0);
-        const auto NumberOfPages        = arg<wow64::ULONG_PTR>(core, 1);
-        const auto UserPfnArray         = arg<wow64::PULONG_PTR>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto STARVirtualAddresses = arg<wow64::PVOID>(args, 0);
+        const auto NumberOfPages        = arg<wow64::ULONG_PTR>(args, 1);
+        const auto UserPfnArray         = arg<wow64::PULONG_PTR>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[274]);
@@ -5453,16 +6623,20 @@ opt<bpid_t> wow64::syscalls32::register_ZwMapViewOfSection(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto SectionHandle      = arg<wow64::HANDLE>(core, 0);
-        const auto ProcessHandle      = arg<wow64::HANDLE>(core, 1);
-        const auto STARBaseAddress    = arg<wow64::PVOID>(core, 2);
-        const auto ZeroBits           = arg<wow64::ULONG_PTR>(core, 3);
-        const auto CommitSize         = arg<wow64::SIZE_T>(core, 4);
-        const auto SectionOffset      = arg<wow64::PLARGE_INTEGER>(core, 5);
-        const auto ViewSize           = arg<wow64::PSIZE_T>(core, 6);
-        const auto InheritDisposition = arg<wow64::SECTION_INHERIT>(core, 7);
-        const auto AllocationType     = arg<wow64::ULONG>(core, 8);
-        const auto Win32Protect       = arg<wow64::WIN32_PROTECTION_MASK>(core, 9);
+        auto args = std::array<arg_t, 10>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionHandle      = arg<wow64::HANDLE>(args, 0);
+        const auto ProcessHandle      = arg<wow64::HANDLE>(args, 1);
+        const auto STARBaseAddress    = arg<wow64::PVOID>(args, 2);
+        const auto ZeroBits           = arg<wow64::ULONG_PTR>(args, 3);
+        const auto CommitSize         = arg<wow64::SIZE_T>(args, 4);
+        const auto SectionOffset      = arg<wow64::PLARGE_INTEGER>(args, 5);
+        const auto ViewSize           = arg<wow64::PSIZE_T>(args, 6);
+        const auto InheritDisposition = arg<wow64::SECTION_INHERIT>(args, 7);
+        const auto AllocationType     = arg<wow64::ULONG>(args, 8);
+        const auto Win32Protect       = arg<wow64::WIN32_PROTECTION_MASK>(args, 9);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[275]);
@@ -5477,7 +6651,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwModifyDriverEntry(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto DriverEntry = arg<wow64::PEFI_DRIVER_ENTRY>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DriverEntry = arg<wow64::PEFI_DRIVER_ENTRY>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[276]);
@@ -5492,9 +6670,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenDirectoryObject(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto DirectoryHandle  = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DirectoryHandle  = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[277]);
@@ -5509,11 +6691,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenEnlistment(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle      = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess         = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ResourceManagerHandle = arg<wow64::HANDLE>(core, 2);
-        const auto EnlistmentGuid        = arg<wow64::LPGUID>(core, 3);
-        const auto ObjectAttributes      = arg<wow64::POBJECT_ATTRIBUTES>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle      = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess         = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ResourceManagerHandle = arg<wow64::HANDLE>(args, 2);
+        const auto EnlistmentGuid        = arg<wow64::LPGUID>(args, 3);
+        const auto ObjectAttributes      = arg<wow64::POBJECT_ATTRIBUTES>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[278]);
@@ -5528,9 +6714,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenIoCompletion(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes   = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[279]);
@@ -5545,9 +6735,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenJobObject(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto JobHandle        = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle        = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[280]);
@@ -5562,9 +6756,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenKey(proc_t proc, const on_ZwOpenKe
     {
         auto& core = d_->core;
 
-        const auto KeyHandle        = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle        = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[281]);
@@ -5579,10 +6777,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenKeyEx(proc_t proc, const on_ZwOpen
     {
         auto& core = d_->core;
 
-        const auto KeyHandle        = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto OpenOptions      = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle        = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto OpenOptions      = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[282]);
@@ -5597,18 +6799,22 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenObjectAuditAlarm(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto SubsystemName      = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto HandleId           = arg<wow64::PVOID>(core, 1);
-        const auto ObjectTypeName     = arg<wow64::PUNICODE_STRING>(core, 2);
-        const auto ObjectName         = arg<wow64::PUNICODE_STRING>(core, 3);
-        const auto SecurityDescriptor = arg<wow64::PSECURITY_DESCRIPTOR>(core, 4);
-        const auto ClientToken        = arg<wow64::HANDLE>(core, 5);
-        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(core, 6);
-        const auto GrantedAccess      = arg<wow64::ACCESS_MASK>(core, 7);
-        const auto Privileges         = arg<wow64::PPRIVILEGE_SET>(core, 8);
-        const auto ObjectCreation     = arg<wow64::BOOLEAN>(core, 9);
-        const auto AccessGranted      = arg<wow64::BOOLEAN>(core, 10);
-        const auto GenerateOnClose    = arg<wow64::PBOOLEAN>(core, 11);
+        auto args = std::array<arg_t, 12>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName      = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto HandleId           = arg<wow64::PVOID>(args, 1);
+        const auto ObjectTypeName     = arg<wow64::PUNICODE_STRING>(args, 2);
+        const auto ObjectName         = arg<wow64::PUNICODE_STRING>(args, 3);
+        const auto SecurityDescriptor = arg<wow64::PSECURITY_DESCRIPTOR>(args, 4);
+        const auto ClientToken        = arg<wow64::HANDLE>(args, 5);
+        const auto DesiredAccess      = arg<wow64::ACCESS_MASK>(args, 6);
+        const auto GrantedAccess      = arg<wow64::ACCESS_MASK>(args, 7);
+        const auto Privileges         = arg<wow64::PPRIVILEGE_SET>(args, 8);
+        const auto ObjectCreation     = arg<wow64::BOOLEAN>(args, 9);
+        const auto AccessGranted      = arg<wow64::BOOLEAN>(args, 10);
+        const auto GenerateOnClose    = arg<wow64::PBOOLEAN>(args, 11);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[283]);
@@ -5623,10 +6829,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenProcess(proc_t proc, const on_ZwOp
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ClientId         = arg<wow64::PCLIENT_ID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ClientId         = arg<wow64::PCLIENT_ID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[284]);
@@ -5641,9 +6851,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenProcessToken(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<wow64::HANDLE>(core, 0);
-        const auto DesiredAccess = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto TokenHandle   = arg<wow64::PHANDLE>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<wow64::HANDLE>(args, 0);
+        const auto DesiredAccess = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto TokenHandle   = arg<wow64::PHANDLE>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[285]);
@@ -5658,10 +6872,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenProcessTokenEx(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto HandleAttributes = arg<wow64::ULONG>(core, 2);
-        const auto TokenHandle      = arg<wow64::PHANDLE>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto HandleAttributes = arg<wow64::ULONG>(args, 2);
+        const auto TokenHandle      = arg<wow64::PHANDLE>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[286]);
@@ -5676,11 +6894,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenResourceManager(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess         = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto TmHandle              = arg<wow64::HANDLE>(core, 2);
-        const auto ResourceManagerGuid   = arg<wow64::LPGUID>(core, 3);
-        const auto ObjectAttributes      = arg<wow64::POBJECT_ATTRIBUTES>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess         = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto TmHandle              = arg<wow64::HANDLE>(args, 2);
+        const auto ResourceManagerGuid   = arg<wow64::LPGUID>(args, 3);
+        const auto ObjectAttributes      = arg<wow64::POBJECT_ATTRIBUTES>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[287]);
@@ -5695,10 +6917,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenThread(proc_t proc, const on_ZwOpe
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle     = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto ClientId         = arg<wow64::PCLIENT_ID>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle     = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto ClientId         = arg<wow64::PCLIENT_ID>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[288]);
@@ -5713,9 +6939,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenTimer(proc_t proc, const on_ZwOpen
     {
         auto& core = d_->core;
 
-        const auto TimerHandle      = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle      = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[289]);
@@ -5730,11 +6960,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenTransaction(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto Uow               = arg<wow64::LPGUID>(core, 3);
-        const auto TmHandle          = arg<wow64::HANDLE>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess     = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes  = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto Uow               = arg<wow64::LPGUID>(args, 3);
+        const auto TmHandle          = arg<wow64::HANDLE>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[290]);
@@ -5749,12 +6983,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwOpenTransactionManager(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto TmHandle         = arg<wow64::PHANDLE>(core, 0);
-        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(core, 1);
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
-        const auto LogFileName      = arg<wow64::PUNICODE_STRING>(core, 3);
-        const auto TmIdentity       = arg<wow64::LPGUID>(core, 4);
-        const auto OpenOptions      = arg<wow64::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TmHandle         = arg<wow64::PHANDLE>(args, 0);
+        const auto DesiredAccess    = arg<wow64::ACCESS_MASK>(args, 1);
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
+        const auto LogFileName      = arg<wow64::PUNICODE_STRING>(args, 3);
+        const auto TmIdentity       = arg<wow64::LPGUID>(args, 4);
+        const auto OpenOptions      = arg<wow64::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[291]);
@@ -5769,11 +7007,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwPowerInformation(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto InformationLevel   = arg<wow64::POWER_INFORMATION_LEVEL>(core, 0);
-        const auto InputBuffer        = arg<wow64::PVOID>(core, 1);
-        const auto InputBufferLength  = arg<wow64::ULONG>(core, 2);
-        const auto OutputBuffer       = arg<wow64::PVOID>(core, 3);
-        const auto OutputBufferLength = arg<wow64::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto InformationLevel   = arg<wow64::POWER_INFORMATION_LEVEL>(args, 0);
+        const auto InputBuffer        = arg<wow64::PVOID>(args, 1);
+        const auto InputBufferLength  = arg<wow64::ULONG>(args, 2);
+        const auto OutputBuffer       = arg<wow64::PVOID>(args, 3);
+        const auto OutputBufferLength = arg<wow64::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[292]);
@@ -5788,8 +7030,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwPrePrepareComplete(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<wow64::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<wow64::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[293]);
@@ -5804,8 +7050,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwPrepareEnlistment(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<wow64::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<wow64::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[294]);
@@ -5820,9 +7070,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwPrivilegeCheck(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto ClientToken        = arg<wow64::HANDLE>(core, 0);
-        const auto RequiredPrivileges = arg<wow64::PPRIVILEGE_SET>(core, 1);
-        const auto Result             = arg<wow64::PBOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ClientToken        = arg<wow64::HANDLE>(args, 0);
+        const auto RequiredPrivileges = arg<wow64::PPRIVILEGE_SET>(args, 1);
+        const auto Result             = arg<wow64::PBOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[295]);
@@ -5837,12 +7091,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwPrivilegeObjectAuditAlarm(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto SubsystemName = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto HandleId      = arg<wow64::PVOID>(core, 1);
-        const auto ClientToken   = arg<wow64::HANDLE>(core, 2);
-        const auto DesiredAccess = arg<wow64::ACCESS_MASK>(core, 3);
-        const auto Privileges    = arg<wow64::PPRIVILEGE_SET>(core, 4);
-        const auto AccessGranted = arg<wow64::BOOLEAN>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SubsystemName = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto HandleId      = arg<wow64::PVOID>(args, 1);
+        const auto ClientToken   = arg<wow64::HANDLE>(args, 2);
+        const auto DesiredAccess = arg<wow64::ACCESS_MASK>(args, 3);
+        const auto Privileges    = arg<wow64::PPRIVILEGE_SET>(args, 4);
+        const auto AccessGranted = arg<wow64::BOOLEAN>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[296]);
@@ -5857,9 +7115,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwPropagationFailed(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle = arg<wow64::HANDLE>(core, 0);
-        const auto RequestCookie         = arg<wow64::ULONG>(core, 1);
-        const auto PropStatus            = arg<wow64::NTSTATUS>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle = arg<wow64::HANDLE>(args, 0);
+        const auto RequestCookie         = arg<wow64::ULONG>(args, 1);
+        const auto PropStatus            = arg<wow64::NTSTATUS>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[297]);
@@ -5874,11 +7136,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwProtectVirtualMemory(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto STARBaseAddress = arg<wow64::PVOID>(core, 1);
-        const auto RegionSize      = arg<wow64::PSIZE_T>(core, 2);
-        const auto NewProtectWin32 = arg<wow64::WIN32_PROTECTION_MASK>(core, 3);
-        const auto OldProtect      = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto STARBaseAddress = arg<wow64::PVOID>(args, 1);
+        const auto RegionSize      = arg<wow64::PSIZE_T>(args, 2);
+        const auto NewProtectWin32 = arg<wow64::WIN32_PROTECTION_MASK>(args, 3);
+        const auto OldProtect      = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[298]);
@@ -5893,8 +7159,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwPulseEvent(proc_t proc, const on_ZwPul
     {
         auto& core = d_->core;
 
-        const auto EventHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto PreviousState = arg<wow64::PLONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto PreviousState = arg<wow64::PLONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[299]);
@@ -5909,8 +7179,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryAttributesFile(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
-        const auto FileInformation  = arg<wow64::PFILE_BASIC_INFORMATION>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
+        const auto FileInformation  = arg<wow64::PFILE_BASIC_INFORMATION>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[300]);
@@ -5925,8 +7199,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryBootEntryOrder(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Ids   = arg<wow64::PULONG>(core, 0);
-        const auto Count = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Ids   = arg<wow64::PULONG>(args, 0);
+        const auto Count = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[301]);
@@ -5941,8 +7219,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryBootOptions(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto BootOptions       = arg<wow64::PBOOT_OPTIONS>(core, 0);
-        const auto BootOptionsLength = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto BootOptions       = arg<wow64::PBOOT_OPTIONS>(args, 0);
+        const auto BootOptionsLength = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[302]);
@@ -5957,7 +7239,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryDefaultUILanguage(proc_t proc, co
     {
         auto& core = d_->core;
 
-        const auto STARDefaultUILanguageId = arg<wow64::LANGID>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto STARDefaultUILanguageId = arg<wow64::LANGID>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[303]);
@@ -5972,17 +7258,21 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryDirectoryFile(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto FileHandle           = arg<wow64::HANDLE>(core, 0);
-        const auto Event                = arg<wow64::HANDLE>(core, 1);
-        const auto ApcRoutine           = arg<wow64::PIO_APC_ROUTINE>(core, 2);
-        const auto ApcContext           = arg<wow64::PVOID>(core, 3);
-        const auto IoStatusBlock        = arg<wow64::PIO_STATUS_BLOCK>(core, 4);
-        const auto FileInformation      = arg<wow64::PVOID>(core, 5);
-        const auto Length               = arg<wow64::ULONG>(core, 6);
-        const auto FileInformationClass = arg<wow64::FILE_INFORMATION_CLASS>(core, 7);
-        const auto ReturnSingleEntry    = arg<wow64::BOOLEAN>(core, 8);
-        const auto FileName             = arg<wow64::PUNICODE_STRING>(core, 9);
-        const auto RestartScan          = arg<wow64::BOOLEAN>(core, 10);
+        auto args = std::array<arg_t, 11>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle           = arg<wow64::HANDLE>(args, 0);
+        const auto Event                = arg<wow64::HANDLE>(args, 1);
+        const auto ApcRoutine           = arg<wow64::PIO_APC_ROUTINE>(args, 2);
+        const auto ApcContext           = arg<wow64::PVOID>(args, 3);
+        const auto IoStatusBlock        = arg<wow64::PIO_STATUS_BLOCK>(args, 4);
+        const auto FileInformation      = arg<wow64::PVOID>(args, 5);
+        const auto Length               = arg<wow64::ULONG>(args, 6);
+        const auto FileInformationClass = arg<wow64::FILE_INFORMATION_CLASS>(args, 7);
+        const auto ReturnSingleEntry    = arg<wow64::BOOLEAN>(args, 8);
+        const auto FileName             = arg<wow64::PUNICODE_STRING>(args, 9);
+        const auto RestartScan          = arg<wow64::BOOLEAN>(args, 10);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[304]);
@@ -5997,13 +7287,17 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryDirectoryObject(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto DirectoryHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto Buffer            = arg<wow64::PVOID>(core, 1);
-        const auto Length            = arg<wow64::ULONG>(core, 2);
-        const auto ReturnSingleEntry = arg<wow64::BOOLEAN>(core, 3);
-        const auto RestartScan       = arg<wow64::BOOLEAN>(core, 4);
-        const auto Context           = arg<wow64::PULONG>(core, 5);
-        const auto ReturnLength      = arg<wow64::PULONG>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DirectoryHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto Buffer            = arg<wow64::PVOID>(args, 1);
+        const auto Length            = arg<wow64::ULONG>(args, 2);
+        const auto ReturnSingleEntry = arg<wow64::BOOLEAN>(args, 3);
+        const auto RestartScan       = arg<wow64::BOOLEAN>(args, 4);
+        const auto Context           = arg<wow64::PULONG>(args, 5);
+        const auto ReturnLength      = arg<wow64::PULONG>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[305]);
@@ -6018,15 +7312,19 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryEaFile(proc_t proc, const on_ZwQu
     {
         auto& core = d_->core;
 
-        const auto FileHandle        = arg<wow64::HANDLE>(core, 0);
-        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
-        const auto Buffer            = arg<wow64::PVOID>(core, 2);
-        const auto Length            = arg<wow64::ULONG>(core, 3);
-        const auto ReturnSingleEntry = arg<wow64::BOOLEAN>(core, 4);
-        const auto EaList            = arg<wow64::PVOID>(core, 5);
-        const auto EaListLength      = arg<wow64::ULONG>(core, 6);
-        const auto EaIndex           = arg<wow64::PULONG>(core, 7);
-        const auto RestartScan       = arg<wow64::BOOLEAN>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle        = arg<wow64::HANDLE>(args, 0);
+        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
+        const auto Buffer            = arg<wow64::PVOID>(args, 2);
+        const auto Length            = arg<wow64::ULONG>(args, 3);
+        const auto ReturnSingleEntry = arg<wow64::BOOLEAN>(args, 4);
+        const auto EaList            = arg<wow64::PVOID>(args, 5);
+        const auto EaListLength      = arg<wow64::ULONG>(args, 6);
+        const auto EaIndex           = arg<wow64::PULONG>(args, 7);
+        const auto RestartScan       = arg<wow64::BOOLEAN>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[306]);
@@ -6041,8 +7339,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryFullAttributesFile(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
-        const auto FileInformation  = arg<wow64::PFILE_NETWORK_OPEN_INFORMATION>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ObjectAttributes = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
+        const auto FileInformation  = arg<wow64::PFILE_NETWORK_OPEN_INFORMATION>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[307]);
@@ -6057,11 +7359,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryInformationEnlistment(proc_t proc
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto EnlistmentInformationClass  = arg<wow64::ENLISTMENT_INFORMATION_CLASS>(core, 1);
-        const auto EnlistmentInformation       = arg<wow64::PVOID>(core, 2);
-        const auto EnlistmentInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength                = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto EnlistmentInformationClass  = arg<wow64::ENLISTMENT_INFORMATION_CLASS>(args, 1);
+        const auto EnlistmentInformation       = arg<wow64::PVOID>(args, 2);
+        const auto EnlistmentInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength                = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[308]);
@@ -6076,11 +7382,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryInformationFile(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto FileHandle           = arg<wow64::HANDLE>(core, 0);
-        const auto IoStatusBlock        = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
-        const auto FileInformation      = arg<wow64::PVOID>(core, 2);
-        const auto Length               = arg<wow64::ULONG>(core, 3);
-        const auto FileInformationClass = arg<wow64::FILE_INFORMATION_CLASS>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle           = arg<wow64::HANDLE>(args, 0);
+        const auto IoStatusBlock        = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
+        const auto FileInformation      = arg<wow64::PVOID>(args, 2);
+        const auto Length               = arg<wow64::ULONG>(args, 3);
+        const auto FileInformationClass = arg<wow64::FILE_INFORMATION_CLASS>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[309]);
@@ -6095,11 +7405,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryInformationJobObject(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto JobHandle                  = arg<wow64::HANDLE>(core, 0);
-        const auto JobObjectInformationClass  = arg<wow64::JOBOBJECTINFOCLASS>(core, 1);
-        const auto JobObjectInformation       = arg<wow64::PVOID>(core, 2);
-        const auto JobObjectInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength               = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle                  = arg<wow64::HANDLE>(args, 0);
+        const auto JobObjectInformationClass  = arg<wow64::JOBOBJECTINFOCLASS>(args, 1);
+        const auto JobObjectInformation       = arg<wow64::PVOID>(args, 2);
+        const auto JobObjectInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength               = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[310]);
@@ -6114,11 +7428,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryInformationPort(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto PortHandle           = arg<wow64::HANDLE>(core, 0);
-        const auto PortInformationClass = arg<wow64::PORT_INFORMATION_CLASS>(core, 1);
-        const auto PortInformation      = arg<wow64::PVOID>(core, 2);
-        const auto Length               = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength         = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle           = arg<wow64::HANDLE>(args, 0);
+        const auto PortInformationClass = arg<wow64::PORT_INFORMATION_CLASS>(args, 1);
+        const auto PortInformation      = arg<wow64::PVOID>(args, 2);
+        const auto Length               = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength         = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[311]);
@@ -6133,11 +7451,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryInformationProcess(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto ProcessInformationClass  = arg<wow64::PROCESSINFOCLASS>(core, 1);
-        const auto ProcessInformation       = arg<wow64::PVOID>(core, 2);
-        const auto ProcessInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength             = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto ProcessInformationClass  = arg<wow64::PROCESSINFOCLASS>(args, 1);
+        const auto ProcessInformation       = arg<wow64::PVOID>(args, 2);
+        const auto ProcessInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength             = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[312]);
@@ -6152,11 +7474,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryInformationResourceManager(proc_t
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto ResourceManagerInformationClass  = arg<wow64::RESOURCEMANAGER_INFORMATION_CLASS>(core, 1);
-        const auto ResourceManagerInformation       = arg<wow64::PVOID>(core, 2);
-        const auto ResourceManagerInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength                     = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto ResourceManagerInformationClass  = arg<wow64::RESOURCEMANAGER_INFORMATION_CLASS>(args, 1);
+        const auto ResourceManagerInformation       = arg<wow64::PVOID>(args, 2);
+        const auto ResourceManagerInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength                     = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[313]);
@@ -6171,11 +7497,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryInformationToken(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto TokenHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto TokenInformationClass  = arg<wow64::TOKEN_INFORMATION_CLASS>(core, 1);
-        const auto TokenInformation       = arg<wow64::PVOID>(core, 2);
-        const auto TokenInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength           = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto TokenInformationClass  = arg<wow64::TOKEN_INFORMATION_CLASS>(args, 1);
+        const auto TokenInformation       = arg<wow64::PVOID>(args, 2);
+        const auto TokenInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength           = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[314]);
@@ -6190,11 +7520,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryInformationTransaction(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto TransactionInformationClass  = arg<wow64::TRANSACTION_INFORMATION_CLASS>(core, 1);
-        const auto TransactionInformation       = arg<wow64::PVOID>(core, 2);
-        const auto TransactionInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength                 = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto TransactionInformationClass  = arg<wow64::TRANSACTION_INFORMATION_CLASS>(args, 1);
+        const auto TransactionInformation       = arg<wow64::PVOID>(args, 2);
+        const auto TransactionInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength                 = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[315]);
@@ -6209,11 +7543,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryInformationWorkerFactory(proc_t p
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto WorkerFactoryInformationClass  = arg<wow64::WORKERFACTORYINFOCLASS>(core, 1);
-        const auto WorkerFactoryInformation       = arg<wow64::PVOID>(core, 2);
-        const auto WorkerFactoryInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength                   = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto WorkerFactoryInformationClass  = arg<wow64::WORKERFACTORYINFOCLASS>(args, 1);
+        const auto WorkerFactoryInformation       = arg<wow64::PVOID>(args, 2);
+        const auto WorkerFactoryInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength                   = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[316]);
@@ -6228,11 +7566,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryKey(proc_t proc, const on_ZwQuery
     {
         auto& core = d_->core;
 
-        const auto KeyHandle           = arg<wow64::HANDLE>(core, 0);
-        const auto KeyInformationClass = arg<wow64::KEY_INFORMATION_CLASS>(core, 1);
-        const auto KeyInformation      = arg<wow64::PVOID>(core, 2);
-        const auto Length              = arg<wow64::ULONG>(core, 3);
-        const auto ResultLength        = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle           = arg<wow64::HANDLE>(args, 0);
+        const auto KeyInformationClass = arg<wow64::KEY_INFORMATION_CLASS>(args, 1);
+        const auto KeyInformation      = arg<wow64::PVOID>(args, 2);
+        const auto Length              = arg<wow64::ULONG>(args, 3);
+        const auto ResultLength        = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[317]);
@@ -6260,15 +7602,19 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryQuotaInformationFile(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto FileHandle        = arg<wow64::HANDLE>(core, 0);
-        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
-        const auto Buffer            = arg<wow64::PVOID>(core, 2);
-        const auto Length            = arg<wow64::ULONG>(core, 3);
-        const auto ReturnSingleEntry = arg<wow64::BOOLEAN>(core, 4);
-        const auto SidList           = arg<wow64::PVOID>(core, 5);
-        const auto SidListLength     = arg<wow64::ULONG>(core, 6);
-        const auto StartSid          = arg<wow64::PULONG>(core, 7);
-        const auto RestartScan       = arg<wow64::BOOLEAN>(core, 8);
+        auto args = std::array<arg_t, 9>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle        = arg<wow64::HANDLE>(args, 0);
+        const auto IoStatusBlock     = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
+        const auto Buffer            = arg<wow64::PVOID>(args, 2);
+        const auto Length            = arg<wow64::ULONG>(args, 3);
+        const auto ReturnSingleEntry = arg<wow64::BOOLEAN>(args, 4);
+        const auto SidList           = arg<wow64::PVOID>(args, 5);
+        const auto SidListLength     = arg<wow64::ULONG>(args, 6);
+        const auto StartSid          = arg<wow64::PULONG>(args, 7);
+        const auto RestartScan       = arg<wow64::BOOLEAN>(args, 8);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[319]);
@@ -6283,11 +7629,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQuerySection(proc_t proc, const on_ZwQ
     {
         auto& core = d_->core;
 
-        const auto SectionHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto SectionInformationClass  = arg<wow64::SECTION_INFORMATION_CLASS>(core, 1);
-        const auto SectionInformation       = arg<wow64::PVOID>(core, 2);
-        const auto SectionInformationLength = arg<wow64::SIZE_T>(core, 3);
-        const auto ReturnLength             = arg<wow64::PSIZE_T>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SectionHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto SectionInformationClass  = arg<wow64::SECTION_INFORMATION_CLASS>(args, 1);
+        const auto SectionInformation       = arg<wow64::PVOID>(args, 2);
+        const auto SectionInformationLength = arg<wow64::SIZE_T>(args, 3);
+        const auto ReturnLength             = arg<wow64::PSIZE_T>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[320]);
@@ -6302,12 +7652,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwQuerySecurityAttributesToken(proc_t pr
     {
         auto& core = d_->core;
 
-        const auto TokenHandle        = arg<wow64::HANDLE>(core, 0);
-        const auto Attributes         = arg<wow64::PUNICODE_STRING>(core, 1);
-        const auto NumberOfAttributes = arg<wow64::ULONG>(core, 2);
-        const auto Buffer             = arg<wow64::PVOID>(core, 3);
-        const auto Length             = arg<wow64::ULONG>(core, 4);
-        const auto ReturnLength       = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle        = arg<wow64::HANDLE>(args, 0);
+        const auto Attributes         = arg<wow64::PUNICODE_STRING>(args, 1);
+        const auto NumberOfAttributes = arg<wow64::ULONG>(args, 2);
+        const auto Buffer             = arg<wow64::PVOID>(args, 3);
+        const auto Length             = arg<wow64::ULONG>(args, 4);
+        const auto ReturnLength       = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[321]);
@@ -6322,11 +7676,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQuerySemaphore(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto SemaphoreHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto SemaphoreInformationClass  = arg<wow64::SEMAPHORE_INFORMATION_CLASS>(core, 1);
-        const auto SemaphoreInformation       = arg<wow64::PVOID>(core, 2);
-        const auto SemaphoreInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength               = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SemaphoreHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto SemaphoreInformationClass  = arg<wow64::SEMAPHORE_INFORMATION_CLASS>(args, 1);
+        const auto SemaphoreInformation       = arg<wow64::PVOID>(args, 2);
+        const auto SemaphoreInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength               = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[322]);
@@ -6341,9 +7699,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwQuerySymbolicLinkObject(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto LinkHandle     = arg<wow64::HANDLE>(core, 0);
-        const auto LinkTarget     = arg<wow64::PUNICODE_STRING>(core, 1);
-        const auto ReturnedLength = arg<wow64::PULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto LinkHandle     = arg<wow64::HANDLE>(args, 0);
+        const auto LinkTarget     = arg<wow64::PUNICODE_STRING>(args, 1);
+        const auto ReturnedLength = arg<wow64::PULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[323]);
@@ -6358,10 +7720,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwQuerySystemEnvironmentValue(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto VariableName  = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto VariableValue = arg<wow64::PWSTR>(core, 1);
-        const auto ValueLength   = arg<wow64::USHORT>(core, 2);
-        const auto ReturnLength  = arg<wow64::PUSHORT>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto VariableName  = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto VariableValue = arg<wow64::PWSTR>(args, 1);
+        const auto ValueLength   = arg<wow64::USHORT>(args, 2);
+        const auto ReturnLength  = arg<wow64::PUSHORT>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[324]);
@@ -6376,11 +7742,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQuerySystemEnvironmentValueEx(proc_t p
     {
         auto& core = d_->core;
 
-        const auto VariableName = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto VendorGuid   = arg<wow64::LPGUID>(core, 1);
-        const auto Value        = arg<wow64::PVOID>(core, 2);
-        const auto ValueLength  = arg<wow64::PULONG>(core, 3);
-        const auto Attributes   = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto VariableName = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto VendorGuid   = arg<wow64::LPGUID>(args, 1);
+        const auto Value        = arg<wow64::PVOID>(args, 2);
+        const auto ValueLength  = arg<wow64::PULONG>(args, 3);
+        const auto Attributes   = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[325]);
@@ -6395,12 +7765,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwQuerySystemInformationEx(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto SystemInformationClass  = arg<wow64::SYSTEM_INFORMATION_CLASS>(core, 0);
-        const auto QueryInformation        = arg<wow64::PVOID>(core, 1);
-        const auto QueryInformationLength  = arg<wow64::ULONG>(core, 2);
-        const auto SystemInformation       = arg<wow64::PVOID>(core, 3);
-        const auto SystemInformationLength = arg<wow64::ULONG>(core, 4);
-        const auto ReturnLength            = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemInformationClass  = arg<wow64::SYSTEM_INFORMATION_CLASS>(args, 0);
+        const auto QueryInformation        = arg<wow64::PVOID>(args, 1);
+        const auto QueryInformationLength  = arg<wow64::ULONG>(args, 2);
+        const auto SystemInformation       = arg<wow64::PVOID>(args, 3);
+        const auto SystemInformationLength = arg<wow64::ULONG>(args, 4);
+        const auto ReturnLength            = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[326]);
@@ -6415,11 +7789,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryTimer(proc_t proc, const on_ZwQue
     {
         auto& core = d_->core;
 
-        const auto TimerHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto TimerInformationClass  = arg<wow64::TIMER_INFORMATION_CLASS>(core, 1);
-        const auto TimerInformation       = arg<wow64::PVOID>(core, 2);
-        const auto TimerInformationLength = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength           = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto TimerInformationClass  = arg<wow64::TIMER_INFORMATION_CLASS>(args, 1);
+        const auto TimerInformation       = arg<wow64::PVOID>(args, 2);
+        const auto TimerInformationLength = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength           = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[327]);
@@ -6434,12 +7812,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwQueryValueKey(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto KeyHandle                = arg<wow64::HANDLE>(core, 0);
-        const auto ValueName                = arg<wow64::PUNICODE_STRING>(core, 1);
-        const auto KeyValueInformationClass = arg<wow64::KEY_VALUE_INFORMATION_CLASS>(core, 2);
-        const auto KeyValueInformation      = arg<wow64::PVOID>(core, 3);
-        const auto Length                   = arg<wow64::ULONG>(core, 4);
-        const auto ResultLength             = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle                = arg<wow64::HANDLE>(args, 0);
+        const auto ValueName                = arg<wow64::PUNICODE_STRING>(args, 1);
+        const auto KeyValueInformationClass = arg<wow64::KEY_VALUE_INFORMATION_CLASS>(args, 2);
+        const auto KeyValueInformation      = arg<wow64::PVOID>(args, 3);
+        const auto Length                   = arg<wow64::ULONG>(args, 4);
+        const auto ResultLength             = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[328]);
@@ -6454,9 +7836,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwRaiseException(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto ExceptionRecord = arg<wow64::PEXCEPTION_RECORD>(core, 0);
-        const auto ContextRecord   = arg<wow64::PCONTEXT>(core, 1);
-        const auto FirstChance     = arg<wow64::BOOLEAN>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ExceptionRecord = arg<wow64::PEXCEPTION_RECORD>(args, 0);
+        const auto ContextRecord   = arg<wow64::PCONTEXT>(args, 1);
+        const auto FirstChance     = arg<wow64::BOOLEAN>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[329]);
@@ -6471,12 +7857,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwRaiseHardError(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto ErrorStatus                = arg<wow64::NTSTATUS>(core, 0);
-        const auto NumberOfParameters         = arg<wow64::ULONG>(core, 1);
-        const auto UnicodeStringParameterMask = arg<wow64::ULONG>(core, 2);
-        const auto Parameters                 = arg<wow64::PULONG_PTR>(core, 3);
-        const auto ValidResponseOptions       = arg<wow64::ULONG>(core, 4);
-        const auto Response                   = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ErrorStatus                = arg<wow64::NTSTATUS>(args, 0);
+        const auto NumberOfParameters         = arg<wow64::ULONG>(args, 1);
+        const auto UnicodeStringParameterMask = arg<wow64::ULONG>(args, 2);
+        const auto Parameters                 = arg<wow64::PULONG_PTR>(args, 3);
+        const auto ValidResponseOptions       = arg<wow64::ULONG>(args, 4);
+        const auto Response                   = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[330]);
@@ -6491,8 +7881,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwReadOnlyEnlistment(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<wow64::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<wow64::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[331]);
@@ -6507,12 +7901,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwReadRequestData(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto PortHandle        = arg<wow64::HANDLE>(core, 0);
-        const auto Message           = arg<wow64::PPORT_MESSAGE>(core, 1);
-        const auto DataEntryIndex    = arg<wow64::ULONG>(core, 2);
-        const auto Buffer            = arg<wow64::PVOID>(core, 3);
-        const auto BufferSize        = arg<wow64::SIZE_T>(core, 4);
-        const auto NumberOfBytesRead = arg<wow64::PSIZE_T>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle        = arg<wow64::HANDLE>(args, 0);
+        const auto Message           = arg<wow64::PPORT_MESSAGE>(args, 1);
+        const auto DataEntryIndex    = arg<wow64::ULONG>(args, 2);
+        const auto Buffer            = arg<wow64::PVOID>(args, 3);
+        const auto BufferSize        = arg<wow64::SIZE_T>(args, 4);
+        const auto NumberOfBytesRead = arg<wow64::PSIZE_T>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[332]);
@@ -6527,7 +7925,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwRecoverTransactionManager(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto TransactionManagerHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionManagerHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[333]);
@@ -6542,11 +7944,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwRegisterProtocolAddressInformation(pro
     {
         auto& core = d_->core;
 
-        const auto ResourceManager         = arg<wow64::HANDLE>(core, 0);
-        const auto ProtocolId              = arg<wow64::PCRM_PROTOCOL_ID>(core, 1);
-        const auto ProtocolInformationSize = arg<wow64::ULONG>(core, 2);
-        const auto ProtocolInformation     = arg<wow64::PVOID>(core, 3);
-        const auto CreateOptions           = arg<wow64::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManager         = arg<wow64::HANDLE>(args, 0);
+        const auto ProtocolId              = arg<wow64::PCRM_PROTOCOL_ID>(args, 1);
+        const auto ProtocolInformationSize = arg<wow64::ULONG>(args, 2);
+        const auto ProtocolInformation     = arg<wow64::PVOID>(args, 3);
+        const auto CreateOptions           = arg<wow64::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[334]);
@@ -6561,7 +7967,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwRegisterThreadTerminatePort(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto PortHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[335]);
@@ -6576,8 +7986,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwReleaseMutant(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto MutantHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto PreviousCount = arg<wow64::PLONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto MutantHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto PreviousCount = arg<wow64::PLONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[336]);
@@ -6592,7 +8006,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwReleaseWorkerFactoryWorker(proc_t proc
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[337]);
@@ -6607,11 +8025,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwRemoveIoCompletion(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle = arg<wow64::HANDLE>(core, 0);
-        const auto STARKeyContext     = arg<wow64::PVOID>(core, 1);
-        const auto STARApcContext     = arg<wow64::PVOID>(core, 2);
-        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(core, 3);
-        const auto Timeout            = arg<wow64::PLARGE_INTEGER>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle = arg<wow64::HANDLE>(args, 0);
+        const auto STARKeyContext     = arg<wow64::PVOID>(args, 1);
+        const auto STARApcContext     = arg<wow64::PVOID>(args, 2);
+        const auto IoStatusBlock      = arg<wow64::PIO_STATUS_BLOCK>(args, 3);
+        const auto Timeout            = arg<wow64::PLARGE_INTEGER>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[338]);
@@ -6626,12 +8048,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwRemoveIoCompletionEx(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto IoCompletionHandle      = arg<wow64::HANDLE>(core, 0);
-        const auto IoCompletionInformation = arg<wow64::PFILE_IO_COMPLETION_INFORMATION>(core, 1);
-        const auto Count                   = arg<wow64::ULONG>(core, 2);
-        const auto NumEntriesRemoved       = arg<wow64::PULONG>(core, 3);
-        const auto Timeout                 = arg<wow64::PLARGE_INTEGER>(core, 4);
-        const auto Alertable               = arg<wow64::BOOLEAN>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto IoCompletionHandle      = arg<wow64::HANDLE>(args, 0);
+        const auto IoCompletionInformation = arg<wow64::PFILE_IO_COMPLETION_INFORMATION>(args, 1);
+        const auto Count                   = arg<wow64::ULONG>(args, 2);
+        const auto NumEntriesRemoved       = arg<wow64::PULONG>(args, 3);
+        const auto Timeout                 = arg<wow64::PLARGE_INTEGER>(args, 4);
+        const auto Alertable               = arg<wow64::BOOLEAN>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[339]);
@@ -6646,8 +8072,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwRemoveProcessDebug(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle     = arg<wow64::HANDLE>(core, 0);
-        const auto DebugObjectHandle = arg<wow64::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle     = arg<wow64::HANDLE>(args, 0);
+        const auto DebugObjectHandle = arg<wow64::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[340]);
@@ -6662,8 +8092,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwRenameKey(proc_t proc, const on_ZwRena
     {
         auto& core = d_->core;
 
-        const auto KeyHandle = arg<wow64::HANDLE>(core, 0);
-        const auto NewName   = arg<wow64::PUNICODE_STRING>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle = arg<wow64::HANDLE>(args, 0);
+        const auto NewName   = arg<wow64::PUNICODE_STRING>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[341]);
@@ -6678,9 +8112,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwReplaceKey(proc_t proc, const on_ZwRep
     {
         auto& core = d_->core;
 
-        const auto NewFile      = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
-        const auto TargetHandle = arg<wow64::HANDLE>(core, 1);
-        const auto OldFile      = arg<wow64::POBJECT_ATTRIBUTES>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto NewFile      = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
+        const auto TargetHandle = arg<wow64::HANDLE>(args, 1);
+        const auto OldFile      = arg<wow64::POBJECT_ATTRIBUTES>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[342]);
@@ -6695,8 +8133,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwReplyPort(proc_t proc, const on_ZwRepl
     {
         auto& core = d_->core;
 
-        const auto PortHandle   = arg<wow64::HANDLE>(core, 0);
-        const auto ReplyMessage = arg<wow64::PPORT_MESSAGE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle   = arg<wow64::HANDLE>(args, 0);
+        const auto ReplyMessage = arg<wow64::PPORT_MESSAGE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[343]);
@@ -6711,8 +8153,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwRequestPort(proc_t proc, const on_ZwRe
     {
         auto& core = d_->core;
 
-        const auto PortHandle     = arg<wow64::HANDLE>(core, 0);
-        const auto RequestMessage = arg<wow64::PPORT_MESSAGE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto PortHandle     = arg<wow64::HANDLE>(args, 0);
+        const auto RequestMessage = arg<wow64::PPORT_MESSAGE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[344]);
@@ -6727,9 +8173,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwResetWriteWatch(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<wow64::HANDLE>(core, 0);
-        const auto BaseAddress   = arg<wow64::PVOID>(core, 1);
-        const auto RegionSize    = arg<wow64::SIZE_T>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<wow64::HANDLE>(args, 0);
+        const auto BaseAddress   = arg<wow64::PVOID>(args, 1);
+        const auto RegionSize    = arg<wow64::SIZE_T>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[345]);
@@ -6744,7 +8194,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwResumeProcess(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[346]);
@@ -6759,8 +8213,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwResumeThread(proc_t proc, const on_ZwR
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle         = arg<wow64::HANDLE>(core, 0);
-        const auto PreviousSuspendCount = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle         = arg<wow64::HANDLE>(args, 0);
+        const auto PreviousSuspendCount = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[347]);
@@ -6775,8 +8233,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwRollbackComplete(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<wow64::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<wow64::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[348]);
@@ -6791,8 +8253,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetBootEntryOrder(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto Ids   = arg<wow64::PULONG>(core, 0);
-        const auto Count = arg<wow64::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Ids   = arg<wow64::PULONG>(args, 0);
+        const auto Count = arg<wow64::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[349]);
@@ -6807,8 +8273,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetBootOptions(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto BootOptions    = arg<wow64::PBOOT_OPTIONS>(core, 0);
-        const auto FieldsToChange = arg<wow64::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto BootOptions    = arg<wow64::PBOOT_OPTIONS>(args, 0);
+        const auto FieldsToChange = arg<wow64::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[350]);
@@ -6823,8 +8293,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetContextThread(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto ThreadContext = arg<wow64::PCONTEXT>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto ThreadContext = arg<wow64::PCONTEXT>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[351]);
@@ -6839,7 +8313,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetDefaultUILanguage(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto DefaultUILanguageId = arg<wow64::LANGID>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DefaultUILanguageId = arg<wow64::LANGID>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[352]);
@@ -6854,10 +8332,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetEaFile(proc_t proc, const on_ZwSetE
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
-        const auto Buffer        = arg<wow64::PVOID>(core, 2);
-        const auto Length        = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
+        const auto Buffer        = arg<wow64::PVOID>(args, 2);
+        const auto Length        = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[353]);
@@ -6872,11 +8354,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationDebugObject(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto DebugObjectHandle           = arg<wow64::HANDLE>(core, 0);
-        const auto DebugObjectInformationClass = arg<wow64::DEBUGOBJECTINFOCLASS>(core, 1);
-        const auto DebugInformation            = arg<wow64::PVOID>(core, 2);
-        const auto DebugInformationLength      = arg<wow64::ULONG>(core, 3);
-        const auto ReturnLength                = arg<wow64::PULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DebugObjectHandle           = arg<wow64::HANDLE>(args, 0);
+        const auto DebugObjectInformationClass = arg<wow64::DEBUGOBJECTINFOCLASS>(args, 1);
+        const auto DebugInformation            = arg<wow64::PVOID>(args, 2);
+        const auto DebugInformationLength      = arg<wow64::ULONG>(args, 3);
+        const auto ReturnLength                = arg<wow64::PULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[354]);
@@ -6891,11 +8377,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationFile(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto FileHandle           = arg<wow64::HANDLE>(core, 0);
-        const auto IoStatusBlock        = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
-        const auto FileInformation      = arg<wow64::PVOID>(core, 2);
-        const auto Length               = arg<wow64::ULONG>(core, 3);
-        const auto FileInformationClass = arg<wow64::FILE_INFORMATION_CLASS>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle           = arg<wow64::HANDLE>(args, 0);
+        const auto IoStatusBlock        = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
+        const auto FileInformation      = arg<wow64::PVOID>(args, 2);
+        const auto Length               = arg<wow64::ULONG>(args, 3);
+        const auto FileInformationClass = arg<wow64::FILE_INFORMATION_CLASS>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[355]);
@@ -6910,10 +8400,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationJobObject(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto JobHandle                  = arg<wow64::HANDLE>(core, 0);
-        const auto JobObjectInformationClass  = arg<wow64::JOBOBJECTINFOCLASS>(core, 1);
-        const auto JobObjectInformation       = arg<wow64::PVOID>(core, 2);
-        const auto JobObjectInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle                  = arg<wow64::HANDLE>(args, 0);
+        const auto JobObjectInformationClass  = arg<wow64::JOBOBJECTINFOCLASS>(args, 1);
+        const auto JobObjectInformation       = arg<wow64::PVOID>(args, 2);
+        const auto JobObjectInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[356]);
@@ -6928,10 +8422,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationKey(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto KeyHandle               = arg<wow64::HANDLE>(core, 0);
-        const auto KeySetInformationClass  = arg<wow64::KEY_SET_INFORMATION_CLASS>(core, 1);
-        const auto KeySetInformation       = arg<wow64::PVOID>(core, 2);
-        const auto KeySetInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle               = arg<wow64::HANDLE>(args, 0);
+        const auto KeySetInformationClass  = arg<wow64::KEY_SET_INFORMATION_CLASS>(args, 1);
+        const auto KeySetInformation       = arg<wow64::PVOID>(args, 2);
+        const auto KeySetInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[357]);
@@ -6946,10 +8444,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationObject(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto Handle                  = arg<wow64::HANDLE>(core, 0);
-        const auto ObjectInformationClass  = arg<wow64::OBJECT_INFORMATION_CLASS>(core, 1);
-        const auto ObjectInformation       = arg<wow64::PVOID>(core, 2);
-        const auto ObjectInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle                  = arg<wow64::HANDLE>(args, 0);
+        const auto ObjectInformationClass  = arg<wow64::OBJECT_INFORMATION_CLASS>(args, 1);
+        const auto ObjectInformation       = arg<wow64::PVOID>(args, 2);
+        const auto ObjectInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[358]);
@@ -6964,10 +8466,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationProcess(proc_t proc, con
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto ProcessInformationClass  = arg<wow64::PROCESSINFOCLASS>(core, 1);
-        const auto ProcessInformation       = arg<wow64::PVOID>(core, 2);
-        const auto ProcessInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto ProcessInformationClass  = arg<wow64::PROCESSINFOCLASS>(args, 1);
+        const auto ProcessInformation       = arg<wow64::PVOID>(args, 2);
+        const auto ProcessInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[359]);
@@ -6982,10 +8488,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationResourceManager(proc_t p
     {
         auto& core = d_->core;
 
-        const auto ResourceManagerHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto ResourceManagerInformationClass  = arg<wow64::RESOURCEMANAGER_INFORMATION_CLASS>(core, 1);
-        const auto ResourceManagerInformation       = arg<wow64::PVOID>(core, 2);
-        const auto ResourceManagerInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ResourceManagerHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto ResourceManagerInformationClass  = arg<wow64::RESOURCEMANAGER_INFORMATION_CLASS>(args, 1);
+        const auto ResourceManagerInformation       = arg<wow64::PVOID>(args, 2);
+        const auto ResourceManagerInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[360]);
@@ -7000,10 +8510,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationThread(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto ThreadInformationClass  = arg<wow64::THREADINFOCLASS>(core, 1);
-        const auto ThreadInformation       = arg<wow64::PVOID>(core, 2);
-        const auto ThreadInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto ThreadInformationClass  = arg<wow64::THREADINFOCLASS>(args, 1);
+        const auto ThreadInformation       = arg<wow64::PVOID>(args, 2);
+        const auto ThreadInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[361]);
@@ -7018,10 +8532,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationToken(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto TokenHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto TokenInformationClass  = arg<wow64::TOKEN_INFORMATION_CLASS>(core, 1);
-        const auto TokenInformation       = arg<wow64::PVOID>(core, 2);
-        const auto TokenInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TokenHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto TokenInformationClass  = arg<wow64::TOKEN_INFORMATION_CLASS>(args, 1);
+        const auto TokenInformation       = arg<wow64::PVOID>(args, 2);
+        const auto TokenInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[362]);
@@ -7036,10 +8554,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationTransaction(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto TransactionHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto TransactionInformationClass  = arg<wow64::TRANSACTION_INFORMATION_CLASS>(core, 1);
-        const auto TransactionInformation       = arg<wow64::PVOID>(core, 2);
-        const auto TransactionInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TransactionHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto TransactionInformationClass  = arg<wow64::TRANSACTION_INFORMATION_CLASS>(args, 1);
+        const auto TransactionInformation       = arg<wow64::PVOID>(args, 2);
+        const auto TransactionInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[363]);
@@ -7054,10 +8576,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationTransactionManager(proc_
     {
         auto& core = d_->core;
 
-        const auto TmHandle                            = arg<wow64::HANDLE>(core, 0);
-        const auto TransactionManagerInformationClass  = arg<wow64::TRANSACTIONMANAGER_INFORMATION_CLASS>(core, 1);
-        const auto TransactionManagerInformation       = arg<wow64::PVOID>(core, 2);
-        const auto TransactionManagerInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TmHandle                            = arg<wow64::HANDLE>(args, 0);
+        const auto TransactionManagerInformationClass  = arg<wow64::TRANSACTIONMANAGER_INFORMATION_CLASS>(args, 1);
+        const auto TransactionManagerInformation       = arg<wow64::PVOID>(args, 2);
+        const auto TransactionManagerInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[364]);
@@ -7072,10 +8598,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetInformationWorkerFactory(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto WorkerFactoryHandle            = arg<wow64::HANDLE>(core, 0);
-        const auto WorkerFactoryInformationClass  = arg<wow64::WORKERFACTORYINFOCLASS>(core, 1);
-        const auto WorkerFactoryInformation       = arg<wow64::PVOID>(core, 2);
-        const auto WorkerFactoryInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto WorkerFactoryHandle            = arg<wow64::HANDLE>(args, 0);
+        const auto WorkerFactoryInformationClass  = arg<wow64::WORKERFACTORYINFOCLASS>(args, 1);
+        const auto WorkerFactoryInformation       = arg<wow64::PVOID>(args, 2);
+        const auto WorkerFactoryInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[365]);
@@ -7090,12 +8620,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetLdtEntries(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto Selector0 = arg<wow64::ULONG>(core, 0);
-        const auto Entry0Low = arg<wow64::ULONG>(core, 1);
-        const auto Entry0Hi  = arg<wow64::ULONG>(core, 2);
-        const auto Selector1 = arg<wow64::ULONG>(core, 3);
-        const auto Entry1Low = arg<wow64::ULONG>(core, 4);
-        const auto Entry1Hi  = arg<wow64::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Selector0 = arg<wow64::ULONG>(args, 0);
+        const auto Entry0Low = arg<wow64::ULONG>(args, 1);
+        const auto Entry0Hi  = arg<wow64::ULONG>(args, 2);
+        const auto Selector1 = arg<wow64::ULONG>(args, 3);
+        const auto Entry1Low = arg<wow64::ULONG>(args, 4);
+        const auto Entry1Hi  = arg<wow64::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[366]);
@@ -7110,7 +8644,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetLowEventPair(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[367]);
@@ -7125,7 +8663,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetLowWaitHighEventPair(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[368]);
@@ -7140,10 +8682,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetQuotaInformationFile(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
-        const auto Buffer        = arg<wow64::PVOID>(core, 2);
-        const auto Length        = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
+        const auto Buffer        = arg<wow64::PVOID>(args, 2);
+        const auto Length        = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[369]);
@@ -7158,8 +8704,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetSystemEnvironmentValue(proc_t proc,
     {
         auto& core = d_->core;
 
-        const auto VariableName  = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto VariableValue = arg<wow64::PUNICODE_STRING>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto VariableName  = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto VariableValue = arg<wow64::PUNICODE_STRING>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[370]);
@@ -7174,11 +8724,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetSystemEnvironmentValueEx(proc_t pro
     {
         auto& core = d_->core;
 
-        const auto VariableName = arg<wow64::PUNICODE_STRING>(core, 0);
-        const auto VendorGuid   = arg<wow64::LPGUID>(core, 1);
-        const auto Value        = arg<wow64::PVOID>(core, 2);
-        const auto ValueLength  = arg<wow64::ULONG>(core, 3);
-        const auto Attributes   = arg<wow64::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto VariableName = arg<wow64::PUNICODE_STRING>(args, 0);
+        const auto VendorGuid   = arg<wow64::LPGUID>(args, 1);
+        const auto Value        = arg<wow64::PVOID>(args, 2);
+        const auto ValueLength  = arg<wow64::ULONG>(args, 3);
+        const auto Attributes   = arg<wow64::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[371]);
@@ -7193,9 +8747,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetSystemInformation(proc_t proc, cons
     {
         auto& core = d_->core;
 
-        const auto SystemInformationClass  = arg<wow64::SYSTEM_INFORMATION_CLASS>(core, 0);
-        const auto SystemInformation       = arg<wow64::PVOID>(core, 1);
-        const auto SystemInformationLength = arg<wow64::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemInformationClass  = arg<wow64::SYSTEM_INFORMATION_CLASS>(args, 0);
+        const auto SystemInformation       = arg<wow64::PVOID>(args, 1);
+        const auto SystemInformationLength = arg<wow64::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[372]);
@@ -7210,9 +8768,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetSystemPowerState(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto SystemAction   = arg<wow64::POWER_ACTION>(core, 0);
-        const auto MinSystemState = arg<wow64::SYSTEM_POWER_STATE>(core, 1);
-        const auto Flags          = arg<wow64::ULONG>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemAction   = arg<wow64::POWER_ACTION>(args, 0);
+        const auto MinSystemState = arg<wow64::SYSTEM_POWER_STATE>(args, 1);
+        const auto Flags          = arg<wow64::ULONG>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[373]);
@@ -7227,8 +8789,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetSystemTime(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto SystemTime   = arg<wow64::PLARGE_INTEGER>(core, 0);
-        const auto PreviousTime = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SystemTime   = arg<wow64::PLARGE_INTEGER>(args, 0);
+        const auto PreviousTime = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[374]);
@@ -7243,8 +8809,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetThreadExecutionState(proc_t proc, c
     {
         auto& core = d_->core;
 
-        const auto esFlags           = arg<wow64::EXECUTION_STATE>(core, 0);
-        const auto STARPreviousFlags = arg<wow64::EXECUTION_STATE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto esFlags           = arg<wow64::EXECUTION_STATE>(args, 0);
+        const auto STARPreviousFlags = arg<wow64::EXECUTION_STATE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[375]);
@@ -7259,13 +8829,17 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetTimer(proc_t proc, const on_ZwSetTi
     {
         auto& core = d_->core;
 
-        const auto TimerHandle     = arg<wow64::HANDLE>(core, 0);
-        const auto DueTime         = arg<wow64::PLARGE_INTEGER>(core, 1);
-        const auto TimerApcRoutine = arg<wow64::PTIMER_APC_ROUTINE>(core, 2);
-        const auto TimerContext    = arg<wow64::PVOID>(core, 3);
-        const auto WakeTimer       = arg<wow64::BOOLEAN>(core, 4);
-        const auto Period          = arg<wow64::LONG>(core, 5);
-        const auto PreviousState   = arg<wow64::PBOOLEAN>(core, 6);
+        auto args = std::array<arg_t, 7>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle     = arg<wow64::HANDLE>(args, 0);
+        const auto DueTime         = arg<wow64::PLARGE_INTEGER>(args, 1);
+        const auto TimerApcRoutine = arg<wow64::PTIMER_APC_ROUTINE>(args, 2);
+        const auto TimerContext    = arg<wow64::PVOID>(args, 3);
+        const auto WakeTimer       = arg<wow64::BOOLEAN>(args, 4);
+        const auto Period          = arg<wow64::LONG>(args, 5);
+        const auto PreviousState   = arg<wow64::PBOOLEAN>(args, 6);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[376]);
@@ -7280,10 +8854,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetTimerEx(proc_t proc, const on_ZwSet
     {
         auto& core = d_->core;
 
-        const auto TimerHandle               = arg<wow64::HANDLE>(core, 0);
-        const auto TimerSetInformationClass  = arg<wow64::TIMER_SET_INFORMATION_CLASS>(core, 1);
-        const auto TimerSetInformation       = arg<wow64::PVOID>(core, 2);
-        const auto TimerSetInformationLength = arg<wow64::ULONG>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TimerHandle               = arg<wow64::HANDLE>(args, 0);
+        const auto TimerSetInformationClass  = arg<wow64::TIMER_SET_INFORMATION_CLASS>(args, 1);
+        const auto TimerSetInformation       = arg<wow64::PVOID>(args, 2);
+        const auto TimerSetInformationLength = arg<wow64::ULONG>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[377]);
@@ -7298,7 +8876,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetUuidSeed(proc_t proc, const on_ZwSe
     {
         auto& core = d_->core;
 
-        const auto Seed = arg<wow64::PCHAR>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Seed = arg<wow64::PCHAR>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[378]);
@@ -7313,12 +8895,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwSetValueKey(proc_t proc, const on_ZwSe
     {
         auto& core = d_->core;
 
-        const auto KeyHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto ValueName  = arg<wow64::PUNICODE_STRING>(core, 1);
-        const auto TitleIndex = arg<wow64::ULONG>(core, 2);
-        const auto Type       = arg<wow64::ULONG>(core, 3);
-        const auto Data       = arg<wow64::PVOID>(core, 4);
-        const auto DataSize   = arg<wow64::ULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto KeyHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto ValueName  = arg<wow64::PUNICODE_STRING>(args, 1);
+        const auto TitleIndex = arg<wow64::ULONG>(args, 2);
+        const auto Type       = arg<wow64::ULONG>(args, 3);
+        const auto Data       = arg<wow64::PVOID>(args, 4);
+        const auto DataSize   = arg<wow64::ULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[379]);
@@ -7333,7 +8919,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwShutdownSystem(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto Action = arg<wow64::SHUTDOWN_ACTION>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Action = arg<wow64::SHUTDOWN_ACTION>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[380]);
@@ -7348,10 +8938,14 @@ opt<bpid_t> wow64::syscalls32::register_ZwSignalAndWaitForSingleObject(proc_t pr
     {
         auto& core = d_->core;
 
-        const auto SignalHandle = arg<wow64::HANDLE>(core, 0);
-        const auto WaitHandle   = arg<wow64::HANDLE>(core, 1);
-        const auto Alertable    = arg<wow64::BOOLEAN>(core, 2);
-        const auto Timeout      = arg<wow64::PLARGE_INTEGER>(core, 3);
+        auto args = std::array<arg_t, 4>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SignalHandle = arg<wow64::HANDLE>(args, 0);
+        const auto WaitHandle   = arg<wow64::HANDLE>(args, 1);
+        const auto Alertable    = arg<wow64::BOOLEAN>(args, 2);
+        const auto Timeout      = arg<wow64::PLARGE_INTEGER>(args, 3);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[381]);
@@ -7366,8 +8960,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwSinglePhaseReject(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto EnlistmentHandle = arg<wow64::HANDLE>(core, 0);
-        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EnlistmentHandle = arg<wow64::HANDLE>(args, 0);
+        const auto TmVirtualClock   = arg<wow64::PLARGE_INTEGER>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[382]);
@@ -7382,7 +8980,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwStopProfile(proc_t proc, const on_ZwSt
     {
         auto& core = d_->core;
 
-        const auto ProfileHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProfileHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[383]);
@@ -7397,7 +8999,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwSuspendProcess(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[384]);
@@ -7412,8 +9018,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwSuspendThread(proc_t proc, const on_Zw
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle         = arg<wow64::HANDLE>(core, 0);
-        const auto PreviousSuspendCount = arg<wow64::PULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle         = arg<wow64::HANDLE>(args, 0);
+        const auto PreviousSuspendCount = arg<wow64::PULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[385]);
@@ -7428,8 +9038,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwTerminateJobObject(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto JobHandle  = arg<wow64::HANDLE>(core, 0);
-        const auto ExitStatus = arg<wow64::NTSTATUS>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto JobHandle  = arg<wow64::HANDLE>(args, 0);
+        const auto ExitStatus = arg<wow64::NTSTATUS>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[386]);
@@ -7444,8 +9058,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwTerminateProcess(proc_t proc, const on
     {
         auto& core = d_->core;
 
-        const auto ProcessHandle = arg<wow64::HANDLE>(core, 0);
-        const auto ExitStatus    = arg<wow64::NTSTATUS>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ProcessHandle = arg<wow64::HANDLE>(args, 0);
+        const auto ExitStatus    = arg<wow64::NTSTATUS>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[387]);
@@ -7460,8 +9078,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwTerminateThread(proc_t proc, const on_
     {
         auto& core = d_->core;
 
-        const auto ThreadHandle = arg<wow64::HANDLE>(core, 0);
-        const auto ExitStatus   = arg<wow64::NTSTATUS>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto ThreadHandle = arg<wow64::HANDLE>(args, 0);
+        const auto ExitStatus   = arg<wow64::NTSTATUS>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[388]);
@@ -7489,12 +9111,16 @@ opt<bpid_t> wow64::syscalls32::register_ZwTraceControl(proc_t proc, const on_ZwT
     {
         auto& core = d_->core;
 
-        const auto FunctionCode = arg<wow64::ULONG>(core, 0);
-        const auto InBuffer     = arg<wow64::PVOID>(core, 1);
-        const auto InBufferLen  = arg<wow64::ULONG>(core, 2);
-        const auto OutBuffer    = arg<wow64::PVOID>(core, 3);
-        const auto OutBufferLen = arg<wow64::ULONG>(core, 4);
-        const auto ReturnLength = arg<wow64::PULONG>(core, 5);
+        auto args = std::array<arg_t, 6>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FunctionCode = arg<wow64::ULONG>(args, 0);
+        const auto InBuffer     = arg<wow64::PVOID>(args, 1);
+        const auto InBufferLen  = arg<wow64::ULONG>(args, 2);
+        const auto OutBuffer    = arg<wow64::PVOID>(args, 3);
+        const auto OutBufferLen = arg<wow64::ULONG>(args, 4);
+        const auto ReturnLength = arg<wow64::PULONG>(args, 5);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[390]);
@@ -7509,7 +9135,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwUmsThreadYield(proc_t proc, const on_Z
     {
         auto& core = d_->core;
 
-        const auto SchedulerParam = arg<wow64::PVOID>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto SchedulerParam = arg<wow64::PVOID>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[391]);
@@ -7524,7 +9154,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwUnloadDriver(proc_t proc, const on_ZwU
     {
         auto& core = d_->core;
 
-        const auto DriverServiceName = arg<wow64::PUNICODE_STRING>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto DriverServiceName = arg<wow64::PUNICODE_STRING>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[392]);
@@ -7539,8 +9173,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwUnloadKey2(proc_t proc, const on_ZwUnl
     {
         auto& core = d_->core;
 
-        const auto TargetKey = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
-        const auto Flags     = arg<wow64::ULONG>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
+        const auto Flags     = arg<wow64::ULONG>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[393]);
@@ -7555,8 +9193,12 @@ opt<bpid_t> wow64::syscalls32::register_ZwUnloadKeyEx(proc_t proc, const on_ZwUn
     {
         auto& core = d_->core;
 
-        const auto TargetKey = arg<wow64::POBJECT_ATTRIBUTES>(core, 0);
-        const auto Event     = arg<wow64::HANDLE>(core, 1);
+        auto args = std::array<arg_t, 2>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto TargetKey = arg<wow64::POBJECT_ATTRIBUTES>(args, 0);
+        const auto Event     = arg<wow64::HANDLE>(args, 1);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[394]);
@@ -7571,11 +9213,15 @@ opt<bpid_t> wow64::syscalls32::register_ZwUnlockFile(proc_t proc, const on_ZwUnl
     {
         auto& core = d_->core;
 
-        const auto FileHandle    = arg<wow64::HANDLE>(core, 0);
-        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(core, 1);
-        const auto ByteOffset    = arg<wow64::PLARGE_INTEGER>(core, 2);
-        const auto Length        = arg<wow64::PLARGE_INTEGER>(core, 3);
-        const auto Key           = arg<wow64::ULONG>(core, 4);
+        auto args = std::array<arg_t, 5>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto FileHandle    = arg<wow64::HANDLE>(args, 0);
+        const auto IoStatusBlock = arg<wow64::PIO_STATUS_BLOCK>(args, 1);
+        const auto ByteOffset    = arg<wow64::PLARGE_INTEGER>(args, 2);
+        const auto Length        = arg<wow64::PLARGE_INTEGER>(args, 3);
+        const auto Key           = arg<wow64::ULONG>(args, 4);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[395]);
@@ -7590,9 +9236,13 @@ opt<bpid_t> wow64::syscalls32::register_ZwWaitForSingleObject(proc_t proc, const
     {
         auto& core = d_->core;
 
-        const auto Handle    = arg<wow64::HANDLE>(core, 0);
-        const auto Alertable = arg<wow64::BOOLEAN>(core, 1);
-        const auto Timeout   = arg<wow64::PLARGE_INTEGER>(core, 2);
+        auto args = std::array<arg_t, 3>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto Handle    = arg<wow64::HANDLE>(args, 0);
+        const auto Alertable = arg<wow64::BOOLEAN>(args, 1);
+        const auto Timeout   = arg<wow64::PLARGE_INTEGER>(args, 2);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[396]);
@@ -7607,7 +9257,11 @@ opt<bpid_t> wow64::syscalls32::register_ZwWaitHighEventPair(proc_t proc, const o
     {
         auto& core = d_->core;
 
-        const auto EventPairHandle = arg<wow64::HANDLE>(core, 0);
+        auto args = std::array<arg_t, 1>{};
+        if(!functions::read_args(core, &args[0], args.size()))
+            return;
+
+        const auto EventPairHandle = arg<wow64::HANDLE>(args, 0);
 
         if constexpr(g_debug)
             tracer::log_call(core, g_callcfgs[397]);
@@ -7637,3 +9291,66 @@ opt<bpid_t> wow64::syscalls32::register_all(proc_t proc, const wow64::syscalls32
         register_callback_with(d, bpid, proc, cfg.name, [=]{ on_call(cfg); });
     return bpid;
 }
+
+opt<bpid_t> wow64::syscalls32::register_filtered(proc_t proc, const filter_t& filter, const on_call_fn& on_call)
+{
+    auto& d          = *d_;
+    d.filter_bpid    = state::acquire_breakpoint_id(d.core);
+    d.filter_proc    = proc;
+    d.filter_on_call = on_call;
+    d.filter_bps.clear();
+    // only matching entries get a breakpoint, every other target stays
+    // free of foreign hits & channel traffic
+    for(const auto& cfg : g_callcfgs)
+    {
+        if(!match_filter(filter, cfg.name))
+            continue;
+
+        const auto bp = arm_filtered(d, d.filter_bpid, proc, cfg, on_call);
+        if(bp)
+            d.filter_bps.push_back({&cfg, bp, true});
+    }
+    return d.filter_bpid;
+}
+
+bool wow64::syscalls32::refilter(const filter_t& filter)
+{
+    auto& d = *d_;
+    if(!d.filter_on_call)
+        return false;
+
+    // flip existing breakpoints in two batches, one per direction
+    auto disarm = state::breakpoint_group(d.core);
+    auto rearm  = state::breakpoint_group_disarmed(d.core);
+    for(auto& entry : d.filter_bps)
+    {
+        const auto keep = match_filter(filter, entry.cfg->name);
+        if(keep == entry.armed)
+            continue;
+
+        state::group_add(keep ? rearm : disarm, entry.bp);
+        entry.armed = keep;
+    }
+    auto ok = state::group_disarm(d.core, disarm);
+    ok &= state::group_rearm(d.core, rearm);
+    // newly-matched targets without a breakpoint yet are armed on creation
+    for(const auto& cfg : g_callcfgs)
+    {
+        if(!match_filter(filter, cfg.name))
+            continue;
+
+        const auto it = std::find_if(d.filter_bps.begin(), d.filter_bps.end(), [&](const armed_t& entry)
+        {
+            return entry.cfg == &cfg;
+        });
+        if(it != d.filter_bps.end())
+            continue;
+
+        const auto bp = arm_filtered(d, d.filter_bpid, d.filter_proc, cfg, d.filter_on_call);
+        if(bp)
+            d.filter_bps.push_back({&cfg, bp, true});
+        else
+            ok = false;
+    }
+    return ok;
+}
@@ -4,10 +4,18 @@
 #include "core.hpp"
 #include "log.hpp"
 #include "os.hpp"
+#include "symbols.hpp"
 #include "types.hpp"
+#include "utils/utils.hpp"
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace
@@ -33,13 +41,393 @@ namespace
 
         return reply;
     }
+
+    // fixed-size record, formatting is deferred to the sink thread
+    struct record_t
+    {
+        const tracer::callcfg_t* call;
+        uint64_t                 time;
+        uint64_t                 guest_tsc;
+        uint64_t                 proc;
+        uint64_t                 thread;
+        uint64_t                 args[20]; // matches callcfg_t capacity
+        uint64_t                 ret;
+        bool                     has_ret; // exit records carry the return value
+    };
+
+    void format_record(const record_t& rec)
+    {
+        std::vector<std::string> args;
+        args.reserve(rec.call->argc);
+        for(size_t i = 0; i < rec.call->argc; ++i)
+            args.emplace_back(fmt::format("{}:{:#x}", rec.call->args[i].name, rec.args[i]));
+        if(rec.has_ret)
+            LOG(INFO, "%s(%s) = 0x%" PRIx64, rec.call->name, join(args, ", ").data(), rec.ret);
+        else
+            LOG(INFO, "%s(%s)", rec.call->name, join(args, ", ").data());
+    }
+
+    constexpr size_t ring_size = 4096; // power of two
+
+    // columnar storage, one fixed-size block of column vectors at a
+    // time; queries scan only the columns they filter on
+    constexpr size_t block_events = 4096;
+
+    struct block_t
+    {
+        uint64_t              tmin; // zone map over times
+        uint64_t              tmax;
+        std::vector<uint64_t> times;
+        std::vector<uint64_t> tscs;
+        std::vector<uint64_t> procs;
+        std::vector<uint64_t> threads;
+        std::vector<uint32_t> calls; // index into Store::names
+    };
+
+    struct Store
+    {
+        std::mutex                                             mutex;
+        std::unordered_map<const tracer::callcfg_t*, uint32_t> ids;
+        std::vector<const char*>                               names;
+        std::vector<block_t>                                   blocks;
+        std::atomic<bool>                                      enabled{false};
+        // clock calibration: first & latest (host, tsc) sample pairs,
+        // refreshed by every logged event
+        std::atomic<uint64_t>                                  first_ns{0};
+        std::atomic<uint64_t>                                  first_tsc{0};
+        std::atomic<uint64_t>                                  last_ns{0};
+        std::atomic<uint64_t>                                  last_tsc{0};
+    };
+
+    Store& store()
+    {
+        static Store g_store;
+        return g_store;
+    }
+
+    void store_append(Store& s, const record_t& rec)
+    {
+        const auto lock = std::lock_guard{s.mutex};
+        auto       id   = uint32_t{};
+        const auto it   = s.ids.find(rec.call);
+        if(it != s.ids.end())
+            id = it->second;
+        else
+        {
+            id = static_cast<uint32_t>(s.names.size());
+            s.names.push_back(rec.call->name);
+            s.ids.emplace(rec.call, id);
+        }
+        if(s.blocks.empty() || s.blocks.back().times.size() >= block_events)
+            s.blocks.push_back(block_t{~uint64_t{0}, 0, {}, {}, {}, {}, {}});
+
+        auto& block = s.blocks.back();
+        block.tmin  = std::min(block.tmin, rec.time);
+        block.tmax  = std::max(block.tmax, rec.time);
+        block.times.push_back(rec.time);
+        block.tscs.push_back(rec.guest_tsc);
+        block.procs.push_back(rec.proc);
+        block.threads.push_back(rec.thread);
+        block.calls.push_back(id);
+    }
+
+    // single-producer single-consumer ring: breakpoint callbacks enqueue
+    // records while this thread formats & flushes them, so the guest
+    // resumes without waiting on stdio
+    struct Sink
+    {
+        Sink()
+            : ring(ring_size)
+            , thread([=] { run(); })
+        {
+        }
+
+        ~Sink()
+        {
+            stop = true;
+            thread.join();
+        }
+
+        void push(const record_t& rec)
+        {
+            // full ring: wait on the formatter rather than drop records
+            const auto widx = write_idx.load(std::memory_order_relaxed);
+            while(widx - read_idx.load(std::memory_order_acquire) >= ring_size)
+                std::this_thread::yield();
+
+            ring[widx & (ring_size - 1)] = rec;
+            write_idx.store(widx + 1, std::memory_order_release);
+        }
+
+        void run()
+        {
+            auto ridx = size_t{0};
+            while(true)
+            {
+                if(ridx == write_idx.load(std::memory_order_acquire))
+                {
+                    // drain fully before honoring stop
+                    if(stop.load(std::memory_order_relaxed))
+                        return;
+
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                    continue;
+                }
+
+                const auto& rec = ring[ridx & (ring_size - 1)];
+                format_record(rec);
+                if(store().enabled.load(std::memory_order_relaxed))
+                    store_append(store(), rec);
+                read_idx.store(++ridx, std::memory_order_release);
+            }
+        }
+
+        std::vector<record_t> ring;
+        std::atomic<size_t>   write_idx{0};
+        std::atomic<size_t>   read_idx{0};
+        std::atomic<bool>     stop{false};
+        std::thread           thread;
+    };
+
+    Sink& sink()
+    {
+        static Sink g_sink;
+        return g_sink;
+    }
+}
+
+namespace
+{
+    record_t capture_record(core::Core& core, const tracer::callcfg_t& call)
+    {
+        // guest reads must happen now, while the vm is paused on the breakpoint
+        const auto now    = std::chrono::steady_clock::now().time_since_epoch();
+        const auto ts     = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+        const auto tsc    = registers::read_msr(core, msr_e::tsc);
+        const auto proc   = process::current(core);
+        const auto thread = threads::current(core);
+        auto rec          = record_t{&call, static_cast<uint64_t>(ts), tsc, proc ? proc->id : 0, thread ? thread->id : 0, {}, 0, false};
+        auto& s           = store();
+        if(tsc)
+        {
+            uint64_t expected = 0;
+            if(s.first_ns.compare_exchange_strong(expected, static_cast<uint64_t>(ts), std::memory_order_relaxed))
+                s.first_tsc.store(tsc, std::memory_order_relaxed);
+            s.last_ns.store(static_cast<uint64_t>(ts), std::memory_order_relaxed);
+            s.last_tsc.store(tsc, std::memory_order_relaxed);
+        }
+        for(size_t i = 0; i < call.argc; ++i)
+            rec.args[i] = read_arg(core, i, call.args[i].size);
+        return rec;
+    }
 }
 
 void tracer::log_call(core::Core& core, const tracer::callcfg_t& call)
 {
-    std::vector<std::string> args;
-    args.reserve(call.argc);
-    for(size_t i = 0; i < call.argc; ++i)
-        args.emplace_back(fmt::format("{}:{:#x}", call.args[i].name, read_arg(core, i, call.args[i].size)));
-    LOG(INFO, "%s(%s)", call.name, join(args, ", ").data());
+    sink().push(capture_record(core, call));
+}
+
+namespace
+{
+    // prototype registry, filled by the generated tables at static-init
+    struct Prototypes
+    {
+        std::mutex                                                     mutex;
+        std::unordered_map<std::string_view, const tracer::callcfg_t*> by_name;
+    };
+
+    Prototypes& prototypes()
+    {
+        static Prototypes g_prototypes;
+        return g_prototypes;
+    }
+}
+
+bool tracer::register_prototypes(const callcfg_t* cfgs, size_t count)
+{
+    auto&      p    = prototypes();
+    const auto lock = std::lock_guard{p.mutex};
+    for(size_t i = 0; i < count; ++i)
+        p.by_name.emplace(cfgs[i].name, &cfgs[i]);
+    return true;
+}
+
+const tracer::callcfg_t* tracer::find_prototype(std::string_view name)
+{
+    auto&      p    = prototypes();
+    const auto lock = std::lock_guard{p.mutex};
+    const auto it   = p.by_name.find(name);
+    return it != p.by_name.end() ? it->second : nullptr;
+}
+
+opt<bpid_t> tracer::break_on_prototype(core::Core& core, proc_t proc, const std::string& module, const std::string& name, const on_typed_call_fn& on_call)
+{
+    const auto* call = find_prototype(name);
+    if(!call)
+        return FAIL(std::nullopt, "no registered prototype for %s", name.data());
+
+    const auto addr = symbols::address(core, proc, module, name);
+    if(!addr)
+        return FAIL(std::nullopt, "unable to find symbol %s!%s", module.data(), name.data());
+
+    const auto ptr = &core;
+    const auto bp  = state::break_on_process(core, name, proc, *addr, [=]
+    {
+        // one batched read covers registers & the stack span
+        arg_t args[COUNT_OF(call->args)];
+        if(call->argc)
+            if(!functions::read_args(*ptr, &args[0], call->argc))
+                return;
+
+        uint64_t values[COUNT_OF(call->args)];
+        for(size_t i = 0; i < call->argc; ++i)
+            values[i] = args[i].val & (~uint64_t(0) >> (64 - call->args[i].size * 8));
+        on_call(*call, values);
+    });
+    if(!bp)
+        return FAIL(std::nullopt, "unable to set breakpoint");
+
+    return state::save_breakpoint(core, bp);
+}
+
+namespace
+{
+    struct pending_t
+    {
+        uint64_t sp;
+        record_t rec;
+    };
+
+    // threads killed mid-call would leak their entries otherwise
+    constexpr size_t max_pending_per_thread = 16;
+
+    // the stack grows down: an entry recorded below the current stack
+    // pointer was already unwound without hitting the exit, e.g. its
+    // thread died & the id got reused; a page of slack absorbs the
+    // frame-depth noise between the entry & exit capture points
+    constexpr uint64_t stale_sp_slack = 0x1000;
+}
+
+struct tracer::CallCorrelator::Data
+{
+    core::Core*       core = nullptr;
+    state::Breakpoint bp; // the one shared sysret-exit breakpoint
+    std::unordered_map<uint64_t, std::vector<pending_t>> pending;
+};
+
+tracer::CallCorrelator::CallCorrelator()
+    : d_(std::make_unique<Data>())
+{
+}
+
+tracer::CallCorrelator::~CallCorrelator() = default;
+
+namespace
+{
+    void resolve_return(tracer::CallCorrelator::Data& d)
+    {
+        const auto thread = threads::current(*d.core);
+        if(!thread)
+            return;
+
+        const auto it = d.pending.find(thread->id);
+        if(it == d.pending.end() || it->second.empty())
+            return;
+
+        // returns unwind in lifo order per thread, validated against
+        // the stack pointer recorded at entry so stale entries never
+        // pair with a foreign return
+        const auto sp = registers::read(*d.core, reg_e::rsp);
+        auto& waiting = it->second;
+        while(!waiting.empty() && waiting.back().sp + stale_sp_slack < sp)
+            waiting.pop_back();
+        if(waiting.empty())
+        {
+            d.pending.erase(it);
+            return;
+        }
+
+        auto rec = waiting.back().rec;
+        waiting.pop_back();
+        if(waiting.empty())
+            d.pending.erase(it);
+
+        rec.ret     = registers::read(*d.core, reg_e::rax);
+        rec.has_ret = true;
+        sink().push(rec);
+    }
+}
+
+bool tracer::setup_correlator(CallCorrelator& corr, core::Core& core)
+{
+    auto& d           = *corr.d_;
+    d.core            = &core;
+    const auto sysret = symbols::address(core, symbols::kernel, "nt", "KiKernelSysretExit");
+    if(!sysret)
+        return FAIL(false, "unable to resolve the sysret exit address");
+
+    d.bp = state::break_on(core, "tracer sysret exit", *sysret, [&d] { resolve_return(d); });
+    return !!d.bp;
+}
+
+void tracer::log_call_entry(CallCorrelator& corr, core::Core& core, const callcfg_t& call)
+{
+    auto rec = capture_record(core, call);
+    sink().push(rec);
+
+    auto& d       = *corr.d_;
+    auto& waiting = d.pending[rec.thread];
+    if(waiting.size() >= max_pending_per_thread)
+        waiting.erase(waiting.begin());
+    waiting.push_back({registers::read(core, reg_e::rsp), rec});
+}
+
+void tracer::enable_store(bool enabled)
+{
+    store().enabled = enabled;
+}
+
+opt<tracer::calibration_t> tracer::clock_calibration()
+{
+    auto&      s         = store();
+    const auto first_ns  = s.first_ns.load(std::memory_order_relaxed);
+    const auto last_ns   = s.last_ns.load(std::memory_order_relaxed);
+    const auto first_tsc = s.first_tsc.load(std::memory_order_relaxed);
+    const auto last_tsc  = s.last_tsc.load(std::memory_order_relaxed);
+    if(!first_ns || !first_tsc)
+        return {};
+
+    auto ret      = calibration_t{last_ns, last_tsc, 0.0};
+    const auto ns = last_ns - first_ns;
+    if(ns)
+        ret.tsc_per_ns = static_cast<double>(last_tsc - first_tsc) / static_cast<double>(ns);
+    return ret;
+}
+
+bool tracer::query_store(std::string_view name, uint64_t begin, uint64_t end, const tracer::on_trace_event_fn& on_event)
+{
+    auto&      s    = store();
+    const auto lock = std::lock_guard{s.mutex};
+    for(const auto& block : s.blocks)
+    {
+        // zone map: blocks outside the window are skipped untouched
+        if(block.tmin > end || block.tmax < begin)
+            continue;
+
+        for(size_t i = 0; i < block.times.size(); ++i)
+        {
+            const auto time = block.times[i];
+            if(time < begin || time > end)
+                continue;
+
+            const auto* call_name = s.names[block.calls[i]];
+            if(!name.empty() && name != call_name)
+                continue;
+
+            const auto ev = trace_event_t{time, block.tscs[i], block.procs[i], block.threads[i], call_name};
+            if(on_event(ev) == walk_e::stop)
+                return true;
+        }
+    }
+    return true;
 }
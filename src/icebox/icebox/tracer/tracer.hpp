@@ -1,7 +1,15 @@
 #pragma once
 
+#include "icebox/types.hpp"
+
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace core { struct Core; }
 
@@ -22,4 +30,189 @@ namespace tracer
     };
 
     void log_call(core::Core& core, const callcfg_t& call);
+
+    // runtime prototype registry: every generated table publishes its
+    // callcfg array once at static-init time, so typed breakpoints can
+    // attach to any known api by symbol name & decode arguments from
+    // the prototype instead of per-event scripting; the first table
+    // registering a name wins
+    bool             register_prototypes(const callcfg_t* cfgs, size_t count);
+    const callcfg_t* find_prototype     (std::string_view name);
+
+    // args hold one value per declared argument, truncated to its size
+    using on_typed_call_fn = std::function<void(const callcfg_t& call, const uint64_t* args)>;
+    // break on module!name in proc; every hit batch-reads the declared
+    // arguments & hands them to on_call already decoded
+    opt<bpid_t> break_on_prototype(core::Core& core, proc_t proc, const std::string& module, const std::string& name, const on_typed_call_fn& on_call);
+
+    // syscall return correlation: entry args land in a pending table
+    // keyed by thread and a single shared sysret-exit breakpoint pops
+    // them in lifo order, matching the stack pointer recorded at entry
+    // so a reused thread id never pairs a foreign return; the
+    // breakpoint count stays constant whatever the call rate
+    struct CallCorrelator
+    {
+         CallCorrelator();
+        ~CallCorrelator();
+
+        struct Data;
+        std::unique_ptr<Data> d_;
+    };
+    bool setup_correlator(CallCorrelator& corr, core::Core& core);
+    // capture the current entry, the paired exit record is emitted
+    // through the trace sink when its thread returns to user mode
+    void log_call_entry  (CallCorrelator& corr, core::Core& core, const callcfg_t& call);
+
+    // compile-time name index over a callcfg table: the generated
+    // tables build one constexpr, so name lookups hash once & probe a
+    // read-only array instead of constructing a map at startup
+    constexpr uint32_t name_hash(std::string_view name)
+    {
+        auto ret = uint32_t{0x811c9dc5};
+        for(const auto c : name)
+        {
+            ret ^= static_cast<uint8_t>(c);
+            ret *= 0x01000193;
+        }
+        return ret;
+    }
+
+    template <size_t N>
+    struct name_index_t
+    {
+        static constexpr size_t pow2(size_t count)
+        {
+            auto ret = size_t{1};
+            while(ret < count)
+                ret <<= 1;
+            return ret;
+        }
+        static constexpr size_t capacity = pow2(N * 2);
+
+        uint16_t slots[capacity]; // entry index + 1, zero means empty
+    };
+
+    template <size_t N>
+    constexpr name_index_t<N> index_names(const std::array<callcfg_t, N>& cfgs)
+    {
+        static_assert(N < UINT16_MAX, "table too large for uint16_t slots");
+        constexpr auto mask = name_index_t<N>::capacity - 1;
+        auto ret            = name_index_t<N>{};
+        for(size_t i = 0; i < N; ++i)
+        {
+            auto slot = name_hash(cfgs[i].name) & mask;
+            while(ret.slots[slot])
+                slot = (slot + 1) & mask;
+            ret.slots[slot] = static_cast<uint16_t>(i + 1);
+        }
+        return ret;
+    }
+
+    template <size_t N>
+    const callcfg_t* find_name(const std::array<callcfg_t, N>& cfgs, const name_index_t<N>& index, std::string_view name)
+    {
+        constexpr auto mask = name_index_t<N>::capacity - 1;
+        auto slot           = name_hash(name) & mask;
+        while(index.slots[slot])
+        {
+            const auto& cfg = cfgs[index.slots[slot] - 1];
+            if(name == cfg.name)
+                return &cfg;
+
+            slot = (slot + 1) & mask;
+        }
+        return nullptr;
+    }
+
+    // embedded columnar store over traced calls, filled off the hot
+    // path by the trace sink thread; per-block min/max timestamps act
+    // as zone maps so time-range queries skip whole blocks untouched
+    struct trace_event_t
+    {
+        uint64_t    time;      // steady-clock nanoseconds
+        uint64_t    guest_tsc; // guest clock at the same instant
+        uint64_t    proc;
+        uint64_t    thread;
+        const char* name;
+    };
+
+    // host-clock & guest-tsc samples taken at the same instants, for
+    // correlating trace events with in-guest logs without fuzzy
+    // alignment; tsc_per_ns is derived from the first & last samples
+    struct calibration_t
+    {
+        uint64_t host_ns;
+        uint64_t guest_tsc;
+        double   tsc_per_ns;
+    };
+    opt<calibration_t> clock_calibration();
+    using on_trace_event_fn = std::function<walk_e(const trace_event_t&)>;
+
+    void enable_store(bool enabled);
+    // events in [begin, end] matching name, empty name matches every call
+    bool query_store (std::string_view name, uint64_t begin, uint64_t end, const on_trace_event_fn& on_event);
+
+    // compact binary trace, post-processors mmap it back instead of
+    // parsing text, see binlog.cpp for the record layout
+    struct Binlog
+    {
+         Binlog();
+        ~Binlog();
+
+        struct Data;
+        std::unique_ptr<Data> d_;
+    };
+    bool open_binlog (Binlog& log, const fs::path& path);
+    bool close_binlog(Binlog& log);
+    bool log_event   (Binlog& log, core::Core& core, const callcfg_t& call);
+    // same record layout, arg values supplied by the caller instead of
+    // being read from the guest
+    bool log_event_with(Binlog& log, core::Core& core, const callcfg_t& call, const uint64_t* args);
+
+    // same record stream as the binary trace, published into a named
+    // shared-memory ring with a seqlock header so companion processes
+    // consume events zero-copy, without a socket hop in between; see
+    // binlog.cpp for the segment layout
+    struct ShmExport
+    {
+         ShmExport();
+        ~ShmExport();
+
+        struct Data;
+        std::unique_ptr<Data> d_;
+    };
+    // frame-compressed binary trace: the record stream is cut into
+    // self-describing frames compressed off the hot path by a worker
+    // pool; a footer index maps raw offsets to frames so the query
+    // layer seeks without decompressing the whole file
+    struct Zlog
+    {
+         Zlog();
+        ~Zlog();
+
+        struct Data;
+        std::unique_ptr<Data> d_;
+    };
+    bool open_zlog (Zlog& log, const fs::path& path, size_t workers);
+    bool close_zlog(Zlog& log);
+    bool zlog_event(Zlog& log, core::Core& core, const callcfg_t& call);
+    // 1 (fastest) to 9 (tightest); the sink steps the effective level
+    // down on its own while frames queue up faster than workers drain
+    void zlog_set_level(Zlog& log, int level);
+
+    struct zlog_frame_t
+    {
+        uint64_t file_offset; // compressed frame position
+        uint64_t comp_size;
+        uint64_t raw_offset;  // position in the uncompressed stream
+        uint64_t raw_size;
+    };
+    // read back a finished trace, frame by frame
+    opt<std::vector<zlog_frame_t>> zlog_index(const fs::path& path);
+    bool zlog_read_frame(const fs::path& path, const zlog_frame_t& frame, std::vector<uint8_t>& dst);
+
+    bool open_shm_export   (ShmExport& exporter, const std::string& name, size_t capacity);
+    bool close_shm_export  (ShmExport& exporter);
+    bool publish_event     (ShmExport& exporter, core::Core& core, const callcfg_t& call);
+    bool publish_event_with(ShmExport& exporter, core::Core& core, const callcfg_t& call, const uint64_t* args);
 } // namespace tracer
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// bump allocator for event-scoped temporaries: allocations are pointer
+// increments into one reused block & everything dies at once on reset,
+// so steady-state events stop touching the heap; state.cpp installs an
+// arena per worker coroutine and resets it when the task finishes
+namespace arena
+{
+    struct Arena
+    {
+        static constexpr size_t default_chunk = 64 * 1024;
+
+        void* alloc(size_t size, size_t align)
+        {
+            auto idx = (used_ + align - 1) & ~(align - 1);
+            while(block_ < blocks_.size() && idx + size > blocks_[block_].size)
+            {
+                ++block_;
+                used_ = 0;
+                idx   = 0;
+            }
+            if(block_ == blocks_.size())
+            {
+                auto block = block_t{};
+                block.size = std::max(default_chunk, size + align);
+                block.data = std::make_unique<uint8_t[]>(block.size);
+                blocks_.emplace_back(std::move(block));
+                used_ = 0;
+                idx   = 0;
+            }
+            used_ = idx + size;
+            return &blocks_[block_].data[idx];
+        }
+
+        // keeps the capacity; overflow blocks coalesce into one so the
+        // next event bumps through a single block
+        void reset()
+        {
+            if(blocks_.size() > 1)
+            {
+                auto total = size_t{0};
+                for(const auto& block : blocks_)
+                    total += block.size;
+                blocks_.clear();
+                auto block = block_t{};
+                block.size = total;
+                block.data = std::make_unique<uint8_t[]>(total);
+                blocks_.emplace_back(std::move(block));
+            }
+            block_ = 0;
+            used_  = 0;
+        }
+
+      private:
+        struct block_t
+        {
+            std::unique_ptr<uint8_t[]> data;
+            size_t                     size = 0;
+        };
+
+        std::vector<block_t> blocks_;
+        size_t               block_ = 0;
+        size_t               used_  = 0;
+    };
+
+    namespace details
+    {
+        inline Arena*& current_slot()
+        {
+            thread_local Arena* g_current = nullptr;
+            return g_current;
+        }
+    } // namespace details
+
+    inline Arena* current()
+    {
+        return details::current_slot();
+    }
+
+    inline Arena* set_current(Arena* arena)
+    {
+        auto& slot     = details::current_slot();
+        auto* previous = slot;
+        slot           = arena;
+        return previous;
+    }
+
+    // std allocator binding to the arena installed at construction
+    // time, falling back to the heap outside any event; the arena must
+    // outlive the container, which holds for worker-scoped temporaries
+    template <typename T>
+    struct allocator
+    {
+        using value_type = T;
+
+        allocator()
+            : arena(current())
+        {
+        }
+
+        template <typename U>
+        allocator(const allocator<U>& arg)
+            : arena(arg.arena)
+        {
+        }
+
+        T* allocate(size_t count)
+        {
+            if(arena)
+                return static_cast<T*>(arena->alloc(count * sizeof(T), alignof(T)));
+
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+
+        void deallocate(T* ptr, size_t /*count*/)
+        {
+            if(!arena)
+                ::operator delete(ptr);
+        }
+
+        Arena* arena = nullptr;
+    };
+
+    template <typename T, typename U>
+    bool operator==(const allocator<T>& a, const allocator<U>& b)
+    {
+        return a.arena == b.arena;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const allocator<T>& a, const allocator<U>& b)
+    {
+        return a.arena != b.arena;
+    }
+
+    template <typename T>
+    using vector = std::vector<T, allocator<T>>;
+    using string = std::basic_string<char, std::char_traits<char>, allocator<char>>;
+} // namespace arena
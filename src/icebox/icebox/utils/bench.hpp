@@ -1,28 +1,154 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
-#include <string>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
 
+// scoped timing probes cheap enough to leave in production builds:
+// BENCH_SCOPE accumulates into a per-site log2 histogram of nanoseconds,
+// sharded by thread to keep the hot path one relaxed fetch_add, &
+// bench::dump merges every site on demand; define DISABLE_BENCH to
+// compile all probes out
 namespace bench
 {
-    struct Log
+    constexpr size_t bucket_count = 64;
+    constexpr size_t shard_count  = 16;
+
+    struct site_t
+    {
+        site_t(const char* name)
+            : name(name)
+        {
+        }
+
+        const char* name;
+        // buckets[shard][log2(ns)], merged at dump time
+        std::array<std::array<std::atomic<uint64_t>, bucket_count>, shard_count> buckets{};
+        std::array<std::atomic<uint64_t>, shard_count>                           total_ns{};
+    };
+
+    namespace details
+    {
+        struct registry_t
+        {
+            std::mutex           mutex; // guards registration only
+            std::deque<site_t>   sites; // deque: site addresses are stable
+            std::vector<site_t*> index;
+        };
+
+        inline registry_t& registry()
+        {
+            static auto r = registry_t{};
+            return r;
+        }
+
+        inline size_t shard()
+        {
+            static std::atomic<size_t> next{0};
+            thread_local const size_t  idx = next.fetch_add(1, std::memory_order_relaxed);
+            return idx & (shard_count - 1);
+        }
+
+        inline size_t bucket(uint64_t ns)
+        {
+            auto ret = size_t{0};
+            while(ns >>= 1)
+                ++ret;
+            return ret;
+        }
+    } // namespace details
+
+    inline site_t& site(const char* name)
     {
-        using timestamp_t = decltype(std::chrono::high_resolution_clock::now());
+        auto&      reg  = details::registry();
+        const auto lock = std::lock_guard{reg.mutex};
+        auto&      ret  = reg.sites.emplace_back(name);
+        reg.index.push_back(&ret);
+        return ret;
+    }
 
-        Log(const char* name)
-            : begin(std::chrono::high_resolution_clock::now())
-            , name(name)
+    struct Scope
+    {
+        Scope(site_t& site)
+            : site(site)
+            , begin(std::chrono::steady_clock::now())
         {
         }
 
-        ~Log()
+        ~Scope()
         {
-            const auto end      = std::chrono::high_resolution_clock::now();
-            const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
-            LOG(INFO, "%s: %" PRId64 " ms", name.data(), duration);
+            const auto end = std::chrono::steady_clock::now();
+            const auto ns  = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+            const auto idx = details::shard();
+            site.buckets[idx][details::bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+            site.total_ns[idx].fetch_add(ns, std::memory_order_relaxed);
         }
 
-        const timestamp_t begin;
-        const std::string name;
+        site_t&                                     site;
+        const std::chrono::steady_clock::time_point begin;
+    };
+
+    struct site_stats_t
+    {
+        const char* name;
+        uint64_t    hits;
+        uint64_t    total_ns;
+        uint64_t    p50_ns;
+        uint64_t    p99_ns;
     };
+
+    // merge the shards of every registered site; values are approximate
+    // under load & percentiles carry log2 bucket resolution
+    template <typename T>
+    void dump(const T& on_site)
+    {
+        auto&      reg  = details::registry();
+        const auto lock = std::lock_guard{reg.mutex};
+        for(auto* site : reg.index)
+        {
+            auto merged = std::array<uint64_t, bucket_count>{};
+            auto stats  = site_stats_t{site->name, 0, 0, 0, 0};
+            for(size_t s = 0; s < shard_count; ++s)
+            {
+                stats.total_ns += site->total_ns[s].load(std::memory_order_relaxed);
+                for(size_t b = 0; b < bucket_count; ++b)
+                {
+                    const auto count = site->buckets[s][b].load(std::memory_order_relaxed);
+                    merged[b] += count;
+                    stats.hits += count;
+                }
+            }
+            if(!stats.hits)
+                continue;
+
+            auto seen = uint64_t{0};
+            for(size_t b = 0; b < bucket_count; ++b)
+            {
+                seen += merged[b];
+                if(!stats.p50_ns && seen * 2 >= stats.hits)
+                    stats.p50_ns = uint64_t{1} << b;
+                if(!stats.p99_ns && seen * 100 >= stats.hits * 99)
+                    stats.p99_ns = uint64_t{1} << b;
+            }
+            on_site(stats);
+        }
+    }
 } // namespace bench
+
+#define BENCH_CAT_(A, B) A##B
+#define BENCH_CAT(A, B)  BENCH_CAT_(A, B)
+
+#ifdef DISABLE_BENCH
+#    define BENCH_SCOPE(NAME) \
+        do                    \
+        {                     \
+        } while(0)
+#else
+#    define BENCH_SCOPE(NAME)                                                        \
+        static auto& BENCH_CAT(bench_site_, __LINE__) = bench::site((NAME));         \
+        const auto BENCH_CAT(bench_scope_, __LINE__)  = bench::Scope{BENCH_CAT(bench_site_, __LINE__)}
+#endif
@@ -1,5 +1,21 @@
 #include "file.hpp"
 
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#ifdef _MSC_VER
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
 bool file::write(const fs::path& output, const void* data, size_t size)
 {
     const auto fd = fopen(output.generic_string().data(), "wb");
@@ -13,3 +29,358 @@ bool file::write(const fs::path& output, const void* data, size_t size)
 
     return true;
 }
+
+namespace
+{
+    struct AsyncWriter
+    {
+        ~AsyncWriter()
+        {
+            {
+                const auto lock = std::lock_guard{mutex};
+                stop            = true;
+            }
+            pending.notify_all();
+            if(worker.joinable())
+                worker.join();
+        }
+
+        void run()
+        {
+            auto lock = std::unique_lock{mutex};
+            while(true)
+            {
+                pending.wait(lock, [&] { return stop || !order.empty(); });
+                if(order.empty())
+                    break;
+
+                const auto path = std::move(order.front());
+                order.pop_front();
+                const auto it = queue.find(path);
+                if(it == queue.end())
+                    continue; // coalesced into a later write
+
+                const auto data = std::move(it->second);
+                queue.erase(it);
+                busy = true; // the popped item stays pending until its write lands
+                lock.unlock();
+                if(!file::write(path, data.data(), data.size()))
+                    fprintf(stderr, "unable to write %s\n", path.data());
+                lock.lock();
+                busy = false;
+                if(order.empty())
+                    drained.notify_all();
+            }
+        }
+
+        bool push(const fs::path& output, std::vector<uint8_t>&& data)
+        {
+            auto path = output.generic_string();
+            {
+                const auto lock = std::lock_guard{mutex};
+                if(stop)
+                    return false;
+
+                if(!worker.joinable())
+                    worker = std::thread{[this] { run(); }};
+                const auto it = queue.find(path);
+                if(it == queue.end())
+                    order.push_back(path);
+                queue[std::move(path)] = std::move(data);
+            }
+            pending.notify_one();
+            return true;
+        }
+
+        void drain()
+        {
+            auto lock = std::unique_lock{mutex};
+            drained.wait(lock, [&] { return order.empty() && !busy; });
+        }
+
+        std::mutex                                                 mutex;
+        std::condition_variable                                    pending;
+        std::condition_variable                                    drained;
+        std::unordered_map<std::string, std::vector<uint8_t>>      queue;
+        std::deque<std::string>                                    order;
+        std::thread                                                worker;
+        bool                                                       stop = false;
+        bool                                                       busy = false; // worker owns a popped, unwritten item
+    };
+
+    AsyncWriter& async_writer()
+    {
+        static AsyncWriter g_writer;
+        return g_writer;
+    }
+}
+
+bool file::write_async(const fs::path& output, std::vector<uint8_t>&& data)
+{
+    return async_writer().push(output, std::move(data));
+}
+
+bool file::write_async(const fs::path& output, const void* data, size_t size)
+{
+    auto buffer = std::vector<uint8_t>(size);
+    memcpy(buffer.data(), data, size);
+    return write_async(output, std::move(buffer));
+}
+
+void file::flush()
+{
+    async_writer().drain();
+}
+
+bool file::map_read(Map& map, const fs::path& input)
+{
+#ifdef _MSC_VER
+    const auto file = CreateFileA(input.generic_string().data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+        return false;
+
+    auto size = LARGE_INTEGER{};
+    if(!GetFileSizeEx(file, &size) || !size.QuadPart)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    const auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if(!mapping)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    const auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if(!view)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    map.data = view;
+    map.size = static_cast<size_t>(size.QuadPart);
+    map.os_a = file;
+    map.os_b = mapping;
+    return true;
+#else
+    const auto fd = open(input.generic_string().data(), O_RDONLY);
+    if(fd < 0)
+        return false;
+
+    struct stat st;
+    if(fstat(fd, &st) || !st.st_size)
+    {
+        close(fd);
+        return false;
+    }
+
+    const auto view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping keeps its own reference
+    if(view == MAP_FAILED)
+        return false;
+
+    map.data = view;
+    map.size = static_cast<size_t>(st.st_size);
+    return true;
+#endif
+}
+
+void file::unmap(Map& map)
+{
+    if(!map.data)
+        return;
+
+#ifdef _MSC_VER
+    UnmapViewOfFile(map.data);
+    CloseHandle(map.os_b);
+    CloseHandle(map.os_a);
+#else
+    munmap(const_cast<void*>(map.data), map.size);
+#endif
+    map = {};
+}
+
+namespace
+{
+    bool remap_writer(file::Writer& writer, size_t capacity)
+    {
+#ifdef _MSC_VER
+        if(writer.data)
+        {
+            UnmapViewOfFile(writer.data);
+            CloseHandle(writer.os_b);
+            writer.data = nullptr;
+            writer.os_b = nullptr;
+        }
+        auto distance = LARGE_INTEGER{};
+        distance.QuadPart = static_cast<LONGLONG>(capacity);
+        if(!SetFilePointerEx(writer.os_a, distance, nullptr, FILE_BEGIN) || !SetEndOfFile(writer.os_a))
+            return false;
+
+        const auto mapping = CreateFileMappingA(writer.os_a, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+        if(!mapping)
+            return false;
+
+        const auto view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0);
+        if(!view)
+        {
+            CloseHandle(mapping);
+            return false;
+        }
+
+        writer.data     = view;
+        writer.os_b     = mapping;
+        writer.capacity = capacity;
+        return true;
+#else
+        if(writer.data)
+        {
+            munmap(writer.data, writer.capacity);
+            writer.data = nullptr;
+        }
+        const auto fd = static_cast<int>(reinterpret_cast<intptr_t>(writer.os_a));
+        if(ftruncate(fd, static_cast<off_t>(capacity)))
+            return false;
+
+        const auto view = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if(view == MAP_FAILED)
+            return false;
+
+        writer.data     = view;
+        writer.capacity = capacity;
+        return true;
+#endif
+    }
+}
+
+bool file::map_write(Writer& writer, const fs::path& output, size_t chunk)
+{
+#ifdef _MSC_VER
+    const auto file = CreateFileA(output.generic_string().data(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+        return false;
+
+    writer.os_a = file;
+#else
+    const auto fd = open(output.generic_string().data(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0)
+        return false;
+
+    writer.os_a = reinterpret_cast<void*>(static_cast<intptr_t>(fd));
+#endif
+    writer.size  = 0;
+    writer.chunk = chunk;
+    if(remap_writer(writer, chunk))
+        return true;
+
+    map_close(writer);
+    return false;
+}
+
+void* file::map_grow(Writer& writer, size_t size)
+{
+    if(!writer.data)
+        return nullptr;
+
+    if(writer.size + size > writer.capacity)
+    {
+        auto capacity = writer.capacity;
+        while(writer.size + size > capacity)
+            capacity += writer.chunk;
+        if(!remap_writer(writer, capacity))
+            return nullptr;
+    }
+
+    const auto ptr = static_cast<uint8_t*>(writer.data) + writer.size;
+    writer.size += size;
+    return ptr;
+}
+
+bool file::map_shared(Shared& shm, const std::string& name, size_t size)
+{
+#ifdef _MSC_VER
+    const auto high    = static_cast<DWORD>(size >> 32);
+    const auto low     = static_cast<DWORD>(size);
+    const auto mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, high, low, name.data());
+    if(!mapping)
+        return false;
+
+    const auto view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if(!view)
+    {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    shm.os_a = mapping;
+#else
+    const auto fd = shm_open(name.data(), O_RDWR | O_CREAT, 0644);
+    if(fd < 0)
+        return false;
+
+    if(ftruncate(fd, static_cast<off_t>(size)))
+    {
+        close(fd);
+        shm_unlink(name.data());
+        return false;
+    }
+
+    const auto view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd); // the mapping keeps its own reference
+    if(view == MAP_FAILED)
+    {
+        shm_unlink(name.data());
+        return false;
+    }
+#endif
+    shm.data = view;
+    shm.size = size;
+    shm.name = name;
+    return true;
+}
+
+void file::unmap_shared(Shared& shm)
+{
+    if(!shm.data)
+        return;
+
+#ifdef _MSC_VER
+    UnmapViewOfFile(shm.data);
+    CloseHandle(shm.os_a);
+#else
+    munmap(shm.data, shm.size);
+    shm_unlink(shm.name.data());
+#endif
+    shm = {};
+}
+
+bool file::map_close(Writer& writer)
+{
+    if(!writer.os_a)
+        return false;
+
+    auto ok = true;
+#ifdef _MSC_VER
+    if(writer.data)
+        UnmapViewOfFile(writer.data);
+    if(writer.os_b)
+        CloseHandle(writer.os_b);
+    auto distance = LARGE_INTEGER{};
+    distance.QuadPart = static_cast<LONGLONG>(writer.size);
+    ok &= !!SetFilePointerEx(writer.os_a, distance, nullptr, FILE_BEGIN);
+    ok &= !!SetEndOfFile(writer.os_a);
+    CloseHandle(writer.os_a);
+#else
+    if(writer.data)
+        munmap(writer.data, writer.capacity);
+    const auto fd = static_cast<int>(reinterpret_cast<intptr_t>(writer.os_a));
+    ok &= !ftruncate(fd, static_cast<off_t>(writer.size));
+    close(fd);
+#endif
+    writer = {};
+    return ok;
+}
@@ -2,7 +2,56 @@
 
 #include "icebox/types.hpp"
 
+#include <string>
+#include <vector>
+
 namespace file
 {
     bool write(const fs::path& output, const void* data, size_t size);
+
+    // queue a write on a background thread; writes to the same path
+    // coalesce so only the latest payload hits the disk, flush()
+    // blocks until the queue drains & pending writes land at exit
+    bool write_async(const fs::path& output, std::vector<uint8_t>&& data);
+    bool write_async(const fs::path& output, const void* data, size_t size);
+    void flush();
+
+    // read-only file mapping, pages are shared across processes
+    struct Map
+    {
+        const void* data = nullptr;
+        size_t      size = 0;
+        void*       os_a = nullptr; // platform handles
+        void*       os_b = nullptr;
+    };
+    bool map_read   (Map& map, const fs::path& input);
+    void unmap      (Map& map);
+
+    // mmap'd output file, preallocated & grown chunk by chunk,
+    // the file is truncated to the written size on close
+    struct Writer
+    {
+        void*  data     = nullptr;
+        size_t size     = 0; // bytes written
+        size_t capacity = 0;
+        size_t chunk    = 0;
+        void*  os_a     = nullptr; // platform handles
+        void*  os_b     = nullptr;
+    };
+    bool    map_write   (Writer& writer, const fs::path& output, size_t chunk);
+    void*   map_grow    (Writer& writer, size_t size);
+    bool    map_close   (Writer& writer);
+
+    // named shared-memory segment, fixed capacity, zero-filled on
+    // creation; other processes open it under the same name (posix
+    // names start with '/'), the segment is unlinked on unmap
+    struct Shared
+    {
+        void*       data = nullptr;
+        size_t      size = 0;
+        void*       os_a = nullptr; // platform handle
+        std::string name;
+    };
+    bool map_shared  (Shared& shm, const std::string& name, size_t size);
+    void unmap_shared(Shared& shm);
 }
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// open-addressing hash map for hot-path tables: slots live in one flat
+// array probed linearly, so lookups walk contiguous memory instead of
+// chasing per-node pointers & inserts never allocate; reserve() at
+// setup sizes the table once and nothing rehashes until the load
+// factor is crossed
+//
+// keys & values must be default-constructible and movable; erased
+// slots become tombstones reused by later inserts; iterators and
+// references invalidate on insert, like any flat container
+namespace flat
+{
+    template <typename Key, typename Value, typename Hash = std::hash<Key>, typename Equal = std::equal_to<Key>>
+    struct map
+    {
+        using value_type = std::pair<Key, Value>;
+
+        enum class slot_e : uint8_t
+        {
+            empty,
+            full,
+            dead,
+        };
+
+        template <typename M, typename V>
+        struct iterator_t
+        {
+            M*     map_;
+            size_t idx_;
+
+            V&   operator*() const { return map_->slots_[idx_]; }
+            V*   operator->() const { return &map_->slots_[idx_]; }
+            bool operator==(const iterator_t& arg) const { return idx_ == arg.idx_; }
+            bool operator!=(const iterator_t& arg) const { return idx_ != arg.idx_; }
+
+            iterator_t& operator++()
+            {
+                ++idx_;
+                while(idx_ < map_->states_.size() && map_->states_[idx_] != slot_e::full)
+                    ++idx_;
+                return *this;
+            }
+        };
+        using iterator       = iterator_t<map, value_type>;
+        using const_iterator = iterator_t<const map, const value_type>;
+
+        void reserve(size_t count)
+        {
+            // one slot in four stays empty so probe chains stay short
+            auto capacity = size_t{8};
+            while(capacity * 3 < count * 4)
+                capacity <<= 1;
+            if(capacity > states_.size())
+                rehash(capacity);
+        }
+
+        size_t size() const { return size_; }
+        bool   empty() const { return !size_; }
+
+        void clear()
+        {
+            for(auto& state : states_)
+                state = slot_e::empty;
+            for(auto& slot : slots_)
+                slot = value_type{};
+            size_ = 0;
+            dead_ = 0;
+        }
+
+        iterator       begin() { return first<iterator>(this); }
+        iterator       end() { return {this, states_.size()}; }
+        const_iterator begin() const { return first<const_iterator>(this); }
+        const_iterator end() const { return {this, states_.size()}; }
+
+        iterator find(const Key& key)
+        {
+            return {this, find_idx(key)};
+        }
+
+        const_iterator find(const Key& key) const
+        {
+            return {this, find_idx(key)};
+        }
+
+        template <typename K, typename V>
+        std::pair<iterator, bool> emplace(K&& key, V&& value)
+        {
+            if((size_ + dead_ + 1) * 4 > states_.size() * 3)
+                rehash(states_.size() ? states_.size() * 2 : 8);
+
+            const auto mask = states_.size() - 1;
+            auto       idx  = Hash{}(key)&mask;
+            auto       dst  = states_.size();
+            while(true)
+            {
+                if(states_[idx] == slot_e::empty)
+                    break;
+
+                if(states_[idx] == slot_e::dead)
+                {
+                    if(dst == states_.size())
+                        dst = idx;
+                }
+                else if(Equal{}(slots_[idx].first, key))
+                    return {{this, idx}, false};
+                idx = (idx + 1) & mask;
+            }
+            if(dst == states_.size())
+                dst = idx;
+            else
+                --dead_;
+            slots_[dst]  = value_type{std::forward<K>(key), std::forward<V>(value)};
+            states_[dst] = slot_e::full;
+            ++size_;
+            return {{this, dst}, true};
+        }
+
+        Value& operator[](const Key& key)
+        {
+            return emplace(key, Value{}).first->second;
+        }
+
+        void erase(iterator it)
+        {
+            slots_[it.idx_]  = value_type{};
+            states_[it.idx_] = slot_e::dead;
+            --size_;
+            ++dead_;
+        }
+
+        size_t erase(const Key& key)
+        {
+            const auto it = find(key);
+            if(it == end())
+                return 0;
+
+            erase(it);
+            return 1;
+        }
+
+      private:
+        template <typename It, typename M>
+        static It first(M* self)
+        {
+            auto idx = size_t{0};
+            while(idx < self->states_.size() && self->states_[idx] != slot_e::full)
+                ++idx;
+            return {self, idx};
+        }
+
+        size_t find_idx(const Key& key) const
+        {
+            if(!size_)
+                return states_.size();
+
+            const auto mask = states_.size() - 1;
+            auto       idx  = Hash{}(key)&mask;
+            while(states_[idx] != slot_e::empty)
+            {
+                if(states_[idx] == slot_e::full && Equal{}(slots_[idx].first, key))
+                    return idx;
+
+                idx = (idx + 1) & mask;
+            }
+            return states_.size();
+        }
+
+        void rehash(size_t capacity)
+        {
+            auto slots  = std::vector<value_type>(capacity);
+            auto states = std::vector<slot_e>(capacity, slot_e::empty);
+            slots_.swap(slots);
+            states_.swap(states);
+            size_ = 0;
+            dead_ = 0;
+            for(size_t i = 0; i < states.size(); ++i)
+                if(states[i] == slot_e::full)
+                    emplace(std::move(slots[i].first), std::move(slots[i].second));
+        }
+
+        std::vector<value_type> slots_;
+        std::vector<slot_e>     states_;
+        size_t                  size_ = 0;
+        size_t                  dead_ = 0;
+    };
+} // namespace flat
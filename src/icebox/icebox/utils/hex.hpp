@@ -1,14 +1,46 @@
 #pragma once
 
 #include <stdint.h>
+#include <string.h>
 
 #include "icebox/endian.hpp"
 #include "utils.hpp"
 
 namespace hex
 {
-    const char chars_upper[] = "0123456789ABCDEF";
-    const char chars_lower[] = "0123456789abcdef";
+    constexpr char chars_upper[] = "0123456789ABCDEF";
+    constexpr char chars_lower[] = "0123456789abcdef";
+
+    namespace details
+    {
+        struct pairs_t
+        {
+            char data[256][2];
+        };
+
+        constexpr pairs_t make_pairs(const char (&hexchars)[17])
+        {
+            auto ret = pairs_t{};
+            for(int i = 0; i < 256; ++i)
+            {
+                ret.data[i][0] = hexchars[i >> 4];
+                ret.data[i][1] = hexchars[i & 0x0F];
+            }
+            return ret;
+        }
+
+        constexpr auto pairs_upper = make_pairs(chars_upper);
+        constexpr auto pairs_lower = make_pairs(chars_lower);
+    } // namespace details
+
+    // one table lookup & one two-byte store per input byte
+    inline void encode(char* dst, const void* vsrc, size_t size, bool lower = false)
+    {
+        const auto&    pairs = lower ? details::pairs_lower : details::pairs_upper;
+        const uint8_t* src   = static_cast<const uint8_t*>(vsrc);
+        for(size_t i = 0; i < size; ++i)
+            memcpy(&dst[i * 2], pairs.data[src[i]], 2);
+    }
 
     template <size_t szhex>
     void convert(char* dst, const char (&hexchars)[szhex], const void* vsrc, size_t size)
@@ -32,9 +64,8 @@ namespace hex
     const char* convert(char (&dst)[szdst], const void* src)
     {
         STATIC_ASSERT_EQ(szdst, !!(flags & HexaPrefix) * 2 + size * 2 + 1);
-        const auto& hexchars = flags & LowerCase ? chars_lower : chars_upper;
-        const auto prefix    = flags & HexaPrefix ? 2 : 0;
-        convert(&dst[prefix], hexchars, src, size);
+        const auto prefix = flags & HexaPrefix ? 2 : 0;
+        encode(&dst[prefix], src, size, !!(flags & LowerCase));
         dst[prefix + size * 2] = 0;
         size_t skip            = 0;
         // we need at least one 0
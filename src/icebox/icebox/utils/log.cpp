@@ -3,8 +3,16 @@
 
 #include <loguru.hpp>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
 
 void logg::init(int argc, char** argv)
 {
@@ -20,10 +28,179 @@ void logg::init(int argc, char** argv)
 namespace
 {
     auto g_log = logg::log_fn{};
+
+    void emit(logg::level_t level, const char* buffer)
+    {
+        if(g_log)
+            return g_log(level, buffer);
+
+        switch(level)
+        {
+            case logg::level_t::info:
+                LOG_F(INFO, "%s", buffer);
+                return;
+
+            case logg::level_t::error:
+                LOG_F(ERROR, "%s", buffer);
+                return;
+        }
+    }
+
+    // bounded mpsc ring: callers format into a slot and return, the
+    // worker thread alone pays for the sink; a full ring drops the
+    // message and bumps a counter reported on the next drain
+    constexpr size_t ring_size = 1024; // power of two
+    constexpr size_t text_size = 512;
+
+    struct slot_t
+    {
+        std::atomic<uint64_t> seq;
+        logg::level_t         level;
+        char                  text[text_size];
+    };
+
+    struct Async
+    {
+        Async()
+        {
+            for(size_t i = 0; i < slots.size(); ++i)
+                slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+
+        ~Async()
+        {
+            {
+                const auto lock = std::lock_guard{mutex};
+                stop            = true;
+            }
+            wake.notify_all();
+            if(worker.joinable())
+                worker.join();
+        }
+
+        void start()
+        {
+            if(started.load(std::memory_order_acquire))
+                return;
+
+            const auto lock = std::lock_guard{mutex};
+            if(started.load(std::memory_order_relaxed))
+                return;
+
+            worker = std::thread{[this] { run(); }};
+            started.store(true, std::memory_order_release);
+        }
+
+        bool push(logg::level_t level, const char* text)
+        {
+            auto pos = head.load(std::memory_order_relaxed);
+            while(true)
+            {
+                auto&      slot = slots[pos & (ring_size - 1)];
+                const auto seq  = slot.seq.load(std::memory_order_acquire);
+                const auto dif  = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+                if(dif < 0)
+                    return false; // full
+
+                if(dif > 0)
+                {
+                    pos = head.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                if(!head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    continue;
+
+                slot.level = level;
+                strncpy(slot.text, text, text_size - 1);
+                slot.text[text_size - 1] = 0;
+                slot.seq.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+
+        void notify()
+        {
+            if(signaled.exchange(true, std::memory_order_release))
+                return;
+
+            {
+                const auto lock = std::lock_guard{mutex};
+            }
+            wake.notify_one();
+        }
+
+        void drain_ring()
+        {
+            while(true)
+            {
+                const auto pos  = tail.load(std::memory_order_relaxed);
+                auto&      slot = slots[pos & (ring_size - 1)];
+                if(slot.seq.load(std::memory_order_acquire) != pos + 1)
+                    break;
+
+                emit(slot.level, slot.text);
+                slot.seq.store(pos + ring_size, std::memory_order_release);
+                tail.store(pos + 1, std::memory_order_release);
+            }
+            const auto drops = dropped.load(std::memory_order_relaxed);
+            if(drops != reported)
+            {
+                char buffer[128];
+                snprintf(buffer, sizeof buffer, "log: ring full, dropped %" PRIu64 " message(s)", drops - reported);
+                emit(logg::level_t::error, buffer);
+                reported = drops;
+            }
+        }
+
+        bool empty() const
+        {
+            return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+        }
+
+        void run()
+        {
+            auto lock = std::unique_lock{mutex};
+            while(true)
+            {
+                wake.wait_for(lock, std::chrono::milliseconds{100}, [&] { return stop || signaled.load(std::memory_order_acquire); });
+                signaled.store(false, std::memory_order_release);
+                lock.unlock();
+                drain_ring();
+                lock.lock();
+                if(empty())
+                {
+                    drained.notify_all();
+                    if(stop)
+                        break;
+                }
+            }
+        }
+
+        std::array<slot_t, ring_size> slots;
+        std::atomic<uint64_t>         head{0};
+        std::atomic<uint64_t>         tail{0};
+        std::atomic<uint64_t>         dropped{0};
+        uint64_t                      reported = 0;
+        std::atomic<bool>             signaled{false};
+        std::atomic<bool>             started{false};
+        std::mutex                    mutex;
+        std::condition_variable       wake;
+        std::condition_variable       drained;
+        std::thread                   worker;
+        bool                          stop = false;
+    };
+
+    Async& async()
+    {
+        static Async g_async;
+        return g_async;
+    }
 }
 
 void logg::redirect(logg::log_fn on_log)
 {
+    flush(); // don't deliver queued messages to the new sink
     g_log = std::move(on_log);
 }
 
@@ -40,17 +217,21 @@ void logg::print(logg::level_t level, const char* fmt, ...)
     va_start(args, fmt);
     FMT_VSNPRINTF(buffer, sizeof buffer, fmt, args);
     va_end(args);
-    if(g_log)
-        return g_log(level, buffer);
+    auto& a = async();
+    a.start();
+    if(!a.push(level, buffer))
+        return void(a.dropped.fetch_add(1, std::memory_order_relaxed));
 
-    switch(level)
-    {
-        case level_t::info:
-            LOG_F(INFO, "%s", buffer);
-            return;
+    a.notify();
+}
 
-        case level_t::error:
-            LOG_F(ERROR, "%s", buffer);
-            return;
-    }
+void logg::flush()
+{
+    auto& a = async();
+    if(!a.started.load(std::memory_order_acquire))
+        return;
+
+    a.notify();
+    auto lock = std::unique_lock{a.mutex};
+    a.drained.wait(lock, [&] { return a.empty(); });
 }
@@ -0,0 +1,147 @@
+#include "lz.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    constexpr size_t min_match    = 4;
+    constexpr size_t max_match    = 0x7f + min_match;
+    constexpr size_t max_distance = 0xffff;
+    constexpr size_t hash_bits    = 15;
+
+    uint32_t hash4(const uint8_t* src)
+    {
+        auto value = uint32_t{};
+        memcpy(&value, src, sizeof value);
+        return (value * UINT32_C(2654435761)) >> (32 - hash_bits);
+    }
+
+    size_t match_length(const uint8_t* a, const uint8_t* b, size_t max)
+    {
+        auto len = size_t{0};
+        while(len < max && a[len] == b[len])
+            ++len;
+        return len;
+    }
+
+    uint8_t* flush_literals(uint8_t* dst, const uint8_t* src, size_t count)
+    {
+        while(count)
+        {
+            const auto run = std::min<size_t>(count, 0x80);
+            *dst++         = static_cast<uint8_t>(run - 1);
+            memcpy(dst, src, run);
+            dst += run;
+            src += run;
+            count -= run;
+        }
+        return dst;
+    }
+}
+
+size_t lz::compress_bound(size_t size)
+{
+    // one control byte per 128 literals plus slack
+    return size + size / 128 + 16;
+}
+
+size_t lz::compress(void* vdst, size_t dst_size, const void* vsrc, size_t size, int level)
+{
+    if(dst_size < compress_bound(size))
+        return 0;
+
+    const auto* src   = static_cast<const uint8_t*>(vsrc);
+    auto*       dst   = static_cast<uint8_t*>(vdst);
+    auto*       out   = dst;
+    const auto  depth = size_t{1} << std::clamp(level - 1, 0, 8); // probes per position
+
+    // head: most recent position per hash, chain: previous position
+    auto head  = std::vector<uint32_t>(size_t{1} << hash_bits, UINT32_MAX);
+    auto chain = std::vector<uint32_t>(size);
+
+    auto lit = size_t{0}; // start of the pending literal run
+    auto pos = size_t{0};
+    while(pos + min_match <= size)
+    {
+        const auto hash = hash4(&src[pos]);
+        auto       best = size_t{0};
+        auto       dist = size_t{0};
+        auto       ref  = head[hash];
+        for(auto probes = depth; probes && ref != UINT32_MAX; --probes, ref = chain[ref])
+        {
+            if(pos - ref > max_distance)
+                break;
+
+            const auto len = match_length(&src[pos], &src[ref], std::min(max_match, size - pos));
+            if(len > best)
+            {
+                best = len;
+                dist = pos - ref;
+            }
+        }
+        chain[pos] = head[hash];
+        head[hash] = static_cast<uint32_t>(pos);
+        if(best < min_match)
+        {
+            ++pos;
+            continue;
+        }
+
+        out    = flush_literals(out, &src[lit], pos - lit);
+        *out++ = static_cast<uint8_t>(0x80 | (best - min_match));
+        *out++ = static_cast<uint8_t>(dist);
+        *out++ = static_cast<uint8_t>(dist >> 8);
+        // index skipped positions so later matches can reach into them
+        const auto match_end = pos + best;
+        const auto index_end = std::min(match_end, size - min_match + 1);
+        for(++pos; pos < index_end; ++pos)
+        {
+            const auto h = hash4(&src[pos]);
+            chain[pos]   = head[h];
+            head[h]      = static_cast<uint32_t>(pos);
+        }
+        pos = match_end;
+        lit = match_end;
+    }
+    out = flush_literals(out, &src[lit], size - lit);
+    return out - dst;
+}
+
+size_t lz::decompress(void* vdst, size_t dst_size, const void* vsrc, size_t size)
+{
+    const auto* src = static_cast<const uint8_t*>(vsrc);
+    const auto* end = src + size;
+    auto*       dst = static_cast<uint8_t*>(vdst);
+    auto        out = size_t{0};
+    while(src < end)
+    {
+        const auto token = *src++;
+        if(token < 0x80)
+        {
+            const auto run = size_t{token} + 1;
+            if(src + run > end || out + run > dst_size)
+                return 0;
+
+            memcpy(&dst[out], src, run);
+            src += run;
+            out += run;
+            continue;
+        }
+
+        if(src + 2 > end)
+            return 0;
+
+        const auto len  = static_cast<size_t>(token & 0x7f) + min_match;
+        const auto dist = size_t{src[0]} | (size_t{src[1]} << 8);
+        src += 2;
+        if(!dist || dist > out || out + len > dst_size)
+            return 0;
+
+        // byte-by-byte, matches may overlap their own output
+        for(size_t i = 0; i < len; ++i, ++out)
+            dst[out] = dst[out - dist];
+    }
+    return out;
+}
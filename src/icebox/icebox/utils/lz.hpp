@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// small byte-oriented lz codec for trace frames: greedy hash-chain
+// matcher, self-contained so traces stay readable without an external
+// library; the format is token streams of
+//   0x00-0x7f: literal run, token+1 bytes follow
+//   0x80-0xff: match, length (token & 0x7f) + 4, u16le distance follows
+namespace lz
+{
+    constexpr int min_level = 1; // single hash probe, fastest
+    constexpr int max_level = 9; // deepest chain search
+
+    // worst case output size for size input bytes
+    size_t compress_bound(size_t size);
+
+    // returns compressed size, 0 when dst_size is too small
+    size_t compress  (void* dst, size_t dst_size, const void* src, size_t size, int level);
+    // returns decompressed size, 0 on malformed input or short dst
+    size_t decompress(void* dst, size_t dst_size, const void* src, size_t size);
+} // namespace lz
@@ -6,7 +6,13 @@
 #include "log.hpp"
 #include "utils/utils.hpp"
 
+#include "memory.hpp"
+
 #include <array>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <tuple>
 
 namespace nt
 {
@@ -171,6 +177,88 @@ namespace nt
 
 } // namespace nt
 
+namespace
+{
+    // module-load storms at process startup used to generate hundreds of
+    // tiny reads: pull the whole header page once, parse it locally &
+    // cache the result per module identity
+    constexpr size_t header_size       = 0x1000;
+    constexpr size_t max_debug_entries = 16;
+
+    struct parsed_t
+    {
+        bool                        pe64;
+        std::array<opt<span_t>, 16> dirs;
+        opt<span_t>                 codeview;
+        bool                        codeview_set;
+    };
+
+    // (proc id, addr, size) identifies one loaded module
+    using module_id_t = std::tuple<uint64_t, uint64_t, uint64_t>;
+
+    struct cache_t
+    {
+        std::mutex                           mutex;
+        std::map<module_id_t, opt<parsed_t>> entries;
+    };
+
+    cache_t& cache()
+    {
+        static cache_t g_cache;
+        return g_cache;
+    }
+
+    module_id_t identify(const memory::Io& io, span_t span)
+    {
+        return {io.proc ? io.proc->id : 0, span.addr, span.size};
+    }
+
+    opt<parsed_t> parse_headers(const memory::Io& io, span_t span)
+    {
+        auto       buf  = std::array<uint8_t, header_size>{};
+        const auto size = span.size ? std::min<uint64_t>(header_size, span.size) : header_size;
+        if(!io.read_all(&buf[0], span.addr, size))
+            return FAIL(std::nullopt, "unable to read pe headers at 0x%" PRIx64, span.addr);
+
+        const auto e_lfanew = read_le32(&buf[offsetof(nt::IMAGE_DOS_HEADER, e_lfanew)]);
+        const auto file_hdr = e_lfanew + offsetof(nt::IMAGE_NT_HEADERS64, FileHeader);
+        if(file_hdr + sizeof(nt::IMAGE_FILE_HEADER) > size)
+            return FAIL(std::nullopt, "pe headers at 0x%" PRIx64 " overflow the header page", span.addr);
+
+        auto       ret     = parsed_t{};
+        const auto machine = read_le16(&buf[file_hdr + offsetof(nt::IMAGE_FILE_HEADER, Machine)]);
+        ret.pe64           = machine == nt::image_file_machine_amd64;
+        const auto opt_hdr = e_lfanew + offsetof(nt::IMAGE_NT_HEADERS64, OptionalHeader);
+        const auto offset  = ret.pe64 ? offsetof(nt::IMAGE_OPTIONAL_HEADER64, DataDirectory) : offsetof(nt::IMAGE_OPTIONAL_HEADER32, DataDirectory);
+        for(size_t id = 0; id < ret.dirs.size(); ++id)
+        {
+            const auto entry = opt_hdr + offset + id * sizeof(nt::IMAGE_DATA_DIRECTORY);
+            if(entry + sizeof(nt::IMAGE_DATA_DIRECTORY) > size)
+                break;
+
+            const auto va = read_le32(&buf[entry + offsetof(nt::IMAGE_DATA_DIRECTORY, VirtualAddress)]);
+            if(!va)
+                continue;
+
+            const auto dir_size = read_le32(&buf[entry + offsetof(nt::IMAGE_DATA_DIRECTORY, Size)]);
+            ret.dirs[id]        = span_t{span.addr + va, dir_size};
+        }
+        return ret;
+    }
+
+    opt<parsed_t>& parsed(const memory::Io& io, span_t span)
+    {
+        auto&      c    = cache();
+        const auto lock = std::lock_guard{c.mutex};
+        const auto key  = identify(io, span);
+        const auto it   = c.entries.find(key);
+        if(it != c.entries.end())
+            return it->second;
+
+        return c.entries.emplace(key, parse_headers(io, span)).first->second;
+    }
+}
+
 opt<bool> pe::is_pe64(const memory::Io& io, const uint64_t image_file_header)
 {
     const auto machine = io.le16(image_file_header + offsetof(nt::IMAGE_FILE_HEADER, Machine));
@@ -182,51 +270,57 @@ opt<bool> pe::is_pe64(const memory::Io& io, const uint64_t image_file_header)
 
 opt<span_t> pe::find_image_directory(const memory::Io& io, const span_t span, const image_directory_entry_e id)
 {
-    const auto e_lfanew = io.le32(span.addr + offsetof(nt::IMAGE_DOS_HEADER, e_lfanew));
-    if(!e_lfanew)
-        return FAIL(std::nullopt, "unable to read e_lfanew");
-
-    const auto image_nt_header       = span.addr + *e_lfanew;
-    const auto image_file_header     = image_nt_header + offsetof(nt::IMAGE_NT_HEADERS64, FileHeader);
-    const auto image_optional_header = image_nt_header + offsetof(nt::IMAGE_NT_HEADERS64, OptionalHeader);
-
-    const auto pe64 = is_pe64(io, image_file_header);
-    if(!pe64)
-        return FAIL(std::nullopt, "unable to read get pe machine type");
-
-    const auto offset          = *pe64 ? offsetof(nt::IMAGE_OPTIONAL_HEADER64, DataDirectory) : offsetof(nt::IMAGE_OPTIONAL_HEADER32, DataDirectory);
-    const auto data_directory  = image_optional_header + offset + id * sizeof(nt::IMAGE_DATA_DIRECTORY);
-    const auto virtual_address = io.le32(data_directory + offsetof(nt::IMAGE_DATA_DIRECTORY, VirtualAddress));
-    if(!virtual_address || !*virtual_address)
-        return FAIL(std::nullopt, "unable to read DataDirectory.VirtualAddress");
+    const auto& entry = parsed(io, span);
+    if(!entry)
+        return {};
 
-    const auto size = io.le32(data_directory + offsetof(nt::IMAGE_DATA_DIRECTORY, Size));
-    if(!size)
-        return FAIL(std::nullopt, "unable to read DataDirectory.Size");
+    if(!entry->dirs[id])
+        return FAIL(std::nullopt, "unable to read DataDirectory.VirtualAddress");
 
-    // LOG(INFO, "exception_dir addr {:#x} section size {:#x}", span.addr + *data_directory_virtual_address, *data_directory_size);
-    return span_t{span.addr + *virtual_address, *size};
+    return entry->dirs[id];
 }
 
 opt<span_t> pe::find_debug_codeview(const memory::Io& io, span_t span)
 {
+    {
+        auto&      c    = cache();
+        const auto lock = std::lock_guard{c.mutex};
+        const auto it   = c.entries.find(identify(io, span));
+        if(it != c.entries.end() && it->second && it->second->codeview_set)
+            return it->second->codeview;
+    }
     const auto directory = find_image_directory(io, span, pe::IMAGE_DIRECTORY_ENTRY_DEBUG);
     if(!directory)
         return {};
 
-    const auto type = io.le32(directory->addr + offsetof(nt::IMAGE_DEBUG_DIRECTORY, Type));
-    if(!type)
+    // one batched read of the whole directory, scanned locally
+    auto       entries = std::array<nt::IMAGE_DEBUG_DIRECTORY, max_debug_entries>{};
+    const auto count   = std::min<size_t>(directory->size / sizeof entries[0], entries.size());
+    if(!count)
         return {};
 
-    if(*type != 2)
-        return FAIL(std::nullopt, "invalid IMAGE_DEBUG_TYPE, want IMAGE_DEBUG_TYPE_CODEVIEW = 2, got %d", *type);
-
-    const auto addr = io.le32(directory->addr + offsetof(nt::IMAGE_DEBUG_DIRECTORY, AddressOfRawData));
-    const auto size = io.le32(directory->addr + offsetof(nt::IMAGE_DEBUG_DIRECTORY, SizeOfData));
-    if(!addr || !size)
+    if(!io.read_all(&entries[0], directory->addr, count * sizeof entries[0]))
         return {};
 
-    return span_t{span.addr + *addr, *size};
+    auto ret = opt<span_t>{};
+    for(size_t i = 0; i < count; ++i)
+        if(entries[i].Type == 2) // IMAGE_DEBUG_TYPE_CODEVIEW
+        {
+            ret = span_t{span.addr + entries[i].AddressOfRawData, entries[i].SizeOfData};
+            break;
+        }
+    if(!ret)
+        return FAIL(std::nullopt, "no IMAGE_DEBUG_TYPE_CODEVIEW = 2 entry in %zd debug directory entries", count);
+
+    auto&      c    = cache();
+    const auto lock = std::lock_guard{c.mutex};
+    const auto it   = c.entries.find(identify(io, span));
+    if(it != c.entries.end() && it->second)
+    {
+        it->second->codeview     = ret;
+        it->second->codeview_set = true;
+    }
+    return ret;
 }
 
 opt<size_t> pe::read_image_size(const void* vsrc, size_t size)
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// vector with inline capacity for dispatch paths: the first N elements
+// live inside the object so steady-state events never touch the heap,
+// & growth past N spills to a heap block like a regular vector
+namespace utils
+{
+    template <typename T, size_t N>
+    struct small_vector
+    {
+        static_assert(N > 0, "inline capacity cannot be empty");
+
+        small_vector() = default;
+
+        explicit small_vector(size_t count, const T& value = T{})
+        {
+            reserve(count);
+            for(size_t i = 0; i < count; ++i)
+                new(&ptr_[i]) T{value};
+            size_ = count;
+        }
+
+        small_vector(small_vector&& arg) noexcept
+        {
+            steal(std::move(arg));
+        }
+
+        small_vector& operator=(small_vector&& arg) noexcept
+        {
+            if(this == &arg)
+                return *this;
+
+            destroy();
+            steal(std::move(arg));
+            return *this;
+        }
+
+        small_vector(const small_vector&) = delete;
+        small_vector& operator=(const small_vector&) = delete;
+
+        ~small_vector()
+        {
+            destroy();
+        }
+
+        T*       begin() { return ptr_; }
+        T*       end() { return ptr_ + size_; }
+        const T* begin() const { return ptr_; }
+        const T* end() const { return ptr_ + size_; }
+        T*       data() { return ptr_; }
+        const T* data() const { return ptr_; }
+
+        T&       operator[](size_t idx) { return ptr_[idx]; }
+        const T& operator[](size_t idx) const { return ptr_[idx]; }
+        T&       back() { return ptr_[size_ - 1]; }
+        const T& back() const { return ptr_[size_ - 1]; }
+
+        size_t size() const { return size_; }
+        size_t capacity() const { return capacity_; }
+        bool   empty() const { return !size_; }
+
+        void clear()
+        {
+            for(size_t i = 0; i < size_; ++i)
+                ptr_[i].~T();
+            size_ = 0;
+        }
+
+        void reserve(size_t count)
+        {
+            if(count <= capacity_)
+                return;
+
+            auto capacity = capacity_;
+            while(capacity < count)
+                capacity *= 2;
+            auto* ptr = static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t{alignof(T)}));
+            for(size_t i = 0; i < size_; ++i)
+            {
+                new(&ptr[i]) T{std::move(ptr_[i])};
+                ptr_[i].~T();
+            }
+            release();
+            ptr_      = ptr;
+            capacity_ = capacity;
+        }
+
+        void resize(size_t count)
+        {
+            reserve(count);
+            for(auto i = size_; i < count; ++i)
+                new(&ptr_[i]) T{};
+            for(auto i = count; i < size_; ++i)
+                ptr_[i].~T();
+            size_ = count;
+        }
+
+        void push_back(const T& value)
+        {
+            reserve(size_ + 1);
+            new(&ptr_[size_++]) T{value};
+        }
+
+        void push_back(T&& value)
+        {
+            reserve(size_ + 1);
+            new(&ptr_[size_++]) T{std::move(value)};
+        }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            reserve(size_ + 1);
+            return *new(&ptr_[size_++]) T{std::forward<Args>(args)...};
+        }
+
+        void pop_back()
+        {
+            ptr_[--size_].~T();
+        }
+
+      private:
+        bool inlined() const
+        {
+            return ptr_ == reinterpret_cast<const T*>(&storage_);
+        }
+
+        void release()
+        {
+            if(!inlined())
+                ::operator delete(ptr_, std::align_val_t{alignof(T)});
+        }
+
+        void destroy()
+        {
+            clear();
+            release();
+            ptr_      = reinterpret_cast<T*>(&storage_);
+            capacity_ = N;
+        }
+
+        void steal(small_vector&& arg)
+        {
+            if(arg.inlined())
+            {
+                for(size_t i = 0; i < arg.size_; ++i)
+                    new(&ptr_[i]) T{std::move(arg.ptr_[i])};
+                size_ = arg.size_;
+                arg.clear();
+                return;
+            }
+
+            // take over the heap block, the donor falls back inline
+            ptr_          = arg.ptr_;
+            size_         = arg.size_;
+            capacity_     = arg.capacity_;
+            arg.ptr_      = reinterpret_cast<T*>(&arg.storage_);
+            arg.size_     = 0;
+            arg.capacity_ = N;
+        }
+
+        typename std::aligned_storage<sizeof(T) * N, alignof(T)>::type storage_;
+
+        T*     ptr_      = reinterpret_cast<T*>(&storage_);
+        size_t size_     = 0;
+        size_t capacity_ = N;
+    };
+} // namespace utils
@@ -1,20 +1,146 @@
 #include "utf8.hpp"
 
 #include <codecvt>
+#include <cstdint>
+#include <cstring>
 #include <locale>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#    define UTF8_SSE2
+#    include <emmintrin.h>
+#elif defined(__aarch64__)
+#    define UTF8_NEON
+#    include <arm_neon.h>
+#endif
+
 #define U16_STRING_TYPE char16_t
 #ifdef _MSC_VER
 #    undef U16_STRING_TYPE
 #    define U16_STRING_TYPE uint16_t // NOTE we have to use uint16_t or suffer incompatibilities with msvc 2017
 #endif
 
+namespace
+{
+    // emit one code point, writing only while it fits; invalid guest
+    // data maps to U+FFFD instead of aborting the conversion
+    size_t emit(uint32_t cp, char* dst, size_t dst_size, size_t idx)
+    {
+        if(cp < 0x80)
+        {
+            if(idx < dst_size)
+                dst[idx] = static_cast<char>(cp);
+            return idx + 1;
+        }
+        if(cp < 0x800)
+        {
+            if(idx + 2 <= dst_size)
+            {
+                dst[idx]     = static_cast<char>(0xC0 | (cp >> 6));
+                dst[idx + 1] = static_cast<char>(0x80 | (cp & 0x3F));
+            }
+            return idx + 2;
+        }
+        if(cp < 0x10000)
+        {
+            if(idx + 3 <= dst_size)
+            {
+                dst[idx]     = static_cast<char>(0xE0 | (cp >> 12));
+                dst[idx + 1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                dst[idx + 2] = static_cast<char>(0x80 | (cp & 0x3F));
+            }
+            return idx + 3;
+        }
+        if(idx + 4 <= dst_size)
+        {
+            dst[idx]     = static_cast<char>(0xF0 | (cp >> 18));
+            dst[idx + 1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            dst[idx + 2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            dst[idx + 3] = static_cast<char>(0x80 | (cp & 0x3F));
+        }
+        return idx + 4;
+    }
+
+    // copy as many all-ascii units as the vector width allows; nearly
+    // every module path & process name takes only this path
+    size_t ascii_fast_path(const uint16_t* src, size_t count, char* dst, size_t dst_size)
+    {
+        size_t i = 0;
+#if defined(UTF8_SSE2)
+        const auto limit = _mm_set1_epi16(0x7F);
+        while(i + 16 <= count && i + 16 <= dst_size)
+        {
+            const auto lo  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+            const auto hi  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i + 8]));
+            const auto cmp = _mm_or_si128(_mm_cmpgt_epi16(lo, limit), _mm_cmpgt_epi16(hi, limit));
+            const auto neg = _mm_or_si128(lo, hi); // negative means >= 0x8000
+            if(_mm_movemask_epi8(_mm_or_si128(cmp, neg)) & 0xAAAA)
+                break;
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[i]), _mm_packus_epi16(lo, hi));
+            i += 16;
+        }
+#elif defined(UTF8_NEON)
+        while(i + 8 <= count && i + 8 <= dst_size)
+        {
+            const auto units = vld1q_u16(&src[i]);
+            if(vmaxvq_u16(units) > 0x7F)
+                break;
+
+            vst1_u8(reinterpret_cast<uint8_t*>(&dst[i]), vmovn_u16(units));
+            i += 8;
+        }
+#endif
+        while(i < count && i < dst_size && src[i] < 0x80)
+        {
+            dst[i] = static_cast<char>(src[i]);
+            ++i;
+        }
+        return i;
+    }
+}
+
+size_t utf8::from_utf16(const void* vptr, const void* vend, char* dst, size_t dst_size)
+{
+    const auto* src   = reinterpret_cast<const uint16_t*>(vptr);
+    const auto  count = static_cast<size_t>(reinterpret_cast<const uint16_t*>(vend) - src);
+    auto        i     = ascii_fast_path(src, count, dst, dst_size);
+    auto        idx   = i;
+    while(i < count)
+    {
+        const auto unit = src[i++];
+        if(unit < 0x80)
+        {
+            idx = emit(unit, dst, dst_size, idx);
+            continue;
+        }
+        if(unit < 0xD800 || unit >= 0xE000)
+        {
+            idx = emit(unit, dst, dst_size, idx);
+            continue;
+        }
+        // surrogate pair, unpaired halves degrade to U+FFFD
+        if(unit >= 0xDC00 || i >= count || src[i] < 0xDC00 || src[i] >= 0xE000)
+        {
+            idx = emit(0xFFFD, dst, dst_size, idx);
+            continue;
+        }
+        const auto low = src[i++];
+        idx            = emit(0x10000 + ((uint32_t{unit} - 0xD800) << 10) + (low - 0xDC00), dst, dst_size, idx);
+    }
+    return idx;
+}
+
 std::string utf8::from_utf16(const void* vptr, const void* vend)
 {
-    std::wstring_convert<std::codecvt_utf8_utf16<U16_STRING_TYPE, 0x10ffff, std::codecvt_mode::little_endian>, U16_STRING_TYPE> convert;
-    const auto ptr = reinterpret_cast<const U16_STRING_TYPE*>(vptr);
-    const auto end = reinterpret_cast<const U16_STRING_TYPE*>(vend);
-    return convert.to_bytes(ptr, end);
+    // short names convert once into the stack & land in the string sso
+    char buffer[256];
+    const auto size = from_utf16(vptr, vend, buffer, sizeof buffer);
+    if(size <= sizeof buffer)
+        return std::string{buffer, size};
+
+    auto ret = std::string(size, 0);
+    from_utf16(vptr, vend, &ret[0], ret.size());
+    return ret;
 }
 
 std::wstring utf8::to_utf16(std::string_view src)
@@ -5,5 +5,10 @@
 namespace utf8
 {
     std::string     from_utf16  (const void* ptr, const void* end);
+    // convert into a caller-provided buffer, vectorized on the ascii
+    // fast path; bytes are written while they fit & the full required
+    // size is returned, so a result larger than dst_size means the
+    // output was truncated
+    size_t          from_utf16  (const void* ptr, const void* end, char* dst, size_t dst_size);
     std::wstring    to_utf16    (std::string_view src);
 } // namespace utf8
@@ -13,6 +13,8 @@ namespace vm_area
 
     bool                list    (core::Core&, proc_t proc, on_vm_area_fn on_vm_area);
     opt<vm_area_t>      find    (core::Core&, proc_t proc, uint64_t addr);
+    // drop any locally cached view of the process address space
+    void                refresh (core::Core&, proc_t proc);
     opt<span_t>         span    (core::Core&, proc_t proc, vm_area_t vm_area);
     vma_access_e        access  (core::Core&, proc_t proc, vm_area_t vm_area);
     vma_type_e          type    (core::Core&, proc_t proc, vm_area_t vm_area);
@@ -1,4 +1,6 @@
+import asyncio
 import binascii
+import mmap
 import os
 import struct
 import types
@@ -58,6 +60,31 @@ flags_x86 = Flags({"is_x86": True,   "is_x64": False})
 flags_x64 = Flags({"is_x86": False,  "is_x64": True})
 
 
+def _dump_to_file(read, path, ptr, size, chunk):
+    # the file is mapped & read into directly, so pages move from the
+    # guest into the page cache without intermediate allocations
+    with open(path, "wb") as fh:
+        fh.truncate(size)
+    with open(path, "r+b") as fh:
+        with mmap.mmap(fh.fileno(), size) as view:
+            buf = memoryview(view)
+            try:
+                for off in range(0, size, chunk):
+                    n = min(chunk, size - off)
+                    try:
+                        read(buf[off:off + n], ptr + off)
+                    except RuntimeError:
+                        # retry page by page, unreadable pages stay zeroed
+                        for page in range(off, off + n, 0x1000):
+                            m = min(0x1000, size - page)
+                            try:
+                                read(buf[page:page + m], ptr + page)
+                            except RuntimeError:
+                                pass
+            finally:
+                buf.release()
+
+
 def dump_bytes(buf):
     """Dump bytes from input buffer."""
     if len(buf) == 1:
@@ -97,6 +124,55 @@ class BreakpointId:
         del self.callback
 
 
+class StrucAccessor:
+    """Precompiled struct reader.
+
+    Member offsets & sizes are resolved once at construction; read()
+    decodes every selected field from a single guest read over the
+    covering span instead of one lookup & one small read per field.
+    """
+
+    _formats = {1: "<B", 2: "<H", 4: "<I", 8: "<Q"}
+
+    def __init__(self, py_proc, name, members):
+        struc = py_proc.symbols.struc(name)
+        if not struc:
+            raise RuntimeError("unknown struc %s" % name)
+
+        by_name = {m.name: m for m in struc.members}
+        self.name = name
+        self.memory = py_proc.memory
+        self.fields = []
+        begin, end = None, 0
+        for want in members if members else [m.name for m in struc.members]:
+            m = by_name.get(want)
+            if m is None:
+                raise KeyError("unknown member %s in %s" % (want, name))
+
+            size = m.bits >> 3
+            if not size:
+                continue
+
+            self.fields.append((want, m.offset, size, self._formats.get(size)))
+            begin = m.offset if begin is None else min(begin, m.offset)
+            end = max(end, m.offset + size)
+        self.begin = begin if begin is not None else 0
+        self.end = end
+
+    def read(self, ptr):
+        """Return a dict of all fields decoded from one bulk read at ptr."""
+        buf = bytearray(self.end - self.begin)
+        self.memory.read(buf, ptr + self.begin)
+        ret = {}
+        for name, offset, size, fmt in self.fields:
+            at = offset - self.begin
+            if fmt:
+                ret[name] = struct.unpack_from(fmt, buf, at)[0]
+            else:
+                ret[name] = bytes(buf[at: at + size])
+        return ret
+
+
 class Symbols:
     def __init__(self, py_proc):
         self.py_proc = py_proc
@@ -111,6 +187,17 @@ class Symbols:
         """List all structure names from process module name."""
         return _icebox.symbols_list_strucs(self.proc, module)
 
+    def member_offset(self, name):
+        """Read memoized member offset from "module!struc.member" name."""
+        module, member_name = name.split("!")
+        struc_name, member_name = member_name.split(".")
+        return _icebox.symbols_member_offset(self.proc, module, struc_name, member_name)
+
+    def struc_size(self, name):
+        """Read memoized structure size from "module!struc" name."""
+        module, struc_name = name.split("!")
+        return _icebox.symbols_struc_size(self.proc, module, struc_name)
+
     def struc(self, name):
         """Read structure type from name."""
         module, struc_name = name.split("!")
@@ -131,6 +218,13 @@ class Symbols:
         setattr(struc, "members", members)
         return struc
 
+    def accessor(self, name, *members):
+        """Return a precompiled accessor decoding members in one bulk read.
+
+        Without members, every fixed-size member of the struct is kept.
+        """
+        return StrucAccessor(self.py_proc, name, members)
+
     def string(self, ptr):
         """Convert process virtual memory address to symbol string."""
         return _icebox.symbols_string(self.proc, ptr)
@@ -184,13 +278,26 @@ class Virtual:
         return buf[0]
 
     def read(self, buf, ptr):
-        """Read buffer from virtual memory."""
+        """Read virtual memory into any writable buffer-protocol object."""
         return _icebox.memory_read_virtual(buf, self.proc, ptr)
 
+    def dump(self, path, ptr, size, chunk=0x100000):
+        """Dump a virtual memory range into a mmap-backed file."""
+        return _dump_to_file(self.read, path, ptr, size, chunk)
+
     def physical_address(self, ptr):
         """Convert virtual memory address to physical address."""
         return _icebox.memory_virtual_to_physical(self.proc, ptr)
 
+    def prefetch(self):
+        """Stream the resident working set into the host cache.
+
+        Returns the number of pages fetched. An explicit warm-up before
+        a trace session so first events hit warm caches instead of
+        faulting page by page.
+        """
+        return _icebox.memory_prefetch(self.proc)
+
     def __setitem__(self, key, item):
         if isinstance(key, slice):
             return self.write(key.start, item)
@@ -236,6 +343,11 @@ class Modules:
         for x in _icebox.modules_list(self.proc):
             yield Module(self.proc, x)
 
+    def list_full(self):
+        """Return list of (Module, name, addr, size) tuples in one call."""
+        return [(Module(self.proc, mod), name, addr, size)
+                for mod, name, addr, size in _icebox.modules_list_full(self.proc)]
+
     def find(self, addr):
         """Find module by address."""
         mod = _icebox.modules_find(self.proc, addr)
@@ -263,6 +375,17 @@ class Callstack:
         for x in _icebox.callstacks_read(self.proc, 256):
             yield x
 
+    def symbols(self, depth=256):
+        """Return whole symbolized callstack as one tuple of strings."""
+        return _icebox.callstacks_read_symbols(self.proc, depth)
+
+    def id(self, depth=256):
+        """Return an opaque interned id identifying the current callstack.
+
+        Identical stacks share one id, cheap to aggregate per event.
+        """
+        return _icebox.callstacks_read_id(self.proc, depth)
+
     def load_module(self, mod):
         """Load unwind data from module."""
         return _icebox.callstacks_load_module(self.proc, mod.mod)
@@ -336,6 +459,14 @@ class Process:
         """Join process in user mode."""
         return _icebox.process_join(self.proc, "user")
 
+    def join_kernel_deferred(self):
+        """Join process in kernel mode, loading symbols in the background."""
+        return _icebox.process_join_deferred(self.proc, "kernel")
+
+    def join_user_deferred(self):
+        """Join process in user mode, loading symbols in the background."""
+        return _icebox.process_join_deferred(self.proc, "user")
+
     def parent(self):
         """Return parent process."""
         ret = _icebox.process_parent(self.proc)
@@ -356,15 +487,19 @@ class Processes:
         for x in _icebox.process_list():
             yield Process(x)
 
+    def list_full(self):
+        """Return list of (Process, pid, name) tuples in one call."""
+        return [(Process(proc), pid, name)
+                for proc, pid, name in _icebox.process_list_full()]
+
     def current(self):
         """Return current active process."""
         return Process(_icebox.process_current())
 
     def find_name(self, name, flags=flags_any):
         """Find process by name."""
-        for p in self():
-            got_name = os.path.basename(p.name())
-            if got_name != name:
+        for p, _, got_name in self.list_full():
+            if os.path.basename(got_name) != name:
                 continue
 
             got_flags = p.flags()
@@ -379,8 +514,8 @@ class Processes:
 
     def find_pid(self, pid):
         """Find process by PID."""
-        for p in self():
-            if p.pid() == pid:
+        for p, got_pid, _ in self.list_full():
+            if got_pid == pid:
                 return p
         return None
 
@@ -459,9 +594,17 @@ class Physical:
         return buf[0]
 
     def read(self, buf, ptr):
-        """Read physical memory to buffer."""
+        """Read physical memory into any writable buffer-protocol object."""
         return _icebox.memory_read_physical(buf, ptr)
 
+    def sample(self, buf, ptr):
+        """Read physical memory without pausing the guest, values may tear."""
+        return _icebox.memory_sample_physical(buf, ptr)
+
+    def dump(self, path, ptr, size, chunk=0x100000):
+        """Dump a physical memory range into a mmap-backed file."""
+        return _dump_to_file(self.read, path, ptr, size, chunk)
+
     def __setitem__(self, key, item):
         if isinstance(key, slice):
             return self.write(key.start, item)
@@ -516,6 +659,40 @@ class Functions:
         return _icebox.functions_break_on_return(name, callback)
 
 
+class Stats:
+    def counters(self):
+        """Return dict of subsystem counters: channel calls, breakpoint
+        hits & cache hit/miss counts."""
+        return _icebox.stats_counters()
+
+    def observers(self):
+        """Return per-observer statistics as a list of dicts."""
+        return _icebox.stats_observers()
+
+    def channels(self):
+        """Return per-module channel round-trip & byte counters."""
+        return _icebox.stats_channels()
+
+    def reset(self):
+        """Reset all counters & observer statistics."""
+        _icebox.stats_reset()
+
+
+class Tracer:
+    def enable_store(self, enable=True):
+        """Enable or disable the in-memory trace event store."""
+        return _icebox.tracer_enable_store(enable)
+
+    def query_store(self, name="", begin=0, end=2**64 - 1):
+        """List (time, guest_tsc, proc, thread, name) trace events matching name in [begin, end]."""
+        return _icebox.tracer_query_store(name, begin, end)
+
+    def clock_calibration(self):
+        """Return guest-tsc/host-clock calibration as a dict, or None
+        before the first stamped event."""
+        return _icebox.tracer_clock_calibration()
+
+
 class Driver:
     def __init__(self, drv):
         self.drv = drv
@@ -605,6 +782,8 @@ class Vm:
         self.processes = Processes()
         self.physical = Physical()
         self.functions = Functions()
+        self.tracer = Tracer()
+        self.stats = Stats()
         self.drivers = Drivers()
         self.symbols = KernelSymbols()
 
@@ -632,6 +811,14 @@ class Vm:
         """Wait for vm to break."""
         _icebox.wait()
 
+    def poll(self, timeout_ms=0):
+        """Drain pending events & run callbacks, never blocking past timeout_ms."""
+        return _icebox.poll(timeout_ms)
+
+    def attach_asyncio(self, loop=None):
+        """Return an AsyncVm dispatching this vm's events on an asyncio loop."""
+        return AsyncVm(self, loop)
+
     def exec(self):
         """Execute vm once until next break."""
         self.resume()
@@ -657,6 +844,18 @@ class Vm:
         bp = _icebox.break_on(name, where, callback)
         return BreakpointId(bp, callback)
 
+    def break_on_batch(self, where, callback, count=1024, delay_ns=0, name=""):
+        """Return breakpoint delivering events in batches.
+
+        Events are packed little-endian (time_ns, rip, proc, thread)
+        u64 quadruplets; callback receives one memoryview per batch,
+        flushed when count events accumulated or when an event arrives
+        delay_ns after the first buffered one.
+        """
+        where = self._to_virtual(where, lambda: self.processes.current())
+        bp = _icebox.break_on_batch(name, where, count, delay_ns, callback)
+        return BreakpointId(bp, callback)
+
     def break_on_process(self, proc, where, callback, name=""):
         """Return breakpoint on virtual address filtered by process."""
         where = self._to_virtual(where, lambda: proc)
@@ -682,6 +881,58 @@ class Vm:
         return BreakpointId(bp, callback)
 
 
+class AsyncVm:
+    """Dispatch guest events on an asyncio loop.
+
+    The server wait fd is registered with loop.add_reader when
+    available, otherwise a polling task drains events; either way
+    breakpoint callbacks run on the loop thread and breakpoints can
+    be awaited without one blocking thread per guest.
+    """
+
+    def __init__(self, vm, loop=None):
+        self.vm = vm
+        self.loop = loop if loop else asyncio.get_event_loop()
+        self.fd = _icebox.wait_fd()
+        self.task = None
+        if self.fd >= 0:
+            self.loop.add_reader(self.fd, _icebox.poll, 0)
+        else:
+            self.task = self.loop.create_task(self._poll_forever())
+
+    def detach(self):
+        """Stop dispatching events on the loop."""
+        if self.fd >= 0:
+            self.loop.remove_reader(self.fd)
+            self.fd = -1
+        elif self.task:
+            self.task.cancel()
+            self.task = None
+
+    async def _poll_forever(self):
+        while True:
+            _icebox.poll(0)
+            await asyncio.sleep(0.001)
+
+    async def wait_break(self, where, name=""):
+        """Resume the guest & await one hit of a breakpoint at where.
+
+        The guest is left paused on the breakpoint, like Vm.exec.
+        """
+        future = self.loop.create_future()
+
+        def on_hit():
+            if not future.done():
+                future.set_result(None)
+
+        bp = self.vm.break_on(where, on_hit, name)
+        self.vm.resume()
+        try:
+            await future
+        finally:
+            del bp
+
+
 def attach(name):
     """Attach to live VM by name."""
     return Vm(name)
@@ -121,6 +121,7 @@ namespace
         Py_INCREF(py_func); // FIXME leak ?
         logg::redirect([=](logg::level_t level, const char* fmt)
         {
+            const auto gil  = py::gil_lock{};
             const auto args = Py_BuildValue("(Ks)", (uint64_t) level, fmt);
             if(!args)
                 return;
@@ -169,11 +170,14 @@ namespace
         {"resume", &core_exec<&py::state::resume>, METH_NOARGS, "resume vm"},
         {"single_step", &core_exec<&py::state::single_step>, METH_NOARGS, "execute a single instruction"},
         {"wait", &core_exec<&py::state::wait>, METH_NOARGS, "wait vm"},
+        {"poll", &core_exec<&py::state::poll>, METH_VARARGS, "drain pending vm events, never blocking past timeout"},
+        {"wait_fd", &core_exec<&py::state::wait_fd>, METH_NOARGS, "selectable fd signaled while vm events are pending"},
         {"break_on", &core_exec<&py::state::break_on>, METH_VARARGS, "break on virtual address"},
         {"break_on_process", &core_exec<&py::state::break_on_process>, METH_VARARGS, "break process on address"},
         {"break_on_thread", &core_exec<&py::state::break_on_thread>, METH_VARARGS, "break thread on address"},
         {"break_on_physical", &core_exec<&py::state::break_on_physical>, METH_VARARGS, "break on physical address"},
         {"break_on_physical_process", &core_exec<&py::state::break_on_physical_process>, METH_VARARGS, "break process on physical address"},
+        {"break_on_batch", &core_exec<&py::state::break_on_batch>, METH_VARARGS, "break on virtual address with batched event delivery"},
         {"drop_breakpoint", &core_exec<&py::state::drop_breakpoint>, METH_VARARGS, "drop breakpoint"},
         // registers
         {"msr_list", &core_exec<&py::registers::msr_list>, METH_NOARGS, "list available msr registers"},
@@ -188,6 +192,8 @@ namespace
         {"memory_read_virtual", &core_exec<&py::memory::read_virtual>, METH_VARARGS, "read virtual memory"},
         {"memory_read_virtual_with_dtb", &core_exec<&py::memory::read_virtual_with_dtb>, METH_VARARGS, "read virtual memory with dtb"},
         {"memory_read_physical", &core_exec<&py::memory::read_physical>, METH_VARARGS, "read physical memory"},
+        {"memory_sample_physical", &core_exec<&py::memory::sample_physical>, METH_VARARGS, "read physical memory without pausing the guest"},
+        {"memory_prefetch", &core_exec<&py::memory::prefetch>, METH_VARARGS, "stream the process working set into the host cache"},
         {"memory_write_virtual", &core_exec<&py::memory::write_virtual>, METH_VARARGS, "write virtual memory"},
         {"memory_write_virtual_with_dtb", &core_exec<&py::memory::write_virtual_with_dtb>, METH_VARARGS, "write virtual memory with dtb"},
         {"memory_write_physical", &core_exec<&py::memory::write_physical>, METH_VARARGS, "write physical memory"},
@@ -196,7 +202,9 @@ namespace
         {"process_flags", &core_exec<&py::process::flags>, METH_VARARGS, "read process flags"},
         {"process_is_valid", &core_exec<&py::process::is_valid>, METH_VARARGS, "check if process is valid"},
         {"process_join", &core_exec<&py::process::join>, METH_VARARGS, "join process"},
+        {"process_join_deferred", &core_exec<&py::process::join_deferred>, METH_VARARGS, "join process, loading symbols in the background"},
         {"process_list", &core_exec<&py::process::list>, METH_NOARGS, "list available processes"},
+        {"process_list_full", &core_exec<&py::process::list_full>, METH_NOARGS, "list available processes with pid & name"},
         {"process_listen_create", &core_exec<&py::process::listen_create>, METH_VARARGS, "listen on process creation"},
         {"process_listen_delete", &core_exec<&py::process::listen_delete>, METH_VARARGS, "listen on process deletion"},
         {"process_name", &core_exec<&py::process::name>, METH_VARARGS, "read process name"},
@@ -213,6 +221,7 @@ namespace
         {"thread_listen_delete", &core_exec<&py::threads::listen_delete>, METH_VARARGS, "listen on thread deletion"},
         // modules
         {"modules_list", &core_exec<&py::modules::list>, METH_VARARGS, "list process modules"},
+        {"modules_list_full", &core_exec<&py::modules::list_full>, METH_VARARGS, "list process modules with name & span"},
         {"modules_name", &core_exec<&py::modules::name>, METH_VARARGS, "read module name"},
         {"modules_span", &core_exec<&py::modules::span>, METH_VARARGS, "read module span"},
         {"modules_flags", &core_exec<&py::modules::flags>, METH_VARARGS, "read module flags"},
@@ -236,6 +245,8 @@ namespace
         {"symbols_address", &core_exec<&py::symbols::address>, METH_VARARGS, "read symbols address"},
         {"symbols_list_strucs", &core_exec<&py::symbols::list_strucs>, METH_VARARGS, "list structs"},
         {"symbols_read_struc", &core_exec<&py::symbols::read_struc>, METH_VARARGS, "read struc"},
+        {"symbols_member_offset", &core_exec<&py::symbols::member_offset>, METH_VARARGS, "read memoized struc member offset"},
+        {"symbols_struc_size", &core_exec<&py::symbols::struc_size>, METH_VARARGS, "read memoized struc size"},
         {"symbols_string", &core_exec<&py::symbols::string>, METH_VARARGS, "convert address to symbol string"},
         // functions
         {"functions_read_stack", &core_exec<&py::functions::read_stack>, METH_VARARGS, "read stack value"},
@@ -244,9 +255,19 @@ namespace
         {"functions_break_on_return", &core_exec<&py::functions::break_on_return>, METH_VARARGS, "break on function return"},
         // callstacks
         {"callstacks_read", &core_exec<&py::callstacks::read>, METH_VARARGS, "read callstack"},
+        {"callstacks_read_symbols", &core_exec<&py::callstacks::read_symbols>, METH_VARARGS, "read symbolized callstack in one call"},
+        {"callstacks_read_id", &core_exec<&py::callstacks::read_id>, METH_VARARGS, "read interned callstack id"},
         {"callstacks_load_module", &core_exec<&py::callstacks::load_module>, METH_VARARGS, "load module unwind data"},
         {"callstacks_load_driver", &core_exec<&py::callstacks::load_driver>, METH_VARARGS, "load driver unwind data"},
         {"callstacks_autoload_modules", &core_exec<&py::callstacks::autoload_modules>, METH_VARARGS, "autoload process module unwind data"},
+        // tracer
+        {"stats_channels", &core_exec<&py::stats::channels>, METH_NOARGS, "read per-module channel counters"},
+        {"stats_counters", &core_exec<&py::stats::counters>, METH_NOARGS, "read subsystem counters"},
+        {"stats_observers", &core_exec<&py::stats::observers>, METH_NOARGS, "read per-observer statistics"},
+        {"stats_reset", &core_exec<&py::stats::reset>, METH_NOARGS, "reset all statistics"},
+        {"tracer_enable_store", &core_exec<&py::tracer::enable_store>, METH_VARARGS, "enable trace event store"},
+        {"tracer_query_store", &core_exec<&py::tracer::query_store>, METH_VARARGS, "query trace event store"},
+        {"tracer_clock_calibration", &core_exec<&py::tracer::clock_calibration>, METH_NOARGS, "read guest-tsc/host-clock calibration"},
         // vm_area
         {"vm_area_list", &core_exec<&py::vm_area::list>, METH_VARARGS, "list process vm areas"},
         {"vm_area_span", &core_exec<&py::vm_area::span>, METH_VARARGS, "read vm area span"},
@@ -18,11 +18,14 @@ namespace py
         PyObject*   resume                      (core::Core& core, PyObject* args);
         PyObject*   single_step                 (core::Core& core, PyObject* args);
         PyObject*   wait                        (core::Core& core, PyObject* args);
+        PyObject*   poll                        (core::Core& core, PyObject* args);
+        PyObject*   wait_fd                     (core::Core& core, PyObject* args);
         PyObject*   break_on                    (core::Core& core, PyObject* args);
         PyObject*   break_on_process            (core::Core& core, PyObject* args);
         PyObject*   break_on_thread             (core::Core& core, PyObject* args);
         PyObject*   break_on_physical           (core::Core& core, PyObject* args);
         PyObject*   break_on_physical_process   (core::Core& core, PyObject* args);
+        PyObject*   break_on_batch              (core::Core& core, PyObject* args);
         PyObject*   drop_breakpoint             (core::Core& core, PyObject* args);
     } // namespace state
 
@@ -43,6 +46,8 @@ namespace py
         PyObject*   read_virtual                (core::Core& core, PyObject* args);
         PyObject*   read_virtual_with_dtb       (core::Core& core, PyObject* args);
         PyObject*   read_physical               (core::Core& core, PyObject* args);
+        PyObject*   sample_physical             (core::Core& core, PyObject* args);
+        PyObject*   prefetch                    (core::Core& core, PyObject* args);
         PyObject*   write_virtual               (core::Core& core, PyObject* args);
         PyObject*   write_virtual_with_dtb      (core::Core& core, PyObject* args);
         PyObject*   write_physical              (core::Core& core, PyObject* args);
@@ -56,8 +61,10 @@ namespace py
         PyObject*   pid             (core::Core& core, PyObject* args);
         PyObject*   flags           (core::Core& core, PyObject* args);
         PyObject*   join            (core::Core& core, PyObject* args);
+        PyObject*   join_deferred   (core::Core& core, PyObject* args);
         PyObject*   parent          (core::Core& core, PyObject* args);
         PyObject*   list            (core::Core& core, PyObject* args);
+        PyObject*   list_full       (core::Core& core, PyObject* args);
         PyObject*   wait            (core::Core& core, PyObject* args);
         PyObject*   listen_create   (core::Core& core, PyObject* args);
         PyObject*   listen_delete   (core::Core& core, PyObject* args);
@@ -77,6 +84,7 @@ namespace py
     namespace modules
     {
         PyObject*   list            (core::Core& core, PyObject* args);
+        PyObject*   list_full       (core::Core& core, PyObject* args);
         PyObject*   name            (core::Core& core, PyObject* args);
         PyObject*   span            (core::Core& core, PyObject* args);
         PyObject*   flags           (core::Core& core, PyObject* args);
@@ -106,6 +114,8 @@ namespace py
         PyObject*   address             (core::Core& core, PyObject* args);
         PyObject*   list_strucs         (core::Core& core, PyObject* args);
         PyObject*   read_struc          (core::Core& core, PyObject* args);
+        PyObject*   member_offset       (core::Core& core, PyObject* args);
+        PyObject*   struc_size          (core::Core& core, PyObject* args);
         PyObject*   string              (core::Core& core, PyObject* args);
     } // namespace symbols
 
@@ -120,11 +130,28 @@ namespace py
     namespace callstacks
     {
         PyObject*   read            (core::Core& core, PyObject* args);
+        PyObject*   read_symbols    (core::Core& core, PyObject* args);
+        PyObject*   read_id         (core::Core& core, PyObject* args);
         PyObject*   load_module     (core::Core& core, PyObject* args);
         PyObject*   load_driver     (core::Core& core, PyObject* args);
         PyObject*   autoload_modules(core::Core& core, PyObject* args);
     } // namespace callstacks
 
+    namespace stats
+    {
+        PyObject*   channels    (core::Core& core, PyObject* args);
+        PyObject*   counters    (core::Core& core, PyObject* args);
+        PyObject*   observers   (core::Core& core, PyObject* args);
+        PyObject*   reset       (core::Core& core, PyObject* args);
+    } // namespace stats
+
+    namespace tracer
+    {
+        PyObject*   enable_store       (core::Core& core, PyObject* args);
+        PyObject*   query_store        (core::Core& core, PyObject* args);
+        PyObject*   clock_calibration  (core::Core& core, PyObject* args);
+    } // namespace tracer
+
     namespace vm_area
     {
         PyObject*   list(core::Core&, PyObject* args);
@@ -137,6 +164,39 @@ namespace py
         opt<flags_t>    to  (PyObject* arg);
     } // namespace flags
 
+    // released around blocking core calls so other python threads keep
+    // running while the guest executes; callbacks fired from inside
+    // those calls re-acquire the gil through gil_lock first
+    struct gil_release
+    {
+        gil_release()
+            : state_(PyEval_SaveThread())
+        {
+        }
+
+        ~gil_release()
+        {
+            PyEval_RestoreThread(state_);
+        }
+
+        PyThreadState* state_;
+    };
+
+    struct gil_lock
+    {
+        gil_lock()
+            : state_(PyGILState_Ensure())
+        {
+        }
+
+        ~gil_lock()
+        {
+            PyGILState_Release(state_);
+        }
+
+        PyGILState_STATE state_;
+    };
+
     template <typename T>
     T fail_with(T ret, PyObject* err, const char* msg)
     {
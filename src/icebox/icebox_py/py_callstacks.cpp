@@ -1,5 +1,9 @@
 #include "bindings.hpp"
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 PyObject* py::callstacks::read(core::Core& core, PyObject* args)
 {
     auto py_proc = static_cast<PyObject*>(nullptr);
@@ -35,6 +39,79 @@ PyObject* py::callstacks::read(core::Core& core, PyObject* args)
     return py_list;
 }
 
+PyObject* py::callstacks::read_symbols(core::Core& core, PyObject* args)
+{
+    auto py_proc = static_cast<PyObject*>(nullptr);
+    auto size    = uint64_t{};
+    const auto ok = PyArg_ParseTuple(args, "SK", &py_proc, &size);
+    if(!ok)
+        return nullptr;
+
+    const auto opt_proc = py::from_bytes<proc_t>(py_proc);
+    if(!opt_proc)
+        return nullptr;
+
+    auto names = std::vector<std::string>{};
+    {
+        // capture & symbolize every frame in c++, one crossing per stack
+        const auto gil = py::gil_release{};
+        auto buf       = std::vector<::callstacks::caller_t>(size);
+        const auto n   = ::callstacks::read(core, &buf[0], buf.size(), *opt_proc);
+        auto addrs     = std::vector<uint64_t>(n);
+        for(size_t i = 0; i < n; ++i)
+            addrs[i] = buf[i].addr;
+        names = ::symbols::string_many(core, *opt_proc, addrs.data(), n);
+    }
+    auto py_tuple = PyTuple_New(static_cast<Py_ssize_t>(names.size()));
+    if(!py_tuple)
+        return nullptr;
+
+    for(size_t i = 0; i < names.size(); ++i)
+    {
+        auto item = PyUnicode_FromStringAndSize(names[i].data(), names[i].size());
+        if(!item)
+        {
+            Py_DECREF(py_tuple);
+            return nullptr;
+        }
+
+        PyTuple_SET_ITEM(py_tuple, static_cast<Py_ssize_t>(i), item);
+    }
+    return py_tuple;
+}
+
+PyObject* py::callstacks::read_id(core::Core& core, PyObject* args)
+{
+    // interned stack ids for aggregation: identical stacks share one id,
+    // the gil serializes accesses to the intern table
+    static auto g_ids = std::unordered_map<std::string, uint64_t>{};
+
+    auto py_proc = static_cast<PyObject*>(nullptr);
+    auto size    = uint64_t{};
+    const auto ok = PyArg_ParseTuple(args, "SK", &py_proc, &size);
+    if(!ok)
+        return nullptr;
+
+    const auto opt_proc = py::from_bytes<proc_t>(py_proc);
+    if(!opt_proc)
+        return nullptr;
+
+    auto key = std::string{};
+    {
+        const auto gil = py::gil_release{};
+        auto buf       = std::vector<::callstacks::caller_t>(size);
+        const auto n   = ::callstacks::read(core, &buf[0], buf.size(), *opt_proc);
+        key.assign(reinterpret_cast<const char*>(&buf[0]), n * sizeof buf[0]);
+    }
+    const auto it = g_ids.find(key);
+    if(it != g_ids.end())
+        return PyLong_FromUnsignedLongLong(it->second);
+
+    const auto id = static_cast<uint64_t>(g_ids.size()) + 1;
+    g_ids.emplace(std::move(key), id);
+    return PyLong_FromUnsignedLongLong(id);
+}
+
 PyObject* py::callstacks::load_module(core::Core& core, PyObject* args)
 {
     auto py_proc = static_cast<PyObject*>(nullptr);
@@ -86,6 +86,7 @@ PyObject* py::drivers::listen(core::Core& core, PyObject* args)
 
     const auto opt_bpid = ::drivers::listen_create(core, [=](driver_t drv, bool load)
     {
+        const auto gil    = py::gil_lock{};
         const auto py_drv = py::to_bytes(drv);
         const auto args   = Py_BuildValue("(OO)", py_drv, load ? Py_True : Py_False);
         if(!args)
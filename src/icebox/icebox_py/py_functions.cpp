@@ -58,6 +58,7 @@ PyObject* py::functions::break_on_return(core::Core& core, PyObject* args)
     Py_INCREF(py_func);
     ok = ::functions::break_on_return(core, name, [=]
     {
+        const auto gil  = py::gil_lock{};
         const auto args = Py_BuildValue("()");
         if(!args)
             return;
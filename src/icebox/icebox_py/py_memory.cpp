@@ -75,7 +75,10 @@ PyObject* py::memory::read_virtual(core::Core& core, PyObject* args)
     if(!opt_proc)
         return nullptr;
 
-    ok = ::memory::read_virtual(core, *opt_proc, buf.buf, src, buf.len);
+    {
+        const auto gil = py::gil_release{};
+        ok = ::memory::read_virtual(core, *opt_proc, buf.buf, src, buf.len);
+    }
     if(!ok)
         return py::fail_with(nullptr, PyExc_RuntimeError, "unable to read virtual memory");
 
@@ -95,7 +98,10 @@ PyObject* py::memory::read_virtual_with_dtb(core::Core& core, PyObject* args)
     if(!check_buffer(buf, access_e::need_write))
         return nullptr;
 
-    ok = ::memory::read_virtual_with_dtb(core, dtb_t{dtb}, buf.buf, src, buf.len);
+    {
+        const auto gil = py::gil_release{};
+        ok = ::memory::read_virtual_with_dtb(core, dtb_t{dtb}, buf.buf, src, buf.len);
+    }
     if(!ok)
         return py::fail_with(nullptr, PyExc_RuntimeError, "unable to read virtual memory");
 
@@ -114,13 +120,38 @@ PyObject* py::memory::read_physical(core::Core& core, PyObject* args)
     if(!check_buffer(buf, access_e::need_write))
         return nullptr;
 
-    ok = ::memory::read_physical(core, buf.buf, src, buf.len);
+    {
+        const auto gil = py::gil_release{};
+        ok = ::memory::read_physical(core, buf.buf, src, buf.len);
+    }
     if(!ok)
         return py::fail_with(nullptr, PyExc_RuntimeError, "unable to read physical memory");
 
     Py_RETURN_NONE;
 }
 
+PyObject* py::memory::sample_physical(core::Core& core, PyObject* args)
+{
+    auto buf = Py_buffer{};
+    auto src = uint64_t{};
+    auto ok  = PyArg_ParseTuple(args, "y*K", &buf, &src);
+    if(!ok)
+        return nullptr;
+
+    DEFER([&] { PyBuffer_Release(&buf); });
+    if(!check_buffer(buf, access_e::need_write))
+        return nullptr;
+
+    {
+        const auto gil = py::gil_release{};
+        ok = ::memory::sample_physical(core, buf.buf, src, buf.len);
+    }
+    if(!ok)
+        return py::fail_with(nullptr, PyExc_RuntimeError, "unable to sample physical memory");
+
+    Py_RETURN_NONE;
+}
+
 PyObject* py::memory::write_virtual(core::Core& core, PyObject* args)
 {
     auto buf     = Py_buffer{};
@@ -138,7 +169,10 @@ PyObject* py::memory::write_virtual(core::Core& core, PyObject* args)
     if(!opt_proc)
         return nullptr;
 
-    ok = ::memory::write_virtual(core, *opt_proc, dst, buf.buf, buf.len);
+    {
+        const auto gil = py::gil_release{};
+        ok = ::memory::write_virtual(core, *opt_proc, dst, buf.buf, buf.len);
+    }
     if(!ok)
         return py::fail_with(nullptr, PyExc_RuntimeError, "unable to write virtual memory");
 
@@ -158,7 +192,10 @@ PyObject* py::memory::write_virtual_with_dtb(core::Core& core, PyObject* args)
     if(!check_buffer(buf, access_e::need_read))
         return nullptr;
 
-    ok = ::memory::write_virtual_with_dtb(core, dtb_t{dtb}, dst, buf.buf, buf.len);
+    {
+        const auto gil = py::gil_release{};
+        ok = ::memory::write_virtual_with_dtb(core, dtb_t{dtb}, dst, buf.buf, buf.len);
+    }
     if(!ok)
         return py::fail_with(nullptr, PyExc_RuntimeError, "unable to write virtual memory");
 
@@ -177,9 +214,31 @@ PyObject* py::memory::write_physical(core::Core& core, PyObject* args)
     if(!check_buffer(buf, access_e::need_read))
         return nullptr;
 
-    ok = ::memory::write_physical(core, dst, buf.buf, buf.len);
+    {
+        const auto gil = py::gil_release{};
+        ok = ::memory::write_physical(core, dst, buf.buf, buf.len);
+    }
     if(!ok)
         return py::fail_with(nullptr, PyExc_RuntimeError, "unable to write virtual memory");
 
     Py_RETURN_NONE;
 }
+
+PyObject* py::memory::prefetch(core::Core& core, PyObject* args)
+{
+    auto py_proc  = static_cast<PyObject*>(nullptr);
+    const auto ok = PyArg_ParseTuple(args, "S", &py_proc);
+    if(!ok)
+        return nullptr;
+
+    const auto opt_proc = py::from_bytes<proc_t>(py_proc);
+    if(!opt_proc)
+        return nullptr;
+
+    auto fetched = size_t{};
+    {
+        const auto gil = py::gil_release{};
+        fetched        = ::memory::prefetch(core, *opt_proc);
+    }
+    return PyLong_FromSize_t(fetched);
+}
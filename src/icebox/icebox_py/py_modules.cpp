@@ -1,5 +1,8 @@
 #include "bindings.hpp"
 
+#include <string>
+#include <vector>
+
 PyObject* py::modules::list(core::Core& core, PyObject* args)
 {
     auto py_proc  = static_cast<PyObject*>(nullptr);
@@ -11,24 +14,87 @@ PyObject* py::modules::list(core::Core& core, PyObject* args)
     if(!opt_proc)
         return nullptr;
 
+    auto mods = std::vector<mod_t>{};
+    {
+        // the guest walk never touches python, run it without the gil
+        const auto gil = py::gil_release{};
+        ::modules::list(core, *opt_proc, [&](mod_t mod)
+        {
+            mods.push_back(mod);
+            return walk_e::next;
+        });
+    }
     auto py_list = PyList_New(0);
     if(!py_list)
         return nullptr;
 
     PY_DEFER_DECREF(py_list);
-    ::modules::list(core, *opt_proc, [&](mod_t mod)
+    for(const auto& mod : mods)
     {
         auto item = py::to_bytes(mod);
         if(!item)
-            return walk_e::stop;
+            return nullptr;
 
         PY_DEFER_DECREF(item);
         const auto err = PyList_Append(py_list, item);
         if(err)
-            return walk_e::stop;
+            return nullptr;
+    }
+    Py_INCREF(py_list);
+    return py_list;
+}
 
-        return walk_e::next;
-    });
+PyObject* py::modules::list_full(core::Core& core, PyObject* args)
+{
+    auto py_proc  = static_cast<PyObject*>(nullptr);
+    const auto ok = PyArg_ParseTuple(args, "S", &py_proc);
+    if(!ok)
+        return nullptr;
+
+    const auto opt_proc = py::from_bytes<proc_t>(py_proc);
+    if(!opt_proc)
+        return nullptr;
+
+    struct item_t
+    {
+        mod_t       mod;
+        std::string name;
+        span_t      span;
+    };
+    auto items = std::vector<item_t>{};
+    {
+        // walk & per-module reads are batched in c++, python sees one
+        // list of (mod, name, addr, size) tuples instead of 3n+1 crossings
+        const auto gil = py::gil_release{};
+        ::modules::list(core, *opt_proc, [&](mod_t mod)
+        {
+            const auto opt_name = ::modules::name(core, *opt_proc, mod);
+            const auto opt_span = ::modules::span(core, *opt_proc, mod);
+            items.push_back({mod, opt_name ? *opt_name : std::string{}, opt_span ? *opt_span : span_t{}});
+            return walk_e::next;
+        });
+    }
+    auto py_list = PyList_New(0);
+    if(!py_list)
+        return nullptr;
+
+    PY_DEFER_DECREF(py_list);
+    for(const auto& it : items)
+    {
+        auto py_mod = py::to_bytes(it.mod);
+        if(!py_mod)
+            return nullptr;
+
+        PY_DEFER_DECREF(py_mod);
+        auto item = Py_BuildValue("(Os#KK)", py_mod, it.name.data(), static_cast<Py_ssize_t>(it.name.size()), it.span.addr, it.span.size);
+        if(!item)
+            return nullptr;
+
+        PY_DEFER_DECREF(item);
+        const auto err = PyList_Append(py_list, item);
+        if(err)
+            return nullptr;
+    }
     Py_INCREF(py_list);
     return py_list;
 }
@@ -158,6 +224,7 @@ PyObject* py::modules::listen_create(core::Core& core, PyObject* args)
 
     const auto opt_bpid = ::modules::listen_create(core, *opt_proc, *opt_flags, [=](mod_t mod)
     {
+        const auto gil    = py::gil_lock{};
         const auto py_mod = py::to_bytes(mod);
         const auto args   = Py_BuildValue("(O)", py_mod);
         if(!args)
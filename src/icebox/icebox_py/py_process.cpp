@@ -1,5 +1,8 @@
 #include "bindings.hpp"
 
+#include <string>
+#include <vector>
+
 PyObject* py::process::current(core::Core& core, PyObject* /*args*/)
 {
     const auto opt_proc = ::process::current(core);
@@ -111,7 +114,30 @@ PyObject* py::process::join(core::Core& core, PyObject* args)
         return nullptr;
 
     const auto mode = strmode && strmode == std::string_view{"kernel"} ? mode_e::kernel : mode_e::user;
-    ::process::join(core, *opt_proc, mode);
+    {
+        const auto gil = py::gil_release{};
+        ::process::join(core, *opt_proc, mode);
+    }
+    Py_RETURN_NONE;
+}
+
+PyObject* py::process::join_deferred(core::Core& core, PyObject* args)
+{
+    auto py_proc = static_cast<PyObject*>(nullptr);
+    auto strmode = static_cast<const char*>(nullptr);
+    auto ok      = PyArg_ParseTuple(args, "Ss", &py_proc, &strmode);
+    if(!ok)
+        return nullptr;
+
+    const auto opt_proc = py::from_bytes<proc_t>(py_proc);
+    if(!opt_proc)
+        return nullptr;
+
+    const auto mode = strmode && strmode == std::string_view{"kernel"} ? mode_e::kernel : mode_e::user;
+    {
+        const auto gil = py::gil_release{};
+        ::process::join_deferred(core, *opt_proc, mode);
+    }
     Py_RETURN_NONE;
 }
 
@@ -135,27 +161,86 @@ PyObject* py::process::parent(core::Core& core, PyObject* args)
 
 PyObject* py::process::list(core::Core& core, PyObject* /*args*/)
 {
+    auto procs = std::vector<proc_t>{};
+    auto ok    = false;
+    {
+        // the guest walk never touches python, run it without the gil
+        const auto gil = py::gil_release{};
+        ok             = ::process::list(core, [&](proc_t proc)
+        {
+            procs.push_back(proc);
+            return walk_e::next;
+        });
+    }
+    if(!ok)
+        return py::fail_with(nullptr, PyExc_RuntimeError, "unable to list processes");
+
     auto py_list = PyList_New(0);
     if(!py_list)
         return nullptr;
 
     PY_DEFER_DECREF(py_list);
-    const auto ok = ::process::list(core, [&](proc_t proc)
+    for(const auto& proc : procs)
     {
         auto item = py::to_bytes(proc);
         if(!item)
-            return walk_e::stop;
+            return nullptr;
 
         PY_DEFER_DECREF(item);
         const auto err = PyList_Append(py_list, item);
         if(err)
-            return walk_e::stop;
+            return nullptr;
+    }
+    Py_INCREF(py_list);
+    return py_list;
+}
 
-        return walk_e::next;
-    });
+PyObject* py::process::list_full(core::Core& core, PyObject* /*args*/)
+{
+    struct item_t
+    {
+        proc_t      proc;
+        uint64_t    pid;
+        std::string name;
+    };
+    auto items = std::vector<item_t>{};
+    auto ok    = false;
+    {
+        // walk & per-process reads are batched in c++, python sees one
+        // list of (proc, pid, name) tuples instead of 2n+1 crossings
+        const auto gil = py::gil_release{};
+        ok             = ::process::list(core, [&](proc_t proc)
+        {
+            const auto pid      = ::process::pid(core, proc);
+            const auto opt_name = ::process::name(core, proc);
+            items.push_back({proc, pid, opt_name ? *opt_name : std::string{}});
+            return walk_e::next;
+        });
+    }
     if(!ok)
         return py::fail_with(nullptr, PyExc_RuntimeError, "unable to list processes");
 
+    auto py_list = PyList_New(0);
+    if(!py_list)
+        return nullptr;
+
+    PY_DEFER_DECREF(py_list);
+    for(const auto& it : items)
+    {
+        auto py_proc = py::to_bytes(it.proc);
+        if(!py_proc)
+            return nullptr;
+
+        PY_DEFER_DECREF(py_proc);
+        auto item = Py_BuildValue("(OKs#)", py_proc, it.pid, it.name.data(), static_cast<Py_ssize_t>(it.name.size()));
+        if(!item)
+            return nullptr;
+
+        PY_DEFER_DECREF(item);
+        const auto err = PyList_Append(py_list, item);
+        if(err)
+            return nullptr;
+    }
     Py_INCREF(py_list);
     return py_list;
 }
@@ -173,7 +258,11 @@ PyObject* py::process::wait(core::Core& core, PyObject* args)
     if(!opt_flags)
         return nullptr;
 
-    const auto opt_proc = ::process::wait(core, name, *opt_flags);
+    auto opt_proc = opt<proc_t>{};
+    {
+        const auto gil = py::gil_release{};
+        opt_proc       = ::process::wait(core, name, *opt_flags);
+    }
     if(!opt_proc)
         return py::fail_with(nullptr, PyExc_RuntimeError, "unable to wait for process");
 
@@ -195,6 +284,7 @@ namespace
 
         const auto opt_bpid = operand(core, [=](proc_t proc)
         {
+            const auto gil     = py::gil_lock{};
             const auto py_proc = py::to_bytes(proc);
             const auto args    = Py_BuildValue("(O)", py_proc);
             if(!args)
@@ -1,5 +1,9 @@
 #include "bindings.hpp"
 
+#include <chrono>
+#include <memory>
+#include <vector>
+
 namespace
 {
     PyObject* none_or_error(bool ok)
@@ -16,25 +20,65 @@ namespace
 
 PyObject* py::state::pause(core::Core& core, PyObject* /*args*/)
 {
-    const auto ok = ::state::pause(core);
+    auto ok = false;
+    {
+        const auto gil = py::gil_release{};
+        ok             = ::state::pause(core);
+    }
     return none_or_error(ok);
 }
 
 PyObject* py::state::resume(core::Core& core, PyObject* /*args*/)
 {
-    const auto ok = ::state::resume(core);
+    auto ok = false;
+    {
+        const auto gil = py::gil_release{};
+        ok             = ::state::resume(core);
+    }
     return none_or_error(ok);
 }
 
 PyObject* py::state::single_step(core::Core& core, PyObject* /*args*/)
 {
-    const auto ok = ::state::single_step(core);
+    auto ok = false;
+    {
+        const auto gil = py::gil_release{};
+        ok             = ::state::single_step(core);
+    }
     return none_or_error(ok);
 }
 
+PyObject* py::state::poll(core::Core& core, PyObject* args)
+{
+    auto timeout_ms = int{};
+    const auto ok   = PyArg_ParseTuple(args, "i", &timeout_ms);
+    if(!ok)
+        return nullptr;
+
+    auto got = false;
+    {
+        const auto gil = py::gil_release{};
+        got            = ::state::poll(core, timeout_ms);
+    }
+    if(!got)
+        Py_RETURN_FALSE;
+
+    Py_RETURN_TRUE;
+}
+
+PyObject* py::state::wait_fd(core::Core& core, PyObject* /*args*/)
+{
+    const auto fd = ::state::wait_fd(core);
+    return PyLong_FromLong(fd);
+}
+
 PyObject* py::state::wait(core::Core& core, PyObject* /*args*/)
 {
-    const auto ok = ::state::wait(core);
+    auto ok = false;
+    {
+        const auto gil = py::gil_release{};
+        ok             = ::state::wait(core);
+    }
     return none_or_error(ok);
 }
 
@@ -65,6 +109,7 @@ PyObject* py::state::break_on(core::Core& core, PyObject* args)
 
     const auto bp = ::state::break_on(core, name, where, [=]
     {
+        const auto gil  = py::gil_lock{};
         const auto args = Py_BuildValue("()");
         if(!args)
             return;
@@ -97,6 +142,7 @@ PyObject* py::state::break_on_process(core::Core& core, PyObject* args)
 
     const auto bp = ::state::break_on_process(core, name, *opt_proc, where, [=]
     {
+        const auto gil  = py::gil_lock{};
         const auto args = Py_BuildValue("()");
         if(!args)
             return;
@@ -129,6 +175,7 @@ PyObject* py::state::break_on_thread(core::Core& core, PyObject* args)
 
     const auto bp = ::state::break_on_thread(core, name, *opt_thread, where, [=]
     {
+        const auto gil  = py::gil_lock{};
         const auto args = Py_BuildValue("()");
         if(!args)
             return;
@@ -156,6 +203,7 @@ PyObject* py::state::break_on_physical(core::Core& core, PyObject* args)
 
     const auto bp = ::state::break_on_physical(core, name, phy_t{where}, [=]
     {
+        const auto gil  = py::gil_lock{};
         const auto args = Py_BuildValue("()");
         if(!args)
             return;
@@ -184,6 +232,7 @@ PyObject* py::state::break_on_physical_process(core::Core& core, PyObject* args)
 
     const auto bp = ::state::break_on_physical_process(core, name, dtb_t{dtb}, phy_t{where}, [=]
     {
+        const auto gil  = py::gil_lock{};
         const auto args = Py_BuildValue("()");
         if(!args)
             return;
@@ -196,6 +245,102 @@ PyObject* py::state::break_on_physical_process(core::Core& core, PyObject* args)
     return from_breakpoint(core, bp);
 }
 
+namespace
+{
+    // fixed-width record so numpy consumers can frombuffer the batch
+    struct batch_event_t
+    {
+        uint64_t time; // steady-clock nanoseconds
+        uint64_t rip;
+        uint64_t proc;
+        uint64_t thread;
+    };
+
+    struct Batch
+    {
+        std::vector<batch_event_t> events;
+        size_t                     capacity;
+        uint64_t                   first_ns;
+        uint64_t                   delay_ns;
+        PyObject*                  py_func;
+    };
+
+    uint64_t now_ns()
+    {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+    }
+
+    void flush_batch(Batch& batch)
+    {
+        if(batch.events.empty())
+            return;
+
+        // one python crossing for the whole batch, delivered as a
+        // memoryview over the packed records so numpy wraps it without
+        // another copy
+        const auto gil  = py::gil_lock{};
+        const auto size = static_cast<Py_ssize_t>(batch.events.size() * sizeof batch.events[0]);
+        auto*      view = PyMemoryView_FromMemory(reinterpret_cast<char*>(&batch.events[0]), size, PyBUF_READ);
+        batch.events.clear();
+        if(!view)
+            return;
+
+        PY_DEFER_DECREF(view);
+        const auto args = Py_BuildValue("(O)", view);
+        if(!args)
+            return;
+
+        PY_DEFER_DECREF(args);
+        const auto ret = PyEval_CallObject(batch.py_func, args);
+        if(ret)
+            PY_DEFER_DECREF(ret);
+    }
+}
+
+PyObject* py::state::break_on_batch(core::Core& core, PyObject* args)
+{
+    auto name     = static_cast<const char*>(nullptr);
+    auto where    = uint64_t{};
+    auto count    = uint64_t{};
+    auto delay    = uint64_t{};
+    auto py_func  = static_cast<PyObject*>(nullptr);
+    const auto ok = PyArg_ParseTuple(args, "sKKKO", &name, &where, &count, &delay, &py_func);
+    if(!ok)
+        return nullptr;
+
+    name = name ? name : "";
+    if(!PyCallable_Check(py_func))
+        return py::fail_with(nullptr, PyExc_TypeError, "arg must be callable");
+
+    Py_INCREF(py_func);
+    auto batch      = std::make_shared<Batch>();
+    batch->capacity = count ? count : 1;
+    batch->first_ns = 0;
+    batch->delay_ns = delay;
+    batch->py_func  = py_func;
+    batch->events.reserve(batch->capacity);
+    auto*      pcore = &core;
+    const auto bp    = ::state::break_on(core, name, where, [=]
+    {
+        // events accumulate without touching python, the gil is only
+        // taken when a full or stale batch is flushed
+        const auto now = now_ns();
+        if(batch->events.empty())
+            batch->first_ns = now;
+
+        const auto rip    = ::registers::read(*pcore, reg_e::rip);
+        const auto proc   = ::process::current(*pcore);
+        const auto thread = ::threads::current(*pcore);
+        batch->events.push_back({now, rip, proc ? proc->id : 0, thread ? thread->id : 0});
+        const auto full  = batch->events.size() >= batch->capacity;
+        const auto stale = batch->delay_ns && now - batch->first_ns >= batch->delay_ns;
+        if(full || stale)
+            flush_batch(*batch);
+    });
+    return from_breakpoint(core, bp);
+}
+
 PyObject* py::state::drop_breakpoint(core::Core& core, PyObject* args)
 {
     auto py_bpid  = static_cast<PyObject*>(nullptr);
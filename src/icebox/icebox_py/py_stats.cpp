@@ -0,0 +1,81 @@
+#include "bindings.hpp"
+
+#include <icebox/counters.hpp>
+
+PyObject* py::stats::channels(core::Core& /*core*/, PyObject* /*args*/)
+{
+    auto py_list = PyList_New(0);
+    if(!py_list)
+        return nullptr;
+
+    PY_DEFER_DECREF(py_list);
+    auto ok = true;
+    ::counters::visit_channels([&](const ::counters::channel_t& chan)
+    {
+        auto item = Py_BuildValue("{s:s,s:K,s:K}",
+                                  "module", chan.name,
+                                  "calls", chan.calls.load(std::memory_order_relaxed),
+                                  "bytes", chan.bytes.load(std::memory_order_relaxed));
+        if(!item)
+        {
+            ok = false;
+            return;
+        }
+
+        PY_DEFER_DECREF(item);
+        const auto err = PyList_Append(py_list, item);
+        if(err)
+            ok = false;
+    });
+    if(!ok)
+        return nullptr;
+
+    Py_INCREF(py_list);
+    return py_list;
+}
+
+PyObject* py::stats::counters(core::Core& /*core*/, PyObject* /*args*/)
+{
+    const auto& c = ::counters::get();
+    return Py_BuildValue("{s:K,s:K,s:K,s:K,s:K,s:K,s:K}",
+                         "fdp_calls", c.fdp_calls.load(std::memory_order_relaxed),
+                         "fdp_bytes", c.fdp_bytes.load(std::memory_order_relaxed),
+                         "breakpoint_hits", c.breakpoint_hits.load(std::memory_order_relaxed),
+                         "page_cache_hits", c.page_cache_hits.load(std::memory_order_relaxed),
+                         "page_cache_misses", c.page_cache_misses.load(std::memory_order_relaxed),
+                         "symbol_cache_hits", c.symbol_cache_hits.load(std::memory_order_relaxed),
+                         "symbol_cache_misses", c.symbol_cache_misses.load(std::memory_order_relaxed));
+}
+
+PyObject* py::stats::observers(core::Core& core, PyObject* /*args*/)
+{
+    auto py_list = PyList_New(0);
+    if(!py_list)
+        return nullptr;
+
+    PY_DEFER_DECREF(py_list);
+    for(const auto& it : ::state::observer_stats(core))
+    {
+        auto item = Py_BuildValue("{s:s,s:K,s:K,s:K}",
+                                  "name", it.name.data(),
+                                  "hits", it.hits,
+                                  "task_ns", it.task_ns,
+                                  "paused_ns", it.paused_ns);
+        if(!item)
+            return nullptr;
+
+        PY_DEFER_DECREF(item);
+        const auto err = PyList_Append(py_list, item);
+        if(err)
+            return nullptr;
+    }
+    Py_INCREF(py_list);
+    return py_list;
+}
+
+PyObject* py::stats::reset(core::Core& core, PyObject* /*args*/)
+{
+    ::counters::reset();
+    ::state::reset_observer_stats(core);
+    Py_RETURN_NONE;
+}
@@ -92,6 +92,52 @@ PyObject* py::symbols::read_struc(core::Core& core, PyObject* args)
                          "members", py_list);
 }
 
+PyObject* py::symbols::member_offset(core::Core& core, PyObject* args)
+{
+    auto py_proc = static_cast<PyObject*>(nullptr);
+    auto module  = static_cast<const char*>(nullptr);
+    auto struc   = static_cast<const char*>(nullptr);
+    auto member  = static_cast<const char*>(nullptr);
+    auto ok      = PyArg_ParseTuple(args, "Ssss", &py_proc, &module, &struc, &member);
+    if(!ok)
+        return nullptr;
+
+    const auto opt_proc = py::from_bytes<proc_t>(py_proc);
+    if(!opt_proc)
+        return nullptr;
+
+    module         = module ? module : "";
+    struc          = struc ? struc : "";
+    member         = member ? member : "";
+    const auto ret = ::symbols::member_offset(core, *opt_proc, module, struc, member);
+    if(!ret)
+        return py::fail_with(nullptr, PyExc_RuntimeError, "unable to read member offset");
+
+    return PyLong_FromUnsignedLongLong(*ret);
+}
+
+PyObject* py::symbols::struc_size(core::Core& core, PyObject* args)
+{
+    auto py_proc = static_cast<PyObject*>(nullptr);
+    auto module  = static_cast<const char*>(nullptr);
+    auto struc   = static_cast<const char*>(nullptr);
+    auto ok      = PyArg_ParseTuple(args, "Sss", &py_proc, &module, &struc);
+    if(!ok)
+        return nullptr;
+
+    const auto opt_proc = py::from_bytes<proc_t>(py_proc);
+    if(!opt_proc)
+        return nullptr;
+
+    module         = module ? module : "";
+    struc          = struc ? struc : "";
+    const auto ret = ::symbols::struc_size(core, *opt_proc, module, struc);
+    if(!ret)
+        return py::fail_with(nullptr, PyExc_RuntimeError, "unable to read struc size");
+
+    return PyLong_FromUnsignedLongLong(*ret);
+}
+
 PyObject* py::symbols::string(core::Core& core, PyObject* args)
 {
     auto py_proc = static_cast<PyObject*>(nullptr);
@@ -119,6 +119,7 @@ namespace
 
         const auto opt_bpid = operand(core, [=](thread_t thread)
         {
+            const auto gil       = py::gil_lock{};
             const auto py_thread = py::to_bytes(thread);
             const auto args      = Py_BuildValue("(O)", py_thread);
             if(!args)
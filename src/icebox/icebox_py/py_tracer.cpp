@@ -0,0 +1,61 @@
+#include "bindings.hpp"
+
+#include <icebox/tracer/tracer.hpp>
+
+PyObject* py::tracer::enable_store(core::Core& /*core*/, PyObject* args)
+{
+    auto enabled  = int{};
+    const auto ok = PyArg_ParseTuple(args, "p", &enabled);
+    if(!ok)
+        return nullptr;
+
+    ::tracer::enable_store(!!enabled);
+    Py_RETURN_NONE;
+}
+
+PyObject* py::tracer::query_store(core::Core& /*core*/, PyObject* args)
+{
+    auto name  = static_cast<const char*>(nullptr);
+    auto begin = uint64_t{};
+    auto end   = uint64_t{};
+    auto ok    = PyArg_ParseTuple(args, "sKK", &name, &begin, &end);
+    if(!ok)
+        return nullptr;
+
+    name         = name ? name : "";
+    auto py_list = PyList_New(0);
+    if(!py_list)
+        return nullptr;
+
+    PY_DEFER_DECREF(py_list);
+    ok = ::tracer::query_store(name, begin, end, [&](const ::tracer::trace_event_t& ev)
+    {
+        auto item = Py_BuildValue("(KKKKs)", ev.time, ev.guest_tsc, ev.proc, ev.thread, ev.name);
+        if(!item)
+            return walk_e::stop;
+
+        PY_DEFER_DECREF(item);
+        const auto err = PyList_Append(py_list, item);
+        if(err)
+            return walk_e::stop;
+
+        return walk_e::next;
+    });
+    if(!ok)
+        return py::fail_with(nullptr, PyExc_RuntimeError, "unable to query trace store");
+
+    Py_INCREF(py_list);
+    return py_list;
+}
+
+PyObject* py::tracer::clock_calibration(core::Core& /*core*/, PyObject* /*args*/)
+{
+    const auto calib = ::tracer::clock_calibration();
+    if(!calib)
+        Py_RETURN_NONE;
+
+    return Py_BuildValue("{s:K,s:K,s:d}",
+                         "host_ns", calib->host_ns,
+                         "guest_tsc", calib->guest_tsc,
+                         "tsc_per_ns", calib->tsc_per_ns);
+}
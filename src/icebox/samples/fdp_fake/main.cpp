@@ -0,0 +1,379 @@
+#define FDP_MODULE "fdp_fake"
+#include <FDP.h>
+#include <icebox/log.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr uint64_t page_size = 0x1000;
+    constexpr uint64_t giga_page = 1ull << 30;
+
+    // synthetic guest served entirely from process memory: every request
+    // costs one channel round trip & a memcpy, so the client stack can be
+    // stressed at millions of ops per second without any hypervisor
+    struct FakeGuest
+    {
+        std::vector<uint8_t>     ram;
+        std::array<uint64_t, 64> regs;
+        std::array<uint64_t, 8>  msrs;
+        std::atomic<uint16_t>    state;
+        std::mutex               mutex;      // guards breakpoints
+        std::array<bool, FDP_MAX_BREAKPOINT> breakpoints;
+    };
+
+    bool read_physical(void* vctx, uint8_t* dst, uint64_t addr, uint32_t size)
+    {
+        auto& guest = *reinterpret_cast<FakeGuest*>(vctx);
+        if(addr + size < addr || addr + size > guest.ram.size())
+            return false;
+
+        memcpy(dst, &guest.ram[addr], size);
+        return true;
+    }
+
+    bool write_physical(void* vctx, uint8_t* src, uint64_t addr, uint32_t size)
+    {
+        auto& guest = *reinterpret_cast<FakeGuest*>(vctx);
+        if(addr + size < addr || addr + size > guest.ram.size())
+            return false;
+
+        memcpy(&guest.ram[addr], src, size);
+        return true;
+    }
+
+    // the fake page tables identity-map the whole ram, so translation is
+    // the identity & virtual accesses reuse the physical path
+    bool read_virtual(void* vctx, uint32_t /*cpu_id*/, uint64_t src, uint32_t size, uint8_t* dst)
+    {
+        return read_physical(vctx, dst, src, size);
+    }
+
+    bool write_virtual(void* vctx, uint32_t /*cpu_id*/, uint8_t* src, uint64_t dst, uint32_t size)
+    {
+        return write_physical(vctx, src, dst, size);
+    }
+
+    bool read_virtual_multiple(void* vctx, uint32_t /*cpu_id*/, const FDP_VIRTUAL_RANGE* ranges, uint32_t count, uint8_t* dst)
+    {
+        auto ok = true;
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            ok &= read_physical(vctx, dst, ranges[i].VirtualAddress, ranges[i].ReadSize);
+            dst += ranges[i].ReadSize;
+        }
+        return ok;
+    }
+
+    bool virtual_to_physical(void* /*vctx*/, uint32_t /*cpu_id*/, uint64_t va, uint64_t* pa)
+    {
+        *pa = va;
+        return true;
+    }
+
+    bool get_state(void* vctx, uint8_t* state)
+    {
+        auto& guest = *reinterpret_cast<FakeGuest*>(vctx);
+        *state      = static_cast<uint8_t>(guest.state.load(std::memory_order_relaxed));
+        return true;
+    }
+
+    bool get_cpu_state(void* vctx, uint32_t /*cpu_id*/, uint8_t* state)
+    {
+        return get_state(vctx, state);
+    }
+
+    bool get_cpu_count(void* /*vctx*/, uint32_t* count)
+    {
+        *count = 1;
+        return true;
+    }
+
+    bool get_memory_size(void* vctx, uint64_t* size)
+    {
+        auto& guest = *reinterpret_cast<FakeGuest*>(vctx);
+        *size       = guest.ram.size();
+        return true;
+    }
+
+    bool read_register(void* vctx, uint32_t /*cpu_id*/, FDP_Register reg, uint64_t* value)
+    {
+        auto& guest = *reinterpret_cast<FakeGuest*>(vctx);
+        if(reg >= guest.regs.size())
+            return false;
+
+        *value = guest.regs[reg];
+        return true;
+    }
+
+    bool write_register(void* vctx, uint32_t /*cpu_id*/, FDP_Register reg, uint64_t value)
+    {
+        auto& guest = *reinterpret_cast<FakeGuest*>(vctx);
+        if(reg >= guest.regs.size())
+            return false;
+
+        guest.regs[reg] = value;
+        return true;
+    }
+
+    size_t msr_slot(uint64_t msr_id)
+    {
+        switch(msr_id)
+        {
+            case 0xC0000082:    return 0; // lstar
+            case 0xC0000100:    return 1; // fs_base
+            case 0xC0000101:    return 2; // gs_base
+            case 0xC0000102:    return 3; // kernel_gs_base
+            case 0x10:          return 4; // tsc
+            default:            return ~size_t{0};
+        }
+    }
+
+    bool read_msr(void* vctx, uint32_t /*cpu_id*/, uint64_t msr_id, uint64_t* value)
+    {
+        auto&      guest = *reinterpret_cast<FakeGuest*>(vctx);
+        const auto slot  = msr_slot(msr_id);
+        *value           = slot < guest.msrs.size() ? guest.msrs[slot] : 0;
+        return true;
+    }
+
+    bool write_msr(void* vctx, uint32_t /*cpu_id*/, uint64_t msr_id, uint64_t value)
+    {
+        auto&      guest = *reinterpret_cast<FakeGuest*>(vctx);
+        const auto slot  = msr_slot(msr_id);
+        if(slot < guest.msrs.size())
+            guest.msrs[slot] = value;
+        return true;
+    }
+
+    bool pause(void* vctx)
+    {
+        auto& guest = *reinterpret_cast<FakeGuest*>(vctx);
+        guest.state.store(FDP_STATE_PAUSED, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool resume(void* vctx)
+    {
+        auto& guest = *reinterpret_cast<FakeGuest*>(vctx);
+        guest.state.store(FDP_STATE_NULL, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool single_step(void* vctx, uint32_t /*cpu_id*/)
+    {
+        // one fake instruction: bump rip so steppers observe progress
+        auto& guest = *reinterpret_cast<FakeGuest*>(vctx);
+        guest.regs[FDP_RIP_REGISTER]++;
+        return true;
+    }
+
+    int set_breakpoint(void* vctx, uint32_t /*cpu_id*/, FDP_BreakpointType /*type*/, int bpid, FDP_Access /*access*/, FDP_AddressType /*ptrtype*/, uint64_t /*ptr*/, uint64_t /*len*/, uint64_t /*cr3*/)
+    {
+        auto&      guest = *reinterpret_cast<FakeGuest*>(vctx);
+        const auto lock  = std::lock_guard{guest.mutex};
+        if(bpid >= 0)
+        {
+            if(bpid >= FDP_MAX_BREAKPOINT || guest.breakpoints[bpid])
+                return -1;
+
+            guest.breakpoints[bpid] = true;
+            return bpid;
+        }
+
+        for(int i = 0; i < FDP_MAX_BREAKPOINT; ++i)
+            if(!guest.breakpoints[i])
+            {
+                guest.breakpoints[i] = true;
+                return i;
+            }
+        return -1;
+    }
+
+    bool unset_breakpoint(void* vctx, int bpid)
+    {
+        auto&      guest = *reinterpret_cast<FakeGuest*>(vctx);
+        const auto lock  = std::lock_guard{guest.mutex};
+        if(bpid < 0 || bpid >= FDP_MAX_BREAKPOINT || !guest.breakpoints[bpid])
+            return false;
+
+        guest.breakpoints[bpid] = false;
+        return true;
+    }
+
+    bool set_breakpoint_filter(void* /*vctx*/, int /*bpid*/, uint64_t /*cr3*/, uint64_t /*thread_addr*/, uint64_t /*thread_value*/)
+    {
+        return true;
+    }
+
+    bool set_breakpoint_one_shot(void* /*vctx*/, int /*bpid*/, bool /*enable*/)
+    {
+        return true;
+    }
+
+    bool set_breakpoint_register_filter(void* /*vctx*/, int /*bpid*/, FDP_Register /*reg*/, const FDP_REGISTER_RANGE* /*ranges*/, uint32_t /*count*/)
+    {
+        return true;
+    }
+
+    bool fork_guest(void* vctx, char* dst, uint32_t size)
+    {
+        // no cow to set up here, the fork is a plain raw image of the
+        // synthetic ram, good enough to exercise the client path
+        auto& guest       = *static_cast<FakeGuest*>(vctx);
+        const auto path   = std::string{"fdp_fake.fork"};
+        auto*      file   = fopen(path.data(), "wb");
+        if(!file)
+            return false;
+
+        const auto written = fwrite(guest.ram.data(), 1, guest.ram.size(), file);
+        fclose(file);
+        if(written != guest.ram.size())
+            return false;
+
+        strncpy(dst, path.data(), size - 1);
+        dst[size - 1] = 0;
+        return true;
+    }
+
+    bool get_fx_state(void* /*vctx*/, uint32_t /*cpu_id*/, uint8_t* /*dst*/, uint32_t* /*size*/)
+    {
+        return false;
+    }
+
+    bool set_fx_state(void* /*vctx*/, uint32_t /*cpu_id*/, uint8_t* /*src*/, uint32_t /*size*/)
+    {
+        return false;
+    }
+
+    bool no_op(void* /*vctx*/)
+    {
+        return true;
+    }
+
+    bool inject_interrupt(void* /*vctx*/, uint32_t /*cpu_id*/, uint32_t /*code*/, uint32_t /*error*/, uint64_t /*cr2*/)
+    {
+        return true;
+    }
+
+    // the synthetic process list lives in guest ram at proc_base: a
+    // circular singly-linked list stress tools can walk & rewrite
+    struct fake_proc_t
+    {
+        uint64_t next;
+        uint64_t pid;
+        char     name[16];
+    };
+    constexpr uint64_t proc_base = 0x10000;
+
+    void setup_guest(FakeGuest& guest, uint64_t ram_mb, uint64_t proc_count)
+    {
+        guest.ram.resize(ram_mb << 20);
+        guest.regs.fill(0);
+        guest.msrs.fill(0);
+        guest.state = FDP_STATE_PAUSED;
+        guest.breakpoints.fill(false);
+
+        // stamp every page with its own address so readers can validate
+        // what they got back
+        for(uint64_t addr = 0; addr < guest.ram.size(); addr += page_size)
+            memcpy(&guest.ram[addr], &addr, sizeof addr);
+
+        // identity page tables in the top two ram pages: one pml4 entry
+        // pointing to a pdpt of 1GB pages, cr3 points at the pml4
+        const auto pml4 = guest.ram.size() - 2 * page_size;
+        const auto pdpt = guest.ram.size() - 1 * page_size;
+        auto       ent  = pdpt | 3;
+        memcpy(&guest.ram[pml4], &ent, sizeof ent);
+        for(uint64_t i = 0; i * giga_page < guest.ram.size(); ++i)
+        {
+            ent = (i * giga_page) | 0x83;
+            memcpy(&guest.ram[pdpt + i * sizeof ent], &ent, sizeof ent);
+        }
+        guest.regs[FDP_CR3_REGISTER] = pml4;
+        guest.regs[FDP_RIP_REGISTER] = proc_base;
+        guest.msrs[0]                = proc_base; // lstar
+
+        for(uint64_t i = 0; i < proc_count; ++i)
+        {
+            auto proc = fake_proc_t{};
+            proc.next = proc_base + ((i + 1) % proc_count) * sizeof proc;
+            proc.pid  = 4 + i * 4;
+            const auto name = "proc_" + std::to_string(i);
+            strncpy(proc.name, name.data(), sizeof proc.name - 1);
+            memcpy(&guest.ram[proc_base + i * sizeof proc], &proc, sizeof proc);
+        }
+    }
+
+    FDP_SERVER_INTERFACE_T make_server(FakeGuest& guest)
+    {
+        auto srv                        = FDP_SERVER_INTERFACE_T{};
+        srv.pUserHandle                 = &guest;
+        srv.pfnGetState                 = &get_state;
+        srv.pfnGetCpuState              = &get_cpu_state;
+        srv.pfnGetCpuCount              = &get_cpu_count;
+        srv.pfnGetMemorySize            = &get_memory_size;
+        srv.pfnReadRegister             = &read_register;
+        srv.pfnWriteRegister            = &write_register;
+        srv.pfnReadMsr                  = &read_msr;
+        srv.pfnWriteMsr                 = &write_msr;
+        srv.pfnReadPhysicalMemory       = &read_physical;
+        srv.pfnWritePhysicalMemory      = &write_physical;
+        srv.pfnReadVirtualMemory        = &read_virtual;
+        srv.pfnWriteVirtualMemory       = &write_virtual;
+        srv.pfnReadVirtualMemoryMultiple = &read_virtual_multiple;
+        srv.pfnVirtualToPhysical        = &virtual_to_physical;
+        srv.pfnPause                    = &pause;
+        srv.pfnResume                   = &resume;
+        srv.pfnSingleStep               = &single_step;
+        srv.pfnSetBreakpoint            = &set_breakpoint;
+        srv.pfnUnsetBreakpoint          = &unset_breakpoint;
+        srv.pfnSetBreakpointFilter      = &set_breakpoint_filter;
+        srv.pfnSetBreakpointRegisterFilter = &set_breakpoint_register_filter;
+        srv.pfnSetBreakpointOneShot        = &set_breakpoint_one_shot;
+        srv.pfnFork                        = &fork_guest;
+        srv.pfnGetFxState64             = &get_fx_state;
+        srv.pfnSetFxState64             = &set_fx_state;
+        srv.pfnSave                     = &no_op;
+        srv.pfnRestore                  = &no_op;
+        srv.pfnSaveIncremental          = &no_op;
+        srv.pfnRestoreIncremental       = &no_op;
+        srv.pfnReboot                   = &no_op;
+        srv.pfnInjectInterrupt          = &inject_interrupt;
+        return srv;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    logg::init(argc, argv);
+    if(argc < 2 || argc > 4)
+        return FAIL(-1, "usage: fdp_fake <name> [ram_mb] [process_count]");
+
+    const auto name       = std::string{argv[1]};
+    const auto ram_mb     = argc > 2 ? strtoull(argv[2], nullptr, 0) : 512;
+    const auto proc_count = argc > 3 ? strtoull(argv[3], nullptr, 0) : 64;
+    if(ram_mb < 1)
+        return FAIL(-1, "ram size must be at least 1 MB");
+
+    auto guest = FakeGuest{};
+    setup_guest(guest, ram_mb, proc_count);
+
+    auto* shm = FDP_CreateSHM(name.data());
+    if(!shm)
+        return FAIL(-1, "unable to create shm %s", name.data());
+
+    auto srv = make_server(guest);
+    if(!FDP_SetFDPServer(shm, &srv))
+        return FAIL(-1, "unable to register server on %s", name.data());
+
+    LOG(INFO, "serving %" PRIu64 " MB fake guest, %" PRIu64 " process(es) on %s", ram_mb, proc_count, name.data());
+    FDP_ServerLoop(shm);
+    return 0;
+}
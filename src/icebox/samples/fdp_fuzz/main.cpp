@@ -0,0 +1,579 @@
+#define FDP_MODULE "fdp_fuzz"
+#include <FDP.h>
+#include <FDP_structs.h>
+#include <icebox/log.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr uint64_t page_size = 0x1000;
+
+    // every detected invariant break lands here; the run fails if any
+    std::atomic<uint64_t> g_violations{0};
+
+#define CHECK(COND, FMT, ...)               \
+    do                                      \
+    {                                       \
+        if(!(COND))                         \
+        {                                   \
+            ++g_violations;                 \
+            LOG(ERROR, FMT, ##__VA_ARGS__); \
+        }                                   \
+    } while(0)
+
+    // synthetic guest with fault injection: callbacks fail one call in
+    // fault_one_in & add random jitter so client/server interleavings
+    // shift from run to run; a failed call never mutates any state, so
+    // the protocol invariant stays simple: success implies valid data
+    struct FuzzGuest
+    {
+        std::vector<uint8_t>     ram;
+        std::array<uint64_t, 64> regs;
+        std::atomic<uint16_t>    state;
+        std::atomic<uint64_t>    fault_one_in;
+        std::mutex               mutex; // guards breakpoints
+        std::array<bool, FDP_MAX_BREAKPOINT> breakpoints;
+    };
+
+    bool inject_fault(FuzzGuest& guest)
+    {
+        const auto one_in = guest.fault_one_in.load(std::memory_order_relaxed);
+        if(!one_in)
+            return false;
+
+        thread_local auto gen = std::minstd_rand(std::random_device{}());
+        if(gen() % one_in)
+            return false;
+
+        return true;
+    }
+
+    void jitter()
+    {
+        thread_local auto gen = std::minstd_rand(std::random_device{}());
+        switch(gen() % 8)
+        {
+            case 0:     std::this_thread::yield(); break;
+            case 1:     std::this_thread::sleep_for(std::chrono::microseconds(gen() % 50)); break;
+            default:    break;
+        }
+    }
+
+    bool read_physical(void* vctx, uint8_t* dst, uint64_t addr, uint32_t size)
+    {
+        auto& guest = *static_cast<FuzzGuest*>(vctx);
+        jitter();
+        if(inject_fault(guest))
+            return false;
+
+        if(addr + size < addr || addr + size > guest.ram.size())
+            return false;
+
+        memcpy(dst, &guest.ram[addr], size);
+        return true;
+    }
+
+    bool write_physical(void* vctx, uint8_t* src, uint64_t addr, uint32_t size)
+    {
+        auto& guest = *static_cast<FuzzGuest*>(vctx);
+        jitter();
+        if(inject_fault(guest))
+            return false;
+
+        if(addr + size < addr || addr + size > guest.ram.size())
+            return false;
+
+        memcpy(&guest.ram[addr], src, size);
+        return true;
+    }
+
+    // identity translation, virtual accesses reuse the physical path
+    bool read_virtual(void* vctx, uint32_t /*cpu_id*/, uint64_t src, uint32_t size, uint8_t* dst)
+    {
+        return read_physical(vctx, dst, src, size);
+    }
+
+    bool write_virtual(void* vctx, uint32_t /*cpu_id*/, uint8_t* src, uint64_t dst, uint32_t size)
+    {
+        return write_physical(vctx, src, dst, size);
+    }
+
+    bool read_virtual_multiple(void* vctx, uint32_t /*cpu_id*/, const FDP_VIRTUAL_RANGE* ranges, uint32_t count, uint8_t* dst)
+    {
+        auto ok = true;
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            ok &= read_physical(vctx, dst, ranges[i].VirtualAddress, ranges[i].ReadSize);
+            dst += ranges[i].ReadSize;
+        }
+        return ok;
+    }
+
+    bool virtual_to_physical(void* /*vctx*/, uint32_t /*cpu_id*/, uint64_t va, uint64_t* pa)
+    {
+        *pa = va;
+        return true;
+    }
+
+    bool get_state(void* vctx, uint8_t* state)
+    {
+        auto& guest = *static_cast<FuzzGuest*>(vctx);
+        *state      = static_cast<uint8_t>(guest.state.load(std::memory_order_relaxed));
+        return true;
+    }
+
+    bool get_cpu_state(void* vctx, uint32_t /*cpu_id*/, uint8_t* state)
+    {
+        return get_state(vctx, state);
+    }
+
+    bool get_cpu_count(void* /*vctx*/, uint32_t* count)
+    {
+        *count = 1;
+        return true;
+    }
+
+    bool get_memory_size(void* vctx, uint64_t* size)
+    {
+        auto& guest = *static_cast<FuzzGuest*>(vctx);
+        *size       = guest.ram.size();
+        return true;
+    }
+
+    bool read_register(void* vctx, uint32_t /*cpu_id*/, FDP_Register reg, uint64_t* value)
+    {
+        auto& guest = *static_cast<FuzzGuest*>(vctx);
+        jitter();
+        if(inject_fault(guest) || reg >= guest.regs.size())
+            return false;
+
+        *value = guest.regs[reg];
+        return true;
+    }
+
+    bool write_register(void* vctx, uint32_t /*cpu_id*/, FDP_Register reg, uint64_t value)
+    {
+        auto& guest = *static_cast<FuzzGuest*>(vctx);
+        jitter();
+        if(inject_fault(guest) || reg >= guest.regs.size())
+            return false;
+
+        guest.regs[reg] = value;
+        return true;
+    }
+
+    bool read_msr(void* /*vctx*/, uint32_t /*cpu_id*/, uint64_t /*msr_id*/, uint64_t* value)
+    {
+        *value = 0;
+        return true;
+    }
+
+    bool write_msr(void* /*vctx*/, uint32_t /*cpu_id*/, uint64_t /*msr_id*/, uint64_t /*value*/)
+    {
+        return true;
+    }
+
+    bool pause(void* vctx)
+    {
+        auto& guest = *static_cast<FuzzGuest*>(vctx);
+        guest.state.store(FDP_STATE_PAUSED, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool resume(void* vctx)
+    {
+        auto& guest = *static_cast<FuzzGuest*>(vctx);
+        guest.state.store(FDP_STATE_NULL, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool single_step(void* vctx, uint32_t /*cpu_id*/)
+    {
+        auto& guest = *static_cast<FuzzGuest*>(vctx);
+        guest.regs[FDP_RIP_REGISTER]++;
+        return true;
+    }
+
+    int set_breakpoint(void* vctx, uint32_t /*cpu_id*/, FDP_BreakpointType /*type*/, int bpid, FDP_Access /*access*/, FDP_AddressType /*ptrtype*/, uint64_t /*ptr*/, uint64_t /*len*/, uint64_t /*cr3*/)
+    {
+        auto& guest = *static_cast<FuzzGuest*>(vctx);
+        jitter();
+        if(inject_fault(guest))
+            return -1;
+
+        const auto lock = std::lock_guard{guest.mutex};
+        if(bpid >= 0)
+        {
+            if(bpid >= FDP_MAX_BREAKPOINT || guest.breakpoints[bpid])
+                return -1;
+
+            guest.breakpoints[bpid] = true;
+            return bpid;
+        }
+
+        for(int i = 0; i < FDP_MAX_BREAKPOINT; ++i)
+            if(!guest.breakpoints[i])
+            {
+                guest.breakpoints[i] = true;
+                return i;
+            }
+        return -1;
+    }
+
+    bool unset_breakpoint(void* vctx, int bpid)
+    {
+        auto&      guest = *static_cast<FuzzGuest*>(vctx);
+        const auto lock  = std::lock_guard{guest.mutex};
+        if(bpid < 0 || bpid >= FDP_MAX_BREAKPOINT || !guest.breakpoints[bpid])
+            return false;
+
+        guest.breakpoints[bpid] = false;
+        return true;
+    }
+
+    bool no_op(void* /*vctx*/)
+    {
+        return true;
+    }
+
+    bool inject_interrupt(void* /*vctx*/, uint32_t /*cpu_id*/, uint32_t /*code*/, uint32_t /*error*/, uint64_t /*cr2*/)
+    {
+        return true;
+    }
+
+    void setup_guest(FuzzGuest& guest, uint64_t ram_mb, uint64_t fault_one_in)
+    {
+        guest.ram.resize(ram_mb << 20);
+        guest.regs.fill(0);
+        guest.state        = FDP_STATE_PAUSED;
+        guest.fault_one_in = fault_one_in;
+        guest.breakpoints.fill(false);
+
+        // stamp every page with its own address: any reply claiming
+        // success but carrying foreign bytes is caught immediately
+        for(uint64_t addr = 0; addr < guest.ram.size(); addr += page_size)
+            memcpy(&guest.ram[addr], &addr, sizeof addr);
+    }
+
+    FDP_SERVER_INTERFACE_T make_server(FuzzGuest& guest)
+    {
+        auto srv                         = FDP_SERVER_INTERFACE_T{};
+        srv.pUserHandle                  = &guest;
+        srv.pfnGetState                  = &get_state;
+        srv.pfnGetCpuState               = &get_cpu_state;
+        srv.pfnGetCpuCount               = &get_cpu_count;
+        srv.pfnGetMemorySize             = &get_memory_size;
+        srv.pfnReadRegister              = &read_register;
+        srv.pfnWriteRegister             = &write_register;
+        srv.pfnReadMsr                   = &read_msr;
+        srv.pfnWriteMsr                  = &write_msr;
+        srv.pfnReadPhysicalMemory        = &read_physical;
+        srv.pfnWritePhysicalMemory       = &write_physical;
+        srv.pfnReadVirtualMemory         = &read_virtual;
+        srv.pfnWriteVirtualMemory        = &write_virtual;
+        srv.pfnReadVirtualMemoryMultiple = &read_virtual_multiple;
+        srv.pfnVirtualToPhysical         = &virtual_to_physical;
+        srv.pfnPause                     = &pause;
+        srv.pfnResume                    = &resume;
+        srv.pfnSingleStep                = &single_step;
+        srv.pfnSetBreakpoint             = &set_breakpoint;
+        srv.pfnUnsetBreakpoint           = &unset_breakpoint;
+        srv.pfnSave                      = &no_op;
+        srv.pfnRestore                   = &no_op;
+        srv.pfnSaveIncremental           = &no_op;
+        srv.pfnRestoreIncremental        = &no_op;
+        srv.pfnReboot                    = &no_op;
+        srv.pfnInjectInterrupt           = &inject_interrupt;
+        return srv;
+    }
+}
+
+namespace
+{
+    // per-thread scratch pages, far from the stamped low pages
+    constexpr uint64_t scratch_base = 0x800000;
+
+    struct fuzz_args_t
+    {
+        std::string           name;
+        uint64_t              seed;
+        size_t                tid;
+        uint64_t              ram_size;
+        std::atomic<bool>*    stop;
+        std::atomic<uint64_t>* ops;
+    };
+
+    // drive the classic canal with a randomized op mix; every op
+    // asserts the one invariant fault injection cannot excuse: a call
+    // reported successful returned coherent data
+    void fuzz_classic(const fuzz_args_t& args)
+    {
+        auto* shm = FDP_OpenSHM(args.name.data());
+        if(!shm)
+        {
+            CHECK(false, "thread %zd: unable to open shm", args.tid);
+            return;
+        }
+
+        auto       gen          = std::minstd_rand(static_cast<uint32_t>(args.seed + args.tid));
+        const auto scratch      = scratch_base + args.tid * page_size;
+        const auto own_reg      = FDP_Register(FDP_R8_REGISTER + args.tid % 8);
+        auto       acked        = uint64_t{0}; // last write the server acknowledged
+        auto       acked_reg    = uint64_t{0};
+        auto       reg_written  = false;
+        auto       page         = std::vector<uint8_t>(page_size);
+        while(!args.stop->load(std::memory_order_relaxed))
+        {
+            ++*args.ops;
+            switch(gen() % 8)
+            {
+                case 0: // stamped page read, physical
+                {
+                    const auto addr = (gen() % (args.ram_size / page_size)) * page_size;
+                    if(!FDP_ReadPhysicalMemory(shm, &page[0], page_size, addr))
+                        break;
+
+                    auto stamp = uint64_t{};
+                    memcpy(&stamp, &page[0], sizeof stamp);
+                    CHECK(stamp == addr, "thread %zd: physical read returned page %" PRIx64 " instead of %" PRIx64, args.tid, stamp, addr);
+                    break;
+                }
+                case 1: // stamped page read, virtual
+                {
+                    const auto addr = (gen() % (args.ram_size / page_size)) * page_size;
+                    if(!FDP_ReadVirtualMemory(shm, 0, &page[0], page_size, addr))
+                        break;
+
+                    auto stamp = uint64_t{};
+                    memcpy(&stamp, &page[0], sizeof stamp);
+                    CHECK(stamp == addr, "thread %zd: virtual read returned page %" PRIx64 " instead of %" PRIx64, args.tid, stamp, addr);
+                    break;
+                }
+                case 2: // write/read roundtrip on the thread-owned page
+                {
+                    auto value = uint64_t{gen()} << 32 | gen();
+                    if(FDP_WritePhysicalMemory(shm, reinterpret_cast<uint8_t*>(&value), sizeof value, scratch))
+                        acked = value;
+                    auto now = uint64_t{};
+                    if(!FDP_ReadPhysicalMemory(shm, reinterpret_cast<uint8_t*>(&now), sizeof now, scratch))
+                        break;
+
+                    CHECK(now == acked, "thread %zd: scratch read %" PRIx64 " != last acked write %" PRIx64, args.tid, now, acked);
+                    break;
+                }
+                case 3: // register roundtrip on the thread-owned slot
+                {
+                    auto value = uint64_t{gen()} << 32 | gen();
+                    if(FDP_WriteRegister(shm, 0, own_reg, value))
+                    {
+                        acked_reg   = value;
+                        reg_written = true;
+                    }
+                    auto now = uint64_t{};
+                    if(!reg_written || !FDP_ReadRegister(shm, 0, own_reg, &now))
+                        break;
+
+                    CHECK(now == acked_reg, "thread %zd: register read %" PRIx64 " != last acked write %" PRIx64, args.tid, now, acked_reg);
+                    break;
+                }
+                case 4: // state & geometry queries return stable facts
+                {
+                    auto state = FDP_State{};
+                    FDP_GetState(shm, &state);
+                    auto size = uint64_t{};
+                    if(FDP_GetPhysicalMemorySize(shm, &size))
+                        CHECK(size == args.ram_size, "thread %zd: memory size %" PRIx64 " != %" PRIx64, args.tid, size, args.ram_size);
+                    break;
+                }
+                case 5: // breakpoint slots stay in range & release cleanly
+                {
+                    const auto bpid = FDP_SetBreakpoint(shm, 0, FDP_SOFTHBP, -1, FDP_EXECUTE_BP, FDP_VIRTUAL_ADDRESS, scratch, 1, FDP_NO_CR3);
+                    if(bpid < 0)
+                        break;
+
+                    CHECK(bpid < FDP_MAX_BREAKPOINT, "thread %zd: breakpoint id %d out of range", args.tid, bpid);
+                    CHECK(FDP_UnsetBreakpoint(shm, bpid), "thread %zd: unable to release breakpoint %d", args.tid, bpid);
+                    break;
+                }
+                case 6: // pause/resume/single-step churn the state word
+                {
+                    FDP_Pause(shm);
+                    FDP_SingleStep(shm, 0);
+                    FDP_Resume(shm);
+                    break;
+                }
+                case 7: // scattered reads through the multiple-range path
+                {
+                    const auto addr   = (gen() % (args.ram_size / page_size)) * page_size;
+                    auto       ranges = std::array<FDP_VIRTUAL_RANGE, 2>{{{addr, 8}, {addr + 8, 8}}};
+                    auto       bytes  = std::array<uint8_t, 16>{};
+                    if(!FDP_ReadVirtualMemoryMultiple(shm, 0, &ranges[0], 2, &bytes[0]))
+                        break;
+
+                    auto stamp = uint64_t{};
+                    memcpy(&stamp, &bytes[0], sizeof stamp);
+                    CHECK(stamp == addr, "thread %zd: multiple read returned page %" PRIx64 " instead of %" PRIx64, args.tid, stamp, addr);
+                    break;
+                }
+            }
+        }
+        FDP_ExitSHM(shm);
+    }
+
+    // drive the pipelined ring from one dedicated thread: requests go
+    // out in a burst, responses must come back in the same order with
+    // their status words intact
+    void fuzz_pipelined(const fuzz_args_t& args)
+    {
+        auto* shm = FDP_OpenSHM(args.name.data());
+        if(!shm)
+        {
+            CHECK(false, "pipeline: unable to open shm");
+            return;
+        }
+
+        auto gen      = std::minstd_rand(static_cast<uint32_t>(args.seed ^ 0x9E3779B9));
+        auto response = std::vector<uint8_t>(FDP_MAX_DATA_SIZE);
+        while(!args.stop->load(std::memory_order_relaxed))
+        {
+            const auto burst = 1 + gen() % 8;
+            auto       addrs = std::vector<uint64_t>{};
+            auto       sent  = size_t{0};
+            for(size_t i = 0; i < burst; ++i)
+            {
+                const auto addr = (gen() % (args.ram_size / page_size)) * page_size;
+                auto       pkt  = FDP_READ_PHYSICAL_MEMORY_PKT_REQ{};
+                pkt.Type            = FDPCMD_READ_PHYSICAL;
+                pkt.PhysicalAddress = addr;
+                pkt.ReadSize        = static_cast<uint32_t>(page_size);
+                if(!FDP_EnqueueCommand(shm, &pkt, sizeof pkt))
+                    break; // ring full, collect what went out
+
+                addrs.push_back(addr);
+                ++sent;
+            }
+            for(size_t i = 0; i < sent; ++i)
+            {
+                ++*args.ops;
+                auto       status = false;
+                const auto size   = FDP_CollectResponse(shm, &response[0], static_cast<uint32_t>(response.size()), &status);
+                CHECK(size != 0, "pipeline: lost response %zd of %zd", i, sent);
+                if(!size || !status)
+                    continue;
+
+                // responses are fifo: reply i must carry the page of request i
+                CHECK(size == page_size, "pipeline: response size %u != %" PRIu64, size, page_size);
+                auto stamp = uint64_t{};
+                memcpy(&stamp, &response[0], sizeof stamp);
+                CHECK(stamp == addrs[i], "pipeline: response %zd returned page %" PRIx64 " instead of %" PRIx64, i, stamp, addrs[i]);
+            }
+        }
+        FDP_ExitSHM(shm);
+    }
+
+    // read-only session over the parallel canals: reads must stay
+    // coherent & every mutating command must be refused
+    void fuzz_readonly(const fuzz_args_t& args)
+    {
+        auto* shm = FDP_OpenSHM(args.name.data());
+        if(!shm)
+        {
+            CHECK(false, "readonly: unable to open shm");
+            return;
+        }
+
+        if(!FDP_OpenSession(shm, true))
+        {
+            CHECK(false, "readonly: unable to open session");
+            FDP_ExitSHM(shm);
+            return;
+        }
+
+        auto gen  = std::minstd_rand(static_cast<uint32_t>(args.seed ^ 0x85EBCA6B));
+        auto page = std::vector<uint8_t>(page_size);
+        while(!args.stop->load(std::memory_order_relaxed))
+        {
+            ++*args.ops;
+            const auto addr = (gen() % (args.ram_size / page_size)) * page_size;
+            if(FDP_ReadPhysicalMemory(shm, &page[0], page_size, addr))
+            {
+                auto stamp = uint64_t{};
+                memcpy(&stamp, &page[0], sizeof stamp);
+                CHECK(stamp == addr, "readonly: read returned page %" PRIx64 " instead of %" PRIx64, stamp, addr);
+            }
+            CHECK(!FDP_WriteRegister(shm, 0, FDP_RAX_REGISTER, 0), "readonly: mutating command accepted on observer session");
+        }
+        FDP_CloseSession(shm);
+        FDP_ExitSHM(shm);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    logg::init(argc, argv);
+    if(argc < 2 || argc > 6)
+        return FAIL(-1, "usage: fdp_fuzz <name> [seconds] [threads] [fault_one_in] [seed]");
+
+    const auto name         = std::string{argv[1]};
+    const auto seconds      = uint64_t{argc > 2 ? strtoull(argv[2], nullptr, 0) : 10};
+    const auto threads      = size_t{argc > 3 ? strtoull(argv[3], nullptr, 0) : 4};
+    const auto fault_one_in = uint64_t{argc > 4 ? strtoull(argv[4], nullptr, 0) : 16};
+    const auto seed         = uint64_t{argc > 5 ? strtoull(argv[5], nullptr, 0) : std::random_device{}()};
+    LOG(INFO, "fuzzing %s: %" PRIu64 "s, %zd thread(s), 1-in-%" PRIu64 " faults, seed 0x%" PRIx64, name.data(), seconds, threads, fault_one_in, seed);
+
+    auto guest = FuzzGuest{};
+    setup_guest(guest, 64, fault_one_in);
+
+    auto* server_shm = FDP_CreateSHM(name.data());
+    if(!server_shm)
+        return FAIL(-1, "unable to create shm %s", name.data());
+
+    auto srv = make_server(guest);
+    if(!FDP_SetFDPServer(server_shm, &srv))
+        return FAIL(-1, "unable to register server on %s", name.data());
+
+    auto server = std::thread{[=] { FDP_ServerLoop(server_shm); }};
+
+    auto stop    = std::atomic<bool>{false};
+    auto ops     = std::atomic<uint64_t>{0};
+    auto args    = fuzz_args_t{name, seed, 0, guest.ram.size(), &stop, &ops};
+    auto workers = std::vector<std::thread>{};
+    workers.emplace_back([=] { fuzz_pipelined(args); });
+    if(threads > 1)
+        workers.emplace_back([=] { fuzz_readonly(args); });
+    for(size_t tid = workers.size(); tid < threads; ++tid)
+    {
+        auto targs = args;
+        targs.tid  = tid;
+        workers.emplace_back([=] { fuzz_classic(targs); });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    stop = true;
+    for(auto& worker : workers)
+        worker.join();
+
+    // the channel must survive the storm: with faults off, a fresh
+    // client completes a full round trip on the very canal just fuzzed
+    guest.fault_one_in = 0;
+    auto* probe        = FDP_OpenSHM(name.data());
+    auto  state        = FDP_State{};
+    CHECK(probe && FDP_GetState(probe, &state), "channel unusable after the run");
+    if(probe)
+        FDP_ExitSHM(probe);
+
+    FDP_SetFDPServerRunning(server_shm, false);
+    server.join();
+
+    const auto violations = g_violations.load();
+    LOG(INFO, "%" PRIu64 " ops, %" PRIu64 " violation(s)", ops.load(), violations);
+    return violations ? -1 : 0;
+}
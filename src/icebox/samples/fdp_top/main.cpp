@@ -0,0 +1,90 @@
+#define FDP_MODULE "fdp_top"
+#include <FDP.h>
+#include <FDP_structs.h>
+#include <icebox/log.hpp>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace
+{
+    const char* command_name(int slot)
+    {
+        switch(slot)
+        {
+            case FDPCMD_READ_PHYSICAL:          return "read_physical";
+            case FDPCMD_READ_VIRTUAL:           return "read_virtual";
+            case FDPCMD_READ_VIRTUAL_MULTIPLE:  return "read_virtual_multiple";
+            case FDPCMD_READ_PHYSICAL_STREAM:   return "read_physical_stream";
+            case FDPCMD_WRITE_PHYSICAL:         return "write_physical";
+            case FDPCMD_WRITE_VIRTUAL:          return "write_virtual";
+            case FDPCMD_READ_REGISTER:          return "read_register";
+            case FDPCMD_WRITE_REGISTER:         return "write_register";
+            case FDPCMD_READ_MSR:               return "read_msr";
+            case FDPCMD_WRITE_MSR:              return "write_msr";
+            case FDPCMD_GET_CPU_CTX:            return "get_cpu_ctx";
+            case FDPCMD_GET_STATE:              return "get_state";
+            case FDPCMD_SET_BP:                 return "set_bp";
+            case FDPCMD_SET_BP_MULTIPLE:        return "set_bp_multiple";
+            case FDPCMD_UNSET_BP:               return "unset_bp";
+            case FDPCMD_UNSET_BP_MULTIPLE:      return "unset_bp_multiple";
+            case FDPCMD_PAUSE_VM:               return "pause_vm";
+            case FDPCMD_RESUME_VM:              return "resume_vm";
+            case FDPCMD_SINGLE_STEP:            return "single_step";
+            case FDPCMD_SINGLE_STEP_MULTIPLE:   return "single_step_multiple";
+            case FDPCMD_VIRTUAL_PHYSICAL:       return "virtual_physical";
+            default:                            return nullptr;
+        }
+    }
+
+    // one wait-free snapshot per interval; slots are printed as deltas
+    // so a stalled command class shows up as zero throughput with a
+    // growing cumulative latency
+    int monitor(FDP_SHM* shm, uint64_t interval_ms)
+    {
+        auto last    = FDP_TELEMETRY_SNAPSHOT{};
+        auto current = FDP_TELEMETRY_SNAPSHOT{};
+        if(!FDP_GetTelemetry(shm, &last))
+            return FAIL(-1, "unable to read telemetry");
+
+        while(true)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+            if(!FDP_GetTelemetry(shm, &current))
+                return FAIL(-1, "unable to read telemetry");
+
+            for(int slot = 0; slot < FDP_TELEMETRY_CMD_SLOTS; ++slot)
+            {
+                const auto count = current.CommandCount[slot] - last.CommandCount[slot];
+                if(!count)
+                    continue;
+
+                const auto ns    = current.CommandNs[slot] - last.CommandNs[slot];
+                const auto* name = command_name(slot);
+                LOG(INFO, "%-22s n:%" PRIu64 " avg:%" PRIu64 " ns", name ? name : std::to_string(slot).data(), count, ns / count);
+            }
+            const auto hits    = current.BreakpointHitCount - last.BreakpointHitCount;
+            const auto changes = current.StateChangeCount - last.StateChangeCount;
+            if(hits || changes)
+                LOG(INFO, "%-22s hits:%" PRIu64 " state_changes:%" PRIu64, "events", hits, changes);
+            last = current;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    logg::init(argc, argv);
+    if(argc != 2 && argc != 3)
+        return FAIL(-1, "usage: fdp_top <name> [interval_ms]");
+
+    const auto name        = std::string{argv[1]};
+    const auto interval_ms = argc == 3 ? std::stoull(argv[2]) : uint64_t{1000};
+
+    auto* shm = FDP_OpenSHM(name.data());
+    if(!shm)
+        return FAIL(-1, "unable to open shm %s", name.data());
+
+    return monitor(shm, interval_ms);
+}
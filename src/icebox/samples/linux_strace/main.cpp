@@ -0,0 +1,184 @@
+#define FDP_MODULE "linux_strace"
+#include <icebox/core.hpp>
+#include <icebox/log.hpp>
+#include <icebox/tracer/tracer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr size_t max_syscalls = 512;
+
+    // common x86_64 syscall numbers, unknown ones fall back to sys_<nr>
+    const char* known_name(uint64_t nr)
+    {
+        switch(nr)
+        {
+            case 0:     return "read";
+            case 1:     return "write";
+            case 2:     return "open";
+            case 3:     return "close";
+            case 4:     return "stat";
+            case 5:     return "fstat";
+            case 6:     return "lstat";
+            case 7:     return "poll";
+            case 8:     return "lseek";
+            case 9:     return "mmap";
+            case 10:    return "mprotect";
+            case 11:    return "munmap";
+            case 12:    return "brk";
+            case 13:    return "rt_sigaction";
+            case 14:    return "rt_sigprocmask";
+            case 16:    return "ioctl";
+            case 17:    return "pread64";
+            case 18:    return "pwrite64";
+            case 19:    return "readv";
+            case 20:    return "writev";
+            case 21:    return "access";
+            case 22:    return "pipe";
+            case 23:    return "select";
+            case 24:    return "sched_yield";
+            case 28:    return "madvise";
+            case 32:    return "dup";
+            case 33:    return "dup2";
+            case 35:    return "nanosleep";
+            case 39:    return "getpid";
+            case 41:    return "socket";
+            case 42:    return "connect";
+            case 43:    return "accept";
+            case 44:    return "sendto";
+            case 45:    return "recvfrom";
+            case 46:    return "sendmsg";
+            case 47:    return "recvmsg";
+            case 48:    return "shutdown";
+            case 49:    return "bind";
+            case 50:    return "listen";
+            case 56:    return "clone";
+            case 57:    return "fork";
+            case 59:    return "execve";
+            case 60:    return "exit";
+            case 61:    return "wait4";
+            case 62:    return "kill";
+            case 72:    return "fcntl";
+            case 78:    return "getdents";
+            case 79:    return "getcwd";
+            case 83:    return "mkdir";
+            case 87:    return "unlink";
+            case 89:    return "readlink";
+            case 96:    return "gettimeofday";
+            case 102:   return "getuid";
+            case 104:   return "getgid";
+            case 158:   return "arch_prctl";
+            case 186:   return "gettid";
+            case 202:   return "futex";
+            case 218:   return "set_tid_address";
+            case 228:   return "clock_gettime";
+            case 231:   return "exit_group";
+            case 257:   return "openat";
+            case 262:   return "newfstatat";
+            case 271:   return "ppoll";
+            case 288:   return "accept4";
+            case 302:   return "prlimit64";
+            case 318:   return "getrandom";
+            default:    return nullptr;
+        }
+    }
+
+    // one static callcfg per syscall number: log_call defers string
+    // formatting to the sink thread & the columnar store interns names
+    // by callcfg pointer, so the hot path stays one table lookup
+    struct Syscalls
+    {
+        Syscalls()
+        {
+            for(size_t nr = 0; nr < max_syscalls; ++nr)
+            {
+                const auto* name = known_name(nr);
+                names[nr]        = name ? name : "sys_" + std::to_string(nr);
+                cfgs[nr]         = tracer::callcfg_t{names[nr].data(), 0, {}};
+            }
+        }
+
+        const tracer::callcfg_t& get(uint64_t nr) const
+        {
+            return cfgs[nr < max_syscalls ? nr : 0];
+        }
+
+        std::array<std::string, max_syscalls>       names;
+        std::array<tracer::callcfg_t, max_syscalls> cfgs;
+    };
+
+    int report()
+    {
+        auto counts = std::unordered_map<std::string, uint64_t>{};
+        auto total  = uint64_t{};
+        const auto ok = tracer::query_store("", 0, ~uint64_t{0}, [&](const tracer::trace_event_t& ev)
+        {
+            ++counts[ev.name];
+            ++total;
+            return walk_e::next;
+        });
+        if(!ok)
+            return FAIL(-1, "unable to query trace store");
+
+        auto sorted = std::vector<std::pair<std::string, uint64_t>>{counts.begin(), counts.end()};
+        std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b)
+        {
+            return a.second > b.second;
+        });
+        LOG(INFO, "%" PRIu64 " syscall(s) traced", total);
+        for(const auto& it : sorted)
+            LOG(INFO, "%8" PRIu64 " %s", it.second, it.first.data());
+        return 0;
+    }
+
+    int strace(core::Core& core, int seconds)
+    {
+        const auto entry = symbols::address(core, symbols::kernel, "kernel_sym", "entry_SYSCALL_64");
+        if(!entry)
+            return FAIL(-1, "unable to resolve kernel_sym!entry_SYSCALL_64");
+
+        static const auto syscalls = Syscalls{};
+        tracer::enable_store(true);
+        const auto bp = state::break_on(core, "entry_SYSCALL_64", *entry, [&]
+        {
+            const auto nr = registers::read(core, reg_e::rax);
+            tracer::log_call(core, syscalls.get(nr));
+        });
+        if(!bp)
+            return FAIL(-1, "unable to break on entry_SYSCALL_64");
+
+        LOG(INFO, "tracing syscalls for %d second(s)...", seconds);
+        const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+        while(std::chrono::steady_clock::now() < end)
+            state::exec(core);
+
+        tracer::enable_store(false);
+        return report();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    logg::init(argc, argv);
+    if(argc != 2 && argc != 3)
+        return FAIL(-1, "usage: linux_strace <name> [seconds]");
+
+    const auto name    = std::string{argv[1]};
+    const auto seconds = argc == 3 ? atoi(argv[2]) : 30;
+    LOG(INFO, "starting on %s", name.data());
+
+    const auto core = core::attach(name);
+    if(!core)
+        return FAIL(-1, "unable to start core at %s", name.data());
+
+    state::pause(*core);
+    const auto ret = strace(*core, seconds);
+    state::resume(*core);
+    return ret;
+}
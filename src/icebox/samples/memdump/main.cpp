@@ -0,0 +1,85 @@
+#define FDP_MODULE "memdump"
+#include <icebox/core.hpp>
+#include <icebox/log.hpp>
+#include <icebox/utils/file.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+namespace
+{
+    // large chunks go through the fdp streaming read path
+    constexpr uint64_t chunk_size = 16 * 1024 * 1024;
+    constexpr uint64_t page_size  = 0x1000;
+
+    int dump(core::Core& core, const fs::path& output)
+    {
+        const auto opt_size = memory::physical_size(core);
+        if(!opt_size)
+            return FAIL(-1, "unable to read physical memory size");
+
+        const auto total = *opt_size;
+        LOG(INFO, "dumping %" PRIu64 " MB to %s", total >> 20, output.generic_string().data());
+
+        auto writer = file::Writer{};
+        auto ok     = file::map_write(writer, output, chunk_size);
+        if(!ok)
+            return FAIL(-1, "unable to map %s", output.generic_string().data());
+
+        state::pause(core);
+        const auto beg = std::chrono::steady_clock::now();
+        auto holes     = uint64_t{};
+        for(uint64_t addr = 0; addr < total; addr += chunk_size)
+        {
+            const auto size = std::min(chunk_size, total - addr);
+            auto* dst       = reinterpret_cast<uint8_t*>(file::map_grow(writer, size));
+            if(!dst)
+            {
+                state::resume(core);
+                return FAIL(-1, "unable to grow %s", output.generic_string().data());
+            }
+
+            // reads land directly in the mapped file, the host flushes
+            // them asynchronously through page-cache writeback
+            ok = memory::read_physical(core, dst, addr, size);
+            if(ok)
+                continue;
+
+            // retry page by page: unbacked pages are never touched, so
+            // they stay holes & the output file remains sparse
+            for(uint64_t off = 0; off < size; off += page_size)
+                if(!memory::read_physical(core, dst + off, addr + off, page_size))
+                    ++holes;
+        }
+        state::resume(core);
+
+        const auto elapsed = std::chrono::steady_clock::now() - beg;
+        const auto ms      = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+        ok                 = file::map_close(writer);
+        if(!ok)
+            return FAIL(-1, "unable to close %s", output.generic_string().data());
+
+        const auto rate = ms ? (total >> 20) * 1000 / static_cast<uint64_t>(ms) : 0;
+        LOG(INFO, "dumped %" PRIu64 " MB in %" PRId64 " ms (%" PRIu64 " MB/s), %" PRIu64 " unbacked page(s)",
+            total >> 20, ms, rate, holes);
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    logg::init(argc, argv);
+    if(argc != 3)
+        return FAIL(-1, "usage: memdump <name> <output_file>");
+
+    const auto name   = std::string{argv[1]};
+    const auto output = fs::path{argv[2]};
+    LOG(INFO, "starting on %s", name.data());
+
+    const auto core = core::attach(name);
+    if(!core)
+        return FAIL(-1, "unable to start core at %s", name.data());
+
+    return dump(*core, output);
+}
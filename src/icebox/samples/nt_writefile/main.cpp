@@ -6,17 +6,121 @@
 #include <icebox/utils/file.hpp>
 #include <icebox/utils/path.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace
 {
+    constexpr uint64_t page_size = 0x1000;
+
+    struct WriteJob
+    {
+        fs::path             dst;
+        std::vector<uint8_t> data;
+    };
+
+    // async write queue: the guest resumes as soon as bytes are copied
+    // out & host disk latency is paid on this thread; buffers recycle
+    // through a free list so steady state allocates nothing
+    struct WriteQueue
+    {
+        WriteQueue()
+            : stop(false)
+        {
+            worker = std::thread{[this] { run(); }};
+        }
+
+        ~WriteQueue()
+        {
+            {
+                const auto lock = std::lock_guard<std::mutex>{mutex};
+                stop            = true;
+            }
+            cv.notify_all();
+            // drains pending jobs before returning
+            worker.join();
+        }
+
+        std::vector<uint8_t> acquire()
+        {
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            if(free_bufs.empty())
+                return {};
+
+            auto buf = std::move(free_bufs.back());
+            free_bufs.pop_back();
+            return buf;
+        }
+
+        void release(std::vector<uint8_t> buf)
+        {
+            buf.clear();
+            const auto lock = std::lock_guard<std::mutex>{mutex};
+            free_bufs.emplace_back(std::move(buf));
+        }
+
+        void push(fs::path dst, std::vector<uint8_t> data)
+        {
+            {
+                const auto lock = std::lock_guard<std::mutex>{mutex};
+                jobs.emplace_back(WriteJob{std::move(dst), std::move(data)});
+            }
+            cv.notify_one();
+        }
+
+        void run()
+        {
+            while(true)
+            {
+                auto lock = std::unique_lock<std::mutex>{mutex};
+                cv.wait(lock, [&] { return !jobs.empty() || stop; });
+                if(jobs.empty() && stop)
+                    return;
+
+                auto job = std::move(jobs.front());
+                jobs.pop_front();
+                lock.unlock();
+                const auto ok = file::write(job.dst, &job.data[0], job.data.size());
+                if(!ok)
+                    LOG(ERROR, "unable to write %s", job.dst.generic_string().data());
+                release(std::move(job.data));
+            }
+        }
+
+        std::mutex                        mutex;
+        std::condition_variable           cv;
+        std::deque<WriteJob>              jobs;
+        std::vector<std::vector<uint8_t>> free_bufs;
+        std::thread                       worker;
+        bool                              stop;
+    };
+
     bool read_file(std::vector<uint8_t>& dst, const memory::Io& io, nt::PVOID Buffer, nt::ULONG Length)
     {
         if(Length > 64 * 1024 * 1024)
             return FAIL(false, "buffer too big size:%d", Length);
 
         dst.resize(Length);
-        const auto ok = io.read_all(&dst[0], Buffer, Length);
+        // one batched scatter read, page-sized ranges into the reused buffer
+        auto ranges = std::vector<memory::io_range_t>{};
+        ranges.reserve(Length / page_size + 2);
+        auto  src  = uint64_t{Buffer};
+        auto  left = size_t{Length};
+        auto* out  = &dst[0];
+        while(left)
+        {
+            const auto chunk = std::min<size_t>(left, page_size - (src & (page_size - 1)));
+            ranges.emplace_back(memory::io_range_t{src, out, chunk});
+            src += chunk;
+            out += chunk;
+            left -= chunk;
+        }
+        const auto ok = io.read_many(&ranges[0], ranges.size());
         if(!ok)
             return FAIL(false, "unable to read range:0x%" PRIx64 "-0x%" PRIx64, Buffer, Buffer + Length);
 
@@ -51,7 +155,7 @@ namespace
         int idx       = -1;
         auto objects  = objects::make(core, *proc);
         auto tracer   = nt::syscalls{core, "ntdll"};
-        auto buffer   = std::vector<uint8_t>{};
+        auto writes   = WriteQueue{};
         const auto io = memory::make_io(core, *proc);
         const auto bp = tracer.register_NtWriteFile(*proc, [&](nt::HANDLE FileHandle, nt::HANDLE /*Event*/, nt::PIO_APC_ROUTINE /*ApcRoutine*/,
                                                                nt::PVOID /*ApcContext*/, nt::PIO_STATUS_BLOCK /*IoStatusBlock*/, nt::PVOID Buffer,
@@ -59,15 +163,20 @@ namespace
         {
             ++idx;
             const auto filename = read_filename(*objects, FileHandle);
-            const auto read     = read_file(buffer, io, Buffer, Length);
-            if(!filename || !read)
+            if(!filename)
                 return;
 
+            auto buffer     = writes.acquire();
+            const auto read = read_file(buffer, io, Buffer, Length);
+            if(!read)
+                return writes.release(std::move(buffer));
+
             LOG(INFO, "%s: %d byte(s)", filename->data(), Length);
             const auto ext = fs::path(*filename).extension().generic_string();
             const auto dst = path::filename(*filename).replace_extension(std::to_string(idx) + ext);
-            LOG(INFO, "dumping %s: %" PRId64 " byte(s)...", dst.generic_string().data(), buffer.size());
-            file::write(dst, &buffer[0], buffer.size());
+            LOG(INFO, "queueing %s: %" PRId64 " byte(s)...", dst.generic_string().data(), buffer.size());
+            // the disk write happens on the queue thread, the guest resumes now
+            writes.push(dst, std::move(buffer));
         });
 
         LOG(INFO, "listening NtWriteFile events...");
@@ -0,0 +1,156 @@
+#define FDP_MODULE "procdiff"
+#include <icebox/core.hpp>
+#include <icebox/log.hpp>
+#include <icebox/utils/file.hpp>
+#include <icebox/vm_area.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr uint64_t page_size = 0x1000;
+
+    uint64_t hash_page(const uint8_t* buf)
+    {
+        // fnv-1a over the page, cheap enough to hash gigabytes per second
+        auto hash = uint64_t{0xcbf29ce484222325};
+        for(size_t i = 0; i < page_size; ++i)
+        {
+            hash ^= buf[i];
+            hash *= 0x100000001b3;
+        }
+        return hash;
+    }
+
+    // baseline state: one hash per resident page of the va space
+    using Hashes = std::unordered_map<uint64_t, uint64_t>;
+
+    struct Stats
+    {
+        uint64_t pages_read;
+        uint64_t pages_changed;
+    };
+
+    bool for_each_resident_page(core::Core& core, proc_t proc, const std::function<void(uint64_t)>& on_page)
+    {
+        auto states = std::vector<uint8_t>{};
+        return vm_area::list(core, proc, [&](vm_area_t vma)
+        {
+            const auto span = vm_area::span(core, proc, vma);
+            if(!span || !span->size)
+                return walk_e::next;
+
+            states.resize(span->size / page_size + 1);
+            if(!memory::residency_map(core, proc, *span, &states[0]))
+                return walk_e::next;
+
+            for(uint64_t off = 0; off < span->size; off += page_size)
+                if(states[off / page_size] & memory::page_valid)
+                    on_page(span->addr + off);
+            return walk_e::next;
+        });
+    }
+
+    // one diff record per changed page: little-endian va then raw bytes
+    bool emit_page(file::Writer& out, uint64_t va, const uint8_t* buf)
+    {
+        auto* dst = reinterpret_cast<uint8_t*>(file::map_grow(out, sizeof va + page_size));
+        if(!dst)
+            return false;
+
+        memcpy(dst, &va, sizeof va);
+        memcpy(dst + sizeof va, buf, page_size);
+        return true;
+    }
+
+    opt<Stats> diff_once(core::Core& core, proc_t proc, Hashes& baseline, const fs::path& output)
+    {
+        auto out      = file::Writer{};
+        const auto ok = file::map_write(out, output, 4 * 1024 * 1024);
+        if(!ok)
+            return FAIL(std::nullopt, "unable to map %s", output.generic_string().data());
+
+        auto stats    = Stats{};
+        auto next     = Hashes{};
+        auto buf      = std::vector<uint8_t>(page_size);
+        const auto io = memory::make_io(core, proc);
+        next.reserve(baseline.size());
+        for_each_resident_page(core, proc, [&](uint64_t va)
+        {
+            if(!io.read_all(&buf[0], va, page_size))
+                return;
+
+            ++stats.pages_read;
+            const auto hash = hash_page(&buf[0]);
+            next[va]        = hash;
+            const auto it   = baseline.find(va);
+            if(it != baseline.end() && it->second == hash)
+                return;
+
+            ++stats.pages_changed;
+            if(!emit_page(out, va, &buf[0]))
+                LOG(ERROR, "unable to append page 0x%" PRIx64, va);
+        });
+        if(!file::map_close(out))
+            return FAIL(std::nullopt, "unable to close %s", output.generic_string().data());
+
+        baseline = std::move(next);
+        return stats;
+    }
+
+    int run_diffs(core::Core& core, const std::string& target, const fs::path& dir, int iterations, int delay_s)
+    {
+        LOG(INFO, "waiting for %s...", target.data());
+        const auto proc = process::wait(core, target, {});
+        if(!proc)
+            return FAIL(-1, "unable to wait for %s", target.data());
+
+        auto baseline = Hashes{};
+        for(int i = 0; i <= iterations; ++i)
+        {
+            state::pause(core);
+            vm_area::refresh(core, *proc);
+            const auto beg   = std::chrono::steady_clock::now();
+            const auto path  = dir / ("diff_" + std::to_string(i) + ".bin");
+            const auto stats = diff_once(core, *proc, baseline, path);
+            state::resume(core);
+            if(!stats)
+                return -1;
+
+            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - beg).count();
+            // iteration 0 only builds the baseline, every page differs
+            LOG(INFO, "iteration %d: %" PRIu64 " page(s) read, %" PRIu64 " changed, %" PRId64 " ms -> %s",
+                i, stats->pages_read, stats->pages_changed, ms, path.generic_string().data());
+            if(i < iterations)
+                std::this_thread::sleep_for(std::chrono::seconds(delay_s));
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    logg::init(argc, argv);
+    if(argc != 4 && argc != 5)
+        return FAIL(-1, "usage: procdiff <name> <process_name> <output_dir> [iterations]");
+
+    const auto name       = std::string{argv[1]};
+    const auto target     = std::string{argv[2]};
+    const auto dir        = fs::path{argv[3]};
+    const auto iterations = argc == 5 ? atoi(argv[4]) : 10;
+    LOG(INFO, "starting on %s", name.data());
+
+    const auto core = core::attach(name);
+    if(!core)
+        return FAIL(-1, "unable to start core at %s", name.data());
+
+    state::pause(*core);
+    const auto ret = run_diffs(*core, target, dir, iterations, 1);
+    state::resume(*core);
+    return ret;
+}
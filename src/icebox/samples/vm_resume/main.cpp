@@ -2,20 +2,107 @@
 #include <icebox/core.hpp>
 #include <icebox/log.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t elapsed_ns(Clock::time_point beg)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - beg).count();
+    }
+
+    uint64_t percentile(const std::vector<uint64_t>& sorted, double p)
+    {
+        const auto idx = std::min(sorted.size() - 1, static_cast<size_t>(p * static_cast<double>(sorted.size())));
+        return sorted[idx];
+    }
+
+    void report(const char* name, std::vector<uint64_t>& ns)
+    {
+        if(ns.empty())
+            return;
+
+        std::sort(ns.begin(), ns.end());
+        auto total = uint64_t{};
+        for(const auto it : ns)
+            total += it;
+        LOG(INFO, "%-12s n:%zd avg:%" PRIu64 " min:%" PRIu64 " p50:%" PRIu64 " p99:%" PRIu64 " p999:%" PRIu64 " max:%" PRIu64 " ns",
+            name, ns.size(), total / ns.size(), ns.front(),
+            percentile(ns, 0.50), percentile(ns, 0.99), percentile(ns, 0.999), ns.back());
+    }
+
+    template <typename T>
+    void bench(std::vector<uint64_t>& dst, size_t count, const T& operand)
+    {
+        dst.clear();
+        dst.reserve(count);
+        for(size_t i = 0; i < count; ++i)
+        {
+            const auto beg = Clock::now();
+            operand();
+            dst.push_back(elapsed_ns(beg));
+        }
+    }
+
+    int benchmark(core::Core& core, size_t iterations)
+    {
+        auto ns = std::vector<uint64_t>{};
+        state::pause(core);
+
+        // pause & resume, sampled in alternation so each pause sees a
+        // running guest & each resume a paused one
+        auto pause_ns  = std::vector<uint64_t>{};
+        auto resume_ns = std::vector<uint64_t>{};
+        pause_ns.reserve(iterations);
+        resume_ns.reserve(iterations);
+        for(size_t i = 0; i < iterations; ++i)
+        {
+            auto beg = Clock::now();
+            state::resume(core);
+            resume_ns.push_back(elapsed_ns(beg));
+            beg = Clock::now();
+            state::pause(core);
+            pause_ns.push_back(elapsed_ns(beg));
+        }
+        report("resume", resume_ns);
+        report("pause", pause_ns);
+
+        // single-step round trip, guest paused between samples
+        bench(ns, iterations, [&] { state::single_step(core); });
+        report("single_step", ns);
+
+        // breakpoint arm + disarm round trip on the current rip
+        const auto rip = registers::read(core, reg_e::rip);
+        bench(ns, iterations, [&]
+        {
+            const auto bp = state::break_on(core, "vm_resume_bench", rip, [] {});
+        });
+        report("breakpoint", ns);
+
+        state::resume(core);
+        return 0;
+    }
+}
+
 int main(int argc, char** argv)
 {
     logg::init(argc, argv);
-    if(argc != 2)
-        return FAIL(-1, "usage: vm_resume <name>");
+    if(argc != 2 && argc != 3)
+        return FAIL(-1, "usage: vm_resume <name> [iterations]");
 
-    const auto name = std::string{argv[1]};
-    LOG(INFO, "starting on %s", name.data());
+    const auto name       = std::string{argv[1]};
+    const auto iterations = argc == 3 ? static_cast<size_t>(std::stoull(argv[2])) : size_t{1000};
+    LOG(INFO, "starting on %s, %zd iterations", name.data(), iterations);
 
-    const auto core = core::attach(name);
+    // pause/resume/single-step never touch the os layer, skip detection
+    const auto core = core::attach_lazy(name);
     if(!core)
         return FAIL(-1, "unable to start core at %s", name.data());
 
-    state::pause(*core);
-    state::resume(*core);
-    return 0;
+    return benchmark(*core, iterations);
 }
@@ -238,6 +238,9 @@ namespace
         pcap::Writer pcap;
         int bp_id = 0;
 
+        if(!pcap.open(capture_path))
+            return FAIL(-1, "unable to open capture file %s", capture_path.data());
+
         symbols::load_drivers(core);
         // ndis!NdisSendNetBufferLists
         const auto NdisSendNetBufferLists = symbols::address(core, symbols::kernel, "ndis", "NdisSendNetBufferLists");
@@ -314,7 +317,9 @@ namespace
         while(std::chrono::high_resolution_clock::now() < end)
             state::exec(core);
 
-        pcap.write(capture_path);
+        if(!pcap.close())
+            return FAIL(-1, "unable to finish capture file %s", capture_path.data());
+
         return 0;
     }
 }
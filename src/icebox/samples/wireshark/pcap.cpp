@@ -1,7 +1,12 @@
 #include "pcap.hpp"
 
+#include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace
@@ -48,32 +53,46 @@ namespace
         uint16_t length;
     };
 
-    struct Packet
+    // longer packets are truncated, original_length keeps the real size
+    constexpr size_t max_packet_size = 0x10000;
+    // bounds capture memory to num_slots * max_packet_size
+    constexpr size_t num_slots = 64;
+
+    // reusable packet slot, the buffer is allocated once & never shrinks
+    struct Slot
     {
         pcap::metadata_t     meta;
-        std::vector<uint8_t> data;
+        uint32_t             cap_length;
+        uint32_t             original_length;
+        std::vector<uint8_t> buf;
     };
 }
 
 struct pcap::Writer::Data
 {
-    std::vector<Packet> packets;
+    FILE*                       file = nullptr;
+    std::array<Slot, num_slots> slots;
+    size_t                      head  = 0; // next slot to fill
+    size_t                      tail  = 0; // next slot to write
+    size_t                      count = 0; // filled slots
+    bool                        stop  = false;
+    bool                        ok    = true;
+    std::mutex                  mutex;
+    std::condition_variable     cv_push;
+    std::condition_variable     cv_pop;
+    std::thread                 writer;
 };
 
 pcap::Writer::Writer()
     : d(std::make_unique<Data>())
 {
+    for(auto& slot : d->slots)
+        slot.buf.resize(max_packet_size);
 }
 
-pcap::Writer::~Writer() = default;
-
-void pcap::Writer::add_packet(const metadata_t& m, const void* data, size_t size)
+pcap::Writer::~Writer()
 {
-    Packet p;
-    p.meta = m;
-    p.data.resize(size);
-    memcpy(&p.data[0], data, p.data.size());
-    d->packets.emplace_back(p);
+    close();
 }
 
 namespace
@@ -126,26 +145,26 @@ namespace
         return true;
     }
 
-    bool write_comment(FILE* file, Packet& p, uint32_t padding)
+    bool write_comment(FILE* file, const Slot& slot)
     {
         Option option;
         uint32_t paddingBuf = 0;
 
         option.code   = 1; // comment
-        option.length = (uint16_t) p.meta.comment.size();
+        option.length = (uint16_t) slot.meta.comment.size();
 
         auto bytes = fwrite(&option, 1, sizeof option, file);
         if(bytes != sizeof option)
             return false;
 
-        bytes = fwrite(p.meta.comment.data(), 1, option.length, file);
+        bytes = fwrite(slot.meta.comment.data(), 1, option.length, file);
         if(bytes != option.length)
             return false;
 
         if(option.length % 4)
         {
-            padding = 4 - (option.length % 4);
-            bytes   = fwrite(&paddingBuf, 1, padding, file);
+            const auto padding = 4 - (option.length % 4);
+            bytes              = fwrite(&paddingBuf, 1, padding, file);
             if(bytes != padding)
                 return false;
         }
@@ -159,53 +178,54 @@ namespace
         return true;
     }
 
-    bool write_packet(FILE* file, Packet& p, BlockHeader& hdr)
+    bool write_packet(FILE* file, const Slot& slot, BlockHeader& hdr)
     {
-        auto size             = p.data.size();
+        const auto size       = size_t{slot.cap_length};
         uint32_t optionLength = 0;
         uint32_t padding      = 0;
+        uint32_t paddingBuf   = 0;
         if(size % 4)
             padding = 4 - (size % 4);
 
-        if(!p.meta.comment.empty())
-            optionLength = 8 + (uint32_t) p.meta.comment.size();
+        if(!slot.meta.comment.empty())
+            optionLength = 8 + (uint32_t) slot.meta.comment.size();
 
         EPB epb;
-        hdr.type = typeEPB;
-        if(sizeof(BlockHeader) + sizeof(EPB) + sizeof hdr.length + size + padding + optionLength > UINT32_MAX)
-            return false;
-
+        hdr.type   = typeEPB;
         hdr.length = static_cast<uint32_t>(sizeof(BlockHeader) + sizeof(EPB) + sizeof hdr.length + size + padding + optionLength);
         auto bytes = fwrite(&hdr, 1, sizeof hdr, file);
         if(bytes != sizeof hdr)
             return false;
 
-        auto timestamp = p.meta.timestamp;
+        auto timestamp = slot.meta.timestamp;
         if(!timestamp)
-            timestamp = p.meta.sec * 1000000 + p.meta.usec;
-
-        epb.if_id          = 0;
-        epb.timestamp_high = timestamp >> 32;
-        epb.timestamp_low  = timestamp & 0xFFFFFFFF;
-        if(size > UINT32_MAX)
-            return false;
+            timestamp = slot.meta.sec * 1000000 + slot.meta.usec;
 
-        epb.cap_length      = static_cast<uint32_t>(size);
-        epb.original_length = static_cast<uint32_t>(size);
+        epb.if_id           = 0;
+        epb.timestamp_high  = timestamp >> 32;
+        epb.timestamp_low   = timestamp & 0xFFFFFFFF;
+        epb.cap_length      = slot.cap_length;
+        epb.original_length = slot.original_length;
 
         bytes = fwrite(&epb, 1, sizeof epb, file);
         if(bytes != sizeof epb)
             return false;
 
-        auto packet_data = p.data;
-        bytes            = fwrite(&packet_data[0], 1, size + padding, file);
-        if(bytes != size + padding)
+        bytes = fwrite(&slot.buf[0], 1, size, file);
+        if(bytes != size)
             return false;
 
+        if(padding)
+        {
+            bytes = fwrite(&paddingBuf, 1, padding, file);
+            if(bytes != padding)
+                return false;
+        }
+
         // write comment option if any
-        if(!p.meta.comment.empty())
+        if(!slot.meta.comment.empty())
         {
-            const auto ok = write_comment(file, p, padding);
+            const auto ok = write_comment(file, slot);
             if(!ok)
                 return false;
         }
@@ -217,37 +237,88 @@ namespace
         return true;
     }
 
-    bool close_and_exit(FILE* file, bool ret)
+    void run_writer(pcap::Writer::Data& d)
     {
-        fclose(file);
-        return ret;
+        BlockHeader hdr;
+        while(true)
+        {
+            auto lock = std::unique_lock<std::mutex>{d.mutex};
+            d.cv_pop.wait(lock, [&] { return d.count || d.stop; });
+            if(!d.count && d.stop)
+                return;
+
+            // the producer never touches slots[tail] until count drops,
+            // write it with the lock released
+            const auto& slot = d.slots[d.tail];
+            lock.unlock();
+            const auto ok = write_packet(d.file, slot, hdr);
+            fflush(d.file);
+            lock.lock();
+            if(!ok)
+                d.ok = false;
+            d.tail = (d.tail + 1) % num_slots;
+            d.count--;
+            d.cv_push.notify_one();
+        }
     }
 }
 
-bool pcap::Writer::write(const std::string& filepath)
+bool pcap::Writer::open(const std::string& filepath)
 {
+    if(d->file)
+        return false;
+
     auto file = fopen(filepath.data(), "wb");
     if(file == nullptr)
         return false;
 
-    // Write the Section Header Block
     BlockHeader hdr;
     auto ok = write_hdr(file, hdr);
+    if(ok)
+        ok = write_idb(file, hdr);
     if(!ok)
-        return close_and_exit(file, false);
+    {
+        fclose(file);
+        return false;
+    }
 
-    // IDB
-    ok = write_idb(file, hdr);
-    if(!ok)
-        return close_and_exit(file, false);
+    d->file   = file;
+    d->writer = std::thread{[data = d.get()] { run_writer(*data); }};
+    return true;
+}
+
+void pcap::Writer::add_packet(const metadata_t& m, const void* data, size_t size)
+{
+    if(!d->file)
+        return;
+
+    auto lock = std::unique_lock<std::mutex>{d->mutex};
+    // block until a slot frees up rather than grow without bound
+    d->cv_push.wait(lock, [&] { return d->count < num_slots; });
+    auto& slot           = d->slots[d->head];
+    const auto cap       = std::min(size, max_packet_size);
+    slot.meta            = m;
+    slot.cap_length      = static_cast<uint32_t>(cap);
+    slot.original_length = static_cast<uint32_t>(size);
+    memcpy(&slot.buf[0], data, cap);
+    d->head = (d->head + 1) % num_slots;
+    d->count++;
+    d->cv_pop.notify_one();
+}
+
+bool pcap::Writer::close()
+{
+    if(!d->file)
+        return false;
 
-    // Write an Enhanced Packet Block for each packet
-    for(auto& p : d->packets)
     {
-        ok = write_packet(file, p, hdr);
-        if(!ok)
-            return close_and_exit(file, false);
+        const auto lock = std::lock_guard<std::mutex>{d->mutex};
+        d->stop         = true;
     }
-
-    return close_and_exit(file, true);
+    d->cv_pop.notify_all();
+    d->writer.join();
+    fclose(d->file);
+    d->file = nullptr;
+    d->stop = false;
+    return d->ok;
 }
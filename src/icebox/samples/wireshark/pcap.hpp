@@ -3,7 +3,6 @@
 #include <memory>
 #include <stdint.h>
 #include <string>
-#include <vector>
 
 namespace pcap
 {
@@ -16,13 +15,18 @@ namespace pcap
         std::string comment;
     };
 
+    // streaming pcapng writer: packets are copied into a bounded ring of
+    // reusable fixed-size buffers & appended to the output file by a
+    // background thread, so memory stays constant for any capture length
+    // & already-written packets survive a crash
     struct Writer
     {
          Writer();
         ~Writer();
 
+        bool    open        (const std::string& filepath);
         void    add_packet  (const metadata_t& m, const void* data, size_t size);
-        bool    write       (const std::string& filepath);
+        bool    close       ();
 
         struct Data;
         std::unique_ptr<Data> d;
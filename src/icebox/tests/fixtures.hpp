@@ -0,0 +1,83 @@
+#pragma once
+
+#include <icebox/core.hpp>
+
+#define GTEST_DONT_DEFINE_FAIL 1
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fixtures
+{
+    // ICEBOX_VM_POOL lists clone names, comma separated; each gtest
+    // shard leases one clone so parallel shards never share a vm:
+    //   ICEBOX_VM_POOL=win10a,win10b GTEST_TOTAL_SHARDS=2 GTEST_SHARD_INDEX=n
+    inline std::vector<std::string> vm_pool(const std::string& fallback)
+    {
+        const auto* env = std::getenv("ICEBOX_VM_POOL");
+        if(!env)
+            return {fallback};
+
+        auto ret    = std::vector<std::string>{};
+        auto stream = std::istringstream{env};
+        auto name   = std::string{};
+        while(std::getline(stream, name, ','))
+            if(!name.empty())
+                ret.push_back(name);
+        if(ret.empty())
+            ret.push_back(fallback);
+        return ret;
+    }
+
+    inline std::string shard_vm(const std::string& fallback)
+    {
+        const auto pool   = vm_pool(fallback);
+        const auto* shard = std::getenv("GTEST_SHARD_INDEX");
+        const auto idx    = shard ? static_cast<size_t>(std::atoll(shard)) : size_t{0};
+        return pool[idx % pool.size()];
+    }
+
+    // per-test attach/restore isolation: the vm state is saved once
+    // after attach and restored on teardown, so a failing test cannot
+    // leak guest state into the next one; the restore only rewrites
+    // pages dirtied by the test
+    struct VmTest
+        : public ::testing::Test
+    {
+      protected:
+        explicit VmTest(std::string vm)
+            : vm_(std::move(vm))
+        {
+        }
+
+        void SetUp() override
+        {
+            ptr_core = core::attach(fixtures::shard_vm(vm_));
+            ASSERT_TRUE(ptr_core);
+
+            const auto paused = state::pause(*ptr_core);
+            ASSERT_TRUE(paused);
+            saved_ = state::save(*ptr_core);
+        }
+
+        void TearDown() override
+        {
+            if(!ptr_core)
+                return;
+
+            if(saved_)
+                EXPECT_TRUE(state::restore(*ptr_core));
+            const auto resumed = state::resume(*ptr_core);
+            EXPECT_TRUE(resumed);
+        }
+
+        std::shared_ptr<core::Core> ptr_core;
+
+      private:
+        std::string vm_;
+        bool        saved_ = false;
+    };
+} // namespace fixtures
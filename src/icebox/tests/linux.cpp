@@ -2,6 +2,8 @@
 #include <icebox/core.hpp>
 #include <icebox/log.hpp>
 
+#include "fixtures.hpp"
+
 #define GTEST_DONT_DEFINE_FAIL 1
 #include <gtest/gtest.h>
 
@@ -13,25 +15,13 @@ namespace
     constexpr char bintest_name[] = "linux_tst_ibx";
 
     struct Linux
-        : public ::testing::Test
+        : public fixtures::VmTest
     {
       protected:
-        void SetUp() override
-        {
-            ptr_core = core::attach(vm_name);
-            ASSERT_TRUE(ptr_core);
-
-            const auto paused = state::pause(*ptr_core);
-            ASSERT_TRUE(paused);
-        }
-
-        void TearDown() override
+        Linux()
+            : fixtures::VmTest(vm_name)
         {
-            const auto resumed = state::resume(*ptr_core);
-            EXPECT_TRUE(resumed);
         }
-
-        std::shared_ptr<core::Core> ptr_core;
     };
 }
 
@@ -39,7 +29,7 @@ TEST(Linux_, attach_detach)
 {
     for(size_t i = 0; i < 16; ++i)
     {
-        const auto core = core::attach(vm_name);
+        const auto core = core::attach(fixtures::shard_vm(vm_name));
         EXPECT_TRUE(!!core);
         state::resume(*core);
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
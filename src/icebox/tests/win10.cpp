@@ -6,6 +6,8 @@
 #include <icebox/tracer/tracer.hpp>
 #include <icebox/utils/path.hpp>
 
+#include "fixtures.hpp"
+
 #include <fmt/format.h>
 
 #define GTEST_DONT_DEFINE_FAIL 1
@@ -18,24 +20,13 @@
 namespace
 {
     struct win10
-        : public ::testing::Test
+        : public fixtures::VmTest
     {
       protected:
-        void SetUp() override
+        win10()
+            : fixtures::VmTest("win10")
         {
-            ptr_core = core::attach("win10");
-            ASSERT_TRUE(ptr_core);
-            const auto paused = state::pause(*ptr_core);
-            ASSERT_TRUE(paused);
         }
-
-        void TearDown() override
-        {
-            const auto resumed = state::resume(*ptr_core);
-            EXPECT_TRUE(resumed);
-        }
-
-        std::shared_ptr<core::Core> ptr_core;
     };
 }
 
@@ -43,7 +34,7 @@ TEST(win10_, attach_detach)
 {
     for(size_t i = 0; i < 16; ++i)
     {
-        const auto core = core::attach("win10");
+        const auto core = core::attach(fixtures::shard_vm("win10"));
         EXPECT_TRUE(!!core);
         state::resume(*core);
         std::this_thread::sleep_for(std::chrono::milliseconds(100));